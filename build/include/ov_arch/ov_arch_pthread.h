@@ -0,0 +1 @@
+/root/repo/src/lib/ov_arch/include/ov_arch_pthread.h
\ No newline at end of file
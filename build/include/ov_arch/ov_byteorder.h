@@ -0,0 +1 @@
+/root/repo/src/lib/ov_arch/include/ov_byteorder.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_arch/include/testrun.h
\ No newline at end of file
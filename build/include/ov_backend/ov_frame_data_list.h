@@ -0,0 +1 @@
+/root/repo/src/lib/ov_backend/include/ov_frame_data_list.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_backend/include/ov_minion_app.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_backend/include/ov_signal_monitor.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_backend/include/ov_signaling_server_mockup.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_base64.h
\ No newline at end of file
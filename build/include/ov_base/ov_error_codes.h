@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_error_codes.h
\ No newline at end of file
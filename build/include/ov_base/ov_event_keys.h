@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_event_keys.h
\ No newline at end of file
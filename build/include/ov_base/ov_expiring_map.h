@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_expiring_map.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_linked_list.h
\ No newline at end of file
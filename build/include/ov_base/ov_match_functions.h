@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_match_functions.h
\ No newline at end of file
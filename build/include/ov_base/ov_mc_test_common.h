@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_mc_test_common.h
\ No newline at end of file
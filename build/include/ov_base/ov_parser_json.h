@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_parser_json.h
\ No newline at end of file
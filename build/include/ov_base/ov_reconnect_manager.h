@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_reconnect_manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_rtp_source_stats.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_base/include/ov_thread_pool.h
\ No newline at end of file
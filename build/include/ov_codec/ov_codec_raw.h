@@ -0,0 +1 @@
+/root/repo/src/lib/ov_codec/include/ov_codec_raw.h
\ No newline at end of file
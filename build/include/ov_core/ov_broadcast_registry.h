@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_broadcast_registry.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_event_connection.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_event_engine.h
\ No newline at end of file
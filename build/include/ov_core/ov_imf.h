@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_imf.h
\ No newline at end of file
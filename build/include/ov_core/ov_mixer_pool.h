@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_mixer_pool.h
\ No newline at end of file
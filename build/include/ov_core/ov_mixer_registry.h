@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_mixer_registry.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_recorder_events.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_response_state.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_stream_parameters.h
\ No newline at end of file
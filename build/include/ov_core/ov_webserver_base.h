@@ -0,0 +1 @@
+/root/repo/src/lib/ov_core/include/ov_webserver_base.h
\ No newline at end of file
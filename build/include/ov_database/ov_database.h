@@ -0,0 +1 @@
+/root/repo/src/lib/ov_database/include/ov_database.h
\ No newline at end of file
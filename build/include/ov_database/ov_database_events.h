@@ -0,0 +1 @@
+/root/repo/src/lib/ov_database/include/ov_database_events.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_database/sqlite3/sqlite3.h
\ No newline at end of file
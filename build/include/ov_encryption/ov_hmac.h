@@ -0,0 +1 @@
+/root/repo/src/lib/ov_encryption/include/ov_hmac.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_format/include/ov_file_format.h
\ No newline at end of file
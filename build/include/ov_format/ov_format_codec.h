@@ -0,0 +1 @@
+/root/repo/src/lib/ov_format/include/ov_format_codec.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_format/include/ov_format_ipv4.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_format/include/ov_format_ogg_opus.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_ice/include/ov_ice_dtls_cookie.h
\ No newline at end of file
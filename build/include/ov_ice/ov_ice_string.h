@@ -0,0 +1 @@
+/root/repo/src/lib/ov_ice/include/ov_ice_string.h
\ No newline at end of file
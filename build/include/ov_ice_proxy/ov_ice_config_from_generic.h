@@ -0,0 +1 @@
+/root/repo/src/lib/ov_ice_proxy/include/ov_ice_config_from_generic.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_ice_proxy/include/ov_ice_proxy_generic_dtls_config.h
\ No newline at end of file
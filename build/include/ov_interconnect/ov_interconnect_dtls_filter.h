@@ -0,0 +1 @@
+/root/repo/src/lib/ov_interconnect/include/ov_interconnect_dtls_filter.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_interconnect/include/ov_interconnect_session.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_ldap/include/ov_ldap.h
\ No newline at end of file
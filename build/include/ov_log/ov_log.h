@@ -0,0 +1 @@
+/root/repo/src/lib/ov_log/include/ov_log.h
\ No newline at end of file
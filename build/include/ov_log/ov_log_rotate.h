@@ -0,0 +1 @@
+/root/repo/src/lib/ov_log/include/ov_log_rotate.h
\ No newline at end of file
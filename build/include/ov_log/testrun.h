@@ -0,0 +1 @@
+/root/repo/src/lib/ov_log/include/testrun.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_pcm16s/include/ov_pcm16_mod.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_pcm16s/include/ov_pcm_resampler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_pcm_gen/include/ov_pcm_gen.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_sip/include/ov_sip_headers.h
\ No newline at end of file
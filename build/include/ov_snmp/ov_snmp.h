@@ -0,0 +1 @@
+/root/repo/src/lib/ov_snmp/include/ov_snmp.h
\ No newline at end of file
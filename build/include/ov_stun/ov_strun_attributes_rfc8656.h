@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_strun_attributes_rfc8656.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_stun_attr_alternate_domain.h
\ No newline at end of file
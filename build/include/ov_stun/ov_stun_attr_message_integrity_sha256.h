@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_stun_attr_message_integrity_sha256.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_stun_attributes_rfc8489.h
\ No newline at end of file
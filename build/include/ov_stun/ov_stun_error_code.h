@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_stun_error_code.h
\ No newline at end of file
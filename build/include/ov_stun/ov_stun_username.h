@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_stun_username.h
\ No newline at end of file
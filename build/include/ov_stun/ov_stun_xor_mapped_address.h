@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_stun_xor_mapped_address.h
\ No newline at end of file
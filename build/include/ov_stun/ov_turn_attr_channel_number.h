@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_turn_attr_channel_number.h
\ No newline at end of file
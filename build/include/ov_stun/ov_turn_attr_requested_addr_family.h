@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_turn_attr_requested_addr_family.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_stun/include/ov_turn_channel_bind.h
\ No newline at end of file
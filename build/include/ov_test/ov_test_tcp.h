@@ -0,0 +1 @@
+/root/repo/src/lib/ov_test/include/ov_test_tcp.h
\ No newline at end of file
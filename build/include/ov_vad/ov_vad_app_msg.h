@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vad/include/ov_vad_app_msg.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vad/include/ov_vad_thread_msg.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_value/include/ov_serde_app.h
\ No newline at end of file
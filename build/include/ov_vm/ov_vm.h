@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vm/include/ov_vm.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vm/include/ov_vm_prog.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs/include/ov_mc_backend_registry.h
\ No newline at end of file
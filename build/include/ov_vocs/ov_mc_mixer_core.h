@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs/include/ov_mc_mixer_core.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs/include/ov_mc_sip_msg.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs/include/ov_vocs_loop.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs/include/ov_vocs_msg.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs/include/ov_vocs_recorder.h
\ No newline at end of file
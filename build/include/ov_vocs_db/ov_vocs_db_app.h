@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs_db/include/ov_vocs_db_app.h
\ No newline at end of file
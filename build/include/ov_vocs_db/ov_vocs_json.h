@@ -0,0 +1 @@
+/root/repo/src/lib/ov_vocs_db/include/ov_vocs_json.h
\ No newline at end of file
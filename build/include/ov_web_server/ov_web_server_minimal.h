@@ -0,0 +1 @@
+/root/repo/src/lib/ov_web_server/include/ov_web_server_minimal.h
\ No newline at end of file
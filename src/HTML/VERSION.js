@@ -0,0 +1,2 @@
+// Auto-Generated - DO NOT MODIFY
+VERSION_NUMBER = "2.5.1";
@@ -27,26 +27,34 @@
 /*----------------------------------------------------------------------------*/
 
 #include "ov_rtp_mixer.h"
+#include <ov_arch/ov_arch_math.h>
 #include <ov_base/ov_convert.h>
 #include <ov_base/ov_dict.h>
-#include <ov_base/ov_rtp_frame_buffer.h>
-#include <ov_base/ov_thread_lock.h>
+#include <ov_base/ov_spsc_queue.h>
+#include <ov_base/ov_time.h>
 #include <ov_codec/ov_codec.h>
 #include <ov_codec/ov_codec_factory.h>
 #include <ov_codec/ov_codec_opus.h>
 #include <ov_pcm16s/ov_pcm16_mod.h>
 #include <ov_pcm_gen/ov_pcm_gen.h>
+#include <stdatomic.h>
 
 /*----------------------------------------------------------------------------*/
 
 #define MAGIC_BYTES 0x2f2d2e2f
 
+/* Frames received within one period over all streams */
+#define FRAME_QUEUE_CAPACITY 256
+
 struct ov_rtp_mixer_struct {
 
     uint32_t magic_bytes;
 
-    ov_rtp_frame_buffer *frame_buffer;
-    ov_thread_lock frame_buffer_lock;
+    /* Adding thread -> mixing thread, frames are owned by the queue */
+    ov_spsc_queue *frame_queue;
+
+    /* Frames rejected by the adding thread due to a full queue */
+    _Atomic uint64_t frames_rejected;
 
     struct {
 
@@ -58,6 +66,8 @@ struct ov_rtp_mixer_struct {
 
         uint32_t ssid_to_cancel;
 
+        size_t max_num_frames_per_stream;
+
     } settings;
 
     struct {
@@ -72,13 +82,25 @@ struct ov_rtp_mixer_struct {
 
     } comfort_noise;
 
-    ov_dict *codecs;
+    /* Everything below is only touched by the mixing thread */
+
+    ov_dict *streams;
+
+    struct {
+
+        ov_buffer *decoded_16bit;
+        int32_t *decoded_32bit;
+        int32_t *mixed_32bit;
+        ov_buffer *pcm16;
+
+    } scratch;
+
+    ov_rtp_mixer_stats stats;
 };
 
 /*----------------------------------------------------------------------------*/
 
 static ov_rtp_mixer const *as_mixer(void const *ptr) {
-
     ov_rtp_mixer const *mixer = ptr;
 
     if ((0 != ptr) && (MAGIC_BYTES == mixer->magic_bytes)) {
@@ -95,13 +117,20 @@ typedef struct {
     ov_codec *codec;
     time_t last_used_epoch_secs; // For garbage collection
 
-} codec_entry;
+    /* Frames in order of their sequence numbers, oldest first */
+    size_t num_frames;
+    ov_rtp_frame *frames[];
 
-/*----------------------------------------------------------------------------*/
+} stream_entry;
 
-static codec_entry *codec_entry_free(codec_entry *entry) {
+/*----------------------------------------------------------------------------*/
 
+static stream_entry *stream_entry_free(stream_entry *entry) {
     if (0 != entry) {
+        for (size_t i = 0; i < entry->num_frames; ++i) {
+            entry->frames[i] = ov_rtp_frame_free(entry->frames[i]);
+        }
+
         entry->codec = ov_codec_free(entry->codec);
         return ov_free(entry);
     }
@@ -111,72 +140,114 @@ static codec_entry *codec_entry_free(codec_entry *entry) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_codec *codec_from_codec_entry(codec_entry *entry) {
+static void *stream_entry_free_void(void *entry) {
+    return (void *)stream_entry_free(entry);
+}
 
-    if (0 != entry) {
+/*----------------------------------------------------------------------------*/
 
-        entry->last_used_epoch_secs = time(0);
-        return entry->codec;
+static stream_entry *get_stream_for_ssrc(ov_rtp_mixer *self,
+                                         uint32_t ssrc) {
+    intptr_t key = ssrc;
+    stream_entry *entry = ov_dict_get(self->streams, (void *)key);
 
-    } else {
+    if (0 == entry) {
+        entry = calloc(1, sizeof(stream_entry) +
+                              self->settings.max_num_frames_per_stream *
+                                  sizeof(ov_rtp_frame *));
 
-        return 0;
+        if (0 != entry) {
+            entry->codec =
+                ov_codec_factory_get_codec(0, ov_codec_opus_id(), key, 0);
+
+            if (!ov_dict_set(self->streams, (void *)key, entry, 0)) {
+                entry = stream_entry_free(entry);
+            }
+        }
     }
+
+    if (0 != entry) {
+        entry->last_used_epoch_secs = time(0);
+    }
+
+    return entry;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static ov_codec *get_codec_for_ssrc(ov_rtp_mixer *self, uint32_t ssrc) {
-
-    intptr_t key = ssrc;
-    codec_entry *codec = 0;
+static int16_t sequence_diff(ov_rtp_frame const *a, ov_rtp_frame const *b) {
+    // Wraps around at 2^16
+    return (int16_t)(a->expanded.sequence_number -
+                     b->expanded.sequence_number);
+}
 
-    if (ov_ptr_valid(self, "Cannot get Codec - invalid RTP mixer pointer")) {
+/*----------------------------------------------------------------------------*/
 
-        codec = ov_dict_get(self->codecs, (void *)key);
+/**
+ * @return frame that was not stored (duplicate or too old) or dropped to make
+ * room, or 0
+ */
+static ov_rtp_frame *stream_add_frame(stream_entry *entry, size_t capacity,
+                                      ov_rtp_frame *frame) {
+    size_t pos = entry->num_frames;
 
-        if (!codec) {
+    while ((0 < pos) && (0 > sequence_diff(frame, entry->frames[pos - 1]))) {
+        --pos;
+    }
 
-            codec = calloc(1, sizeof(codec_entry));
+    if ((0 < pos) && (0 == sequence_diff(frame, entry->frames[pos - 1]))) {
+        return frame;
+    }
 
-            codec->codec =
-                ov_codec_factory_get_codec(0, ov_codec_opus_id(), key, 0);
+    ov_rtp_frame *dropped = 0;
 
-            if (codec && (!ov_dict_set(self->codecs, (void *)key, codec, 0))) {
-                codec = codec_entry_free(codec);
-            }
+    if (capacity <= entry->num_frames) {
+        if (0 == pos) {
+            return frame;
         }
-    }
 
-    return codec_from_codec_entry(codec);
-}
+        dropped = entry->frames[0];
+        memmove(entry->frames, entry->frames + 1,
+                (entry->num_frames - 1) * sizeof(ov_rtp_frame *));
 
-/*----------------------------------------------------------------------------*/
+        --entry->num_frames;
+        --pos;
+    }
 
-static ov_codec *get_codec_for_frame(ov_rtp_mixer *mixer,
-                                     const ov_rtp_frame *frame) {
+    memmove(entry->frames + pos + 1, entry->frames + pos,
+            (entry->num_frames - pos) * sizeof(ov_rtp_frame *));
 
-    if (ov_ptr_valid(frame,
-                     "Cannot get codec for RTP frame: invalid frame pointer")) {
+    entry->frames[pos] = frame;
+    ++entry->num_frames;
 
-        return get_codec_for_ssrc(mixer, frame->expanded.ssrc);
+    return dropped;
+}
 
-    } else {
+/*----------------------------------------------------------------------------*/
 
+static ov_rtp_frame *stream_pop_frame(stream_entry *entry) {
+    if (0 == entry->num_frames) {
         return 0;
     }
+
+    ov_rtp_frame *frame = entry->frames[0];
+
+    --entry->num_frames;
+    memmove(entry->frames, entry->frames + 1,
+            entry->num_frames * sizeof(ov_rtp_frame *));
+
+    return frame;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static ov_buffer *create_comfort_noise_for_default_frame(ov_rtp_mixer *self) {
-
+static ov_buffer *
+create_comfort_noise_for_default_frame(ov_rtp_mixer *self) {
     ov_buffer *buf16 = 0;
 
     if (ov_ptr_valid(self,
                      "Cannot initialize comfort noise buffer - invalid mixer "
                      "pointer")) {
-
         ov_pcm_gen_config cfg = {
             .frame_length_usecs = 1000 * self->settings.frame_length_ms,
             .sample_rate_hertz = self->settings.sample_rate_hertz,
@@ -200,24 +271,51 @@ static ov_buffer *create_comfort_noise_for_default_frame(ov_rtp_mixer *self) {
 
 /*----------------------------------------------------------------------------*/
 
-static void *codec_entry_free_void(void *codec) {
+static void *rtp_frame_free_void(void *frame) {
+    return (void *)ov_rtp_frame_free(frame);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool create_scratch(ov_rtp_mixer *self) {
+    size_t samples = self->settings.decoded_frame_length_samples;
 
-    return (void *)codec_entry_free(codec);
+    self->scratch.decoded_16bit = ov_buffer_create(samples * sizeof(int16_t));
+    self->scratch.decoded_32bit = calloc(samples, sizeof(int32_t));
+    self->scratch.mixed_32bit = calloc(samples, sizeof(int32_t));
+    self->scratch.pcm16 = ov_buffer_create(samples * sizeof(int16_t));
+
+    if ((0 == self->scratch.pcm16) || (0 == self->scratch.decoded_16bit)) {
+        return false;
+    }
+
+    self->scratch.pcm16->length = samples * sizeof(int16_t);
+
+    return (0 != self->scratch.decoded_32bit) &&
+           (0 != self->scratch.mixed_32bit);
 }
 
 /*----------------------------------------------------------------------------*/
 
-ov_rtp_mixer *ov_rtp_mixer_create(ov_rtp_mixer_config cfg) {
+static void free_scratch(ov_rtp_mixer *self) {
+    self->scratch.decoded_16bit = ov_buffer_free(self->scratch.decoded_16bit);
+    self->scratch.decoded_32bit = ov_free(self->scratch.decoded_32bit);
+    self->scratch.mixed_32bit = ov_free(self->scratch.mixed_32bit);
+    self->scratch.pcm16 = ov_buffer_free(self->scratch.pcm16);
+}
 
-    ov_rtp_frame_buffer_config fbconf = {
-        .num_frames_to_buffer_per_stream =
-            OV_OR_DEFAULT(cfg.max_num_frames_per_stream, 10),
-    };
+/*----------------------------------------------------------------------------*/
 
+ov_rtp_mixer *ov_rtp_mixer_create(ov_rtp_mixer_config cfg) {
     ov_rtp_mixer *mixer = calloc(1, sizeof(ov_rtp_mixer));
 
+    if (!ov_ptr_valid(mixer, "Could not create RTP mixer - out of memory")) {
+        return 0;
+    }
+
     mixer->magic_bytes = MAGIC_BYTES;
-    mixer->frame_buffer = ov_rtp_frame_buffer_create(fbconf);
+    mixer->frame_queue = ov_spsc_queue_create(FRAME_QUEUE_CAPACITY);
+    atomic_init(&mixer->frames_rejected, 0);
     mixer->rtp_keepalive = true;
     mixer->comfort_noise.enabled = (0 == cfg.comfort_noise_max_amplitude);
 
@@ -238,15 +336,20 @@ ov_rtp_mixer *ov_rtp_mixer_create(ov_rtp_mixer_config cfg) {
 
     mixer->settings.ssid_to_cancel = cfg.ssid_to_cancel;
 
+    mixer->settings.max_num_frames_per_stream =
+        OV_OR_DEFAULT(cfg.max_num_frames_per_stream, 10);
+
     mixer->comfort_noise.noisy_frame_16bit =
         create_comfort_noise_for_default_frame(mixer);
 
     ov_dict_config d_config = ov_dict_intptr_key_config(255);
-    d_config.value.data_function.free = codec_entry_free_void;
-    mixer->codecs = ov_dict_create(d_config);
+    d_config.value.data_function.free = stream_entry_free_void;
+    mixer->streams = ov_dict_create(d_config);
 
-    ov_thread_lock_init(&mixer->frame_buffer_lock,
-                        1000 * OV_DEFAULT_FRAME_LENGTH_MS / 2.0);
+    if ((0 == mixer->frame_queue) || (!create_scratch(mixer))) {
+        ov_log_error("Could not create RTP mixer");
+        mixer = ov_rtp_mixer_free(mixer);
+    }
 
     return mixer;
 }
@@ -256,12 +359,14 @@ ov_rtp_mixer *ov_rtp_mixer_create(ov_rtp_mixer_config cfg) {
 ov_rtp_mixer *ov_rtp_mixer_free(ov_rtp_mixer *self) {
     if (ov_ptr_valid(as_mixer(self),
                      "Cannot free RTP mixer: Invalid pointer")) {
-        self->frame_buffer = ov_rtp_frame_buffer_free(self->frame_buffer);
-        ov_thread_lock_clear(&self->frame_buffer_lock);
-        self->codecs = ov_dict_free(self->codecs);
+        self->frame_queue =
+            ov_spsc_queue_free(self->frame_queue, rtp_frame_free_void);
+        self->streams = ov_dict_free(self->streams);
         self->comfort_noise.noisy_frame_16bit =
             ov_buffer_free(self->comfort_noise.noisy_frame_16bit);
 
+        free_scratch(self);
+
         return ov_free(self);
 
     } else {
@@ -271,30 +376,17 @@ ov_rtp_mixer *ov_rtp_mixer_free(ov_rtp_mixer *self) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_rtp_frame *frame_buffer_add(ov_thread_lock *lock,
-                                      ov_rtp_frame_buffer *buffer,
-                                      ov_rtp_frame *frame) {
-    if (ov_thread_lock_try_lock(lock)) {
-        frame = ov_rtp_frame_buffer_add(buffer, frame);
-
-        ov_thread_lock_unlock(lock);
-    }
-    return frame;
-}
-
-/*----------------------------------------------------------------------------*/
-
 bool ov_rtp_mixer_add_frame(ov_rtp_mixer *self, ov_rtp_frame *frame) {
     if (ov_ptr_valid(
             self, "Cannot add RTP frame to mixing buffer - invalid pointer") &&
         ov_ptr_valid(
             frame, "Cannot add RTP frame to mixing buffer - invalid pointer")) {
-
         if (self->settings.ssid_to_cancel == frame->expanded.ssrc) {
             ov_rtp_frame_free(frame);
-        } else {
-            ov_rtp_frame_free(frame_buffer_add(&self->frame_buffer_lock,
-                                               self->frame_buffer, frame));
+        } else if (!ov_spsc_queue_push(self->frame_queue, frame)) {
+            atomic_fetch_add_explicit(&self->frames_rejected, 1,
+                                      memory_order_relaxed);
+            ov_rtp_frame_free(frame);
         }
 
         return true;
@@ -306,13 +398,21 @@ bool ov_rtp_mixer_add_frame(ov_rtp_mixer *self, ov_rtp_frame *frame) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_list *free_frame_list(ov_list *list) {
-    for (ov_rtp_frame *frame = ov_list_pop(list); 0 != frame;
-         frame = ov_list_pop(list)) {
-        frame = ov_rtp_frame_free(frame);
-    }
+static void take_queued_frames(ov_rtp_mixer *self) {
+    for (ov_rtp_frame *frame = ov_spsc_queue_pop(self->frame_queue);
+         0 != frame; frame = ov_spsc_queue_pop(self->frame_queue)) {
+        stream_entry *entry = get_stream_for_ssrc(self, frame->expanded.ssrc);
 
-    return ov_list_free(list);
+        if (0 != entry) {
+            frame = stream_add_frame(
+                entry, self->settings.max_num_frames_per_stream, frame);
+        }
+
+        if (0 != frame) {
+            ++self->stats.frames_dropped;
+            frame = ov_rtp_frame_free(frame);
+        }
+    }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -338,134 +438,162 @@ static bool decode_frame(ov_codec *codec, ov_rtp_frame *frame,
 
 /*----------------------------------------------------------------------------*/
 
-static ov_buffer *mix_frames(ov_rtp_mixer *self, ov_list *frames,
-                             size_t decoded_frame_length_samples) {
-    size_t num_frames = ov_list_count(frames);
-    size_t num_mixed_frames = 0;
-
-    size_t decoded_len_16bit = decoded_frame_length_samples * sizeof(int16_t);
-    size_t decoded_len_32bit = decoded_frame_length_samples * sizeof(int32_t);
-
-    ov_buffer *decoded_16bit = ov_buffer_create(decoded_len_16bit);
-    decoded_16bit->length = decoded_len_16bit;
-
-    ov_buffer *decoded_32bit = ov_buffer_create(decoded_len_32bit);
-    decoded_32bit->length = decoded_len_32bit;
-
-    ov_buffer *mixed_32bit = ov_buffer_create(decoded_len_32bit);
-    mixed_32bit->length = decoded_len_32bit;
-    memset(mixed_32bit->start, 0, mixed_32bit->length);
-
-    for (size_t i = 0; i < num_frames; ++i) {
-        ov_rtp_frame *frame = ov_list_pop(frames);
-
-        if (decode_frame(get_codec_for_frame(self, frame), frame,
-                         decoded_16bit) &&
-            (ov_ptr_valid(decoded_16bit, "Could not decode RTP frame") &&
-             ov_cond_valid(decoded_len_16bit == decoded_16bit->length,
-                           "Decoded RTP frame has unexpected length") &&
-             (ov_cond_valid(ov_pcm_16_scale_to_32(
-                                decoded_frame_length_samples,
-                                (int16_t *)decoded_16bit->start,
-                                (int32_t *)decoded_32bit->start, 1.0, 0, 0),
-                            "Could not scale decoded PCM to 32 bit")) &&
-             ov_cond_valid(ov_pcm_32_add(decoded_frame_length_samples,
-                                         (int32_t *)mixed_32bit->start,
-                                         (int32_t *)decoded_32bit->start),
-                           "Could not add decoded RTP payload"))) {
-            ++num_mixed_frames;
-        }
+typedef struct {
 
-        frame = ov_rtp_frame_free(frame);
-    }
+    ov_rtp_mixer *mixer;
+    size_t num_frames;
+    size_t num_mixed_frames;
+
+} mix_args;
 
-    ov_buffer *pcm16 = ov_buffer_create(decoded_len_16bit);
-    pcm16->length = decoded_len_16bit;
+/*----------------------------------------------------------------------------*/
+
+static bool mix_oldest_frame_of_stream(const void *key, void *value,
+                                       void *data) {
+    UNUSED(key);
 
-    double scale_factor = OV_OR_DEFAULT(num_mixed_frames, 1);
+    stream_entry *entry = value;
+    mix_args *args = data;
 
-    if ((!ov_cond_valid(ov_pcm_32_scale(decoded_frame_length_samples,
-                                        (int32_t *)mixed_32bit->start,
-                                        1.0 / scale_factor),
-                        "Could not scale mixed PCM")) ||
-        (!ov_cond_valid(ov_pcm_32_clip_to_16(decoded_frame_length_samples,
-                                             (int32_t *)mixed_32bit->start,
-                                             (int16_t *)pcm16->start),
-                        "Could not clip mixed PCM"))) {
-        pcm16 = ov_buffer_free(pcm16);
+    ov_rtp_frame *frame = stream_pop_frame(entry);
+
+    if (0 == frame) {
+        return true;
+    }
+
+    ++args->num_frames;
+
+    ov_rtp_mixer *self = args->mixer;
+
+    size_t decoded_frame_length_samples =
+        self->settings.decoded_frame_length_samples;
+    ov_buffer *decoded_16bit = self->scratch.decoded_16bit;
+
+    entry->last_used_epoch_secs = time(0);
+
+    if (decode_frame(entry->codec, frame, decoded_16bit) &&
+        ov_cond_valid(decoded_frame_length_samples * sizeof(int16_t) ==
+                          decoded_16bit->length,
+                      "Decoded RTP frame has unexpected length") &&
+        ov_cond_valid(ov_pcm_16_scale_to_32(decoded_frame_length_samples,
+                                            (int16_t *)decoded_16bit->start,
+                                            self->scratch.decoded_32bit, 1.0,
+                                            0, 0),
+                      "Could not scale decoded PCM to 32 bit") &&
+        ov_cond_valid(ov_pcm_32_add(decoded_frame_length_samples,
+                                    self->scratch.mixed_32bit,
+                                    self->scratch.decoded_32bit),
+                      "Could not add decoded RTP payload")) {
+        ++args->num_mixed_frames;
     }
 
-    decoded_16bit = ov_buffer_free(decoded_16bit);
-    decoded_32bit = ov_buffer_free(decoded_32bit);
-    mixed_32bit = ov_buffer_free(mixed_32bit);
+    frame = ov_rtp_frame_free(frame);
 
-    return pcm16;
+    return true;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static bool process_frames(ov_rtp_mixer *self, ov_list *frames,
-                           ov_chunker *chunker_to_write_to) {
-    bool ok = false;
+/**
+ * Mixes the oldest frame of each stream into scratch.pcm16.
+ * @return number of frames taken from the streams
+ */
+static size_t mix_frames(ov_rtp_mixer *self, bool *ok) {
+    size_t decoded_frame_length_samples =
+        self->settings.decoded_frame_length_samples;
 
-    if (ov_ptr_valid(self, "Cannot mix frames - invalid mixer pointer") &&
-        ov_ptr_valid_warn(frames, "Cannot mix frames - no frame list")) {
-        ov_buffer *mixed_payload = mix_frames(
-            self, frames, self->settings.decoded_frame_length_samples);
+    memset(self->scratch.mixed_32bit, 0,
+           decoded_frame_length_samples * sizeof(int32_t));
 
-        if (0 != mixed_payload) {
-            ov_chunker_add(chunker_to_write_to, mixed_payload);
-            ok = true;
+    mix_args args = {.mixer = self};
 
-        } else {
-            ov_log_debug("No frame to forward");
-            if (0 != self->comfort_noise.noisy_frame_16bit) {
-                ov_log_debug("Adding comfort noise");
-                ov_chunker_add(chunker_to_write_to,
-                               self->comfort_noise.noisy_frame_16bit);
-
-            } else {
-                ov_log_debug("Comfort noise not added - not configured");
-            }
-        }
+    ov_dict_for_each(self->streams, &args, mix_oldest_frame_of_stream);
 
-        mixed_payload = ov_buffer_free(mixed_payload);
-    }
+    self->stats.frames_mixed += args.num_mixed_frames;
 
-    frames = free_frame_list(frames);
+    double scale_factor = OV_OR_DEFAULT(args.num_mixed_frames, 1);
 
-    return ok;
+    *ok = ov_cond_valid(ov_pcm_32_scale(decoded_frame_length_samples,
+                                        self->scratch.mixed_32bit,
+                                        1.0 / scale_factor),
+                        "Could not scale mixed PCM") &&
+          ov_cond_valid(
+              ov_pcm_32_clip_to_16(decoded_frame_length_samples,
+                                   self->scratch.mixed_32bit,
+                                   (int16_t *)self->scratch.pcm16->start),
+              "Could not clip mixed PCM");
+
+    return args.num_frames;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static ov_list *frame_buffer_get_current_frames(ov_thread_lock *lock,
-                                                ov_rtp_frame_buffer *buffer) {
-    ov_list *frames = 0;
+static bool process_frames(ov_rtp_mixer *self,
+                           ov_chunker *chunker_to_write_to) {
+    bool mixed = false;
+
+    if (0 == mix_frames(self, &mixed)) {
+        ++self->stats.periods_silent;
+        ov_log_warning("Cannot mix frames - no frames to mix");
+        return false;
 
-    if (ov_thread_lock_try_lock(lock)) {
-        frames = ov_rtp_frame_buffer_get_current_frames(buffer);
+    } else if (mixed) {
+        ov_chunker_add(chunker_to_write_to, self->scratch.pcm16);
+        return true;
 
-        ov_thread_lock_unlock(lock);
-    }
+    } else {
+        ov_log_debug("No frame to forward");
+        if (0 != self->comfort_noise.noisy_frame_16bit) {
+            ov_log_debug("Adding comfort noise");
+            ov_chunker_add(chunker_to_write_to,
+                           self->comfort_noise.noisy_frame_16bit);
 
-    return frames;
+        } else {
+            ov_log_debug("Comfort noise not added - not configured");
+        }
+
+        return false;
+    }
 }
 
 /*----------------------------------------------------------------------------*/
 
-bool ov_rtp_mixer_mix(ov_rtp_mixer *self, ov_chunker *chunker_to_write_to) {
+bool ov_rtp_mixer_mix(ov_rtp_mixer *self,
+                           ov_chunker *chunker_to_write_to) {
     if (ov_ptr_valid(self, "Cannot mix frames - invalid mixer pointer")) {
-        ov_list *frame_list = frame_buffer_get_current_frames(
-            &self->frame_buffer_lock, self->frame_buffer);
+        uint64_t start_usecs = ov_time_get_current_time_usecs();
+
+        take_queued_frames(self);
+        bool ok = process_frames(self, chunker_to_write_to);
+
+        uint64_t mix_usecs = ov_time_get_current_time_usecs() - start_usecs;
 
-        return process_frames(self, frame_list, chunker_to_write_to);
+        ++self->stats.periods;
+        self->stats.mix_usecs_total += mix_usecs;
+        self->stats.mix_usecs_max =
+            OV_MAX(self->stats.mix_usecs_max, mix_usecs);
+
+        return ok;
 
     } else {
         return false;
     }
 }
 
+/*----------------------------------------------------------------------------*/
+
+ov_rtp_mixer_stats ov_rtp_mixer_get_stats(ov_rtp_mixer const *self) {
+    ov_rtp_mixer_stats stats = {0};
+
+    if (0 != as_mixer(self)) {
+        stats = self->stats;
+        stats.frames_dropped += atomic_load_explicit(&self->frames_rejected,
+                                                     memory_order_relaxed);
+    }
+
+    return stats;
+}
+
 /*****************************************************************************
                       Garbage collection of stale streams
  ****************************************************************************/
@@ -485,7 +613,7 @@ static bool collect_stale_stream_ssids(const void *key, void *value,
     if (ov_ptr_valid(args, "Cannot collect stale RTP streams - invalid args "
                            "pointer") &&
         (sizeof(args->ssids) / sizeof(args->ssids[0]) > args->ssids_found)) {
-        codec_entry *entry = value;
+        stream_entry *entry = value;
 
         if ((0 != entry) &&
             (entry->last_used_epoch_secs < args->before_epoch_secs)) {
@@ -502,11 +630,11 @@ static bool collect_stale_stream_ssids(const void *key, void *value,
 
 /*----------------------------------------------------------------------------*/
 
-static void clean_codec_entries(ov_dict *codec_entries, gc_args args) {
+static void clean_stream_entries(ov_dict *stream_entries, gc_args args) {
     for (size_t i = 0; i < args.ssids_found; ++i) {
         ov_log_info("RTP mixer: Removing stale stream %" PRIu32, args.ssids[i]);
         intptr_t ssidptr = args.ssids[i];
-        ov_dict_del(codec_entries, (void *)ssidptr);
+        ov_dict_del(stream_entries, (void *)ssidptr);
     }
 }
 
@@ -522,8 +650,8 @@ bool ov_rtp_mixer_garbage_collect(ov_rtp_mixer *self,
 
     if (ov_ptr_valid(self,
                      "Cannot perform garbage collection - invalid RTP mixer")) {
-        ov_dict_for_each(self->codecs, &args, collect_stale_stream_ssids);
-        clean_codec_entries(self->codecs, args);
+        ov_dict_for_each(self->streams, &args, collect_stale_stream_ssids);
+        clean_stream_entries(self->streams, args);
 
         return true;
 
@@ -0,0 +1,389 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2024 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+
+        @author         Michael J. Beer
+
+        ------------------------------------------------------------------------
+*/
+
+#include "ov_rtp_mixer.c"
+
+#include <ov_base/ov_registered_cache.h>
+#include <ov_codec/ov_codec_raw.h>
+#include <ov_test/ov_test.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define TEST_SSRC 1234
+#define TEST_CAPACITY 4
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_frame *frame_with_payload(uint32_t ssrc, uint16_t sequence,
+                                        uint8_t *payload, size_t length) {
+
+    return ov_rtp_frame_encode(&(ov_rtp_frame_expansion){
+        .version = RTP_VERSION_2,
+        .ssrc = ssrc,
+        .sequence_number = sequence,
+        .timestamp = 960 * (uint32_t)sequence,
+        .payload.data = payload,
+        .payload.length = length,
+    });
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_frame *frame(uint16_t sequence) {
+
+    uint8_t payload[4] = {1, 2, 3, 4};
+    return frame_with_payload(TEST_SSRC, sequence, payload, sizeof(payload));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static stream_entry *entry_create(size_t capacity) {
+
+    return calloc(1, sizeof(stream_entry) + capacity * sizeof(ov_rtp_frame *));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool entry_holds(stream_entry const *entry, size_t num,
+                        uint16_t const *sequence_numbers) {
+
+    if (num != entry->num_frames) {
+        return false;
+    }
+
+    for (size_t i = 0; i < num; ++i) {
+
+        if (sequence_numbers[i] !=
+            entry->frames[i]->expanded.sequence_number) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool add_expect_stored(stream_entry *entry, uint16_t sequence) {
+
+    return 0 == stream_add_frame(entry, TEST_CAPACITY, frame(sequence));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool add_expect_returned(stream_entry *entry, uint16_t sequence,
+                                uint16_t returned_sequence) {
+
+    ov_rtp_frame *returned =
+        stream_add_frame(entry, TEST_CAPACITY, frame(sequence));
+
+    bool ok = (0 != returned) &&
+              (returned_sequence == returned->expanded.sequence_number);
+
+    ov_rtp_frame_free(returned);
+
+    return ok;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_sequence_diff() {
+
+    ov_rtp_frame *a = frame(1);
+    ov_rtp_frame *b = frame(2);
+
+    testrun(0 > sequence_diff(a, b));
+    testrun(0 < sequence_diff(b, a));
+    testrun(0 == sequence_diff(a, a));
+
+    a = ov_rtp_frame_free(a);
+    b = ov_rtp_frame_free(b);
+
+    // 0 follows 65535
+    a = frame(65535);
+    b = frame(0);
+
+    testrun(0 > sequence_diff(a, b));
+    testrun(0 < sequence_diff(b, a));
+
+    a = ov_rtp_frame_free(a);
+    b = ov_rtp_frame_free(b);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_stream_add_frame() {
+
+    stream_entry *entry = entry_create(TEST_CAPACITY);
+    testrun(0 != entry);
+
+    // In order
+
+    testrun(add_expect_stored(entry, 10));
+    testrun(add_expect_stored(entry, 11));
+    testrun(add_expect_stored(entry, 12));
+    testrun(entry_holds(entry, 3, (uint16_t[]){10, 11, 12}));
+
+    ov_rtp_frame *popped = stream_pop_frame(entry);
+    testrun(10 == popped->expanded.sequence_number);
+    popped = ov_rtp_frame_free(popped);
+    testrun(entry_holds(entry, 2, (uint16_t[]){11, 12}));
+
+    entry = stream_entry_free(entry);
+    entry = entry_create(TEST_CAPACITY);
+
+    // Reordered across the wrap of the sequence number
+
+    testrun(add_expect_stored(entry, 65534));
+    testrun(add_expect_stored(entry, 1));
+    testrun(add_expect_stored(entry, 0));
+    testrun(add_expect_stored(entry, 65535));
+    testrun(entry_holds(entry, 4, (uint16_t[]){65534, 65535, 0, 1}));
+
+    entry = stream_entry_free(entry);
+    entry = entry_create(TEST_CAPACITY);
+
+    // Duplicates are returned, not stored
+
+    testrun(add_expect_stored(entry, 20));
+    testrun(add_expect_stored(entry, 22));
+    testrun(add_expect_returned(entry, 22, 22));
+    testrun(add_expect_returned(entry, 20, 20));
+    testrun(add_expect_stored(entry, 21));
+    testrun(add_expect_returned(entry, 21, 21));
+    testrun(entry_holds(entry, 3, (uint16_t[]){20, 21, 22}));
+
+    entry = stream_entry_free(entry);
+    entry = entry_create(TEST_CAPACITY);
+
+    // Overflow drops the oldest frame
+
+    testrun(add_expect_stored(entry, 30));
+    testrun(add_expect_stored(entry, 31));
+    testrun(add_expect_stored(entry, 33));
+    testrun(add_expect_stored(entry, 34));
+    testrun(add_expect_returned(entry, 35, 30));
+    testrun(entry_holds(entry, 4, (uint16_t[]){31, 33, 34, 35}));
+
+    // Reordered frame still fits in, dropping the oldest one
+
+    testrun(add_expect_returned(entry, 32, 31));
+    testrun(entry_holds(entry, 4, (uint16_t[]){32, 33, 34, 35}));
+
+    // Frame older than all stored ones is too late
+
+    testrun(add_expect_returned(entry, 31, 31));
+    testrun(entry_holds(entry, 4, (uint16_t[]){32, 33, 34, 35}));
+
+    entry = stream_entry_free(entry);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_rtp_mixer_create() {
+
+    ov_rtp_mixer *mixer = ov_rtp_mixer_create((ov_rtp_mixer_config){0});
+    testrun(0 != mixer);
+
+    testrun(10 == mixer->settings.max_num_frames_per_stream);
+    testrun(0 != mixer->frame_queue);
+
+    ov_rtp_mixer_stats stats = ov_rtp_mixer_get_stats(mixer);
+    testrun(0 == stats.periods);
+    testrun(0 == stats.frames_mixed);
+    testrun(0 == stats.frames_dropped);
+
+    mixer = ov_rtp_mixer_free(mixer);
+    testrun(0 == mixer);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_rtp_mixer_add_frame() {
+
+    testrun(!ov_rtp_mixer_add_frame(0, 0));
+
+    ov_rtp_mixer *mixer = ov_rtp_mixer_create((ov_rtp_mixer_config){
+        .max_num_frames_per_stream = TEST_CAPACITY,
+        .ssid_to_cancel = 42,
+    });
+
+    testrun(0 != mixer);
+    testrun(!ov_rtp_mixer_add_frame(mixer, 0));
+
+    // Cancelled SSID is neither stored nor counted as dropped
+
+    uint8_t payload[4] = {0};
+    testrun(ov_rtp_mixer_add_frame(
+        mixer, frame_with_payload(42, 1, payload, sizeof(payload))));
+
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(101)));
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(100)));
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(101)));
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(102)));
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(103)));
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(104)));
+
+    take_queued_frames(mixer);
+
+    // One duplicate, 100 dropped to make room for 104
+    testrun(2 == ov_rtp_mixer_get_stats(mixer).frames_dropped);
+
+    testrun(1 == ov_dict_count(mixer->streams));
+
+    stream_entry *entry =
+        ov_dict_get(mixer->streams, (void *)(intptr_t)TEST_SSRC);
+
+    testrun(0 != entry);
+    testrun(entry_holds(entry, 4, (uint16_t[]){101, 102, 103, 104}));
+
+    // Full queue rejects frames
+
+    size_t capacity = ov_spsc_queue_capacity(mixer->frame_queue);
+
+    for (size_t i = 0; i < capacity + 5; ++i) {
+        testrun(ov_rtp_mixer_add_frame(mixer, frame(200 + i)));
+    }
+
+    testrun(2 + 5 == ov_rtp_mixer_get_stats(mixer).frames_dropped);
+
+    mixer = ov_rtp_mixer_free(mixer);
+    testrun(0 == mixer);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_rtp_mixer_mix() {
+
+    ov_rtp_mixer *mixer = ov_rtp_mixer_create((ov_rtp_mixer_config){
+        .max_num_frames_per_stream = TEST_CAPACITY,
+        .comfort_noise_max_amplitude = 100,
+    });
+
+    testrun(0 != mixer);
+
+    ov_chunker *chunker = ov_chunker_create();
+    testrun(0 != chunker);
+
+    testrun(!ov_rtp_mixer_mix(0, chunker));
+
+    // Nothing to mix
+
+    testrun(!ov_rtp_mixer_mix(mixer, chunker));
+    testrun(0 == ov_chunker_available_octets(chunker));
+
+    ov_rtp_mixer_stats stats = ov_rtp_mixer_get_stats(mixer);
+    testrun(1 == stats.periods);
+    testrun(1 == stats.periods_silent);
+    testrun(0 == stats.frames_mixed);
+
+    // Decode raw PCM instead of opus, the mixing is the same
+
+    stream_entry *entry = get_stream_for_ssrc(mixer, TEST_SSRC);
+    testrun(0 != entry);
+
+    entry->codec = ov_codec_free(entry->codec);
+    entry->codec =
+        ov_codec_factory_get_codec(0, ov_codec_raw_id(), TEST_SSRC, 0);
+    testrun(0 != entry->codec);
+
+    size_t length =
+        mixer->settings.decoded_frame_length_samples * sizeof(int16_t);
+
+    uint8_t *payload = calloc(1, length);
+    testrun(0 != payload);
+
+    testrun(ov_rtp_mixer_add_frame(
+        mixer, frame_with_payload(TEST_SSRC, 2, payload, length)));
+    testrun(ov_rtp_mixer_add_frame(
+        mixer, frame_with_payload(TEST_SSRC, 1, payload, length)));
+
+    testrun(ov_rtp_mixer_mix(mixer, chunker));
+    testrun(length == ov_chunker_available_octets(chunker));
+
+    stats = ov_rtp_mixer_get_stats(mixer);
+    testrun(2 == stats.periods);
+    testrun(1 == stats.periods_silent);
+    testrun(1 == stats.frames_mixed);
+    testrun(0 == stats.frames_dropped);
+    testrun(stats.mix_usecs_max <= stats.mix_usecs_total);
+
+    // Second frame is mixed in the next period
+
+    testrun(entry_holds(entry, 1, (uint16_t[]){2}));
+
+    testrun(ov_rtp_mixer_mix(mixer, chunker));
+    testrun(2 * length == ov_chunker_available_octets(chunker));
+
+    stats = ov_rtp_mixer_get_stats(mixer);
+    testrun(3 == stats.periods);
+    testrun(2 == stats.frames_mixed);
+
+    // Frames that cannot be decoded are consumed, but not mixed
+
+    testrun(ov_rtp_mixer_add_frame(mixer, frame(3)));
+    testrun(ov_rtp_mixer_mix(mixer, chunker));
+    testrun(3 * length == ov_chunker_available_octets(chunker));
+    testrun(entry_holds(entry, 0, 0));
+
+    stats = ov_rtp_mixer_get_stats(mixer);
+    testrun(4 == stats.periods);
+    testrun(1 == stats.periods_silent);
+    testrun(2 == stats.frames_mixed);
+
+    payload = ov_free(payload);
+    chunker = ov_chunker_free(chunker);
+    mixer = ov_rtp_mixer_free(mixer);
+    testrun(0 == mixer);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int tear_down() {
+
+    ov_registered_cache_free_all();
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+OV_TEST_RUN("ov_rtp_mixer", test_sequence_diff, test_stream_add_frame,
+            test_ov_rtp_mixer_create, test_ov_rtp_mixer_add_frame,
+            test_ov_rtp_mixer_mix, tear_down);
+
+/*----------------------------------------------------------------------------*/
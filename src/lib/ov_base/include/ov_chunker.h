@@ -73,6 +73,21 @@
         data = ov_chunker_remainder(us);
         consume(data);
 
+        Streaming without any allocation:
+
+        A chunker created by `ov_chunker_create_ring` has a fixed capacity.
+        Adding more data than fits fails instead of growing the chunker,
+        without logging, a full ring is backpressure rather than an error.
+        The ring is mapped twice in a row, hence the available data can
+        always be previewed as one contiguous array and consumed in place:
+
+        uint8_t const *period = ov_chunker_next_chunk_preview(us, 20);
+
+        if (0 != period) {
+           consume_raw(period, 20);
+           ov_chunker_skip(us, 20);
+        }
+
         ------------------------------------------------------------------------
 */
 #ifndef OV_CHUNKER_H
@@ -88,10 +103,21 @@ typedef struct ov_chunker_struct ov_chunker;
 
 ov_chunker *ov_chunker_create();
 
+/**
+ * Create a chunker of fixed capacity, see above.
+ * capacity is rounded up to a multiple of the page size.
+ */
+ov_chunker *ov_chunker_create_ring(size_t capacity);
+
 ov_chunker *ov_chunker_free(ov_chunker *self);
 
 size_t ov_chunker_available_octets(ov_chunker *self);
 
+/**
+ * @return capacity of a ring chunker, 0 for a growing chunker
+ */
+size_t ov_chunker_capacity(ov_chunker *self);
+
 bool ov_chunker_add(ov_chunker *self, ov_buffer const *data);
 
 /**
@@ -104,6 +130,12 @@ bool ov_chunker_add(ov_chunker *self, ov_buffer const *data);
 uint8_t const *ov_chunker_next_chunk_preview(ov_chunker *self,
                                              size_t num_octets);
 
+/**
+ * Drop num_octets, e.g. after they were consumed by a preview.
+ * Fails if less than num_octets are available.
+ */
+bool ov_chunker_skip(ov_chunker *self, size_t num_octets);
+
 bool ov_chunker_next_chunk_raw(ov_chunker *self, size_t num_octets,
                                uint8_t *dest);
 
@@ -304,6 +304,7 @@
 #define OV_KEY_ANSWER "answer"
 
 #define OV_KEY_STATISTICS "statistics"
+#define OV_KEY_METRICS "metrics"
 #define OV_KEY_LAST "last"
 #define OV_KEY_BYTES "bytes"
 
@@ -523,6 +524,7 @@
 #define OV_KEY_RTCP_MUX "rtcp-mux"
 #define OV_KEY_SRTP "srtp"
 #define OV_KEY_DTLS_SRTP "dtls srtp"
+#define OV_KEY_DTLS_HANDSHAKE "dtls handshake"
 
 /*
  *      ------------------------------------------------------------------------
@@ -578,6 +580,16 @@
 #define OV_KEY_SAMPLE_RATE_HERTZ "sample_rate_hz"
 
 #define OV_KEY_FRAME_BUFFER "frame_buffer"
+#define OV_KEY_JITTER_BUFFER "jitter_buffer"
+#define OV_KEY_MIX_CACHE "mix_cache"
+#define OV_KEY_LOOP_BUS "loop_bus"
+#define OV_KEY_OVERLOAD "overload"
+#define OV_KEY_DEADLINE_USECS "deadline_usecs"
+#define OV_KEY_WINDOW "window"
+#define OV_KEY_OVERRUNS "overruns"
+#define OV_KEY_MAX_TALKERS "max_talkers"
+#define OV_KEY_SKIP_NORMALIZATION "skip_normalization"
+#define OV_KEY_ENCODER_COMPLEXITY "encoder_complexity"
 #define OV_KEY_FRAME_LENGTH_USECS "frame_length_usecs"
 #define OV_KEY_LENGTH "length"
 
@@ -899,6 +911,7 @@
 #define OV_KEY_HTTP_MESSAGE "http message"
 
 #define OV_KEY_IP4_ONLY "ip4_only"
+#define OV_KEY_KTLS "ktls"
 #define OV_KEY_IP4 "ip4"
 #define OV_KEY_IP6 "ip6"
 
@@ -44,6 +44,11 @@ bool ov_crc32_generate_table_for(uint32_t polynomial, bool reverted_in,
 /**
  * Calculate a CRC32 checksum.
  *
+ * Works bytewise on the table given. For the common flavours prefer
+ * ov_crc32_posix, ov_crc32_ogg or ov_crc32_zlib, which use precomputed
+ * slice-by-8 tables and carry-less multiplication (PCLMULQDQ) if the
+ * CPU supports it.
+ *
  * The algorithm is such that for generator polynome 0x04C11DB7 and initial
  * value of 0 you get CRC32/OGG checksum.
  *
@@ -115,12 +120,14 @@ uint32_t ov_crc32_posix(uint8_t const *data, size_t len_octets);
 /**
  * Compute CRC32 checksum to be used in an OGG header.
  * @param init Must be 0 for a fresh check sum.
+ * @returns init if data is NULL
  */
 uint32_t ov_crc32_ogg(uint32_t init, uint8_t const *data, size_t len_octets);
 
 /**
- * Calculate CRC32 in flavour of ZLIB.
+ * Calculate CRC32 in flavour of ZLIB (IEEE 802.3, e.g. STUN FINGERPRINT).
  * Use init value of 0.
+ * @returns init if data is NULL
  */
 uint32_t ov_crc32_zlib(uint32_t init, uint8_t const *data, size_t len_octets);
 
@@ -0,0 +1,192 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_expiring_map.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          String keyed map of values with some lifetime.
+
+        Entries are additionally sorted into a timing wheel of
+        config.wheel.slots buckets of config.wheel.resolution_usec each,
+        based on their expiry time. So insert, lookup and removal are O(1)
+        and ov_expiring_map_expire only visits the buckets elapsed since
+        its last call, instead of walking all entries.
+
+        Entries with a lifetime longer than one turn of the wheel stay in
+        their bucket and are checked again with each turn.
+
+        Entries expire at most config.wheel.resolution_usec after their
+        lifetime, if ov_expiring_map_expire is called at least with this
+        interval.
+
+        NOTE the map is NOT threadsafe.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_expiring_map_h
+#define ov_expiring_map_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OV_EXPIRING_MAP_DEFAULT_SLOTS 4096
+#define OV_EXPIRING_MAP_DEFAULT_WHEEL_SLOTS 512
+#define OV_EXPIRING_MAP_DEFAULT_RESOLUTION_USEC 100000 // 100ms
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_expiring_map ov_expiring_map;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_expiring_map_config {
+
+    size_t slots; // hash slots of the key lookup, default 4096
+
+    struct {
+
+        size_t slots;             // buckets of the wheel, default 512
+        uint64_t resolution_usec; // time per bucket, default 100ms
+
+    } wheel;
+
+    struct {
+
+        /* optional free function for values dropped by the map */
+        void *(*free)(void *value);
+
+        /* optional callback for expired values,
+         * called before value.free is applied to value */
+        void *userdata;
+        void (*expired)(void *userdata, const char *key, void *value);
+
+    } value;
+
+} ov_expiring_map_config;
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_expiring_map *ov_expiring_map_create(ov_expiring_map_config config);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Free the map and all contained values using config.value.free.
+    No expired callback will be called.
+*/
+ov_expiring_map *ov_expiring_map_free(ov_expiring_map *self);
+
+/*----------------------------------------------------------------------------*/
+
+ov_expiring_map_config ov_expiring_map_get_config(const ov_expiring_map *self);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      ENTRY FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+/**
+    Set value for key, expiring lifetime_usec from now.
+
+    An existing value of key will be freed using config.value.free.
+
+    @param self             instance
+    @param key              key to set (will be copied)
+    @param value            value to set
+    @param lifetime_usec    lifetime of the entry
+*/
+bool ov_expiring_map_set(ov_expiring_map *self, const char *key, void *value,
+                         uint64_t lifetime_usec);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns value of key or NULL
+*/
+void *ov_expiring_map_get(const ov_expiring_map *self, const char *key);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Remove some key from the map.
+
+    @returns value of key (ownership back to the caller) or NULL
+*/
+void *ov_expiring_map_remove(ov_expiring_map *self, const char *key);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Delete some key from the map, the value will be freed using
+    config.value.free.
+
+    @returns true if key is no longer contained
+*/
+bool ov_expiring_map_del(ov_expiring_map *self, const char *key);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Delete all entries matching some function. Values will be freed
+    using config.value.free.
+
+    NOTE this walks all entries, it is intended for rare events like
+    dropping all entries of some closed connection.
+
+    @returns number of entries deleted
+*/
+size_t ov_expiring_map_del_if(ov_expiring_map *self, void *data,
+                              bool (*match)(const char *key, void *value,
+                                            void *data));
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Drop all entries expired at now_usec. For each entry the optional
+    expired callback is called, before the value is freed.
+
+    The callback MAY use the map.
+
+    @param self     instance
+    @param now_usec current time e.g. ov_time_get_current_time_usecs()
+
+    @returns number of entries expired
+*/
+size_t ov_expiring_map_expire(ov_expiring_map *self, uint64_t now_usec);
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_expiring_map_count(const ov_expiring_map *self);
+
+#endif /* ov_expiring_map_h */
@@ -0,0 +1,98 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_histogram.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Fixed bucket histogram of unsigned values, e.g.
+                        durations in usec.
+
+        Buckets are log linear (HDR style), each power of 2 is split into
+        8 buckets, so any value is recorded with an error below 12.5 %.
+        Values up to 2^34 are bucketed, larger values go to the last
+        bucket. Adding some value is constant time without allocation.
+
+        The histogram is not thread safe, see ov_metrics.h for histograms
+        written by several threads.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_histogram_h
+#define ov_histogram_h
+
+#include "ov_json_value.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OV_HISTOGRAM_SUB_BITS 3
+#define OV_HISTOGRAM_BUCKETS 256
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_histogram {
+
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+
+    uint64_t bucket[OV_HISTOGRAM_BUCKETS];
+
+} ov_histogram;
+
+/*----------------------------------------------------------------------------*/
+
+void ov_histogram_add(ov_histogram *self, uint64_t value);
+
+bool ov_histogram_merge(ov_histogram *self, const ov_histogram *other);
+
+void ov_histogram_reset(ov_histogram *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns the upper bound of the bucket of the percentile (0 - 100),
+    at most the maximum value added
+*/
+uint64_t ov_histogram_percentile(const ov_histogram *self, double percentile);
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_histogram_bucket_index(uint64_t value);
+
+/**
+    @returns the largest value of some bucket
+*/
+uint64_t ov_histogram_bucket_upper(size_t index);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Summary of count, min, max, mean and the percentiles 50, 90, 99, 99.9
+*/
+ov_json_value *ov_histogram_to_json(const ov_histogram *self);
+
+#endif /* ov_histogram_h */
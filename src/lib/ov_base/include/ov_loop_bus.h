@@ -0,0 +1,177 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_loop_bus.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Shared memory transport of loop RTP for services
+                        of the same host.
+
+        Each loop is a ring of slots within POSIX shared memory. Any
+        process of the host may publish to the ring, any number of
+        processes may subscribe to it. Publishing is lock free,
+        subscribers never block publishers.
+
+        Each subscriber reads the ring at its own position. A subscriber
+        falling behind more than the ring size skips the frames
+        overwritten meanwhile, they are counted as dropped.
+
+        Subscribers idle within their event loop at some doorbell,
+        an abstract unix datagram socket. Publishers only ring the
+        doorbells of subscribers, which did read all frames, so a busy
+        subscriber reads a batch of frames per wakeup.
+
+        Buses are named after the multicast group of their loop, see
+        ov_loop_bus_name, so any consumer knowing the group is able to
+        subscribe.
+
+        Multicast stays the transport between hosts. Publishers using the
+        bus disable multicast loopback (ov_loop_bus_multicast_loop) on
+        their multicast socket, each frame is delivered within the host
+        via the bus only. Hence the bus is a setting of the host, all
+        consumers of a host MUST subscribe to the bus, once some
+        publisher of the host uses it.
+
+        The bus saves the copies through the kernel, yet an idle
+        subscriber is woken by a doorbell datagram. Subscribers reading a
+        batch of frames per wakeup gain most, a subscriber woken for each
+        single frame still pays the doorbell syscalls for each frame,
+        see check_loop_bus_performance.
+
+        NOTE the ring MUST be larger than the frames published
+        concurrently, as concurrent publishers of the same slot are
+        not detected.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_loop_bus_h
+#define ov_loop_bus_h
+
+#include "ov_event_loop.h"
+#include "ov_json_value.h"
+#include "ov_socket.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OV_LOOP_BUS_NAME_MAX 64
+#define OV_LOOP_BUS_SLOTS_DEFAULT 256
+#define OV_LOOP_BUS_PAYLOAD_MAX 1500
+#define OV_LOOP_BUS_SUBSCRIBERS_MAX 64
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_loop_bus ov_loop_bus;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_loop_bus_config {
+
+    char name[OV_LOOP_BUS_NAME_MAX]; // see ov_loop_bus_name
+    size_t slots;                    // rounded up to a power of 2
+
+    /* subscribe, if callback.io is set */
+
+    ov_event_loop *loop;
+
+    struct {
+
+        void *userdata;
+        void (*io)(void *userdata, const uint8_t *buffer, size_t bytes);
+
+    } callback;
+
+} ov_loop_bus_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_loop_bus_stats {
+
+    uint64_t published;
+    uint64_t received;
+    uint64_t dropped; // overwritten before received
+    uint64_t wakeups;
+
+} ov_loop_bus_stats;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Attach to the bus of some loop, the shared memory is created if
+    required.
+*/
+ov_loop_bus *ov_loop_bus_create(ov_loop_bus_config config);
+ov_loop_bus *ov_loop_bus_free(ov_loop_bus *self);
+ov_loop_bus *ov_loop_bus_cast(const void *data);
+
+void *ov_loop_bus_free_void(void *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Write the bus name of the multicast group of some loop to name.
+*/
+bool ov_loop_bus_name(ov_socket_configuration group, char *name, size_t size);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Remove the shared memory of some loop. Processes attached keep
+    their mapping.
+*/
+bool ov_loop_bus_unlink(const char *name);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Publish some frame to the loop, may be called from several threads.
+*/
+bool ov_loop_bus_publish(ov_loop_bus *self, const uint8_t *buffer,
+                         size_t bytes);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Read all frames pending for the subscriber.
+    Called on doorbell io, might be called to poll as well.
+
+    @returns number of frames passed to callback.io
+*/
+size_t ov_loop_bus_receive(ov_loop_bus *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Enable or disable the loopback of multicast sent at socket.
+*/
+bool ov_loop_bus_multicast_loop(int socket, bool enable);
+
+/*----------------------------------------------------------------------------*/
+
+ov_loop_bus_stats ov_loop_bus_get_stats(const ov_loop_bus *self);
+
+ov_json_value *ov_loop_bus_stats_to_json(ov_loop_bus_stats stats);
+
+#endif /* ov_loop_bus_h */
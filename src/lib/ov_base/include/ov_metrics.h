@@ -0,0 +1,133 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_metrics.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Low overhead counters and histograms of media
+                        processing, optionally per loop.
+
+        Series are looked up once by name and loop and kept by the caller.
+        Counting and observing is lock free and allocation free, each
+        thread writes its own shard of some series, so threads never
+        share cache lines. Snapshots merge all shards, they are
+        approximate while written.
+
+        Up to OV_METRICS_THREADS_MAX threads of some process get their
+        own shard, further threads share shards. Shared shards stay
+        exact, they just contend for the cache line.
+
+        Snapshots are provided as JSON for state events and as
+        OpenMetrics text, e.g.
+
+            # TYPE openvocs_mixer_frames_in counter
+            openvocs_mixer_frames_in_total{loop="loop1"} 1234
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_metrics_h
+#define ov_metrics_h
+
+#include "ov_histogram.h"
+#include "ov_json_value.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OV_METRICS_NAME_MAX 64
+#define OV_METRICS_THREADS_MAX 64
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_metrics ov_metrics;
+typedef struct ov_metrics_series ov_metrics_series;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_metrics_config {
+
+    /* prefix of OpenMetrics names, e.g. openvocs_mixer */
+    char prefix[OV_METRICS_NAME_MAX];
+
+} ov_metrics_config;
+
+/*----------------------------------------------------------------------------*/
+
+ov_metrics *ov_metrics_create(ov_metrics_config config);
+ov_metrics *ov_metrics_free(ov_metrics *self);
+ov_metrics *ov_metrics_cast(const void *data);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Get or create some series, loop may be NULL.
+    Series are valid until the metrics are freed.
+*/
+ov_metrics_series *ov_metrics_counter(ov_metrics *self, const char *name,
+                                      const char *loop);
+
+ov_metrics_series *ov_metrics_histogram(ov_metrics *self, const char *name,
+                                        const char *loop);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Increase some counter, ignored for other series or NULL.
+*/
+void ov_metrics_count(ov_metrics_series *series, uint64_t increment);
+
+/**
+    Add some value to some histogram, ignored for other series or NULL.
+*/
+void ov_metrics_observe(ov_metrics_series *series, uint64_t value);
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_metrics_counter_get(const ov_metrics_series *series);
+
+bool ov_metrics_histogram_get(const ov_metrics_series *series,
+                              ov_histogram *out);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Snapshot of all series
+
+        {
+            "name" : value,
+            "name" : { "loop" : value }
+        }
+
+    with numbers for counters and ov_histogram_to_json for histograms.
+*/
+ov_json_value *ov_metrics_to_json(ov_metrics *self);
+
+/**
+    Snapshot of all series in OpenMetrics text exposition format,
+    to be freed by the caller.
+*/
+char *ov_metrics_to_openmetrics(ov_metrics *self);
+
+#endif /* ov_metrics_h */
@@ -42,6 +42,11 @@ typedef struct {
 
     bool multicast;
     ov_socket_configuration rtp_socket;
+
+    /* with multicast, receive frames published by the host to the loop
+     * bus of rtp_socket as well, see ov_loop_bus.h */
+    bool loop_bus;
+
     bool (*rtp_handler)(ov_rtp_frame *rtp_frame, void *userdata);
     void *rtp_handler_userdata;
 
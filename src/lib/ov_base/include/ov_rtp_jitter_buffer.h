@@ -0,0 +1,189 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_jitter_buffer.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Adaptive jitter buffer for RTP streams, keyed by SSRC.
+
+        Each stream keeps its frames in a ring indexed by the sequence
+        number, so inserting and playing out some frame is O(1).
+
+        The interarrival jitter of each stream is estimated as of RFC 3550
+        6.4.1, see ov_rtp_source_stats.h. The target delay of some stream
+        follows this estimate within config.delay.min_frames and
+        config.delay.max_frames.
+
+        Playout of some stream starts, once frames for the target delay
+        are buffered. With each call of ov_rtp_jitter_buffer_playout
+        one slot per playing stream is played out:
+
+        - the frame expected, if present
+        - a lost slot, if the frame expected is missing, but some newer
+          frame is buffered. The receiver is expected to conceal the loss,
+          the next frame buffered is passed along for in-band FEC.
+
+        If a stream runs empty (e.g. at the end of some talk spurt)
+        it will be buffered again up to the target delay, so the delay
+        adapts at talk spurt boundaries.
+
+        Frames arriving after their slot was played out are counted as
+        late and rejected.
+
+        NOTE the jitter buffer is NOT threadsafe.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_rtp_jitter_buffer_h
+#define ov_rtp_jitter_buffer_h
+
+#include "ov_json_value.h"
+#include "ov_rtp_frame.h"
+
+#define OV_RTP_JITTER_BUFFER_CAPACITY_DEFAULT 64
+#define OV_RTP_JITTER_BUFFER_FRAME_USEC_DEFAULT 20000
+#define OV_RTP_JITTER_BUFFER_CLOCK_RATE_DEFAULT 48000
+#define OV_RTP_JITTER_BUFFER_MIN_FRAMES_DEFAULT 1
+#define OV_RTP_JITTER_BUFFER_MAX_FRAMES_DEFAULT 10
+#define OV_RTP_JITTER_BUFFER_TIMEOUT_USEC_DEFAULT 5000000
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_rtp_jitter_buffer ov_rtp_jitter_buffer;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_rtp_jitter_buffer_config {
+
+    uint32_t clock_rate_hz;     // RTP clock, default 48000
+    uint64_t frame_length_usec; // playout interval, default 20ms
+
+    struct {
+
+        uint32_t min_frames; // default 1
+        uint32_t max_frames; // default 10
+
+    } delay;
+
+    /* frames buffered per stream, rounded up to a power of 2,
+     * default OV_RTP_JITTER_BUFFER_CAPACITY_DEFAULT */
+    size_t capacity;
+
+    /* streams without frames for this time are dropped,
+     * default OV_RTP_JITTER_BUFFER_TIMEOUT_USEC_DEFAULT */
+    uint64_t stream_timeout_usec;
+
+} ov_rtp_jitter_buffer_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_rtp_jitter_buffer_stats {
+
+    uint64_t received;
+    uint64_t played;
+    uint64_t late;       // arrived after playout of their slot
+    uint64_t lost;       // slots played out without frame
+    uint64_t concealed;  // lost slots concealed by the receiver
+    uint64_t duplicates; // frames received more than once
+    uint64_t dropped;    // frames dropped on overflow
+    uint64_t underruns;  // stream ran empty while playing
+
+    uint64_t jitter_usec;
+    uint32_t target_frames;
+    uint32_t buffered_frames;
+
+} ov_rtp_jitter_buffer_stats;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_rtp_jitter_buffer_slot {
+
+    uint32_t ssrc;
+    uint16_t sequence_number;
+    uint32_t timestamp;
+
+    /* frame to play out, NULL if lost.
+     * Ownership is passed to the receiver. */
+    ov_rtp_frame *frame;
+
+    /* if lost, the next frame buffered or NULL */
+    const ov_rtp_frame *next;
+
+} ov_rtp_jitter_buffer_slot;
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_rtp_jitter_buffer *
+ov_rtp_jitter_buffer_create(ov_rtp_jitter_buffer_config config);
+
+ov_rtp_jitter_buffer *ov_rtp_jitter_buffer_free(ov_rtp_jitter_buffer *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Add some frame received at now_usec.
+
+    @returns NULL if the frame was taken over, otherwise the frame
+    (e.g. late or duplicate), which is then to be freed by the caller.
+*/
+ov_rtp_frame *ov_rtp_jitter_buffer_add(ov_rtp_jitter_buffer *self,
+                                       ov_rtp_frame *frame, uint64_t now_usec);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Play out one slot of each stream ready.
+
+    For lost slots, the callback returns true if the loss was concealed.
+
+    @returns number of slots played out
+*/
+size_t ov_rtp_jitter_buffer_playout(
+    ov_rtp_jitter_buffer *self, uint64_t now_usec, void *userdata,
+    bool (*callback)(void *userdata, ov_rtp_jitter_buffer_slot *slot));
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_rtp_jitter_buffer_count_streams(const ov_rtp_jitter_buffer *self);
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_jitter_buffer_get_stats(const ov_rtp_jitter_buffer *self,
+                                    uint32_t ssrc,
+                                    ov_rtp_jitter_buffer_stats *stats);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns object of stats per stream, keyed by the SSRC
+*/
+ov_json_value *ov_rtp_jitter_buffer_stats_to_json(ov_rtp_jitter_buffer *self);
+
+#endif /* ov_rtp_jitter_buffer_h */
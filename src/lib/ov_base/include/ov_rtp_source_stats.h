@@ -0,0 +1,103 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_source_stats.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Receiver statistics of a single RTP source,
+                        sequence tracking and interarrival jitter as of
+                        RFC 3550 A.1 / A.8.
+
+        Packets repeating the highest sequence number seen are counted as
+        duplicates, packets below it as reordered. Duplicates do not
+        update the jitter, they carry no new transit time.
+
+        Plain value without allocation, zero it and set clock_rate_hz
+        before the first update. Not thread safe.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_rtp_source_stats_h
+#define ov_rtp_source_stats_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_rtp_source_stats {
+
+    uint32_t clock_rate_hz;
+
+    /* all packets, including duplicates */
+    uint64_t packets;
+    uint64_t duplicates;
+    uint64_t reordered;
+
+    uint16_t base_seq;
+    uint16_t max_seq;
+
+    /* sequence number wraps, shifted by 16 bit */
+    uint32_t cycles;
+
+    uint64_t first_usecs;
+    uint64_t last_usecs;
+
+    /* in timestamp units, relative to first_usecs */
+    int64_t last_arrival;
+    uint32_t last_timestamp;
+    double jitter;
+
+} ov_rtp_source_stats;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Account a packet received at arrival_usecs.
+
+    @returns false if self is invalid or clock_rate_hz is not set
+*/
+bool ov_rtp_source_stats_update(ov_rtp_source_stats *self,
+                                uint16_t sequence_number, uint32_t timestamp,
+                                uint64_t arrival_usecs);
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_rtp_source_stats_expected(const ov_rtp_source_stats *self);
+
+/**
+    @returns packets without duplicates
+*/
+uint64_t ov_rtp_source_stats_received(const ov_rtp_source_stats *self);
+
+/**
+    @returns expected - received, negative if late duplicates arrived
+    below the highest sequence number
+*/
+int64_t ov_rtp_source_stats_lost(const ov_rtp_source_stats *self);
+
+double ov_rtp_source_stats_jitter_usecs(const ov_rtp_source_stats *self);
+
+/*----------------------------------------------------------------------------*/
+#endif
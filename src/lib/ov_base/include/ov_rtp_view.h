@@ -0,0 +1,112 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_view.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          View of some RTP packet within its buffer.
+
+        ov_rtp_view_parse validates the packet the same way
+        ov_rtp_frame_decode does, but neither allocates nor copies.
+        It only indexes the packet, all accessors read from the buffer
+        and all mutators write to the buffer in place.
+
+        Use it, where only some header fields are required, or some
+        header fields are to be rewritten before forwarding.
+
+        The buffer MUST outlive the view. The buffer is not altered,
+        unless some ov_rtp_view_set_* function is called.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_rtp_view_h
+#define ov_rtp_view_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_rtp_view {
+
+    uint8_t *data;
+    size_t length;
+
+    size_t payload_offset;
+    size_t payload_length;
+
+} ov_rtp_view;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Validate and index the RTP packet in data.
+
+    @returns false if data does not contain a valid RTP version 2 packet
+*/
+bool ov_rtp_view_parse(ov_rtp_view *self, uint8_t *data, size_t length);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      ACCESSORS
+ *
+ *      ------------------------------------------------------------------------
+ *
+ *      All accessors return 0 / false for a view not parsed.
+ */
+
+bool ov_rtp_view_marker(const ov_rtp_view *self);
+uint8_t ov_rtp_view_payload_type(const ov_rtp_view *self);
+uint16_t ov_rtp_view_sequence_number(const ov_rtp_view *self);
+uint32_t ov_rtp_view_timestamp(const ov_rtp_view *self);
+uint32_t ov_rtp_view_ssrc(const ov_rtp_view *self);
+
+uint8_t ov_rtp_view_csrc_count(const ov_rtp_view *self);
+uint32_t ov_rtp_view_csrc(const ov_rtp_view *self, uint8_t index);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @param length   set to the payload length, padding excluded
+    @returns pointer to the payload within the buffer
+*/
+const uint8_t *ov_rtp_view_payload(const ov_rtp_view *self, size_t *length);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      MUTATORS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+bool ov_rtp_view_set_marker(ov_rtp_view *self, bool marker);
+bool ov_rtp_view_set_payload_type(ov_rtp_view *self, uint8_t payload_type);
+bool ov_rtp_view_set_sequence_number(ov_rtp_view *self, uint16_t seq);
+bool ov_rtp_view_set_timestamp(ov_rtp_view *self, uint32_t timestamp);
+bool ov_rtp_view_set_ssrc(ov_rtp_view *self, uint32_t ssrc);
+
+#endif /* ov_rtp_view_h */
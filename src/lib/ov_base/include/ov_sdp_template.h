@@ -0,0 +1,104 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sdp_template.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Precompiled SDP offer / answer, where only the
+                        per session values change.
+
+        A template is some SDP string containing placeholders:
+
+            {{port}}            port of the enclosing media description
+            {{ssrc}}            SSRC of the enclosing media description
+            {{ice-ufrag}}       ICE user fragment
+            {{ice-pwd}}         ICE password
+            {{fingerprint}}     DTLS fingerprint e.g. "sha-256 AB:CD:..."
+
+        e.g.
+
+            "m=audio {{port}} UDP/TLS/RTP/SAVPF 100\r\n"
+            "a=ice-ufrag:{{ice-ufrag}}\r\n"
+            "a=ssrc:{{ssrc}} cname:openvocs\r\n"
+
+        The template is validated as SDP once while it is created.
+        ov_sdp_template_write copies the literal parts and fills in
+        the values, without parsing and without allocation.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_sdp_template_h
+#define ov_sdp_template_h
+
+#include "ov_sdp_view.h"
+
+#include <sys/types.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_sdp_template ov_sdp_template;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_sdp_template_values {
+
+    const char *ice_ufrag;
+    const char *ice_pwd;
+    const char *fingerprint;
+
+    /* indexed by media description */
+    uint16_t port[OV_SDP_VIEW_MEDIA_MAX];
+    uint32_t ssrc[OV_SDP_VIEW_MEDIA_MAX];
+
+} ov_sdp_template_values;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Compile some template string.
+
+    @returns NULL if the string contains an unknown placeholder,
+    a port or SSRC placeholder outside of a media description,
+    or is not valid SDP once filled
+*/
+ov_sdp_template *ov_sdp_template_create(const char *string);
+
+ov_sdp_template *ov_sdp_template_free(ov_sdp_template *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Fill the template into buffer, the result is zero terminated.
+
+    Strings MUST be set, if the template contains their placeholder,
+    and MUST NOT contain line breaks.
+
+    @returns length of the SDP written (without zero termination)
+    or -1 if buffer is too small or some value is missing
+*/
+ssize_t ov_sdp_template_write(const ov_sdp_template *self,
+                              const ov_sdp_template_values *values,
+                              char *buffer, size_t size);
+
+#endif /* ov_sdp_template_h */
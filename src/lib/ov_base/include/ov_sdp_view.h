@@ -0,0 +1,156 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sdp_view.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          View of some SDP string within its buffer.
+
+        ov_sdp_view_parse validates the SDP with the grammar of ov_sdp.h
+        in one pass over the string. It neither allocates nor copies,
+        but only records where each line and each media description
+        starts. All accessors return pointers into the SDP string,
+        which are NOT zero terminated.
+
+        Use it, where only some fields of an offer or answer are
+        required, e.g. ports, ICE credentials or fingerprints.
+        Use ov_sdp_parse, where a mutable ov_sdp_session is required.
+
+        The string MUST outlive the view.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_sdp_view_h
+#define ov_sdp_view_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OV_SDP_VIEW_LINES_MAX 512
+#define OV_SDP_VIEW_MEDIA_MAX 32
+
+/**
+    Section index of the session level,
+    media descriptions are indexed from 0.
+*/
+#define OV_SDP_VIEW_SESSION SIZE_MAX
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_sdp_view_line {
+
+    char type;
+
+    /* content of the line without "x=" and CRLF */
+    uint32_t offset;
+    uint32_t length;
+
+} ov_sdp_view_line;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_sdp_view {
+
+    const char *data;
+    size_t length;
+
+    size_t num_lines;
+    ov_sdp_view_line lines[OV_SDP_VIEW_LINES_MAX];
+
+    /* index of the m= line of each media description */
+    size_t num_media;
+    size_t media[OV_SDP_VIEW_MEDIA_MAX];
+
+} ov_sdp_view;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Validate and index the SDP in data.
+
+    @returns false if data is not valid SDP, or contains more than
+    OV_SDP_VIEW_LINES_MAX lines or OV_SDP_VIEW_MEDIA_MAX media descriptions
+*/
+bool ov_sdp_view_parse(ov_sdp_view *self, const char *data, size_t length);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      ACCESSORS
+ *
+ *      ------------------------------------------------------------------------
+ *
+ *      All accessors return NULL / 0 for a view not parsed.
+ */
+
+size_t ov_sdp_view_media_count(const ov_sdp_view *self);
+
+/**
+    @param section  OV_SDP_VIEW_SESSION or index of a media description
+    @param type     line type e.g. 'o', 'c' or 'm'
+    @param length   set to the length of the content
+    @returns content of the first line of type within the section
+*/
+const char *ov_sdp_view_line_get(const ov_sdp_view *self, size_t section,
+                                 char type, size_t *length);
+
+/**
+    Get the value of some attribute. The media level does NOT
+    inherit attributes of the session level.
+
+    @param section  OV_SDP_VIEW_SESSION or index of a media description
+    @param name     attribute name e.g. "ice-ufrag"
+    @param length   set to the length of the value, 0 for a flag
+    @returns value of the first attribute name within the section
+*/
+const char *ov_sdp_view_attribute_get(const ov_sdp_view *self, size_t section,
+                                      const char *name, size_t *length);
+
+/**
+    Iterate all attributes of some section.
+
+    @param pos      iterator, MUST be 0 for the first call
+    @returns false if there is no further attribute
+*/
+bool ov_sdp_view_attribute_next(const ov_sdp_view *self, size_t section,
+                                size_t *pos, const char **name,
+                                size_t *name_length, const char **value,
+                                size_t *value_length);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @param length   set to the length of the media type e.g. 5 for "audio"
+    @returns media type of the media description
+*/
+const char *ov_sdp_view_media_type(const ov_sdp_view *self, size_t index,
+                                   size_t *length);
+
+/**
+    @returns port of the media description, 0 if not set
+*/
+uint16_t ov_sdp_view_media_port(const ov_sdp_view *self, size_t index);
+
+#endif /* ov_sdp_view_h */
@@ -0,0 +1,80 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_shm.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Named POSIX shared memory of fixed size, shared by
+                        processes of the same host.
+
+        Any process may create the memory, all others map the same. The
+        memory starts with an ov_shm_header, which the first process
+        initializes and all others check against their own layout, e.g.
+        a ring of slots.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_shm_h
+#define ov_shm_h
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_shm_header {
+
+    _Atomic uint32_t magic;
+    uint32_t slots;
+    uint32_t slot_size;
+
+} ov_shm_header;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Map the shared memory name read / write, it is created with size
+    bytes if it does not exist.
+
+    @returns NULL if the shared memory exists with some other size
+*/
+void *ov_shm_map(const char *name, size_t size);
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_shm_unmap(void *memory, size_t size);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Initialize the header, unless some other process did, and check it.
+
+    @returns false if the header was initialized for some other layout
+*/
+bool ov_shm_header_init(ov_shm_header *header, uint32_t magic,
+                        uint32_t slots, uint32_t slot_size);
+
+#endif /* ov_shm_h */
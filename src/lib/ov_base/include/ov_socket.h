@@ -117,6 +117,24 @@ typedef struct {
 int ov_socket_create(ov_socket_configuration config, bool as_client,
                      ov_socket_error *err_return);
 
+/*---------------------------------------------------------------------------*/
+
+/*
+        Create a TCP or UDP server socket with SO_REUSEPORT set.
+
+        Several sockets of the process (e.g. one per thread) may be bound
+        to the same address this way, incoming connections or datagrams
+        are distributed among them by the kernel based on the remote
+        address.
+
+        @param config           configuration to be used
+        @param err_return       (optional) container for error messages
+        @returns                on success (socket created)
+                                on error -1
+*/
+int ov_socket_create_reuseport(ov_socket_configuration config,
+                               ov_socket_error *err_return);
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -332,6 +350,7 @@ int ov_socket_close_local(int socket);
 bool ov_socket_set_dont_fragment(int socket);
 bool ov_socket_ensure_nonblocking(int socket);
 bool ov_socket_set_reuseaddress(int socket);
+bool ov_socket_set_reuseport(int socket);
 
 bool ov_socket_disable_nagl(int socket);
 bool ov_socket_disable_delayed_ack(int socket);
@@ -0,0 +1,85 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_spsc_queue.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Bounded lock free queue of pointers between exactly
+                        one producer thread and one consumer thread.
+
+        Push and pop never block and never allocate. If the queue is full,
+        push fails and the caller keeps ownership of the item.
+
+        The capacity is rounded up to the next power of 2.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_spsc_queue_h
+#define ov_spsc_queue_h
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_spsc_queue ov_spsc_queue;
+
+/*----------------------------------------------------------------------------*/
+
+ov_spsc_queue *ov_spsc_queue_create(size_t capacity);
+
+/**
+    Free the queue, items still queued are freed with item_free if given.
+    Must not be called while producer or consumer use the queue.
+*/
+ov_spsc_queue *ov_spsc_queue_free(ov_spsc_queue *self,
+                                  void *(*item_free)(void *));
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Producer side.
+
+    @returns false if the queue is full or item is NULL
+*/
+bool ov_spsc_queue_push(ov_spsc_queue *self, void *item);
+
+/**
+    Consumer side.
+
+    @returns the oldest item or NULL if the queue is empty
+*/
+void *ov_spsc_queue_pop(ov_spsc_queue *self);
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_spsc_queue_capacity(const ov_spsc_queue *self);
+
+/**
+    @returns the number of items queued, exact for producer or consumer,
+    a snapshot for any other thread
+*/
+size_t ov_spsc_queue_count(ov_spsc_queue *self);
+
+#endif /* ov_spsc_queue_h */
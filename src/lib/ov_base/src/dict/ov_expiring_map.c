@@ -0,0 +1,457 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_expiring_map.c
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Implementation of a string keyed map with expiry
+                        based on a timing wheel.
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_expiring_map.h"
+
+#include "../../include/ov_dict.h"
+#include "../../include/ov_time.h"
+#include "../../include/ov_utils.h"
+
+#define IMPL_MIN_RESOLUTION_USEC 1000 // 1ms
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Entry Entry;
+
+struct Entry {
+
+    /* list of the wheel bucket */
+    Entry *prev;
+    Entry *next;
+
+    uint64_t expiry_usec;
+    size_t bucket;
+    void *value;
+
+    char key[];
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_expiring_map {
+
+    ov_expiring_map_config config;
+
+    /* key -> Entry, keys are owned by the entries */
+    ov_dict *dict;
+    size_t count;
+
+    struct {
+
+        Entry **bucket;
+        uint64_t tick; // last tick processed
+
+    } wheel;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t hash_fnv1a(const void *key) {
+
+    /* 64 bit FNV-1a, the default pearson hash of ov_dict is limited to
+     * 256 distinct values, which is not enough for large maps */
+
+    uint64_t hash = 0xcbf29ce484222325;
+
+    for (const uint8_t *c = key; (c != NULL) && (0 != *c); ++c) {
+        hash ^= *c;
+        hash *= 0x100000001b3;
+    }
+
+    return hash;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void entry_link(ov_expiring_map *self, Entry *entry) {
+
+    uint64_t tick = entry->expiry_usec / self->config.wheel.resolution_usec;
+
+    /* already behind the last processed tick, expire with the next run */
+    if (tick < self->wheel.tick)
+        tick = self->wheel.tick;
+
+    entry->bucket = tick % self->config.wheel.slots;
+
+    Entry **bucket = &self->wheel.bucket[entry->bucket];
+
+    entry->prev = NULL;
+    entry->next = *bucket;
+
+    if (*bucket)
+        (*bucket)->prev = entry;
+
+    *bucket = entry;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void entry_unlink(ov_expiring_map *self, Entry *entry) {
+
+    if (entry->prev) {
+
+        entry->prev->next = entry->next;
+
+    } else {
+
+        OV_ASSERT(self->wheel.bucket[entry->bucket] == entry);
+        self->wheel.bucket[entry->bucket] = entry->next;
+    }
+
+    if (entry->next)
+        entry->next->prev = entry->prev;
+
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Entry *entry_detach(ov_expiring_map *self, Entry *entry) {
+
+    entry_unlink(self, entry);
+
+    Entry *removed = ov_dict_remove(self->dict, entry->key);
+    OV_ASSERT(removed == entry);
+    UNUSED(removed);
+
+    OV_ASSERT(self->count > 0);
+    self->count--;
+
+    return entry;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *entry_free(ov_expiring_map *self, Entry *entry) {
+
+    if (!entry)
+        return NULL;
+
+    if (entry->value && self->config.value.free)
+        entry->value = self->config.value.free(entry->value);
+
+    free(entry);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_expiring_map *ov_expiring_map_create(ov_expiring_map_config config) {
+
+    ov_expiring_map *self = NULL;
+
+    if (0 == config.slots)
+        config.slots = OV_EXPIRING_MAP_DEFAULT_SLOTS;
+
+    if (0 == config.wheel.slots)
+        config.wheel.slots = OV_EXPIRING_MAP_DEFAULT_WHEEL_SLOTS;
+
+    if (0 == config.wheel.resolution_usec)
+        config.wheel.resolution_usec = OV_EXPIRING_MAP_DEFAULT_RESOLUTION_USEC;
+
+    if (IMPL_MIN_RESOLUTION_USEC > config.wheel.resolution_usec)
+        config.wheel.resolution_usec = IMPL_MIN_RESOLUTION_USEC;
+
+    self = calloc(1, sizeof(ov_expiring_map));
+    if (!self)
+        goto error;
+
+    self->config = config;
+
+    ov_dict_config d_config = ov_dict_string_key_config(config.slots);
+    d_config.key.data_function = (ov_data_function){0};
+    d_config.key.hash = hash_fnv1a;
+
+    self->dict = ov_dict_create(d_config);
+    if (!self->dict)
+        goto error;
+
+    self->wheel.bucket = calloc(config.wheel.slots, sizeof(Entry *));
+    if (!self->wheel.bucket)
+        goto error;
+
+    self->wheel.tick =
+        ov_time_get_current_time_usecs() / config.wheel.resolution_usec;
+
+    return self;
+error:
+    ov_expiring_map_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_expiring_map *ov_expiring_map_free(ov_expiring_map *self) {
+
+    if (!self)
+        return NULL;
+
+    self->dict = ov_dict_free(self->dict);
+
+    if (self->wheel.bucket) {
+
+        for (size_t i = 0; i < self->config.wheel.slots; i++) {
+
+            Entry *entry = self->wheel.bucket[i];
+
+            while (entry) {
+
+                Entry *next = entry->next;
+                entry_free(self, entry);
+                entry = next;
+            }
+        }
+
+        self->wheel.bucket = ov_data_pointer_free(self->wheel.bucket);
+    }
+
+    self = ov_data_pointer_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_expiring_map_config ov_expiring_map_get_config(const ov_expiring_map *self) {
+
+    if (!self)
+        return (ov_expiring_map_config){0};
+
+    return self->config;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      ENTRY FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+bool ov_expiring_map_set(ov_expiring_map *self, const char *key, void *value,
+                         uint64_t lifetime_usec) {
+
+    Entry *entry = NULL;
+
+    if (!self || !key)
+        goto error;
+
+    entry = ov_dict_get(self->dict, key);
+
+    if (entry) {
+
+        if ((entry->value != value) && entry->value && self->config.value.free)
+            self->config.value.free(entry->value);
+
+        entry_unlink(self, entry);
+
+    } else {
+
+        size_t len = strlen(key);
+
+        entry = calloc(1, sizeof(Entry) + len + 1);
+        if (!entry)
+            goto error;
+
+        memcpy(entry->key, key, len);
+
+        if (!ov_dict_set(self->dict, entry->key, entry, NULL)) {
+            entry = ov_data_pointer_free(entry);
+            goto error;
+        }
+
+        self->count++;
+    }
+
+    entry->value = value;
+    entry->expiry_usec = ov_time_get_current_time_usecs() + lifetime_usec;
+
+    entry_link(self, entry);
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_expiring_map_get(const ov_expiring_map *self, const char *key) {
+
+    if (!self || !key)
+        return NULL;
+
+    Entry *entry = ov_dict_get(self->dict, key);
+    if (!entry)
+        return NULL;
+
+    return entry->value;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_expiring_map_remove(ov_expiring_map *self, const char *key) {
+
+    if (!self || !key)
+        return NULL;
+
+    Entry *entry = ov_dict_get(self->dict, key);
+    if (!entry)
+        return NULL;
+
+    entry = entry_detach(self, entry);
+
+    void *value = entry->value;
+    free(entry);
+
+    return value;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_expiring_map_del(ov_expiring_map *self, const char *key) {
+
+    if (!self || !key)
+        return false;
+
+    Entry *entry = ov_dict_get(self->dict, key);
+    if (!entry)
+        return true;
+
+    entry = entry_detach(self, entry);
+    entry_free(self, entry);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_expiring_map_del_if(ov_expiring_map *self, void *data,
+                              bool (*match)(const char *key, void *value,
+                                            void *data)) {
+
+    if (!self || !match)
+        return 0;
+
+    size_t count = 0;
+
+    for (size_t i = 0; i < self->config.wheel.slots; i++) {
+
+        Entry *entry = self->wheel.bucket[i];
+
+        while (entry) {
+
+            Entry *next = entry->next;
+
+            if (match(entry->key, entry->value, data)) {
+
+                entry = entry_detach(self, entry);
+                entry_free(self, entry);
+                count++;
+            }
+
+            entry = next;
+        }
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_expiring_map_expire(ov_expiring_map *self, uint64_t now_usec) {
+
+    if (!self)
+        return 0;
+
+    uint64_t tick = now_usec / self->config.wheel.resolution_usec;
+
+    /* clock moved backwards */
+    if (tick < self->wheel.tick)
+        self->wheel.tick = tick;
+
+    uint64_t ticks = tick - self->wheel.tick + 1;
+    if (ticks > self->config.wheel.slots)
+        ticks = self->config.wheel.slots;
+
+    /* Detach all expired entries first, so the callbacks are free to
+     * use the map. Detached entries are chained using next. */
+
+    Entry *expired = NULL;
+
+    for (uint64_t t = 0; t < ticks; t++) {
+
+        size_t i = (self->wheel.tick + t) % self->config.wheel.slots;
+        Entry *entry = self->wheel.bucket[i];
+
+        while (entry) {
+
+            Entry *next = entry->next;
+
+            if (entry->expiry_usec <= now_usec) {
+
+                entry = entry_detach(self, entry);
+                entry->next = expired;
+                expired = entry;
+            }
+
+            entry = next;
+        }
+    }
+
+    self->wheel.tick = tick;
+
+    size_t count = 0;
+
+    while (expired) {
+
+        Entry *entry = expired;
+        expired = entry->next;
+
+        if (self->config.value.expired)
+            self->config.value.expired(self->config.value.userdata, entry->key,
+                                       entry->value);
+
+        entry_free(self, entry);
+        count++;
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_expiring_map_count(const ov_expiring_map *self) {
+
+    if (!self)
+        return 0;
+
+    return self->count;
+}
@@ -0,0 +1,441 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_expiring_map_test.c
+
+        @date           2026-10-18
+
+        @ingroup        ov_base
+
+        @brief          Unit tests of ov_expiring_map
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_expiring_map.c"
+#include <ov_test/testrun.h>
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST HELPER                                                     #HELPER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+struct dummy_userdata {
+
+    ov_expiring_map *map;
+    size_t expired;
+    char last[20];
+};
+
+/*----------------------------------------------------------------------------*/
+
+static void dummy_expired(void *userdata, const char *key, void *value) {
+
+    struct dummy_userdata *data = userdata;
+
+    data->expired++;
+    strncpy(data->last, key, sizeof(data->last) - 1);
+
+    UNUSED(value);
+
+    /* callbacks MAY use the map */
+    if (data->map)
+        ov_expiring_map_del(data->map, "other");
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool match_prefix(const char *key, void *value, void *data) {
+
+    UNUSED(value);
+    return (0 == strncmp(key, (const char *)data, strlen(data)));
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CASES                                                      #CASES
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int test_ov_expiring_map_create() {
+
+    ov_expiring_map *map = ov_expiring_map_create((ov_expiring_map_config){0});
+    testrun(map);
+
+    ov_expiring_map_config config = ov_expiring_map_get_config(map);
+    testrun(config.slots == OV_EXPIRING_MAP_DEFAULT_SLOTS);
+    testrun(config.wheel.slots == OV_EXPIRING_MAP_DEFAULT_WHEEL_SLOTS);
+    testrun(config.wheel.resolution_usec ==
+            OV_EXPIRING_MAP_DEFAULT_RESOLUTION_USEC);
+
+    testrun(NULL == ov_expiring_map_free(map));
+
+    map = ov_expiring_map_create(
+        (ov_expiring_map_config){.wheel.resolution_usec = 1});
+    testrun(map);
+
+    config = ov_expiring_map_get_config(map);
+    testrun(config.wheel.resolution_usec == IMPL_MIN_RESOLUTION_USEC);
+
+    testrun(NULL == ov_expiring_map_free(map));
+    testrun(NULL == ov_expiring_map_free(NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_expiring_map_set() {
+
+    ov_expiring_map *map = ov_expiring_map_create(
+        (ov_expiring_map_config){.value.free = ov_data_pointer_free});
+    testrun(map);
+
+    char *one = strdup("one");
+    char *two = strdup("two");
+
+    testrun(!ov_expiring_map_set(NULL, "1", one, 1000));
+    testrun(!ov_expiring_map_set(map, NULL, one, 1000));
+
+    testrun(ov_expiring_map_set(map, "1", one, 1000));
+    testrun(1 == ov_expiring_map_count(map));
+    testrun(one == ov_expiring_map_get(map, "1"));
+
+    // set same value again
+    testrun(ov_expiring_map_set(map, "1", one, 2000));
+    testrun(1 == ov_expiring_map_count(map));
+    testrun(one == ov_expiring_map_get(map, "1"));
+
+    // replace (one will be freed)
+    testrun(ov_expiring_map_set(map, "1", two, 2000));
+    testrun(1 == ov_expiring_map_count(map));
+    testrun(two == ov_expiring_map_get(map, "1"));
+
+    testrun(ov_expiring_map_set(map, "2", NULL, 2000));
+    testrun(2 == ov_expiring_map_count(map));
+    testrun(NULL == ov_expiring_map_get(map, "2"));
+
+    // free with content
+    testrun(NULL == ov_expiring_map_free(map));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_expiring_map_get() {
+
+    ov_expiring_map *map = ov_expiring_map_create((ov_expiring_map_config){0});
+    testrun(map);
+
+    char *value = "value";
+
+    testrun(!ov_expiring_map_get(NULL, NULL));
+    testrun(!ov_expiring_map_get(map, NULL));
+    testrun(!ov_expiring_map_get(NULL, "1"));
+    testrun(!ov_expiring_map_get(map, "1"));
+
+    testrun(ov_expiring_map_set(map, "1", value, 1000));
+    testrun(value == ov_expiring_map_get(map, "1"));
+
+    // key is copied
+    char key[] = "2";
+    testrun(ov_expiring_map_set(map, key, value, 1000));
+    key[0] = '3';
+    testrun(value == ov_expiring_map_get(map, "2"));
+    testrun(NULL == ov_expiring_map_get(map, "3"));
+
+    testrun(NULL == ov_expiring_map_free(map));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_expiring_map_remove() {
+
+    ov_expiring_map *map = ov_expiring_map_create(
+        (ov_expiring_map_config){.value.free = ov_data_pointer_free});
+    testrun(map);
+
+    char *value = strdup("value");
+
+    testrun(ov_expiring_map_set(map, "1", value, 1000));
+    testrun(ov_expiring_map_set(map, "2", strdup("2"), 1000));
+    testrun(ov_expiring_map_set(map, "3", strdup("3"), 1000));
+    testrun(3 == ov_expiring_map_count(map));
+
+    testrun(NULL == ov_expiring_map_remove(NULL, "1"));
+    testrun(NULL == ov_expiring_map_remove(map, NULL));
+    testrun(NULL == ov_expiring_map_remove(map, "4"));
+
+    testrun(value == ov_expiring_map_remove(map, "1"));
+    testrun(2 == ov_expiring_map_count(map));
+    testrun(NULL == ov_expiring_map_get(map, "1"));
+    testrun(NULL == ov_expiring_map_remove(map, "1"));
+    free(value);
+
+    testrun(!ov_expiring_map_del(NULL, "2"));
+    testrun(!ov_expiring_map_del(map, NULL));
+
+    testrun(ov_expiring_map_del(map, "2"));
+    testrun(1 == ov_expiring_map_count(map));
+    testrun(ov_expiring_map_del(map, "2"));
+    testrun(1 == ov_expiring_map_count(map));
+
+    testrun(ov_expiring_map_del(map, "3"));
+    testrun(0 == ov_expiring_map_count(map));
+
+    testrun(NULL == ov_expiring_map_free(map));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_expiring_map_del_if() {
+
+    ov_expiring_map *map = ov_expiring_map_create(
+        (ov_expiring_map_config){.value.free = ov_data_pointer_free});
+    testrun(map);
+
+    testrun(ov_expiring_map_set(map, "a1", strdup("1"), 1000));
+    testrun(ov_expiring_map_set(map, "a2", strdup("2"), 1000000));
+    testrun(ov_expiring_map_set(map, "b1", strdup("3"), 1000));
+    testrun(ov_expiring_map_set(map, "b2", strdup("4"), 1000000000));
+
+    testrun(0 == ov_expiring_map_del_if(NULL, "a", match_prefix));
+    testrun(0 == ov_expiring_map_del_if(map, "a", NULL));
+
+    testrun(2 == ov_expiring_map_del_if(map, "a", match_prefix));
+    testrun(2 == ov_expiring_map_count(map));
+    testrun(!ov_expiring_map_get(map, "a1"));
+    testrun(!ov_expiring_map_get(map, "a2"));
+    testrun(ov_expiring_map_get(map, "b1"));
+    testrun(ov_expiring_map_get(map, "b2"));
+
+    testrun(0 == ov_expiring_map_del_if(map, "a", match_prefix));
+    testrun(2 == ov_expiring_map_del_if(map, "b", match_prefix));
+    testrun(0 == ov_expiring_map_count(map));
+
+    testrun(NULL == ov_expiring_map_free(map));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_expiring_map_expire() {
+
+    struct dummy_userdata userdata = {0};
+
+    ov_expiring_map *map = ov_expiring_map_create((ov_expiring_map_config){
+
+        .wheel.slots = 16,
+        .wheel.resolution_usec = 10000,
+        .value.free = ov_data_pointer_free,
+        .value.userdata = &userdata,
+        .value.expired = dummy_expired});
+
+    testrun(map);
+
+    uint64_t now = ov_time_get_current_time_usecs();
+
+    testrun(ov_expiring_map_set(map, "1", strdup("1"), 0));
+    testrun(ov_expiring_map_set(map, "2", strdup("2"), 50000));
+    testrun(ov_expiring_map_set(map, "3", strdup("3"), 100000));
+
+    // longer than one turn of the wheel (160ms)
+    testrun(ov_expiring_map_set(map, "4", strdup("4"), 1000000));
+
+    testrun(0 == ov_expiring_map_expire(NULL, now));
+
+    testrun(1 == ov_expiring_map_expire(map, now + 1000));
+    testrun(1 == userdata.expired);
+    testrun(0 == strcmp(userdata.last, "1"));
+    testrun(3 == ov_expiring_map_count(map));
+
+    testrun(0 == ov_expiring_map_expire(map, now + 30000));
+    testrun(3 == ov_expiring_map_count(map));
+
+    testrun(1 == ov_expiring_map_expire(map, now + 80000));
+    testrun(0 == strcmp(userdata.last, "2"));
+    testrun(2 == ov_expiring_map_count(map));
+    testrun(!ov_expiring_map_get(map, "2"));
+
+    // skip more than one turn of the wheel, 4 not expired yet
+    testrun(1 == ov_expiring_map_expire(map, now + 500000));
+    testrun(0 == strcmp(userdata.last, "3"));
+    testrun(1 == ov_expiring_map_count(map));
+
+    // several turns in small steps
+    for (uint64_t t = 500000; t < 990000; t += 10000) {
+        testrun(0 == ov_expiring_map_expire(map, now + t));
+    }
+
+    testrun(1 == ov_expiring_map_count(map));
+    testrun(1 == ov_expiring_map_expire(map, now + 1020000));
+    testrun(0 == strcmp(userdata.last, "4"));
+    testrun(0 == ov_expiring_map_count(map));
+    testrun(4 == userdata.expired);
+
+    // callback using the map, continue after the last expire run
+    userdata.map = map;
+    now += 1100000;
+
+    testrun(ov_expiring_map_set(map, "1", strdup("1"), 0));
+    testrun(ov_expiring_map_set(map, "other", strdup("2"), 0));
+    testrun(ov_expiring_map_set(map, "3", strdup("3"), 10000000));
+
+    testrun(2 == ov_expiring_map_expire(map, now + 20000));
+    testrun(1 == ov_expiring_map_count(map));
+    testrun(ov_expiring_map_get(map, "3"));
+
+    // reset lifetime with set
+    testrun(ov_expiring_map_set(map, "3", ov_expiring_map_get(map, "3"), 0));
+    testrun(1 == ov_expiring_map_expire(map, now + 40000));
+    testrun(0 == ov_expiring_map_count(map));
+
+    // clock moved backwards
+    testrun(ov_expiring_map_set(map, "1", strdup("1"), 10000));
+    testrun(0 == ov_expiring_map_expire(map, now - 1000000));
+    testrun(1 == ov_expiring_map_expire(map, now + 100000));
+
+    testrun(NULL == ov_expiring_map_free(map));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool collect_expired(const void *key, void *value, void *data) {
+
+    if (!key)
+        return true;
+
+    uint64_t *expiry = value;
+    ov_list *list = data;
+
+    if (*expiry < 1)
+        return ov_list_push(list, (void *)key);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_ov_expiring_map_performance() {
+
+    size_t entries = 50000;
+    size_t sweeps = 100;
+
+    char key[20] = {0};
+    uint64_t expiry = 1;
+
+    ov_expiring_map *map = ov_expiring_map_create((ov_expiring_map_config){0});
+    testrun(map);
+
+    ov_dict *dict = ov_dict_create(ov_dict_string_key_config(255));
+    testrun(dict);
+
+    uint64_t start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < entries; i++) {
+        snprintf(key, sizeof(key), "%zu", i);
+        testrun(ov_expiring_map_set(map, key, &expiry, 10000000));
+    }
+    uint64_t map_insert = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < entries; i++) {
+        snprintf(key, sizeof(key), "%zu", i);
+        testrun(ov_dict_set(dict, strdup(key), &expiry, NULL));
+    }
+    uint64_t dict_insert = ov_time_get_current_time_usecs() - start;
+
+    /* expiry sweeps as done on the timer, nothing expired */
+
+    uint64_t now = ov_time_get_current_time_usecs();
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < sweeps; i++) {
+        testrun(0 == ov_expiring_map_expire(map, now + i * 1000));
+    }
+    uint64_t map_sweep = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < sweeps; i++) {
+        ov_list *list = ov_list_create((ov_list_config){0});
+        testrun(ov_dict_for_each(dict, list, collect_expired));
+        testrun(0 == ov_list_count(list));
+        list = ov_list_free(list);
+    }
+    uint64_t dict_sweep = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout,
+            "expiring map %zu entries: insert %.0f ns/op (dict %.0f ns/op), "
+            "sweep %.0f us (dict walk %.0f us)\n",
+            entries, 1000.0 * map_insert / entries,
+            1000.0 * dict_insert / entries, (double)map_sweep / sweeps,
+            (double)dict_sweep / sweeps);
+
+    testrun(NULL == ov_expiring_map_free(map));
+    testrun(NULL == ov_dict_free(dict));
+
+    return testrun_log_success();
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CLUSTER                                                    #CLUSTER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_expiring_map_create);
+    testrun_test(test_ov_expiring_map_set);
+    testrun_test(test_ov_expiring_map_get);
+    testrun_test(test_ov_expiring_map_remove);
+    testrun_test(test_ov_expiring_map_del_if);
+    testrun_test(test_ov_expiring_map_expire);
+    testrun_test(check_ov_expiring_map_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
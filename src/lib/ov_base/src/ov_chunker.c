@@ -28,6 +28,13 @@
 #include "ov_buffer.h"
 #include <../include/ov_registered_cache.h>
 
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 /*----------------------------------------------------------------------------*/
 
 #define MAGIC_BYTES 0x43ffff43
@@ -38,6 +45,21 @@ struct ov_chunker_struct {
 
     ov_buffer *buffer;
     uint8_t const *read_ptr;
+
+    /*
+     * Ring mode only.
+     * The ring is mapped twice in a row, any ring.length octets starting
+     * at ring.start + ring.read are contiguous in memory.
+     */
+    struct {
+
+        uint8_t *start;
+        size_t capacity;
+
+        size_t read;
+        size_t length;
+
+    } ring;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -64,6 +86,99 @@ static ov_chunker *as_chunker_mutable(void *vptr) {
 
 /*----------------------------------------------------------------------------*/
 
+static uint8_t *ring_map(size_t capacity) {
+
+    static _Atomic uint32_t rings = 0;
+
+    uint8_t *start = MAP_FAILED;
+    int fd = -1;
+
+    char name[64] = {0};
+    snprintf(name, sizeof(name), "/ov_chunker_%ld_%" PRIu32, (long)getpid(),
+             atomic_fetch_add(&rings, 1));
+
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (0 > fd)
+        goto error;
+
+    // Only the mappings are required
+    shm_unlink(name);
+
+    if (0 != ftruncate(fd, capacity))
+        goto error;
+
+    start = mmap(0, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                 0);
+
+    if (MAP_FAILED == start)
+        goto error;
+
+    if ((MAP_FAILED == mmap(start, capacity, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_FIXED, fd, 0)) ||
+        (MAP_FAILED == mmap(start + capacity, capacity, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_FIXED, fd, 0)))
+        goto error;
+
+    close(fd);
+    return start;
+
+error:
+
+    if (0 <= fd)
+        close(fd);
+
+    if (MAP_FAILED != start)
+        munmap(start, 2 * capacity);
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t available_octets(ov_chunker const *self) {
+
+    if (0 != self->ring.start) {
+        return self->ring.length;
+    } else {
+        return self->buffer->length - (self->read_ptr - self->buffer->start);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint8_t const *read_pointer(ov_chunker const *self) {
+
+    if (0 != self->ring.start) {
+        return self->ring.start + self->ring.read;
+    } else {
+        return self->read_ptr;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void consume(ov_chunker *self, size_t num_octets) {
+
+    if (0 != self->ring.start) {
+
+        self->ring.read = (self->ring.read + num_octets) % self->ring.capacity;
+        self->ring.length -= num_octets;
+
+    } else {
+
+        self->read_ptr += num_octets;
+
+        if (self->read_ptr == self->buffer->start + self->buffer->length) {
+
+            // Drained, start over
+            self->buffer->length = 0;
+            self->read_ptr = self->buffer->start;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
 ov_chunker *ov_chunker_create() {
 
     ov_chunker *self = calloc(1, sizeof(ov_chunker));
@@ -78,12 +193,51 @@ ov_chunker *ov_chunker_create() {
 
 /*----------------------------------------------------------------------------*/
 
+ov_chunker *ov_chunker_create_ring(size_t capacity) {
+
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    if ((!ov_cond_valid(0 < capacity, "Cannot create chunker: capacity 0")) ||
+        (0 >= page_size)) {
+        return 0;
+    }
+
+    capacity = (capacity + page_size - 1) / page_size * page_size;
+
+    uint8_t *start = ring_map(capacity);
+
+    if (!ov_ptr_valid(start, "Cannot create chunker: could not map ring")) {
+        return 0;
+    }
+
+    ov_chunker *self = calloc(1, sizeof(ov_chunker));
+
+    if (!ov_ptr_valid(self, "Cannot create chunker: out of memory")) {
+        munmap(start, 2 * capacity);
+        return 0;
+    }
+
+    self->magic_bytes = MAGIC_BYTES;
+    self->ring.start = start;
+    self->ring.capacity = capacity;
+
+    return self;
+}
+
+/*----------------------------------------------------------------------------*/
+
 ov_chunker *ov_chunker_free(ov_chunker *self) {
 
     self = as_chunker_mutable(self);
 
     if (0 != self) {
+
         self->buffer = ov_buffer_free(self->buffer);
+
+        if (0 != self->ring.start) {
+            munmap(self->ring.start, 2 * self->ring.capacity);
+            self->ring.start = 0;
+        }
     }
 
     return ov_free(self);
@@ -148,13 +302,68 @@ static ov_buffer *merge_data(uint8_t const *restrict b1, size_t b1len,
 
 /*----------------------------------------------------------------------------*/
 
+static bool compact_and_append(ov_chunker *self, ov_buffer const *data) {
+
+    size_t available = available_octets(self);
+
+    if (self->buffer->capacity - available <= data->length) {
+        return false;
+    }
+
+    if (self->read_ptr != self->buffer->start) {
+        memmove(self->buffer->start, self->read_ptr, available);
+    }
+
+    self->buffer->length = available;
+    self->read_ptr = self->buffer->start;
+
+    return append_to_buffer(self->buffer, data);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool add_to_ring(ov_chunker *self, ov_buffer const *data) {
+
+    // Full ring is backpressure, not an error
+    if (data->length > self->ring.capacity - self->ring.length) {
+        return false;
+    }
+
+    size_t write = (self->ring.read + self->ring.length) % self->ring.capacity;
+
+    if (0 < data->length) {
+        memcpy(self->ring.start + write, data->start, data->length);
+    }
+
+    self->ring.length += data->length;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
 size_t ov_chunker_available_octets(ov_chunker *self) {
 
     if (ov_ptr_valid(as_chunker(self),
                      "Cannot get available octets - invalid chunker "
                      "instance")) {
 
-        return self->buffer->length - (self->read_ptr - self->buffer->start);
+        return available_octets(self);
+
+    } else {
+
+        return 0;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_chunker_capacity(ov_chunker *self) {
+
+    if (ov_ptr_valid(as_chunker(self),
+                     "Cannot get capacity - invalid chunker instance")) {
+
+        return self->ring.capacity;
 
     } else {
 
@@ -170,13 +379,15 @@ bool ov_chunker_add(ov_chunker *self, ov_buffer const *data) {
                      "Cannot add data - no valid chunker instance") &&
         ov_ptr_valid(data, "Cannot add data - no data (0 pointer)")) {
 
-        if ((0 != data->length) && !append_to_buffer(self->buffer, data)) {
+        if (0 != self->ring.start) {
+
+            return add_to_ring(self, data);
+
+        } else if ((0 != data->length) &&
+                   !append_to_buffer(self->buffer, data) &&
+                   !compact_and_append(self, data)) {
 
-            // Trying to 'defrag' self->buffer does not yield anything,
-            // because in order to copy round data within the buffer,
-            // we would require a copy of the data...
-            // Then we can just create the copy straight away and
-            // work on it.
+            // Does not fit into the current buffer at all, grow
             ov_buffer *merged = merge_data(
                 self->read_ptr,
                 self->buffer->length - (self->read_ptr - self->buffer->start),
@@ -214,13 +425,10 @@ uint8_t const *ov_chunker_next_chunk_preview(ov_chunker *self,
                                        "chunker "
                                        "instance")) {
 
-        size_t available_octets =
-            self->buffer->length - (self->read_ptr - self->buffer->start);
-
-        if (ov_cond_valid_debug(num_octets <= available_octets,
+        if (ov_cond_valid_debug(num_octets <= available_octets(self),
                                 "Cannot get more data - not enough data")) {
 
-            return self->read_ptr;
+            return read_pointer(self);
 
         } else {
 
@@ -243,14 +451,11 @@ bool ov_chunker_next_chunk_raw(ov_chunker *self, size_t num_octets,
                                        "instance") &&
         ov_ptr_valid(dest, "Cannot get more data - 0 pointer")) {
 
-        size_t available_octets =
-            self->buffer->length - (self->read_ptr - self->buffer->start);
-
-        if (ov_cond_valid_debug(num_octets <= available_octets,
+        if (ov_cond_valid_debug(num_octets <= available_octets(self),
                                 "Cannot get more data - not enough data")) {
 
-            memcpy(dest, self->read_ptr, num_octets);
-            self->read_ptr += num_octets;
+            memcpy(dest, read_pointer(self), num_octets);
+            consume(self, num_octets);
 
             return true;
 
@@ -267,6 +472,24 @@ bool ov_chunker_next_chunk_raw(ov_chunker *self, size_t num_octets,
 
 /*----------------------------------------------------------------------------*/
 
+bool ov_chunker_skip(ov_chunker *self, size_t num_octets) {
+
+    if (ov_ptr_valid(as_chunker(self), "Cannot skip data - invalid chunker "
+                                       "instance") &&
+        ov_cond_valid_debug(num_octets <= available_octets(self),
+                            "Cannot skip data - not enough data")) {
+
+        consume(self, num_octets);
+        return true;
+
+    } else {
+
+        return false;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
 ov_buffer *ov_chunker_next_chunk(ov_chunker *self, size_t num_octets) {
 
     ov_buffer *data = ov_buffer_create(num_octets);
@@ -290,10 +513,7 @@ ov_buffer *ov_chunker_remainder(ov_chunker *self) {
     if (ov_ptr_valid(as_chunker(self), "Cannot get more data - invalid chunker "
                                        "instance")) {
 
-        size_t available_octets =
-            self->buffer->length - (self->read_ptr - self->buffer->start);
-
-        return ov_chunker_next_chunk(self, available_octets);
+        return ov_chunker_next_chunk(self, available_octets(self));
 
     } else {
 
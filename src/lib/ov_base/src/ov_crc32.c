@@ -31,6 +31,13 @@
 #include "../include/ov_crc32.h"
 #include "../include/ov_utils.h"
 
+#include <pthread.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OV_CRC32_CLMUL 1
+#include <immintrin.h>
+#endif
+
 /*----------------------------------------------------------------------------*/
 
 static uint32_t reflect_bits(uint32_t n) {
@@ -126,12 +133,9 @@ bool ov_crc32_generate_table_for(uint32_t polynomial, bool reverted_in,
 static uint32_t crc32_straight_in(uint32_t crc, uint8_t const *data,
                                   size_t len_octets, uint32_t lookup[0x100]) {
 
-    // fprintf(stderr, "Calculating checksum: ");
     for (size_t i = 0; i < len_octets; ++i) {
-        //     fprintf(stderr, "%" PRIu8 " ", data[i]);
         crc = (crc << 8) ^ lookup[data[i] ^ ((crc >> 24) & 0x000000ff)];
     }
-    fprintf(stderr, "\n");
 
     return crc;
 }
@@ -148,6 +152,308 @@ static uint32_t crc32_reflected_in(uint32_t crc, uint8_t const *data,
     return crc;
 }
 
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      FAST ENGINES for polynomial 0x04c11db7
+ *
+ *      Ogg uses the polynomial straight, zlib (IEEE 802.3, STUN FINGERPRINT)
+ *      uses the reflected variant. Both are calculated using slice-by-8
+ *      tables and, if the CPU supports it, carry-less multiplication
+ *      (PCLMULQDQ) for blocks of at least 64 octets.
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+#define CRC32_POLYNOMIAL 0x04c11db7
+
+static struct {
+
+    uint32_t straight[8][0x100];
+    uint32_t reflected[8][0x100];
+
+    bool clmul;
+
+} engine;
+
+static pthread_once_t engine_once = PTHREAD_ONCE_INIT;
+
+/*----------------------------------------------------------------------------*/
+
+static void engine_init(void) {
+
+    ov_crc32_generate_table_for(CRC32_POLYNOMIAL, false, engine.straight[0]);
+    ov_crc32_generate_table_for(CRC32_POLYNOMIAL, true, engine.reflected[0]);
+
+    for (size_t k = 1; k < 8; ++k) {
+
+        for (size_t i = 0; i < 0x100; ++i) {
+
+            uint32_t s = engine.straight[k - 1][i];
+            engine.straight[k][i] = (s << 8) ^ engine.straight[0][s >> 24];
+
+            uint32_t r = engine.reflected[k - 1][i];
+            engine.reflected[k][i] = (r >> 8) ^ engine.reflected[0][r & 0xff];
+        }
+    }
+
+#ifdef OV_CRC32_CLMUL
+    __builtin_cpu_init();
+    engine.clmul = __builtin_cpu_supports("pclmul") &&
+                   __builtin_cpu_supports("sse4.1") &&
+                   __builtin_cpu_supports("ssse3");
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t crc32_straight_slice8(uint32_t crc, uint8_t const *data,
+                                      size_t len_octets) {
+
+    uint32_t(*t)[0x100] = engine.straight;
+
+    while (len_octets >= 8) {
+
+        uint32_t one = crc ^ ((uint32_t)data[0] << 24 |
+                              (uint32_t)data[1] << 16 |
+                              (uint32_t)data[2] << 8 | (uint32_t)data[3]);
+
+        uint32_t two = (uint32_t)data[4] << 24 | (uint32_t)data[5] << 16 |
+                       (uint32_t)data[6] << 8 | (uint32_t)data[7];
+
+        crc = t[7][one >> 24] ^ t[6][(one >> 16) & 0xff] ^
+              t[5][(one >> 8) & 0xff] ^ t[4][one & 0xff] ^ t[3][two >> 24] ^
+              t[2][(two >> 16) & 0xff] ^ t[1][(two >> 8) & 0xff] ^
+              t[0][two & 0xff];
+
+        data += 8;
+        len_octets -= 8;
+    }
+
+    return crc32_straight_in(crc, data, len_octets, t[0]);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t crc32_reflected_slice8(uint32_t crc, uint8_t const *data,
+                                       size_t len_octets) {
+
+    uint32_t(*t)[0x100] = engine.reflected;
+
+    while (len_octets >= 8) {
+
+        uint32_t one = crc ^ ((uint32_t)data[0] | (uint32_t)data[1] << 8 |
+                              (uint32_t)data[2] << 16 |
+                              (uint32_t)data[3] << 24);
+
+        uint32_t two = (uint32_t)data[4] | (uint32_t)data[5] << 8 |
+                       (uint32_t)data[6] << 16 | (uint32_t)data[7] << 24;
+
+        crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^
+              t[5][(one >> 16) & 0xff] ^ t[4][one >> 24] ^ t[3][two & 0xff] ^
+              t[2][(two >> 8) & 0xff] ^ t[1][(two >> 16) & 0xff] ^
+              t[0][two >> 24];
+
+        data += 8;
+        len_octets -= 8;
+    }
+
+    return crc32_reflected_in(crc, data, len_octets, t[0]);
+}
+
+/*----------------------------------------------------------------------------*/
+
+#ifdef OV_CRC32_CLMUL
+
+#define CLMUL_TARGET __attribute__((target("pclmul,sse4.1,ssse3")))
+
+CLMUL_TARGET static inline __m128i clmul_load(uint8_t const *data,
+                                              bool reverse_bits) {
+
+    __m128i x = _mm_loadu_si128((__m128i const *)data);
+
+    if (!reverse_bits)
+        return x;
+
+    /* reverse the bits of each octet using nibble lookups */
+
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    const __m128i rev_lo = _mm_setr_epi8(0x00, 0x80, 0x40, 0xc0, 0x20, 0xa0,
+                                         0x60, 0xe0, 0x10, 0x90, 0x50, 0xd0,
+                                         0x30, 0xb0, 0x70, 0xf0);
+
+    const __m128i rev_hi = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0c, 0x02, 0x0a,
+                                         0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d,
+                                         0x03, 0x0b, 0x07, 0x0f);
+
+    __m128i lo = _mm_and_si128(x, mask);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+
+    return _mm_or_si128(_mm_shuffle_epi8(rev_lo, lo),
+                        _mm_shuffle_epi8(rev_hi, hi));
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Folding of the reflected CRC using carry-less multiplication, as
+ * described in "Fast CRC Computation for Generic Polynomials Using
+ * PCLMULQDQ Instruction" (Intel, 2009).
+ *
+ * The straight (non reflected) CRC is calculated by reversing the bits of
+ * each input octet, which yields the reflected CRC of the straight one.
+ *
+ * len_octets MUST be a multiple of 16 and at least 64.
+ */
+CLMUL_TARGET static uint32_t crc32_clmul(uint32_t crc, uint8_t const *data,
+                                         size_t len_octets,
+                                         bool reverse_bits) {
+
+    /* x^(4*128+32) mod P, x^(4*128-32) mod P */
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    /* x^(128+32) mod P, x^(128-32) mod P */
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    /* x^64 mod P */
+    const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+    /* P and mu = x^64 / P (reflected) */
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = clmul_load(data + 0x00, reverse_bits);
+    x2 = clmul_load(data + 0x10, reverse_bits);
+    x3 = clmul_load(data + 0x20, reverse_bits);
+    x4 = clmul_load(data + 0x30, reverse_bits);
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+
+    data += 64;
+    len_octets -= 64;
+
+    /* fold 4 x 128 bit in parallel */
+
+    while (len_octets >= 64) {
+
+        x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+                           clmul_load(data + 0x00, reverse_bits));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+                           clmul_load(data + 0x10, reverse_bits));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+                           clmul_load(data + 0x20, reverse_bits));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+                           clmul_load(data + 0x30, reverse_bits));
+
+        data += 64;
+        len_octets -= 64;
+    }
+
+    /* fold into 128 bit */
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* fold remaining blocks of 16 */
+
+    while (len_octets >= 16) {
+
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, clmul_load(data, reverse_bits)),
+                           x5);
+
+        data += 16;
+        len_octets -= 16;
+    }
+
+    /* fold 128 bit to 64 bit */
+
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* barrett reduction to 32 bit */
+
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t crc32_straight_fast(uint32_t crc, uint8_t const *data,
+                                    size_t len_octets) {
+
+    pthread_once(&engine_once, engine_init);
+
+#ifdef OV_CRC32_CLMUL
+    if (engine.clmul && (len_octets >= 64)) {
+
+        size_t chunk = len_octets & ~(size_t)15;
+
+        crc = reflect_bits(crc32_clmul(reflect_bits(crc), data, chunk, true));
+
+        data += chunk;
+        len_octets -= chunk;
+    }
+#endif
+
+    return crc32_straight_slice8(crc, data, len_octets);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t crc32_reflected_fast(uint32_t crc, uint8_t const *data,
+                                     size_t len_octets) {
+
+    pthread_once(&engine_once, engine_init);
+
+#ifdef OV_CRC32_CLMUL
+    if (engine.clmul && (len_octets >= 64)) {
+
+        size_t chunk = len_octets & ~(size_t)15;
+
+        crc = crc32_clmul(crc, data, chunk, false);
+
+        data += chunk;
+        len_octets -= chunk;
+    }
+#endif
+
+    return crc32_reflected_slice8(crc, data, len_octets);
+}
+
 /*----------------------------------------------------------------------------*/
 
 uint32_t ov_crc32_sum(uint32_t crc, uint8_t const *data, size_t len_octets,
@@ -189,31 +495,21 @@ uint32_t ov_crc32_posix(uint8_t const *data, size_t len_octets) {
 
 uint32_t ov_crc32_ogg(uint32_t init, uint8_t const *data, size_t len_octets) {
 
-    static bool initialized = false;
-    static uint32_t lookup[0x100] = {0};
-
-    if (!initialized) {
-        ov_crc32_generate_table_for(0x04c11db7, false, lookup);
-        initialized = true;
-    }
+    if (!data)
+        return init;
 
-    return ov_crc32_sum(init, data, len_octets, false, false, lookup);
+    return crc32_straight_fast(init, data, len_octets);
 }
 
 /*----------------------------------------------------------------------------*/
 
 uint32_t ov_crc32_zlib(uint32_t init, uint8_t const *data, size_t len_octets) {
 
-    static uint32_t table[0x100] = {0};
-    static bool initialized = false;
-
-    if (!initialized) {
-        ov_crc32_generate_table_for(0x04c11db7, true, table);
-        initialized = true;
-    }
+    if (!data)
+        return init;
 
     return 0xffffffff ^
-           ov_crc32_sum(0xffffffff ^ init, data, len_octets, true, true, table);
+           crc32_reflected_fast(0xffffffff ^ init, data, len_octets);
 }
 
 /*----------------------------------------------------------------------------*/
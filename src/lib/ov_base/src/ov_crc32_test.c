@@ -25,6 +25,7 @@
         ------------------------------------------------------------------------
 */
 #include "ov_crc32.c"
+#include "../include/ov_time.h"
 #include <ov_test/ov_test.h>
 
 uint32_t start_values[] = {18, 97, 98, 99};
@@ -155,5 +156,183 @@ static int test_ov_crc32_zlib() {
 
 /*----------------------------------------------------------------------------*/
 
+static void fill_random(uint8_t *data, size_t len) {
+
+    for (size_t i = 0; i < len; ++i) {
+        data[i] = (uint8_t)random();
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool engines_equal(uint32_t init, uint8_t const *data, size_t len) {
+
+    pthread_once(&engine_once, engine_init);
+
+    uint32_t straight = crc32_straight_in(init, data, len, engine.straight[0]);
+    uint32_t reflected =
+        crc32_reflected_in(init, data, len, engine.reflected[0]);
+
+    if (straight != crc32_straight_slice8(init, data, len))
+        return false;
+
+    if (reflected != crc32_reflected_slice8(init, data, len))
+        return false;
+
+    if (straight != crc32_straight_fast(init, data, len))
+        return false;
+
+    if (reflected != crc32_reflected_fast(init, data, len))
+        return false;
+
+#ifdef OV_CRC32_CLMUL
+
+    if (engine.clmul && (len >= 64)) {
+
+        size_t chunk = len & ~(size_t)15;
+
+        uint32_t crc = crc32_clmul(init, data, chunk, false);
+        crc = crc32_reflected_in(crc, data + chunk, len - chunk,
+                                 engine.reflected[0]);
+
+        if (reflected != crc)
+            return false;
+
+        crc = reflect_bits(crc32_clmul(reflect_bits(init), data, chunk, true));
+        crc = crc32_straight_in(crc, data + chunk, len - chunk,
+                                engine.straight[0]);
+
+        if (straight != crc)
+            return false;
+    }
+
+#endif
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_crc32_engines() {
+
+    uint8_t data[5000] = {0};
+    fill_random(data, sizeof(data));
+
+    // all lengths around the block sizes of the engines
+    for (size_t len = 0; len < 300; ++len) {
+        testrun(engines_equal(0, data, len));
+        testrun(engines_equal(0xffffffff, data, len));
+        testrun(engines_equal((uint32_t)random(), data, len));
+    }
+
+    // misaligned input
+    for (size_t offset = 1; offset < 16; ++offset) {
+        testrun(engines_equal(0, data + offset, 1000));
+        testrun(engines_equal(0x12345678, data + offset, 257));
+    }
+
+    testrun(engines_equal(0, data, sizeof(data)));
+
+    // chaining over engine boundaries
+    uint32_t crc = ov_crc32_zlib(0, data, sizeof(data));
+    testrun(crc == ov_crc32_zlib(ov_crc32_zlib(0, data, 63), data + 63,
+                                 sizeof(data) - 63));
+
+    crc = ov_crc32_ogg(0, data, sizeof(data));
+    testrun(crc == ov_crc32_ogg(ov_crc32_ogg(0, data, 1001), data + 1001,
+                                sizeof(data) - 1001));
+
+    testrun(0 == ov_crc32_zlib(0, 0, 10));
+    testrun(17 == ov_crc32_ogg(17, 0, 10));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static double mb_per_sec(uint64_t usecs, size_t bytes) {
+
+    if (0 == usecs)
+        usecs = 1;
+
+    return (double)bytes / (double)usecs;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_crc32_performance() {
+
+    size_t len = 1024 * 1024;
+    size_t runs = 50;
+
+    uint8_t *data = calloc(1, len);
+    testrun(data);
+
+    fill_random(data, len);
+
+    pthread_once(&engine_once, engine_init);
+
+    uint32_t crc[3] = {0};
+    uint64_t start = 0;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; ++i) {
+        crc[0] = crc32_reflected_in(crc[0], data, len, engine.reflected[0]);
+    }
+    uint64_t bytewise = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; ++i) {
+        crc[1] = crc32_reflected_slice8(crc[1], data, len);
+    }
+    uint64_t slice8 = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; ++i) {
+        crc[2] = crc32_reflected_fast(crc[2], data, len);
+    }
+    uint64_t fast = ov_time_get_current_time_usecs() - start;
+
+    testrun(crc[0] == crc[1]);
+    testrun(crc[0] == crc[2]);
+
+    fprintf(stdout,
+            "crc32 zlib %zu x %zu bytes: bytewise %.0f MB/s, "
+            "slice-by-8 %.0f MB/s, dispatched (%s) %.0f MB/s\n",
+            runs, len, mb_per_sec(bytewise, runs * len),
+            mb_per_sec(slice8, runs * len),
+            engine.clmul ? "pclmul" : "slice-by-8",
+            mb_per_sec(fast, runs * len));
+
+    crc[0] = crc[1] = 0;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; ++i) {
+        crc[0] = crc32_straight_in(crc[0], data, len, engine.straight[0]);
+    }
+    bytewise = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; ++i) {
+        crc[1] = ov_crc32_ogg(crc[1], data, len);
+    }
+    fast = ov_time_get_current_time_usecs() - start;
+
+    testrun(crc[0] == crc[1]);
+
+    fprintf(stdout,
+            "crc32 ogg %zu x %zu bytes: bytewise %.0f MB/s, "
+            "dispatched %.0f MB/s\n",
+            runs, len, mb_per_sec(bytewise, runs * len),
+            mb_per_sec(fast, runs * len));
+
+    free(data);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 OV_TEST_RUN("ov_crc32", test_ov_crc32_sum, test_ov_crc32_posix,
-            test_ov_crc32_ogg, test_ov_crc32_zlib);
+            test_ov_crc32_ogg, test_ov_crc32_zlib, test_ov_crc32_engines,
+            test_ov_crc32_performance);
@@ -0,0 +1,207 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_histogram.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_histogram.h"
+
+#include "../include/ov_json.h"
+
+#include <string.h>
+
+#define SUB_BUCKETS (1 << OV_HISTOGRAM_SUB_BITS)
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_histogram_bucket_index(uint64_t value) {
+
+    if (value < SUB_BUCKETS)
+        return value;
+
+    size_t msb = 63 - __builtin_clzll(value);
+    size_t shift = msb - OV_HISTOGRAM_SUB_BITS;
+
+    size_t index =
+        (shift + 1) * SUB_BUCKETS + ((value >> shift) & (SUB_BUCKETS - 1));
+
+    if (index >= OV_HISTOGRAM_BUCKETS)
+        index = OV_HISTOGRAM_BUCKETS - 1;
+
+    return index;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_histogram_bucket_upper(size_t index) {
+
+    if (index < SUB_BUCKETS)
+        return index;
+
+    if (index >= OV_HISTOGRAM_BUCKETS - 1)
+        return UINT64_MAX;
+
+    size_t shift = index / SUB_BUCKETS - 1;
+    uint64_t lower = (uint64_t)(SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+
+    return lower + ((uint64_t)1 << shift) - 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void ov_histogram_add(ov_histogram *self, uint64_t value) {
+
+    if (!self)
+        return;
+
+    if ((0 == self->count) || (value < self->min))
+        self->min = value;
+
+    if (value > self->max)
+        self->max = value;
+
+    self->count++;
+    self->sum += value;
+    self->bucket[ov_histogram_bucket_index(value)]++;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_histogram_merge(ov_histogram *self, const ov_histogram *other) {
+
+    if (!self || !other)
+        return false;
+
+    if (0 == other->count)
+        return true;
+
+    if ((0 == self->count) || (other->min < self->min))
+        self->min = other->min;
+
+    if (other->max > self->max)
+        self->max = other->max;
+
+    self->count += other->count;
+    self->sum += other->sum;
+
+    for (size_t i = 0; i < OV_HISTOGRAM_BUCKETS; ++i) {
+        self->bucket[i] += other->bucket[i];
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void ov_histogram_reset(ov_histogram *self) {
+
+    if (self)
+        memset(self, 0, sizeof(ov_histogram));
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_histogram_percentile(const ov_histogram *self, double percentile) {
+
+    if (!self || (0 == self->count))
+        return 0;
+
+    if (percentile < 0)
+        percentile = 0;
+
+    if (percentile > 100)
+        percentile = 100;
+
+    uint64_t rank = (uint64_t)(percentile * self->count / 100.0 + 0.5);
+
+    if (rank < 1)
+        rank = 1;
+
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < OV_HISTOGRAM_BUCKETS; ++i) {
+
+        seen += self->bucket[i];
+
+        if (seen < rank)
+            continue;
+
+        uint64_t upper = ov_histogram_bucket_upper(i);
+        return upper < self->max ? upper : self->max;
+    }
+
+    return self->max;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_histogram_to_json(const ov_histogram *self) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+
+    if (!self)
+        goto error;
+
+    out = ov_json_object();
+
+    val = ov_json_number(self->count);
+    if (!ov_json_object_set(out, "count", val))
+        goto error;
+
+    val = ov_json_number(self->min);
+    if (!ov_json_object_set(out, "min", val))
+        goto error;
+
+    val = ov_json_number(self->max);
+    if (!ov_json_object_set(out, "max", val))
+        goto error;
+
+    val = ov_json_number(self->count ? (double)self->sum / self->count : 0);
+    if (!ov_json_object_set(out, "mean", val))
+        goto error;
+
+    val = ov_json_number(ov_histogram_percentile(self, 50));
+    if (!ov_json_object_set(out, "p50", val))
+        goto error;
+
+    val = ov_json_number(ov_histogram_percentile(self, 90));
+    if (!ov_json_object_set(out, "p90", val))
+        goto error;
+
+    val = ov_json_number(ov_histogram_percentile(self, 99));
+    if (!ov_json_object_set(out, "p99", val))
+        goto error;
+
+    val = ov_json_number(ov_histogram_percentile(self, 99.9));
+    if (!ov_json_object_set(out, "p999", val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
@@ -0,0 +1,199 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_histogram_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_histogram.c"
+
+#include "../include/ov_json.h"
+#include <ov_test/testrun.h>
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_histogram_bucket_index() {
+
+    for (uint64_t i = 0; i < 8; ++i) {
+        testrun(i == ov_histogram_bucket_index(i));
+        testrun(i == ov_histogram_bucket_upper(i));
+    }
+
+    testrun(8 == ov_histogram_bucket_index(8));
+    testrun(15 == ov_histogram_bucket_index(15));
+    testrun(16 == ov_histogram_bucket_index(16));
+    testrun(16 == ov_histogram_bucket_index(17));
+    testrun(17 == ov_histogram_bucket_index(18));
+    testrun(17 == ov_histogram_bucket_upper(16));
+    testrun(19 == ov_histogram_bucket_upper(17));
+
+    testrun(OV_HISTOGRAM_BUCKETS - 1 == ov_histogram_bucket_index(UINT64_MAX));
+    testrun(UINT64_MAX == ov_histogram_bucket_upper(OV_HISTOGRAM_BUCKETS - 1));
+
+    /* each value lies within its bucket, error below 12.5 % */
+
+    for (uint64_t value = 1; value < 10000000; value = value * 3 + 1) {
+
+        size_t index = ov_histogram_bucket_index(value);
+        uint64_t upper = ov_histogram_bucket_upper(index);
+
+        testrun(value <= upper);
+        testrun((upper - value) * 8 <= value);
+        testrun((0 == index) || (ov_histogram_bucket_upper(index - 1) < value));
+    }
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_histogram_add() {
+
+    ov_histogram histogram = {0};
+
+    ov_histogram_add(NULL, 1);
+
+    ov_histogram_add(&histogram, 10);
+    ov_histogram_add(&histogram, 5);
+    ov_histogram_add(&histogram, 1000);
+
+    testrun(3 == histogram.count);
+    testrun(1015 == histogram.sum);
+    testrun(5 == histogram.min);
+    testrun(1000 == histogram.max);
+    testrun(1 == histogram.bucket[5]);
+    testrun(1 == histogram.bucket[ov_histogram_bucket_index(1000)]);
+
+    ov_histogram_reset(&histogram);
+    testrun(0 == histogram.count);
+    testrun(0 == histogram.bucket[5]);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_histogram_merge() {
+
+    ov_histogram a = {0};
+    ov_histogram b = {0};
+
+    testrun(!ov_histogram_merge(NULL, &b));
+    testrun(!ov_histogram_merge(&a, NULL));
+
+    ov_histogram_add(&a, 100);
+    testrun(ov_histogram_merge(&a, &b));
+    testrun(1 == a.count);
+    testrun(100 == a.min);
+
+    ov_histogram_add(&b, 3);
+    ov_histogram_add(&b, 300);
+
+    testrun(ov_histogram_merge(&a, &b));
+    testrun(3 == a.count);
+    testrun(403 == a.sum);
+    testrun(3 == a.min);
+    testrun(300 == a.max);
+    testrun(1 == a.bucket[3]);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_histogram_percentile() {
+
+    ov_histogram histogram = {0};
+
+    testrun(0 == ov_histogram_percentile(NULL, 50));
+    testrun(0 == ov_histogram_percentile(&histogram, 50));
+
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        ov_histogram_add(&histogram, i);
+    }
+
+    uint64_t p50 = ov_histogram_percentile(&histogram, 50);
+    uint64_t p99 = ov_histogram_percentile(&histogram, 99);
+
+    testrun((p50 >= 500) && (p50 <= 500 * 1.125));
+    testrun((p99 >= 990) && (p99 <= 1000));
+    testrun(1 == ov_histogram_percentile(&histogram, 0));
+    testrun(1000 == ov_histogram_percentile(&histogram, 100));
+    testrun(1000 == ov_histogram_percentile(&histogram, 200));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_histogram_to_json() {
+
+    ov_histogram histogram = {0};
+
+    testrun(NULL == ov_histogram_to_json(NULL));
+
+    ov_histogram_add(&histogram, 2);
+    ov_histogram_add(&histogram, 4);
+
+    ov_json_value *out = ov_histogram_to_json(&histogram);
+    testrun(out);
+
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/count")));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/min")));
+    testrun(4 == ov_json_number_get(ov_json_get(out, "/max")));
+    testrun(3 == ov_json_number_get(ov_json_get(out, "/mean")));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/p50")));
+    testrun(4 == ov_json_number_get(ov_json_get(out, "/p99")));
+    testrun(ov_json_get(out, "/p90"));
+    testrun(ov_json_get(out, "/p999"));
+
+    out = ov_json_value_free(out);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_histogram_bucket_index);
+    testrun_test(test_ov_histogram_add);
+    testrun_test(test_ov_histogram_merge);
+    testrun_test(test_ov_histogram_percentile);
+    testrun_test(test_ov_histogram_to_json);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
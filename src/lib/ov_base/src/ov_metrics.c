@@ -0,0 +1,645 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_metrics.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_metrics.h"
+
+#include "../include/ov_json.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OV_METRICS_MAGIC_BYTES 0x6d65
+
+#define CACHE_LINE 64
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum { COUNTER = 1, HISTOGRAM = 2 } Type;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    _Atomic uint64_t value;
+
+} CounterShard;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    _Atomic uint64_t count;
+    _Atomic uint64_t sum;
+    _Atomic uint64_t min;
+    _Atomic uint64_t max;
+
+    _Atomic uint64_t bucket[OV_HISTOGRAM_BUCKETS];
+
+} HistogramShard;
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_metrics_series {
+
+    Type type;
+
+    char name[OV_METRICS_NAME_MAX];
+    char loop[OV_METRICS_NAME_MAX];
+
+    /* written by one thread each, allocated on first use */
+    _Atomic(void *) shard[OV_METRICS_THREADS_MAX];
+
+    ov_metrics_series *next;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_metrics {
+
+    uint16_t magic_bytes;
+    ov_metrics_config config;
+
+    /* guards the list of series, not their shards */
+    pthread_mutex_t lock;
+
+    ov_metrics_series *first;
+    ov_metrics_series *last;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static _Atomic size_t g_threads = 0;
+static _Thread_local size_t g_thread_slot = 0;
+
+/*----------------------------------------------------------------------------*/
+
+static size_t thread_slot() {
+
+    if (0 == g_thread_slot) {
+        g_thread_slot =
+            1 + atomic_fetch_add(&g_threads, 1) % OV_METRICS_THREADS_MAX;
+    }
+
+    return g_thread_slot - 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_metrics *ov_metrics_cast(const void *data) {
+
+    if (!data)
+        return NULL;
+
+    if (*(uint16_t *)data != OV_METRICS_MAGIC_BYTES)
+        return NULL;
+
+    return (ov_metrics *)data;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_metrics *ov_metrics_create(ov_metrics_config config) {
+
+    ov_metrics *self = calloc(1, sizeof(ov_metrics));
+    if (!self)
+        goto error;
+
+    config.prefix[OV_METRICS_NAME_MAX - 1] = 0;
+
+    self->magic_bytes = OV_METRICS_MAGIC_BYTES;
+    self->config = config;
+
+    if (0 != pthread_mutex_init(&self->lock, NULL)) {
+        free(self);
+        goto error;
+    }
+
+    return self;
+error:
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_metrics_series *series_free(ov_metrics_series *series) {
+
+    ov_metrics_series *next = series->next;
+
+    for (size_t i = 0; i < OV_METRICS_THREADS_MAX; ++i) {
+        free(atomic_load(&series->shard[i]));
+    }
+
+    free(series);
+    return next;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_metrics *ov_metrics_free(ov_metrics *self) {
+
+    if (!ov_metrics_cast(self))
+        return self;
+
+    ov_metrics_series *series = self->first;
+
+    while (series) {
+        series = series_free(series);
+    }
+
+    pthread_mutex_destroy(&self->lock);
+    free(self);
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_metrics_series *series_get(ov_metrics *self, Type type,
+                                     const char *name, const char *loop) {
+
+    ov_metrics_series *series = NULL;
+
+    if (!ov_metrics_cast(self) || !name || (0 == name[0]))
+        return NULL;
+
+    if (!loop)
+        loop = "";
+
+    if ((strlen(name) >= OV_METRICS_NAME_MAX) ||
+        (strlen(loop) >= OV_METRICS_NAME_MAX)) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&self->lock);
+
+    /* all series of some name are of the same type */
+
+    for (series = self->first; series; series = series->next) {
+
+        if (0 != strcmp(series->name, name))
+            continue;
+
+        if (series->type != type) {
+            series = NULL;
+            goto done;
+        }
+
+        if (0 == strcmp(series->loop, loop))
+            goto done;
+    }
+
+    series = calloc(1, sizeof(ov_metrics_series));
+    if (!series)
+        goto done;
+
+    series->type = type;
+    strcpy(series->name, name);
+    strcpy(series->loop, loop);
+
+    if (self->last) {
+        self->last->next = series;
+    } else {
+        self->first = series;
+    }
+
+    self->last = series;
+
+done:
+    pthread_mutex_unlock(&self->lock);
+    return series;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_metrics_series *ov_metrics_counter(ov_metrics *self, const char *name,
+                                      const char *loop) {
+
+    return series_get(self, COUNTER, name, loop);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_metrics_series *ov_metrics_histogram(ov_metrics *self, const char *name,
+                                        const char *loop) {
+
+    return series_get(self, HISTOGRAM, name, loop);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *thread_shard(ov_metrics_series *series, size_t size) {
+
+    _Atomic(void *) *slot = &series->shard[thread_slot()];
+
+    void *shard = atomic_load_explicit(slot, memory_order_acquire);
+    if (shard)
+        return shard;
+
+    /* first use within this thread */
+
+    size = ((size + CACHE_LINE - 1) / CACHE_LINE) * CACHE_LINE;
+
+    void *created = aligned_alloc(CACHE_LINE, size);
+    if (!created)
+        return NULL;
+
+    memset(created, 0, size);
+
+    if (HISTOGRAM == series->type)
+        ((HistogramShard *)created)->min = UINT64_MAX;
+
+    if (atomic_compare_exchange_strong(slot, &shard, created))
+        return created;
+
+    /* shared slot, created by some other thread */
+    free(created);
+    return shard;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static inline void add_relaxed(_Atomic uint64_t *value, uint64_t increment) {
+
+    /* Shards beyond OV_METRICS_THREADS_MAX threads are shared, so a plain
+     * load and store would lose increments */
+
+    atomic_fetch_add_explicit(value, increment, memory_order_relaxed);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static inline void min_relaxed(_Atomic uint64_t *value, uint64_t candidate) {
+
+    uint64_t current = atomic_load_explicit(value, memory_order_relaxed);
+
+    while ((candidate < current) &&
+           !atomic_compare_exchange_weak_explicit(value, &current, candidate,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed))
+        ;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static inline void max_relaxed(_Atomic uint64_t *value, uint64_t candidate) {
+
+    uint64_t current = atomic_load_explicit(value, memory_order_relaxed);
+
+    while ((candidate > current) &&
+           !atomic_compare_exchange_weak_explicit(value, &current, candidate,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed))
+        ;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void ov_metrics_count(ov_metrics_series *series, uint64_t increment) {
+
+    if (!series || (COUNTER != series->type))
+        return;
+
+    CounterShard *shard = thread_shard(series, sizeof(CounterShard));
+
+    if (shard)
+        add_relaxed(&shard->value, increment);
+}
+
+/*----------------------------------------------------------------------------*/
+
+void ov_metrics_observe(ov_metrics_series *series, uint64_t value) {
+
+    if (!series || (HISTOGRAM != series->type))
+        return;
+
+    HistogramShard *shard = thread_shard(series, sizeof(HistogramShard));
+    if (!shard)
+        return;
+
+    min_relaxed(&shard->min, value);
+    max_relaxed(&shard->max, value);
+
+    add_relaxed(&shard->bucket[ov_histogram_bucket_index(value)], 1);
+    add_relaxed(&shard->sum, value);
+    add_relaxed(&shard->count, 1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_metrics_counter_get(const ov_metrics_series *series) {
+
+    uint64_t value = 0;
+
+    if (!series || (COUNTER != series->type))
+        return 0;
+
+    for (size_t i = 0; i < OV_METRICS_THREADS_MAX; ++i) {
+
+        CounterShard *shard = atomic_load(&series->shard[i]);
+
+        if (shard)
+            value += atomic_load_explicit(&shard->value, memory_order_relaxed);
+    }
+
+    return value;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_metrics_histogram_get(const ov_metrics_series *series,
+                              ov_histogram *out) {
+
+    if (!series || !out || (HISTOGRAM != series->type))
+        return false;
+
+    ov_histogram_reset(out);
+
+    ov_histogram snapshot = {0};
+
+    for (size_t i = 0; i < OV_METRICS_THREADS_MAX; ++i) {
+
+        HistogramShard *shard = atomic_load(&series->shard[i]);
+        if (!shard)
+            continue;
+
+        snapshot.count =
+            atomic_load_explicit(&shard->count, memory_order_relaxed);
+        snapshot.sum = atomic_load_explicit(&shard->sum, memory_order_relaxed);
+        snapshot.min = atomic_load_explicit(&shard->min, memory_order_relaxed);
+        snapshot.max = atomic_load_explicit(&shard->max, memory_order_relaxed);
+
+        for (size_t b = 0; b < OV_HISTOGRAM_BUCKETS; ++b) {
+            snapshot.bucket[b] =
+                atomic_load_explicit(&shard->bucket[b], memory_order_relaxed);
+        }
+
+        ov_histogram_merge(out, &snapshot);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *series_to_json(const ov_metrics_series *series) {
+
+    if (COUNTER == series->type)
+        return ov_json_number(ov_metrics_counter_get(series));
+
+    ov_histogram histogram = {0};
+    ov_metrics_histogram_get(series, &histogram);
+
+    return ov_histogram_to_json(&histogram);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_metrics_to_json(ov_metrics *self) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+
+    if (!ov_metrics_cast(self))
+        goto error;
+
+    out = ov_json_object();
+    if (!out)
+        goto error;
+
+    pthread_mutex_lock(&self->lock);
+
+    for (ov_metrics_series *s = self->first; s; s = s->next) {
+
+        val = series_to_json(s);
+
+        if (0 == s->loop[0]) {
+
+            if (!ov_json_object_set(out, s->name, val))
+                goto unlock;
+
+            continue;
+        }
+
+        ov_json_value *loops = ov_json_object_get(out, s->name);
+
+        if (!ov_json_is_object(loops)) {
+
+            loops = ov_json_object();
+
+            if (!ov_json_object_set(out, s->name, loops)) {
+                loops = ov_json_value_free(loops);
+                goto unlock;
+            }
+        }
+
+        if (!ov_json_object_set(loops, s->loop, val))
+            goto unlock;
+    }
+
+    pthread_mutex_unlock(&self->lock);
+    return out;
+
+unlock:
+    pthread_mutex_unlock(&self->lock);
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void write_name(FILE *stream, const ov_metrics *self, const char *name) {
+
+    if (0 != self->config.prefix[0])
+        fprintf(stream, "%s_", self->config.prefix);
+
+    fprintf(stream, "%s", name);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void write_labels(FILE *stream, const ov_metrics_series *series,
+                         const char *le) {
+
+    if ((0 == series->loop[0]) && !le)
+        return;
+
+    fprintf(stream, "{");
+
+    if (0 != series->loop[0]) {
+
+        fprintf(stream, "loop=\"");
+
+        for (const char *c = series->loop; *c; ++c) {
+
+            switch (*c) {
+
+            case '"':
+            case '\\':
+                fprintf(stream, "\\%c", *c);
+                break;
+
+            case '\n':
+                fprintf(stream, "\\n");
+                break;
+
+            default:
+                fputc(*c, stream);
+            }
+        }
+
+        fprintf(stream, "\"%s", le ? "," : "");
+    }
+
+    if (le)
+        fprintf(stream, "le=\"%s\"", le);
+
+    fprintf(stream, "}");
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void write_counter(FILE *stream, const ov_metrics *self,
+                          const ov_metrics_series *series) {
+
+    write_name(stream, self, series->name);
+    fprintf(stream, "_total");
+    write_labels(stream, series, NULL);
+    fprintf(stream, " %" PRIu64 "\n", ov_metrics_counter_get(series));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void write_histogram(FILE *stream, const ov_metrics *self,
+                            const ov_metrics_series *series) {
+
+    char le[32] = {0};
+    uint64_t cumulative = 0;
+
+    ov_histogram histogram = {0};
+    ov_metrics_histogram_get(series, &histogram);
+
+    /* empty buckets are omitted */
+
+    for (size_t i = 0; i < OV_HISTOGRAM_BUCKETS - 1; ++i) {
+
+        if (0 == histogram.bucket[i])
+            continue;
+
+        cumulative += histogram.bucket[i];
+
+        snprintf(le, sizeof(le), "%" PRIu64, ov_histogram_bucket_upper(i));
+
+        write_name(stream, self, series->name);
+        fprintf(stream, "_bucket");
+        write_labels(stream, series, le);
+        fprintf(stream, " %" PRIu64 "\n", cumulative);
+    }
+
+    write_name(stream, self, series->name);
+    fprintf(stream, "_bucket");
+    write_labels(stream, series, "+Inf");
+    fprintf(stream, " %" PRIu64 "\n", histogram.count);
+
+    write_name(stream, self, series->name);
+    fprintf(stream, "_count");
+    write_labels(stream, series, NULL);
+    fprintf(stream, " %" PRIu64 "\n", histogram.count);
+
+    write_name(stream, self, series->name);
+    fprintf(stream, "_sum");
+    write_labels(stream, series, NULL);
+    fprintf(stream, " %" PRIu64 "\n", histogram.sum);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool name_written(const ov_metrics *self,
+                         const ov_metrics_series *series) {
+
+    for (ov_metrics_series *s = self->first; s != series; s = s->next) {
+
+        if (0 == strcmp(s->name, series->name))
+            return true;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+char *ov_metrics_to_openmetrics(ov_metrics *self) {
+
+    char *text = NULL;
+    size_t length = 0;
+
+    if (!ov_metrics_cast(self))
+        return NULL;
+
+    FILE *stream = open_memstream(&text, &length);
+    if (!stream)
+        return NULL;
+
+    pthread_mutex_lock(&self->lock);
+
+    /* samples of some metric family MUST be contiguous */
+
+    for (ov_metrics_series *s = self->first; s; s = s->next) {
+
+        if (name_written(self, s))
+            continue;
+
+        fprintf(stream, "# TYPE ");
+        write_name(stream, self, s->name);
+        fprintf(stream, " %s\n", COUNTER == s->type ? "counter" : "histogram");
+
+        for (ov_metrics_series *t = s; t; t = t->next) {
+
+            if (0 != strcmp(t->name, s->name))
+                continue;
+
+            if (COUNTER == t->type) {
+                write_counter(stream, self, t);
+            } else {
+                write_histogram(stream, self, t);
+            }
+        }
+    }
+
+    pthread_mutex_unlock(&self->lock);
+
+    fprintf(stream, "# EOF\n");
+    fclose(stream);
+
+    return text;
+}
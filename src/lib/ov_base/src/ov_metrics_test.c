@@ -0,0 +1,371 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_metrics_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_metrics.c"
+
+#include "../include/ov_time.h"
+#include <ov_test/testrun.h>
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_create() {
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+    testrun(ov_metrics_cast(metrics));
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_free() {
+
+    testrun(NULL == ov_metrics_free(NULL));
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    ov_metrics_count(ov_metrics_counter(metrics, "a", NULL), 1);
+    ov_metrics_observe(ov_metrics_histogram(metrics, "b", "loop"), 1);
+
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_counter() {
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    testrun(NULL == ov_metrics_counter(NULL, "frames", NULL));
+    testrun(NULL == ov_metrics_counter(metrics, NULL, NULL));
+    testrun(NULL == ov_metrics_counter(metrics, "", NULL));
+
+    ov_metrics_series *a = ov_metrics_counter(metrics, "frames", "loop1");
+    ov_metrics_series *b = ov_metrics_counter(metrics, "frames", "loop2");
+    ov_metrics_series *c = ov_metrics_counter(metrics, "frames", NULL);
+
+    testrun(a);
+    testrun(b);
+    testrun(c);
+    testrun(a != b);
+    testrun(a == ov_metrics_counter(metrics, "frames", "loop1"));
+    testrun(c == ov_metrics_counter(metrics, "frames", ""));
+
+    /* type of some name is fixed */
+
+    testrun(NULL == ov_metrics_histogram(metrics, "frames", "loop1"));
+    testrun(NULL == ov_metrics_histogram(metrics, "frames", "loop3"));
+
+    ov_metrics_count(NULL, 1);
+    ov_metrics_count(a, 3);
+    ov_metrics_count(a, 2);
+    ov_metrics_count(b, 1);
+
+    /* ignored for counters */
+    ov_metrics_observe(a, 100);
+
+    testrun(5 == ov_metrics_counter_get(a));
+    testrun(1 == ov_metrics_counter_get(b));
+    testrun(0 == ov_metrics_counter_get(c));
+    testrun(0 == ov_metrics_counter_get(NULL));
+
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_histogram() {
+
+    ov_histogram out = {0};
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    ov_metrics_series *h = ov_metrics_histogram(metrics, "mix_usec", NULL);
+    testrun(h);
+    testrun(h == ov_metrics_histogram(metrics, "mix_usec", NULL));
+    testrun(NULL == ov_metrics_counter(metrics, "mix_usec", NULL));
+
+    testrun(!ov_metrics_histogram_get(NULL, &out));
+    testrun(!ov_metrics_histogram_get(h, NULL));
+
+    testrun(ov_metrics_histogram_get(h, &out));
+    testrun(0 == out.count);
+
+    ov_metrics_observe(NULL, 1);
+    ov_metrics_observe(h, 20);
+    ov_metrics_observe(h, 10);
+    ov_metrics_observe(h, 30);
+
+    /* ignored for histograms */
+    ov_metrics_count(h, 1);
+
+    testrun(ov_metrics_histogram_get(h, &out));
+    testrun(3 == out.count);
+    testrun(60 == out.sum);
+    testrun(10 == out.min);
+    testrun(30 == out.max);
+    testrun(1 == out.bucket[ov_histogram_bucket_index(10)]);
+
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_metrics_series *thread_counter = NULL;
+static ov_metrics_series *thread_histogram = NULL;
+
+static void *count_thread(void *arg) {
+
+    UNUSED(arg);
+
+    for (size_t i = 0; i < 100000; ++i) {
+        ov_metrics_count(thread_counter, 1);
+        ov_metrics_observe(thread_histogram, i);
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_threads() {
+
+    pthread_t threads[4];
+    ov_histogram out = {0};
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    thread_counter = ov_metrics_counter(metrics, "packets", "loop1");
+    thread_histogram = ov_metrics_histogram(metrics, "values", NULL);
+
+    for (size_t i = 0; i < 4; ++i) {
+        testrun(0 == pthread_create(&threads[i], NULL, count_thread, NULL));
+    }
+
+    for (size_t i = 0; i < 4; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    /* no update lost */
+
+    testrun(400000 == ov_metrics_counter_get(thread_counter));
+    testrun(ov_metrics_histogram_get(thread_histogram, &out));
+    testrun(400000 == out.count);
+    testrun(0 == out.min);
+    testrun(99999 == out.max);
+
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_shared_shards() {
+
+    /* more threads than shards, some shards are written concurrently */
+
+    const size_t num_threads = OV_METRICS_THREADS_MAX + 8;
+
+    pthread_t threads[OV_METRICS_THREADS_MAX + 8];
+    ov_histogram out = {0};
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    thread_counter = ov_metrics_counter(metrics, "packets", "loop1");
+    thread_histogram = ov_metrics_histogram(metrics, "values", NULL);
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        testrun(0 == pthread_create(&threads[i], NULL, count_thread, NULL));
+    }
+
+    for (size_t i = 0; i < num_threads; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+
+    testrun(num_threads * 100000 == ov_metrics_counter_get(thread_counter));
+    testrun(ov_metrics_histogram_get(thread_histogram, &out));
+    testrun(num_threads * 100000 == out.count);
+    testrun(0 == out.min);
+    testrun(99999 == out.max);
+
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_to_json() {
+
+    testrun(NULL == ov_metrics_to_json(NULL));
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    ov_metrics_count(ov_metrics_counter(metrics, "frames", "loop1"), 3);
+    ov_metrics_count(ov_metrics_counter(metrics, "frames", "loop2"), 2);
+    ov_metrics_count(ov_metrics_counter(metrics, "late", NULL), 1);
+    ov_metrics_observe(ov_metrics_histogram(metrics, "mix", NULL), 7);
+
+    ov_json_value *out = ov_metrics_to_json(metrics);
+    testrun(out);
+
+    testrun(3 == ov_json_number_get(ov_json_get(out, "/frames/loop1")));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/frames/loop2")));
+    testrun(1 == ov_json_number_get(ov_json_get(out, "/late")));
+    testrun(1 == ov_json_number_get(ov_json_get(out, "/mix/count")));
+    testrun(7 == ov_json_number_get(ov_json_get(out, "/mix/max")));
+
+    out = ov_json_value_free(out);
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_metrics_to_openmetrics() {
+
+    testrun(NULL == ov_metrics_to_openmetrics(NULL));
+
+    ov_metrics *metrics =
+        ov_metrics_create((ov_metrics_config){.prefix = "openvocs_test"});
+    testrun(metrics);
+
+    char *text = ov_metrics_to_openmetrics(metrics);
+    testrun(0 == strcmp("# EOF\n", text));
+    text = ov_data_pointer_free(text);
+
+    ov_metrics_count(ov_metrics_counter(metrics, "frames", "loop1"), 3);
+    ov_metrics_observe(ov_metrics_histogram(metrics, "mix_usec", NULL), 2);
+    ov_metrics_observe(ov_metrics_histogram(metrics, "mix_usec", NULL), 20);
+    ov_metrics_count(ov_metrics_counter(metrics, "frames", "lo\"op"), 1);
+
+    text = ov_metrics_to_openmetrics(metrics);
+    testrun(text);
+
+    const char *expect =
+        "# TYPE openvocs_test_frames counter\n"
+        "openvocs_test_frames_total{loop=\"loop1\"} 3\n"
+        "openvocs_test_frames_total{loop=\"lo\\\"op\"} 1\n"
+        "# TYPE openvocs_test_mix_usec histogram\n"
+        "openvocs_test_mix_usec_bucket{le=\"2\"} 1\n"
+        "openvocs_test_mix_usec_bucket{le=\"21\"} 2\n"
+        "openvocs_test_mix_usec_bucket{le=\"+Inf\"} 2\n"
+        "openvocs_test_mix_usec_count 2\n"
+        "openvocs_test_mix_usec_sum 22\n"
+        "# EOF\n";
+
+    testrun(0 == strcmp(expect, text));
+    text = ov_data_pointer_free(text);
+
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_metrics_performance() {
+
+    const size_t runs = 10000000;
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+    testrun(metrics);
+
+    ov_metrics_series *counter = ov_metrics_counter(metrics, "c", "loop");
+    ov_metrics_series *histogram = ov_metrics_histogram(metrics, "h", "loop");
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_metrics_count(counter, 1);
+    }
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout, "metrics count: %.1f ns/op\n", 1000.0 * usec / runs);
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_metrics_observe(histogram, i & 0xffff);
+    }
+
+    usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout, "metrics observe: %.1f ns/op\n", 1000.0 * usec / runs);
+
+    testrun(runs == ov_metrics_counter_get(counter));
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_metrics_create);
+    testrun_test(test_ov_metrics_free);
+    testrun_test(test_ov_metrics_counter);
+    testrun_test(test_ov_metrics_histogram);
+    testrun_test(test_ov_metrics_threads);
+    testrun_test(test_ov_metrics_shared_shards);
+    testrun_test(test_ov_metrics_to_json);
+    testrun_test(test_ov_metrics_to_openmetrics);
+    testrun_test(check_metrics_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
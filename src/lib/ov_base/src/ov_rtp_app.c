@@ -26,6 +26,7 @@
 */
 
 #include "../include/ov_rtp_app.h"
+#include "../include/ov_loop_bus.h"
 #include "../include/ov_mc_socket.h"
 #include "../include/ov_string.h"
 #include <netdb.h>
@@ -56,6 +57,8 @@ struct ov_rtp_app {
         void *userdata;
 
     } rtp;
+
+    ov_loop_bus *bus;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -73,6 +76,26 @@ static ov_rtp_app const *as_rtp_app(void const *ptr) {
 
 /*----------------------------------------------------------------------------*/
 
+static void dispatch_rtp(struct fd_handler_struct *data,
+                         uint8_t const *buffer, size_t length) {
+
+    ov_rtp_frame *frame = ov_rtp_frame_decode(buffer, length);
+
+    ov_log_debug("Received RTP frame");
+
+    if (ov_ptr_valid(frame, "Could not decode RTP frame") &&
+        (0 != data->handler)) {
+
+        data->handler(frame, data->userdata);
+
+    } else {
+
+        frame = ov_rtp_frame_free(frame);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool cb_rtp_io(int fd, uint8_t events, void *userdata) {
 
     UNUSED(events);
@@ -95,21 +118,20 @@ static bool cb_rtp_io(int fd, uint8_t events, void *userdata) {
 
     } else {
 
-        ov_rtp_frame *frame = ov_rtp_frame_decode(buffer, (size_t)in);
-
-        ov_log_debug("Received RTP frame");
-
-        if (ov_ptr_valid(frame, "Could not decode RTP frame") &&
-            (0 != data->handler)) {
+        dispatch_rtp(data, buffer, (size_t)in);
+        return true;
+    }
+}
 
-            data->handler(frame, data->userdata);
+/*----------------------------------------------------------------------------*/
 
-        } else {
+static void cb_loop_bus_io(void *userdata, const uint8_t *buffer,
+                           size_t bytes) {
 
-            frame = ov_rtp_frame_free(frame);
-        }
+    struct fd_handler_struct *data = userdata;
 
-        return true;
+    if (ov_ptr_valid(data, "Cannot process incoming RTP data")) {
+        dispatch_rtp(data, buffer, bytes);
     }
 }
 
@@ -314,6 +336,24 @@ or_default_rtp_socket(ov_socket_configuration cfg, bool set_default_port) {
 
 /*----------------------------------------------------------------------------*/
 
+static bool subscribe_loop_bus(ov_rtp_app *self) {
+
+    ov_loop_bus_config config = {
+        .loop = self->loop,
+        .callback.userdata = &self->rtp,
+        .callback.io = cb_loop_bus_io,
+    };
+
+    if (ov_loop_bus_name(self->rtp_socket, config.name,
+                         sizeof(config.name))) {
+        self->bus = ov_loop_bus_create(config);
+    }
+
+    return ov_ptr_valid(self->bus, "Could not subscribe to loop bus");
+}
+
+/*----------------------------------------------------------------------------*/
+
 ov_rtp_app *ov_rtp_app_create(ov_event_loop *loop, ov_rtp_app_config cfg) {
 
     ov_rtp_app *self = calloc(1, sizeof(ov_rtp_app));
@@ -331,7 +371,9 @@ ov_rtp_app *ov_rtp_app_create(ov_event_loop *loop, ov_rtp_app_config cfg) {
     if (ov_ptr_valid(cfg.rtp_handler, "No RTP handler") &&
         create_media_socket(&self->rtp_socket, cfg.multicast, fds, false) &&
         set_handler_fd(&self->rtp, fds[0]) &&
-        install_handler(loop, &self->rtp, cb_rtp_io)) {
+        install_handler(loop, &self->rtp, cb_rtp_io) &&
+        ((!cfg.multicast) || (!cfg.loop_bus) ||
+         subscribe_loop_bus(self))) {
 
         return self;
 
@@ -347,6 +389,7 @@ ov_rtp_app *ov_rtp_app_free(ov_rtp_app *self) {
 
     if (0 != as_rtp_app(self)) {
 
+        self->bus = ov_loop_bus_free(self->bus);
         uninstall_handler(self->loop, &self->rtp);
         close_socket(self->rtp.fd, self->multicast);
         return ov_free(self);
@@ -397,7 +440,7 @@ bool ov_rtp_app_send_to_sockaddr(int sd_to_send_from, ov_rtp_frame const *frame,
 
         ssize_t bytes =
             sendto(sd_to_send_from, frame->bytes.data, frame->bytes.length, 0,
-                   (struct sockaddr *)&dest, dest_len);
+                   dest, dest_len);
 
         if ((0 > bytes) || (frame->bytes.length != (size_t)bytes)) {
 
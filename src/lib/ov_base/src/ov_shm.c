@@ -0,0 +1,120 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_shm.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_shm.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <ov_log/ov_log.h>
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_shm_map(const char *name, size_t size) {
+
+    void *memory = NULL;
+
+    if (!name || (0 == size))
+        return NULL;
+
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+
+    if (-1 == fd) {
+        ov_log_error("failed to open shared memory %s", name);
+        goto error;
+    }
+
+    struct stat st = {0};
+
+    if (0 != fstat(fd, &st))
+        goto error;
+
+    if ((0 == st.st_size) && (0 != ftruncate(fd, size)))
+        goto error;
+
+    if ((0 != st.st_size) && ((size_t)st.st_size != size)) {
+
+        ov_log_error("shared memory %s of different size %zu", name,
+                     (size_t)st.st_size);
+        goto error;
+    }
+
+    memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == memory)
+        memory = NULL;
+
+error:
+    if (-1 != fd)
+        close(fd);
+
+    return memory;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_shm_unmap(void *memory, size_t size) {
+
+    if (memory)
+        munmap(memory, size);
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_shm_header_init(ov_shm_header *header, uint32_t magic,
+                        uint32_t slots, uint32_t slot_size) {
+
+    uint32_t expected = 0;
+
+    if (!header || (0 == magic))
+        return false;
+
+    if (0 != atomic_load(&header->magic))
+        goto check;
+
+    /* all processes of some layout initialize the same values */
+
+    header->slots = slots;
+    header->slot_size = slot_size;
+
+    atomic_compare_exchange_strong(&header->magic, &expected, magic);
+
+check:
+
+    if ((magic != atomic_load(&header->magic)) || (slots != header->slots) ||
+        (slot_size != header->slot_size)) {
+
+        ov_log_error("incompatible shared memory layout");
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,126 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_shm_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_shm.c"
+
+#include <ov_test/testrun.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------------------*/
+
+static void shm_test_name(char *out, size_t size, const char *suffix) {
+
+    snprintf(out, size, "/ov_shm_test_%i_%s", getpid(), suffix);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_shm_map() {
+
+    char name[64] = {0};
+    shm_test_name(name, sizeof(name), "map");
+
+    testrun(NULL == ov_shm_map(NULL, 4096));
+    testrun(NULL == ov_shm_map(name, 0));
+
+    uint8_t *a = ov_shm_map(name, 4096);
+    testrun(a);
+
+    /* created zeroed */
+    testrun(0 == a[0]);
+    testrun(0 == a[4095]);
+
+    uint8_t *b = ov_shm_map(name, 4096);
+    testrun(b);
+    testrun(a != b);
+
+    a[17] = 42;
+    testrun(42 == b[17]);
+
+    /* exists with other size */
+    testrun(NULL == ov_shm_map(name, 8192));
+
+    testrun(NULL == ov_shm_unmap(a, 4096));
+    testrun(NULL == ov_shm_unmap(b, 4096));
+    testrun(NULL == ov_shm_unmap(NULL, 4096));
+
+    testrun(0 == shm_unlink(name));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_shm_header_init() {
+
+    ov_shm_header header = {0};
+
+    testrun(!ov_shm_header_init(NULL, 1, 2, 3));
+    testrun(!ov_shm_header_init(&header, 0, 2, 3));
+
+    testrun(ov_shm_header_init(&header, 1, 2, 3));
+    testrun(1 == header.magic);
+    testrun(2 == header.slots);
+    testrun(3 == header.slot_size);
+
+    /* initialized already */
+    testrun(ov_shm_header_init(&header, 1, 2, 3));
+
+    /* other layouts */
+    testrun(!ov_shm_header_init(&header, 2, 2, 3));
+    testrun(!ov_shm_header_init(&header, 1, 4, 3));
+    testrun(!ov_shm_header_init(&header, 1, 2, 4));
+
+    testrun(1 == header.magic);
+    testrun(2 == header.slots);
+    testrun(3 == header.slot_size);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_shm_map);
+    testrun_test(test_ov_shm_header_init);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
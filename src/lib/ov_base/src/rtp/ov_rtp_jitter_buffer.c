@@ -0,0 +1,641 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_jitter_buffer.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_rtp_jitter_buffer.h"
+
+#include "../../include/ov_data_function.h"
+#include "../../include/ov_dict.h"
+#include "../../include/ov_json.h"
+#include "../../include/ov_rtp_source_stats.h"
+#include "../../include/ov_utils.h"
+
+#define OV_RTP_JITTER_BUFFER_MAGIC_BYTES 0x7b1f
+
+#define CAPACITY_MIN 4
+#define CAPACITY_MAX 32768 // half of the sequence number space
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Stream Stream;
+
+struct Stream {
+
+    Stream *prev;
+    Stream *next;
+
+    uint32_t ssrc;
+
+    /* next_seq is fixed, once the first slot was played out */
+    bool fixed;
+    bool playing;
+
+    uint16_t next_seq;
+    uint16_t top_seq;
+
+    struct {
+
+        uint32_t last;
+        uint32_t step;
+
+    } timestamp;
+
+    ov_rtp_source_stats source;
+
+    ov_rtp_jitter_buffer_stats stats;
+
+    ov_rtp_frame **slots;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_rtp_jitter_buffer {
+
+    uint16_t magic_bytes;
+    ov_rtp_jitter_buffer_config config;
+
+    size_t mask;
+
+    ov_dict *streams;
+    Stream *list;
+    size_t count;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_jitter_buffer *as_jitter_buffer(const void *data) {
+
+    if (!data)
+        return NULL;
+
+    if (*(uint16_t *)data != OV_RTP_JITTER_BUFFER_MAGIC_BYTES)
+        return NULL;
+
+    return (ov_rtp_jitter_buffer *)data;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #STREAM FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static ov_rtp_frame *slot_get(const ov_rtp_jitter_buffer *self,
+                              const Stream *stream, uint16_t seq) {
+
+    ov_rtp_frame *frame = stream->slots[seq & self->mask];
+
+    if (frame && (frame->expanded.sequence_number == seq))
+        return frame;
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_frame *slot_take(ov_rtp_jitter_buffer *self, Stream *stream,
+                               uint16_t seq) {
+
+    ov_rtp_frame *frame = slot_get(self, stream, seq);
+
+    if (frame) {
+        stream->slots[seq & self->mask] = NULL;
+        stream->stats.buffered_frames--;
+    }
+
+    return frame;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t stream_span(const Stream *stream) {
+
+    if (0 == stream->stats.buffered_frames)
+        return 0;
+
+    return (uint16_t)(stream->top_seq - stream->next_seq) + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void stream_flush(ov_rtp_jitter_buffer *self, Stream *stream) {
+
+    for (size_t i = 0; i <= self->mask; i++) {
+
+        if (!stream->slots[i])
+            continue;
+
+        stream->slots[i] = ov_rtp_frame_free(stream->slots[i]);
+        stream->stats.dropped++;
+    }
+
+    stream->stats.buffered_frames = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *stream_free(void *data) {
+
+    Stream *stream = (Stream *)data;
+    if (!stream)
+        return NULL;
+
+    if (stream->slots) {
+
+        /* capacity is not known here, slots are flushed before */
+        free(stream->slots);
+    }
+
+    free(stream);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Stream *stream_create(ov_rtp_jitter_buffer *self, uint32_t ssrc) {
+
+    Stream *stream = calloc(1, sizeof(Stream));
+    if (!stream)
+        goto error;
+
+    stream->ssrc = ssrc;
+    stream->slots = calloc(self->mask + 1, sizeof(ov_rtp_frame *));
+    if (!stream->slots)
+        goto error;
+
+    stream->timestamp.step = (uint32_t)((uint64_t)self->config.clock_rate_hz *
+                                        self->config.frame_length_usec /
+                                        1000000);
+
+    stream->source.clock_rate_hz = self->config.clock_rate_hz;
+    stream->stats.target_frames = self->config.delay.min_frames;
+
+    intptr_t key = ssrc;
+    if (!ov_dict_set(self->streams, (void *)key, stream, NULL))
+        goto error;
+
+    stream->next = self->list;
+    if (self->list)
+        self->list->prev = stream;
+
+    self->list = stream;
+    self->count++;
+
+    return stream;
+error:
+    stream_free(stream);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void stream_remove(ov_rtp_jitter_buffer *self, Stream *stream) {
+
+    stream_flush(self, stream);
+
+    if (stream->prev) {
+        stream->prev->next = stream->next;
+    } else {
+        self->list = stream->next;
+    }
+
+    if (stream->next)
+        stream->next->prev = stream->prev;
+
+    self->count--;
+
+    intptr_t key = stream->ssrc;
+    ov_dict_del(self->streams, (void *)key);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void stream_update_jitter(ov_rtp_jitter_buffer *self, Stream *stream,
+                                 const ov_rtp_frame *frame, uint64_t now_usec) {
+
+    ov_rtp_source_stats_update(&stream->source,
+                               frame->expanded.sequence_number,
+                               frame->expanded.timestamp, now_usec);
+
+    stream->stats.jitter_usec =
+        (uint64_t)ov_rtp_source_stats_jitter_usecs(&stream->source);
+
+    /* target delay of 3 times the jitter on top of one frame */
+
+    uint64_t frame_usec = self->config.frame_length_usec;
+    uint64_t target =
+        1 + (3 * stream->stats.jitter_usec + frame_usec - 1) / frame_usec;
+
+    if (target < self->config.delay.min_frames)
+        target = self->config.delay.min_frames;
+
+    if (target > self->config.delay.max_frames)
+        target = self->config.delay.max_frames;
+
+    stream->stats.target_frames = (uint32_t)target;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void stream_drop_oldest(ov_rtp_jitter_buffer *self, Stream *stream) {
+
+    ov_rtp_frame *frame = slot_take(self, stream, stream->next_seq);
+
+    if (frame) {
+        frame = ov_rtp_frame_free(frame);
+        stream->stats.dropped++;
+    }
+
+    stream->next_seq++;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_frame *stream_add(ov_rtp_jitter_buffer *self, Stream *stream,
+                                ov_rtp_frame *frame) {
+
+    uint16_t seq = frame->expanded.sequence_number;
+
+    if ((0 == stream->stats.buffered_frames) && !stream->playing) {
+
+        /* (re)start buffering, e.g. at the begin of some talk spurt */
+
+        if (!stream->fixed || ((int16_t)(seq - stream->next_seq) >= 0)) {
+            stream->next_seq = seq;
+            stream->top_seq = seq;
+        }
+    }
+
+    int32_t diff = (int16_t)(seq - stream->next_seq);
+
+    if (diff < 0) {
+
+        uint32_t span = stream_span(stream) - diff;
+
+        if (stream->fixed || (span > self->config.delay.max_frames)) {
+            stream->stats.late++;
+            return frame;
+        }
+
+        /* reordered before the first playout */
+        stream->next_seq = seq;
+        diff = 0;
+    }
+
+    if ((size_t)diff > self->mask) {
+
+        /* jump of the sequence number, restart the stream */
+
+        stream_flush(self, stream);
+        stream->playing = false;
+        stream->next_seq = seq;
+        stream->top_seq = seq;
+    }
+
+    if (slot_get(self, stream, seq)) {
+        stream->stats.duplicates++;
+        return frame;
+    }
+
+    stream->slots[seq & self->mask] = frame;
+    stream->stats.buffered_frames++;
+
+    if ((int16_t)(seq - stream->top_seq) > 0)
+        stream->top_seq = seq;
+
+    /* bound the delay */
+
+    while (stream_span(stream) > self->config.delay.max_frames) {
+        stream_drop_oldest(self, stream);
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool stream_playout(ov_rtp_jitter_buffer *self, Stream *stream,
+                           void *userdata,
+                           bool (*callback)(void *userdata,
+                                            ov_rtp_jitter_buffer_slot *slot)) {
+
+    if (!stream->playing) {
+
+        if (stream_span(stream) < stream->stats.target_frames)
+            return false;
+
+        stream->playing = true;
+
+        if (!stream->fixed) {
+
+            ov_rtp_frame *first = slot_get(self, stream, stream->next_seq);
+            if (first)
+                stream->timestamp.last =
+                    first->expanded.timestamp - stream->timestamp.step;
+        }
+
+        stream->fixed = true;
+    }
+
+    if (0 == stream->stats.buffered_frames) {
+
+        stream->stats.underruns++;
+        stream->playing = false;
+        return false;
+    }
+
+    uint16_t seq = stream->next_seq++;
+
+    ov_rtp_jitter_buffer_slot slot = (ov_rtp_jitter_buffer_slot){
+        .ssrc = stream->ssrc,
+        .sequence_number = seq,
+        .timestamp = stream->timestamp.last + stream->timestamp.step,
+        .frame = slot_take(self, stream, seq),
+    };
+
+    if (slot.frame) {
+
+        slot.timestamp = slot.frame->expanded.timestamp;
+        stream->stats.played++;
+
+    } else {
+
+        slot.next = slot_get(self, stream, stream->next_seq);
+        stream->stats.lost++;
+    }
+
+    stream->timestamp.last = slot.timestamp;
+
+    bool lost = (NULL == slot.frame);
+
+    if (!callback) {
+        slot.frame = ov_rtp_frame_free(slot.frame);
+    } else if (callback(userdata, &slot) && lost) {
+        stream->stats.concealed++;
+    }
+
+    return true;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #PUBLIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_rtp_jitter_buffer *
+ov_rtp_jitter_buffer_create(ov_rtp_jitter_buffer_config config) {
+
+    ov_rtp_jitter_buffer *self = NULL;
+
+    if (0 == config.clock_rate_hz)
+        config.clock_rate_hz = OV_RTP_JITTER_BUFFER_CLOCK_RATE_DEFAULT;
+
+    if (0 == config.frame_length_usec)
+        config.frame_length_usec = OV_RTP_JITTER_BUFFER_FRAME_USEC_DEFAULT;
+
+    if (0 == config.delay.min_frames)
+        config.delay.min_frames = OV_RTP_JITTER_BUFFER_MIN_FRAMES_DEFAULT;
+
+    if (0 == config.delay.max_frames)
+        config.delay.max_frames = OV_RTP_JITTER_BUFFER_MAX_FRAMES_DEFAULT;
+
+    if (0 == config.capacity)
+        config.capacity = OV_RTP_JITTER_BUFFER_CAPACITY_DEFAULT;
+
+    if (0 == config.stream_timeout_usec)
+        config.stream_timeout_usec = OV_RTP_JITTER_BUFFER_TIMEOUT_USEC_DEFAULT;
+
+    if (config.delay.max_frames < config.delay.min_frames)
+        config.delay.max_frames = config.delay.min_frames;
+
+    size_t capacity = CAPACITY_MIN;
+
+    while ((capacity < config.capacity) && (capacity < CAPACITY_MAX)) {
+        capacity <<= 1;
+    }
+
+    if (config.delay.max_frames >= capacity)
+        config.delay.max_frames = capacity - 1;
+
+    if (config.delay.min_frames > config.delay.max_frames)
+        config.delay.min_frames = config.delay.max_frames;
+
+    config.capacity = capacity;
+
+    self = calloc(1, sizeof(ov_rtp_jitter_buffer));
+    if (!self)
+        goto error;
+
+    self->magic_bytes = OV_RTP_JITTER_BUFFER_MAGIC_BYTES;
+    self->config = config;
+    self->mask = capacity - 1;
+
+    ov_dict_config d_config = ov_dict_intptr_key_config(255);
+    d_config.value.data_function.free = stream_free;
+
+    self->streams = ov_dict_create(d_config);
+    if (!self->streams)
+        goto error;
+
+    return self;
+error:
+    ov_rtp_jitter_buffer_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_rtp_jitter_buffer *ov_rtp_jitter_buffer_free(ov_rtp_jitter_buffer *self) {
+
+    if (!as_jitter_buffer(self))
+        return self;
+
+    while (self->list) {
+        stream_remove(self, self->list);
+    }
+
+    self->streams = ov_dict_free(self->streams);
+    free(self);
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_rtp_frame *ov_rtp_jitter_buffer_add(ov_rtp_jitter_buffer *self,
+                                       ov_rtp_frame *frame, uint64_t now_usec) {
+
+    if (!as_jitter_buffer(self) || !frame)
+        return frame;
+
+    intptr_t key = frame->expanded.ssrc;
+
+    Stream *stream = ov_dict_get(self->streams, (void *)key);
+
+    if (!stream)
+        stream = stream_create(self, frame->expanded.ssrc);
+
+    if (!stream)
+        return frame;
+
+    stream->stats.received++;
+    stream_update_jitter(self, stream, frame, now_usec);
+
+    return stream_add(self, stream, frame);
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_rtp_jitter_buffer_playout(
+    ov_rtp_jitter_buffer *self, uint64_t now_usec, void *userdata,
+    bool (*callback)(void *userdata, ov_rtp_jitter_buffer_slot *slot)) {
+
+    size_t played = 0;
+
+    if (!as_jitter_buffer(self))
+        return 0;
+
+    Stream *stream = self->list;
+
+    while (stream) {
+
+        Stream *next = stream->next;
+
+        if (now_usec >
+            stream->source.last_usecs + self->config.stream_timeout_usec) {
+
+            stream_remove(self, stream);
+
+        } else if (stream_playout(self, stream, userdata, callback)) {
+
+            played++;
+        }
+
+        stream = next;
+    }
+
+    return played;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_rtp_jitter_buffer_count_streams(const ov_rtp_jitter_buffer *self) {
+
+    if (!as_jitter_buffer(self))
+        return 0;
+
+    return self->count;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_jitter_buffer_get_stats(const ov_rtp_jitter_buffer *self,
+                                    uint32_t ssrc,
+                                    ov_rtp_jitter_buffer_stats *stats) {
+
+    if (!as_jitter_buffer(self) || !stats)
+        return false;
+
+    intptr_t key = ssrc;
+
+    Stream *stream = ov_dict_get(self->streams, (void *)key);
+    if (!stream)
+        return false;
+
+    *stats = stream->stats;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool set_number(ov_json_value *object, const char *key, double value) {
+
+    ov_json_value *number = ov_json_number(value);
+
+    if (ov_json_object_set(object, key, number))
+        return true;
+
+    ov_json_value_free(number);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *stats_to_json(const ov_rtp_jitter_buffer_stats *stats) {
+
+    ov_json_value *out = ov_json_object();
+
+    if (!set_number(out, "received", stats->received) ||
+        !set_number(out, "played", stats->played) ||
+        !set_number(out, "late", stats->late) ||
+        !set_number(out, "lost", stats->lost) ||
+        !set_number(out, "concealed", stats->concealed) ||
+        !set_number(out, "duplicates", stats->duplicates) ||
+        !set_number(out, "dropped", stats->dropped) ||
+        !set_number(out, "underruns", stats->underruns) ||
+        !set_number(out, "jitter_usec", stats->jitter_usec) ||
+        !set_number(out, "target_frames", stats->target_frames) ||
+        !set_number(out, "buffered_frames", stats->buffered_frames))
+        goto error;
+
+    return out;
+error:
+    return ov_json_value_free(out);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_rtp_jitter_buffer_stats_to_json(ov_rtp_jitter_buffer *self) {
+
+    char key[20] = {0};
+
+    if (!as_jitter_buffer(self))
+        return NULL;
+
+    ov_json_value *out = ov_json_object();
+
+    for (Stream *stream = self->list; stream; stream = stream->next) {
+
+        ov_json_value *val = stats_to_json(&stream->stats);
+
+        snprintf(key, sizeof(key), "%" PRIu32, stream->ssrc);
+
+        if (!ov_json_object_set(out, key, val)) {
+            ov_json_value_free(val);
+            goto error;
+        }
+    }
+
+    return out;
+error:
+    return ov_json_value_free(out);
+}
@@ -0,0 +1,489 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_jitter_buffer_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_rtp_jitter_buffer.c"
+
+#include "../../include/ov_time.h"
+#include <ov_test/ov_test.h>
+#include <ov_test/testrun.h>
+
+/*****************************************************************************
+                                    HELPERS
+ ****************************************************************************/
+
+#define FRAME_USEC 20000
+#define TS_STEP 960
+
+static ov_rtp_frame *make_frame(uint32_t ssrc, uint16_t seq) {
+
+    ov_rtp_frame_expansion ref = {
+        .version = 2,
+        .ssrc = ssrc,
+        .sequence_number = seq,
+        /* continuous across the wrap at 0 */
+        .timestamp = 1000 + (uint32_t)(int16_t)seq * TS_STEP,
+    };
+
+    return ov_rtp_frame_encode(&ref);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool add(ov_rtp_jitter_buffer *jb, uint32_t ssrc, uint16_t seq,
+                uint64_t now) {
+
+    ov_rtp_frame *frame =
+        ov_rtp_jitter_buffer_add(jb, make_frame(ssrc, seq), now);
+
+    if (!frame)
+        return true;
+
+    ov_rtp_frame_free(frame);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    size_t count;
+
+    struct {
+
+        uint32_t ssrc;
+        uint16_t seq;
+        uint32_t timestamp;
+        bool lost;
+        int32_t next; // -1 if none
+
+    } slot[32];
+
+} Record;
+
+/*----------------------------------------------------------------------------*/
+
+static bool record(void *userdata, ov_rtp_jitter_buffer_slot *slot) {
+
+    Record *r = userdata;
+
+    if (r->count < 32) {
+
+        r->slot[r->count].ssrc = slot->ssrc;
+        r->slot[r->count].seq = slot->sequence_number;
+        r->slot[r->count].timestamp = slot->timestamp;
+        r->slot[r->count].lost = (NULL == slot->frame);
+        r->slot[r->count].next =
+            slot->next ? slot->next->expanded.sequence_number : -1;
+        r->count++;
+    }
+
+    bool lost = (NULL == slot->frame);
+    slot->frame = ov_rtp_frame_free(slot->frame);
+
+    /* conceal any loss */
+    return lost;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_jitter_buffer *make_buffer(uint32_t min, uint32_t max) {
+
+    return ov_rtp_jitter_buffer_create((ov_rtp_jitter_buffer_config){
+        .clock_rate_hz = 48000,
+        .frame_length_usec = FRAME_USEC,
+        .delay.min_frames = min,
+        .delay.max_frames = max,
+        .capacity = 16,
+        .stream_timeout_usec = 1000000,
+    });
+}
+
+/*****************************************************************************
+                                    TESTS
+ ****************************************************************************/
+
+int test_ov_rtp_jitter_buffer_create() {
+
+    ov_rtp_jitter_buffer *jb =
+        ov_rtp_jitter_buffer_create((ov_rtp_jitter_buffer_config){0});
+    testrun(jb);
+
+    testrun(OV_RTP_JITTER_BUFFER_CLOCK_RATE_DEFAULT ==
+            jb->config.clock_rate_hz);
+    testrun(OV_RTP_JITTER_BUFFER_FRAME_USEC_DEFAULT ==
+            jb->config.frame_length_usec);
+    testrun(OV_RTP_JITTER_BUFFER_MIN_FRAMES_DEFAULT ==
+            jb->config.delay.min_frames);
+    testrun(OV_RTP_JITTER_BUFFER_MAX_FRAMES_DEFAULT ==
+            jb->config.delay.max_frames);
+    testrun(OV_RTP_JITTER_BUFFER_CAPACITY_DEFAULT == jb->config.capacity);
+    testrun(0 == ov_rtp_jitter_buffer_count_streams(jb));
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    /* capacity rounded up, max delay limited by the capacity */
+
+    jb = ov_rtp_jitter_buffer_create((ov_rtp_jitter_buffer_config){
+        .capacity = 5,
+        .delay.min_frames = 20,
+        .delay.max_frames = 30,
+    });
+    testrun(jb);
+
+    testrun(8 == jb->config.capacity);
+    testrun(7 == jb->mask);
+    testrun(7 == jb->config.delay.max_frames);
+    testrun(7 == jb->config.delay.min_frames);
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_jitter_buffer_free() {
+
+    testrun(0 == ov_rtp_jitter_buffer_free(0));
+
+    ov_rtp_jitter_buffer *jb = make_buffer(2, 5);
+    testrun(jb);
+
+    /* buffered frames are freed */
+    testrun(add(jb, 1, 1, 0));
+    testrun(add(jb, 2, 1, 0));
+    testrun(add(jb, 2, 2, 0));
+    testrun(2 == ov_rtp_jitter_buffer_count_streams(jb));
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_jitter_buffer_add() {
+
+    ov_rtp_jitter_buffer_stats stats = {0};
+
+    ov_rtp_jitter_buffer *jb = make_buffer(2, 5);
+    testrun(jb);
+
+    testrun(0 == ov_rtp_jitter_buffer_add(0, 0, 0));
+    testrun(0 == ov_rtp_jitter_buffer_add(jb, 0, 0));
+
+    ov_rtp_frame *frame = make_frame(1, 1);
+    testrun(frame == ov_rtp_jitter_buffer_add(0, frame, 0));
+    frame = ov_rtp_frame_free(frame);
+
+    testrun(add(jb, 1, 10, 0));
+    testrun(add(jb, 1, 12, 2 * FRAME_USEC));
+
+    /* duplicate */
+    testrun(!add(jb, 1, 12, 2 * FRAME_USEC));
+
+    /* reordered before playout */
+    testrun(add(jb, 1, 9, 2 * FRAME_USEC));
+    testrun(add(jb, 1, 11, 2 * FRAME_USEC));
+
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(!ov_rtp_jitter_buffer_get_stats(jb, 2, &stats));
+
+    testrun(5 == stats.received);
+    testrun(1 == stats.duplicates);
+    testrun(4 == stats.buffered_frames);
+    testrun(0 == stats.late);
+
+    /* exceeding the max delay drops the oldest frames */
+
+    testrun(add(jb, 1, 15, 3 * FRAME_USEC));
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(2 == stats.dropped);
+    testrun(3 == stats.buffered_frames);
+    testrun(11 == jb->list->next_seq);
+
+    /* sequence jump restarts the stream */
+
+    testrun(add(jb, 1, 1000, 4 * FRAME_USEC));
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(5 == stats.dropped);
+    testrun(1 == stats.buffered_frames);
+    testrun(1000 == jb->list->next_seq);
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_jitter_buffer_playout() {
+
+    Record r = {0};
+    ov_rtp_jitter_buffer_stats stats = {0};
+
+    ov_rtp_jitter_buffer *jb = make_buffer(2, 5);
+    testrun(jb);
+
+    testrun(0 == ov_rtp_jitter_buffer_playout(0, 0, &r, record));
+
+    /* in order, playout starts at the target delay of 2 frames */
+
+    uint64_t now = 0;
+
+    testrun(add(jb, 1, 65535, now));
+    testrun(0 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(0 == r.count);
+
+    now += FRAME_USEC;
+    testrun(add(jb, 1, 0, now));
+    testrun(1 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(1 == r.count);
+    testrun(65535 == r.slot[0].seq);
+    testrun(!r.slot[0].lost);
+
+    /* frame 1 lost */
+
+    now += FRAME_USEC;
+    testrun(1 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(2 == r.count);
+    testrun(0 == r.slot[1].seq);
+
+    now += 2 * FRAME_USEC;
+    testrun(add(jb, 1, 2, now));
+    testrun(1 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(3 == r.count);
+    testrun(1 == r.slot[2].seq);
+    testrun(r.slot[2].lost);
+    testrun(2 == r.slot[2].next);
+    testrun(1000 + 1 * TS_STEP == r.slot[2].timestamp);
+
+    /* late arrival of frame 1 is rejected */
+    testrun(!add(jb, 1, 1, now));
+
+    testrun(1 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(4 == r.count);
+    testrun(2 == r.slot[3].seq);
+    testrun(!r.slot[3].lost);
+
+    /* underrun */
+    testrun(0 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(3 == stats.played);
+    testrun(1 == stats.lost);
+    testrun(1 == stats.concealed);
+    testrun(1 == stats.late);
+    testrun(1 == stats.underruns);
+    testrun(0 == stats.buffered_frames);
+
+    /* rebuffering after the underrun */
+
+    testrun(add(jb, 1, 3, now));
+    testrun(0 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(add(jb, 1, 4, now));
+    testrun(1 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(3 == r.slot[4].seq);
+
+    /* NULL callback frees the frames */
+    testrun(1 == ov_rtp_jitter_buffer_playout(jb, now, NULL, NULL));
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(5 == stats.played);
+
+    /* stream timeout */
+
+    testrun(add(jb, 2, 1, now));
+    testrun(2 == ov_rtp_jitter_buffer_count_streams(jb));
+    now += 2000000;
+    testrun(0 == ov_rtp_jitter_buffer_playout(jb, now, &r, record));
+    testrun(0 == ov_rtp_jitter_buffer_count_streams(jb));
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_jitter_buffer_adaptive() {
+
+    ov_rtp_jitter_buffer_stats stats = {0};
+
+    ov_rtp_jitter_buffer *jb = make_buffer(1, 8);
+    testrun(jb);
+
+    /* no jitter */
+
+    uint64_t now = 0;
+
+    for (uint16_t seq = 0; seq < 100; ++seq) {
+        testrun(add(jb, 1, seq, now));
+        ov_rtp_jitter_buffer_playout(jb, now, NULL, NULL);
+        now += FRAME_USEC;
+    }
+
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(0 == stats.jitter_usec);
+    testrun(1 == stats.target_frames);
+    testrun(0 == stats.late);
+
+    /* arrivals delayed by 0 or 30ms */
+
+    for (uint16_t seq = 100; seq < 300; ++seq) {
+
+        uint64_t delay = (seq % 2) ? 30000 : 0;
+        add(jb, 1, seq, now + delay);
+        now += FRAME_USEC;
+    }
+
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(stats.jitter_usec > 20000);
+    testrun(stats.jitter_usec < 40000);
+    testrun(stats.target_frames > 4);
+    testrun(stats.target_frames <= 8);
+
+    /* target limited by the max delay */
+
+    for (uint16_t seq = 300; seq < 500; ++seq) {
+
+        uint64_t delay = (seq % 2) ? 200000 : 0;
+        add(jb, 1, seq, now + delay);
+        now += FRAME_USEC;
+    }
+
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(8 == stats.target_frames);
+    testrun(stats.buffered_frames <= 8);
+
+    /* jitter decays */
+
+    for (uint16_t seq = 500; seq < 800; ++seq) {
+        add(jb, 1, seq, now);
+        now += FRAME_USEC;
+    }
+
+    testrun(ov_rtp_jitter_buffer_get_stats(jb, 1, &stats));
+    testrun(stats.jitter_usec < 1000);
+    testrun(1 == stats.target_frames);
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_jitter_buffer_stats_to_json() {
+
+    ov_rtp_jitter_buffer *jb = make_buffer(2, 5);
+    testrun(jb);
+
+    testrun(0 == ov_rtp_jitter_buffer_stats_to_json(0));
+
+    ov_json_value *out = ov_rtp_jitter_buffer_stats_to_json(jb);
+    testrun(ov_json_is_object(out));
+    testrun(0 == ov_json_object_count(out));
+    out = ov_json_value_free(out);
+
+    testrun(add(jb, 12345, 1, 0));
+    testrun(add(jb, 12345, 3, FRAME_USEC));
+    testrun(add(jb, 7, 1, 0));
+
+    out = ov_rtp_jitter_buffer_stats_to_json(jb);
+    testrun(2 == ov_json_object_count(out));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/12345/received")));
+    testrun(2 == ov_json_number_get(
+                     ov_json_get(out, "/12345/buffered_frames")));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/12345/target_frames")));
+    testrun(1 == ov_json_number_get(ov_json_get(out, "/7/received")));
+    testrun(ov_json_get(out, "/7/concealed"));
+    testrun(ov_json_get(out, "/7/late"));
+    testrun(ov_json_get(out, "/7/lost"));
+    out = ov_json_value_free(out);
+
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_jitter_buffer_performance() {
+
+    const size_t streams = 32;
+    const size_t frames = 2000;
+
+    ov_rtp_jitter_buffer *jb = make_buffer(2, 8);
+    testrun(jb);
+
+    ov_rtp_frame **input = calloc(streams * frames, sizeof(ov_rtp_frame *));
+    testrun(input);
+
+    for (size_t f = 0; f < frames; ++f) {
+        for (size_t s = 0; s < streams; ++s) {
+            input[f * streams + s] = make_frame(s + 1, f);
+        }
+    }
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    uint64_t now = 0;
+
+    for (size_t f = 0; f < frames; ++f) {
+
+        for (size_t s = 0; s < streams; ++s) {
+            ov_rtp_frame *frame = input[f * streams + s];
+            frame = ov_rtp_jitter_buffer_add(jb, frame, now);
+            ov_rtp_frame_free(frame);
+        }
+
+        ov_rtp_jitter_buffer_playout(jb, now, NULL, NULL);
+        now += FRAME_USEC;
+    }
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout,
+            "jitter buffer: %zu streams %zu frames add + playout "
+            "%.1f ns/frame\n",
+            streams, frames, 1000.0 * usec / (streams * frames));
+
+    free(input);
+    testrun(0 == ov_rtp_jitter_buffer_free(jb));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+OV_TEST_RUN("ov_rtp_jitter_buffer", test_ov_rtp_jitter_buffer_create,
+            test_ov_rtp_jitter_buffer_free, test_ov_rtp_jitter_buffer_add,
+            test_ov_rtp_jitter_buffer_playout,
+            test_ov_rtp_jitter_buffer_adaptive,
+            test_ov_rtp_jitter_buffer_stats_to_json,
+            check_jitter_buffer_performance);
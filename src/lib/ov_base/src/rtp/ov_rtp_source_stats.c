@@ -0,0 +1,138 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_source_stats.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_rtp_source_stats.h"
+#include "../../include/ov_utils.h"
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_source_stats_update(ov_rtp_source_stats *self,
+                                uint16_t sequence_number, uint32_t timestamp,
+                                uint64_t arrival_usecs) {
+
+    if ((!ov_ptr_valid(self, "Cannot update RTP source stats: 0 pointer")) ||
+        (!ov_cond_valid(0 != self->clock_rate_hz,
+                        "Cannot update RTP source stats: No clock rate"))) {
+        return false;
+    }
+
+    if (0 == self->packets) {
+
+        self->first_usecs = arrival_usecs;
+        self->base_seq = sequence_number;
+        self->max_seq = sequence_number;
+    }
+
+    /* relative to the first packet, absolute usecs would overflow */
+    int64_t arrival = (int64_t)(arrival_usecs - self->first_usecs) *
+                      (int64_t)self->clock_rate_hz / 1000000;
+
+    self->last_usecs = arrival_usecs;
+
+    if (0 == self->packets++) {
+
+        self->last_arrival = arrival;
+        self->last_timestamp = timestamp;
+        return true;
+    }
+
+    uint16_t delta = sequence_number - self->max_seq;
+
+    if (0 == delta) {
+
+        ++self->duplicates;
+        return true;
+
+    } else if (delta < 0x8000) {
+
+        if (sequence_number < self->max_seq)
+            self->cycles += 0x10000;
+
+        self->max_seq = sequence_number;
+
+    } else {
+
+        ++self->reordered;
+    }
+
+    /* difference of transits, the signed 32 bit timestamp difference
+     * keeps timestamp wraps from showing up as jitter spikes */
+
+    int64_t d = (arrival - self->last_arrival) -
+                (int32_t)(timestamp - self->last_timestamp);
+
+    self->last_arrival = arrival;
+    self->last_timestamp = timestamp;
+
+    if (0 > d)
+        d = -d;
+
+    self->jitter += ((double)d - self->jitter) / 16.0;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_rtp_source_stats_expected(const ov_rtp_source_stats *self) {
+
+    if ((0 == self) || (0 == self->packets))
+        return 0;
+
+    return (uint64_t)self->cycles + self->max_seq - self->base_seq + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_rtp_source_stats_received(const ov_rtp_source_stats *self) {
+
+    if (0 == self)
+        return 0;
+
+    return self->packets - self->duplicates;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int64_t ov_rtp_source_stats_lost(const ov_rtp_source_stats *self) {
+
+    return (int64_t)ov_rtp_source_stats_expected(self) -
+           (int64_t)ov_rtp_source_stats_received(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+double ov_rtp_source_stats_jitter_usecs(const ov_rtp_source_stats *self) {
+
+    if ((0 == self) || (0 == self->clock_rate_hz))
+        return 0;
+
+    return 1000000.0 * self->jitter / self->clock_rate_hz;
+}
+
+/*----------------------------------------------------------------------------*/
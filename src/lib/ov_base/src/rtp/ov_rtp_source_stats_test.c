@@ -0,0 +1,173 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_source_stats_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_rtp_source_stats.c"
+
+#include <ov_test/testrun.h>
+
+/* 20 ms frames at 48 kHz */
+#define CLOCK_RATE_HZ 48000
+#define TS_STEP 960
+#define USECS_STEP 20000
+
+/*----------------------------------------------------------------------------*/
+
+static bool update(ov_rtp_source_stats *stats, uint16_t seq,
+                   uint64_t usecs) {
+
+    return ov_rtp_source_stats_update(stats, seq, 1000 + seq * TS_STEP,
+                                      usecs);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_rtp_source_stats_update() {
+
+    ov_rtp_source_stats stats = {0};
+
+    testrun(!ov_rtp_source_stats_update(0, 1, 1, 1));
+    testrun(!update(&stats, 1, 1));
+    testrun(0 == stats.packets);
+
+    stats.clock_rate_hz = CLOCK_RATE_HZ;
+
+    testrun(0 == ov_rtp_source_stats_expected(&stats));
+    testrun(0 == ov_rtp_source_stats_lost(&stats));
+
+    /* in order, no loss, no jitter */
+
+    for (uint16_t seq = 10; seq < 20; ++seq) {
+        testrun(update(&stats, seq, 5000000 + (seq - 10) * USECS_STEP));
+    }
+
+    testrun(10 == stats.packets);
+    testrun(10 == stats.base_seq);
+    testrun(19 == stats.max_seq);
+    testrun(5000000 == stats.first_usecs);
+    testrun(5180000 == stats.last_usecs);
+    testrun(10 == ov_rtp_source_stats_expected(&stats));
+    testrun(10 == ov_rtp_source_stats_received(&stats));
+    testrun(0 == ov_rtp_source_stats_lost(&stats));
+    testrun(0 == stats.jitter);
+
+    /* gap of 2, then a duplicate of the highest and a late packet */
+
+    testrun(update(&stats, 22, 5240000));
+    testrun(update(&stats, 22, 5250000));
+    testrun(update(&stats, 20, 5260000));
+
+    testrun(13 == stats.packets);
+    testrun(1 == stats.duplicates);
+    testrun(1 == stats.reordered);
+    testrun(22 == stats.max_seq);
+    testrun(13 == ov_rtp_source_stats_expected(&stats));
+    testrun(12 == ov_rtp_source_stats_received(&stats));
+    testrun(1 == ov_rtp_source_stats_lost(&stats));
+
+    /* the late packet is 60 ms off its schedule */
+    testrun(0 < stats.jitter);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_rtp_source_stats_wrap() {
+
+    ov_rtp_source_stats stats = {.clock_rate_hz = CLOCK_RATE_HZ};
+
+    uint64_t usecs = 0;
+
+    for (uint32_t i = 0; i < 0x10000 + 10; ++i) {
+        testrun(ov_rtp_source_stats_update(&stats, (uint16_t)(0xfff0 + i),
+                                           i * TS_STEP, usecs));
+        usecs += USECS_STEP;
+    }
+
+    testrun(0x10000 == stats.cycles);
+    testrun(0x10000 + 10 == ov_rtp_source_stats_expected(&stats));
+    testrun(0 == ov_rtp_source_stats_lost(&stats));
+    testrun(0 == stats.reordered);
+    testrun(0 == stats.jitter);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_rtp_source_stats_jitter() {
+
+    ov_rtp_source_stats stats = {.clock_rate_hz = CLOCK_RATE_HZ};
+
+    /* every second frame 10 ms late, D is 480 units each time */
+
+    for (uint16_t seq = 0; seq < 500; ++seq) {
+        testrun(update(&stats, seq, seq * USECS_STEP + (seq % 2) * 10000));
+    }
+
+    testrun(470 < stats.jitter);
+    testrun(480 >= stats.jitter);
+
+    double usecs = ov_rtp_source_stats_jitter_usecs(&stats);
+    testrun(9800 < usecs);
+    testrun(10000 >= usecs);
+
+    /* duplicates carry no new transit */
+
+    double jitter = stats.jitter;
+    testrun(update(&stats, 499, 100000000));
+    testrun(jitter == stats.jitter);
+    testrun(1 == stats.duplicates);
+
+    testrun(0 == ov_rtp_source_stats_jitter_usecs(0));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_rtp_source_stats_update);
+    testrun_test(test_ov_rtp_source_stats_wrap);
+    testrun_test(test_ov_rtp_source_stats_jitter);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
@@ -0,0 +1,262 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_view.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_rtp_view.h"
+
+#include <arpa/inet.h>
+#include <string.h>
+
+#define HEADER_LENGTH 12
+#define VERSION_2 2
+
+/*----------------------------------------------------------------------------*/
+
+static uint16_t read_u16(const uint8_t *ptr) {
+
+    uint16_t u16 = 0;
+    memcpy(&u16, ptr, sizeof(u16));
+    return ntohs(u16);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t read_u32(const uint8_t *ptr) {
+
+    uint32_t u32 = 0;
+    memcpy(&u32, ptr, sizeof(u32));
+    return ntohl(u32);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void write_u32(uint8_t *ptr, uint32_t value) {
+
+    uint32_t u32 = htonl(value);
+    memcpy(ptr, &u32, sizeof(u32));
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_parse(ov_rtp_view *self, uint8_t *data, size_t length) {
+
+    if (!self)
+        goto error;
+
+    *self = (ov_rtp_view){0};
+
+    if (!data || (HEADER_LENGTH > length))
+        goto error;
+
+    if (VERSION_2 != (data[0] >> 6))
+        goto error;
+
+    size_t offset = HEADER_LENGTH + (data[0] & 0x0f) * sizeof(uint32_t);
+
+    if (data[0] & 0x10) {
+
+        /* extension header */
+
+        if (offset + 4 > length)
+            goto error;
+
+        offset += 4 + read_u16(data + offset + 2) * sizeof(uint32_t);
+    }
+
+    if (offset > length)
+        goto error;
+
+    size_t payload_length = length - offset;
+
+    if (data[0] & 0x20) {
+
+        uint8_t padding = data[length - 1];
+
+        if ((0 == padding) || (padding > payload_length))
+            goto error;
+
+        payload_length -= padding;
+    }
+
+    self->data = data;
+    self->length = length;
+    self->payload_offset = offset;
+    self->payload_length = payload_length;
+
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_marker(const ov_rtp_view *self) {
+
+    if (!self || !self->data)
+        return false;
+
+    return self->data[1] & 0x80;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint8_t ov_rtp_view_payload_type(const ov_rtp_view *self) {
+
+    if (!self || !self->data)
+        return 0;
+
+    return self->data[1] & 0x7f;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint16_t ov_rtp_view_sequence_number(const ov_rtp_view *self) {
+
+    if (!self || !self->data)
+        return 0;
+
+    return read_u16(self->data + 2);
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint32_t ov_rtp_view_timestamp(const ov_rtp_view *self) {
+
+    if (!self || !self->data)
+        return 0;
+
+    return read_u32(self->data + 4);
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint32_t ov_rtp_view_ssrc(const ov_rtp_view *self) {
+
+    if (!self || !self->data)
+        return 0;
+
+    return read_u32(self->data + 8);
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint8_t ov_rtp_view_csrc_count(const ov_rtp_view *self) {
+
+    if (!self || !self->data)
+        return 0;
+
+    return self->data[0] & 0x0f;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint32_t ov_rtp_view_csrc(const ov_rtp_view *self, uint8_t index) {
+
+    if (index >= ov_rtp_view_csrc_count(self))
+        return 0;
+
+    return read_u32(self->data + HEADER_LENGTH + index * sizeof(uint32_t));
+}
+
+/*----------------------------------------------------------------------------*/
+
+const uint8_t *ov_rtp_view_payload(const ov_rtp_view *self, size_t *length) {
+
+    if (length)
+        *length = 0;
+
+    if (!self || !self->data || (0 == self->payload_length))
+        return NULL;
+
+    if (length)
+        *length = self->payload_length;
+
+    return self->data + self->payload_offset;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_set_marker(ov_rtp_view *self, bool marker) {
+
+    if (!self || !self->data)
+        return false;
+
+    self->data[1] &= 0x7f;
+
+    if (marker)
+        self->data[1] |= 0x80;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_set_payload_type(ov_rtp_view *self, uint8_t payload_type) {
+
+    if (!self || !self->data || (0x7f < payload_type))
+        return false;
+
+    self->data[1] &= 0x80;
+    self->data[1] |= payload_type;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_set_sequence_number(ov_rtp_view *self, uint16_t seq) {
+
+    if (!self || !self->data)
+        return false;
+
+    uint16_t u16 = htons(seq);
+    memcpy(self->data + 2, &u16, sizeof(u16));
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_set_timestamp(ov_rtp_view *self, uint32_t timestamp) {
+
+    if (!self || !self->data)
+        return false;
+
+    write_u32(self->data + 4, timestamp);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_rtp_view_set_ssrc(ov_rtp_view *self, uint32_t ssrc) {
+
+    if (!self || !self->data)
+        return false;
+
+    write_u32(self->data + 8, ssrc);
+    return true;
+}
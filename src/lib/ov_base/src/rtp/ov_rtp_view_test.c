@@ -0,0 +1,354 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_rtp_view_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_rtp_view.c"
+
+#include "../../include/ov_rtp_frame.h"
+#include "../../include/ov_time.h"
+#include <ov_test/testrun.h>
+
+/*****************************************************************************
+                                    HELPERS
+ ****************************************************************************/
+
+static ov_rtp_frame *frame_encode(bool extension, uint8_t padding) {
+
+    uint8_t payload[160] = {0};
+    uint8_t ext[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t pad[8] = {0};
+    uint32_t csrcs[] = {0xa0a0a0a0, 0xb0b0b0b0};
+
+    for (size_t i = 0; i < sizeof(payload); ++i) {
+        payload[i] = i;
+    }
+
+    ov_rtp_frame_expansion exp = {
+
+        .version = RTP_VERSION_2,
+        .marker_bit = true,
+        .payload_type = 100,
+        .sequence_number = 0xfedc,
+        .timestamp = 0x12345678,
+        .ssrc = 0xdeadbeef,
+        .csrc_count = 2,
+        .csrc_ids = csrcs,
+        .payload.length = sizeof(payload),
+        .payload.data = payload,
+    };
+
+    if (extension) {
+        exp.extension_bit = true;
+        exp.extension.type = 0xbede;
+        exp.extension.length = sizeof(ext);
+        exp.extension.data = ext;
+    }
+
+    if (padding) {
+        exp.padding_bit = true;
+        exp.padding.length = padding;
+        exp.padding.data = pad;
+    }
+
+    return ov_rtp_frame_encode(&exp);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool view_matches_frame(const ov_rtp_view *view,
+                               const ov_rtp_frame *frame) {
+
+    const ov_rtp_frame_expansion *exp = &frame->expanded;
+
+    size_t length = 0;
+    const uint8_t *payload = ov_rtp_view_payload(view, &length);
+
+    if (length != exp->payload.length)
+        return false;
+
+    if ((0 < length) && (0 != memcmp(payload, exp->payload.data, length)))
+        return false;
+
+    for (uint8_t i = 0; i < exp->csrc_count; ++i) {
+
+        if (ov_rtp_view_csrc(view, i) != exp->csrc_ids[i])
+            return false;
+    }
+
+    return (ov_rtp_view_marker(view) == exp->marker_bit) &&
+           (ov_rtp_view_payload_type(view) == exp->payload_type) &&
+           (ov_rtp_view_sequence_number(view) == exp->sequence_number) &&
+           (ov_rtp_view_timestamp(view) == exp->timestamp) &&
+           (ov_rtp_view_ssrc(view) == exp->ssrc) &&
+           (ov_rtp_view_csrc_count(view) == exp->csrc_count);
+}
+
+/*****************************************************************************
+                                     TESTS
+ ****************************************************************************/
+
+int test_ov_rtp_view_parse() {
+
+    ov_rtp_view view = {0};
+    uint8_t buffer[100] = {0x80};
+
+    testrun(!ov_rtp_view_parse(NULL, buffer, sizeof(buffer)));
+    testrun(!ov_rtp_view_parse(&view, NULL, sizeof(buffer)));
+    testrun(!ov_rtp_view_parse(&view, buffer, 11));
+    testrun(0 == view.data);
+
+    /* header only */
+
+    testrun(ov_rtp_view_parse(&view, buffer, 12));
+    testrun(buffer == view.data);
+    testrun(12 == view.payload_offset);
+    testrun(0 == view.payload_length);
+    testrun(NULL == ov_rtp_view_payload(&view, NULL));
+
+    /* wrong version */
+
+    buffer[0] = 0x40;
+    testrun(!ov_rtp_view_parse(&view, buffer, sizeof(buffer)));
+    testrun(0 == view.data);
+
+    /* csrcs exceed packet */
+
+    buffer[0] = 0x8f;
+    testrun(!ov_rtp_view_parse(&view, buffer, 12 + 14 * 4));
+    testrun(ov_rtp_view_parse(&view, buffer, 12 + 15 * 4));
+
+    /* extension exceeds packet */
+
+    buffer[0] = 0x90;
+    buffer[14] = 0;
+    buffer[15] = 2;
+    testrun(!ov_rtp_view_parse(&view, buffer, 14));
+    testrun(!ov_rtp_view_parse(&view, buffer, 12 + 4 + 7));
+    testrun(ov_rtp_view_parse(&view, buffer, 12 + 4 + 8));
+
+    /* padding */
+
+    memset(buffer, 0, sizeof(buffer));
+    buffer[0] = 0xa0;
+    testrun(!ov_rtp_view_parse(&view, buffer, 20));
+    buffer[19] = 9;
+    testrun(!ov_rtp_view_parse(&view, buffer, 20));
+    buffer[19] = 8;
+    testrun(ov_rtp_view_parse(&view, buffer, 20));
+    testrun(0 == view.payload_length);
+    buffer[19] = 3;
+    testrun(ov_rtp_view_parse(&view, buffer, 20));
+    testrun(5 == view.payload_length);
+
+    /* same result as ov_rtp_frame_decode */
+
+    for (size_t i = 0; i < 4; ++i) {
+
+        ov_rtp_frame *frame = frame_encode(i & 1, (i & 2) ? 4 : 0);
+        testrun(frame);
+
+        ov_rtp_frame *decoded =
+            ov_rtp_frame_decode(frame->bytes.data, frame->bytes.length);
+        testrun(decoded);
+
+        testrun(ov_rtp_view_parse(&view, frame->bytes.data,
+                                  frame->bytes.length));
+        testrun(view_matches_frame(&view, decoded));
+
+        frame = ov_rtp_frame_free(frame);
+        decoded = ov_rtp_frame_free(decoded);
+    }
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_view_accessors() {
+
+    ov_rtp_view view = {0};
+
+    testrun(!ov_rtp_view_marker(NULL));
+    testrun(0 == ov_rtp_view_payload_type(NULL));
+    testrun(0 == ov_rtp_view_sequence_number(NULL));
+    testrun(0 == ov_rtp_view_timestamp(NULL));
+    testrun(0 == ov_rtp_view_ssrc(&view));
+    testrun(0 == ov_rtp_view_csrc_count(&view));
+    testrun(0 == ov_rtp_view_csrc(&view, 0));
+
+    size_t length = 1;
+    testrun(NULL == ov_rtp_view_payload(&view, &length));
+    testrun(0 == length);
+
+    ov_rtp_frame *frame = frame_encode(true, 0);
+    testrun(frame);
+
+    testrun(ov_rtp_view_parse(&view, frame->bytes.data, frame->bytes.length));
+
+    testrun(ov_rtp_view_marker(&view));
+    testrun(100 == ov_rtp_view_payload_type(&view));
+    testrun(0xfedc == ov_rtp_view_sequence_number(&view));
+    testrun(0x12345678 == ov_rtp_view_timestamp(&view));
+    testrun(0xdeadbeef == ov_rtp_view_ssrc(&view));
+    testrun(2 == ov_rtp_view_csrc_count(&view));
+    testrun(0xa0a0a0a0 == ov_rtp_view_csrc(&view, 0));
+    testrun(0xb0b0b0b0 == ov_rtp_view_csrc(&view, 1));
+    testrun(0 == ov_rtp_view_csrc(&view, 2));
+
+    const uint8_t *payload = ov_rtp_view_payload(&view, &length);
+    testrun(160 == length);
+    testrun(frame->bytes.data + 12 + 8 + 4 + 8 == payload);
+    testrun(0 == payload[0]);
+    testrun(159 == payload[159]);
+
+    frame = ov_rtp_frame_free(frame);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_rtp_view_mutators() {
+
+    ov_rtp_view view = {0};
+
+    testrun(!ov_rtp_view_set_marker(NULL, true));
+    testrun(!ov_rtp_view_set_payload_type(&view, 1));
+    testrun(!ov_rtp_view_set_sequence_number(&view, 1));
+    testrun(!ov_rtp_view_set_timestamp(&view, 1));
+    testrun(!ov_rtp_view_set_ssrc(&view, 1));
+
+    ov_rtp_frame *frame = frame_encode(true, 4);
+    testrun(frame);
+
+    testrun(ov_rtp_view_parse(&view, frame->bytes.data, frame->bytes.length));
+
+    testrun(!ov_rtp_view_set_payload_type(&view, 0x80));
+    testrun(ov_rtp_view_set_payload_type(&view, 0x7f));
+    testrun(ov_rtp_view_set_payload_type(&view, 8));
+    testrun(ov_rtp_view_set_marker(&view, false));
+    testrun(ov_rtp_view_set_sequence_number(&view, 0x1234));
+    testrun(ov_rtp_view_set_timestamp(&view, 0xfedcba98));
+    testrun(ov_rtp_view_set_ssrc(&view, 0x01020304));
+
+    /* decode the patched buffer */
+
+    ov_rtp_frame *decoded =
+        ov_rtp_frame_decode(frame->bytes.data, frame->bytes.length);
+    testrun(decoded);
+
+    testrun(!decoded->expanded.marker_bit);
+    testrun(8 == decoded->expanded.payload_type);
+    testrun(0x1234 == decoded->expanded.sequence_number);
+    testrun(0xfedcba98 == decoded->expanded.timestamp);
+    testrun(0x01020304 == decoded->expanded.ssrc);
+    testrun(decoded->expanded.extension_bit);
+    testrun(decoded->expanded.padding_bit);
+    testrun(view_matches_frame(&view, decoded));
+
+    testrun(ov_rtp_view_set_marker(&view, true));
+    testrun(ov_rtp_view_marker(&view));
+    testrun(8 == ov_rtp_view_payload_type(&view));
+
+    frame = ov_rtp_frame_free(frame);
+    decoded = ov_rtp_frame_free(decoded);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_rtp_view_performance() {
+
+    const size_t runs = 1000000;
+
+    ov_rtp_frame *frame = frame_encode(false, 0);
+    testrun(frame);
+
+    uint8_t *buffer = frame->bytes.data;
+    size_t bytes = frame->bytes.length;
+
+    uint64_t sum = 0;
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+
+        ov_rtp_frame *decoded = ov_rtp_frame_decode(buffer, bytes);
+        sum += decoded->expanded.ssrc + decoded->expanded.payload.length;
+        decoded = ov_rtp_frame_free(decoded);
+    }
+
+    uint64_t usec_decode = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+
+        ov_rtp_view view = {0};
+        size_t length = 0;
+
+        ov_rtp_view_parse(&view, buffer, bytes);
+        ov_rtp_view_payload(&view, &length);
+        sum -= ov_rtp_view_ssrc(&view) + length;
+    }
+
+    uint64_t usec_view = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout,
+            "rtp header of %zu bytes: decode %.1f ns/op view %.1f ns/op\n",
+            bytes, 1000.0 * usec_decode / runs, 1000.0 * usec_view / runs);
+
+    testrun(0 == sum);
+
+    frame = ov_rtp_frame_free(frame);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_rtp_view_parse);
+    testrun_test(test_ov_rtp_view_accessors);
+    testrun_test(test_ov_rtp_view_mutators);
+    testrun_test(check_rtp_view_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
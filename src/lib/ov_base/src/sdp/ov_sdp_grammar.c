@@ -35,6 +35,7 @@
 
 #include <arpa/inet.h>
 #include <ctype.h>
+#include <string.h>
 
 bool ov_sdp_is_text(const char *buffer, uint64_t length) {
 
@@ -398,18 +399,11 @@ bool ov_sdp_is_byte_string(const char *buffer, uint64_t length) {
     if (!buffer || length < 1)
         return false;
 
-    for (size_t i = 0; i < length; i++) {
-
-        switch (buffer[i]) {
+    /* memchr is vectorised, far faster than a switch per byte */
 
-        case 0x00:
-        case '\r':
-        case '\n':
-            return false;
-        default:
-            break;
-        }
-    }
+    if (memchr(buffer, 0x00, length) || memchr(buffer, '\r', length) ||
+        memchr(buffer, '\n', length))
+        return false;
 
     return true;
 }
@@ -0,0 +1,386 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sdp_template.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_sdp_template.h"
+#include "../../include/ov_utils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define PLACEHOLDER_OPEN "{{"
+#define PLACEHOLDER_CLOSE "}}"
+
+/* longest decimal uint32_t */
+#define NUMBER_MAX 10
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum {
+
+    LITERAL = 0,
+    PORT,
+    SSRC,
+    ICE_UFRAG,
+    ICE_PWD,
+    FINGERPRINT
+
+} SegmentType;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    SegmentType type;
+
+    /* LITERAL: part of text, PORT / SSRC: media index */
+    size_t offset;
+    size_t length;
+
+} Segment;
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_sdp_template {
+
+    char *text;
+
+    size_t num_segments;
+    Segment *segments;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static const struct {
+
+    const char *name;
+    SegmentType type;
+
+} placeholders[] = {
+
+    {"port", PORT},
+    {"ssrc", SSRC},
+    {"ice-ufrag", ICE_UFRAG},
+    {"ice-pwd", ICE_PWD},
+    {"fingerprint", FINGERPRINT},
+};
+
+/*----------------------------------------------------------------------------*/
+
+static SegmentType placeholder_type(const char *name, size_t length) {
+
+    for (size_t i = 0; i < sizeof(placeholders) / sizeof(placeholders[0]);
+         ++i) {
+
+        if ((length == strlen(placeholders[i].name)) &&
+            (0 == memcmp(name, placeholders[i].name, length)))
+            return placeholders[i].type;
+    }
+
+    return LITERAL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t count_media(const char *text, const char *start,
+                          const char *end) {
+
+    /* media descriptions started within [start, end) */
+
+    size_t count = 0;
+
+    for (const char *ptr = start; ptr + 1 < end; ++ptr) {
+
+        if (('m' != ptr[0]) || ('=' != ptr[1]))
+            continue;
+
+        if ((ptr == text) || ('\n' == ptr[-1]))
+            ++count;
+    }
+
+    return count;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool compile(ov_sdp_template *self) {
+
+    const char *text = self->text;
+    const char *ptr = text;
+
+    size_t media = 0;
+    size_t num = 0;
+
+    /* worst case every second segment is a placeholder */
+
+    size_t max =
+        2 * (strlen(text) / strlen(PLACEHOLDER_OPEN PLACEHOLDER_CLOSE)) + 1;
+
+    self->segments = calloc(max, sizeof(Segment));
+    if (!self->segments)
+        goto error;
+
+    while (*ptr) {
+
+        const char *open = strstr(ptr, PLACEHOLDER_OPEN);
+        if (!open)
+            open = ptr + strlen(ptr);
+
+        if (open > ptr) {
+
+            media += count_media(text, ptr, open);
+
+            self->segments[num++] = (Segment){
+                .type = LITERAL,
+                .offset = ptr - text,
+                .length = open - ptr,
+            };
+        }
+
+        if (!*open)
+            break;
+
+        const char *name = open + strlen(PLACEHOLDER_OPEN);
+        const char *close = strstr(name, PLACEHOLDER_CLOSE);
+        if (!close)
+            goto error;
+
+        Segment segment = {.type = placeholder_type(name, close - name)};
+
+        switch (segment.type) {
+
+        case LITERAL:
+            goto error;
+
+        case PORT:
+        case SSRC:
+
+            if ((0 == media) || (media > OV_SDP_VIEW_MEDIA_MAX))
+                goto error;
+
+            segment.offset = media - 1;
+            break;
+
+        default:
+            break;
+        }
+
+        self->segments[num++] = segment;
+        ptr = close + strlen(PLACEHOLDER_CLOSE);
+    }
+
+    self->num_segments = num;
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate(const ov_sdp_template *self) {
+
+    /* fill in some values and validate the result once */
+
+    ov_sdp_template_values values = {
+
+        .ice_ufrag = "ufrag",
+        .ice_pwd = "passwordpasswordpassword",
+        .fingerprint = "sha-256 "
+                       "00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:"
+                       "00:00:00:00:00:00:00:00:00:00:00:00:00:00:00:00",
+    };
+
+    for (size_t i = 0; i < OV_SDP_VIEW_MEDIA_MAX; ++i) {
+        values.port[i] = 65535;
+        values.ssrc[i] = UINT32_MAX;
+    }
+
+    bool result = false;
+
+    size_t size = strlen(self->text) +
+                  self->num_segments * strlen(values.fingerprint) + 1;
+
+    char *buffer = calloc(1, size);
+    ov_sdp_view *view = calloc(1, sizeof(ov_sdp_view));
+
+    if (!buffer || !view)
+        goto done;
+
+    ssize_t length = ov_sdp_template_write(self, &values, buffer, size);
+    if (0 > length)
+        goto done;
+
+    result = ov_sdp_view_parse(view, buffer, length);
+
+done:
+    buffer = ov_free(buffer);
+    view = ov_free(view);
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_sdp_template *ov_sdp_template_create(const char *string) {
+
+    ov_sdp_template *self = NULL;
+
+    if (!string)
+        goto error;
+
+    self = calloc(1, sizeof(ov_sdp_template));
+    if (!self)
+        goto error;
+
+    self->text = strdup(string);
+    if (!self->text)
+        goto error;
+
+    if (!compile(self) || !validate(self))
+        goto error;
+
+    return self;
+error:
+    return ov_sdp_template_free(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_sdp_template *ov_sdp_template_free(ov_sdp_template *self) {
+
+    if (!self)
+        return NULL;
+
+    self->text = ov_free(self->text);
+    self->segments = ov_free(self->segments);
+    self = ov_free(self);
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static char *write_number(char *ptr, const char *end, uint32_t number) {
+
+    char digits[NUMBER_MAX];
+    size_t count = 0;
+
+    do {
+        digits[count++] = '0' + number % 10;
+        number /= 10;
+    } while (number);
+
+    if ((size_t)(end - ptr) < count)
+        return NULL;
+
+    while (count) {
+        *ptr++ = digits[--count];
+    }
+
+    return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static char *write_string(char *ptr, const char *end, const char *string) {
+
+    if (!string)
+        return NULL;
+
+    size_t length = strcspn(string, "\r\n");
+
+    if (0 != string[length])
+        return NULL;
+
+    if ((size_t)(end - ptr) < length)
+        return NULL;
+
+    memcpy(ptr, string, length);
+    return ptr + length;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ssize_t ov_sdp_template_write(const ov_sdp_template *self,
+                              const ov_sdp_template_values *values,
+                              char *buffer, size_t size) {
+
+    if (!self || !values || !buffer || (0 == size))
+        goto error;
+
+    char *ptr = buffer;
+
+    /* keep the last byte for the zero termination */
+    const char *end = buffer + size - 1;
+
+    for (size_t i = 0; ptr && (i < self->num_segments); ++i) {
+
+        const Segment *segment = self->segments + i;
+
+        switch (segment->type) {
+
+        case LITERAL:
+
+            if ((size_t)(end - ptr) < segment->length)
+                goto error;
+
+            memcpy(ptr, self->text + segment->offset, segment->length);
+            ptr += segment->length;
+            break;
+
+        case PORT:
+            ptr = write_number(ptr, end, values->port[segment->offset]);
+            break;
+
+        case SSRC:
+            ptr = write_number(ptr, end, values->ssrc[segment->offset]);
+            break;
+
+        case ICE_UFRAG:
+            ptr = write_string(ptr, end, values->ice_ufrag);
+            break;
+
+        case ICE_PWD:
+            ptr = write_string(ptr, end, values->ice_pwd);
+            break;
+
+        case FINGERPRINT:
+            ptr = write_string(ptr, end, values->fingerprint);
+            break;
+        }
+    }
+
+    if (!ptr)
+        goto error;
+
+    *ptr = 0;
+    return ptr - buffer;
+
+error:
+    if (buffer && (0 < size))
+        buffer[0] = 0;
+    return -1;
+}
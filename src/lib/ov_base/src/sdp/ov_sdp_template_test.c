@@ -0,0 +1,336 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sdp_template_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_sdp_template.c"
+
+#include "../../include/ov_sdp.h"
+#include "../../include/ov_time.h"
+#include <ov_test/testrun.h>
+
+/*****************************************************************************
+                                    HELPERS
+ ****************************************************************************/
+
+#define FINGERPRINT                                                            \
+    "sha-256 "                                                                 \
+    "7B:8B:F0:65:5F:78:E2:51:3B:AC:6F:F3:3F:46:1B:35:"                         \
+    "DC:B8:5F:64:1A:24:C2:43:F0:A1:58:D0:A1:2C:19:08"
+
+/* offer with audio and video as sent by some browser */
+
+static const char *offer_template =
+    "v=0\r\n"
+    "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+    "s=-\r\n"
+    "t=0 0\r\n"
+    "a=group:BUNDLE 0 1\r\n"
+    "a=msid-semantic: WMS openvocs\r\n"
+    "m=audio {{port}} UDP/TLS/RTP/SAVPF 111 0 8\r\n"
+    "c=IN IP4 0.0.0.0\r\n"
+    "a=ice-ufrag:{{ice-ufrag}}\r\n"
+    "a=ice-pwd:{{ice-pwd}}\r\n"
+    "a=ice-options:trickle\r\n"
+    "a=fingerprint:{{fingerprint}}\r\n"
+    "a=setup:actpass\r\n"
+    "a=mid:0\r\n"
+    "a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+    "a=sendrecv\r\n"
+    "a=rtcp-mux\r\n"
+    "a=rtpmap:111 opus/48000/2\r\n"
+    "a=fmtp:111 minptime=10;useinbandfec=1\r\n"
+    "a=rtpmap:0 PCMU/8000\r\n"
+    "a=rtpmap:8 PCMA/8000\r\n"
+    "a=ssrc:{{ssrc}} cname:openvocs\r\n"
+    "m=video {{port}} UDP/TLS/RTP/SAVPF 96 97\r\n"
+    "c=IN IP4 0.0.0.0\r\n"
+    "a=ice-ufrag:{{ice-ufrag}}\r\n"
+    "a=ice-pwd:{{ice-pwd}}\r\n"
+    "a=ice-options:trickle\r\n"
+    "a=fingerprint:{{fingerprint}}\r\n"
+    "a=setup:actpass\r\n"
+    "a=mid:1\r\n"
+    "a=sendrecv\r\n"
+    "a=rtcp-mux\r\n"
+    "a=rtcp-rsize\r\n"
+    "a=rtpmap:96 VP8/90000\r\n"
+    "a=rtcp-fb:96 nack pli\r\n"
+    "a=rtpmap:97 rtx/90000\r\n"
+    "a=fmtp:97 apt=96\r\n"
+    "a=ssrc:{{ssrc}} cname:openvocs\r\n";
+
+/* audio answer */
+
+static const char *answer_template =
+    "v=0\r\n"
+    "o=- 0 0 IN IP4 0.0.0.0\r\n"
+    "s=-\r\n"
+    "t=0 0\r\n"
+    "a=fingerprint:{{fingerprint}}\r\n"
+    "a=ice-options:trickle\r\n"
+    "m=audio {{port}} UDP/TLS/RTP/SAVPF 111\r\n"
+    "c=IN IP4 0.0.0.0\r\n"
+    "a=sendrecv\r\n"
+    "a=ice-pwd:{{ice-pwd}}\r\n"
+    "a=ice-ufrag:{{ice-ufrag}}\r\n"
+    "a=mid:0\r\n"
+    "a=rtcp-mux\r\n"
+    "a=rtpmap:111 opus/48000/2\r\n"
+    "a=fmtp:111 maxplaybackrate=48000;stereo=1;useinbandfec=1\r\n"
+    "a=setup:active\r\n"
+    "a=ssrc:{{ssrc}} cname:openvocs\r\n";
+
+/*----------------------------------------------------------------------------*/
+
+static ov_sdp_template_values test_values() {
+
+    ov_sdp_template_values values = {
+
+        .ice_ufrag = "9kZ+",
+        .ice_pwd = "D5jV4b0qQ0mQpwKcC4W8lWj6",
+        .fingerprint = FINGERPRINT,
+        .port = {12345, 0},
+        .ssrc = {3735928559, 1},
+    };
+
+    return values;
+}
+
+/*****************************************************************************
+                                     TESTS
+ ****************************************************************************/
+
+int test_ov_sdp_template_create() {
+
+    testrun(NULL == ov_sdp_template_create(NULL));
+    testrun(NULL == ov_sdp_template_create(""));
+
+    ov_sdp_template *template = ov_sdp_template_create(offer_template);
+    testrun(template);
+    testrun(NULL == ov_sdp_template_free(template));
+
+    /* no placeholder at all */
+
+    template = ov_sdp_template_create("v=0\r\n"
+                                      "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                                      "s=-\r\n"
+                                      "t=0 0\r\n");
+    testrun(template);
+    testrun(1 == template->num_segments);
+    testrun(NULL == ov_sdp_template_free(template));
+
+    /* unknown placeholder */
+
+    testrun(NULL == ov_sdp_template_create("v=0\r\n"
+                                           "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                                           "s={{name}}\r\n"
+                                           "t=0 0\r\n"));
+
+    /* placeholder not closed */
+
+    testrun(NULL == ov_sdp_template_create("v=0\r\n"
+                                           "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                                           "s=-\r\n"
+                                           "t=0 0\r\n"
+                                           "a=ice-pwd:{{ice-pwd\r\n"));
+
+    /* port outside of media description */
+
+    testrun(NULL == ov_sdp_template_create("v=0\r\n"
+                                           "o=- {{port}} 0 IN IP4 0.0.0.0\r\n"
+                                           "s=-\r\n"
+                                           "t=0 0\r\n"));
+
+    /* not valid SDP once filled */
+
+    testrun(NULL == ov_sdp_template_create("v=0\r\n"
+                                           "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                                           "s=-\r\n"
+                                           "t=0 0\r\n"
+                                           "m=audio {{port}} RTP/AVP\r\n"));
+
+    testrun(NULL == ov_sdp_template_create("v=0\r\n"
+                                           "s=-\r\n"
+                                           "t=0 0\r\n"));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_sdp_template_free() {
+
+    testrun(NULL == ov_sdp_template_free(NULL));
+
+    ov_sdp_template *template = ov_sdp_template_create(answer_template);
+    testrun(template);
+    testrun(NULL == ov_sdp_template_free(template));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_sdp_template_write() {
+
+    char buffer[4096] = {0};
+    size_t length = 0;
+
+    ov_sdp_template_values values = test_values();
+
+    ov_sdp_template *template = ov_sdp_template_create(offer_template);
+    testrun(template);
+
+    testrun(-1 == ov_sdp_template_write(NULL, &values, buffer, 4096));
+    testrun(-1 == ov_sdp_template_write(template, NULL, buffer, 4096));
+    testrun(-1 == ov_sdp_template_write(template, &values, NULL, 4096));
+    testrun(-1 == ov_sdp_template_write(template, &values, buffer, 0));
+
+    ssize_t written = ov_sdp_template_write(template, &values, buffer, 4096);
+    testrun(0 < written);
+    testrun((size_t)written == strlen(buffer));
+
+    ov_sdp_view view = {0};
+    testrun(ov_sdp_view_parse(&view, buffer, written));
+    testrun(2 == ov_sdp_view_media_count(&view));
+
+    testrun(12345 == ov_sdp_view_media_port(&view, 0));
+    testrun(0 == ov_sdp_view_media_port(&view, 1));
+
+    const char *value =
+        ov_sdp_view_attribute_get(&view, 0, "ice-ufrag", &length);
+    testrun(value && (4 == length) && (0 == memcmp(value, "9kZ+", 4)));
+
+    value = ov_sdp_view_attribute_get(&view, 1, "fingerprint", &length);
+    testrun(value && (strlen(FINGERPRINT) == length));
+    testrun(0 == memcmp(value, FINGERPRINT, length));
+
+    testrun(strstr(buffer, "a=ssrc:3735928559 cname:openvocs\r\n"
+                           "m=video 0 "));
+    testrun(strstr(buffer, "a=ssrc:1 cname:openvocs\r\n"));
+
+    /* same SDP as accepted by ov_sdp_parse */
+
+    ov_sdp_session *session = ov_sdp_parse(buffer, written);
+    testrun(session);
+    session = ov_sdp_session_free(session);
+
+    /* buffer too small */
+
+    testrun(-1 == ov_sdp_template_write(template, &values, buffer, written));
+    testrun(0 == buffer[0]);
+    testrun(written ==
+            ov_sdp_template_write(template, &values, buffer, written + 1));
+
+    /* values missing or invalid */
+
+    values.ice_pwd = NULL;
+    testrun(-1 == ov_sdp_template_write(template, &values, buffer, 4096));
+
+    values.ice_pwd = "pass\r\nword";
+    testrun(-1 == ov_sdp_template_write(template, &values, buffer, 4096));
+
+    testrun(NULL == ov_sdp_template_free(template));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void write_performance(const char *name, const char *string) {
+
+    const size_t runs = 20000;
+
+    char buffer[4096] = {0};
+    ov_sdp_template_values values = test_values();
+
+    ov_sdp_template *template = ov_sdp_template_create(string);
+    OV_ASSERT(template);
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        values.port[0] = i;
+        ov_sdp_template_write(template, &values, buffer, sizeof(buffer));
+    }
+
+    uint64_t template_usec = ov_time_get_current_time_usecs() - start;
+
+    ov_sdp_session *session = ov_sdp_parse(buffer, strlen(buffer));
+    OV_ASSERT(session);
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_free(ov_sdp_stringify(session, false));
+    }
+
+    uint64_t stringify_usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout,
+            "%s (%zu bytes): ov_sdp_template_write %.0f ns/op, "
+            "ov_sdp_stringify %.0f ns/op\n",
+            name, strlen(buffer), 1000.0 * template_usec / runs,
+            1000.0 * stringify_usec / runs);
+
+    ov_sdp_session_free(session);
+    ov_sdp_template_free(template);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_sdp_template_performance() {
+
+    write_performance("offer", offer_template);
+    write_performance("answer", answer_template);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_sdp_template_create);
+    testrun_test(test_ov_sdp_template_free);
+    testrun_test(test_ov_sdp_template_write);
+    testrun_test(check_sdp_template_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
@@ -0,0 +1,763 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sdp_view.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_sdp_view.h"
+#include "../../include/ov_sdp_grammar.h"
+
+#include <string.h>
+
+/*
+ *      Order of the lines within the session level (RFC 4566 5.)
+ *
+ *      v o s [i] [u] *e *p [c] *b 1*(t *r [z]) [k] *a *(media)
+ *
+ *      and within some media description
+ *
+ *      m [i] *c *b [k] *a
+ */
+
+#define RANK_INVALID -1
+
+#define RANK_S 2
+#define RANK_T 9
+#define RANK_R 10
+#define RANK_Z 11
+
+/*----------------------------------------------------------------------------*/
+
+static int session_rank(char type) {
+
+    switch (type) {
+    case 'v':
+        return 0;
+    case 'o':
+        return 1;
+    case 's':
+        return RANK_S;
+    case 'i':
+        return 3;
+    case 'u':
+        return 4;
+    case 'e':
+        return 5;
+    case 'p':
+        return 6;
+    case 'c':
+        return 7;
+    case 'b':
+        return 8;
+    case 't':
+        return RANK_T;
+    case 'r':
+        return RANK_R;
+    case 'z':
+        return RANK_Z;
+    case 'k':
+        return 12;
+    case 'a':
+        return 13;
+    default:
+        return RANK_INVALID;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int media_rank(char type) {
+
+    switch (type) {
+    case 'm':
+        return 0;
+    case 'i':
+        return 1;
+    case 'c':
+        return 2;
+    case 'b':
+        return 3;
+    case 'k':
+        return 4;
+    case 'a':
+        return 5;
+    default:
+        return RANK_INVALID;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool session_order(int current, char type) {
+
+    int rank = session_rank(type);
+
+    if (RANK_INVALID == rank)
+        return false;
+
+    /* v o s are mandatory and MUST be the first lines */
+
+    if ((rank <= RANK_S) || (current < RANK_S))
+        return rank == current + 1;
+
+    switch (type) {
+
+    case 't':
+        return (current <= RANK_Z);
+
+    case 'r':
+    case 'z':
+        return (current == RANK_T) || (current == RANK_R);
+
+    case 'e':
+    case 'p':
+    case 'b':
+    case 'a':
+        if (rank == current)
+            return true;
+        break;
+
+    default:
+        break;
+    }
+
+    if (rank <= current)
+        return false;
+
+    /* anything after the time MUST NOT skip the time */
+
+    if (rank > RANK_Z)
+        return current >= RANK_T;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool media_order(int current, char type) {
+
+    int rank = media_rank(type);
+
+    if (RANK_INVALID == rank)
+        return false;
+
+    switch (type) {
+
+    case 'c':
+    case 'b':
+    case 'a':
+        return rank >= current;
+
+    default:
+        return rank > current;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static const char *next_field(const char **ptr, const char *end,
+                              size_t *length) {
+
+    const char *start = *ptr;
+
+    if (start >= end)
+        return NULL;
+
+    const char *space = memchr(start, ' ', end - start);
+    if (!space)
+        space = end;
+
+    *length = space - start;
+    *ptr = (space == end) ? end : space + 1;
+
+    /* empty fields e.g. double spaces are not allowed */
+    if (0 == *length)
+        return NULL;
+
+    return start;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_connection(const char *ptr, const char *end) {
+
+    /* nettype SP addrtype SP connection-address */
+
+    size_t len = 0;
+    const char *field = next_field(&ptr, end, &len);
+
+    if (!field || !ov_sdp_is_token(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field || !ov_sdp_is_token(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field || !ov_sdp_is_address(field, len))
+        return false;
+
+    return ptr == end;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_origin(const char *ptr, const char *end) {
+
+    /* username SP sess-id SP sess-version SP nettype SP addrtype SP address */
+
+    size_t len = 0;
+    const char *field = next_field(&ptr, end, &len);
+
+    if (!field || !ov_sdp_is_username(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field || !ov_sdp_is_digit(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field || !ov_sdp_is_digit(field, len))
+        return false;
+
+    return validate_connection(ptr, end);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_time(const char *ptr, const char *end) {
+
+    /* start-time SP stop-time */
+
+    size_t len = 0;
+    const char *field = next_field(&ptr, end, &len);
+
+    if (!field || !ov_sdp_is_time(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field || !ov_sdp_is_time(field, len))
+        return false;
+
+    return ptr == end;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_repeat(const char *ptr, const char *end) {
+
+    /* repeat-interval SP typed-time 1*(SP typed-time) */
+
+    size_t len = 0;
+    size_t count = 0;
+
+    while (ptr < end) {
+
+        const char *field = next_field(&ptr, end, &len);
+        if (!field || !ov_sdp_is_typed_time(field, len, false))
+            return false;
+
+        ++count;
+    }
+
+    return count >= 3;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_zone(const char *ptr, const char *end) {
+
+    /* time SP ["-"] typed-time *(SP time SP ["-"] typed-time) */
+
+    size_t len = 0;
+    size_t count = 0;
+
+    while (ptr < end) {
+
+        const char *field = next_field(&ptr, end, &len);
+        if (!field || !ov_sdp_is_typed_time(field, len, 1 == count % 2))
+            return false;
+
+        ++count;
+    }
+
+    return (count > 0) && (0 == count % 2);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_attribute(const char *ptr, const char *end) {
+
+    /* (att-field ":" att-value) / att-field */
+
+    const char *colon = memchr(ptr, ':', end - ptr);
+
+    if (!colon)
+        return ov_sdp_is_token(ptr, end - ptr);
+
+    if (!ov_sdp_is_token(ptr, colon - ptr))
+        return false;
+
+    return ov_sdp_is_byte_string(colon + 1, end - colon - 1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_port(const char *ptr, size_t length) {
+
+    /* unlike ov_sdp_is_port 0 is allowed e.g. for rejected media */
+
+    if ((0 == length) || (5 < length))
+        return false;
+
+    uint32_t port = 0;
+
+    for (size_t i = 0; i < length; ++i) {
+
+        if ((ptr[i] < '0') || (ptr[i] > '9'))
+            return false;
+
+        port = port * 10 + (ptr[i] - '0');
+    }
+
+    return port <= UINT16_MAX;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_proto(const char *ptr, size_t length) {
+
+    /* token *("/" token), same as ov_sdp_is_proto without a list */
+
+    const char *end = ptr + length;
+
+    while (ptr < end) {
+
+        const char *slash = memchr(ptr, '/', end - ptr);
+        if (!slash)
+            slash = end;
+
+        if (!ov_sdp_is_token(ptr, slash - ptr))
+            return false;
+
+        if ((slash < end) && (slash + 1 == end))
+            return false;
+
+        ptr = slash + 1;
+    }
+
+    return length > 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_media(const char *ptr, const char *end) {
+
+    /* media SP port ["/" integer] SP proto 1*(SP fmt) */
+
+    size_t len = 0;
+    const char *field = next_field(&ptr, end, &len);
+
+    if (!field || !ov_sdp_is_token(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field)
+        return false;
+
+    const char *slash = memchr(field, '/', len);
+
+    if (slash) {
+
+        if (!ov_sdp_is_integer(slash + 1, len - (slash + 1 - field)))
+            return false;
+
+        len = slash - field;
+    }
+
+    if (!validate_port(field, len))
+        return false;
+
+    field = next_field(&ptr, end, &len);
+    if (!field || !validate_proto(field, len))
+        return false;
+
+    size_t formats = 0;
+
+    while (ptr < end) {
+
+        field = next_field(&ptr, end, &len);
+        if (!field || !ov_sdp_is_token(field, len))
+            return false;
+
+        ++formats;
+    }
+
+    return formats > 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool validate_content(char type, const char *ptr, size_t length) {
+
+    const char *end = ptr + length;
+
+    if (0 == length)
+        return false;
+
+    switch (type) {
+
+    case 'v':
+        return (1 == length) && ('0' == ptr[0]);
+
+    case 'o':
+        return validate_origin(ptr, end);
+
+    case 's':
+    case 'i':
+        return ov_sdp_is_text(ptr, length);
+
+    case 'u':
+        return true;
+
+    case 'e':
+        return ov_sdp_is_email(ptr, length);
+
+    case 'p':
+        return ov_sdp_is_phone(ptr, length);
+
+    case 'c':
+        return validate_connection(ptr, end);
+
+    case 'b':
+        return ov_sdp_is_bandwidth(ptr, length);
+
+    case 't':
+        return validate_time(ptr, end);
+
+    case 'r':
+        return validate_repeat(ptr, end);
+
+    case 'z':
+        return validate_zone(ptr, end);
+
+    case 'k':
+        return ov_sdp_is_key(ptr, length);
+
+    case 'a':
+        return validate_attribute(ptr, end);
+
+    case 'm':
+        return validate_media(ptr, end);
+
+    default:
+        return false;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_sdp_view_parse(ov_sdp_view *self, const char *data, size_t length) {
+
+    if (!self)
+        goto error;
+
+    /* the line arrays are overwritten while parsing */
+
+    self->data = NULL;
+    self->length = 0;
+    self->num_lines = 0;
+    self->num_media = 0;
+
+    if (!data || (UINT32_MAX < length))
+        goto error;
+
+    const char *ptr = data;
+    const char *end = data + length;
+
+    int session = RANK_INVALID;
+    int media = RANK_INVALID;
+
+    while (ptr < end) {
+
+        const char *lf = memchr(ptr, '\n', end - ptr);
+
+        if (!lf || (lf - ptr < 3) || ('\r' != lf[-1]) || ('=' != ptr[1]))
+            goto error;
+
+        char type = ptr[0];
+
+        if ('m' == type) {
+
+            if ((session < RANK_T) ||
+                (OV_SDP_VIEW_MEDIA_MAX == self->num_media))
+                goto error;
+
+            self->media[self->num_media++] = self->num_lines;
+            media = media_rank(type);
+
+        } else if (0 < self->num_media) {
+
+            if (!media_order(media, type))
+                goto error;
+
+            media = media_rank(type);
+
+        } else {
+
+            if (!session_order(session, type))
+                goto error;
+
+            session = session_rank(type);
+        }
+
+        size_t content = ptr + 2 - data;
+        size_t content_length = lf - 1 - (ptr + 2);
+
+        if (!validate_content(type, ptr + 2, content_length))
+            goto error;
+
+        if (OV_SDP_VIEW_LINES_MAX == self->num_lines)
+            goto error;
+
+        self->lines[self->num_lines++] = (ov_sdp_view_line){
+            .type = type,
+            .offset = content,
+            .length = content_length,
+        };
+
+        ptr = lf + 1;
+    }
+
+    if (session < RANK_T)
+        goto error;
+
+    self->data = data;
+    self->length = length;
+
+    return true;
+error:
+    if (self) {
+        self->num_lines = 0;
+        self->num_media = 0;
+    }
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool section_range(const ov_sdp_view *self, size_t section,
+                          size_t *first, size_t *end) {
+
+    if (!self || !self->data)
+        return false;
+
+    if (OV_SDP_VIEW_SESSION == section) {
+
+        *first = 0;
+        *end = (0 == self->num_media) ? self->num_lines : self->media[0];
+        return true;
+    }
+
+    if (section >= self->num_media)
+        return false;
+
+    *first = self->media[section];
+    *end = (section + 1 == self->num_media) ? self->num_lines
+                                            : self->media[section + 1];
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_sdp_view_media_count(const ov_sdp_view *self) {
+
+    if (!self || !self->data)
+        return 0;
+
+    return self->num_media;
+}
+
+/*----------------------------------------------------------------------------*/
+
+const char *ov_sdp_view_line_get(const ov_sdp_view *self, size_t section,
+                                 char type, size_t *length) {
+
+    size_t first = 0;
+    size_t end = 0;
+
+    if (!length || !section_range(self, section, &first, &end))
+        goto error;
+
+    for (size_t i = first; i < end; ++i) {
+
+        if (type != self->lines[i].type)
+            continue;
+
+        *length = self->lines[i].length;
+        return self->data + self->lines[i].offset;
+    }
+
+error:
+    if (length)
+        *length = 0;
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool attribute_split(const ov_sdp_view *self, size_t line,
+                            const char **name, size_t *name_length,
+                            const char **value, size_t *value_length) {
+
+    const char *ptr = self->data + self->lines[line].offset;
+    size_t len = self->lines[line].length;
+
+    const char *colon = memchr(ptr, ':', len);
+
+    *name = ptr;
+
+    if (!colon) {
+
+        *name_length = len;
+        *value = ptr + len;
+        *value_length = 0;
+
+    } else {
+
+        *name_length = colon - ptr;
+        *value = colon + 1;
+        *value_length = len - *name_length - 1;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_sdp_view_attribute_next(const ov_sdp_view *self, size_t section,
+                                size_t *pos, const char **name,
+                                size_t *name_length, const char **value,
+                                size_t *value_length) {
+
+    size_t first = 0;
+    size_t end = 0;
+
+    if (!pos || !name || !name_length || !value || !value_length)
+        return false;
+
+    if (!section_range(self, section, &first, &end))
+        return false;
+
+    for (size_t i = first + *pos; i < end; ++i) {
+
+        if ('a' != self->lines[i].type)
+            continue;
+
+        *pos = i - first + 1;
+        return attribute_split(self, i, name, name_length, value,
+                               value_length);
+    }
+
+    *pos = end - first;
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+const char *ov_sdp_view_attribute_get(const ov_sdp_view *self, size_t section,
+                                      const char *name, size_t *length) {
+
+    size_t pos = 0;
+
+    const char *key = NULL;
+    const char *value = NULL;
+    size_t key_length = 0;
+
+    if (!name || !length)
+        goto error;
+
+    size_t name_length = strlen(name);
+
+    while (ov_sdp_view_attribute_next(self, section, &pos, &key, &key_length,
+                                      &value, length)) {
+
+        if ((key_length == name_length) && (0 == memcmp(key, name, key_length)))
+            return value;
+    }
+
+error:
+    if (length)
+        *length = 0;
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+const char *ov_sdp_view_media_type(const ov_sdp_view *self, size_t index,
+                                   size_t *length) {
+
+    if (!length)
+        return NULL;
+
+    const char *media = ov_sdp_view_line_get(self, index, 'm', length);
+
+    if (!media || (OV_SDP_VIEW_SESSION == index))
+        goto error;
+
+    const char *space = memchr(media, ' ', *length);
+    if (!space)
+        goto error;
+
+    *length = space - media;
+    return media;
+
+error:
+    *length = 0;
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint16_t ov_sdp_view_media_port(const ov_sdp_view *self, size_t index) {
+
+    size_t length = 0;
+    const char *media = ov_sdp_view_media_type(self, index, &length);
+
+    if (!media)
+        return 0;
+
+    /* port is validated while parsing */
+
+    uint32_t port = 0;
+
+    for (const char *ptr = media + length + 1;
+         (*ptr >= '0') && (*ptr <= '9'); ++ptr) {
+        port = port * 10 + (*ptr - '0');
+    }
+
+    return port;
+}
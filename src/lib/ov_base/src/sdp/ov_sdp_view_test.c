@@ -0,0 +1,582 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sdp_view_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_sdp_view.c"
+
+#include "../../include/ov_sdp.h"
+#include "../../include/ov_time.h"
+#include <ov_test/testrun.h>
+
+/*****************************************************************************
+                                    HELPERS
+ ****************************************************************************/
+
+/* offer of some browser for audio and video */
+
+static const char *browser_offer =
+    "v=0\r\n"
+    "o=- 4611731400430051336 2 IN IP4 127.0.0.1\r\n"
+    "s=-\r\n"
+    "t=0 0\r\n"
+    "a=group:BUNDLE 0 1\r\n"
+    "a=extmap-allow-mixed\r\n"
+    "a=msid-semantic: WMS 7b5a3ccb-b4c0-4a3e-a5b9-6e1f0d2c9a11\r\n"
+    "m=audio 9 UDP/TLS/RTP/SAVPF 111 63 9 0 8 13 110 126\r\n"
+    "c=IN IP4 0.0.0.0\r\n"
+    "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+    "a=candidate:1467250027 1 udp 2122260223 192.168.0.196 46243 typ host "
+    "generation 0 network-id 1\r\n"
+    "a=candidate:435653019 1 tcp 1845501695 192.168.0.196 9 typ host "
+    "tcptype active generation 0 network-id 1\r\n"
+    "a=ice-ufrag:9kZ+\r\n"
+    "a=ice-pwd:D5jV4b0qQ0mQpwKcC4W8lWj6\r\n"
+    "a=ice-options:trickle\r\n"
+    "a=fingerprint:sha-256 "
+    "7B:8B:F0:65:5F:78:E2:51:3B:AC:6F:F3:3F:46:1B:35:"
+    "DC:B8:5F:64:1A:24:C2:43:F0:A1:58:D0:A1:2C:19:08\r\n"
+    "a=setup:actpass\r\n"
+    "a=mid:0\r\n"
+    "a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+    "a=extmap:2 http://www.webrtc.org/experiments/rtp-hdrext/abs-send-time\r\n"
+    "a=extmap:3 urn:ietf:params:rtp-hdrext:sdes:mid\r\n"
+    "a=sendrecv\r\n"
+    "a=msid:7b5a3ccb-b4c0-4a3e-a5b9-6e1f0d2c9a11 "
+    "0c4a3d41-2f5e-4b11-9d3a-5f6e7a8b9c0d\r\n"
+    "a=rtcp-mux\r\n"
+    "a=rtpmap:111 opus/48000/2\r\n"
+    "a=rtcp-fb:111 transport-cc\r\n"
+    "a=fmtp:111 minptime=10;useinbandfec=1\r\n"
+    "a=rtpmap:63 red/48000/2\r\n"
+    "a=fmtp:63 111/111\r\n"
+    "a=rtpmap:9 G722/8000\r\n"
+    "a=rtpmap:0 PCMU/8000\r\n"
+    "a=rtpmap:8 PCMA/8000\r\n"
+    "a=rtpmap:13 CN/8000\r\n"
+    "a=rtpmap:110 telephone-event/48000\r\n"
+    "a=rtpmap:126 telephone-event/8000\r\n"
+    "a=ssrc:3735928559 cname:Yq3CkMGzQ7mBv1cN\r\n"
+    "a=ssrc:3735928559 msid:7b5a3ccb-b4c0-4a3e-a5b9-6e1f0d2c9a11 "
+    "0c4a3d41-2f5e-4b11-9d3a-5f6e7a8b9c0d\r\n"
+    "m=video 9 UDP/TLS/RTP/SAVPF 96 97 102 103\r\n"
+    "c=IN IP4 0.0.0.0\r\n"
+    "a=rtcp:9 IN IP4 0.0.0.0\r\n"
+    "a=ice-ufrag:9kZ+\r\n"
+    "a=ice-pwd:D5jV4b0qQ0mQpwKcC4W8lWj6\r\n"
+    "a=ice-options:trickle\r\n"
+    "a=fingerprint:sha-256 "
+    "7B:8B:F0:65:5F:78:E2:51:3B:AC:6F:F3:3F:46:1B:35:"
+    "DC:B8:5F:64:1A:24:C2:43:F0:A1:58:D0:A1:2C:19:08\r\n"
+    "a=setup:actpass\r\n"
+    "a=mid:1\r\n"
+    "a=extmap:14 urn:ietf:params:rtp-hdrext:toffset\r\n"
+    "a=extmap:13 urn:3gpp:video-orientation\r\n"
+    "a=sendrecv\r\n"
+    "a=rtcp-mux\r\n"
+    "a=rtcp-rsize\r\n"
+    "a=rtpmap:96 VP8/90000\r\n"
+    "a=rtcp-fb:96 goog-remb\r\n"
+    "a=rtcp-fb:96 transport-cc\r\n"
+    "a=rtcp-fb:96 ccm fir\r\n"
+    "a=rtcp-fb:96 nack\r\n"
+    "a=rtcp-fb:96 nack pli\r\n"
+    "a=rtpmap:97 rtx/90000\r\n"
+    "a=fmtp:97 apt=96\r\n"
+    "a=rtpmap:102 H264/90000\r\n"
+    "a=fmtp:102 level-asymmetry-allowed=1;packetization-mode=1;"
+    "profile-level-id=42001f\r\n"
+    "a=rtpmap:103 rtx/90000\r\n"
+    "a=fmtp:103 apt=102\r\n"
+    "a=ssrc-group:FID 1509943390 2897135210\r\n"
+    "a=ssrc:1509943390 cname:Yq3CkMGzQ7mBv1cN\r\n"
+    "a=ssrc:2897135210 cname:Yq3CkMGzQ7mBv1cN\r\n";
+
+/* answer of some browser for audio only */
+
+static const char *browser_answer =
+    "v=0\r\n"
+    "o=mozilla...THIS_IS_SDPARTA-99.0 6150532431465362389 0 IN IP4 0.0.0.0\r\n"
+    "s=-\r\n"
+    "t=0 0\r\n"
+    "a=fingerprint:sha-256 "
+    "2C:9B:52:0B:45:05:5E:87:7C:97:D3:B0:C6:1C:50:6A:"
+    "55:43:92:8C:9C:27:2F:BC:53:43:0A:1E:1F:7A:4D:53\r\n"
+    "a=group:BUNDLE 0\r\n"
+    "a=ice-options:trickle\r\n"
+    "a=msid-semantic:WMS *\r\n"
+    "m=audio 9 UDP/TLS/RTP/SAVPF 111\r\n"
+    "c=IN IP4 0.0.0.0\r\n"
+    "a=sendrecv\r\n"
+    "a=extmap:1 urn:ietf:params:rtp-hdrext:ssrc-audio-level\r\n"
+    "a=extmap:3 urn:ietf:params:rtp-hdrext:sdes:mid\r\n"
+    "a=fmtp:111 maxplaybackrate=48000;stereo=1;useinbandfec=1\r\n"
+    "a=ice-pwd:0bb09be0b1db5f9c4e4b8a5a0c3e1f2d\r\n"
+    "a=ice-ufrag:6b3f1c2a\r\n"
+    "a=mid:0\r\n"
+    "a=msid:{4e8b6b2e-5d8c-4c4f-9a1b-2f3e4d5c6b7a} "
+    "{a1b2c3d4-e5f6-4a7b-8c9d-0e1f2a3b4c5d}\r\n"
+    "a=rtcp-mux\r\n"
+    "a=rtpmap:111 opus/48000/2\r\n"
+    "a=setup:active\r\n"
+    "a=ssrc:2443419183 cname:{0a1b2c3d-4e5f-4a6b-8c7d-9e0f1a2b3c4d}\r\n";
+
+/*----------------------------------------------------------------------------*/
+
+static bool view_valid(const char *sdp) {
+
+    ov_sdp_view view = {0};
+    return ov_sdp_view_parse(&view, sdp, strlen(sdp));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool content_is(const char *content, size_t length,
+                       const char *expected) {
+
+    if (!content)
+        return false;
+
+    return (length == strlen(expected)) &&
+           (0 == memcmp(content, expected, length));
+}
+
+/*****************************************************************************
+                                     TESTS
+ ****************************************************************************/
+
+int test_ov_sdp_view_parse() {
+
+    ov_sdp_view view = {0};
+
+    testrun(!ov_sdp_view_parse(NULL, browser_offer, strlen(browser_offer)));
+    testrun(!ov_sdp_view_parse(&view, NULL, 10));
+    testrun(!ov_sdp_view_parse(&view, browser_offer, 0));
+
+    testrun(ov_sdp_view_parse(&view, browser_offer, strlen(browser_offer)));
+    testrun(view.data == browser_offer);
+    testrun(2 == view.num_media);
+
+    testrun(ov_sdp_view_parse(&view, browser_answer, strlen(browser_answer)));
+    testrun(1 == view.num_media);
+
+    /* same SDP as accepted by ov_sdp_parse */
+
+    ov_sdp_session *session =
+        ov_sdp_parse(browser_offer, strlen(browser_offer));
+    testrun(session);
+    session = ov_sdp_session_free(session);
+
+    /* session level only */
+
+    testrun(view_valid("v=0\r\n"
+                       "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                       "s=-\r\n"
+                       "t=0 0\r\n"));
+
+    testrun(view_valid("v=0\r\n"
+                       "o=name 1 2 IN IP6 ::1\r\n"
+                       "s=session\r\n"
+                       "i=information\r\n"
+                       "u=http://openvocs.org\r\n"
+                       "e=j.doe@example.com\r\n"
+                       "p=+1 617 555-6011\r\n"
+                       "c=IN IP4 224.2.17.12/127\r\n"
+                       "b=AS:128\r\n"
+                       "t=2873397496 2873404696\r\n"
+                       "r=7d 1h 0 25h\r\n"
+                       "t=0 0\r\n"
+                       "z=2882844526 -1h 2898848070 0\r\n"
+                       "k=prompt\r\n"
+                       "a=recvonly\r\n"
+                       "m=audio 49170/2 RTP/AVP 0\r\n"
+                       "i=media\r\n"
+                       "c=IN IP4 224.2.17.12/127\r\n"
+                       "c=IN IP4 224.2.17.13/127\r\n"
+                       "b=AS:64\r\n"
+                       "k=prompt\r\n"
+                       "a=rtpmap:0 PCMU/8000\r\n"));
+
+    /* mandatory lines missing */
+
+    testrun(!view_valid("o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "t=0 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "m=audio 9 RTP/AVP 0\r\n"));
+
+    /* wrong order */
+
+    testrun(!view_valid("v=0\r\n"
+                        "s=-\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "t=0 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "c=IN IP4 0.0.0.0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "i=info\r\n"
+                        "i=info\r\n"
+                        "t=0 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "m=audio 9 RTP/AVP 0\r\n"
+                        "a=sendrecv\r\n"
+                        "c=IN IP4 0.0.0.0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "m=audio 9 RTP/AVP 0\r\n"
+                        "t=0 0\r\n"));
+
+    /* line format */
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "a=sendrecv"));
+
+    testrun(!view_valid("v=1\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0  0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "m=audio 9 RTP/AVP\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "m=audio 123456 RTP/AVP 0\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "x=unknown\r\n"));
+
+    testrun(!view_valid("v=0\r\n"
+                        "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                        "s=-\r\n"
+                        "t=0 0\r\n"
+                        "a=\r\n"));
+
+    /* a failed parse resets the view */
+
+    testrun(ov_sdp_view_parse(&view, browser_offer, strlen(browser_offer)));
+    testrun(!ov_sdp_view_parse(&view, browser_offer, 20));
+    testrun(0 == ov_sdp_view_media_count(&view));
+    testrun(NULL == view.data);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_sdp_view_line_get() {
+
+    ov_sdp_view view = {0};
+    size_t length = 0;
+
+    testrun(NULL == ov_sdp_view_line_get(&view, OV_SDP_VIEW_SESSION, 'o',
+                                         &length));
+
+    testrun(ov_sdp_view_parse(&view, browser_offer, strlen(browser_offer)));
+
+    testrun(NULL == ov_sdp_view_line_get(NULL, OV_SDP_VIEW_SESSION, 'o',
+                                         &length));
+    testrun(NULL == ov_sdp_view_line_get(&view, OV_SDP_VIEW_SESSION, 'o',
+                                         NULL));
+
+    const char *content =
+        ov_sdp_view_line_get(&view, OV_SDP_VIEW_SESSION, 'o', &length);
+
+    testrun(content_is(content, length,
+                       "- 4611731400430051336 2 IN IP4 127.0.0.1"));
+
+    /* lines of media descriptions are not part of the session level */
+
+    testrun(NULL == ov_sdp_view_line_get(&view, OV_SDP_VIEW_SESSION, 'c',
+                                         &length));
+    testrun(0 == length);
+
+    content = ov_sdp_view_line_get(&view, 0, 'c', &length);
+    testrun(content_is(content, length, "IN IP4 0.0.0.0"));
+
+    content = ov_sdp_view_line_get(&view, 1, 'm', &length);
+    testrun(content_is(content, length,
+                       "video 9 UDP/TLS/RTP/SAVPF 96 97 102 103"));
+
+    testrun(NULL == ov_sdp_view_line_get(&view, 2, 'm', &length));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_sdp_view_attribute_get() {
+
+    ov_sdp_view view = {0};
+    size_t length = 0;
+
+    testrun(ov_sdp_view_parse(&view, browser_answer, strlen(browser_answer)));
+
+    testrun(NULL == ov_sdp_view_attribute_get(NULL, 0, "mid", &length));
+    testrun(NULL == ov_sdp_view_attribute_get(&view, 0, NULL, &length));
+    testrun(NULL == ov_sdp_view_attribute_get(&view, 0, "mid", NULL));
+
+    const char *value =
+        ov_sdp_view_attribute_get(&view, 0, "ice-ufrag", &length);
+    testrun(content_is(value, length, "6b3f1c2a"));
+
+    value = ov_sdp_view_attribute_get(&view, 0, "ice-pwd", &length);
+    testrun(content_is(value, length, "0bb09be0b1db5f9c4e4b8a5a0c3e1f2d"));
+
+    value = ov_sdp_view_attribute_get(&view, OV_SDP_VIEW_SESSION,
+                                      "fingerprint", &length);
+    testrun(content_is(value, length,
+                       "sha-256 "
+                       "2C:9B:52:0B:45:05:5E:87:7C:97:D3:B0:C6:1C:50:6A:"
+                       "55:43:92:8C:9C:27:2F:BC:53:43:0A:1E:1F:7A:4D:53"));
+
+    /* no inheritance */
+
+    testrun(NULL == ov_sdp_view_attribute_get(&view, 0, "fingerprint",
+                                              &length));
+
+    /* flags */
+
+    value = ov_sdp_view_attribute_get(&view, 0, "rtcp-mux", &length);
+    testrun(value);
+    testrun(0 == length);
+
+    /* prefix of some other attribute */
+
+    testrun(NULL == ov_sdp_view_attribute_get(&view, 0, "rtcp", &length));
+    testrun(NULL == ov_sdp_view_attribute_get(&view, 1, "mid", &length));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_sdp_view_attribute_next() {
+
+    ov_sdp_view view = {0};
+
+    const char *name = NULL;
+    const char *value = NULL;
+    size_t name_length = 0;
+    size_t value_length = 0;
+    size_t pos = 0;
+
+    testrun(ov_sdp_view_parse(&view, browser_offer, strlen(browser_offer)));
+
+    testrun(!ov_sdp_view_attribute_next(&view, 0, NULL, &name, &name_length,
+                                        &value, &value_length));
+
+    size_t candidates = 0;
+    size_t attributes = 0;
+
+    while (ov_sdp_view_attribute_next(&view, 0, &pos, &name, &name_length,
+                                      &value, &value_length)) {
+
+        ++attributes;
+
+        if (content_is(name, name_length, "candidate"))
+            ++candidates;
+    }
+
+    testrun(28 == attributes);
+    testrun(2 == candidates);
+
+    /* exhausted */
+
+    testrun(!ov_sdp_view_attribute_next(&view, 0, &pos, &name, &name_length,
+                                        &value, &value_length));
+
+    pos = 0;
+    testrun(ov_sdp_view_attribute_next(&view, OV_SDP_VIEW_SESSION, &pos,
+                                       &name, &name_length, &value,
+                                       &value_length));
+    testrun(content_is(name, name_length, "group"));
+    testrun(content_is(value, value_length, "BUNDLE 0 1"));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_sdp_view_media() {
+
+    ov_sdp_view view = {0};
+    size_t length = 0;
+
+    testrun(0 == ov_sdp_view_media_count(NULL));
+    testrun(0 == ov_sdp_view_media_count(&view));
+    testrun(NULL == ov_sdp_view_media_type(&view, 0, &length));
+    testrun(0 == ov_sdp_view_media_port(&view, 0));
+
+    const char *sdp = "v=0\r\n"
+                      "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                      "s=-\r\n"
+                      "t=0 0\r\n"
+                      "m=audio 65535 RTP/AVP 0\r\n"
+                      "m=video 49170/2 RTP/AVP 31\r\n"
+                      "m=application 0 UDP/DTLS/SCTP webrtc-datachannel\r\n";
+
+    testrun(ov_sdp_view_parse(&view, sdp, strlen(sdp)));
+    testrun(3 == ov_sdp_view_media_count(&view));
+
+    const char *type = ov_sdp_view_media_type(&view, 0, &length);
+    testrun(content_is(type, length, "audio"));
+    testrun(65535 == ov_sdp_view_media_port(&view, 0));
+
+    type = ov_sdp_view_media_type(&view, 1, &length);
+    testrun(content_is(type, length, "video"));
+    testrun(49170 == ov_sdp_view_media_port(&view, 1));
+
+    type = ov_sdp_view_media_type(&view, 2, &length);
+    testrun(content_is(type, length, "application"));
+    testrun(0 == ov_sdp_view_media_port(&view, 2));
+
+    testrun(NULL == ov_sdp_view_media_type(&view, 3, &length));
+    testrun(NULL == ov_sdp_view_media_type(&view, OV_SDP_VIEW_SESSION,
+                                           &length));
+    testrun(0 == ov_sdp_view_media_port(&view, 3));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void parse_performance(const char *name, const char *sdp) {
+
+    const size_t runs = 20000;
+
+    size_t length = strlen(sdp);
+    ov_sdp_view view = {0};
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_sdp_view_parse(&view, sdp, length);
+    }
+
+    uint64_t view_usec = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_sdp_session_free(ov_sdp_parse(sdp, length));
+    }
+
+    uint64_t parse_usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout,
+            "%s (%zu bytes): ov_sdp_view_parse %.0f ns/op, "
+            "ov_sdp_parse %.0f ns/op\n",
+            name, length, 1000.0 * view_usec / runs,
+            1000.0 * parse_usec / runs);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_sdp_view_performance() {
+
+    parse_performance("offer", browser_offer);
+    parse_performance("answer", browser_answer);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_sdp_view_parse);
+    testrun_test(test_ov_sdp_view_line_get);
+    testrun_test(test_ov_sdp_view_attribute_get);
+    testrun_test(test_ov_sdp_view_attribute_next);
+    testrun_test(test_ov_sdp_view_media);
+    testrun_test(check_sdp_view_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
@@ -0,0 +1,638 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_loop_bus.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../../include/ov_loop_bus.h"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "../../include/ov_json.h"
+#include "../../include/ov_shm.h"
+#include "../../include/ov_utils.h"
+
+#define OV_LOOP_BUS_MAGIC_BYTES 0x6c62
+#define OV_LOOP_BUS_SHM_MAGIC 0x6f766c62
+#define OV_LOOP_BUS_SHM_PREFIX "/openvocs_loop_"
+
+#define SLOTS_MAX 65536
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    /* 2 * position + 1 while written, 2 * position + 2 once written */
+    _Atomic uint64_t sequence;
+
+    uint32_t length;
+    uint8_t data[OV_LOOP_BUS_PAYLOAD_MAX];
+
+} Slot;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    _Atomic int32_t pid; // 0 if unused
+    _Atomic uint32_t sleeping;
+
+} Subscriber;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    ov_shm_header header;
+
+    _Atomic uint64_t head; // next position to publish
+
+    Subscriber subscriber[OV_LOOP_BUS_SUBSCRIBERS_MAX];
+
+    Slot slot[];
+
+} Ring;
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_loop_bus {
+
+    uint16_t magic_bytes;
+    ov_loop_bus_config config;
+
+    uint64_t mask;
+
+    Ring *ring;
+    size_t size;
+
+    /* unbound, used to ring doorbells */
+    int publisher;
+
+    struct {
+
+        int socket;
+        Subscriber *entry;
+        uint64_t next;
+
+        uint8_t buffer[OV_LOOP_BUS_PAYLOAD_MAX];
+
+    } subscriber;
+
+    /* publishing is thread safe */
+    _Atomic uint64_t published;
+
+    ov_loop_bus_stats stats;
+};
+
+/*----------------------------------------------------------------------------*/
+
+ov_loop_bus *ov_loop_bus_cast(const void *data) {
+
+    if (!data)
+        return NULL;
+
+    if (*(uint16_t *)data != OV_LOOP_BUS_MAGIC_BYTES)
+        return NULL;
+
+    return (ov_loop_bus *)data;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool shm_name(const char *loop, char *out, size_t size) {
+
+    int bytes = snprintf(out, size, "%s%s", OV_LOOP_BUS_SHM_PREFIX, loop);
+
+    if ((bytes < 0) || ((size_t)bytes >= size))
+        return false;
+
+    /* shared memory names must not contain further slashes */
+
+    for (char *ptr = out + 1; *ptr; ++ptr) {
+
+        if ('/' == *ptr)
+            *ptr = '_';
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static socklen_t doorbell_address(const ov_loop_bus *self, size_t index,
+                                  struct sockaddr_un *address) {
+
+    memset(address, 0, sizeof(struct sockaddr_un));
+    address->sun_family = AF_UNIX;
+
+    /* abstract namespace, sun_path[0] stays 0 */
+
+    int bytes = snprintf(address->sun_path + 1, sizeof(address->sun_path) - 1,
+                         "openvocs/loop_bus/%s/%zu", self->config.name, index);
+
+    if ((bytes < 0) || ((size_t)bytes >= sizeof(address->sun_path) - 1))
+        return 0;
+
+    return offsetof(struct sockaddr_un, sun_path) + 1 + bytes;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool process_alive(int32_t pid) {
+
+    if (0 == kill(pid, 0))
+        return true;
+
+    return ESRCH != errno;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool doorbell_io(int socket, uint8_t events, void *userdata) {
+
+    UNUSED(socket);
+
+    ov_loop_bus *self = ov_loop_bus_cast(userdata);
+    if (!self)
+        goto error;
+
+    if (events & OV_EVENT_IO_CLOSE) {
+
+        ov_log_error("Loop bus: doorbell of %s closed", self->config.name);
+        goto error;
+    }
+
+    self->stats.wakeups++;
+    ov_loop_bus_receive(self);
+
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool subscribe(ov_loop_bus *self) {
+
+    int32_t pid = getpid();
+
+    for (size_t i = 0; i < OV_LOOP_BUS_SUBSCRIBERS_MAX; ++i) {
+
+        Subscriber *entry = &self->ring->subscriber[i];
+
+        int32_t owner = atomic_load(&entry->pid);
+
+        /* entries of crashed processes are reused */
+
+        if ((0 != owner) && process_alive(owner))
+            continue;
+
+        if (!atomic_compare_exchange_strong(&entry->pid, &owner, pid))
+            continue;
+
+        struct sockaddr_un address;
+        socklen_t length = doorbell_address(self, i, &address);
+
+        if (0 == length)
+            goto release;
+
+        self->subscriber.socket =
+            socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        if (-1 == self->subscriber.socket)
+            goto release;
+
+        if (0 != bind(self->subscriber.socket, (struct sockaddr *)&address,
+                      length)) {
+
+            ov_log_error("Loop bus: failed to bind doorbell of %s - %s",
+                         self->config.name, strerror(errno));
+
+            close(self->subscriber.socket);
+            self->subscriber.socket = -1;
+            goto release;
+        }
+
+        self->subscriber.entry = entry;
+        self->subscriber.next = atomic_load(&self->ring->head);
+
+        atomic_store(&entry->sleeping, 1);
+        return true;
+
+    release:
+        atomic_store(&entry->pid, 0);
+        return false;
+    }
+
+    ov_log_error("Loop bus: no free subscriber entry at %s",
+                 self->config.name);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_loop_bus *ov_loop_bus_create(ov_loop_bus_config config) {
+
+    ov_loop_bus *self = NULL;
+    char name[OV_LOOP_BUS_NAME_MAX + sizeof(OV_LOOP_BUS_SHM_PREFIX)] = {0};
+
+    config.name[OV_LOOP_BUS_NAME_MAX - 1] = 0;
+
+    if (0 == config.name[0])
+        goto error;
+
+    if (config.callback.io && !config.loop)
+        goto error;
+
+    if (0 == config.slots)
+        config.slots = OV_LOOP_BUS_SLOTS_DEFAULT;
+
+    size_t slots = 1;
+
+    while ((slots < config.slots) && (slots < SLOTS_MAX)) {
+        slots <<= 1;
+    }
+
+    config.slots = slots;
+
+    if (!shm_name(config.name, name, sizeof(name)))
+        goto error;
+
+    self = calloc(1, sizeof(ov_loop_bus));
+    if (!self)
+        goto error;
+
+    self->magic_bytes = OV_LOOP_BUS_MAGIC_BYTES;
+    self->config = config;
+    self->mask = slots - 1;
+    self->size = sizeof(Ring) + slots * sizeof(Slot);
+    self->subscriber.socket = -1;
+
+    self->publisher = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (-1 == self->publisher)
+        goto error;
+
+    self->ring = ov_shm_map(name, self->size);
+    if (!self->ring) {
+        ov_log_error("Loop bus: failed to map %s", name);
+        goto error;
+    }
+
+    if (!ov_shm_header_init(&self->ring->header, OV_LOOP_BUS_SHM_MAGIC, slots,
+                            sizeof(Slot))) {
+        ov_log_error("Loop bus: incompatible ring %s", name);
+        goto error;
+    }
+
+    if (!config.callback.io)
+        goto done;
+
+    if (!subscribe(self))
+        goto error;
+
+    if (!ov_event_loop_set(config.loop, self->subscriber.socket,
+                           OV_EVENT_IO_IN | OV_EVENT_IO_CLOSE, self,
+                           doorbell_io)) {
+        goto error;
+    }
+
+done:
+    return self;
+error:
+    ov_loop_bus_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_loop_bus *ov_loop_bus_free(ov_loop_bus *self) {
+
+    if (!ov_loop_bus_cast(self))
+        return self;
+
+    if (-1 != self->subscriber.socket) {
+
+        if (self->config.loop)
+            ov_event_loop_unset(self->config.loop, self->subscriber.socket,
+                                NULL);
+
+        close(self->subscriber.socket);
+    }
+
+    if (self->subscriber.entry) {
+
+        atomic_store(&self->subscriber.entry->sleeping, 0);
+        atomic_store(&self->subscriber.entry->pid, 0);
+    }
+
+    if (-1 != self->publisher)
+        close(self->publisher);
+
+    /* the shared memory object is kept for other processes */
+
+    self->ring = ov_shm_unmap(self->ring, self->size);
+
+    free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_loop_bus_free_void(void *self) {
+
+    return ov_loop_bus_free(ov_loop_bus_cast(self));
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_loop_bus_name(ov_socket_configuration group, char *name, size_t size) {
+
+    if (!name || (0 == group.host[0]))
+        return false;
+
+    int bytes = snprintf(name, size, "%s:%" PRIu16, group.host, group.port);
+
+    return (bytes > 0) && ((size_t)bytes < size);
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_loop_bus_unlink(const char *loop) {
+
+    char name[OV_LOOP_BUS_NAME_MAX + sizeof(OV_LOOP_BUS_SHM_PREFIX)] = {0};
+
+    if (!loop || !shm_name(loop, name, sizeof(name)))
+        return false;
+
+    return 0 == shm_unlink(name);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void ring_doorbells(ov_loop_bus *self) {
+
+    struct sockaddr_un address;
+    const uint8_t ding = 1;
+
+    for (size_t i = 0; i < OV_LOOP_BUS_SUBSCRIBERS_MAX; ++i) {
+
+        Subscriber *entry = &self->ring->subscriber[i];
+
+        if (0 == atomic_load_explicit(&entry->sleeping, memory_order_relaxed))
+            continue;
+
+        /* only the first publisher after some read rings */
+
+        if (1 != atomic_exchange(&entry->sleeping, 0))
+            continue;
+
+        socklen_t length = doorbell_address(self, i, &address);
+        if (0 == length)
+            continue;
+
+        sendto(self->publisher, &ding, 1, MSG_DONTWAIT,
+               (struct sockaddr *)&address, length);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_loop_bus_publish(ov_loop_bus *self, const uint8_t *buffer,
+                         size_t bytes) {
+
+    if (!ov_loop_bus_cast(self) || !buffer || (0 == bytes))
+        goto error;
+
+    if (bytes > OV_LOOP_BUS_PAYLOAD_MAX)
+        goto error;
+
+    uint64_t pos = atomic_fetch_add(&self->ring->head, 1);
+    Slot *slot = &self->ring->slot[pos & self->mask];
+
+    atomic_store_explicit(&slot->sequence, 2 * pos + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    slot->length = bytes;
+    memcpy(slot->data, buffer, bytes);
+
+    atomic_store_explicit(&slot->sequence, 2 * pos + 2, memory_order_release);
+
+    /* pairs with the fence of subscribers going to sleep */
+
+    atomic_thread_fence(memory_order_seq_cst);
+    ring_doorbells(self);
+
+    atomic_fetch_add_explicit(&self->published, 1, memory_order_relaxed);
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void skip_overwritten(ov_loop_bus *self) {
+
+    uint64_t head = atomic_load(&self->ring->head);
+    uint64_t slots = self->mask + 1;
+
+    /* continue at the oldest frame, which will not be overwritten next */
+
+    uint64_t next = self->subscriber.next;
+
+    if (head > slots - 1)
+        next = head - slots + 1;
+
+    if (next > self->subscriber.next) {
+
+        self->stats.dropped += next - self->subscriber.next;
+        self->subscriber.next = next;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t read_pending(ov_loop_bus *self) {
+
+    size_t frames = 0;
+
+    while (true) {
+
+        uint64_t pos = self->subscriber.next;
+        Slot *slot = &self->ring->slot[pos & self->mask];
+
+        uint64_t sequence =
+            atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+        if (sequence > 2 * pos + 2) {
+            skip_overwritten(self);
+            continue;
+        }
+
+        /* not yet published, or still written */
+
+        if (sequence != 2 * pos + 2)
+            break;
+
+        size_t bytes = slot->length;
+
+        if (bytes > OV_LOOP_BUS_PAYLOAD_MAX)
+            bytes = OV_LOOP_BUS_PAYLOAD_MAX;
+
+        memcpy(self->subscriber.buffer, slot->data, bytes);
+
+        atomic_thread_fence(memory_order_acquire);
+
+        if (sequence !=
+            atomic_load_explicit(&slot->sequence, memory_order_relaxed)) {
+            skip_overwritten(self);
+            continue;
+        }
+
+        self->subscriber.next++;
+        self->stats.received++;
+        frames++;
+
+        self->config.callback.io(self->config.callback.userdata,
+                                 self->subscriber.buffer, bytes);
+    }
+
+    return frames;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_loop_bus_receive(ov_loop_bus *self) {
+
+    if (!ov_loop_bus_cast(self) || !self->subscriber.entry)
+        return 0;
+
+    uint8_t drain[16];
+
+    while (0 < recv(self->subscriber.socket, drain, sizeof(drain),
+                    MSG_DONTWAIT)) {
+    }
+
+    size_t frames = 0;
+    Subscriber *entry = self->subscriber.entry;
+
+    while (true) {
+
+        frames += read_pending(self);
+
+        atomic_store(&entry->sleeping, 1);
+
+        /* pairs with the fence of publishers, either the publisher sees
+         * the subscriber sleeping or the subscriber sees the frame */
+
+        atomic_thread_fence(memory_order_seq_cst);
+
+        uint64_t pos = self->subscriber.next;
+        Slot *slot = &self->ring->slot[pos & self->mask];
+
+        if (atomic_load(&slot->sequence) < 2 * pos + 2)
+            break;
+
+        atomic_store(&entry->sleeping, 0);
+    }
+
+    return frames;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_loop_bus_multicast_loop(int socket, bool enable) {
+
+    int loop = enable ? 1 : 0;
+
+    if (0 > socket)
+        goto error;
+
+    if (0 == setsockopt(socket, IPPROTO_IP, IP_MULTICAST_LOOP, &loop,
+                        sizeof(loop))) {
+        return true;
+    }
+
+    if (0 == setsockopt(socket, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &loop,
+                        sizeof(loop))) {
+        return true;
+    }
+
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_loop_bus_stats ov_loop_bus_get_stats(const ov_loop_bus *self) {
+
+    if (!ov_loop_bus_cast(self))
+        return (ov_loop_bus_stats){0};
+
+    ov_loop_bus_stats stats = self->stats;
+    stats.published = atomic_load(&self->published);
+
+    return stats;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_loop_bus_stats_to_json(ov_loop_bus_stats stats) {
+
+    ov_json_value *out = ov_json_object();
+    ov_json_value *val = NULL;
+
+    val = ov_json_number(stats.published);
+    if (!ov_json_object_set(out, "published", val))
+        goto error;
+
+    val = ov_json_number(stats.received);
+    if (!ov_json_object_set(out, "received", val))
+        goto error;
+
+    val = ov_json_number(stats.dropped);
+    if (!ov_json_object_set(out, "dropped", val))
+        goto error;
+
+    val = ov_json_number(stats.wakeups);
+    if (!ov_json_object_set(out, "wakeups", val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
@@ -0,0 +1,589 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_loop_bus_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_loop_bus.c"
+
+#include "../../include/ov_mc_socket.h"
+#include "../../include/ov_time.h"
+#include <arpa/inet.h>
+#include <ov_test/testrun.h>
+#include <time.h>
+
+/*****************************************************************************
+                                    HELPERS
+ ****************************************************************************/
+
+typedef struct {
+
+    size_t frames;
+    size_t bytes;
+    uint8_t last[OV_LOOP_BUS_PAYLOAD_MAX];
+
+} Received;
+
+/*----------------------------------------------------------------------------*/
+
+static void cb_io(void *userdata, const uint8_t *buffer, size_t bytes) {
+
+    Received *received = userdata;
+
+    received->frames++;
+    received->bytes += bytes;
+    memcpy(received->last, buffer, bytes);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_loop_bus_config bus_config(const char *suffix) {
+
+    ov_loop_bus_config config = {0};
+
+    snprintf(config.name, sizeof(config.name), "ov_loop_bus_test_%i_%s",
+             getpid(), suffix);
+
+    return config;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_event_loop *test_loop() {
+
+    return ov_event_loop_default(ov_event_loop_config_default());
+}
+
+/*****************************************************************************
+                                    TESTS
+ ****************************************************************************/
+
+int test_ov_loop_bus_create() {
+
+    ov_event_loop *loop = test_loop();
+    testrun(loop);
+
+    Received received = {0};
+
+    testrun(NULL == ov_loop_bus_create((ov_loop_bus_config){0}));
+
+    ov_loop_bus_config config = bus_config("create");
+    config.slots = 100;
+
+    /* publisher only */
+
+    ov_loop_bus *publisher = ov_loop_bus_create(config);
+    testrun(publisher);
+    testrun(127 == publisher->mask);
+    testrun(NULL == publisher->subscriber.entry);
+    testrun(-1 == publisher->subscriber.socket);
+
+    /* subscriber without loop */
+
+    config.callback.userdata = &received;
+    config.callback.io = cb_io;
+    testrun(NULL == ov_loop_bus_create(config));
+
+    config.loop = loop;
+
+    ov_loop_bus *subscriber = ov_loop_bus_create(config);
+    testrun(subscriber);
+    testrun(subscriber->subscriber.entry);
+    testrun(getpid() == atomic_load(&subscriber->subscriber.entry->pid));
+    testrun(-1 != subscriber->subscriber.socket);
+
+    /* same name, different geometry */
+
+    config.slots = 1000;
+    testrun(NULL == ov_loop_bus_create(config));
+
+    testrun(NULL == ov_loop_bus_free(subscriber));
+    testrun(NULL == ov_loop_bus_free(publisher));
+    testrun(ov_loop_bus_unlink(config.name));
+    testrun(!ov_loop_bus_unlink(config.name));
+
+    loop = ov_event_loop_free(loop);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_free() {
+
+    testrun(NULL == ov_loop_bus_free(NULL));
+    testrun(NULL == ov_loop_bus_free_void(NULL));
+
+    ov_event_loop *loop = test_loop();
+    Received received = {0};
+
+    ov_loop_bus_config config = bus_config("free");
+    config.loop = loop;
+    config.callback.userdata = &received;
+    config.callback.io = cb_io;
+
+    ov_loop_bus *bus = ov_loop_bus_create(config);
+    testrun(bus);
+
+    size_t index = bus->subscriber.entry - bus->ring->subscriber;
+
+    /* keeps the ring mapped */
+
+    config.callback.io = NULL;
+    ov_loop_bus *publisher = ov_loop_bus_create(config);
+    testrun(publisher);
+
+    Subscriber *entry = &publisher->ring->subscriber[index];
+    testrun(getpid() == atomic_load(&entry->pid));
+
+    testrun(NULL == ov_loop_bus_free(bus));
+
+    /* entry released */
+
+    testrun(0 == atomic_load(&entry->pid));
+
+    testrun(NULL == ov_loop_bus_free(publisher));
+    testrun(ov_loop_bus_unlink(config.name));
+    loop = ov_event_loop_free(loop);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_publish() {
+
+    ov_event_loop *loop = test_loop();
+    Received received = {0};
+
+    uint8_t buffer[OV_LOOP_BUS_PAYLOAD_MAX + 1] = {0};
+
+    ov_loop_bus_config config = bus_config("publish");
+
+    ov_loop_bus *publisher = ov_loop_bus_create(config);
+
+    config.loop = loop;
+    config.callback.userdata = &received;
+    config.callback.io = cb_io;
+
+    ov_loop_bus *subscriber = ov_loop_bus_create(config);
+
+    testrun(publisher);
+    testrun(subscriber);
+
+    testrun(!ov_loop_bus_publish(NULL, buffer, 10));
+    testrun(!ov_loop_bus_publish(publisher, NULL, 10));
+    testrun(!ov_loop_bus_publish(publisher, buffer, 0));
+    testrun(!ov_loop_bus_publish(publisher, buffer, sizeof(buffer)));
+
+    for (uint8_t i = 1; i < 4; ++i) {
+
+        memset(buffer, i, sizeof(buffer));
+        testrun(ov_loop_bus_publish(publisher, buffer, 100 * i));
+    }
+
+    testrun(3 == ov_loop_bus_receive(subscriber));
+    testrun(3 == received.frames);
+    testrun(600 == received.bytes);
+    testrun(3 == received.last[0]);
+    testrun(3 == received.last[299]);
+
+    testrun(0 == ov_loop_bus_receive(subscriber));
+
+    /* publisher may subscribe itself */
+
+    testrun(ov_loop_bus_publish(subscriber, buffer, 10));
+    testrun(1 == ov_loop_bus_receive(subscriber));
+
+    testrun(3 == ov_loop_bus_get_stats(publisher).published);
+    testrun(4 == ov_loop_bus_get_stats(subscriber).received);
+    testrun(0 == ov_loop_bus_get_stats(subscriber).dropped);
+
+    testrun(NULL == ov_loop_bus_free(subscriber));
+    testrun(NULL == ov_loop_bus_free(publisher));
+    testrun(ov_loop_bus_unlink(config.name));
+    loop = ov_event_loop_free(loop);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_receive() {
+
+    ov_event_loop *loop = test_loop();
+    Received received = {0};
+
+    uint8_t buffer[100] = {0};
+
+    ov_loop_bus_config config = bus_config("receive");
+    config.slots = 4;
+    config.loop = loop;
+    config.callback.userdata = &received;
+    config.callback.io = cb_io;
+
+    ov_loop_bus *bus = ov_loop_bus_create(config);
+    testrun(bus);
+
+    testrun(0 == ov_loop_bus_receive(NULL));
+    testrun(0 == ov_loop_bus_receive(bus));
+
+    /* subscriber overrun */
+
+    for (uint8_t i = 0; i < 10; ++i) {
+
+        buffer[0] = i;
+        testrun(ov_loop_bus_publish(bus, buffer, sizeof(buffer)));
+    }
+
+    testrun(3 == ov_loop_bus_receive(bus));
+    testrun(9 == received.last[0]);
+
+    ov_loop_bus_stats stats = ov_loop_bus_get_stats(bus);
+    testrun(3 == stats.received);
+    testrun(7 == stats.dropped);
+
+    /* slot written */
+
+    received = (Received){0};
+
+    testrun(ov_loop_bus_publish(bus, buffer, sizeof(buffer)));
+
+    Slot *slot = &bus->ring->slot[bus->subscriber.next & bus->mask];
+    atomic_fetch_sub(&slot->sequence, 1);
+    testrun(0 == ov_loop_bus_receive(bus));
+    atomic_fetch_add(&slot->sequence, 1);
+    testrun(1 == ov_loop_bus_receive(bus));
+
+    testrun(NULL == ov_loop_bus_free(bus));
+    testrun(ov_loop_bus_unlink(config.name));
+    loop = ov_event_loop_free(loop);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_doorbell() {
+
+    ov_event_loop *loop = test_loop();
+    Received received = {0};
+
+    uint8_t buffer[100] = {0};
+    uint8_t ding = 0;
+
+    ov_loop_bus_config config = bus_config("doorbell");
+
+    ov_loop_bus *publisher = ov_loop_bus_create(config);
+
+    config.loop = loop;
+    config.callback.userdata = &received;
+    config.callback.io = cb_io;
+
+    ov_loop_bus *subscriber = ov_loop_bus_create(config);
+
+    testrun(publisher);
+    testrun(subscriber);
+
+    int socket = subscriber->subscriber.socket;
+
+    /* sleeping subscribers get one doorbell per batch */
+
+    testrun(ov_loop_bus_publish(publisher, buffer, sizeof(buffer)));
+    testrun(ov_loop_bus_publish(publisher, buffer, sizeof(buffer)));
+
+    testrun(1 == recv(socket, &ding, 1, MSG_DONTWAIT | MSG_PEEK));
+    testrun(0 == atomic_load(&subscriber->subscriber.entry->sleeping));
+
+    testrun(loop->run(loop, OV_RUN_ONCE));
+
+    testrun(2 == received.frames);
+    testrun(1 == ov_loop_bus_get_stats(subscriber).wakeups);
+    testrun(1 == atomic_load(&subscriber->subscriber.entry->sleeping));
+    testrun(-1 == recv(socket, &ding, 1, MSG_DONTWAIT | MSG_PEEK));
+
+    testrun(ov_loop_bus_publish(publisher, buffer, sizeof(buffer)));
+    testrun(loop->run(loop, OV_RUN_ONCE));
+    testrun(3 == received.frames);
+
+    testrun(NULL == ov_loop_bus_free(subscriber));
+    testrun(NULL == ov_loop_bus_free(publisher));
+    testrun(ov_loop_bus_unlink(config.name));
+    loop = ov_event_loop_free(loop);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_multicast_loop() {
+
+    testrun(!ov_loop_bus_multicast_loop(-1, true));
+
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    testrun(-1 != s);
+
+    int loop = 1;
+    socklen_t length = sizeof(loop);
+
+    testrun(ov_loop_bus_multicast_loop(s, false));
+    testrun(0 == getsockopt(s, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, &length));
+    testrun(0 == loop);
+
+    testrun(ov_loop_bus_multicast_loop(s, true));
+    testrun(0 == getsockopt(s, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, &length));
+    testrun(1 == loop);
+
+    close(s);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_name() {
+
+    char name[OV_LOOP_BUS_NAME_MAX] = {0};
+
+    ov_socket_configuration group = {
+        .host = "224.0.0.2", .port = 12345, .type = UDP};
+
+    testrun(!ov_loop_bus_name(group, NULL, sizeof(name)));
+    testrun(!ov_loop_bus_name((ov_socket_configuration){0}, name,
+                              sizeof(name)));
+    testrun(!ov_loop_bus_name(group, name, 5));
+
+    testrun(ov_loop_bus_name(group, name, sizeof(name)));
+    testrun(0 == strcmp("224.0.0.2:12345", name));
+
+    /* the bus of the group may be created */
+
+    ov_loop_bus_config config = {0};
+    testrun(ov_loop_bus_name(group, config.name, sizeof(config.name)));
+
+    ov_loop_bus *bus = ov_loop_bus_create(config);
+    testrun(bus);
+
+    testrun(NULL == ov_loop_bus_free(bus));
+    testrun(ov_loop_bus_unlink(config.name));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_loop_bus_stats_to_json() {
+
+    ov_json_value *out = ov_loop_bus_stats_to_json((ov_loop_bus_stats){
+        .published = 4, .received = 3, .dropped = 2, .wakeups = 1});
+
+    testrun(4 == ov_json_number_get(ov_json_get(out, "/published")));
+    testrun(3 == ov_json_number_get(ov_json_get(out, "/received")));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/dropped")));
+    testrun(1 == ov_json_number_get(ov_json_get(out, "/wakeups")));
+
+    out = ov_json_value_free(out);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void print_rate(const char *transport, size_t batch, size_t packets,
+                       uint64_t usec, clock_t cpu) {
+
+    double cpu_usec = 1000000.0 * cpu / CLOCKS_PER_SEC;
+
+    fprintf(stdout,
+            "%s (batch %zu): %zu packets %.0f packets/s %.1f ns/packet "
+            "cpu %.1f ns/packet\n",
+            transport, batch, packets, 1000000.0 * packets / usec,
+            1000.0 * usec / packets, 1000.0 * cpu_usec / packets);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool multicast_performance(size_t packets, size_t batch,
+                                  const uint8_t *payload, size_t bytes) {
+
+    uint8_t buffer[OV_LOOP_BUS_PAYLOAD_MAX] = {0};
+
+    ov_socket_configuration config = {
+        .host = "229.0.0.42", .port = 32042, .type = UDP};
+
+    int receiver = ov_mc_socket(config);
+    int sender = socket(AF_INET, SOCK_DGRAM, 0);
+
+    struct sockaddr_in group = {.sin_family = AF_INET,
+                                .sin_port = htons(config.port)};
+
+    inet_pton(AF_INET, config.host, &group.sin_addr);
+
+    if ((-1 == receiver) || (-1 == sender))
+        goto error;
+
+    int size = 4 * 1024 * 1024;
+    setsockopt(receiver, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+
+    uint64_t start = ov_time_get_current_time_usecs();
+    clock_t cpu = clock();
+
+    size_t received = 0;
+
+    for (size_t i = 0; i < packets; i += batch) {
+
+        for (size_t k = 0; k < batch; ++k) {
+
+            if (0 > sendto(sender, payload, bytes, 0, (struct sockaddr *)&group,
+                           sizeof(group))) {
+                goto error;
+            }
+        }
+
+        while (0 < recv(receiver, buffer, sizeof(buffer), MSG_DONTWAIT)) {
+            received++;
+        }
+    }
+
+    print_rate("multicast", batch, received,
+               ov_time_get_current_time_usecs() - start, clock() - cpu);
+
+    close(sender);
+    close(receiver);
+    return true;
+error:
+    fprintf(stdout, "multicast: not available - %s\n", strerror(errno));
+    if (-1 != sender)
+        close(sender);
+    if (-1 != receiver)
+        close(receiver);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool loop_bus_performance(ov_loop_bus *publisher,
+                                 ov_loop_bus *subscriber, Received *received,
+                                 size_t packets, size_t batch,
+                                 const uint8_t *payload, size_t bytes) {
+
+    *received = (Received){0};
+
+    uint64_t start = ov_time_get_current_time_usecs();
+    clock_t cpu = clock();
+
+    /* each batch rings the doorbell once, as the subscriber read all */
+
+    for (size_t i = 0; i < packets; i += batch) {
+
+        for (size_t k = 0; k < batch; ++k) {
+            ov_loop_bus_publish(publisher, payload, bytes);
+        }
+
+        ov_loop_bus_receive(subscriber);
+    }
+
+    print_rate("loop bus", batch, received->frames,
+               ov_time_get_current_time_usecs() - start, clock() - cpu);
+
+    return packets == received->frames;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_loop_bus_performance() {
+
+    ov_event_loop *loop = test_loop();
+    Received received = {0};
+
+    uint8_t payload[172] = {0};
+
+    const size_t packets = 1000000;
+
+    ov_loop_bus_config config = bus_config("performance");
+
+    ov_loop_bus *publisher = ov_loop_bus_create(config);
+
+    config.loop = loop;
+    config.callback.userdata = &received;
+    config.callback.io = cb_io;
+
+    ov_loop_bus *subscriber = ov_loop_bus_create(config);
+
+    testrun(publisher);
+    testrun(subscriber);
+
+    /* a busy subscriber reads a batch per wakeup, an idle one a single
+     * frame, which costs a doorbell datagram per frame */
+
+    const size_t batches[] = {32, 1};
+
+    for (size_t i = 0; i < sizeof(batches) / sizeof(batches[0]); ++i) {
+
+        testrun(loop_bus_performance(publisher, subscriber, &received,
+                                     packets, batches[i], payload,
+                                     sizeof(payload)));
+
+        multicast_performance(packets, batches[i], payload, sizeof(payload));
+    }
+
+    testrun(0 == ov_loop_bus_get_stats(subscriber).dropped);
+
+    testrun(NULL == ov_loop_bus_free(subscriber));
+    testrun(NULL == ov_loop_bus_free(publisher));
+    testrun(ov_loop_bus_unlink(config.name));
+    loop = ov_event_loop_free(loop);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_loop_bus_create);
+    testrun_test(test_ov_loop_bus_free);
+    testrun_test(test_ov_loop_bus_publish);
+    testrun_test(test_ov_loop_bus_receive);
+    testrun_test(test_ov_loop_bus_doorbell);
+    testrun_test(test_ov_loop_bus_multicast_loop);
+    testrun_test(test_ov_loop_bus_name);
+    testrun_test(test_ov_loop_bus_stats_to_json);
+    testrun_test(check_loop_bus_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
@@ -240,9 +240,13 @@ int socket_create_local(ov_socket_configuration config, bool as_client,
 /*---------------------------------------------------------------------------*/
 
 static int setup_server_socket_nocheck(int fd,
-                                       const struct addrinfo *addrinfo) {
+                                       const struct addrinfo *addrinfo,
+                                       bool reuseport) {
     ov_socket_set_reuseaddress(fd);
 
+    if (reuseport && !ov_socket_set_reuseport(fd))
+        return errno;
+
     int backlog = 2048;
 
     if (0 != bind(fd, addrinfo->ai_addr, addrinfo->ai_addrlen)) {
@@ -272,8 +276,8 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-int ov_socket_create(ov_socket_configuration config, bool as_client,
-                     ov_socket_error *err_return) {
+static int socket_create(ov_socket_configuration config, bool as_client,
+                         bool reuseport, ov_socket_error *err_return) {
     if (config.type == LOCAL)
         return socket_create_local(config, as_client, err_return);
 
@@ -369,7 +373,7 @@ int ov_socket_create(ov_socket_configuration config, bool as_client,
             }
 
         } else {
-            e.err = setup_server_socket_nocheck(fd, current);
+            e.err = setup_server_socket_nocheck(fd, current, reuseport);
 
             if (0 != e.err) {
                 continue;
@@ -405,6 +409,32 @@ error:
     return -1;
 }
 
+/*----------------------------------------------------------------------------*/
+
+int ov_socket_create(ov_socket_configuration config, bool as_client,
+                     ov_socket_error *err_return) {
+
+    return socket_create(config, as_client, false, err_return);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int ov_socket_create_reuseport(ov_socket_configuration config,
+                               ov_socket_error *err_return) {
+
+    switch (config.type) {
+
+    case TCP:
+    case UDP:
+        break;
+
+    default:
+        return -1;
+    }
+
+    return socket_create(config, false, true, err_return);
+}
+
 /*---------------------------------------------------------------------------*/
 
 int ov_socket_create_at_interface(struct ifaddrs *interface,
@@ -564,6 +594,18 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+bool ov_socket_set_reuseport(int socket) {
+
+    int opt = 1;
+
+    if (0 > setsockopt(socket, SOL_SOCKET, SO_REUSEPORT, &opt, sizeof(opt)))
+        return false;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_socket_disable_nagl(int fh) {
     if (0 > fh) {
         return false;
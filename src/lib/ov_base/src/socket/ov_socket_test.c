@@ -688,6 +688,75 @@ int test_ov_socket_set_reuseaddress() {
 
 /*----------------------------------------------------------------------------*/
 
+int test_ov_socket_set_reuseport() {
+
+    int socket = ov_socket_create((ov_socket_configuration){.type = UDP},
+                                  false, NULL);
+    testrun(socket > -1);
+
+    int so_opt = 0;
+    socklen_t so_len = sizeof(so_opt);
+
+    testrun(0 ==
+            getsockopt(socket, SOL_SOCKET, SO_REUSEPORT, &so_opt, &so_len));
+    testrun(0 == so_opt);
+
+    testrun(ov_socket_set_reuseport(socket));
+    testrun(0 ==
+            getsockopt(socket, SOL_SOCKET, SO_REUSEPORT, &so_opt, &so_len));
+    testrun(0 < so_opt);
+
+    testrun(!ov_socket_set_reuseport(-1));
+
+    close(socket);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_socket_create_reuseport() {
+
+    ov_socket_configuration cfg =
+        (ov_socket_configuration){.host = "127.0.0.1", .type = UDP};
+
+    testrun(-1 == ov_socket_create_reuseport(
+                      (ov_socket_configuration){.type = LOCAL}, NULL));
+
+    int socket[3] = {-1, -1, -1};
+
+    socket[0] = ov_socket_create_reuseport(cfg, NULL);
+    testrun(socket[0] > -1);
+    testrun(ov_socket_get_config(socket[0], &cfg, NULL, NULL));
+    testrun(0 != cfg.port);
+
+    // bind to the same address
+    socket[1] = ov_socket_create_reuseport(cfg, NULL);
+    testrun(socket[1] > -1);
+
+    close(socket[0]);
+    close(socket[1]);
+
+    cfg = (ov_socket_configuration){.host = "127.0.0.1", .type = TCP};
+
+    socket[0] = ov_socket_create_reuseport(cfg, NULL);
+    testrun(socket[0] > -1);
+    testrun(ov_socket_get_config(socket[0], &cfg, NULL, NULL));
+
+    socket[1] = ov_socket_create_reuseport(cfg, NULL);
+    testrun(socket[1] > -1);
+
+    // without SO_REUSEPORT the address is in use
+    socket[2] = ov_socket_create(cfg, false, NULL);
+    testrun(-1 == socket[2]);
+
+    close(socket[0]);
+    close(socket[1]);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_socket_create_at_interface() {
 
     ov_socket_configuration cfg;
@@ -2161,6 +2230,7 @@ OV_TEST_RUN(
     "ov_socket", test_ov_socket_create, test_ov_socket_close,
     test_ov_socket_close_local, test_ov_socket_set_dont_fragment,
     test_ov_socket_ensure_nonblocking, test_ov_socket_set_reuseaddress,
+    test_ov_socket_set_reuseport, test_ov_socket_create_reuseport,
     test_ov_socket_create_at_interface,
     test_ov_socket_config_from_sockaddr_storage, test_ov_socket_get_config,
     test_ov_socket_get_sockaddr_storage, test_ov_socket_parse_sockaddr_storage,
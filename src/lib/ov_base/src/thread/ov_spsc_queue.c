@@ -0,0 +1,192 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_spsc_queue.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#ifdef __STDC_NO_ATOMICS__
+#error("Compiler does not support C11 atomics")
+#endif
+
+#include "../../include/ov_spsc_queue.h"
+
+#include <stdalign.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define CACHE_LINE 64
+#define CAPACITY_MAX ((size_t)1 << 24)
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_spsc_queue {
+
+    size_t mask;
+    void **items;
+
+    /*
+     * head and tail run freely, the slot is position & mask.
+     * Each side keeps a copy of the other side to touch the shared
+     * cache line only if the copy is exhausted.
+     */
+
+    alignas(CACHE_LINE) _Atomic size_t head; // next to pop, consumer
+    size_t tail_seen;
+
+    alignas(CACHE_LINE) _Atomic size_t tail; // next to push, producer
+    size_t head_seen;
+};
+
+/*----------------------------------------------------------------------------*/
+
+ov_spsc_queue *ov_spsc_queue_create(size_t capacity) {
+
+    ov_spsc_queue *self = NULL;
+
+    if ((0 == capacity) || (CAPACITY_MAX < capacity))
+        goto error;
+
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    self = aligned_alloc(CACHE_LINE, sizeof(ov_spsc_queue));
+    if (!self)
+        goto error;
+
+    self->mask = size - 1;
+    self->items = calloc(size, sizeof(void *));
+    if (!self->items)
+        goto error;
+
+    atomic_init(&self->head, 0);
+    atomic_init(&self->tail, 0);
+    self->tail_seen = 0;
+    self->head_seen = 0;
+
+    return self;
+error:
+    if (self)
+        free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_spsc_queue *ov_spsc_queue_free(ov_spsc_queue *self,
+                                  void *(*item_free)(void *)) {
+
+    if (!self)
+        return NULL;
+
+    void *item = ov_spsc_queue_pop(self);
+
+    while (item) {
+
+        if (item_free)
+            item_free(item);
+
+        item = ov_spsc_queue_pop(self);
+    }
+
+    free(self->items);
+    free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_spsc_queue_push(ov_spsc_queue *self, void *item) {
+
+    if (!self || !item)
+        return false;
+
+    size_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+
+    if (tail - self->head_seen > self->mask) {
+
+        self->head_seen =
+            atomic_load_explicit(&self->head, memory_order_acquire);
+
+        if (tail - self->head_seen > self->mask)
+            return false;
+    }
+
+    self->items[tail & self->mask] = item;
+    atomic_store_explicit(&self->tail, tail + 1, memory_order_release);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void *ov_spsc_queue_pop(ov_spsc_queue *self) {
+
+    if (!self)
+        return NULL;
+
+    size_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+
+    if (head == self->tail_seen) {
+
+        self->tail_seen =
+            atomic_load_explicit(&self->tail, memory_order_acquire);
+
+        if (head == self->tail_seen)
+            return NULL;
+    }
+
+    void *item = self->items[head & self->mask];
+    atomic_store_explicit(&self->head, head + 1, memory_order_release);
+
+    return item;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_spsc_queue_capacity(const ov_spsc_queue *self) {
+
+    if (!self)
+        return 0;
+
+    return self->mask + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+size_t ov_spsc_queue_count(ov_spsc_queue *self) {
+
+    if (!self)
+        return 0;
+
+    size_t head = atomic_load_explicit(&self->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&self->tail, memory_order_acquire);
+
+    return tail - head;
+}
+
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,249 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_spsc_queue_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_spsc_queue.c"
+#include <ov_test/testrun.h>
+
+#include "../../include/ov_time.h"
+#include "../../include/ov_utils.h"
+#include <pthread.h>
+#include <sched.h>
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_spsc_queue_create() {
+
+    testrun(NULL == ov_spsc_queue_create(0));
+    testrun(NULL == ov_spsc_queue_create(CAPACITY_MAX + 1));
+
+    ov_spsc_queue *queue = ov_spsc_queue_create(1);
+    testrun(queue);
+    testrun(1 == ov_spsc_queue_capacity(queue));
+    testrun(0 == ov_spsc_queue_count(queue));
+    testrun(NULL == ov_spsc_queue_free(queue, NULL));
+
+    queue = ov_spsc_queue_create(100);
+    testrun(queue);
+    testrun(128 == ov_spsc_queue_capacity(queue));
+    testrun(NULL == ov_spsc_queue_free(queue, NULL));
+
+    testrun(0 == ov_spsc_queue_capacity(NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_spsc_queue_free() {
+
+    testrun(NULL == ov_spsc_queue_free(NULL, NULL));
+
+    /* queued items are released */
+
+    ov_spsc_queue *queue = ov_spsc_queue_create(4);
+    testrun(queue);
+
+    for (size_t i = 0; i < 3; ++i) {
+        testrun(ov_spsc_queue_push(queue, calloc(1, 10)));
+    }
+
+    testrun(NULL == ov_spsc_queue_free(queue, ov_free));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_spsc_queue_push() {
+
+    int items[5] = {0};
+
+    ov_spsc_queue *queue = ov_spsc_queue_create(4);
+    testrun(queue);
+
+    testrun(!ov_spsc_queue_push(NULL, items));
+    testrun(!ov_spsc_queue_push(queue, NULL));
+
+    for (size_t i = 0; i < 4; ++i) {
+        testrun(ov_spsc_queue_push(queue, items + i));
+        testrun(i + 1 == ov_spsc_queue_count(queue));
+    }
+
+    /* full */
+    testrun(!ov_spsc_queue_push(queue, items + 4));
+    testrun(4 == ov_spsc_queue_count(queue));
+
+    testrun(items == ov_spsc_queue_pop(queue));
+    testrun(ov_spsc_queue_push(queue, items + 4));
+    testrun(!ov_spsc_queue_push(queue, items));
+
+    testrun(NULL == ov_spsc_queue_free(queue, NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_spsc_queue_pop() {
+
+    int items[10] = {0};
+
+    ov_spsc_queue *queue = ov_spsc_queue_create(4);
+    testrun(queue);
+
+    testrun(NULL == ov_spsc_queue_pop(NULL));
+    testrun(NULL == ov_spsc_queue_pop(queue));
+
+    /* wrap around several times, order is kept */
+
+    for (size_t round = 0; round < 5; ++round) {
+
+        for (size_t i = 0; i < 3; ++i) {
+            testrun(ov_spsc_queue_push(queue, items + i + round));
+        }
+
+        for (size_t i = 0; i < 3; ++i) {
+            testrun(items + i + round == ov_spsc_queue_pop(queue));
+        }
+
+        testrun(NULL == ov_spsc_queue_pop(queue));
+        testrun(0 == ov_spsc_queue_count(queue));
+    }
+
+    testrun(NULL == ov_spsc_queue_free(queue, NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+#define THREAD_ITEMS 1000000
+
+static void *producer(void *arg) {
+
+    ov_spsc_queue *queue = arg;
+
+    for (uintptr_t i = 1; i <= THREAD_ITEMS; ++i) {
+
+        while (!ov_spsc_queue_push(queue, (void *)i)) {
+            sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_spsc_queue_threads() {
+
+    ov_spsc_queue *queue = ov_spsc_queue_create(64);
+    testrun(queue);
+
+    pthread_t thread;
+    testrun(0 == pthread_create(&thread, NULL, producer, queue));
+
+    uintptr_t expected = 1;
+
+    while (expected <= THREAD_ITEMS) {
+
+        void *item = ov_spsc_queue_pop(queue);
+
+        if (!item) {
+            sched_yield();
+            continue;
+        }
+
+        if ((uintptr_t)item != expected)
+            break;
+
+        ++expected;
+    }
+
+    testrun(0 == pthread_join(thread, NULL));
+    testrun(THREAD_ITEMS + 1 == expected);
+    testrun(NULL == ov_spsc_queue_pop(queue));
+
+    testrun(NULL == ov_spsc_queue_free(queue, NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_spsc_queue_performance() {
+
+    const size_t runs = 10000000;
+
+    ov_spsc_queue *queue = ov_spsc_queue_create(1024);
+    testrun(queue);
+
+    int item = 0;
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_spsc_queue_push(queue, &item);
+        ov_spsc_queue_pop(queue);
+    }
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout, "spsc queue push + pop: %.1f ns/op\n",
+            1000.0 * usec / runs);
+
+    testrun(NULL == ov_spsc_queue_free(queue, NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_spsc_queue_create);
+    testrun_test(test_ov_spsc_queue_free);
+    testrun_test(test_ov_spsc_queue_push);
+    testrun_test(test_ov_spsc_queue_pop);
+    testrun_test(test_ov_spsc_queue_threads);
+    testrun_test(check_spsc_queue_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
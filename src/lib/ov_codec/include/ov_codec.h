@@ -68,6 +68,7 @@ Copyright   2017        German Aerospace Center DLR e.V.,
 #define ov_codec_h
 
 #include <limits.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -121,6 +122,33 @@ int32_t ov_codec_decode(ov_codec *codec, uint64_t seq_number,
 
 /*----------------------------------------------------------------------------*/
 
+/**
+ * Conceals the loss of one frame and writes the concealment to `output`
+ * like `ov_codec_decode`.
+ * If `next` is given, it is the frame following the lost one, which
+ * might carry redundancy (e.g. Opus in-band FEC) for the lost frame.
+ * @return number of written bytes or a negative number in case of
+ * error or if the codec does not support concealment.
+ */
+int32_t ov_codec_conceal(ov_codec *codec, const uint8_t *next,
+                         size_t next_length, uint8_t *output,
+                         size_t max_out_length_bytes);
+
+/*----------------------------------------------------------------------------*/
+
+#define OV_CODEC_COMPLEXITY_DEFAULT -1
+
+/**
+ * Sets the computational complexity of the encoder, e.g. 0 ... 10 for Opus.
+ * OV_CODEC_COMPLEXITY_DEFAULT restores the complexity the codec was
+ * created with.
+ * Setting the current complexity again is cheap.
+ * @return false in case of error or if the codec does not support it.
+ */
+bool ov_codec_set_complexity(ov_codec *codec, int complexity);
+
+/*----------------------------------------------------------------------------*/
+
 /**
  * Get standard payload type for RTP for this codec.
  * If there is no standard payload type (like for Opus, where the payload type
@@ -228,6 +256,19 @@ struct ov_codec_struct {
                       const uint8_t *input, size_t length, uint8_t *output,
                       size_t max_out_length);
 
+    /**
+     * Optional, conceal the loss of one frame.
+     * `next` is the frame following the lost one or 0.
+     */
+    int32_t (*conceal)(ov_codec *codec, const uint8_t *next,
+                       size_t next_length, uint8_t *output,
+                       size_t max_out_length);
+
+    /**
+     * Optional, set the encoder complexity.
+     */
+    bool (*set_complexity)(ov_codec *codec, int complexity);
+
     ov_json_value *(*get_parameters)(const ov_codec *);
 
     uint32_t (*get_samplerate_hertz)(const ov_codec *codec);
@@ -288,22 +288,8 @@ int32_t ov_codec_encode(ov_codec *codec, const uint8_t *input, size_t length,
 
 /*----------------------------------------------------------------------------*/
 
-int32_t ov_codec_decode(ov_codec *codec, uint64_t seq_number,
-                        const uint8_t *input, size_t length, uint8_t *output,
-                        size_t max_out_length) {
-
-    int32_t result = -1;
-
-    if (0 == codec) {
-
-        ov_log_error("No codec given");
-        return -1;
-    }
-
-    OV_ASSERT(0 != codec->decode);
-
-    result =
-        codec->decode(codec, seq_number, input, length, output, max_out_length);
+static int32_t resample_decoded(ov_codec *codec, int32_t result,
+                                uint8_t *output, size_t max_out_length) {
 
     if (0 > result) {
         ov_log_error("Decoding failed");
@@ -316,7 +302,7 @@ int32_t ov_codec_decode(ov_codec *codec, uint64_t seq_number,
     }
 
     OV_ASSERT(0 != output);
-    length = result;
+    size_t length = result;
 
     uint8_t *resampled_input = 0;
     size_t resampled_input_len = 0;
@@ -352,6 +338,65 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+int32_t ov_codec_decode(ov_codec *codec, uint64_t seq_number,
+                        const uint8_t *input, size_t length, uint8_t *output,
+                        size_t max_out_length) {
+
+    if (0 == codec) {
+
+        ov_log_error("No codec given");
+        return -1;
+    }
+
+    OV_ASSERT(0 != codec->decode);
+
+    int32_t result =
+        codec->decode(codec, seq_number, input, length, output, max_out_length);
+
+    return resample_decoded(codec, result, output, max_out_length);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int32_t ov_codec_conceal(ov_codec *codec, const uint8_t *next,
+                         size_t next_length, uint8_t *output,
+                         size_t max_out_length) {
+
+    if (0 == codec) {
+
+        ov_log_error("No codec given");
+        return -1;
+    }
+
+    if (0 == codec->conceal) {
+        return -1;
+    }
+
+    int32_t result =
+        codec->conceal(codec, next, next_length, output, max_out_length);
+
+    return resample_decoded(codec, result, output, max_out_length);
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_codec_set_complexity(ov_codec *codec, int complexity) {
+
+    if (0 == codec) {
+
+        ov_log_error("No codec given");
+        return false;
+    }
+
+    if (0 == codec->set_complexity) {
+        return false;
+    }
+
+    return codec->set_complexity(codec, complexity);
+}
+
+/*----------------------------------------------------------------------------*/
+
 int8_t ov_codec_get_rtp_payload_type(ov_codec const *codec) {
     if (0 == codec) {
         ov_log_error(
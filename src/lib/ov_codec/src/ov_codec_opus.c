@@ -30,6 +30,7 @@ Copyright   2018        German Aerospace Center DLR e.V.,
  **/
 
 #include "../include/ov_codec_opus.h"
+#include <ov_arch/ov_arch_math.h>
 #include <ov_base/ov_utils.h>
 
 #include <opus.h>
@@ -54,6 +55,13 @@ typedef struct {
     OpusDecoder *decoder;
     OpusEncoder *encoder;
 
+    struct {
+
+        opus_int32 current;
+        opus_int32 initial;
+
+    } complexity;
+
 } ov_codec_opus;
 
 /******************************************************************************
@@ -72,6 +80,12 @@ static int32_t impl_decode(ov_codec *self, uint64_t seq_number,
                            const uint8_t *input, size_t length, uint8_t *output,
                            size_t max_out_length);
 
+static int32_t impl_conceal(ov_codec *self, const uint8_t *next,
+                            size_t next_length, uint8_t *output,
+                            size_t max_out_length);
+
+static bool impl_set_complexity(ov_codec *self, int complexity);
+
 static ov_json_value *impl_get_parameters(const ov_codec *self);
 static uint32_t impl_get_samplerate_hertz(const ov_codec *self);
 
@@ -144,9 +158,15 @@ static ov_codec *impl_codec_create(uint32_t ssid,
         goto error;
     }
 
+    opus_encoder_ctl(opus->encoder,
+                     OPUS_GET_COMPLEXITY(&opus->complexity.initial));
+    opus->complexity.current = opus->complexity.initial;
+
     codec->free = impl_free;
     codec->encode = impl_encode;
     codec->decode = impl_decode;
+    codec->conceal = impl_conceal;
+    codec->set_complexity = impl_set_complexity;
     codec->get_parameters = impl_get_parameters;
     codec->get_samplerate_hertz = impl_get_samplerate_hertz;
 
@@ -350,6 +370,127 @@ error:
 
 /*---------------------------------------------------------------------------*/
 
+static int32_t impl_conceal(ov_codec *self, const uint8_t *next,
+                            size_t next_length, uint8_t *output,
+                            size_t max_out_length) {
+
+    if (0 == self)
+        goto error;
+    if (0 == output)
+        goto error;
+
+    if (MAGIC_NUMBER != self->type) {
+
+        ov_log_error("Wrong codec type received");
+        goto error;
+    }
+
+    ov_codec_opus *codec = (ov_codec_opus *)self;
+
+    if (0 == codec->decoder) {
+
+        ov_log_error("Decoder not initialized");
+        goto error;
+    }
+
+    if ((max_out_length == 0) || (max_out_length > 2 * (unsigned)INT_MAX)) {
+
+        ov_log_error("Output buffer length out of range");
+        goto error;
+    }
+
+    /* conceal as many samples as the last frame carried */
+
+    opus_int32 samples = 0;
+
+    int error = opus_decoder_ctl(codec->decoder,
+                                 OPUS_GET_LAST_PACKET_DURATION(&samples));
+
+    if ((OPUS_OK != error) || (0 >= samples)) {
+        samples = codec->sample_rate_hertz / 50;
+    }
+
+    samples = OV_MIN(samples, (opus_int32)(max_out_length / 2));
+
+    int samples_decoded = 0;
+
+    if ((0 != next) && (0 < next_length)) {
+
+        /* recover the lost frame from the in-band FEC of the next one,
+         * falls back to PLC if the next frame carries no FEC */
+        samples_decoded = opus_decode(codec->decoder, next, next_length,
+                                      (opus_int16 *)output, samples, 1);
+
+    } else {
+
+        samples_decoded = opus_decode(codec->decoder, NULL, 0,
+                                      (opus_int16 *)output, samples, 0);
+    }
+
+    if (0 > samples_decoded) {
+
+        ov_log_error("Could not conceal frame: %s",
+                     opus_strerror(samples_decoded));
+
+        goto error;
+    }
+
+    return 2 * samples_decoded;
+
+error:
+
+    return -1;
+}
+
+/*---------------------------------------------------------------------------*/
+
+static bool impl_set_complexity(ov_codec *self, int complexity) {
+
+    if (0 == self)
+        goto error;
+
+    if (MAGIC_NUMBER != self->type) {
+
+        ov_log_error("Wrong codec type received");
+        goto error;
+    }
+
+    ov_codec_opus *codec = (ov_codec_opus *)self;
+
+    if (0 == codec->encoder) {
+
+        ov_log_error("Encoder not initialized");
+        goto error;
+    }
+
+    if (OV_CODEC_COMPLEXITY_DEFAULT == complexity)
+        complexity = codec->complexity.initial;
+
+    if ((0 > complexity) || (10 < complexity))
+        goto error;
+
+    if (complexity == codec->complexity.current)
+        return true;
+
+    int error =
+        opus_encoder_ctl(codec->encoder, OPUS_SET_COMPLEXITY(complexity));
+
+    if (OPUS_OK != error) {
+
+        ov_log_error("Could not set complexity: %s", opus_strerror(error));
+        goto error;
+    }
+
+    codec->complexity.current = complexity;
+    return true;
+
+error:
+
+    return false;
+}
+
+/*---------------------------------------------------------------------------*/
+
 static ov_json_value *impl_get_parameters(const ov_codec *self) {
 
     if (0 == self)
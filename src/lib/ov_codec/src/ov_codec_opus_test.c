@@ -478,6 +478,119 @@ static int test_impl_decode() {
 
 /*---------------------------------------------------------------------------*/
 
+static int test_impl_conceal() {
+
+    const int samplerate_hz = 48000;
+    const size_t samples = 960; // 20ms
+
+    int16_t pcm[960] = {0};
+    uint8_t encoded[3][1024] = {0};
+    int32_t encoded_length[3] = {0};
+    int16_t decoded[2 * 960] = {0};
+
+    ov_json_value *json = ov_json_object();
+    ov_codec_parameters_set_sample_rate_hertz(json, samplerate_hz);
+
+    ov_codec *codec = impl_codec_create(0, json);
+    testrun(0 != codec);
+
+    json = json->free(json);
+
+    testrun(-1 == impl_conceal(0, 0, 0, 0, 0));
+    testrun(-1 == impl_conceal(codec, 0, 0, 0, sizeof(decoded)));
+    testrun(-1 == impl_conceal(codec, 0, 0, (uint8_t *)decoded, 0));
+    testrun(-1 == ov_codec_conceal(0, 0, 0, (uint8_t *)decoded,
+                                   sizeof(decoded)));
+
+    /* sender with in-band FEC enabled */
+
+    OpusEncoder *encoder = ((ov_codec_opus *)codec)->encoder;
+    testrun(OPUS_OK == opus_encoder_ctl(encoder, OPUS_SET_INBAND_FEC(1)));
+    testrun(OPUS_OK ==
+            opus_encoder_ctl(encoder, OPUS_SET_PACKET_LOSS_PERC(20)));
+
+    for (size_t f = 0; f < 3; ++f) {
+
+        for (size_t i = 0; i < samples; ++i) {
+            pcm[i] = (int16_t)(8000 * sin(2 * M_PI * 440 *
+                                          (f * samples + i) / samplerate_hz));
+        }
+
+        encoded_length[f] = impl_encode(codec, (uint8_t *)pcm, 2 * samples,
+                                        encoded[f], sizeof(encoded[f]));
+        testrun(0 < encoded_length[f]);
+    }
+
+    testrun(2 * samples == (size_t)impl_decode(codec, 1, encoded[0],
+                                               encoded_length[0],
+                                               (uint8_t *)decoded,
+                                               sizeof(decoded)));
+
+    /* frame 1 lost, recovered from frame 2 */
+
+    testrun(2 * samples == (size_t)ov_codec_conceal(
+                               codec, encoded[2], encoded_length[2],
+                               (uint8_t *)decoded, sizeof(decoded)));
+
+    testrun(2 * samples == (size_t)impl_decode(codec, 3, encoded[2],
+                                               encoded_length[2],
+                                               (uint8_t *)decoded,
+                                               sizeof(decoded)));
+
+    /* frame 3 lost, nothing following - PLC */
+
+    testrun(2 * samples == (size_t)impl_conceal(codec, 0, 0,
+                                                (uint8_t *)decoded,
+                                                sizeof(decoded)));
+
+    /* limited by the output buffer */
+
+    testrun(480 == impl_conceal(codec, 0, 0, (uint8_t *)decoded, 480));
+
+    codec = impl_free(codec);
+    testrun(0 == codec);
+
+    return testrun_log_success();
+}
+
+/*---------------------------------------------------------------------------*/
+
+static int test_impl_set_complexity() {
+
+    ov_json_value *json = ov_json_object();
+    ov_codec_parameters_set_sample_rate_hertz(json, 48000);
+
+    ov_codec *codec = impl_codec_create(0, json);
+    testrun(0 != codec);
+
+    json = json->free(json);
+
+    ov_codec_opus *opus = (ov_codec_opus *)codec;
+    opus_int32 complexity = -1;
+
+    testrun(!impl_set_complexity(0, 1));
+    testrun(!ov_codec_set_complexity(0, 1));
+    testrun(!impl_set_complexity(codec, 11));
+    testrun(!impl_set_complexity(codec, -2));
+
+    testrun(ov_codec_set_complexity(codec, 2));
+    testrun(OPUS_OK ==
+            opus_encoder_ctl(opus->encoder, OPUS_GET_COMPLEXITY(&complexity)));
+    testrun(2 == complexity);
+
+    testrun(impl_set_complexity(codec, OV_CODEC_COMPLEXITY_DEFAULT));
+    testrun(OPUS_OK ==
+            opus_encoder_ctl(opus->encoder, OPUS_GET_COMPLEXITY(&complexity)));
+    testrun(opus->complexity.initial == complexity);
+
+    codec = impl_free(codec);
+    testrun(0 == codec);
+
+    return testrun_log_success();
+}
+
+/*---------------------------------------------------------------------------*/
+
 static int test_impl_get_parameters() {
 
     testrun(0 == impl_get_parameters(0));
@@ -553,6 +666,8 @@ static int test_impl_get_samplesrate_hertz() {
 
 OV_TEST_RUN("ov_codec_opus", test_ov_codec_opus_id, test_impl_codec_create,
             test_impl_free, test_impl_encode, test_impl_decode,
-            test_impl_get_parameters, test_impl_get_samplesrate_hertz);
+            test_impl_conceal, test_impl_set_complexity,
+            test_impl_get_parameters,
+            test_impl_get_samplesrate_hertz);
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,222 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_http_asset_cache.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_core
+
+        @brief          In memory LRU cache of static files served over HTTP.
+
+        Files are keyed by path and revalidated against their mtime and
+        size on each access, so a deployment is picked up without restart.
+
+        Precompressed variants are read from disk next to the file
+        (path.gz and path.br) if they are at least as new as the file,
+        so nothing is compressed at runtime. Variants are revalidated on
+        their own and carry their own ETag, so a replaced variant is picked
+        up even if the file itself is unchanged.
+
+        Files larger than config.max_file_bytes are not loaded. For these
+        only the metadata (size, mtime, ETag) is cached and the content
+        MUST be streamed from disk by the caller.
+
+        NOTE the cache is NOT threadsafe and intended to be used within the
+        eventloop of some webserver.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_http_asset_cache_h
+#define ov_http_asset_cache_h
+
+#include "ov_http_pointer.h"
+
+#include <ov_base/ov_memory_pointer.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define OV_HTTP_ASSET_ETAG_MAX 64
+
+#define OV_HTTP_ASSET_CACHE_DEFAULT_MAX_BYTES (64 * 1024 * 1024)
+#define OV_HTTP_ASSET_CACHE_DEFAULT_MAX_FILE_BYTES (4 * 1024 * 1024)
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_http_asset_cache ov_http_asset_cache;
+
+typedef enum ov_http_asset_encoding {
+
+    OV_HTTP_ASSET_IDENTITY = 0,
+    OV_HTTP_ASSET_GZIP = 1,
+    OV_HTTP_ASSET_BROTLI = 2,
+
+    OV_HTTP_ASSET_ENCODINGS = 3
+
+} ov_http_asset_encoding;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_http_asset {
+
+    size_t size;       // size of the identity content
+    uint64_t mtime;    // mtime of the identity content in nsec
+    bool loaded;       // false if the file exceeds max_file_bytes
+    bool utf8;         // identity content is some valid UTF-8 sequence
+
+    struct {
+
+        /* start == NULL if variant not available */
+        ov_memory_pointer content;
+        char etag[OV_HTTP_ASSET_ETAG_MAX];
+
+    } variant[OV_HTTP_ASSET_ENCODINGS];
+
+} ov_http_asset;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_http_asset_cache_config {
+
+    size_t max_bytes;      // overall content budget, default 64 MB
+    size_t max_file_bytes; // max size of a single file, default 4 MB
+
+} ov_http_asset_cache_config;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Read the config from some JSON object, either the "cache" object itself
+    or some parent containing it.
+*/
+ov_http_asset_cache_config
+ov_http_asset_cache_config_from_json(const ov_json_value *value);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns {"bytes":max_bytes, "file":max_file_bytes}
+*/
+ov_json_value *
+ov_http_asset_cache_config_to_json(ov_http_asset_cache_config config);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_http_asset_cache *
+ov_http_asset_cache_create(ov_http_asset_cache_config config);
+
+ov_http_asset_cache *ov_http_asset_cache_free(ov_http_asset_cache *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Get an asset for some path.
+
+    Will stat the file and (re)load it if it is not cached yet, or if
+    mtime or size changed since it was cached.
+
+    @returns asset or NULL if path is not some regular file.
+
+    NOTE the returned pointer is owned by the cache and valid until the next
+    call of any ov_http_asset_cache function.
+*/
+const ov_http_asset *ov_http_asset_cache_get(ov_http_asset_cache *self,
+                                             const char *path);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Drop all cached assets.
+*/
+bool ov_http_asset_cache_clear(ov_http_asset_cache *self);
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_http_asset_cache_stats {
+
+    size_t assets;
+    size_t bytes;
+
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+
+} ov_http_asset_cache_stats;
+
+ov_http_asset_cache_stats
+ov_http_asset_cache_get_stats(const ov_http_asset_cache *self);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      HTTP HELPER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+/**
+    Select the smallest available variant of asset accepted by the
+    Accept-Encoding header(s) of request.
+
+    @returns OV_HTTP_ASSET_IDENTITY if no encoded variant is acceptable
+*/
+ov_http_asset_encoding
+ov_http_asset_select_encoding(const ov_http_asset *asset,
+                              const ov_http_message *request);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Check the If-None-Match header(s) of request against the ETag of
+    variant encoding of asset.
+
+    @returns true if the client copy is still valid (304 to be send)
+*/
+bool ov_http_asset_not_modified(const ov_http_asset *asset,
+                                ov_http_asset_encoding encoding,
+                                const ov_http_message *request);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Add the asset specific headers ETag, Vary and (if encoded)
+    Content-Encoding to msg.
+
+    @NOTE MUST be used before ov_http_message_close_header
+*/
+bool ov_http_asset_add_header(ov_http_message *msg, const ov_http_asset *asset,
+                              ov_http_asset_encoding encoding);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns content coding token of encoding e.g. "gzip" or NULL for
+    identity
+*/
+const char *ov_http_asset_encoding_to_string(ov_http_asset_encoding encoding);
+
+#endif /* ov_http_asset_cache_h */
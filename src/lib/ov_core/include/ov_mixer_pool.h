@@ -0,0 +1,111 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_mixer_pool.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_core
+
+        @brief          Placement of users on mixers, grouped by host.
+
+        Mixers are identified by their socket. Unused mixers are kept in
+        a free list per host, the hosts in a heap ordered by
+
+            1. hosts without any overloaded mixer first
+            2. hosts with the most unused mixers first
+
+        so acquire picks some unused mixer of the least loaded healthy
+        host. All operations are O(log hosts) at most.
+
+        NOTE the pool is NOT threadsafe.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_mixer_pool_h
+#define ov_mixer_pool_h
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_mixer_pool ov_mixer_pool;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_mixer_pool_count {
+
+    size_t hosts;
+    size_t mixers;
+    size_t used;
+
+} ov_mixer_pool_count;
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_mixer_pool *ov_mixer_pool_create();
+ov_mixer_pool *ov_mixer_pool_free(ov_mixer_pool *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Add some unused mixer of host. A mixer already contained is replaced.
+*/
+bool ov_mixer_pool_add(ov_mixer_pool *self, int socket, const char *host);
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mixer_pool_remove(ov_mixer_pool *self, int socket);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Mark some unused mixer as used.
+
+    @returns socket of the mixer or -1 if there is no unused mixer
+*/
+int ov_mixer_pool_acquire(ov_mixer_pool *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Mark some used mixer as unused again.
+*/
+bool ov_mixer_pool_release(ov_mixer_pool *self, int socket);
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mixer_pool_set_overload(ov_mixer_pool *self, int socket,
+                                bool overloaded);
+
+/*----------------------------------------------------------------------------*/
+
+ov_mixer_pool_count ov_mixer_pool_count_mixers(const ov_mixer_pool *self);
+
+#endif /* ov_mixer_pool_h */
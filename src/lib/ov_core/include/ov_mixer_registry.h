@@ -56,6 +56,8 @@ typedef struct ov_mixer_data {
     ov_socket_data remote;
     char user[OV_HOST_NAME_MAX];
 
+    bool overloaded;
+
 } ov_mixer_data;
 
 /*----------------------------------------------------------------------------*/
@@ -89,6 +91,10 @@ bool ov_mixer_registry_unregister_mixer(ov_mixer_registry *self, int socket);
 
 /*----------------------------------------------------------------------------*/
 
+/**
+    Acquire some unused mixer for the user. Mixers of hosts without any
+    overloaded mixer are preferred.
+*/
 ov_mixer_data ov_mixer_registry_acquire_user(ov_mixer_registry *self,
                                              const char *uuid);
 
@@ -109,4 +115,13 @@ bool ov_mixer_registry_release_user(ov_mixer_registry *self, const char *uuid);
 
 ov_mixer_registry_count ov_mixer_registry_count_mixers(ov_mixer_registry *self);
 
+/*----------------------------------------------------------------------------*/
+
+/**
+    Mark the mixer at socket as (no longer) overloaded, as reported by the
+    mixer itself.
+*/
+bool ov_mixer_registry_set_overload(ov_mixer_registry *self, int socket,
+                                    bool overloaded);
+
 #endif /* ov_mixer_registry_h */
@@ -84,6 +84,7 @@
 
 #include "ov_domain.h"
 #include "ov_event_io.h"
+#include "ov_http_asset_cache.h"
 #include "ov_http_pointer.h"
 #include "ov_websocket_message.h"
 #include "ov_websocket_pointer.h"
@@ -105,6 +106,11 @@ struct ov_webserver_base_config {
     bool debug;
     bool ip4_only;
 
+    /* Enable kernel TLS, if supported by kernel and OpenSSL.
+     * Files larger than cache.max_file_bytes will then be sent using
+     * sendfile without copying the content to userspace. */
+    bool ktls;
+
     char name[OV_WEBSERVER_BASE_NAME_MAX];
     char domain_config_path[PATH_MAX];
 
@@ -115,6 +121,8 @@ struct ov_webserver_base_config {
 
     } limit;
 
+    ov_http_asset_cache_config cache;
+
     ov_http_message_config http_message;
     ov_websocket_frame_config websocket_frame;
 
@@ -293,6 +293,58 @@ bool ov_websocket_set_data(ov_websocket_frame *frame, const uint8_t *data,
 
 /*----------------------------------------------------------------------------*/
 
+/**
+    Reserve space for some payload within the frame buffer, to let the
+    caller serialise the payload in place instead of copying it with
+    ov_websocket_set_data.
+
+    Byte 0 (FIN and opcode) of the frame buffer is preserved.
+
+    @param frame    frame to use
+    @param length   length of the payload to be written
+    @param mask     if true the payload will be masked
+
+    @returns start of the payload area of length bytes within frame->buffer
+
+    @NOTE MUST be followed by ov_websocket_frame_set_header with the same
+    length and mask, once the payload is written.
+*/
+uint8_t *ov_websocket_frame_reserve(ov_websocket_frame *frame, size_t length,
+                                    bool mask);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Write the frame header in front of some payload, which is already
+    contained in frame->buffer at the position returned by
+    ov_websocket_frame_reserve.
+
+    If mask is set, the payload will be masked in place.
+
+    @returns true if the header was set (frame will be reparsed)
+*/
+bool ov_websocket_frame_set_header(ov_websocket_frame *frame, size_t length,
+                                   bool mask);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Encode some JSON value directly as (unmasked) payload of frame,
+    without any intermediate string.
+
+    @param frame        frame to use
+    @param value        value to encode
+    @param stringify    stringify config to use
+    @param length       encoded length of value
+                        @see ov_json_parser_calculate with stringify
+*/
+bool ov_websocket_frame_set_json(ov_websocket_frame *frame,
+                                 const ov_json_value *value,
+                                 const ov_json_stringify_config *stringify,
+                                 size_t length);
+
+/*----------------------------------------------------------------------------*/
+
 /**
     Unmask a frame if masking is set.
 
@@ -31,8 +31,7 @@
 
 #include <ov_base/ov_utils.h>
 
-#include <ov_base/ov_dict.h>
-#include <ov_base/ov_linked_list.h>
+#include <ov_base/ov_expiring_map.h>
 #include <ov_base/ov_registered_cache.h>
 #include <ov_base/ov_thread_lock.h>
 #include <ov_base/ov_time.h>
@@ -48,7 +47,7 @@ struct ov_event_async_store {
     ov_event_async_store_config config;
 
     ov_thread_lock lock;
-    ov_dict *dict;
+    ov_expiring_map *map;
 
     uint32_t invalidate_timer;
 };
@@ -82,59 +81,22 @@ static void *free_internal_session_data(void *self) {
 
 /*----------------------------------------------------------------------------*/
 
-struct container {
+static void timedout_internal_session_data(void *userdata, const char *key,
+                                          void *value) {
 
-    ov_list *list;
-    uint64_t now;
-};
-
-/*----------------------------------------------------------------------------*/
-
-static bool delete_keys_in_dict(void *item, void *data) {
+    UNUSED(userdata);
+    UNUSED(key);
 
-    OV_ASSERT(item);
-    OV_ASSERT(data);
+    internal_session_data *entry = (internal_session_data *)value;
+    OV_ASSERT(entry);
 
-    ov_dict *dict = ov_dict_cast(data);
-
-    internal_session_data *entry =
-        (internal_session_data *)ov_dict_remove(dict, item);
-
-    if (entry && entry->data.timedout.callback) {
+    if (entry->data.timedout.callback) {
 
         entry->data.timedout.callback(entry->data.timedout.userdata,
                                       entry->data);
 
         entry->data.value = NULL;
     }
-
-    entry = free_internal_session_data(entry);
-    return true;
-}
-
-/*----------------------------------------------------------------------------*/
-
-static bool search_timed_out_keys(const void *key, void *item, void *data) {
-
-    if (!key)
-        return true;
-
-    OV_ASSERT(item);
-    OV_ASSERT(data);
-    if (!item || !data)
-        goto error;
-
-    struct container *c = (struct container *)data;
-    internal_session_data *d = (internal_session_data *)item;
-
-    uint64_t lifetime = d->created_usec + d->max_lifetime_usec;
-
-    if (lifetime < c->now)
-        ov_list_push(c->list, (void *)key);
-
-    return true;
-error:
-    return false;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -153,22 +115,7 @@ static bool invalidate_run(uint32_t id, void *data) {
 
     /* locked */
 
-    struct container container = (struct container){
-
-        .list = ov_linked_list_create((ov_list_config){0}),
-        .now = ov_time_get_current_time_usecs()};
-
-    if (!ov_dict_for_each(store->dict, &container, search_timed_out_keys)) {
-        ov_log_error("Failed to search timedout items");
-        OV_ASSERT(1 == 0);
-    }
-
-    if (!ov_list_for_each(container.list, store->dict, delete_keys_in_dict)) {
-        ov_log_error("Failed to delete timedout ID items");
-        OV_ASSERT(1 == 0);
-    }
-
-    container.list = ov_list_free(container.list);
+    ov_expiring_map_expire(store->map, ov_time_get_current_time_usecs());
 
     /* unlock */
 
@@ -225,11 +172,12 @@ ov_event_async_store_create(ov_event_async_store_config config) {
 
     store->config = config;
 
-    ov_dict_config d_config = ov_dict_string_key_config(255);
-    d_config.value.data_function.free = free_internal_session_data;
+    store->map = ov_expiring_map_create((ov_expiring_map_config){
+        .wheel.resolution_usec = config.invalidate_check_interval_usec,
+        .value.free = free_internal_session_data,
+        .value.expired = timedout_internal_session_data});
 
-    store->dict = ov_dict_create(d_config);
-    if (!store->dict)
+    if (!store->map)
         goto error;
 
     ov_event_loop *loop = store->config.loop;
@@ -293,7 +241,7 @@ ov_event_async_store *ov_event_async_store_free(ov_event_async_store *self) {
         self->invalidate_timer = OV_TIMER_INVALID;
     }
 
-    self->dict = ov_dict_free(self->dict);
+    self->map = ov_expiring_map_free(self->map);
 
     if (!ov_thread_lock_unlock(&self->lock)) {
         ov_log_error("Failed to unlock for delete");
@@ -311,14 +259,11 @@ bool ov_event_async_set(ov_event_async_store *store, const char *id,
                         ov_event_async_data data, uint64_t max_lifetime_usec) {
 
     internal_session_data *internal = NULL;
-    char *key = NULL;
     bool result = false;
 
     if (!store || !id)
         goto error;
 
-    key = strdup(id);
-
     internal = ov_registered_cache_get(g_async_internal_cache);
     if (!internal)
         internal = calloc(1, sizeof(internal_session_data));
@@ -334,13 +279,12 @@ bool ov_event_async_set(ov_event_async_store *store, const char *id,
 
     /* locked */
 
-    if (!ov_dict_set(store->dict, key, internal, NULL)) {
+    if (!ov_expiring_map_set(store->map, id, internal, max_lifetime_usec)) {
         internal = free_internal_session_data(internal);
-        key = ov_data_pointer_free(key);
         goto unlock;
     }
 
-    /* We put the internal data to the dict,
+    /* We put the internal data to the map,
      * so everything is contained in the store,
      * but the data to store.
      * We finaly add the data here before unlock */
@@ -357,7 +301,6 @@ unlock:
     return result;
 error:
     free_internal_session_data(internal);
-    key = ov_data_pointer_free(key);
     return false;
 }
 
@@ -375,7 +318,7 @@ ov_event_async_data ov_event_async_unset(ov_event_async_store *store,
         goto error;
 
     internal_session_data *internal =
-        (internal_session_data *)ov_dict_remove(store->dict, id);
+        (internal_session_data *)ov_expiring_map_remove(store->map, id);
 
     if (internal) {
 
@@ -396,71 +339,35 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-struct container_socket {
-
-    int socket;
-    ov_list *list;
-};
-
-/*----------------------------------------------------------------------------*/
-
-static bool search_ids_of_socket(const void *key, void *val, void *data) {
-
-    if (!key)
-        return true;
-
-    struct container_socket *c = (struct container_socket *)data;
-    internal_session_data *d = (internal_session_data *)val;
-
-    if (c->socket == d->data.socket)
-        return ov_list_push(c->list, (void *)key);
-
-    return true;
-}
+static bool match_socket(const char *key, void *value, void *data) {
 
-/*----------------------------------------------------------------------------*/
+    UNUSED(key);
 
-static bool drop_entry(void *val, void *data) {
+    int *socket = (int *)data;
+    internal_session_data *d = (internal_session_data *)value;
 
-    ov_event_async_store *store = (ov_event_async_store *)data;
-    return ov_dict_del(store->dict, val);
+    return (*socket == d->data.socket);
 }
 
 /*----------------------------------------------------------------------------*/
 
 bool ov_event_async_drop(ov_event_async_store *store, int socket) {
 
-    ov_list *list = NULL;
-    bool result = false;
-
     if (!store)
         goto error;
 
-    list = ov_linked_list_create((ov_list_config){0});
-
     if (!ov_thread_lock_try_lock(&store->lock))
         goto error;
 
-    struct container_socket c =
-        (struct container_socket){.socket = socket, .list = list};
-
-    result = ov_dict_for_each(store->dict, &c, search_ids_of_socket);
+    ov_expiring_map_del_if(store->map, &socket, match_socket);
 
-    if (!result)
-        goto done;
-
-    result &= ov_list_for_each(list, store, drop_entry);
-
-done:
     if (!ov_thread_lock_unlock(&store->lock)) {
         ov_log_error("Failed to unlock");
         OV_ASSERT(1 == 0);
     }
 
-    ov_list_free(list);
-    return result;
+    return true;
 error:
-    ov_list_free(list);
     return false;
 }
 
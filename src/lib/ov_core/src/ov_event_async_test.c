@@ -52,7 +52,7 @@ int test_ov_event_async_store_create() {
 
     ov_event_async_store *store = ov_event_async_store_create(config);
     testrun(store);
-    testrun(store->dict);
+    testrun(store->map);
     testrun(OV_TIMER_INVALID != store->invalidate_timer);
     testrun(store->config.threadlock_timeout_usec ==
             IMPL_THREADLOCK_TIMEOUT_USEC);
@@ -138,30 +138,30 @@ int test_ov_event_async_set() {
     testrun(!ov_event_async_set(store, NULL, (ov_event_async_data){0}, 0));
     testrun(!ov_event_async_set(NULL, "1", (ov_event_async_data){0}, 0));
 
-    testrun(!ov_dict_get(store->dict, "1"));
+    testrun(!ov_expiring_map_get(store->map, "1"));
     testrun(ov_event_async_set(store, "1", (ov_event_async_data){0}, 0));
-    testrun(ov_dict_get(store->dict, "1"));
+    testrun(ov_expiring_map_get(store->map, "1"));
 
     uint64_t start = ov_time_get_current_time_usecs();
     usleep(1000);
 
     // override
     testrun(ov_event_async_set(store, "1", data1, 0));
-    testrun(ov_dict_get(store->dict, "1"));
-    testrun(1 == ov_dict_count(store->dict));
+    testrun(ov_expiring_map_get(store->map, "1"));
+    testrun(1 == ov_expiring_map_count(store->map));
 
     testrun(ov_event_async_set(store, "2", data2, 2));
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
 
     testrun(ov_event_async_set(store, "3", data3, 1000));
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     usleep(1000);
 
     // check content
     uint64_t now = ov_time_get_current_time_usecs();
     internal_session_data *internal =
-        (internal_session_data *)ov_dict_get(store->dict, "1");
+        (internal_session_data *)ov_expiring_map_get(store->map, "1");
     testrun(internal);
     testrun(internal->created_usec > start);
     testrun(internal->created_usec < now);
@@ -169,7 +169,7 @@ int test_ov_event_async_set() {
     testrun(internal->data.socket == 1);
     testrun(internal->data.value == val1);
 
-    internal = (internal_session_data *)ov_dict_get(store->dict, "2");
+    internal = (internal_session_data *)ov_expiring_map_get(store->map, "2");
     testrun(internal);
     testrun(internal->created_usec > start);
     testrun(internal->created_usec < now);
@@ -177,7 +177,7 @@ int test_ov_event_async_set() {
     testrun(internal->data.socket == 2);
     testrun(internal->data.value == val2);
 
-    internal = (internal_session_data *)ov_dict_get(store->dict, "3");
+    internal = (internal_session_data *)ov_expiring_map_get(store->map, "3");
     testrun(internal);
     testrun(internal->created_usec > start);
     testrun(internal->created_usec < now);
@@ -187,29 +187,29 @@ int test_ov_event_async_set() {
 
     // remove some item
     ov_event_async_data out = ov_event_async_unset(store, "2");
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
     testrun(out.socket == 2);
     testrun(out.value == val2);
 
     // try to add locked
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
     testrun(ov_thread_lock_try_lock(&store->lock));
     testrun(!ov_event_async_set(store, "2", data2, 0));
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
     testrun(ov_thread_lock_unlock(&store->lock));
     testrun(ov_event_async_set(store, "2", data2, 0));
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     // remove 2 again
     out = ov_event_async_unset(store, "2");
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
     testrun(out.socket == 2);
     testrun(out.value == val2);
     out.value = ov_json_value_free(out.value);
 
     // remove 3
     out = ov_event_async_unset(store, "3");
-    testrun(1 == ov_dict_count(store->dict));
+    testrun(1 == ov_expiring_map_count(store->map));
     testrun(out.socket == 3);
     testrun(out.value == val3);
     out.value = ov_json_value_free(out.value);
@@ -245,7 +245,7 @@ int test_ov_event_async_unset() {
         store, "3",
         (ov_event_async_data){.socket = 3, .value = ov_json_object()}, 1000));
 
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     ov_event_async_data out = ov_event_async_unset(NULL, NULL);
     testrun(out.socket == 0);
@@ -259,14 +259,14 @@ int test_ov_event_async_unset() {
     testrun(out.socket == 0);
     testrun(out.value == NULL);
 
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     out = ov_event_async_unset(store, "1");
     testrun(out.socket == 1);
     testrun(out.value != NULL);
     out.value = ov_json_value_free(out.value);
 
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
 
     // try to unset non set
     out = ov_event_async_unset(store, "1");
@@ -279,7 +279,7 @@ int test_ov_event_async_unset() {
     testrun(out.socket == 0);
     testrun(out.value == NULL);
 
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
 
     // unlock and unset
     testrun(ov_thread_lock_unlock(&store->lock));
@@ -288,7 +288,7 @@ int test_ov_event_async_unset() {
     testrun(out.value != NULL);
     out.value = ov_json_value_free(out.value);
 
-    testrun(1 == ov_dict_count(store->dict));
+    testrun(1 == ov_expiring_map_count(store->map));
 
     testrun(NULL == ov_event_async_store_free(store));
     testrun(NULL == ov_event_loop_free(loop));
@@ -346,32 +346,32 @@ int check_ov_event_async_invalidation() {
         store, "3",
         (ov_event_async_data){.socket = 3, .value = ov_json_object()}, 200000));
 
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     /* check timer not fired */
 
     testrun(loop->run(loop, OV_RUN_ONCE));
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     /* expect first invalidation */
     testrun(loop->run(loop, 220000));
 
-    testrun(2 == ov_dict_count(store->dict));
-    testrun(ov_dict_get(store->dict, "1"));
-    testrun(ov_dict_get(store->dict, "2"));
+    testrun(2 == ov_expiring_map_count(store->map));
+    testrun(ov_expiring_map_get(store->map, "1"));
+    testrun(ov_expiring_map_get(store->map, "2"));
 
     /* expect next invalidation */
 
     testrun(loop->run(loop, 300000));
 
-    testrun(1 == ov_dict_count(store->dict));
-    testrun(ov_dict_get(store->dict, "2"));
+    testrun(1 == ov_expiring_map_count(store->map));
+    testrun(ov_expiring_map_get(store->map, "2"));
 
     /* expect last invalidation */
 
     testrun(loop->run(loop, 500000));
 
-    testrun(0 == ov_dict_count(store->dict));
+    testrun(0 == ov_expiring_map_count(store->map));
 
     /* set same values again */
 
@@ -390,18 +390,18 @@ int check_ov_event_async_invalidation() {
     /* lock store */
     testrun(ov_thread_lock_try_lock(&store->lock));
 
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
     testrun(loop->run(loop, 50000));
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
 
     /* unlock and expect deletion of first two timed out items */
     testrun(ov_thread_lock_unlock(&store->lock));
 
     testrun(loop->run(loop, 50000));
-    testrun(1 == ov_dict_count(store->dict));
+    testrun(1 == ov_expiring_map_count(store->map));
 
     testrun(loop->run(loop, 500000));
-    testrun(0 == ov_dict_count(store->dict));
+    testrun(0 == ov_expiring_map_count(store->map));
 
     /* check timeout callback */
 
@@ -730,12 +730,12 @@ int test_ov_event_async_drop() {
     testrun(ov_event_async_set(store, "2", data2, 0));
     testrun(ov_event_async_set(store, "3", data3, 0));
 
-    testrun(3 == ov_dict_count(store->dict));
+    testrun(3 == ov_expiring_map_count(store->map));
     testrun(ov_event_async_drop(store, 1));
-    testrun(2 == ov_dict_count(store->dict));
+    testrun(2 == ov_expiring_map_count(store->map));
 
     testrun(ov_event_async_drop(store, 2));
-    testrun(0 == ov_dict_count(store->dict));
+    testrun(0 == ov_expiring_map_count(store->map));
 
     testrun(NULL == ov_event_async_store_free(store));
     testrun(NULL == ov_event_loop_free(loop));
@@ -0,0 +1,853 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_http_asset_cache.c
+
+        @date           2026-10-18
+
+        @ingroup        ov_core
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_http_asset_cache.h"
+
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#include <ov_base/ov_config_keys.h>
+#include <ov_base/ov_dict.h>
+#include <ov_base/ov_file.h>
+#include <ov_base/ov_utf8.h>
+#include <ov_base/ov_utils.h>
+
+#include <ov_format/ov_file_format.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define IMPL_DEFAULT_SLOTS 255
+
+static const char *suffix[OV_HTTP_ASSET_ENCODINGS] = {NULL, ".gz", ".br"};
+static const char *token[OV_HTTP_ASSET_ENCODINGS] = {NULL, "gzip", "br"};
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Entry Entry;
+
+/* stat of some encoded variant file, all 0 if not present */
+typedef struct VariantFile {
+
+    uint64_t mtime;
+    size_t size;
+
+} VariantFile;
+
+struct Entry {
+
+    ov_http_asset asset;
+    size_t bytes;
+
+    /* variant files as seen at load, revalidated independent
+     * of the identity file */
+    VariantFile file[OV_HTTP_ASSET_ENCODINGS];
+
+    /* key of the entry within the dict, owned by the dict */
+    const char *path;
+
+    Entry *prev;
+    Entry *next;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_http_asset_cache {
+
+    ov_http_asset_cache_config config;
+
+    ov_dict *entries;
+
+    /* LRU order, head is the most recently used */
+    Entry *head;
+    Entry *tail;
+
+    ov_http_asset_cache_stats stats;
+};
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #ENTRY
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void entry_drop_variant(Entry *entry, ov_http_asset_encoding encoding) {
+
+    OV_ASSERT(entry->bytes >= entry->asset.variant[encoding].content.length);
+    entry->bytes -= entry->asset.variant[encoding].content.length;
+
+    entry->asset.variant[encoding].content.start = ov_data_pointer_free(
+        (void *)entry->asset.variant[encoding].content.start);
+    entry->asset.variant[encoding].content.length = 0;
+    entry->asset.variant[encoding].etag[0] = 0;
+
+    entry->file[encoding] = (VariantFile){0};
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void entry_drop_content(Entry *entry) {
+
+    for (size_t i = 0; i < OV_HTTP_ASSET_ENCODINGS; i++) {
+        entry_drop_variant(entry, i);
+    }
+
+    entry->asset.loaded = false;
+    entry->asset.utf8 = false;
+    entry->bytes = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *entry_free(void *data) {
+
+    Entry *entry = (Entry *)data;
+    if (!entry)
+        return NULL;
+
+    entry_drop_content(entry);
+    return ov_data_pointer_free(entry);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void lru_unlink(ov_http_asset_cache *self, Entry *entry) {
+
+    if (entry->prev) {
+        entry->prev->next = entry->next;
+    } else if (self->head == entry) {
+        self->head = entry->next;
+    }
+
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    } else if (self->tail == entry) {
+        self->tail = entry->prev;
+    }
+
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void lru_push_front(ov_http_asset_cache *self, Entry *entry) {
+
+    entry->prev = NULL;
+    entry->next = self->head;
+
+    if (self->head)
+        self->head->prev = entry;
+
+    self->head = entry;
+
+    if (!self->tail)
+        self->tail = entry;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void remove_entry(ov_http_asset_cache *self, Entry *entry) {
+
+    lru_unlink(self, entry);
+
+    OV_ASSERT(self->stats.bytes >= entry->bytes);
+    self->stats.bytes -= entry->bytes;
+
+    /* will free the key and the entry */
+    ov_dict_del(self->entries, entry->path);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t mtime_nsec(const struct stat *st) {
+
+    return (uint64_t)st->st_mtim.tv_sec * 1000000000ULL +
+           (uint64_t)st->st_mtim.tv_nsec;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static VariantFile variant_file(const char *path,
+                                ov_http_asset_encoding encoding,
+                                char variant_path[PATH_MAX]) {
+
+    struct stat st = {0};
+
+    ssize_t len =
+        snprintf(variant_path, PATH_MAX, "%s%s", path, suffix[encoding]);
+
+    if ((len < 0) || (len >= PATH_MAX))
+        return (VariantFile){0};
+
+    if ((0 != stat(variant_path, &st)) || !S_ISREG(st.st_mode))
+        return (VariantFile){0};
+
+    return (VariantFile){.mtime = mtime_nsec(&st), .size = st.st_size};
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_variant(Entry *entry, const char *path,
+                         ov_http_asset_encoding encoding) {
+
+    char variant_path[PATH_MAX] = {0};
+
+    VariantFile file = variant_file(path, encoding, variant_path);
+
+    /* remembered even if not used, to not reload it on each access */
+    entry->file[encoding] = file;
+
+    if (0 == file.mtime)
+        return false;
+
+    /* Ignore outdated variants from some older deployment */
+    if (file.mtime < entry->asset.mtime)
+        return false;
+
+    /* No need to serve some variant, which is not smaller */
+    if (file.size >= entry->asset.size)
+        return false;
+
+    uint8_t *buffer = NULL;
+    size_t size = 0;
+
+    if (OV_FILE_SUCCESS != ov_file_read(variant_path, &buffer, &size))
+        return false;
+
+    if (size != file.size) {
+
+        /* file changed between stat and read */
+        buffer = ov_data_pointer_free(buffer);
+        entry->file[encoding] = (VariantFile){0};
+        return false;
+    }
+
+    entry->asset.variant[encoding].content =
+        (ov_memory_pointer){.start = buffer, .length = size};
+
+    /* The ETag covers the variant file, as it may be replaced
+     * without touching the identity file */
+
+    snprintf(entry->asset.variant[encoding].etag, OV_HTTP_ASSET_ETAG_MAX,
+             "\"%" PRIx64 "-%zx-%s\"", file.mtime, file.size, token[encoding]);
+
+    entry->bytes += size;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void revalidate_variants(ov_http_asset_cache *self, Entry *entry) {
+
+    char variant_path[PATH_MAX] = {0};
+
+    if (!entry->asset.loaded)
+        return;
+
+    for (size_t i = OV_HTTP_ASSET_GZIP; i < OV_HTTP_ASSET_ENCODINGS; i++) {
+
+        VariantFile file = variant_file(entry->path, i, variant_path);
+
+        if ((file.mtime == entry->file[i].mtime) &&
+            (file.size == entry->file[i].size))
+            continue;
+
+        self->stats.bytes -= entry->bytes;
+
+        entry_drop_variant(entry, i);
+        load_variant(entry, entry->path, i);
+
+        self->stats.bytes += entry->bytes;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_entry(ov_http_asset_cache *self, Entry *entry,
+                       const char *path, const struct stat *st) {
+
+    entry_drop_content(entry);
+
+    entry->asset.size = st->st_size;
+    entry->asset.mtime = mtime_nsec(st);
+
+    snprintf(entry->asset.variant[OV_HTTP_ASSET_IDENTITY].etag,
+             OV_HTTP_ASSET_ETAG_MAX, "\"%" PRIx64 "-%zx\"", entry->asset.mtime,
+             entry->asset.size);
+
+    if (entry->asset.size > self->config.max_file_bytes) {
+
+        /* checked at disk once per mtime, not per request */
+        entry->asset.utf8 = ov_file_encoding_is_utf8(path);
+        return true;
+    }
+
+    uint8_t *buffer = NULL;
+    size_t size = 0;
+
+    if (0 == entry->asset.size) {
+
+        /* empty file, but valid content */
+        buffer = calloc(1, 1);
+
+    } else if (OV_FILE_SUCCESS != ov_file_read(path, &buffer, &size)) {
+        goto error;
+    }
+
+    if (!buffer)
+        goto error;
+
+    if (size != entry->asset.size) {
+
+        /* file changed between stat and read */
+        buffer = ov_data_pointer_free(buffer);
+        goto error;
+    }
+
+    entry->asset.variant[OV_HTTP_ASSET_IDENTITY].content =
+        (ov_memory_pointer){.start = buffer, .length = size};
+
+    entry->asset.utf8 = ov_utf8_validate_sequence(buffer, size);
+    entry->bytes = size;
+
+    load_variant(entry, path, OV_HTTP_ASSET_GZIP);
+    load_variant(entry, path, OV_HTTP_ASSET_BROTLI);
+
+    entry->asset.loaded = true;
+    return true;
+error:
+    entry_drop_content(entry);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void evict(ov_http_asset_cache *self, Entry *keep) {
+
+    while (self->tail && (self->stats.bytes > self->config.max_bytes)) {
+
+        Entry *victim = self->tail;
+
+        if (victim == keep) {
+
+            if (!victim->prev)
+                break;
+
+            victim = victim->prev;
+        }
+
+        remove_entry(self, victim);
+        self->stats.evictions++;
+    }
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_http_asset_cache *
+ov_http_asset_cache_create(ov_http_asset_cache_config config) {
+
+    ov_http_asset_cache *self = calloc(1, sizeof(ov_http_asset_cache));
+    if (!self)
+        goto error;
+
+    if (0 == config.max_bytes)
+        config.max_bytes = OV_HTTP_ASSET_CACHE_DEFAULT_MAX_BYTES;
+
+    if (0 == config.max_file_bytes)
+        config.max_file_bytes = OV_HTTP_ASSET_CACHE_DEFAULT_MAX_FILE_BYTES;
+
+    if (config.max_file_bytes > config.max_bytes)
+        config.max_file_bytes = config.max_bytes;
+
+    self->config = config;
+
+    ov_dict_config d_config = ov_dict_string_key_config(IMPL_DEFAULT_SLOTS);
+    d_config.value.data_function.free = entry_free;
+
+    self->entries = ov_dict_create(d_config);
+    if (!self->entries)
+        goto error;
+
+    return self;
+error:
+    ov_http_asset_cache_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_http_asset_cache *ov_http_asset_cache_free(ov_http_asset_cache *self) {
+
+    if (!self)
+        return NULL;
+
+    self->entries = ov_dict_free(self->entries);
+    return ov_data_pointer_free(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_http_asset_cache_config
+ov_http_asset_cache_config_from_json(const ov_json_value *value) {
+
+    ov_http_asset_cache_config out = {0};
+    if (!value)
+        goto error;
+
+    const ov_json_value *config = ov_json_object_get(value, OV_KEY_CACHE);
+    if (!config)
+        config = value;
+
+    out.max_bytes =
+        ov_json_number_get(ov_json_object_get(config, OV_KEY_BYTES));
+    out.max_file_bytes =
+        ov_json_number_get(ov_json_object_get(config, OV_KEY_FILE));
+
+    return out;
+error:
+    return (ov_http_asset_cache_config){0};
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *
+ov_http_asset_cache_config_to_json(ov_http_asset_cache_config config) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+
+    out = ov_json_object();
+    if (!out)
+        goto error;
+
+    val = ov_json_number(config.max_bytes);
+    if (!ov_json_object_set(out, OV_KEY_BYTES, val))
+        goto error;
+
+    val = ov_json_number(config.max_file_bytes);
+    if (!ov_json_object_set(out, OV_KEY_FILE, val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_http_asset_cache_clear(ov_http_asset_cache *self) {
+
+    if (!self)
+        return false;
+
+    self->head = NULL;
+    self->tail = NULL;
+    self->stats.bytes = 0;
+
+    return ov_dict_clear(self->entries);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_http_asset_cache_stats
+ov_http_asset_cache_get_stats(const ov_http_asset_cache *self) {
+
+    if (!self)
+        return (ov_http_asset_cache_stats){0};
+
+    ov_http_asset_cache_stats stats = self->stats;
+    stats.assets = ov_dict_count(self->entries);
+
+    return stats;
+}
+
+/*----------------------------------------------------------------------------*/
+
+const ov_http_asset *ov_http_asset_cache_get(ov_http_asset_cache *self,
+                                             const char *path) {
+
+    struct stat st = {0};
+    char *key = NULL;
+
+    if (!self || !path)
+        goto error;
+
+    Entry *entry = ov_dict_get(self->entries, path);
+
+    if ((0 != stat(path, &st)) || !S_ISREG(st.st_mode)) {
+
+        if (entry)
+            remove_entry(self, entry);
+
+        goto error;
+    }
+
+    if (entry && (entry->asset.mtime == mtime_nsec(&st)) &&
+        (entry->asset.size == (size_t)st.st_size)) {
+
+        self->stats.hits++;
+
+        lru_unlink(self, entry);
+        lru_push_front(self, entry);
+
+        revalidate_variants(self, entry);
+        evict(self, entry);
+
+        return &entry->asset;
+    }
+
+    self->stats.misses++;
+
+    if (!entry) {
+
+        entry = calloc(1, sizeof(Entry));
+        key = strdup(path);
+
+        if (!entry || !key) {
+            entry = ov_data_pointer_free(entry);
+            goto error;
+        }
+
+        if (!ov_dict_set(self->entries, key, entry, NULL)) {
+            entry = ov_data_pointer_free(entry);
+            goto error;
+        }
+
+        entry->path = key;
+        key = NULL;
+
+    } else {
+
+        lru_unlink(self, entry);
+        self->stats.bytes -= entry->bytes;
+    }
+
+    lru_push_front(self, entry);
+
+    if (!load_entry(self, entry, path, &st)) {
+
+        ov_log_error("failed to load asset %s", path);
+        remove_entry(self, entry);
+        goto error;
+    }
+
+    self->stats.bytes += entry->bytes;
+    evict(self, entry);
+
+    return &entry->asset;
+
+error:
+    key = ov_data_pointer_free(key);
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #HTTP HELPER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+const char *ov_http_asset_encoding_to_string(ov_http_asset_encoding encoding) {
+
+    if ((encoding < 0) || (encoding >= OV_HTTP_ASSET_ENCODINGS))
+        return NULL;
+
+    return token[encoding];
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool is_ws(uint8_t c) { return (c == ' ') || (c == '\t'); }
+
+/*----------------------------------------------------------------------------*/
+
+static bool coding_rejected(const uint8_t *params, size_t length) {
+
+    /* params are everything after the coding token e.g. ";q=0.5" */
+
+    const uint8_t *ptr = params;
+    const uint8_t *end = params + length;
+
+    while (ptr < end) {
+
+        if ((*ptr == 'q') || (*ptr == 'Q')) {
+
+            ptr++;
+
+            while ((ptr < end) && is_ws(*ptr))
+                ptr++;
+
+            if ((ptr >= end) || (*ptr != '='))
+                return false;
+
+            ptr++;
+
+            while ((ptr < end) && is_ws(*ptr))
+                ptr++;
+
+            /* q=0, q=0.0, q=0.00 or q=0.000 */
+
+            if ((ptr >= end) || (*ptr != '0'))
+                return false;
+
+            ptr++;
+
+            if ((ptr < end) && (*ptr == '.')) {
+
+                ptr++;
+
+                while ((ptr < end) && (*ptr == '0'))
+                    ptr++;
+            }
+
+            return (ptr >= end) || is_ws(*ptr) || (*ptr == ';');
+        }
+
+        ptr++;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void parse_accept_encoding(const ov_http_header *header,
+                                  bool accepted[OV_HTTP_ASSET_ENCODINGS]) {
+
+    const uint8_t *ptr = header->value.start;
+    const uint8_t *end = header->value.start + header->value.length;
+
+    while (ptr < end) {
+
+        while ((ptr < end) && (is_ws(*ptr) || (*ptr == ',')))
+            ptr++;
+
+        const uint8_t *item = ptr;
+
+        while ((ptr < end) && (*ptr != ','))
+            ptr++;
+
+        const uint8_t *item_end = ptr;
+
+        const uint8_t *name_end = item;
+
+        while ((name_end < item_end) && (*name_end != ';') &&
+               !is_ws(*name_end))
+            name_end++;
+
+        size_t name_len = name_end - item;
+
+        if (0 == name_len)
+            continue;
+
+        bool rejected = coding_rejected(name_end, item_end - name_end);
+
+        if ((1 == name_len) && ('*' == item[0])) {
+
+            for (size_t i = 1; i < OV_HTTP_ASSET_ENCODINGS; i++) {
+                accepted[i] = !rejected;
+            }
+
+            continue;
+        }
+
+        for (size_t i = 1; i < OV_HTTP_ASSET_ENCODINGS; i++) {
+
+            if ((name_len == strlen(token[i])) &&
+                (0 == strncasecmp(token[i], (char *)item, name_len))) {
+
+                accepted[i] = !rejected;
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_http_asset_encoding
+ov_http_asset_select_encoding(const ov_http_asset *asset,
+                              const ov_http_message *request) {
+
+    bool accepted[OV_HTTP_ASSET_ENCODINGS] = {0};
+
+    if (!asset || !request || !asset->loaded)
+        goto done;
+
+    size_t index = 0;
+    const ov_http_header *header = NULL;
+
+    while (NULL != (header = ov_http_header_get_next(
+                        request->header, request->config.header.capacity,
+                        &index, "Accept-Encoding"))) {
+
+        parse_accept_encoding(header, accepted);
+    }
+
+    ov_http_asset_encoding selected = OV_HTTP_ASSET_IDENTITY;
+    size_t size = asset->variant[OV_HTTP_ASSET_IDENTITY].content.length;
+
+    for (size_t i = 1; i < OV_HTTP_ASSET_ENCODINGS; i++) {
+
+        if (!accepted[i] || !asset->variant[i].content.start)
+            continue;
+
+        if (asset->variant[i].content.length <= size) {
+            selected = i;
+            size = asset->variant[i].content.length;
+        }
+    }
+
+    return selected;
+
+done:
+    return OV_HTTP_ASSET_IDENTITY;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool etag_in_list(const char *etag, const ov_http_header *header) {
+
+    size_t etag_len = strlen(etag);
+
+    const uint8_t *ptr = header->value.start;
+    const uint8_t *end = header->value.start + header->value.length;
+
+    while (ptr < end) {
+
+        while ((ptr < end) && (is_ws(*ptr) || (*ptr == ',')))
+            ptr++;
+
+        if (ptr >= end)
+            break;
+
+        if (*ptr == '*')
+            return true;
+
+        /* weak comparison, ignore W/ */
+        if (((size_t)(end - ptr) > 2) && (ptr[0] == 'W') && (ptr[1] == '/'))
+            ptr += 2;
+
+        const uint8_t *tag = ptr;
+
+        if (*ptr == '"') {
+
+            ptr++;
+
+            while ((ptr < end) && (*ptr != '"'))
+                ptr++;
+
+            if (ptr < end)
+                ptr++;
+
+        } else {
+
+            while ((ptr < end) && (*ptr != ',') && !is_ws(*ptr))
+                ptr++;
+        }
+
+        if (((size_t)(ptr - tag) == etag_len) &&
+            (0 == memcmp(tag, etag, etag_len)))
+            return true;
+
+        while ((ptr < end) && (*ptr != ','))
+            ptr++;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_http_asset_not_modified(const ov_http_asset *asset,
+                                ov_http_asset_encoding encoding,
+                                const ov_http_message *request) {
+
+    if (!asset || !request)
+        return false;
+
+    if ((encoding < 0) || (encoding >= OV_HTTP_ASSET_ENCODINGS))
+        return false;
+
+    size_t index = 0;
+    const ov_http_header *header = NULL;
+
+    while (NULL != (header = ov_http_header_get_next(
+                        request->header, request->config.header.capacity,
+                        &index, "If-None-Match"))) {
+
+        if (etag_in_list(asset->variant[encoding].etag, header))
+            return true;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_http_asset_add_header(ov_http_message *msg, const ov_http_asset *asset,
+                              ov_http_asset_encoding encoding) {
+
+    if (!msg || !asset)
+        goto error;
+
+    if ((encoding < 0) || (encoding >= OV_HTTP_ASSET_ENCODINGS))
+        goto error;
+
+    if (!ov_http_message_add_header_string(msg, "ETag",
+                                           asset->variant[encoding].etag))
+        goto error;
+
+    if (!ov_http_message_add_header_string(msg, "Vary", "Accept-Encoding"))
+        goto error;
+
+    if (token[encoding] &&
+        !ov_http_message_add_header_string(msg, "Content-Encoding",
+                                           token[encoding]))
+        goto error;
+
+    return true;
+error:
+    return false;
+}
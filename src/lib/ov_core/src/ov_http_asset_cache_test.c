@@ -0,0 +1,639 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_http_asset_cache_test.c
+
+        @date           2026-10-18
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_http_asset_cache.c"
+#include <ov_test/ov_test_file.h>
+#include <ov_test/testrun.h>
+
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+/*----------------------------------------------------------------------------*/
+
+static char *write_file(const char *dir, const char *name,
+                        const char *content) {
+
+    char *path = calloc(1, PATH_MAX);
+    snprintf(path, PATH_MAX, "%s/%s", dir, name);
+
+    FILE *file = fopen(path, "w");
+    if (!file)
+        return ov_data_pointer_free(path);
+
+    fwrite(content, 1, strlen(content), file);
+    fclose(file);
+
+    return path;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool set_mtime(const char *path, time_t sec) {
+
+    struct timeval times[2] = {{.tv_sec = sec}, {.tv_sec = sec}};
+    return 0 == utimes(path, times);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_http_message *request(const char *string) {
+
+    ov_http_message *msg = ov_http_message_create((ov_http_message_config){0});
+
+    if (!ov_buffer_set(msg->buffer, string, strlen(string)) ||
+        (OV_HTTP_PARSER_SUCCESS != ov_http_pointer_parse_message(msg, NULL)))
+        msg = ov_http_message_free(msg);
+
+    return msg;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CASES                                                      #CASES
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int test_ov_http_asset_cache_create() {
+
+    ov_http_asset_cache *cache =
+        ov_http_asset_cache_create((ov_http_asset_cache_config){0});
+
+    testrun(cache);
+    testrun(OV_HTTP_ASSET_CACHE_DEFAULT_MAX_BYTES == cache->config.max_bytes);
+    testrun(OV_HTTP_ASSET_CACHE_DEFAULT_MAX_FILE_BYTES ==
+            cache->config.max_file_bytes);
+
+    testrun(NULL == ov_http_asset_cache_free(cache));
+
+    cache = ov_http_asset_cache_create(
+        (ov_http_asset_cache_config){.max_bytes = 10, .max_file_bytes = 100});
+
+    testrun(cache);
+    testrun(10 == cache->config.max_bytes);
+    testrun(10 == cache->config.max_file_bytes);
+
+    testrun(NULL == ov_http_asset_cache_free(cache));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_cache_get() {
+
+    char *dir = ov_test_temp_dir(0);
+    testrun(dir);
+
+    char *a = write_file(dir, "a.txt", "0123456789");
+    testrun(a);
+    testrun(set_mtime(a, 1000));
+
+    ov_http_asset_cache *cache =
+        ov_http_asset_cache_create((ov_http_asset_cache_config){0});
+
+    testrun(!ov_http_asset_cache_get(NULL, NULL));
+    testrun(!ov_http_asset_cache_get(cache, NULL));
+    testrun(!ov_http_asset_cache_get(NULL, a));
+    testrun(!ov_http_asset_cache_get(cache, dir));
+    testrun(!ov_http_asset_cache_get(cache, "/not/existing/file"));
+
+    const ov_http_asset *asset = ov_http_asset_cache_get(cache, a);
+    testrun(asset);
+    testrun(asset->loaded);
+    testrun(asset->utf8);
+    testrun(10 == asset->size);
+    testrun(1000000000000ULL == asset->mtime);
+    testrun(10 == asset->variant[OV_HTTP_ASSET_IDENTITY].content.length);
+    testrun(0 == memcmp("0123456789",
+                        asset->variant[OV_HTTP_ASSET_IDENTITY].content.start,
+                        10));
+    testrun(!asset->variant[OV_HTTP_ASSET_GZIP].content.start);
+    testrun(!asset->variant[OV_HTTP_ASSET_BROTLI].content.start);
+    testrun(0 == strcmp("\"e8d4a51000-a\"",
+                        asset->variant[OV_HTTP_ASSET_IDENTITY].etag));
+
+    ov_http_asset_cache_stats stats = ov_http_asset_cache_get_stats(cache);
+    testrun(1 == stats.assets);
+    testrun(10 == stats.bytes);
+    testrun(0 == stats.hits);
+    testrun(1 == stats.misses);
+
+    testrun(asset == ov_http_asset_cache_get(cache, a));
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(1 == stats.hits);
+    testrun(1 == stats.misses);
+
+    // change content, revalidated by mtime and size
+
+    free(write_file(dir, "a.txt", "abc"));
+    testrun(set_mtime(a, 2000));
+
+    asset = ov_http_asset_cache_get(cache, a);
+    testrun(asset);
+    testrun(3 == asset->size);
+    testrun(0 == memcmp("abc",
+                        asset->variant[OV_HTTP_ASSET_IDENTITY].content.start,
+                        3));
+
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(1 == stats.assets);
+    testrun(3 == stats.bytes);
+    testrun(2 == stats.misses);
+
+    // precompressed variants
+
+    free(write_file(dir, "a.txt", "aaaaaaaaaaaaaaaaaaaaaaaa"));
+    testrun(set_mtime(a, 3000));
+
+    char *gz = write_file(dir, "a.txt.gz", "GZIP");
+    testrun(gz);
+    testrun(set_mtime(gz, 3000));
+
+    // outdated variant
+
+    char *br = write_file(dir, "a.txt.br", "BR");
+    testrun(br);
+    testrun(set_mtime(br, 1000));
+
+    asset = ov_http_asset_cache_get(cache, a);
+    testrun(asset);
+    testrun(4 == asset->variant[OV_HTTP_ASSET_GZIP].content.length);
+    testrun(0 == memcmp("GZIP",
+                        asset->variant[OV_HTTP_ASSET_GZIP].content.start, 4));
+    testrun(!asset->variant[OV_HTTP_ASSET_BROTLI].content.start);
+    testrun(0 != strcmp(asset->variant[OV_HTTP_ASSET_IDENTITY].etag,
+                        asset->variant[OV_HTTP_ASSET_GZIP].etag));
+
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(28 == stats.bytes);
+
+    // variants revalidated without change of the identity file
+
+    char etag[OV_HTTP_ASSET_ETAG_MAX] = {0};
+    strcpy(etag, asset->variant[OV_HTTP_ASSET_GZIP].etag);
+
+    free(write_file(dir, "a.txt.gz", "GZIP2"));
+    testrun(set_mtime(gz, 4000));
+    testrun(set_mtime(br, 4000));
+
+    asset = ov_http_asset_cache_get(cache, a);
+    testrun(asset);
+    testrun(5 == asset->variant[OV_HTTP_ASSET_GZIP].content.length);
+    testrun(0 == memcmp("GZIP2",
+                        asset->variant[OV_HTTP_ASSET_GZIP].content.start, 5));
+    testrun(0 != strcmp(etag, asset->variant[OV_HTTP_ASSET_GZIP].etag));
+    testrun(2 == asset->variant[OV_HTTP_ASSET_BROTLI].content.length);
+
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(31 == stats.bytes);
+    testrun(3 == stats.misses);
+
+    unlink(br);
+
+    asset = ov_http_asset_cache_get(cache, a);
+    testrun(asset);
+    testrun(!asset->variant[OV_HTTP_ASSET_BROTLI].content.start);
+    testrun(5 == asset->variant[OV_HTTP_ASSET_GZIP].content.length);
+
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(29 == stats.bytes);
+    testrun(3 == stats.misses);
+
+    // file removed
+
+    unlink(a);
+    testrun(!ov_http_asset_cache_get(cache, a));
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(0 == stats.assets);
+    testrun(0 == stats.bytes);
+
+    testrun(NULL == ov_http_asset_cache_free(cache));
+
+    unlink(gz);
+    unlink(br);
+    rmdir(dir);
+
+    free(a);
+    free(gz);
+    free(br);
+    free(dir);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_cache_config_from_json() {
+
+    ov_http_asset_cache_config config =
+        ov_http_asset_cache_config_from_json(NULL);
+
+    testrun(0 == config.max_bytes);
+    testrun(0 == config.max_file_bytes);
+
+    ov_json_value *json = ov_json_object();
+    ov_json_value *cache = ov_json_object();
+
+    testrun(ov_json_object_set(json, OV_KEY_CACHE, cache));
+    testrun(ov_json_object_set(cache, OV_KEY_BYTES, ov_json_number(100)));
+    testrun(ov_json_object_set(cache, OV_KEY_FILE, ov_json_number(10)));
+
+    config = ov_http_asset_cache_config_from_json(json);
+    testrun(100 == config.max_bytes);
+    testrun(10 == config.max_file_bytes);
+
+    config = ov_http_asset_cache_config_from_json(cache);
+    testrun(100 == config.max_bytes);
+    testrun(10 == config.max_file_bytes);
+
+    json = ov_json_value_free(json);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_cache_config_to_json() {
+
+    ov_json_value *json = ov_http_asset_cache_config_to_json(
+        (ov_http_asset_cache_config){.max_bytes = 100, .max_file_bytes = 10});
+
+    testrun(json);
+    testrun(100 == ov_json_number_get(ov_json_object_get(json, OV_KEY_BYTES)));
+    testrun(10 == ov_json_number_get(ov_json_object_get(json, OV_KEY_FILE)));
+
+    ov_http_asset_cache_config config =
+        ov_http_asset_cache_config_from_json(json);
+    testrun(100 == config.max_bytes);
+    testrun(10 == config.max_file_bytes);
+
+    json = ov_json_value_free(json);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_cache_get_large() {
+
+    char *dir = ov_test_temp_dir(0);
+    testrun(dir);
+
+    char *a = write_file(dir, "a.txt", "0123456789");
+    testrun(a);
+
+    ov_http_asset_cache *cache = ov_http_asset_cache_create(
+        (ov_http_asset_cache_config){.max_bytes = 100, .max_file_bytes = 5});
+
+    const ov_http_asset *asset = ov_http_asset_cache_get(cache, a);
+    testrun(asset);
+    testrun(!asset->loaded);
+    testrun(asset->utf8);
+    testrun(10 == asset->size);
+    testrun(!asset->variant[OV_HTTP_ASSET_IDENTITY].content.start);
+    testrun(0 != asset->variant[OV_HTTP_ASSET_IDENTITY].etag[0]);
+
+    ov_http_asset_cache_stats stats = ov_http_asset_cache_get_stats(cache);
+    testrun(1 == stats.assets);
+    testrun(0 == stats.bytes);
+
+    testrun(NULL == ov_http_asset_cache_free(cache));
+
+    unlink(a);
+    rmdir(dir);
+
+    free(a);
+    free(dir);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_cache_eviction() {
+
+    char *dir = ov_test_temp_dir(0);
+    testrun(dir);
+
+    char *a = write_file(dir, "a", "0123456789");
+    char *b = write_file(dir, "b", "0123456789");
+    char *c = write_file(dir, "c", "0123456789");
+    testrun(a && b && c);
+
+    ov_http_asset_cache *cache = ov_http_asset_cache_create(
+        (ov_http_asset_cache_config){.max_bytes = 25, .max_file_bytes = 10});
+
+    testrun(ov_http_asset_cache_get(cache, a));
+    testrun(ov_http_asset_cache_get(cache, b));
+
+    // touch a, b is the least recently used
+    testrun(ov_http_asset_cache_get(cache, a));
+    testrun(ov_http_asset_cache_get(cache, c));
+
+    ov_http_asset_cache_stats stats = ov_http_asset_cache_get_stats(cache);
+    testrun(2 == stats.assets);
+    testrun(20 == stats.bytes);
+    testrun(1 == stats.evictions);
+
+    testrun(ov_dict_is_set(cache->entries, a));
+    testrun(!ov_dict_is_set(cache->entries, b));
+    testrun(ov_dict_is_set(cache->entries, c));
+
+    testrun(ov_http_asset_cache_clear(cache));
+    stats = ov_http_asset_cache_get_stats(cache);
+    testrun(0 == stats.assets);
+    testrun(0 == stats.bytes);
+
+    testrun(ov_http_asset_cache_get(cache, b));
+
+    testrun(NULL == ov_http_asset_cache_free(cache));
+
+    unlink(a);
+    unlink(b);
+    unlink(c);
+    rmdir(dir);
+
+    free(a);
+    free(b);
+    free(c);
+    free(dir);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_select_encoding() {
+
+    ov_http_asset asset = {.loaded = true};
+
+    asset.variant[OV_HTTP_ASSET_IDENTITY].content =
+        (ov_memory_pointer){.start = (uint8_t *)"identity", .length = 8};
+
+    ov_http_message *msg = request("GET / HTTP/1.1\r\n\r\n");
+    testrun(msg);
+
+    testrun(OV_HTTP_ASSET_IDENTITY ==
+            ov_http_asset_select_encoding(NULL, NULL));
+    testrun(OV_HTTP_ASSET_IDENTITY ==
+            ov_http_asset_select_encoding(&asset, NULL));
+    testrun(OV_HTTP_ASSET_IDENTITY ==
+            ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    // no variants available
+    msg = request("GET / HTTP/1.1\r\nAccept-Encoding:gzip, br\r\n\r\n");
+    testrun(OV_HTTP_ASSET_IDENTITY ==
+            ov_http_asset_select_encoding(&asset, msg));
+
+    asset.variant[OV_HTTP_ASSET_GZIP].content =
+        (ov_memory_pointer){.start = (uint8_t *)"gzip", .length = 4};
+
+    testrun(OV_HTTP_ASSET_GZIP == ov_http_asset_select_encoding(&asset, msg));
+
+    asset.variant[OV_HTTP_ASSET_BROTLI].content =
+        (ov_memory_pointer){.start = (uint8_t *)"br", .length = 2};
+
+    testrun(OV_HTTP_ASSET_BROTLI ==
+            ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nAccept-Encoding: GZIP;q=0.8\r\n\r\n");
+    testrun(OV_HTTP_ASSET_GZIP == ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nAccept-Encoding: br;q=0, gzip\r\n\r\n");
+    testrun(OV_HTTP_ASSET_GZIP == ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nAccept-Encoding: *;q=0.000\r\n\r\n");
+    testrun(OV_HTTP_ASSET_IDENTITY ==
+            ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nAccept-Encoding: *\r\n\r\n");
+    testrun(OV_HTTP_ASSET_BROTLI ==
+            ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nAccept-Encoding: deflate\r\n"
+                  "Accept-Encoding: gzip\r\n\r\n");
+    testrun(OV_HTTP_ASSET_GZIP == ov_http_asset_select_encoding(&asset, msg));
+
+    // not loaded assets are always served as identity
+    asset.loaded = false;
+    testrun(OV_HTTP_ASSET_IDENTITY ==
+            ov_http_asset_select_encoding(&asset, msg));
+    msg = ov_http_message_free(msg);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_not_modified() {
+
+    ov_http_asset asset = {0};
+    strcpy(asset.variant[OV_HTTP_ASSET_IDENTITY].etag, "\"1-a\"");
+    strcpy(asset.variant[OV_HTTP_ASSET_GZIP].etag, "\"1-a-gzip\"");
+
+    ov_http_message *msg = request("GET / HTTP/1.1\r\n\r\n");
+
+    testrun(!ov_http_asset_not_modified(NULL, 0, NULL));
+    testrun(!ov_http_asset_not_modified(&asset, 0, NULL));
+    testrun(!ov_http_asset_not_modified(NULL, 0, msg));
+    testrun(!ov_http_asset_not_modified(&asset, 0, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nIf-None-Match: \"1-a\"\r\n\r\n");
+    testrun(ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_IDENTITY, msg));
+    testrun(!ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_GZIP, msg));
+    testrun(!ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_ENCODINGS, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\n"
+                  "If-None-Match: \"x\", W/\"1-a-gzip\"\r\n\r\n");
+    testrun(!ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_IDENTITY, msg));
+    testrun(ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_GZIP, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nIf-None-Match: \"1-a-\"\r\n\r\n");
+    testrun(!ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_IDENTITY, msg));
+    msg = ov_http_message_free(msg);
+
+    msg = request("GET / HTTP/1.1\r\nIf-None-Match: *\r\n\r\n");
+    testrun(ov_http_asset_not_modified(&asset, OV_HTTP_ASSET_IDENTITY, msg));
+    msg = ov_http_message_free(msg);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_add_header() {
+
+    ov_http_asset asset = {0};
+    strcpy(asset.variant[OV_HTTP_ASSET_IDENTITY].etag, "\"1-a\"");
+    strcpy(asset.variant[OV_HTTP_ASSET_BROTLI].etag, "\"1-a-br\"");
+
+    ov_http_message *msg = ov_http_create_status_string(
+        (ov_http_message_config){0}, (ov_http_version){.major = 1, .minor = 1},
+        200, OV_HTTP_OK);
+    testrun(msg);
+
+    testrun(!ov_http_asset_add_header(NULL, NULL, 0));
+    testrun(!ov_http_asset_add_header(msg, NULL, 0));
+    testrun(!ov_http_asset_add_header(NULL, &asset, 0));
+    testrun(!ov_http_asset_add_header(msg, &asset, OV_HTTP_ASSET_ENCODINGS));
+
+    testrun(ov_http_asset_add_header(msg, &asset, OV_HTTP_ASSET_BROTLI));
+    testrun(ov_http_message_close_header(msg));
+
+    testrun(OV_HTTP_PARSER_SUCCESS == ov_http_pointer_parse_message(msg, NULL));
+
+    const ov_http_header *header = ov_http_header_get(
+        msg->header, msg->config.header.capacity, "ETag");
+    testrun(header);
+    testrun(0 == memcmp("\"1-a-br\"", header->value.start, 8));
+
+    header = ov_http_header_get(msg->header, msg->config.header.capacity,
+                                "Content-Encoding");
+    testrun(header);
+    testrun(0 == memcmp("br", header->value.start, 2));
+
+    header =
+        ov_http_header_get(msg->header, msg->config.header.capacity, "Vary");
+    testrun(header);
+
+    msg = ov_http_message_free(msg);
+
+    testrun(NULL == ov_http_asset_encoding_to_string(OV_HTTP_ASSET_IDENTITY));
+    testrun(0 == strcmp("gzip",
+                        ov_http_asset_encoding_to_string(OV_HTTP_ASSET_GZIP)));
+    testrun(0 == strcmp("br", ov_http_asset_encoding_to_string(
+                                  OV_HTTP_ASSET_BROTLI)));
+    testrun(NULL == ov_http_asset_encoding_to_string(OV_HTTP_ASSET_ENCODINGS));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_http_asset_cache_benchmark() {
+
+    char *dir = ov_test_temp_dir(0);
+    testrun(dir);
+
+    char *a = write_file(dir, "index.html", "<html></html>");
+    testrun(a);
+
+    ov_http_asset_cache *cache =
+        ov_http_asset_cache_create((ov_http_asset_cache_config){0});
+
+    const size_t runs = 100000;
+    struct timespec start, stop;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (size_t i = 0; i < runs; i++) {
+
+        uint8_t *buffer = NULL;
+        size_t size = 0;
+        testrun(OV_FILE_SUCCESS == ov_file_read(a, &buffer, &size));
+        free(buffer);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    uint64_t read_nsec = (stop.tv_sec - start.tv_sec) * 1000000000ULL +
+                         stop.tv_nsec - start.tv_nsec;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (size_t i = 0; i < runs; i++) {
+        testrun(ov_http_asset_cache_get(cache, a));
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    uint64_t cache_nsec = (stop.tv_sec - start.tv_sec) * 1000000000ULL +
+                          stop.tv_nsec - start.tv_nsec;
+
+    fprintf(stdout,
+            "asset read from disk %" PRIu64 " ns/op, from cache %" PRIu64
+            " ns/op\n",
+            read_nsec / runs, cache_nsec / runs);
+
+    testrun(NULL == ov_http_asset_cache_free(cache));
+
+    unlink(a);
+    rmdir(dir);
+
+    free(a);
+    free(dir);
+
+    return testrun_log_success();
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CLUSTER                                                    #CLUSTER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_http_asset_cache_create);
+    testrun_test(test_ov_http_asset_cache_get);
+    testrun_test(test_ov_http_asset_cache_config_from_json);
+    testrun_test(test_ov_http_asset_cache_config_to_json);
+    testrun_test(test_ov_http_asset_cache_get_large);
+    testrun_test(test_ov_http_asset_cache_eviction);
+    testrun_test(test_ov_http_asset_select_encoding);
+    testrun_test(test_ov_http_asset_not_modified);
+    testrun_test(test_ov_http_asset_add_header);
+    testrun_test(test_ov_http_asset_cache_benchmark);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
@@ -1139,11 +1139,11 @@ static bool cb_wss_send_json(void *userdata, int socket,
     if (!conn->websocket)
         goto error;
 
-    str = ov_json_value_to_string(msg);
-    if (!str)
-        goto error;
+    ov_json_stringify_config stringify = ov_json_config_stringify_default();
 
-    ssize_t length = strlen(str);
+    ssize_t length = ov_json_parser_calculate(msg, &stringify);
+    if (length < 0)
+        goto error;
 
     /* Send the string over websocket frames */
 
@@ -1163,7 +1163,7 @@ static bool cb_wss_send_json(void *userdata, int socket,
 
         frame->buffer->start[0] = 0x80 | OV_WEBSOCKET_OPCODE_TEXT;
 
-        if (!ov_websocket_set_data(frame, (uint8_t *)str, length, false))
+        if (!ov_websocket_frame_set_json(frame, msg, &stringify, length))
             goto error;
 
         if (!ov_io_send(self->config.io, socket,
@@ -1177,6 +1177,10 @@ static bool cb_wss_send_json(void *userdata, int socket,
     /* send fragmented */
     size_t counter = 0;
 
+    str = ov_json_value_to_string(msg);
+    if (!str)
+        goto error;
+
     uint8_t *ptr = (uint8_t *)str;
     ssize_t open = length;
 
@@ -0,0 +1,528 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_mixer_pool.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_mixer_pool.h"
+
+#include <ov_base/ov_constants.h>
+#include <ov_base/ov_data_function.h>
+#include <ov_base/ov_dict.h>
+#include <ov_base/ov_node.h>
+#include <ov_base/ov_string.h>
+#include <ov_base/ov_utils.h>
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Host Host;
+
+typedef struct Slot {
+
+    ov_node node;
+
+    int socket;
+    bool used;
+    bool overloaded;
+
+    Host *host;
+
+} Slot;
+
+/*----------------------------------------------------------------------------*/
+
+struct Host {
+
+    char name[OV_HOST_NAME_MAX];
+
+    size_t mixers;
+    size_t unused;
+    size_t overloaded;
+
+    /* free list of the unused mixers */
+    Slot *free;
+
+    /* position within the host heap, 0 if not contained */
+    size_t heap_index;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_mixer_pool {
+
+    /* slots indexed by socket */
+    struct {
+        Slot **slot;
+        size_t capacity;
+        size_t count;
+    } slots;
+
+    ov_dict *hosts;
+
+    /*
+     * Heap of all hosts, the host to place the next user on at the root.
+     * Usable index runs from 1 through size.
+     */
+    struct {
+        Host **hosts;
+        size_t size;
+        size_t capacity;
+    } heap;
+
+    size_t used;
+};
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      HOST HEAP
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static bool host_before(const Host *a, const Host *b) {
+
+    if ((0 == a->unused) != (0 == b->unused))
+        return 0 != a->unused;
+
+    if ((0 == a->overloaded) != (0 == b->overloaded))
+        return 0 == a->overloaded;
+
+    return a->unused > b->unused;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void heap_place(ov_mixer_pool *self, size_t index, Host *host) {
+
+    self->heap.hosts[index] = host;
+    host->heap_index = index;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void heap_sift_up(ov_mixer_pool *self, size_t index) {
+
+    Host **heap = self->heap.hosts;
+    Host *host = heap[index];
+
+    while ((1 < index) && host_before(host, heap[index / 2])) {
+
+        heap_place(self, index, heap[index / 2]);
+        index /= 2;
+    }
+
+    heap_place(self, index, host);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void heap_sift_down(ov_mixer_pool *self, size_t index) {
+
+    Host **heap = self->heap.hosts;
+    Host *host = heap[index];
+    size_t size = self->heap.size;
+
+    while (2 * index <= size) {
+
+        size_t child = 2 * index;
+
+        if ((child < size) && host_before(heap[child + 1], heap[child])) {
+            ++child;
+        }
+
+        if (!host_before(heap[child], host)) {
+            break;
+        }
+
+        heap_place(self, index, heap[child]);
+        index = child;
+    }
+
+    heap_place(self, index, host);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool heap_insert(ov_mixer_pool *self, Host *host) {
+
+    OV_ASSERT(0 == host->heap_index);
+
+    if (self->heap.size + 1 >= self->heap.capacity) {
+
+        size_t capacity = 2 * self->heap.capacity;
+        if (capacity < 16)
+            capacity = 16;
+
+        Host **hosts = realloc(self->heap.hosts, capacity * sizeof(Host *));
+        if (!hosts)
+            return false;
+
+        self->heap.hosts = hosts;
+        self->heap.capacity = capacity;
+    }
+
+    ++self->heap.size;
+    heap_place(self, self->heap.size, host);
+    heap_sift_up(self, self->heap.size);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void heap_remove(ov_mixer_pool *self, Host *host) {
+
+    size_t index = host->heap_index;
+
+    if (0 == index)
+        return;
+
+    OV_ASSERT(host == self->heap.hosts[index]);
+
+    Host *last = self->heap.hosts[self->heap.size];
+
+    self->heap.hosts[self->heap.size] = 0;
+    --self->heap.size;
+    host->heap_index = 0;
+
+    if (last == host)
+        return;
+
+    heap_place(self, index, last);
+    heap_sift_up(self, index);
+    heap_sift_down(self, last->heap_index);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void heap_update(ov_mixer_pool *self, Host *host) {
+
+    heap_sift_up(self, host->heap_index);
+    heap_sift_down(self, host->heap_index);
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      SLOT FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void slot_set_unused(Slot *slot) {
+
+    Host *host = slot->host;
+
+    slot->used = false;
+    ov_node_push_front((void **)&host->free, slot);
+    host->unused++;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void slot_set_used(Slot *slot) {
+
+    Host *host = slot->host;
+
+    slot->used = true;
+    ov_node_unplug((void **)&host->free, slot);
+    host->unused--;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Slot *get_slot(const ov_mixer_pool *self, int socket) {
+
+    if ((socket < 0) || ((size_t)socket >= self->slots.capacity))
+        return NULL;
+
+    return self->slots.slot[socket];
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool set_slot(ov_mixer_pool *self, int socket, Slot *slot) {
+
+    if ((size_t)socket >= self->slots.capacity) {
+
+        size_t capacity = 2 * self->slots.capacity;
+        if (capacity <= (size_t)socket)
+            capacity = (size_t)socket + 1;
+
+        Slot **slots = realloc(self->slots.slot, capacity * sizeof(Slot *));
+        if (!slots)
+            return false;
+
+        memset(slots + self->slots.capacity, 0,
+               (capacity - self->slots.capacity) * sizeof(Slot *));
+
+        self->slots.slot = slots;
+        self->slots.capacity = capacity;
+    }
+
+    if (self->slots.slot[socket])
+        self->slots.count--;
+
+    if (slot)
+        self->slots.count++;
+
+    self->slots.slot[socket] = slot;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Host *get_host(ov_mixer_pool *self, const char *name) {
+
+    Host *host = ov_dict_get(self->hosts, name);
+    if (host)
+        return host;
+
+    host = calloc(1, sizeof(Host));
+    if (!host)
+        goto error;
+
+    strncpy(host->name, name, OV_HOST_NAME_MAX - 1);
+
+    if (!ov_dict_set(self->hosts, ov_string_dup(host->name), host, NULL))
+        goto error;
+
+    if (!heap_insert(self, host)) {
+        ov_dict_del(self->hosts, name);
+        return NULL;
+    }
+
+    return host;
+error:
+    host = ov_data_pointer_free(host);
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_mixer_pool *ov_mixer_pool_create() {
+
+    ov_mixer_pool *self = calloc(1, sizeof(ov_mixer_pool));
+    if (!self)
+        goto error;
+
+    ov_dict_config d_config = ov_dict_string_key_config(255);
+    d_config.value.data_function.free = ov_data_pointer_free;
+
+    self->hosts = ov_dict_create(d_config);
+    if (!self->hosts)
+        goto error;
+
+    return self;
+error:
+    ov_mixer_pool_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_mixer_pool *ov_mixer_pool_free(ov_mixer_pool *self) {
+
+    if (!self)
+        return NULL;
+
+    for (size_t i = 0; i < self->slots.capacity; ++i) {
+        self->slots.slot[i] = ov_data_pointer_free(self->slots.slot[i]);
+    }
+
+    self->slots.slot = ov_data_pointer_free(self->slots.slot);
+    self->hosts = ov_dict_free(self->hosts);
+    self->heap.hosts = ov_data_pointer_free(self->heap.hosts);
+    self = ov_data_pointer_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mixer_pool_add(ov_mixer_pool *self, int socket, const char *host) {
+
+    Slot *slot = NULL;
+
+    if (!self || !host || (socket < 0))
+        goto error;
+
+    ov_mixer_pool_remove(self, socket);
+
+    slot = calloc(1, sizeof(Slot));
+    if (!slot)
+        goto error;
+
+    slot->socket = socket;
+    slot->host = get_host(self, host);
+    if (!slot->host)
+        goto error;
+
+    if (!set_slot(self, socket, slot))
+        goto error;
+
+    slot->host->mixers++;
+    slot_set_unused(slot);
+    heap_update(self, slot->host);
+
+    return true;
+error:
+    if (slot && slot->host && (0 == slot->host->mixers)) {
+        heap_remove(self, slot->host);
+        ov_dict_del(self->hosts, host);
+    }
+    slot = ov_data_pointer_free(slot);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mixer_pool_remove(ov_mixer_pool *self, int socket) {
+
+    if (!self)
+        goto error;
+
+    Slot *slot = get_slot(self, socket);
+    if (!slot)
+        goto error;
+
+    Host *host = slot->host;
+
+    if (slot->used) {
+        self->used--;
+    } else {
+        ov_node_unplug((void **)&host->free, slot);
+        host->unused--;
+    }
+
+    if (slot->overloaded)
+        host->overloaded--;
+
+    host->mixers--;
+
+    if (0 == host->mixers) {
+        heap_remove(self, host);
+        ov_dict_del(self->hosts, host->name);
+    } else {
+        heap_update(self, host);
+    }
+
+    set_slot(self, socket, NULL);
+    slot = ov_data_pointer_free(slot);
+
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int ov_mixer_pool_acquire(ov_mixer_pool *self) {
+
+    if (!self || (0 == self->heap.size))
+        goto error;
+
+    Host *host = self->heap.hosts[1];
+    if (!host->free)
+        goto error;
+
+    Slot *slot = host->free;
+    slot_set_used(slot);
+    self->used++;
+
+    heap_sift_down(self, host->heap_index);
+
+    return slot->socket;
+error:
+    return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mixer_pool_release(ov_mixer_pool *self, int socket) {
+
+    if (!self)
+        goto error;
+
+    Slot *slot = get_slot(self, socket);
+    if (!slot || !slot->used)
+        goto error;
+
+    slot_set_unused(slot);
+    self->used--;
+
+    heap_sift_up(self, slot->host->heap_index);
+
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mixer_pool_set_overload(ov_mixer_pool *self, int socket,
+                                bool overloaded) {
+
+    if (!self)
+        goto error;
+
+    Slot *slot = get_slot(self, socket);
+    if (!slot)
+        goto error;
+
+    if (slot->overloaded == overloaded)
+        return true;
+
+    slot->overloaded = overloaded;
+
+    if (overloaded) {
+        slot->host->overloaded++;
+    } else {
+        slot->host->overloaded--;
+    }
+
+    heap_update(self, slot->host);
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_mixer_pool_count ov_mixer_pool_count_mixers(const ov_mixer_pool *self) {
+
+    if (!self)
+        return (ov_mixer_pool_count){0};
+
+    return (ov_mixer_pool_count){.hosts = self->heap.size,
+                                 .mixers = self->slots.count,
+                                 .used = self->used};
+}
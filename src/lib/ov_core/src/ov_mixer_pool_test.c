@@ -0,0 +1,322 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_mixer_pool_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_mixer_pool.c"
+#include <ov_test/testrun.h>
+
+/*----------------------------------------------------------------------------*/
+
+static bool heap_is_valid(const ov_mixer_pool *self) {
+
+    for (size_t i = 1; i <= self->heap.size; ++i) {
+
+        if (i != self->heap.hosts[i]->heap_index)
+            return false;
+
+        if ((1 < i) && host_before(self->heap.hosts[i],
+                                   self->heap.hosts[i / 2]))
+            return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_create() {
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+    testrun(pool->hosts);
+    testrun(0 == pool->heap.size);
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    testrun(NULL == ov_mixer_pool_free(NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_add() {
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+
+    testrun(!ov_mixer_pool_add(NULL, 1, "a"));
+    testrun(!ov_mixer_pool_add(pool, 1, NULL));
+    testrun(!ov_mixer_pool_add(pool, -1, "a"));
+
+    testrun(ov_mixer_pool_add(pool, 1, "a"));
+    testrun(ov_mixer_pool_add(pool, 2, "a"));
+    testrun(ov_mixer_pool_add(pool, 3, "b"));
+
+    ov_mixer_pool_count count = ov_mixer_pool_count_mixers(pool);
+    testrun(2 == count.hosts);
+    testrun(3 == count.mixers);
+    testrun(0 == count.used);
+
+    /* host a has the most unused mixers */
+
+    testrun(0 == strcmp("a", pool->heap.hosts[1]->name));
+    testrun(heap_is_valid(pool));
+
+    /* replaced */
+
+    testrun(ov_mixer_pool_add(pool, 1, "b"));
+    testrun(ov_mixer_pool_add(pool, 2, "b"));
+
+    count = ov_mixer_pool_count_mixers(pool);
+    testrun(1 == count.hosts);
+    testrun(3 == count.mixers);
+    testrun(!ov_dict_get(pool->hosts, "a"));
+    testrun(3 == ((Host *)ov_dict_get(pool->hosts, "b"))->unused);
+
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_remove() {
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+
+    testrun(!ov_mixer_pool_remove(NULL, 1));
+    testrun(!ov_mixer_pool_remove(pool, 1));
+
+    testrun(ov_mixer_pool_add(pool, 1, "a"));
+    testrun(ov_mixer_pool_add(pool, 2, "a"));
+    testrun(ov_mixer_pool_add(pool, 3, "b"));
+
+    testrun(-1 != ov_mixer_pool_acquire(pool));
+    testrun(ov_mixer_pool_set_overload(pool, 3, true));
+
+    testrun(ov_mixer_pool_remove(pool, 1));
+    testrun(ov_mixer_pool_remove(pool, 2));
+    testrun(!ov_mixer_pool_remove(pool, 2));
+    testrun(heap_is_valid(pool));
+
+    ov_mixer_pool_count count = ov_mixer_pool_count_mixers(pool);
+    testrun(1 == count.hosts);
+    testrun(1 == count.mixers);
+    testrun(0 == count.used);
+
+    testrun(ov_mixer_pool_remove(pool, 3));
+
+    count = ov_mixer_pool_count_mixers(pool);
+    testrun(0 == count.hosts);
+    testrun(0 == count.mixers);
+    testrun(0 == ov_dict_count(pool->hosts));
+
+    testrun(-1 == ov_mixer_pool_acquire(pool));
+
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_acquire() {
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+
+    testrun(-1 == ov_mixer_pool_acquire(NULL));
+    testrun(-1 == ov_mixer_pool_acquire(pool));
+
+    testrun(ov_mixer_pool_add(pool, 1, "a"));
+    testrun(ov_mixer_pool_add(pool, 2, "a"));
+    testrun(ov_mixer_pool_add(pool, 3, "a"));
+    testrun(ov_mixer_pool_add(pool, 4, "b"));
+
+    /* users are spread over the hosts */
+
+    int socket = ov_mixer_pool_acquire(pool);
+    testrun((0 < socket) && (socket < 4));
+
+    socket = ov_mixer_pool_acquire(pool);
+    testrun((0 < socket) && (socket < 4));
+
+    /* a and b have one unused mixer each */
+
+    socket = ov_mixer_pool_acquire(pool);
+    testrun(0 < socket);
+
+    socket = ov_mixer_pool_acquire(pool);
+    testrun(0 < socket);
+
+    testrun(-1 == ov_mixer_pool_acquire(pool));
+    testrun(4 == ov_mixer_pool_count_mixers(pool).used);
+    testrun(heap_is_valid(pool));
+
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_release() {
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+
+    testrun(!ov_mixer_pool_release(NULL, 1));
+    testrun(!ov_mixer_pool_release(pool, 1));
+
+    testrun(ov_mixer_pool_add(pool, 1, "a"));
+    testrun(ov_mixer_pool_add(pool, 2, "b"));
+
+    /* not used */
+    testrun(!ov_mixer_pool_release(pool, 1));
+
+    int first = ov_mixer_pool_acquire(pool);
+    int second = ov_mixer_pool_acquire(pool);
+    testrun(first != second);
+    testrun(-1 == ov_mixer_pool_acquire(pool));
+
+    testrun(ov_mixer_pool_release(pool, first));
+    testrun(!ov_mixer_pool_release(pool, first));
+    testrun(1 == ov_mixer_pool_count_mixers(pool).used);
+
+    testrun(first == ov_mixer_pool_acquire(pool));
+    testrun(heap_is_valid(pool));
+
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_set_overload() {
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+
+    testrun(ov_mixer_pool_add(pool, 1, "a"));
+    testrun(ov_mixer_pool_add(pool, 2, "a"));
+    testrun(ov_mixer_pool_add(pool, 3, "a"));
+    testrun(ov_mixer_pool_add(pool, 4, "b"));
+
+    testrun(!ov_mixer_pool_set_overload(NULL, 1, true));
+    testrun(!ov_mixer_pool_set_overload(pool, 5, true));
+
+    /* a is overloaded, b is preferred even with less unused mixers */
+
+    testrun(ov_mixer_pool_set_overload(pool, 1, true));
+    testrun(ov_mixer_pool_set_overload(pool, 1, true));
+    testrun(1 == ((Host *)ov_dict_get(pool->hosts, "a"))->overloaded);
+
+    testrun(4 == ov_mixer_pool_acquire(pool));
+
+    /* overloaded hosts are used if nothing else is left */
+
+    int socket = ov_mixer_pool_acquire(pool);
+    testrun((0 < socket) && (socket < 4));
+    testrun(ov_mixer_pool_release(pool, 4));
+
+    /* recovered */
+
+    testrun(ov_mixer_pool_set_overload(pool, 1, false));
+    testrun(0 == ((Host *)ov_dict_get(pool->hosts, "a"))->overloaded);
+
+    socket = ov_mixer_pool_acquire(pool);
+    testrun((0 < socket) && (socket < 4));
+    testrun(heap_is_valid(pool));
+
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mixer_pool_count_mixers() {
+
+    ov_mixer_pool_count count = ov_mixer_pool_count_mixers(NULL);
+    testrun(0 == count.hosts);
+    testrun(0 == count.mixers);
+    testrun(0 == count.used);
+
+    ov_mixer_pool *pool = ov_mixer_pool_create();
+    testrun(pool);
+
+    for (int i = 1; i <= 10; ++i) {
+        testrun(ov_mixer_pool_add(pool, i, (i % 2) ? "a" : "b"));
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        testrun(-1 != ov_mixer_pool_acquire(pool));
+    }
+
+    count = ov_mixer_pool_count_mixers(pool);
+    testrun(2 == count.hosts);
+    testrun(10 == count.mixers);
+    testrun(4 == count.used);
+
+    testrun(NULL == ov_mixer_pool_free(pool));
+
+    return testrun_log_success();
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CLUSTER                                                    #CLUSTER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int all_tests() {
+
+    testrun_init();
+    testrun_test(test_ov_mixer_pool_create);
+    testrun_test(test_ov_mixer_pool_add);
+    testrun_test(test_ov_mixer_pool_remove);
+    testrun_test(test_ov_mixer_pool_acquire);
+    testrun_test(test_ov_mixer_pool_release);
+    testrun_test(test_ov_mixer_pool_set_overload);
+    testrun_test(test_ov_mixer_pool_count_mixers);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
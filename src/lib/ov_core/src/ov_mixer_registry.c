@@ -28,6 +28,7 @@
         ------------------------------------------------------------------------
 */
 #include "../include/ov_mixer_registry.h"
+#include "../include/ov_mixer_pool.h"
 
 #include <ov_base/ov_dict.h>
 #include <ov_base/ov_id.h>
@@ -40,6 +41,9 @@ struct ov_mixer_registry {
     ov_thread_lock lock;
     ov_dict *users;
     ov_dict *sockets;
+
+    /* unused mixers per host */
+    ov_mixer_pool *pool;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -62,6 +66,10 @@ ov_mixer_registry *ov_mixer_registry_create(ov_mixer_registry_config config) {
     if (!self->sockets)
         goto error;
 
+    self->pool = ov_mixer_pool_create();
+    if (!self->pool)
+        goto error;
+
     if (!ov_thread_lock_init(&self->lock,
                              config.limits.threadlock_timeout_usec))
         goto error;
@@ -83,6 +91,7 @@ ov_mixer_registry *ov_mixer_registry_free(ov_mixer_registry *self) {
 
     self->users = ov_dict_free(self->users);
     self->sockets = ov_dict_free(self->sockets);
+    self->pool = ov_mixer_pool_free(self->pool);
     self = ov_data_pointer_free(self);
     return NULL;
 }
@@ -106,10 +115,19 @@ bool ov_mixer_registry_register_mixer(ov_mixer_registry *self, int socket,
     bool result =
         ov_dict_set(self->sockets, (void *)(intptr_t)socket, val, NULL);
 
-    ov_thread_lock_unlock(&self->lock);
+    if (result) {
+
+        result = ov_mixer_pool_add(self->pool, socket, remote->host);
+
+        if (!result)
+            ov_dict_del(self->sockets, (void *)(intptr_t)socket);
+
+    } else {
 
-    if (!result)
         val = ov_data_pointer_free(val);
+    }
+
+    ov_thread_lock_unlock(&self->lock);
 
     return result;
 error:
@@ -129,6 +147,7 @@ bool ov_mixer_registry_unregister_mixer(ov_mixer_registry *self, int socket) {
     ov_mixer_data *data = ov_dict_get(self->sockets, (void *)(intptr_t)socket);
     if (data) {
         ov_dict_del(self->users, data->user);
+        ov_mixer_pool_remove(self->pool, socket);
     }
 
     bool result = ov_dict_del(self->sockets, (void *)(intptr_t)socket);
@@ -143,35 +162,6 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-struct container {
-
-    int slot;
-    int user;
-};
-
-/*----------------------------------------------------------------------------*/
-
-static bool find_unused_mixer(const void *key, void *val, void *data) {
-
-    if (!key)
-        return true;
-
-    struct container *container = (struct container *)data;
-    if (container->slot != 0)
-        return true;
-
-    ov_mixer_data *mixer = (ov_mixer_data *)val;
-
-    if (0 == strlen(mixer->user)) {
-
-        container->slot = (intptr_t)key;
-    }
-
-    return true;
-}
-
-/*----------------------------------------------------------------------------*/
-
 ov_mixer_data ov_mixer_registry_acquire_user(ov_mixer_registry *self,
                                              const char *uuid) {
 
@@ -183,30 +173,32 @@ ov_mixer_data ov_mixer_registry_acquire_user(ov_mixer_registry *self,
     if (OV_HOST_NAME_MAX < strlen(uuid))
         goto error;
 
-    struct container container = (struct container){.slot = 0};
-
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
-    bool result =
-        ov_dict_for_each(self->sockets, &container, find_unused_mixer);
-
-    if (0 == container.slot)
+    int socket = ov_mixer_pool_acquire(self->pool);
+    if (-1 == socket)
         goto done;
 
-    ov_mixer_data *val =
-        ov_dict_get(self->sockets, (void *)(intptr_t)container.slot);
+    ov_mixer_data *val = ov_dict_get(self->sockets, (void *)(intptr_t)socket);
     if (!val)
         goto done;
 
     strncpy(val->user, uuid, OV_HOST_NAME_MAX);
 
     char *key = ov_string_dup(val->user);
-    result =
-        ov_dict_set(self->users, key, (void *)(intptr_t)container.slot, NULL);
 
-    if (result)
+    if (ov_dict_set(self->users, key, (void *)(intptr_t)socket, NULL)) {
+
         data = *val;
+
+    } else {
+
+        key = ov_data_pointer_free(key);
+        memset(val->user, 0, OV_HOST_NAME_MAX);
+        ov_mixer_pool_release(self->pool, socket);
+    }
+
 done:
     ov_thread_lock_unlock(&self->lock);
     return data;
@@ -283,8 +275,10 @@ bool ov_mixer_registry_release_user(ov_mixer_registry *self, const char *uuid) {
     intptr_t socket = (intptr_t)ov_dict_get(self->users, uuid);
     ov_mixer_data *data = ov_dict_get(self->sockets, (void *)socket);
 
-    if (data)
-        memset(data->user, 0, 256);
+    if (data) {
+        memset(data->user, 0, OV_HOST_NAME_MAX);
+        ov_mixer_pool_release(self->pool, socket);
+    }
 
     ov_dict_del(self->users, uuid);
 
@@ -296,43 +290,46 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static bool count_sockets(const void *key, void *val, void *data) {
+ov_mixer_registry_count
+ov_mixer_registry_count_mixers(ov_mixer_registry *self) {
 
-    if (!key)
-        return true;
+    if (!self)
+        goto error;
 
-    struct container *container = (struct container *)data;
+    if (!ov_thread_lock_try_lock(&self->lock))
+        goto error;
 
-    ov_mixer_data *mixer = (ov_mixer_data *)val;
+    ov_mixer_pool_count count = ov_mixer_pool_count_mixers(self->pool);
 
-    container->slot++;
+    ov_thread_lock_unlock(&self->lock);
 
-    if (0 != mixer->user[0])
-        container->user++;
+    return (ov_mixer_registry_count){.mixers = count.mixers,
+                                     .used = count.used};
 
-    return true;
+error:
+    return (ov_mixer_registry_count){0};
 }
 
 /*----------------------------------------------------------------------------*/
 
-ov_mixer_registry_count
-ov_mixer_registry_count_mixers(ov_mixer_registry *self) {
+bool ov_mixer_registry_set_overload(ov_mixer_registry *self, int socket,
+                                    bool overloaded) {
 
     if (!self)
         goto error;
 
-    struct container container = (struct container){.slot = 0, .user = 0};
-
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
-    ov_dict_for_each(self->sockets, &container, count_sockets);
-
-    ov_thread_lock_unlock(&self->lock);
+    ov_mixer_data *data = ov_dict_get(self->sockets, (void *)(intptr_t)socket);
 
-    return (ov_mixer_registry_count){.mixers = container.slot,
-                                     .used = container.user};
+    if (data) {
+        data->overloaded = overloaded;
+        ov_mixer_pool_set_overload(self->pool, socket, overloaded);
+    }
 
+    ov_thread_lock_unlock(&self->lock);
+    return (NULL != data);
 error:
-    return (ov_mixer_registry_count){0};
-}
\ No newline at end of file
+    return false;
+}
@@ -28,6 +28,8 @@
         ------------------------------------------------------------------------
 */
 #include "ov_mixer_registry.c"
+
+#include <ov_base/ov_time.h>
 #include <ov_test/testrun.h>
 
 /*
@@ -46,6 +48,128 @@ int test_case() {
 
 /*----------------------------------------------------------------------------*/
 
+int test_ov_mixer_registry_set_overload() {
+
+    ov_mixer_registry *reg =
+        ov_mixer_registry_create((ov_mixer_registry_config){0});
+    testrun(reg);
+
+    ov_socket_data a = {.host = "10.0.0.1", .port = 1};
+    ov_socket_data b = {.host = "10.0.0.2", .port = 1};
+
+    testrun(ov_mixer_registry_register_mixer(reg, 1, &a));
+    testrun(ov_mixer_registry_register_mixer(reg, 2, &a));
+    testrun(ov_mixer_registry_register_mixer(reg, 3, &b));
+
+    testrun(!ov_mixer_registry_set_overload(NULL, 1, true));
+    testrun(!ov_mixer_registry_set_overload(reg, 4, true));
+    testrun(ov_mixer_registry_set_overload(reg, 1, true));
+    testrun(ov_mixer_registry_get_socket(reg, 1).overloaded);
+
+    /* host a is overloaded, b is preferred */
+
+    ov_mixer_data data = ov_mixer_registry_acquire_user(reg, "user1");
+    testrun(3 == data.socket);
+
+    /* a is used if nothing else is left */
+
+    data = ov_mixer_registry_acquire_user(reg, "user2");
+    testrun((1 == data.socket) || (2 == data.socket));
+
+    int socket = data.socket;
+
+    data = ov_mixer_registry_acquire_user(reg, "user3");
+    testrun((1 == data.socket) || (2 == data.socket));
+    testrun(socket != data.socket);
+
+    data = ov_mixer_registry_acquire_user(reg, "user4");
+    testrun(0 == data.socket);
+
+    /* recovered */
+
+    testrun(ov_mixer_registry_release_user(reg, "user2"));
+    testrun(ov_mixer_registry_set_overload(reg, 1, false));
+    testrun(!ov_mixer_registry_get_socket(reg, 1).overloaded);
+
+    testrun(ov_mixer_registry_set_overload(reg, 3, true));
+    testrun(ov_mixer_registry_unregister_mixer(reg, 3));
+    testrun(2 == ov_mixer_registry_count_mixers(reg).mixers);
+
+    data = ov_mixer_registry_acquire_user(reg, "user2");
+    testrun(socket == data.socket);
+
+    testrun(NULL == ov_mixer_registry_free(reg));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_reconnect_storm() {
+
+    /* 10k mixers on 50 hosts, all users reconnect after a failover */
+
+    const int mixers = 10000;
+    const int hosts = 50;
+    const int rounds = 10;
+
+    char uuid[OV_HOST_NAME_MAX] = {0};
+
+    ov_mixer_registry *reg =
+        ov_mixer_registry_create((ov_mixer_registry_config){0});
+    testrun(reg);
+
+    for (int i = 1; i <= mixers; ++i) {
+
+        ov_socket_data remote = {.port = 1};
+        snprintf(remote.host, sizeof(remote.host), "10.0.0.%i", i % hosts);
+        testrun(ov_mixer_registry_register_mixer(reg, i, &remote));
+    }
+
+    uint64_t acquire_usec = 0;
+    uint64_t release_usec = 0;
+
+    for (int round = 0; round < rounds; ++round) {
+
+        uint64_t start = ov_time_get_current_time_usecs();
+
+        for (int i = 0; i < mixers; ++i) {
+
+            snprintf(uuid, sizeof(uuid), "user-%i", i);
+            testrun(0 != ov_mixer_registry_acquire_user(reg, uuid).socket);
+        }
+
+        acquire_usec += ov_time_get_current_time_usecs() - start;
+
+        testrun(0 == ov_mixer_registry_acquire_user(reg, "late").socket);
+        testrun(mixers == (int)ov_mixer_registry_count_mixers(reg).used);
+
+        start = ov_time_get_current_time_usecs();
+
+        for (int i = 0; i < mixers; ++i) {
+
+            snprintf(uuid, sizeof(uuid), "user-%i", i);
+            testrun(ov_mixer_registry_release_user(reg, uuid));
+        }
+
+        release_usec += ov_time_get_current_time_usecs() - start;
+
+        testrun(0 == ov_mixer_registry_count_mixers(reg).used);
+    }
+
+    fprintf(stdout,
+            "mixer registry: %i mixers, %i rounds "
+            "acquire %.1f ns/op release %.1f ns/op\n",
+            mixers, rounds, 1000.0 * acquire_usec / (mixers * rounds),
+            1000.0 * release_usec / (mixers * rounds));
+
+    testrun(NULL == ov_mixer_registry_free(reg));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -58,6 +182,8 @@ int all_tests() {
 
     testrun_init();
     testrun_test(test_case);
+    testrun_test(test_ov_mixer_registry_set_overload);
+    testrun_test(check_reconnect_storm);
 
     return testrun_counter;
 }
@@ -55,7 +55,9 @@
 #include <ov_base/ov_uri.h>
 #include <ov_base/ov_utils.h>
 
+#include <fcntl.h>
 #include <signal.h>
+#include <sys/stat.h>
 
 /*
  *      ------------------------------------------------------------------------
@@ -78,6 +80,9 @@
 #define IMPL_DEFAULT_ACCEPT_TO_IO_USEC 1000 * 1000      // 1 second
 #define IMPL_WEBSOCKET_CLOSE_RESPONSE_DELAY 1000 * 1000 // 1 second
 #define IMPL_BUFFER_SIZE_WS_FRAME_DEFRAG 1000000        // 1MB
+#define IMPL_SENDFILE_CHUNK 1000000                     // 1MB
+
+#define IMPL_FILE_SEGMENT_MAGIC_BYTE 0xf11e
 
 /* We use some rather small buffer size for websocket frames
  * to reduce delay for sending due to "large" socket writes,
@@ -121,6 +126,76 @@ const char *connection_type_string(ConnectionType type) {
 
 /*----------------------------------------------------------------------------*/
 
+/*  Outgoing file content to be streamed from disk,
+ *  used for files too large for the asset cache. */
+
+typedef struct FileSegment {
+
+    uint16_t magic_byte;
+
+    int fd;
+    off_t offset;
+    size_t length;
+
+} FileSegment;
+
+/*----------------------------------------------------------------------------*/
+
+static FileSegment *file_segment_cast(const void *data) {
+
+    if (!data)
+        return NULL;
+
+    if (*(uint16_t *)data == IMPL_FILE_SEGMENT_MAGIC_BYTE)
+        return (FileSegment *)data;
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *file_segment_free(void *data) {
+
+    FileSegment *segment = file_segment_cast(data);
+    if (!segment)
+        return data;
+
+    if (-1 < segment->fd)
+        close(segment->fd);
+
+    free(segment);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static FileSegment *file_segment_create(const char *path, size_t length) {
+
+    struct stat st = {0};
+
+    FileSegment *segment = calloc(1, sizeof(FileSegment));
+    if (!segment)
+        goto error;
+
+    segment->magic_byte = IMPL_FILE_SEGMENT_MAGIC_BYTE;
+    segment->length = length;
+    segment->fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (-1 == segment->fd)
+        goto error;
+
+    /* file changed since the asset was checked */
+    if ((0 != fstat(segment->fd, &st)) || ((size_t)st.st_size != length))
+        goto error;
+
+    return segment;
+error:
+    file_segment_free(segment);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
 typedef struct Connection {
 
     int fd;
@@ -193,6 +268,9 @@ typedef struct Connection {
 
             ov_buffer *buffer;
             ov_list *queue;
+
+            /* file currently streamed, send before the queue (PRIO 2b) */
+            FileSegment *file;
             /*
                         struct {
 
@@ -256,6 +334,8 @@ struct ov_webserver_base {
 
     } domain;
 
+    ov_http_asset_cache *assets;
+
     struct Connection *conn;
 };
 
@@ -427,6 +507,11 @@ static bool tls_init_context(ov_webserver_base *srv, ov_domain *domain) {
     SSL_CTX_set_client_hello_cb(domain->context.tls, tls_client_hello_callback,
                                 srv);
 
+#ifdef SSL_OP_ENABLE_KTLS
+    if (srv->config.ktls)
+        SSL_CTX_set_options(domain->context.tls, SSL_OP_ENABLE_KTLS);
+#endif
+
     return true;
 error:
     return false;
@@ -559,6 +644,7 @@ close_without_websocket_shutdown:
 
     // drop all outgoing
     conn->io.out.buffer = ov_buffer_free(conn->io.out.buffer);
+    conn->io.out.file = file_segment_free(conn->io.out.file);
 
     // drop all format sending
     /*
@@ -572,6 +658,7 @@ close_without_websocket_shutdown:
 
         data = ov_http_message_free(data);
         data = ov_websocket_frame_free(data);
+        data = file_segment_free(data);
         data = ov_buffer_free(data);
 
         if (data) {
@@ -1108,6 +1195,135 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+/* BIO_get_ktls_send and SSL_sendfile are available with the same OpenSSL
+ * versions as SSL_OP_ENABLE_KTLS, see tls_init_context */
+
+static bool tls_ktls_send_active(Connection *conn) {
+
+#ifdef SSL_OP_ENABLE_KTLS
+    return BIO_get_ktls_send(SSL_get_wbio(conn->tls.ssl));
+#else
+    (void)conn;
+    return false;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ssize_t tls_ktls_sendfile(Connection *conn, FileSegment *segment,
+                                 size_t chunk) {
+
+#ifdef SSL_OP_ENABLE_KTLS
+    return SSL_sendfile(conn->tls.ssl, segment->fd, segment->offset, chunk, 0);
+#else
+    (void)conn;
+    (void)segment;
+    (void)chunk;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool tls_send_file(ov_webserver_base *srv, Connection *conn) {
+
+    OV_ASSERT(srv);
+    OV_ASSERT(conn);
+    OV_ASSERT(conn->io.out.file);
+    OV_ASSERT(NULL == conn->io.out.buffer);
+
+    ov_buffer *buffer = NULL;
+    FileSegment *segment = conn->io.out.file;
+
+    ssize_t bytes = 0;
+    size_t chunk = segment->length;
+
+    if (chunk > IMPL_SENDFILE_CHUNK)
+        chunk = IMPL_SENDFILE_CHUNK;
+
+    if (tls_ktls_send_active(conn)) {
+
+        /* kTLS active, the kernel will encrypt the file content
+         * without any copy to userspace */
+
+        bytes = tls_ktls_sendfile(conn, segment, chunk);
+
+        if (bytes <= 0) {
+
+            switch (SSL_get_error(conn->tls.ssl, bytes)) {
+
+            case SSL_ERROR_WANT_READ:
+            case SSL_ERROR_WANT_WRITE:
+                /* retry */
+                goto done;
+
+            default:
+                break;
+            }
+
+            ov_log_error("%s sendfile failed at %i | %s", srv->config.name,
+                         conn->fd, strerror(errno));
+
+            goto error;
+        }
+
+        conn->io.out.bytes += bytes;
+        conn->io.out.last = ov_time_get_current_time_usecs();
+
+    } else {
+
+        /* No kTLS, read the next chunk and send it over SSL_write.
+         *
+         * NOTE chunk MUST NOT exceed the send buffer size,
+         * as tls_send_buffer would otherwise queue the parts behind
+         * other outgoing data. */
+
+        size_t max = ov_socket_get_send_buffer_size(conn->fd);
+
+        if ((max > 0) && (chunk > max))
+            chunk = max;
+
+        buffer = ov_buffer_create(chunk);
+        if (!buffer)
+            goto error;
+
+        bytes = pread(segment->fd, buffer->start, chunk, segment->offset);
+
+        if (bytes <= 0) {
+
+            ov_log_error("%s failed to read file at %i | %s", srv->config.name,
+                         conn->fd, strerror(errno));
+
+            goto error;
+        }
+
+        buffer->length = bytes;
+
+        /* will close the connection on error */
+        if (!tls_send_buffer(srv, conn, buffer)) {
+            buffer = ov_buffer_free(buffer);
+            return false;
+        }
+
+        buffer = ov_buffer_free(buffer);
+    }
+
+    segment->offset += bytes;
+    segment->length -= bytes;
+
+    if (0 == segment->length)
+        conn->io.out.file = file_segment_free(conn->io.out.file);
+
+done:
+    return true;
+error:
+    buffer = ov_buffer_free(buffer);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool io_tls_send(ov_webserver_base *srv, Connection *conn,
                         ov_event_loop *loop) {
 
@@ -1219,6 +1435,16 @@ static bool io_tls_send(ov_webserver_base *srv, Connection *conn,
 
     OV_ASSERT(NULL == conn->io.out.buffer);
 
+    /* (1b) Continue to stream some file */
+
+    if (conn->io.out.file) {
+
+        if (!tls_send_file(srv, conn))
+            goto error;
+
+        goto done;
+    }
+
     /* (2) Try to get next message of outgoing queue */
 
     void *out = ov_list_queue_pop(conn->io.out.queue);
@@ -1290,6 +1516,17 @@ static bool io_tls_send(ov_webserver_base *srv, Connection *conn,
         goto done;
     }
 
+    FileSegment *segment = file_segment_cast(out);
+    if (segment) {
+
+        conn->io.out.file = segment;
+
+        if (!tls_send_file(srv, conn))
+            goto error;
+
+        goto done;
+    }
+
     OV_ASSERT(1 == 0);
 
 done:
@@ -2016,11 +2253,11 @@ static bool cb_wss_send_json(void *self, int socket, const ov_json_value *msg) {
         goto error;
     }
 
-    str = ov_json_value_to_string(msg);
-    if (!str)
-        goto error;
+    ov_json_stringify_config stringify = ov_json_config_stringify_default();
 
-    ssize_t length = strlen(str);
+    ssize_t length = ov_json_parser_calculate(msg, &stringify);
+    if (length < 0)
+        goto error;
 
     /* Send the string over websocket frames */
 
@@ -2039,7 +2276,7 @@ static bool cb_wss_send_json(void *self, int socket, const ov_json_value *msg) {
 
         frame->buffer->start[0] = 0x80 | OV_WEBSOCKET_OPCODE_TEXT;
 
-        if (!ov_websocket_set_data(frame, (uint8_t *)str, length, false)) {
+        if (!ov_websocket_frame_set_json(frame, msg, &stringify, length)) {
 
             ov_log_error("%s failed to set websocket data for %i",
                          srv->config.name, socket);
@@ -2064,6 +2301,10 @@ static bool cb_wss_send_json(void *self, int socket, const ov_json_value *msg) {
     /* send fragmented */
     size_t counter = 0;
 
+    str = ov_json_value_to_string(msg);
+    if (!str)
+        goto error;
+
     uint8_t *ptr = (uint8_t *)str;
     ssize_t open = length;
 
@@ -3716,6 +3957,10 @@ ov_webserver_base *ov_webserver_base_create(ov_webserver_base_config config) {
 
     srv->connections_max = config.limit.max_sockets;
 
+    srv->assets = ov_http_asset_cache_create(config.cache);
+    if (!srv->assets)
+        goto error;
+
     srv->conn = calloc(1, srv->connections_max * sizeof(struct Connection));
     if (!srv->conn)
         goto error;
@@ -3984,6 +4229,9 @@ ov_webserver_base_config_from_json(const ov_json_value *value) {
     if (ov_json_is_true(ov_json_object_get(config, OV_KEY_IP4_ONLY)))
         out.ip4_only = true;
 
+    if (ov_json_is_true(ov_json_object_get(config, OV_KEY_KTLS)))
+        out.ktls = true;
+
     out.http_message = ov_http_message_config_from_json(config);
     out.websocket_frame = ov_websocket_frame_config_from_json(config);
 
@@ -4006,6 +4254,9 @@ ov_webserver_base_config_from_json(const ov_json_value *value) {
     out.limit.max_content_bytes_per_websocket_frame = ov_json_number_get(
         ov_json_get(config, "/" OV_KEY_LIMITS "/" OV_WEBSOCKET_KEY));
 
+    out.cache = ov_http_asset_cache_config_from_json(
+        ov_json_object_get(config, OV_KEY_CACHE));
+
     return out;
 error:
     return (ov_webserver_base_config){0};
@@ -4082,6 +4333,12 @@ ov_webserver_base_config_to_json(ov_webserver_base_config config) {
             goto error;
     }
 
+    if (config.ktls) {
+        val = ov_json_true();
+        if (!ov_json_object_set(out, OV_KEY_KTLS, val))
+            goto error;
+    }
+
     val = ov_http_message_config_to_json(config.http_message);
     if (val && !ov_json_object_set(out, OV_KEY_HTTP_MESSAGE, val))
         goto error;
@@ -4128,6 +4385,10 @@ ov_webserver_base_config_to_json(ov_webserver_base_config config) {
     if (!ov_json_object_set(limits, OV_KEY_WEBSOCKET, val))
         goto error;
 
+    val = ov_http_asset_cache_config_to_json(config.cache);
+    if (!ov_json_object_set(out, OV_KEY_CACHE, val))
+        goto error;
+
     return out;
 error:
     ov_json_value_free(val);
@@ -4219,6 +4480,7 @@ ov_webserver_base *ov_webserver_base_free(ov_webserver_base *srv) {
         ov_domain_array_free(srv->domain.size, srv->domain.array);
 
     srv->conn = ov_data_pointer_free(srv->conn);
+    srv->assets = ov_http_asset_cache_free(srv->assets);
     free(srv);
     return NULL;
 error:
@@ -4706,15 +4968,152 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-bool ov_webserver_base_answer_get(ov_webserver_base *srv, int socket,
-                                  ov_file_format_desc fmt,
-                                  const ov_http_message *request) {
+static Connection *get_connection(ov_webserver_base *srv, int socket) {
+
+    OV_ASSERT(srv);
+
+    if ((socket < 0) || ((uint32_t)socket >= srv->connections_max))
+        return NULL;
+
+    Connection *conn = &srv->conn[socket];
+
+    if (conn->fd != socket)
+        return NULL;
+
+    return conn;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool answer_asset(ov_webserver_base *srv, ov_file_format_desc fmt,
+                         const ov_http_message *request, const char *path,
+                         Connection *conn, bool head) {
+
+    OV_ASSERT(srv);
+    OV_ASSERT(request);
+    OV_ASSERT(path);
+    OV_ASSERT(conn);
 
-    // ov_format *format = NULL;
     ov_http_message *msg = NULL;
+    FileSegment *segment = NULL;
 
-    uint8_t *buffer = NULL;
-    size_t size = 0;
+    const ov_http_asset *asset = ov_http_asset_cache_get(srv->assets, path);
+
+    if (!asset) {
+        ov_log_error("Failed to read file %s", path);
+        goto error;
+    }
+
+    ov_http_asset_encoding encoding =
+        ov_http_asset_select_encoding(asset, request);
+
+    if (ov_http_asset_not_modified(asset, encoding, request)) {
+
+        msg = ov_http_create_status_string(request->config, request->version,
+                                           304, OV_HTTP_NOT_MODIFIED);
+
+        if (!msg)
+            goto error;
+
+        if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER,
+                                               srv->config.name))
+            goto error;
+
+        if (!ov_http_message_set_date(msg))
+            goto error;
+
+        if (!ov_http_asset_add_header(msg, asset, encoding))
+            goto error;
+
+        if (!ov_http_message_close_header(msg))
+            goto error;
+
+        if (!push_outgoing(conn, msg))
+            goto error;
+
+        return true;
+    }
+
+    size_t size = asset->size;
+
+    if (asset->loaded)
+        size = asset->variant[encoding].content.length;
+
+    /* Files not loaded to the cache are streamed from disk,
+     * using sendfile if kTLS is enabled for the connection. */
+
+    if (!asset->loaded && !head) {
+
+        segment = file_segment_create(path, size);
+
+        if (!segment) {
+            ov_log_error("Failed to open file %s", path);
+            goto error;
+        }
+    }
+
+    msg = ov_http_create_status_string(request->config, request->version, 200,
+                                       OV_HTTP_OK);
+
+    if (!msg)
+        goto error;
+
+    if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER,
+                                           srv->config.name))
+        goto error;
+
+    if (!ov_http_message_add_content_type(msg, fmt.mime,
+                                          asset->utf8 ? "utf-8" : NULL))
+        goto error;
+
+    if (!ov_http_message_set_date(msg))
+        goto error;
+
+    if (!ov_http_message_set_content_length(msg, size))
+        goto error;
+
+    if (!ov_http_message_add_header_string(msg, "Accept-Ranges", "bytes"))
+        goto error;
+
+    if (!ov_http_asset_add_header(msg, asset, encoding))
+        goto error;
+
+    if (!ov_http_message_close_header(msg))
+        goto error;
+
+    if (!head && asset->loaded) {
+
+        if (!ov_http_message_add_body(msg, asset->variant[encoding].content))
+            goto error;
+    }
+
+    if (!push_outgoing(conn, msg)) {
+        ov_list_remove_if_included(conn->io.out.queue, msg);
+        goto error;
+    }
+
+    if (segment && !push_outgoing(conn, segment)) {
+
+        /* The header announced the content length,
+         * so it MUST NOT be sent without the body. */
+
+        ov_list_remove_if_included(conn->io.out.queue, segment);
+        ov_list_remove_if_included(conn->io.out.queue, msg);
+        goto error;
+    }
+
+    return true;
+error:
+    msg = ov_http_message_free(msg);
+    segment = file_segment_free(segment);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_webserver_base_answer_get(ov_webserver_base *srv, int socket,
+                                  ov_file_format_desc fmt,
+                                  const ov_http_message *request) {
 
     if (!srv || (socket < 0) || !request)
         goto error;
@@ -4747,15 +5146,7 @@ bool ov_webserver_base_answer_get(ov_webserver_base *srv, int socket,
 
     /* (2) find open connection */
 
-    Connection *conn = NULL;
-
-    for (size_t i = 0; i < srv->connections_max; i++) {
-
-        if (srv->conn[i].fd == socket) {
-            conn = &srv->conn[i];
-            break;
-        }
-    }
+    Connection *conn = get_connection(srv, socket);
 
     if (!conn) {
 
@@ -4805,66 +5196,8 @@ bool ov_webserver_base_answer_get(ov_webserver_base *srv, int socket,
     if (range)
         return answer_get_range(srv, fmt, request, path, range, conn);
 
-    if (OV_FILE_SUCCESS != ov_file_read(path, &buffer, &size)) {
-        ov_log_error("Failed to read file %s", path);
-        goto error;
-    }
-
-    if (request) {
-
-        msg = ov_http_create_status_string(request->config, request->version,
-                                           200, OV_HTTP_OK);
-
-    } else {
-
-        msg = ov_http_create_status_string(
-            srv->config.http_message, (ov_http_version){.major = 1, .minor = 1},
-            200, OV_HTTP_OK);
-    }
-
-    if (!msg)
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER,
-                                           srv->config.name))
-        goto error;
-
-    if (ov_file_encoding_is_utf8(path)) {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, "utf-8"))
-            goto error;
-
-    } else {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, NULL))
-            goto error;
-    }
-
-    if (!ov_http_message_set_date(msg))
-        goto error;
-
-    if (!ov_http_message_set_content_length(msg, size))
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, "Accept-Ranges", "bytes"))
-        goto error;
-
-    if (!ov_http_message_close_header(msg))
-        goto error;
-
-    if (!ov_http_message_add_body(
-            msg, (ov_memory_pointer){.start = buffer, .length = size}))
-        goto error;
-
-    if (!push_outgoing(conn, msg))
-        goto error;
-
-    buffer = ov_data_pointer_free(buffer);
-    return true;
+    return answer_asset(srv, fmt, request, path, conn, false);
 error:
-    // format = ov_format_close(format);
-    buffer = ov_data_pointer_free(buffer);
-    msg = ov_http_message_free(msg);
     return false;
 }
 
@@ -4969,12 +5302,6 @@ bool ov_webserver_base_answer_head(ov_webserver_base *srv, int socket,
                                    ov_file_format_desc fmt,
                                    const ov_http_message *request) {
 
-    // ov_format *format = NULL;
-    ov_http_message *msg = NULL;
-
-    uint8_t *buffer = NULL;
-    size_t size = 0;
-
     if (!srv || (socket < 0) || !request)
         goto error;
 
@@ -4998,15 +5325,7 @@ bool ov_webserver_base_answer_head(ov_webserver_base *srv, int socket,
 
     /* (2) find open connection */
 
-    Connection *conn = NULL;
-
-    for (size_t i = 0; i < srv->connections_max; i++) {
-
-        if (srv->conn[i].fd == socket) {
-            conn = &srv->conn[i];
-            break;
-        }
-    }
+    Connection *conn = get_connection(srv, socket);
 
     if (!conn) {
 
@@ -5056,62 +5375,8 @@ bool ov_webserver_base_answer_head(ov_webserver_base *srv, int socket,
     if (range)
         return answer_head_range(srv, fmt, request, path, range, conn);
 
-    if (OV_FILE_SUCCESS != ov_file_read(path, &buffer, &size)) {
-        ov_log_error("Failed to read file %s", path);
-        goto error;
-    }
-
-    if (request) {
-
-        msg = ov_http_create_status_string(request->config, request->version,
-                                           200, OV_HTTP_OK);
-
-    } else {
-
-        msg = ov_http_create_status_string(
-            srv->config.http_message, (ov_http_version){.major = 1, .minor = 1},
-            200, OV_HTTP_OK);
-    }
-
-    if (!msg)
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER,
-                                           srv->config.name))
-        goto error;
-
-    if (ov_file_encoding_is_utf8(path)) {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, "utf-8"))
-            goto error;
-
-    } else {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, NULL))
-            goto error;
-    }
-
-    if (!ov_http_message_set_date(msg))
-        goto error;
-
-    if (!ov_http_message_set_content_length(msg, size))
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, "Accept-Ranges", "bytes"))
-        goto error;
-
-    if (!ov_http_message_close_header(msg))
-        goto error;
-
-    if (!push_outgoing(conn, msg))
-        goto error;
-
-    buffer = ov_data_pointer_free(buffer);
-    return true;
+    return answer_asset(srv, fmt, request, path, conn, true);
 error:
-    // format = ov_format_close(format);
-    buffer = ov_data_pointer_free(buffer);
-    msg = ov_http_message_free(msg);
     return false;
 }
 
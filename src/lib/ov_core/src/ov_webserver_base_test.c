@@ -5251,12 +5251,16 @@ int test_ov_webserver_base_config_to_json() {
 
         .debug = true,
         .ip4_only = true,
+        .ktls = true,
 
         .name = "name",
         .domain_config_path = "path",
 
         .limit.max_sockets = 1,
 
+        .cache.max_bytes = 100,
+        .cache.max_file_bytes = 10,
+
         .http_message =
             (ov_http_message_config){.header.capacity = 1,
                                      .header.max_bytes_method_name = 2,
@@ -5308,6 +5312,16 @@ int test_ov_webserver_base_config_to_json() {
                                     ov_json_object_get(out, OV_KEY_DOMAINS))));
     testrun(ov_json_is_true(ov_json_object_get(out, OV_KEY_DEBUG)));
     testrun(ov_json_is_true(ov_json_object_get(out, OV_KEY_IP4_ONLY)));
+    testrun(ov_json_is_true(ov_json_object_get(out, OV_KEY_KTLS)));
+
+    val = ov_json_object_get(out, OV_KEY_CACHE);
+    testrun(100 == ov_json_number_get(ov_json_object_get(val, OV_KEY_BYTES)));
+    testrun(10 == ov_json_number_get(ov_json_object_get(val, OV_KEY_FILE)));
+
+    config = ov_webserver_base_config_from_json(out);
+    testrun(config.ktls);
+    testrun(100 == config.cache.max_bytes);
+    testrun(10 == config.cache.max_file_bytes);
 
     val = ov_json_object_get(out, OV_KEY_SOCKETS);
     testrun(val);
@@ -5349,6 +5363,35 @@ int test_ov_webserver_base_config_to_json() {
 
 /*----------------------------------------------------------------------------*/
 
+static bool read_response(ov_event_loop *loop, SSL *ssl,
+                          ov_http_message *response) {
+
+    ov_buffer_clear(response->buffer);
+
+    for (size_t i = 0; i < 1000; i++) {
+
+        if (!loop->run(loop, OV_RUN_ONCE))
+            return false;
+
+        ssize_t bytes =
+            SSL_read(ssl, response->buffer->start + response->buffer->length,
+                     response->buffer->capacity - response->buffer->length);
+
+        if (bytes <= 0)
+            continue;
+
+        response->buffer->length += bytes;
+
+        if (OV_HTTP_PARSER_SUCCESS ==
+            ov_http_pointer_parse_message(response, NULL))
+            return true;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_webserver_base_answer_get() {
 
     char errorstring[OV_SSL_ERROR_STRING_BUFFER_SIZE] = {0};
@@ -5618,6 +5661,53 @@ int test_ov_webserver_base_answer_get() {
 
     testrun(0 == memcmp(buf, response->body.start, response->body.length));
 
+    header = ov_http_header_get_unique(
+        response->header, response->config.header.capacity, "ETag");
+    testrun(header);
+
+    char etag[OV_HTTP_ASSET_ETAG_MAX] = {0};
+    testrun(header->value.length < OV_HTTP_ASSET_ETAG_MAX);
+    memcpy(etag, header->value.start, header->value.length);
+
+    // check conditional request is answered from cache
+
+    ov_http_message *conditional = ov_http_create_request_string(
+        (ov_http_message_config){0}, (ov_http_version){.major = 1, .minor = 1},
+        "GET", filename);
+
+    testrun(ov_http_message_add_header_string(conditional, "If-None-Match",
+                                              etag));
+    testrun(ov_http_message_close_header(conditional));
+    testrun(OV_HTTP_PARSER_SUCCESS ==
+            ov_http_pointer_parse_message(conditional, NULL));
+
+    testrun(ov_webserver_base_answer_get(srv, conn_fd, format, conditional));
+    testrun(read_response(loop, ssl, response));
+    testrun(304 == response->status.code);
+    testrun(0 == response->body.length);
+
+    testrun(NULL == ov_http_message_free(conditional));
+
+    ov_http_asset_cache_stats stats =
+        ov_http_asset_cache_get_stats(srv->assets);
+    testrun(1 == stats.assets);
+    testrun(1 == stats.misses);
+    testrun(1 == stats.hits);
+
+    // check files not cached are streamed from disk
+
+    srv->assets = ov_http_asset_cache_free(srv->assets);
+    srv->assets = ov_http_asset_cache_create(
+        (ov_http_asset_cache_config){.max_file_bytes = 100});
+    testrun(srv->assets);
+
+    testrun(ov_webserver_base_answer_get(srv, conn_fd, format, request));
+    testrun(read_response(loop, ssl, response));
+    testrun(200 == response->status.code);
+    testrun(response->body.length == 4000);
+    testrun(0 == memcmp(buf, response->body.start, response->body.length));
+    testrun(NULL == srv->conn[conn_fd].io.out.file);
+
     testrun(loop->run(loop, OV_RUN_ONCE));
 
     // reset client
@@ -716,11 +716,37 @@ static bool mask_data(uint8_t *buffer, size_t size, const uint8_t *mask) {
     if (!buffer || size < 1 || !mask)
         goto error;
 
-    uint8_t j = 0;
+    size_t i = 0;
 
-    for (size_t i = 0; i < size; i++) {
-        j = i % 4;
-        buffer[i] = buffer[i] ^ mask[j];
+    /* bytewise until buffer + i is aligned to 8 */
+
+    while ((i < size) && (0 != ((uintptr_t)(buffer + i) & 0x07))) {
+        buffer[i] ^= mask[i & 0x03];
+        i++;
+    }
+
+    /* mask repeated to 64 bit, starting at the current mask offset,
+     * which stays the same when stepping in blocks of 8 bytes */
+
+    uint8_t pattern[8] = {0};
+
+    for (size_t k = 0; k < 8; k++) {
+        pattern[k] = mask[(i + k) & 0x03];
+    }
+
+    uint64_t mask64 = 0;
+    memcpy(&mask64, pattern, 8);
+
+    uint64_t word = 0;
+
+    for (; i + 8 <= size; i += 8) {
+        memcpy(&word, buffer + i, 8);
+        word ^= mask64;
+        memcpy(buffer + i, &word, 8);
+    }
+
+    for (; i < size; i++) {
+        buffer[i] ^= mask[i & 0x03];
     }
 
     return true;
@@ -754,59 +780,82 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-bool ov_websocket_set_data(ov_websocket_frame *frame, const uint8_t *data,
-                           size_t length, bool mask) {
+static size_t header_length(size_t length, bool mask) {
 
-    if (!frame)
-        goto error;
+    size_t header = 10;
 
-    size_t required = 0;
+    if (length < 126) {
 
-    if (!data)
-        length = 0;
+        header = 2;
 
-    if (0 == length)
-        data = NULL;
+    } else if (length < 0xffff) {
 
-    if (length < 126) {
+        header = 4;
+    }
 
-        required = 2 + length;
+    if (mask)
+        header += 4;
 
-    } else if (length < 0xffff) {
+    return header;
+}
 
-        required = 4 + length;
+/*----------------------------------------------------------------------------*/
 
-    } else {
+uint8_t *ov_websocket_frame_reserve(ov_websocket_frame *frame, size_t length,
+                                    bool mask) {
 
-        required = 10 + length;
-    }
+    if (!frame)
+        goto error;
 
-    if (mask)
-        required += 4;
+    size_t header = header_length(length, mask);
+    size_t required = header + length;
 
     if (!frame->buffer) {
 
         frame->buffer = ov_buffer_create(required);
+        if (!frame->buffer)
+            goto error;
 
     } else if (frame->buffer->capacity < required) {
 
+        /* extend will clear anything behind buffer->length */
+        uint8_t first = frame->buffer->start[0];
+
         if (!ov_buffer_extend(frame->buffer,
                               required - frame->buffer->capacity))
             goto error;
+
+        frame->buffer->start[0] = first;
     }
 
-    // set buffer to empty do not change byte 0
-    memset(frame->buffer->start + 1, 0, frame->buffer->capacity - 1);
+    return frame->buffer->start + header;
+error:
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
 
-    if (!data || (0 == length)) {
+bool ov_websocket_frame_set_header(ov_websocket_frame *frame, size_t length,
+                                   bool mask) {
 
-        if (mask)
-            goto error;
-    }
+    if (!frame || !frame->buffer)
+        goto error;
+
+    // masking without content
+    if (mask && (0 == length))
+        goto error;
+
+    size_t header = header_length(length, mask);
+
+    if (frame->buffer->capacity < header + length)
+        goto error;
 
     uint8_t *next = NULL;
     uint8_t *mask_start = NULL;
 
+    // set header to empty do not change byte 0
+    memset(frame->buffer->start + 1, 0, header - 1);
+
     uint8_t flag_mask = 0;
     if (mask)
         flag_mask = 0x80;
@@ -845,15 +894,6 @@ bool ov_websocket_set_data(ov_websocket_frame *frame, const uint8_t *data,
 
         mask_start = next;
         next += 4;
-    }
-
-    if (data && (0 != length)) {
-
-        if (!memcpy(next, data, length))
-            goto error;
-    }
-
-    if (mask) {
 
         if (!mask_data(next, length, mask_start))
             goto error;
@@ -862,7 +902,7 @@ bool ov_websocket_set_data(ov_websocket_frame *frame, const uint8_t *data,
     /*  Reparse to frame and set correct buffer length */
 
     next = NULL;
-    frame->buffer->length = frame->buffer->capacity;
+    frame->buffer->length = header + length;
 
     if (OV_WEBSOCKET_PARSER_SUCCESS != ov_websocket_parse_frame(frame, &next))
         goto error;
@@ -876,6 +916,62 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+bool ov_websocket_set_data(ov_websocket_frame *frame, const uint8_t *data,
+                           size_t length, bool mask) {
+
+    if (!frame)
+        goto error;
+
+    if (!data)
+        length = 0;
+
+    if (0 == length)
+        data = NULL;
+
+    // masking without content
+    if (mask && !data)
+        goto error;
+
+    uint8_t *payload = ov_websocket_frame_reserve(frame, length, mask);
+    if (!payload)
+        goto error;
+
+    if (data)
+        memcpy(payload, data, length);
+
+    return ov_websocket_frame_set_header(frame, length, mask);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_websocket_frame_set_json(ov_websocket_frame *frame,
+                                 const ov_json_value *value,
+                                 const ov_json_stringify_config *stringify,
+                                 size_t length) {
+
+    if (!frame || !value || !stringify || (0 == length))
+        goto error;
+
+    uint8_t *payload = ov_websocket_frame_reserve(frame, length, false);
+    if (!payload)
+        goto error;
+
+    int64_t written = ov_json_parser_encode(value, stringify,
+                                            ov_json_parser_collocate_ascending,
+                                            (char *)payload, length);
+
+    if ((int64_t)length != written)
+        goto error;
+
+    return ov_websocket_frame_set_header(frame, length, false);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_websocket_frame_shift_trailing_bytes(ov_websocket_frame *source,
                                              uint8_t *next,
                                              ov_websocket_frame **dest) {
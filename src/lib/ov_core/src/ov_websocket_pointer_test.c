@@ -29,6 +29,7 @@
 */
 #include "ov_websocket_pointer.c"
 #include <ov_test/testrun.h>
+#include <ov_base/ov_time.h>
 
 /*
  *      ------------------------------------------------------------------------
@@ -1485,7 +1486,30 @@ int check_mask_data() {
 
     for (size_t i = 0; i < 100; i++) {
         j = i % 4;
-        data[i] = source[i] ^ mask[j];
+        testrun(data[i] == (source[i] ^ mask[j]));
+    }
+
+    // check all offsets and lengths around the word size
+    for (size_t offset = 0; offset < 8; offset++) {
+
+        for (size_t len = 1; len < 40; len++) {
+
+            memcpy(&data, &source, 100);
+            testrun(mask_data(data + offset, len, mask));
+
+            for (size_t i = 0; i < 100; i++) {
+
+                if ((i < offset) || (i >= offset + len)) {
+                    testrun(data[i] == source[i]);
+                } else {
+                    testrun(data[i] == (source[i] ^ mask[(i - offset) % 4]));
+                }
+            }
+
+            // masking twice will unmask
+            testrun(mask_data(data + offset, len, mask));
+            testrun(0 == memcmp(&source, &data, 100));
+        }
     }
 
     return testrun_log_success();
@@ -1493,6 +1517,63 @@ int check_mask_data() {
 
 /*----------------------------------------------------------------------------*/
 
+static bool mask_data_bytewise(uint8_t *buffer, size_t size,
+                               const uint8_t *mask) {
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = buffer[i] ^ mask[i % 4];
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_mask_data_performance() {
+
+    size_t size = 1024 * 1024;
+    size_t runs = 100;
+
+    uint8_t mask[4] = {0};
+    testrun(generate_masking_key(mask, 4));
+
+    uint8_t *data = calloc(1, size + 1);
+    uint8_t *copy = calloc(1, size + 1);
+    testrun(data);
+    testrun(copy);
+
+    testrun(ov_random_bytes(data, size + 1));
+    memcpy(copy, data, size + 1);
+
+    // use some misaligned start as for payload behind a frame header
+    uint64_t start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; i++) {
+        mask_data_bytewise(data + 1, size, mask);
+    }
+    uint64_t bytewise = ov_time_get_current_time_usecs() - start + 1;
+
+    start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; i++) {
+        testrun(mask_data(copy + 1, size, mask));
+    }
+    uint64_t wordwise = ov_time_get_current_time_usecs() - start + 1;
+
+    // even number of runs, both MUST be unmasked again
+    testrun(0 == memcmp(data, copy, size + 1));
+
+    fprintf(stdout,
+            "websocket mask %zu x %zu bytes: bytewise %.0f MB/s, "
+            "wordwise %.0f MB/s\n",
+            runs, size, (double)(runs * size) / (double)bytewise,
+            (double)(runs * size) / (double)wordwise);
+
+    free(data);
+    free(copy);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_websocket_set_data() {
 
     ov_websocket_frame_config config = {.buffer.default_size = 10};
@@ -1630,6 +1711,135 @@ int test_ov_websocket_set_data() {
 
 /*----------------------------------------------------------------------------*/
 
+int test_ov_websocket_frame_reserve() {
+
+    ov_websocket_frame_config config = {.buffer.default_size = 10};
+
+    ov_websocket_frame *frame = ov_websocket_frame_create(config);
+    testrun(frame);
+
+    testrun(!ov_websocket_frame_reserve(NULL, 0, false));
+
+    uint8_t *payload = ov_websocket_frame_reserve(frame, 4, false);
+    testrun(payload == frame->buffer->start + 2);
+    testrun(frame->buffer->capacity == 10);
+
+    payload = ov_websocket_frame_reserve(frame, 4, true);
+    testrun(payload == frame->buffer->start + 6);
+    testrun(frame->buffer->capacity == 10);
+
+    payload = ov_websocket_frame_reserve(frame, 200, false);
+    testrun(payload == frame->buffer->start + 4);
+    testrun(frame->buffer->capacity == 204);
+
+    payload = ov_websocket_frame_reserve(frame, 0x10000, true);
+    testrun(payload == frame->buffer->start + 14);
+    testrun(frame->buffer->capacity == 0x10000 + 14);
+
+    testrun(NULL == ov_websocket_frame_free(frame));
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_websocket_frame_set_header() {
+
+    ov_websocket_frame_config config = {.buffer.default_size = 10};
+
+    ov_websocket_frame *frame = ov_websocket_frame_create(config);
+    testrun(frame);
+
+    testrun(!ov_websocket_frame_set_header(NULL, 0, false));
+
+    // masking without content
+    testrun(!ov_websocket_frame_set_header(frame, 0, true));
+
+    // payload not reserved
+    testrun(!ov_websocket_frame_set_header(frame, 100, false));
+
+    frame->buffer->start[0] = 0x80 | OV_WEBSOCKET_OPCODE_TEXT;
+
+    char *data = "test";
+    uint8_t *payload = ov_websocket_frame_reserve(frame, strlen(data), false);
+    testrun(payload);
+    memcpy(payload, data, strlen(data));
+
+    testrun(ov_websocket_frame_set_header(frame, strlen(data), false));
+    testrun(frame->buffer->length == 2 + strlen(data));
+    testrun(frame->opcode == OV_WEBSOCKET_OPCODE_TEXT);
+    testrun(frame->state == OV_WEBSOCKET_FRAGMENTATION_NONE);
+    testrun(frame->mask == NULL);
+    testrun(frame->content.start == payload);
+    testrun(frame->content.length == strlen(data));
+    testrun(0 == memcmp(data, frame->content.start, frame->content.length));
+
+    // extended length with mask, payload masked in place
+    uint8_t buffer[70000] = {0};
+    testrun(ov_random_bytes(buffer, sizeof(buffer)));
+
+    payload = ov_websocket_frame_reserve(frame, sizeof(buffer), true);
+    testrun(payload);
+    memcpy(payload, buffer, sizeof(buffer));
+
+    testrun(ov_websocket_frame_set_header(frame, sizeof(buffer), true));
+    testrun(frame->buffer->length == 14 + sizeof(buffer));
+    testrun(frame->opcode == OV_WEBSOCKET_OPCODE_TEXT);
+    testrun(frame->mask == frame->buffer->start + 10);
+    testrun(frame->content.start == payload);
+    testrun(frame->content.length == sizeof(buffer));
+    testrun(0 != memcmp(buffer, payload, sizeof(buffer)));
+
+    testrun(ov_websocket_frame_unmask(frame));
+    testrun(0 == memcmp(buffer, payload, sizeof(buffer)));
+
+    testrun(NULL == ov_websocket_frame_free(frame));
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_websocket_frame_set_json() {
+
+    ov_websocket_frame_config config = {.buffer.default_size = 10};
+
+    ov_websocket_frame *frame = ov_websocket_frame_create(config);
+    testrun(frame);
+
+    ov_json_value *value = ov_json_decode("{\"b\":[1,2,3],\"a\":\"x\"}");
+    testrun(value);
+
+    ov_json_stringify_config stringify = ov_json_config_stringify_default();
+    int64_t length = ov_json_parser_calculate(value, &stringify);
+    testrun(length > 0);
+
+    char *str = ov_json_value_to_string(value);
+    testrun(str);
+    testrun(length == (int64_t)strlen(str));
+
+    testrun(!ov_websocket_frame_set_json(NULL, value, &stringify, length));
+    testrun(!ov_websocket_frame_set_json(frame, NULL, &stringify, length));
+    testrun(!ov_websocket_frame_set_json(frame, value, NULL, length));
+    testrun(!ov_websocket_frame_set_json(frame, value, &stringify, 0));
+
+    // length not matching the encoding
+    testrun(!ov_websocket_frame_set_json(frame, value, &stringify, 3));
+
+    frame->buffer->start[0] = 0x80 | OV_WEBSOCKET_OPCODE_TEXT;
+    testrun(ov_websocket_frame_set_json(frame, value, &stringify, length));
+    testrun(frame->buffer->length == 2 + (size_t)length);
+    testrun(frame->opcode == OV_WEBSOCKET_OPCODE_TEXT);
+    testrun(frame->mask == NULL);
+    testrun(frame->content.length == (size_t)length);
+    testrun(0 == memcmp(str, frame->content.start, length));
+
+    str = ov_data_pointer_free(str);
+    value = ov_json_value_free(value);
+    testrun(NULL == ov_websocket_frame_free(frame));
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_websocket_frame_unmask() {
 
     ov_websocket_frame_config config = {.buffer.default_size = 10};
@@ -1885,8 +2095,12 @@ int all_tests() {
 
     testrun_test(check_generate_masking_key);
     testrun_test(check_mask_data);
+    testrun_test(check_mask_data_performance);
 
     testrun_test(test_ov_websocket_set_data);
+    testrun_test(test_ov_websocket_frame_reserve);
+    testrun_test(test_ov_websocket_frame_set_header);
+    testrun_test(test_ov_websocket_frame_set_json);
     testrun_test(test_ov_websocket_frame_unmask);
 
     testrun_test(test_ov_websocket_frame_shift_trailing_bytes);
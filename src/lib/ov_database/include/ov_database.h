@@ -53,6 +53,14 @@
 
 extern char const *OV_DB_SQLITE_MEMORY;
 
+/**
+ * Called once per result row, values and names are valid during the call
+ * only. Return false to stop the query.
+ */
+typedef bool (*ov_database_row_callback)(void *userdata, size_t num_cols,
+                                         char const *const *values,
+                                         char const *const *names);
+
 typedef struct ov_database_struct {
 
     // Set by us - modules shall NOT use these!
@@ -67,6 +75,16 @@ typedef struct ov_database_struct {
                              char const *select_statement, uint32_t limit,
                              uint32_t offset);
 
+    // Optional - if not set, a generic fallback is used
+
+    ov_result (*query_rows)(struct ov_database_struct *self, char const *sql,
+                            ov_database_row_callback callback,
+                            void *userdata);
+
+    ov_result (*insert_rows)(struct ov_database_struct *self, char const *sql,
+                             size_t num_params, char const *const *values,
+                             size_t num_rows);
+
 } ov_database;
 
 /**
@@ -128,6 +146,34 @@ ov_result ov_database_query(ov_database *self, char const *sql,
 
 /*----------------------------------------------------------------------------*/
 
+/**
+ * Like ov_database_query, but hands each result row to `callback` instead
+ * of collecting all rows in a JSON array first.
+ */
+ov_result ov_database_query_rows(ov_database *self, char const *sql,
+                                 ov_database_row_callback callback,
+                                 void *userdata);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Execute one statement for several rows within a single transaction.
+ *
+ * `sql` contains `num_params` placeholders `?`, e.g.
+ *
+ *  INSERT INTO t (a, b) VALUES (?, ?);
+ *
+ * `values` holds num_rows * num_params strings, row after row.
+ * Values are bound as text, never spliced into the statement unescaped.
+ *
+ * Either all rows are written or none.
+ */
+ov_result ov_database_insert_rows(ov_database *self, char const *sql,
+                                  size_t num_params,
+                                  char const *const *values, size_t num_rows);
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_database_add_limit_clause(ov_database *self, char *target,
                                   size_t target_capacity_octets,
                                   char const *select_statement, uint32_t limit,
@@ -36,6 +36,12 @@
 
 /*----------------------------------------------------------------------------*/
 
+#define OV_DB_USER_LEN 300
+#define OV_DB_ROLE_LEN 300
+#define OV_DB_LOOP_LEN 200
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_db_prepare(ov_database *self);
 
 /**
@@ -47,6 +53,24 @@ bool ov_db_events_add_participation_state(
     ov_database *self, const char *user_id, const char *role_id,
     const char *loop_id, ov_participation_state state, time_t time_epoch);
 
+typedef struct {
+
+    char user[OV_DB_USER_LEN + 1];
+    char role[OV_DB_ROLE_LEN + 1];
+    char loop[OV_DB_LOOP_LEN + 1];
+    ov_participation_state state;
+    time_t time_epoch;
+
+} ov_db_participation_event;
+
+/**
+ * Add several events within one transaction.
+ * Either all events are added or none.
+ */
+bool ov_db_events_add_participation_states(
+    ov_database *self, ov_db_participation_event const *events,
+    size_t num_events);
+
 typedef struct {
 
     ov_participation_state state;
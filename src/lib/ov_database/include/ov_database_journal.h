@@ -0,0 +1,134 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_database_journal.h
+
+        @date           2026-10-18
+
+        Non blocking journal of participation events.
+
+        Adding an event only copies it into a bounded queue. Some writer
+        thread takes the events off the queue and writes them in batches,
+        one transaction per batch, see ov_db_events_add_participation_states.
+
+        A batch is written as soon as config.batch_size events are queued,
+        or config.flush_interval_usecs after the last write at the latest.
+
+        If the queue is full, config.policy decides what happens:
+
+            OV_DB_JOURNAL_DROP_NEWEST   the event to add is dropped
+            OV_DB_JOURNAL_DROP_OLDEST   the oldest queued event is dropped
+            OV_DB_JOURNAL_BLOCK         wait up to config.block_timeout_usecs
+                                        for space, drop the event afterwards
+
+        NOTE the database is used from the writer thread. It must be
+        threadsafe, e.g. SQLite serializes access to the connection itself.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef OV_DATABASE_JOURNAL_H
+#define OV_DATABASE_JOURNAL_H
+
+#include "ov_database_events.h"
+
+#define OV_DB_JOURNAL_CAPACITY_DEFAULT 1024
+#define OV_DB_JOURNAL_BATCH_SIZE_DEFAULT 128
+#define OV_DB_JOURNAL_FLUSH_INTERVAL_USECS_DEFAULT 100000
+#define OV_DB_JOURNAL_BLOCK_TIMEOUT_USECS_DEFAULT 10000
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_db_journal ov_db_journal;
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum {
+
+    OV_DB_JOURNAL_DROP_NEWEST = 0,
+    OV_DB_JOURNAL_DROP_OLDEST,
+    OV_DB_JOURNAL_BLOCK
+
+} ov_db_journal_policy;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    ov_database *db;
+
+    size_t capacity;               // max queued events
+    size_t batch_size;             // max events per transaction
+    uint64_t flush_interval_usecs; // max time an event is queued
+
+    ov_db_journal_policy policy;
+    uint64_t block_timeout_usecs; // OV_DB_JOURNAL_BLOCK only
+
+} ov_db_journal_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint64_t queued;  // events accepted
+    uint64_t written; // events written to the database
+    uint64_t dropped; // events dropped due to a full queue
+    uint64_t failed;  // events lost due to database errors
+
+    size_t pending; // events queued or being written right now
+
+} ov_db_journal_stats;
+
+/*----------------------------------------------------------------------------*/
+
+ov_db_journal *ov_db_journal_create(ov_db_journal_config config);
+
+/**
+ * Writes all pending events before returning.
+ */
+ov_db_journal *ov_db_journal_free(ov_db_journal *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Queue some event, never touches the database.
+ *
+ * @return false if the event is invalid or was dropped
+ */
+bool ov_db_journal_add_participation_state(ov_db_journal *self,
+                                           const char *user_id,
+                                           const char *role_id,
+                                           const char *loop_id,
+                                           ov_participation_state state,
+                                           time_t time_epoch);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Block until all events queued before are written (or failed).
+ */
+bool ov_db_journal_flush(ov_db_journal *self);
+
+/*----------------------------------------------------------------------------*/
+
+ov_db_journal_stats ov_db_journal_get_stats(ov_db_journal *self);
+
+/*----------------------------------------------------------------------------*/
+#endif
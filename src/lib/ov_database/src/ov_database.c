@@ -34,6 +34,7 @@
 #include <ov_base/ov_plugin_system.h>
 #include <ov_base/ov_string.h>
 #include <ov_base/ov_teardown.h>
+#include <pthread.h>
 #include <stdbool.h>
 #include <wchar.h>
 #include <wctype.h>
@@ -112,11 +113,26 @@ static ov_database *as_database_mut(void *vptr) {
                                      SQLite
  ****************************************************************************/
 
+#define SQLITE_STATEMENT_CACHE_SIZE 8
+#define SQLITE_BUSY_TIMEOUT_MSECS 2000
+
 typedef struct {
 
     ov_database public;
     sqlite3 *sqlite;
 
+    /* The connection might be shared between the loop and some
+     * writer thread, this keeps transactions and the cache consistent */
+    pthread_mutex_t lock;
+
+    /* Prepared statements of insert_rows, replaced round robin */
+    struct {
+        char *sql;
+        sqlite3_stmt *stmt;
+    } statements[SQLITE_STATEMENT_CACHE_SIZE];
+
+    size_t next_statement;
+
 } db_sqlite;
 
 static db_sqlite const *as_sqlite(ov_database const *self) {
@@ -135,7 +151,14 @@ static bool sqlite_close(ov_database *self) {
 
     if (ov_ptr_valid(sql, "Cannot close database: No database")) {
 
+        for (size_t i = 0; i < SQLITE_STATEMENT_CACHE_SIZE; ++i) {
+            sqlite3_finalize(sql->statements[i].stmt);
+            sql->statements[i].stmt = 0;
+            sql->statements[i].sql = ov_free(sql->statements[i].sql);
+        }
+
         sqlite3_close(sql->sqlite);
+        pthread_mutex_destroy(&sql->lock);
         return true;
     }
 
@@ -182,8 +205,6 @@ static int sqlite_exec_callback(void *jtarget, int num_cols, char **cols,
         ov_cond_valid(num_cols > 0, "Querying database failed: number of "
                                     "result columns is negative")) {
 
-        fprintf(stderr, "Pushing another row...\n");
-
         ov_json_array_push(jtarget,
                            sqlite_row_to_json(num_cols, cols, col_names));
     }
@@ -214,8 +235,12 @@ static ov_result sqlite_query(ov_database *self, char const *sql,
 
         char *errormsg = 0;
 
-        if (SQLITE_OK != sqlite3_exec(sdb->sqlite, sql, sqlite_exec_callback,
-                                      jval, &errormsg)) {
+        pthread_mutex_lock(&sdb->lock);
+        int rc = sqlite3_exec(sdb->sqlite, sql, sqlite_exec_callback, jval,
+                              &errormsg);
+        pthread_mutex_unlock(&sdb->lock);
+
+        if (SQLITE_OK != rc) {
 
             ov_result_set(&res, OV_ERROR_INTERNAL_SERVER, errormsg);
             sqlite3_free(errormsg);
@@ -237,6 +262,189 @@ static ov_result sqlite_query(ov_database *self, char const *sql,
     return res;
 }
 
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    ov_database_row_callback callback;
+    void *userdata;
+    bool stopped;
+
+} RowContext;
+
+static int sqlite_rows_callback(void *context, int num_cols, char **cols,
+                                char **col_names) {
+
+    RowContext *ctx = context;
+
+    if ((0 < num_cols) &&
+        !ctx->callback(ctx->userdata, (size_t)num_cols,
+                       (char const *const *)cols,
+                       (char const *const *)col_names)) {
+
+        ctx->stopped = true;
+        return 1;
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_result sqlite_query_rows(ov_database *self, char const *sql,
+                                   ov_database_row_callback callback,
+                                   void *userdata) {
+
+    ov_result res = {
+        .error_code = OV_ERROR_NOERROR,
+    };
+
+    db_sqlite *sdb = as_sqlite_mut(self);
+
+    RowContext ctx = {
+        .callback = callback,
+        .userdata = userdata,
+    };
+
+    char *errormsg = 0;
+
+    pthread_mutex_lock(&sdb->lock);
+    int rc = sqlite3_exec(sdb->sqlite, sql, sqlite_rows_callback, &ctx,
+                          &errormsg);
+    pthread_mutex_unlock(&sdb->lock);
+
+    if ((SQLITE_OK != rc) && !((SQLITE_ABORT == rc) && ctx.stopped)) {
+        ov_result_set(&res, OV_ERROR_INTERNAL_SERVER,
+                      OV_OR_DEFAULT(errormsg, "Query failed"));
+    }
+
+    sqlite3_free(errormsg);
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static sqlite3_stmt *sqlite_get_statement(db_sqlite *sdb, char const *sql) {
+
+    for (size_t i = 0; i < SQLITE_STATEMENT_CACHE_SIZE; ++i) {
+
+        if (ov_string_equal(sdb->statements[i].sql, sql)) {
+            return sdb->statements[i].stmt;
+        }
+    }
+
+    sqlite3_stmt *stmt = 0;
+
+    if (SQLITE_OK != sqlite3_prepare_v2(sdb->sqlite, sql, -1, &stmt, 0)) {
+
+        ov_log_error("Could not prepare statement: %s",
+                     sqlite3_errmsg(sdb->sqlite));
+        return 0;
+    }
+
+    size_t i = sdb->next_statement;
+    sdb->next_statement = (i + 1) % SQLITE_STATEMENT_CACHE_SIZE;
+
+    sqlite3_finalize(sdb->statements[i].stmt);
+    ov_free(sdb->statements[i].sql);
+
+    sdb->statements[i].sql = ov_string_dup(sql);
+    sdb->statements[i].stmt = stmt;
+
+    return stmt;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool sqlite_insert_row(sqlite3_stmt *stmt, size_t num_params,
+                              char const *const *values) {
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    for (size_t i = 0; i < num_params; ++i) {
+
+        int rc = SQLITE_OK;
+
+        if (0 == values[i]) {
+            rc = sqlite3_bind_null(stmt, 1 + i);
+        } else {
+            rc = sqlite3_bind_text(stmt, 1 + i, values[i], -1, SQLITE_STATIC);
+        }
+
+        if (SQLITE_OK != rc) {
+            return false;
+        }
+    }
+
+    return SQLITE_DONE == sqlite3_step(stmt);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_result sqlite_insert_rows(ov_database *self, char const *sql,
+                                    size_t num_params,
+                                    char const *const *values,
+                                    size_t num_rows) {
+
+    ov_result res = {
+        .error_code = OV_ERROR_NOERROR,
+    };
+
+    db_sqlite *sdb = as_sqlite_mut(self);
+
+    pthread_mutex_lock(&sdb->lock);
+
+    sqlite3_stmt *stmt = sqlite_get_statement(sdb, sql);
+
+    if (0 == stmt) {
+
+        ov_result_set(&res, OV_ERROR_INTERNAL_SERVER,
+                      "Could not prepare statement");
+
+    } else if (num_params != (size_t)sqlite3_bind_parameter_count(stmt)) {
+
+        ov_result_set(&res, OV_ERROR_BAD_ARG,
+                      "Number of parameters does not match statement");
+
+    } else if (SQLITE_OK != sqlite3_exec(sdb->sqlite, "BEGIN;", 0, 0, 0)) {
+
+        ov_result_set(&res, OV_ERROR_INTERNAL_SERVER,
+                      sqlite3_errmsg(sdb->sqlite));
+
+    } else {
+
+        for (size_t row = 0; row < num_rows; ++row) {
+
+            if (!sqlite_insert_row(stmt, num_params,
+                                   values + row * num_params)) {
+
+                ov_result_set(&res, OV_ERROR_INTERNAL_SERVER,
+                              sqlite3_errmsg(sdb->sqlite));
+                break;
+            }
+        }
+
+        sqlite3_reset(stmt);
+
+        if ((OV_ERROR_NOERROR != res.error_code) ||
+            (SQLITE_OK != sqlite3_exec(sdb->sqlite, "COMMIT;", 0, 0, 0))) {
+
+            if (OV_ERROR_NOERROR == res.error_code) {
+                ov_result_set(&res, OV_ERROR_INTERNAL_SERVER,
+                              sqlite3_errmsg(sdb->sqlite));
+            }
+
+            sqlite3_exec(sdb->sqlite, "ROLLBACK;", 0, 0, 0);
+        }
+    }
+
+    pthread_mutex_unlock(&sdb->lock);
+
+    return res;
+}
+
 /*---------------------------------------------------------------------------*/
 
 bool sqlite_add_limit_clause(char *target, size_t target_capacity_octets,
@@ -268,13 +476,29 @@ static ov_database *new_database_sqlite(ov_database_info info) {
 
     if (res == SQLITE_OK) {
 
+        sqlite3_busy_timeout(sdb, SQLITE_BUSY_TIMEOUT_MSECS);
+
+        // Write ahead log lets readers proceed while a batch is committed
+        if ((!ov_string_equal(info.dbname, OV_DB_SQLITE_MEMORY)) &&
+            (SQLITE_OK != sqlite3_exec(sdb,
+                                       "PRAGMA journal_mode=WAL;"
+                                       "PRAGMA synchronous=NORMAL;",
+                                       0, 0, 0))) {
+
+            ov_log_warning("Could not enable WAL for SQLite3 database: %s",
+                           sqlite3_errmsg(sdb));
+        }
+
         db = calloc(1, sizeof(db_sqlite));
 
         db->public.magic_bytes = MAGIC_BYTES;
         db->public.query = sqlite_query;
         db->public.close = sqlite_close;
         db->public.add_limit_clause = sqlite_add_limit_clause;
+        db->public.query_rows = sqlite_query_rows;
+        db->public.insert_rows = sqlite_insert_rows;
         db->sqlite = sdb;
+        pthread_mutex_init(&db->lock, 0);
         return &db->public;
 
     } else {
@@ -466,6 +690,197 @@ ov_result ov_database_query(ov_database *self, char const *sql,
 
 /*----------------------------------------------------------------------------*/
 
+#define FALLBACK_MAX_COLUMNS 64
+
+typedef struct {
+
+    size_t num_cols;
+    char const *values[FALLBACK_MAX_COLUMNS];
+    char const *names[FALLBACK_MAX_COLUMNS];
+
+} FallbackRow;
+
+static bool fallback_add_column(const void *key, void *value, void *data) {
+
+    FallbackRow *row = data;
+
+    if (row->num_cols < FALLBACK_MAX_COLUMNS) {
+
+        row->names[row->num_cols] = key;
+        row->values[row->num_cols] = ov_json_string_get(value);
+        ++row->num_cols;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_result fallback_query_rows(ov_database *self, char const *sql,
+                                     ov_database_row_callback callback,
+                                     void *userdata) {
+
+    ov_json_value *jrows = 0;
+
+    ov_result res = ov_database_query(self, sql, &jrows);
+
+    size_t num_rows = ov_json_array_count(jrows);
+
+    for (size_t i = 1; i <= num_rows; ++i) {
+
+        FallbackRow row = {0};
+
+        ov_json_object_for_each(ov_json_array_get(jrows, i), &row,
+                                fallback_add_column);
+
+        if ((0 < row.num_cols) &&
+            (!callback(userdata, row.num_cols, row.values, row.names))) {
+            break;
+        }
+    }
+
+    jrows = ov_json_value_free(jrows);
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_result ov_database_query_rows(ov_database *self, char const *sql,
+                                 ov_database_row_callback callback,
+                                 void *userdata) {
+
+    if (ov_ptr_valid(self, "Cannot query database - no database") &&
+        ov_ptr_valid(sql, "Cannot query database - no SQL") &&
+        ov_ptr_valid(callback, "Cannot query database - no callback")) {
+
+        if (0 != self->query_rows) {
+            return self->query_rows(self, sql, callback, userdata);
+        } else {
+            return fallback_query_rows(self, sql, callback, userdata);
+        }
+
+    } else {
+
+        ov_result res = {0};
+        ov_result_set(&res, OV_ERROR_BAD_ARG,
+                      "Cannot query database - No DB / SQL / callback");
+        return res;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Replaces each `?` by the next value as SQL string literal
+ */
+static char *fallback_expand_statement(char const *sql, size_t num_params,
+                                       char const *const *values) {
+
+    size_t len = strlen(sql) + 1;
+
+    for (size_t i = 0; i < num_params; ++i) {
+        len += 2 * ov_string_len(values[i]) + 4;
+    }
+
+    char *expanded = calloc(1, len);
+    char *write_ptr = expanded;
+    size_t param = 0;
+
+    for (char const *c = sql; 0 != *c; ++c) {
+
+        if (('?' != *c) || (param >= num_params)) {
+            *write_ptr++ = *c;
+            continue;
+        }
+
+        char const *value = values[param++];
+
+        if (0 == value) {
+            memcpy(write_ptr, "NULL", 4);
+            write_ptr += 4;
+            continue;
+        }
+
+        *write_ptr++ = '\'';
+
+        for (; 0 != *value; ++value) {
+
+            if ('\'' == *value) {
+                *write_ptr++ = '\'';
+            }
+
+            *write_ptr++ = *value;
+        }
+
+        *write_ptr++ = '\'';
+    }
+
+    return expanded;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_result fallback_insert_rows(ov_database *self, char const *sql,
+                                      size_t num_params,
+                                      char const *const *values,
+                                      size_t num_rows) {
+
+    ov_result res = ov_database_query(self, "BEGIN;", 0);
+
+    for (size_t row = 0;
+         (OV_ERROR_NOERROR == res.error_code) && (row < num_rows); ++row) {
+
+        char *statement = fallback_expand_statement(
+            sql, num_params, values + row * num_params);
+
+        res = ov_database_query(self, statement, 0);
+        statement = ov_free(statement);
+    }
+
+    if (OV_ERROR_NOERROR == res.error_code) {
+        res = ov_database_query(self, "COMMIT;", 0);
+    }
+
+    if (OV_ERROR_NOERROR != res.error_code) {
+        ov_result rollback = ov_database_query(self, "ROLLBACK;", 0);
+        ov_result_clear(&rollback);
+    }
+
+    return res;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_result ov_database_insert_rows(ov_database *self, char const *sql,
+                                  size_t num_params,
+                                  char const *const *values, size_t num_rows) {
+
+    if (ov_ptr_valid(self, "Cannot insert into database - no database") &&
+        ov_ptr_valid(sql, "Cannot insert into database - no SQL") &&
+        ov_cond_valid((0 == num_rows * num_params) || (0 != values),
+                      "Cannot insert into database - no values")) {
+
+        if (0 == num_rows) {
+            return (ov_result){.error_code = OV_ERROR_NOERROR};
+        } else if (0 != self->insert_rows) {
+            return self->insert_rows(self, sql, num_params, values, num_rows);
+        } else {
+            return fallback_insert_rows(self, sql, num_params, values,
+                                        num_rows);
+        }
+
+    } else {
+
+        ov_result res = {0};
+        ov_result_set(&res, OV_ERROR_BAD_ARG,
+                      "Cannot insert into database - No DB / SQL / values");
+        return res;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_database_add_limit_clause(ov_database *self, char *target,
                                   size_t target_capacity_octets,
                                   char const *select_statement, uint32_t limit,
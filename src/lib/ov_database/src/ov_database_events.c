@@ -109,11 +109,39 @@ static bool query(ov_database *self, char const *sql, ov_json_value **jtarget,
 
 /*----------------------------------------------------------------------------*/
 
-static bool result_has_less_entries_than(ov_json_value const **res,
-                                         uint32_t max_num_entries) {
-    return (0 == max_num_entries) || (0 == res) || (0 == *res) ||
-           (ov_json_is_array(*res) &&
-            (max_num_entries > ov_json_array_count(*res)));
+typedef struct {
+
+    ov_json_value *rows;
+    uint32_t max_num_rows;
+    bool too_many_rows;
+
+} RowCollector;
+
+static bool collect_row(void *userdata, size_t num_cols,
+                        char const *const *values, char const *const *names) {
+
+    RowCollector *collector = userdata;
+
+    if ((0 != collector->max_num_rows) &&
+        (collector->max_num_rows <= ov_json_array_count(collector->rows))) {
+
+        collector->too_many_rows = true;
+        return false;
+    }
+
+    ov_json_value *jrow = ov_json_object();
+
+    for (size_t i = 0; i < num_cols; ++i) {
+
+        if (0 != names[i]) {
+            ov_json_object_set(jrow, names[i],
+                               ov_json_string(OV_OR_DEFAULT(values[i], "")));
+        }
+    }
+
+    ov_json_array_push(collector->rows, jrow);
+
+    return true;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -144,26 +172,34 @@ static QueryResult query_select(ov_database *self, uint32_t max_num_results,
     char select_sql[1000] = {0};
 
     if (ov_ptr_valid(sql, "No SQL statement") &&
+        ov_ptr_valid(jtarget, "No result target") &&
         add_limit_clause_if_required(self, select_sql, sizeof(select_sql), sql,
                                      max_num_results)) {
-        bool ok = query(self, select_sql, jtarget, error_msg);
-
-        if (ok) {
-            if ((0 == max_num_results) ||
-                result_has_less_entries_than((ov_json_value const **)jtarget,
-                                             max_num_results + 1)) {
-                return OK;
 
-            } else {
-                if (0 != jtarget) {
-                    *jtarget = ov_json_value_free(*jtarget);
-                }
+        // Rows are turned into the result right away, no need to collect
+        // more than max_num_results + 1 of them
+        RowCollector collector = {
+            .rows = ov_json_array(),
+            .max_num_rows = max_num_results,
+        };
+
+        ov_result res = ov_database_query_rows(self, select_sql, collect_row,
+                                               &collector);
+
+        if (OV_ERROR_NOERROR != res.error_code) {
+            ov_log_error("%s: %s", ov_string_sanitize(error_msg),
+                         ov_result_get_message(res));
+            ov_result_clear(&res);
+            collector.rows = ov_json_value_free(collector.rows);
+            return ERROR;
 
-                return TOO_MANY_RESULTS;
-            }
+        } else if (collector.too_many_rows) {
+            collector.rows = ov_json_value_free(collector.rows);
+            return TOO_MANY_RESULTS;
 
         } else {
-            return ERROR;
+            *jtarget = collector.rows;
+            return OK;
         }
 
     } else {
@@ -176,11 +212,11 @@ static QueryResult query_select(ov_database *self, uint32_t max_num_results,
 #define RECORDINGS_TABLE "recordings"
 #define ID_LEN 36
 #define URI_LEN 300
-#define LOOP_LEN 200
+#define LOOP_LEN OV_DB_LOOP_LEN
 
 #define PARTICIPATION_EVENTS_TABLE "events"
-#define USER_LEN 300
-#define ROLE_LEN 300
+#define USER_LEN OV_DB_USER_LEN
+#define ROLE_LEN OV_DB_ROLE_LEN
 #define PARTICIPATION_STATE_LEN 15
 
 #define STR_HELPER(x) #x
@@ -221,52 +257,82 @@ static char *epoch_secs_to_sql_datetime(char *target, size_t target_capacity,
 
 /*----------------------------------------------------------------------------*/
 
-bool ov_db_events_add_participation_state(ov_database *self, const char *user,
-                                          const char *role, const char *loop,
-                                          ov_participation_state state,
-                                          time_t time_epoch) {
+static bool participation_event_valid(const char *user, const char *role,
+                                      const char *loop,
+                                      ov_participation_state state) {
     size_t user_len = ov_string_len(user);
     size_t role_len = ov_string_len(role);
     size_t loop_len = ov_string_len(loop);
 
-    char sql[500] = {0};
+    return ov_ptr_valid(user,
+                        "Cannot insert participation event into database: No "
+                        "user given") &&
+           ov_ptr_valid(role,
+                        "Cannot insert participation event into database: No "
+                        "role given") &&
+           ov_ptr_valid(loop,
+                        "Cannot insert participation event into database: No "
+                        "loop given") &&
+           ov_cond_valid(user_len <= USER_LEN,
+                         "Cannot insert recording into database: User string "
+                         "is too long") &&
+           ov_cond_valid(role_len <= ROLE_LEN,
+                         "Cannot insert recording into database: Role string "
+                         "is too long") &&
+           ov_cond_valid(loop_len <= LOOP_LEN,
+                         "Cannot insert recording into database: Role string "
+                         "is too long") &&
+           ov_ptr_valid(ov_participation_state_to_string(state),
+                        "Cannot insert participation event into database: "
+                        "Invalid participation state") &&
+           ov_cond_valid(OV_PARTICIPATION_STATE_NONE != state,
+                         "Cannot insert participation event into database: "
+                         "Invalid participation state");
+}
+
+/*----------------------------------------------------------------------------*/
+
+#define PARTICIPATION_EVENT_COLUMNS 5
+
+static bool insert_participation_events(ov_database *self,
+                                        char const *const *values,
+                                        size_t num_events) {
+
+    ov_result res = ov_database_insert_rows(
+        self,
+        "INSERT INTO " PARTICIPATION_EVENTS_TABLE
+        " (usr, role, loop, evstate, evtime) "
+        " VALUES (?, ?, ?, ?, ?);",
+        PARTICIPATION_EVENT_COLUMNS, values, num_events);
+
+    if (OV_ERROR_NOERROR != res.error_code) {
+        ov_log_error("Cannot insert participation event into database: %s",
+                     ov_result_get_message(res));
+        ov_result_clear(&res);
+
+        return false;
+
+    } else {
+        ov_result_clear(&res);
+        return true;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_db_events_add_participation_state(ov_database *self, const char *user,
+                                          const char *role, const char *loop,
+                                          ov_participation_state state,
+                                          time_t time_epoch) {
     char str_time[30] = {0};
-    char const *str_state = ov_participation_state_to_string(state);
-
-    if (ov_ptr_valid(user,
-                     "Cannot insert participation event into database: No user "
-                     "given") &&
-        ov_ptr_valid(role,
-                     "Cannot insert participation event into database: No role "
-                     "given") &&
-        ov_ptr_valid(loop,
-                     "Cannot insert participation event into database: No loop "
-                     "given") &&
-        ov_cond_valid(user_len <= USER_LEN,
-                      "Cannot insert recording into database: User string is "
-                      "too long") &&
-        ov_cond_valid(role_len <= ROLE_LEN,
-                      "Cannot insert recording into database: Role string is "
-                      "too long") &&
-        ov_cond_valid(loop_len <= LOOP_LEN,
-                      "Cannot insert recording into database: Role string is "
-                      "too long") &&
-        ov_ptr_valid(str_state,
-                     "Cannot insert participation event into database: "
-                     "Invalid participation state") &&
-        ov_cond_valid(OV_PARTICIPATION_STATE_NONE != state,
-                      "Cannot insert participation event into database: "
-                      "Invalid participation state")) {
-        snprintf(
-            sql, sizeof(sql),
-            "INSERT INTO " PARTICIPATION_EVENTS_TABLE
-            " (usr, role, loop, evstate, evtime) "
-            " VALUES ('%s', '%s', '%s', '%s', '%s');",
-            user, role, loop, str_state,
-            epoch_secs_to_sql_datetime(str_time, sizeof(str_time), time_epoch));
 
-        return query(self, sql, 0,
-                     "Cannot insert participation event into database");
+    if (participation_event_valid(user, role, loop, state)) {
+        char const *values[PARTICIPATION_EVENT_COLUMNS] = {
+            user, role, loop, ov_participation_state_to_string(state),
+            epoch_secs_to_sql_datetime(str_time, sizeof(str_time),
+                                       time_epoch)};
+
+        return insert_participation_events(self, values, 1);
 
     } else {
         return false;
@@ -275,6 +341,52 @@ bool ov_db_events_add_participation_state(ov_database *self, const char *user,
 
 /*----------------------------------------------------------------------------*/
 
+bool ov_db_events_add_participation_states(
+    ov_database *self, ov_db_participation_event const *events,
+    size_t num_events) {
+
+    typedef char Timestamp[30];
+
+    char const **values = 0;
+    Timestamp *timestamps = 0;
+
+    bool ok = ov_ptr_valid(events,
+                           "Cannot insert participation events into database: "
+                           "No events given");
+
+    if (ok && (0 < num_events)) {
+        values = calloc(num_events * PARTICIPATION_EVENT_COLUMNS,
+                        sizeof(char const *));
+        timestamps = calloc(num_events, sizeof(Timestamp));
+    }
+
+    for (size_t i = 0; ok && (i < num_events); ++i) {
+
+        ov_db_participation_event const *event = events + i;
+        char const **row = values + i * PARTICIPATION_EVENT_COLUMNS;
+
+        ok = participation_event_valid(event->user, event->role, event->loop,
+                                       event->state);
+
+        row[0] = event->user;
+        row[1] = event->role;
+        row[2] = event->loop;
+        row[3] = ov_participation_state_to_string(event->state);
+        row[4] = epoch_secs_to_sql_datetime(
+            timestamps[i], sizeof(Timestamp), event->time_epoch);
+    }
+
+    ok = ok && ((0 == num_events) ||
+                insert_participation_events(self, values, num_events));
+
+    values = ov_free(values);
+    timestamps = ov_free(timestamps);
+
+    return ok;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool
 pstate_params_to_sql_query(char *target, size_t target_capacity,
                            ov_db_events_get_participation_state_params params) {
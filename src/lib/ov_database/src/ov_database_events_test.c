@@ -195,6 +195,54 @@ static bool pstates_user_is_there(ov_json_value const *jval, char const *user) {
 
 /*----------------------------------------------------------------------------*/
 
+static int test_ov_db_events_add_participation_states() {
+
+    ov_db_participation_event events[] = {
+        {.user = "user1",
+         .role = "role2",
+         .loop = "loop3",
+         .state = OV_PARTICIPATION_STATE_SEND,
+         .time_epoch = 10},
+        {.user = "o'user",
+         .role = "role2",
+         .loop = "loop3",
+         .state = OV_PARTICIPATION_STATE_RECV,
+         .time_epoch = 11},
+    };
+
+    testrun(!ov_db_events_add_participation_states(0, events, 2));
+
+    ov_database *db = connect_to_db();
+    testrun(0 != db);
+    testrun(ov_db_prepare(db));
+
+    testrun(!ov_db_events_add_participation_states(db, 0, 2));
+    testrun(ov_db_events_add_participation_states(db, events, 0));
+    testrun(ov_db_events_add_participation_states(db, events, 2));
+
+    ov_json_value *jresult =
+        ov_db_events_get_participation_state(db, 0, .role = "role2");
+
+    testrun(2 == ov_json_array_count(jresult));
+    testrun(pstates_user_is_there(jresult, "user1"));
+    testrun(pstates_user_is_there(jresult, "o'user"));
+    jresult = ov_json_value_free(jresult);
+
+    // invalid events are not written at all
+    events[1].state = OV_PARTICIPATION_STATE_NONE;
+    testrun(!ov_db_events_add_participation_states(db, events, 2));
+
+    jresult = ov_db_events_get_participation_state(db, 0, .role = "role2");
+    testrun(2 == ov_json_array_count(jresult));
+    jresult = ov_json_value_free(jresult);
+
+    db = ov_database_close(db);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 static int test_ov_db_events_get_partitipation_state() {
 
     ov_database *db = connect_to_db();
@@ -730,6 +778,7 @@ static int test_ov_db_recordings_get() {
 OV_TEST_RUN("ov_database_events", test_ov_db_prepare,
             test_ov_db_events_add_participation_state,
             test_ov_db_events_get_partitipation_state,
+            test_ov_db_events_add_participation_states,
             test_ov_db_recordings_add, test_ov_db_recordings_remove,
             test_ov_db_recordings_get);
 
@@ -0,0 +1,482 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_database_journal.c
+
+        @date           2026-10-18
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_database_journal.h"
+
+#include <ov_arch/ov_arch_math.h>
+#include <ov_base/ov_string.h>
+#include <ov_base/ov_time.h>
+#include <ov_base/ov_utils.h>
+
+#include <pthread.h>
+#include <time.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define OV_DB_JOURNAL_MAGIC_BYTES 0x30001abb
+
+struct ov_db_journal {
+
+    uint32_t magic_bytes;
+    ov_db_journal_config config;
+
+    pthread_t thread;
+    pthread_mutex_t lock;
+
+    /* signals the writer: events queued, flush or stop requested */
+    pthread_cond_t work;
+
+    /* signals producers and flushes: events taken or written */
+    pthread_cond_t done;
+
+    bool running;
+    bool flush;
+
+    /* queue of events, fixed size ring */
+    struct {
+
+        ov_db_participation_event *events;
+        size_t head;
+        size_t count;
+
+        /* time the oldest queued event was added */
+        uint64_t since_usecs;
+
+    } queue;
+
+    /* events taken by the writer, accessed by the writer only */
+    ov_db_participation_event *batch;
+    size_t writing;
+
+    ov_db_journal_stats stats;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static struct timespec abs_timeout(uint64_t usecs_from_now) {
+
+    struct timespec ts = {0};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    uint64_t nsecs = (uint64_t)ts.tv_nsec + 1000 * (usecs_from_now % 1000000);
+
+    ts.tv_sec += usecs_from_now / 1000000 + nsecs / 1000000000;
+    ts.tv_nsec = nsecs % 1000000000;
+
+    return ts;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      QUEUE - lock must be held
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static ov_db_participation_event *queue_push(ov_db_journal *self) {
+
+    size_t capacity = self->config.capacity;
+    size_t tail = (self->queue.head + self->queue.count) % capacity;
+
+    if (0 == self->queue.count) {
+        self->queue.since_usecs = ov_time_get_current_time_usecs();
+    }
+
+    ++self->queue.count;
+    return self->queue.events + tail;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void queue_drop_oldest(ov_db_journal *self) {
+
+    self->queue.head = (self->queue.head + 1) % self->config.capacity;
+    --self->queue.count;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t queue_take(ov_db_journal *self, ov_db_participation_event *out,
+                         size_t max) {
+
+    size_t capacity = self->config.capacity;
+    size_t num = OV_MIN(max, self->queue.count);
+
+    /* copy at most 2 contiguous parts of the ring */
+    size_t first = OV_MIN(num, capacity - self->queue.head);
+
+    memcpy(out, self->queue.events + self->queue.head,
+           first * sizeof(ov_db_participation_event));
+    memcpy(out + first, self->queue.events,
+           (num - first) * sizeof(ov_db_participation_event));
+
+    self->queue.head = (self->queue.head + num) % capacity;
+    self->queue.count -= num;
+
+    if (0 < self->queue.count) {
+        self->queue.since_usecs = ov_time_get_current_time_usecs();
+    }
+
+    return num;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool batch_due(ov_db_journal *self) {
+
+    if ((!self->running) || self->flush ||
+        (self->queue.count >= self->config.batch_size)) {
+        return true;
+    }
+
+    uint64_t now = ov_time_get_current_time_usecs();
+
+    return now >= self->queue.since_usecs + self->config.flush_interval_usecs;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      WRITER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void *writer_run(void *arg) {
+
+    ov_db_journal *self = arg;
+
+    pthread_mutex_lock(&self->lock);
+
+    while (true) {
+
+        if (0 == self->queue.count) {
+
+            self->flush = false;
+
+            if (!self->running)
+                break;
+
+            pthread_cond_wait(&self->work, &self->lock);
+            continue;
+        }
+
+        if (!batch_due(self)) {
+
+            uint64_t waited =
+                ov_time_get_current_time_usecs() - self->queue.since_usecs;
+
+            struct timespec deadline =
+                abs_timeout(self->config.flush_interval_usecs - waited);
+
+            pthread_cond_timedwait(&self->work, &self->lock, &deadline);
+            continue;
+        }
+
+        self->writing =
+            queue_take(self, self->batch, self->config.batch_size);
+
+        pthread_cond_broadcast(&self->done);
+        pthread_mutex_unlock(&self->lock);
+
+        bool ok = ov_db_events_add_participation_states(
+            self->config.db, self->batch, self->writing);
+
+        pthread_mutex_lock(&self->lock);
+
+        if (ok) {
+            self->stats.written += self->writing;
+        } else {
+            self->stats.failed += self->writing;
+        }
+
+        self->writing = 0;
+        pthread_cond_broadcast(&self->done);
+    }
+
+    pthread_cond_broadcast(&self->done);
+    pthread_mutex_unlock(&self->lock);
+
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      PUBLIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static ov_db_journal *as_journal(void *self) {
+
+    ov_db_journal *journal = self;
+
+    if ((0 == journal) || (OV_DB_JOURNAL_MAGIC_BYTES != journal->magic_bytes))
+        return 0;
+
+    return journal;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_db_journal *ov_db_journal_create(ov_db_journal_config config) {
+
+    ov_db_journal *self = 0;
+
+    if (!ov_ptr_valid(config.db, "Cannot create journal - no database"))
+        goto error;
+
+    config.capacity =
+        OV_OR_DEFAULT(config.capacity, OV_DB_JOURNAL_CAPACITY_DEFAULT);
+    config.batch_size =
+        OV_OR_DEFAULT(config.batch_size, OV_DB_JOURNAL_BATCH_SIZE_DEFAULT);
+    config.batch_size = OV_MIN(config.batch_size, config.capacity);
+    config.flush_interval_usecs =
+        OV_OR_DEFAULT(config.flush_interval_usecs,
+                      OV_DB_JOURNAL_FLUSH_INTERVAL_USECS_DEFAULT);
+    config.block_timeout_usecs =
+        OV_OR_DEFAULT(config.block_timeout_usecs,
+                      OV_DB_JOURNAL_BLOCK_TIMEOUT_USECS_DEFAULT);
+
+    self = calloc(1, sizeof(ov_db_journal));
+    if (!self)
+        goto error;
+
+    self->magic_bytes = OV_DB_JOURNAL_MAGIC_BYTES;
+    self->config = config;
+
+    self->queue.events =
+        calloc(config.capacity, sizeof(ov_db_participation_event));
+    self->batch = calloc(config.batch_size, sizeof(ov_db_participation_event));
+
+    if (!self->queue.events || !self->batch)
+        goto error;
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+
+    pthread_mutex_init(&self->lock, NULL);
+    pthread_cond_init(&self->work, &attr);
+    pthread_cond_init(&self->done, &attr);
+    pthread_condattr_destroy(&attr);
+
+    self->running = true;
+
+    if (0 != pthread_create(&self->thread, NULL, writer_run, self)) {
+
+        ov_log_error("Cannot create journal - failed to start writer");
+
+        pthread_cond_destroy(&self->done);
+        pthread_cond_destroy(&self->work);
+        pthread_mutex_destroy(&self->lock);
+        goto error;
+    }
+
+    return self;
+error:
+    if (self) {
+        self->queue.events = ov_free(self->queue.events);
+        self->batch = ov_free(self->batch);
+    }
+    return ov_free(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_db_journal *ov_db_journal_free(ov_db_journal *self) {
+
+    self = as_journal(self);
+    if (!self)
+        return 0;
+
+    pthread_mutex_lock(&self->lock);
+    self->running = false;
+    pthread_cond_signal(&self->work);
+    pthread_mutex_unlock(&self->lock);
+
+    pthread_join(self->thread, NULL);
+
+    if (0 < self->stats.failed) {
+        ov_log_warning("Journal failed to write %" PRIu64 " events",
+                       self->stats.failed);
+    }
+
+    pthread_cond_destroy(&self->done);
+    pthread_cond_destroy(&self->work);
+    pthread_mutex_destroy(&self->lock);
+
+    self->queue.events = ov_free(self->queue.events);
+    self->batch = ov_free(self->batch);
+
+    return ov_free(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool wait_for_space(ov_db_journal *self) {
+
+    struct timespec deadline = abs_timeout(self->config.block_timeout_usecs);
+
+    while (self->running && (self->queue.count == self->config.capacity)) {
+
+        if (0 != pthread_cond_timedwait(&self->done, &self->lock, &deadline))
+            break;
+    }
+
+    return self->queue.count < self->config.capacity;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool make_space(ov_db_journal *self) {
+
+    if (self->queue.count < self->config.capacity)
+        return true;
+
+    switch (self->config.policy) {
+
+    case OV_DB_JOURNAL_DROP_OLDEST:
+
+        queue_drop_oldest(self);
+        ++self->stats.dropped;
+        return true;
+
+    case OV_DB_JOURNAL_BLOCK:
+
+        pthread_cond_signal(&self->work);
+
+        if (wait_for_space(self))
+            return true;
+
+        ++self->stats.dropped;
+        return false;
+
+    default:
+
+        ++self->stats.dropped;
+        return false;
+    };
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_db_journal_add_participation_state(ov_db_journal *self,
+                                           const char *user,
+                                           const char *role,
+                                           const char *loop,
+                                           ov_participation_state state,
+                                           time_t time_epoch) {
+
+    self = as_journal(self);
+
+    if (!ov_ptr_valid(self, "Cannot journal event - no journal") ||
+        !ov_ptr_valid(user, "Cannot journal event - no user") ||
+        !ov_ptr_valid(role, "Cannot journal event - no role") ||
+        !ov_ptr_valid(loop, "Cannot journal event - no loop") ||
+        !ov_cond_valid(OV_DB_USER_LEN >= ov_string_len(user),
+                       "Cannot journal event - user too long") ||
+        !ov_cond_valid(OV_DB_ROLE_LEN >= ov_string_len(role),
+                       "Cannot journal event - role too long") ||
+        !ov_cond_valid(OV_DB_LOOP_LEN >= ov_string_len(loop),
+                       "Cannot journal event - loop too long") ||
+        !ov_cond_valid(OV_PARTICIPATION_STATE_NONE != state,
+                       "Cannot journal event - invalid state")) {
+        return false;
+    }
+
+    pthread_mutex_lock(&self->lock);
+
+    if (!make_space(self)) {
+        pthread_mutex_unlock(&self->lock);
+        return false;
+    }
+
+    ov_db_participation_event *event = queue_push(self);
+
+    ov_string_copy(event->user, user, sizeof(event->user));
+    ov_string_copy(event->role, role, sizeof(event->role));
+    ov_string_copy(event->loop, loop, sizeof(event->loop));
+    event->state = state;
+    event->time_epoch = time_epoch;
+
+    ++self->stats.queued;
+
+    /* the writer sleeps until the first event or waits for a full batch */
+    if ((1 == self->queue.count) ||
+        (self->config.batch_size == self->queue.count)) {
+        pthread_cond_signal(&self->work);
+    }
+
+    pthread_mutex_unlock(&self->lock);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_db_journal_flush(ov_db_journal *self) {
+
+    self = as_journal(self);
+    if (!self)
+        return false;
+
+    pthread_mutex_lock(&self->lock);
+
+    self->flush = true;
+    pthread_cond_signal(&self->work);
+
+    while ((0 < self->queue.count) || (0 < self->writing)) {
+        pthread_cond_wait(&self->done, &self->lock);
+    }
+
+    pthread_mutex_unlock(&self->lock);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_db_journal_stats ov_db_journal_get_stats(ov_db_journal *self) {
+
+    ov_db_journal_stats stats = {0};
+
+    self = as_journal(self);
+    if (!self)
+        return stats;
+
+    pthread_mutex_lock(&self->lock);
+
+    stats = self->stats;
+    stats.pending = self->queue.count + self->writing;
+
+    pthread_mutex_unlock(&self->lock);
+
+    return stats;
+}
@@ -0,0 +1,425 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_database_journal_test.c
+
+        @date           2026-10-18
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_database_journal.c"
+#include <ov_test/ov_test.h>
+#include <unistd.h>
+
+/*----------------------------------------------------------------------------*/
+
+/* Database keeping the users inserted, writes block while the gate is
+ * closed */
+typedef struct {
+
+    ov_database public;
+
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+
+    bool gate_closed;
+    size_t writers_waiting;
+
+    size_t rows;
+    char users[32][OV_DB_USER_LEN + 1];
+
+} FakeDb;
+
+static ov_result fake_insert_rows(ov_database *self, char const *sql,
+                                  size_t num_params, char const *const *values,
+                                  size_t num_rows) {
+
+    UNUSED(sql);
+
+    FakeDb *db = (FakeDb *)self;
+
+    pthread_mutex_lock(&db->lock);
+
+    ++db->writers_waiting;
+    pthread_cond_broadcast(&db->cond);
+
+    while (db->gate_closed) {
+        pthread_cond_wait(&db->cond, &db->lock);
+    }
+
+    --db->writers_waiting;
+
+    for (size_t i = 0; i < num_rows; ++i) {
+
+        if (db->rows < 32) {
+            ov_string_copy(db->users[db->rows], values[i * num_params],
+                           OV_DB_USER_LEN + 1);
+        }
+
+        ++db->rows;
+    }
+
+    pthread_mutex_unlock(&db->lock);
+
+    return (ov_result){.error_code = OV_ERROR_NOERROR};
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void fake_init(FakeDb *db) {
+
+    *db = (FakeDb){
+        .public.insert_rows = fake_insert_rows,
+        .gate_closed = true,
+    };
+
+    pthread_mutex_init(&db->lock, 0);
+    pthread_cond_init(&db->cond, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void fake_wait_for_writer(FakeDb *db) {
+
+    pthread_mutex_lock(&db->lock);
+
+    while (0 == db->writers_waiting) {
+        pthread_cond_wait(&db->cond, &db->lock);
+    }
+
+    pthread_mutex_unlock(&db->lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void fake_open_gate(FakeDb *db) {
+
+    pthread_mutex_lock(&db->lock);
+    db->gate_closed = false;
+    pthread_cond_broadcast(&db->cond);
+    pthread_mutex_unlock(&db->lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void fake_clear(FakeDb *db) {
+
+    pthread_cond_destroy(&db->cond);
+    pthread_mutex_destroy(&db->lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool add(ov_db_journal *journal, char const *user) {
+
+    return ov_db_journal_add_participation_state(
+        journal, user, "role", "loop", OV_PARTICIPATION_STATE_SEND, 1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Closes the gate and adds 2 events to stall the writer with a full
+ * batch, 4 more events to fill the queue
+ */
+static ov_db_journal *stalled_journal(FakeDb *db,
+                                      ov_db_journal_policy policy) {
+
+    fake_init(db);
+
+    ov_db_journal *journal = ov_db_journal_create((ov_db_journal_config){
+        .db = &db->public,
+        .capacity = 4,
+        .batch_size = 2,
+        .flush_interval_usecs = 10 * 1000 * 1000,
+        .policy = policy,
+        .block_timeout_usecs = 50000,
+    });
+
+    if (add(journal, "a") && add(journal, "b")) {
+        fake_wait_for_writer(db);
+    }
+
+    if (!add(journal, "c") || !add(journal, "d") || !add(journal, "e") ||
+        !add(journal, "f")) {
+        journal = ov_db_journal_free(journal);
+    }
+
+    return journal;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_db_journal_create() {
+
+    testrun(0 == ov_db_journal_create((ov_db_journal_config){0}));
+
+    FakeDb db = {0};
+    fake_init(&db);
+
+    ov_db_journal *journal =
+        ov_db_journal_create((ov_db_journal_config){.db = &db.public});
+    testrun(0 != journal);
+
+    testrun(OV_DB_JOURNAL_CAPACITY_DEFAULT == journal->config.capacity);
+    testrun(OV_DB_JOURNAL_BATCH_SIZE_DEFAULT == journal->config.batch_size);
+    testrun(OV_DB_JOURNAL_FLUSH_INTERVAL_USECS_DEFAULT ==
+            journal->config.flush_interval_usecs);
+    testrun(OV_DB_JOURNAL_DROP_NEWEST == journal->config.policy);
+
+    testrun(0 == ov_db_journal_free(journal));
+
+    // batches never exceed the queue
+    journal = ov_db_journal_create((ov_db_journal_config){
+        .db = &db.public, .capacity = 10, .batch_size = 100});
+    testrun(0 != journal);
+    testrun(10 == journal->config.batch_size);
+
+    testrun(0 == ov_db_journal_free(journal));
+    testrun(0 == ov_db_journal_free(0));
+
+    fake_clear(&db);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_db_journal_add_participation_state() {
+
+    FakeDb db = {0};
+    fake_init(&db);
+    db.gate_closed = false;
+
+    ov_db_journal *journal = ov_db_journal_create((ov_db_journal_config){
+        .db = &db.public,
+        .batch_size = 3,
+        .flush_interval_usecs = 1000,
+    });
+    testrun(0 != journal);
+
+    testrun(!ov_db_journal_add_participation_state(
+        0, "a", "role", "loop", OV_PARTICIPATION_STATE_SEND, 1));
+    testrun(!ov_db_journal_add_participation_state(
+        journal, 0, "role", "loop", OV_PARTICIPATION_STATE_SEND, 1));
+    testrun(!ov_db_journal_add_participation_state(
+        journal, "a", 0, "loop", OV_PARTICIPATION_STATE_SEND, 1));
+    testrun(!ov_db_journal_add_participation_state(
+        journal, "a", "role", 0, OV_PARTICIPATION_STATE_SEND, 1));
+    testrun(!ov_db_journal_add_participation_state(
+        journal, "a", "role", "loop", OV_PARTICIPATION_STATE_NONE, 1));
+
+    for (size_t i = 0; i < 10; ++i) {
+        testrun(add(journal, "a"));
+    }
+
+    // written by the flush interval without any explicit flush
+    for (size_t i = 0;
+         (i < 1000) && (10 > ov_db_journal_get_stats(journal).written); ++i) {
+        usleep(1000);
+    }
+
+    ov_db_journal_stats stats = ov_db_journal_get_stats(journal);
+    testrun(10 == stats.queued);
+    testrun(10 == stats.written);
+    testrun(0 == stats.pending);
+    testrun(0 == stats.dropped);
+    testrun(0 == stats.failed);
+
+    testrun(0 == ov_db_journal_free(journal));
+    fake_clear(&db);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_db_journal_policy() {
+
+    FakeDb db = {0};
+
+    // drop newest
+
+    ov_db_journal *journal =
+        stalled_journal(&db, OV_DB_JOURNAL_DROP_NEWEST);
+    testrun(0 != journal);
+
+    testrun(!add(journal, "g"));
+
+    ov_db_journal_stats stats = ov_db_journal_get_stats(journal);
+    testrun(6 == stats.queued);
+    testrun(1 == stats.dropped);
+    testrun(6 == stats.pending);
+
+    fake_open_gate(&db);
+    testrun(ov_db_journal_flush(journal));
+
+    testrun(6 == db.rows);
+    testrun(0 == strcmp("f", db.users[5]));
+    testrun(6 == ov_db_journal_get_stats(journal).written);
+
+    testrun(0 == ov_db_journal_free(journal));
+    fake_clear(&db);
+
+    // drop oldest
+
+    journal = stalled_journal(&db, OV_DB_JOURNAL_DROP_OLDEST);
+    testrun(0 != journal);
+
+    testrun(add(journal, "g"));
+    testrun(1 == ov_db_journal_get_stats(journal).dropped);
+
+    fake_open_gate(&db);
+    testrun(ov_db_journal_flush(journal));
+
+    testrun(6 == db.rows);
+    testrun(0 == strcmp("d", db.users[2]));
+    testrun(0 == strcmp("g", db.users[5]));
+
+    testrun(0 == ov_db_journal_free(journal));
+    fake_clear(&db);
+
+    // block until timeout
+
+    journal = stalled_journal(&db, OV_DB_JOURNAL_BLOCK);
+    testrun(0 != journal);
+
+    uint64_t start = ov_time_get_current_time_usecs();
+    testrun(!add(journal, "g"));
+    testrun(50000 <= ov_time_get_current_time_usecs() - start);
+    testrun(1 == ov_db_journal_get_stats(journal).dropped);
+
+    fake_open_gate(&db);
+    testrun(add(journal, "g"));
+
+    // pending events are written on free
+    testrun(0 == ov_db_journal_free(journal));
+    testrun(7 == db.rows);
+
+    fake_clear(&db);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_db_journal_sqlite() {
+
+    ov_database *db = ov_database_connect(
+        (ov_database_info){.type = OV_DB_SQLITE, .dbname = 0});
+    testrun(0 != db);
+    testrun(ov_db_prepare(db));
+
+    ov_db_journal *journal = ov_db_journal_create(
+        (ov_db_journal_config){.db = db, .batch_size = 64});
+    testrun(0 != journal);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        testrun(ov_db_journal_add_participation_state(
+            journal, (i % 2) ? "odd" : "even", "role", "loop",
+            OV_PARTICIPATION_STATE_PTT, i));
+    }
+
+    testrun(ov_db_journal_flush(journal));
+    testrun(1000 == ov_db_journal_get_stats(journal).written);
+
+    ov_json_value *jresult =
+        ov_db_events_get_participation_state(db, 0, .user = "odd");
+    testrun(500 == ov_json_array_count(jresult));
+    jresult = ov_json_value_free(jresult);
+
+    testrun(0 == ov_db_journal_free(journal));
+    db = ov_database_close(db);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int check_journal_throughput() {
+
+    size_t const num_events = 20000;
+
+    char path[] = "/tmp/ov_database_journal_XXXXXX";
+    int fd = mkstemp(path);
+    testrun(-1 != fd);
+    close(fd);
+
+    ov_database *db = ov_database_connect(
+        (ov_database_info){.type = OV_DB_SQLITE, .dbname = path});
+    testrun(0 != db);
+    testrun(ov_db_prepare(db));
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < num_events / 10; ++i) {
+        testrun(ov_db_events_add_participation_state(
+            db, "user", "role", "loop", OV_PARTICIPATION_STATE_PTT, i));
+    }
+
+    uint64_t direct = ov_time_get_current_time_usecs() - start;
+
+    // a burst exceeds any queue, measure throughput instead of drops
+    ov_db_journal *journal = ov_db_journal_create((ov_db_journal_config){
+        .db = db,
+        .policy = OV_DB_JOURNAL_BLOCK,
+        .block_timeout_usecs = 1000 * 1000,
+    });
+    testrun(0 != journal);
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < num_events; ++i) {
+        ov_db_journal_add_participation_state(
+            journal, "user", "role", "loop", OV_PARTICIPATION_STATE_PTT, i);
+    }
+
+    uint64_t queued = ov_time_get_current_time_usecs() - start;
+
+    testrun(ov_db_journal_flush(journal));
+
+    uint64_t written = ov_time_get_current_time_usecs() - start;
+
+    ov_db_journal_stats stats = ov_db_journal_get_stats(journal);
+
+    fprintf(stdout,
+            "direct insert     %" PRIu64 " ns/op\n"
+            "journal add       %" PRIu64 " ns/op\n"
+            "journal written   %" PRIu64 " ns/op (%" PRIu64 " dropped)\n",
+            direct * 1000 / (num_events / 10), queued * 1000 / num_events,
+            written * 1000 / num_events, stats.dropped);
+
+    testrun(0 == ov_db_journal_free(journal));
+    db = ov_database_close(db);
+
+    unlink(path);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+OV_TEST_RUN("ov_database_journal", test_ov_db_journal_create,
+            test_ov_db_journal_add_participation_state,
+            test_ov_db_journal_policy, test_ov_db_journal_sqlite,
+            check_journal_throughput);
+
+/*----------------------------------------------------------------------------*/
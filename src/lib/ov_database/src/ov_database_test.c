@@ -346,6 +346,155 @@ static int test_ov_database_query() {
 
 /*----------------------------------------------------------------------------*/
 
+typedef struct {
+
+    size_t rows;
+    size_t stop_after;
+    char names[10][20];
+
+} RowCounter;
+
+static bool count_row(void *userdata, size_t num_cols,
+                      char const *const *values, char const *const *names) {
+
+    RowCounter *counter = userdata;
+
+    if ((2 == num_cols) && ov_string_equal("name", names[0]) &&
+        ov_string_equal("event", names[1]) && (counter->rows < 10)) {
+        ov_string_copy(counter->names[counter->rows], values[0], 20);
+    }
+
+    ++counter->rows;
+
+    return (0 == counter->stop_after) || (counter->rows < counter->stop_after);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int check_query_rows(ov_database *db) {
+
+    RowCounter counter = {0};
+
+    ov_result res = ov_database_query_rows(
+        db, "SELECT name, event FROM events ORDER BY name;", count_row,
+        &counter);
+
+    testrun(OV_ERROR_NOERROR == res.error_code);
+    testrun(3 == counter.rows);
+    testrun(ov_string_equal("anna", counter.names[0]));
+    testrun(ov_string_equal("bert", counter.names[1]));
+    testrun(ov_string_equal("o'hara", counter.names[2]));
+
+    // stopped by callback is no error
+    counter = (RowCounter){.stop_after = 2};
+
+    res = ov_database_query_rows(db, "SELECT name, event FROM events;",
+                                 count_row, &counter);
+
+    testrun(OV_ERROR_NOERROR == res.error_code);
+    testrun(2 == counter.rows);
+
+    res = ov_database_query_rows(db, "SELECT nonsense FROM nowhere;",
+                                 count_row, &counter);
+
+    testrun(OV_ERROR_NOERROR != res.error_code);
+    ov_result_clear(&res);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int check_insert_rows(ov_database *db) {
+
+    char const *insert = "INSERT INTO events (name, event) VALUES (?, ?);";
+
+    ov_result res = ov_database_query(db,
+                                      "CREATE TABLE events (name "
+                                      "VARCHAR(150), event VARCHAR(150));",
+                                      0);
+    testrun(OV_ERROR_NOERROR == res.error_code);
+
+    char const *values[] = {"bert", "ptt", "o'hara", "ptt", "anna", 0};
+
+    res = ov_database_insert_rows(0, insert, 2, values, 3);
+    testrun(OV_ERROR_NOERROR != res.error_code);
+    ov_result_clear(&res);
+
+    res = ov_database_insert_rows(db, 0, 2, values, 3);
+    testrun(OV_ERROR_NOERROR != res.error_code);
+    ov_result_clear(&res);
+
+    res = ov_database_insert_rows(db, insert, 2, 0, 3);
+    testrun(OV_ERROR_NOERROR != res.error_code);
+    ov_result_clear(&res);
+
+    res = ov_database_insert_rows(db, insert, 2, values, 0);
+    testrun(OV_ERROR_NOERROR == res.error_code);
+
+    res = ov_database_insert_rows(db, insert, 2, values, 3);
+    testrun(OV_ERROR_NOERROR == res.error_code);
+
+    // statement is reused
+    res = ov_database_insert_rows(db, "INSERT INTO nowhere VALUES (?, ?);", 2,
+                                  values, 1);
+    testrun(OV_ERROR_NOERROR != res.error_code);
+    ov_result_clear(&res);
+
+    // all or nothing
+    res = ov_database_query(db,
+                            "CREATE TABLE unique_events (name VARCHAR(150) "
+                            "UNIQUE, event VARCHAR(150));",
+                            0);
+    testrun(OV_ERROR_NOERROR == res.error_code);
+
+    char const *duplicates[] = {"carl", "ptt", "dora", "ptt", "carl", "ptt"};
+
+    res = ov_database_insert_rows(
+        db, "INSERT INTO unique_events (name, event) VALUES (?, ?);", 2,
+        duplicates, 3);
+    testrun(OV_ERROR_NOERROR != res.error_code);
+    ov_result_clear(&res);
+
+    RowCounter counter = {0};
+
+    res = ov_database_query_rows(db, "SELECT name, event FROM unique_events;",
+                                 count_row, &counter);
+    testrun(OV_ERROR_NOERROR == res.error_code);
+    testrun(0 == counter.rows);
+
+    return check_query_rows(db);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_database_insert_rows() {
+
+    ov_database *db = ov_database_connect(database_info(0));
+    testrun(0 != db);
+
+    testrun(check_insert_rows(db));
+
+    db = ov_database_close(db);
+
+    // Same with the generic implementation used by databases without
+    // query_rows / insert_rows
+
+    db = ov_database_connect(database_info(0));
+    testrun(0 != db);
+
+    db->query_rows = 0;
+    db->insert_rows = 0;
+
+    testrun(check_insert_rows(db));
+
+    db = ov_database_close(db);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 static int teardown() {
 
     ov_teardown();
@@ -357,4 +506,5 @@ static int teardown() {
 OV_TEST_RUN("ov_database", test_ov_database_info_from_json,
             test_ov_database_info_to_json, test_ov_database_register_connector,
             test_ov_database_connect, test_ov_database_connect_singleton,
-            test_ov_database_query, teardown);
+            test_ov_database_query, test_ov_database_insert_rows,
+            teardown);
@@ -0,0 +1,227 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_dtls_handshake_pool.h
+
+        @date           2026-10-18
+
+        Worker threads for passive DTLS-SRTP handshakes.
+
+        The eventloop only passes datagrams to some ov_dtls_handshake.
+        All SSL processing (cookie exchange, ECDHE, certificate signing and
+        the export of the SRTP keying material) is done within the workers.
+
+        Datagrams to be sent and the SRTP keys are delivered within the
+        thread of config.loop using the callbacks of the handshake.
+
+        Each handshake is processed by at most one worker at some time,
+        datagrams of some handshake are processed in order.
+
+        NOTE the SSL_CTX used MUST be threadsafe, i.e. cookie callbacks
+        MUST NOT use unprotected shared state.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_dtls_handshake_pool_h
+#define ov_dtls_handshake_pool_h
+
+#include "ov_dtls.h"
+
+#include <openssl/ssl.h>
+
+#define OV_DTLS_HANDSHAKE_POOL_THREADS_DEFAULT 2
+#define OV_DTLS_HANDSHAKE_POOL_THREADS_MAX 64
+
+#define OV_DTLS_SRTP_PROFILE_NAME_MAX 64
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_dtls_handshake_pool ov_dtls_handshake_pool;
+typedef struct ov_dtls_handshake ov_dtls_handshake;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_dtls_handshake_pool_config {
+
+    ov_event_loop *loop; // loop of the callbacks
+
+    size_t threads; // default OV_DTLS_HANDSHAKE_POOL_THREADS_DEFAULT
+
+} ov_dtls_handshake_pool_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_dtls_srtp_keys {
+
+    char profile[OV_DTLS_SRTP_PROFILE_NAME_MAX];
+
+    uint32_t key_len;
+    uint32_t salt_len;
+
+    struct {
+
+        uint8_t key[OV_DTLS_KEY_MAX];
+        uint8_t salt[OV_DTLS_SALT_MAX];
+
+    } server;
+
+    struct {
+
+        uint8_t key[OV_DTLS_KEY_MAX];
+        uint8_t salt[OV_DTLS_SALT_MAX];
+
+    } client;
+
+} ov_dtls_srtp_keys;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_dtls_handshake_config {
+
+    SSL_CTX *ctx;
+
+    /* SRTP profiles offered */
+    char srtp_profile[OV_DTLS_PROFILE_MAX];
+
+    struct {
+
+        void *userdata;
+
+        /* datagram to be sent to the remote */
+        ssize_t (*send)(void *userdata, const uint8_t *buffer, size_t size);
+
+        /* handshake done, SRTP keys exported */
+        void (*keys)(void *userdata, const ov_dtls_srtp_keys *keys);
+
+    } callback;
+
+} ov_dtls_handshake_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_dtls_handshake_pool_stats {
+
+    size_t threads;
+
+    struct {
+
+        size_t current; // handshakes waiting for some worker
+        size_t max;     // max since creation
+
+    } queue;
+
+    uint64_t completed;
+
+    /* time from the first datagram to the export of the keys */
+    struct {
+
+        uint64_t last_usec;
+        uint64_t max_usec;
+        uint64_t avg_usec;
+
+    } latency;
+
+    /* time waited for some worker */
+    struct {
+
+        uint64_t max_usec;
+        uint64_t avg_usec;
+
+    } wait;
+
+} ov_dtls_handshake_pool_stats;
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      POOL FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_dtls_handshake_pool *
+ov_dtls_handshake_pool_create(ov_dtls_handshake_pool_config config);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Stop all workers and free the pool.
+
+    All handshakes of the pool MUST be freed before.
+*/
+ov_dtls_handshake_pool *
+ov_dtls_handshake_pool_free(ov_dtls_handshake_pool *self);
+
+/*----------------------------------------------------------------------------*/
+
+ov_dtls_handshake_pool_stats
+ov_dtls_handshake_pool_get_stats(ov_dtls_handshake_pool *self);
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *
+ov_dtls_handshake_pool_stats_to_json(ov_dtls_handshake_pool_stats stats);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      HANDSHAKE FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+/**
+    Create a passive (server side) handshake.
+*/
+ov_dtls_handshake *ov_dtls_handshake_passive(ov_dtls_handshake_pool *pool,
+                                             ov_dtls_handshake_config config);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Free some handshake. No callback will be called afterwards.
+
+    If the handshake is processed by some worker, the handshake will be
+    freed by the pool.
+*/
+ov_dtls_handshake *ov_dtls_handshake_free(ov_dtls_handshake *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Pass some DTLS datagram received to the handshake.
+
+    Datagrams received after the handshake (e.g. retransmissions of the
+    remote) are processed by the workers as well.
+*/
+bool ov_dtls_handshake_input(ov_dtls_handshake *self, const uint8_t *buffer,
+                             size_t size);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Export the SRTP keying material of some SSL after the handshake.
+
+    @returns true if keys is filled
+*/
+bool ov_dtls_srtp_keys_export(SSL *ssl, ov_dtls_srtp_keys *keys);
+
+#endif /* ov_dtls_handshake_pool_h */
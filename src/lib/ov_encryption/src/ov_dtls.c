@@ -46,6 +46,8 @@
 #include <ov_base/ov_socket.h>
 #include <ov_base/ov_utils.h>
 
+#include <pthread.h>
+
 #include <openssl/conf.h>
 #include <openssl/err.h>
 #include <openssl/rand.h>
@@ -55,6 +57,9 @@
 
 static ov_list *dtls_keys = NULL;
 
+/* cookies may be generated and verified within DTLS handshake workers */
+static pthread_rwlock_t dtls_keys_lock = PTHREAD_RWLOCK_INITIALIZER;
+
 /*----------------------------------------------------------------------------*/
 
 struct ov_dtls {
@@ -78,20 +83,34 @@ struct ov_dtls {
 
 /*----------------------------------------------------------------------------*/
 
+static void swap_dtls_cookie_keys(ov_list *keys) {
+
+    pthread_rwlock_wrlock(&dtls_keys_lock);
+
+    ov_list *old = dtls_keys;
+    dtls_keys = keys;
+
+    pthread_rwlock_unlock(&dtls_keys_lock);
+
+    ov_list_free(old);
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool init_dtls_cookie_keys(size_t quantity, size_t length) {
 
+    ov_list *keys = NULL;
+
     if ((0 == quantity) || (0 == length))
         return false;
 
-    if (dtls_keys) {
-        ov_list_clear(dtls_keys);
-    } else {
+    /* The new keys are created aside and swapped in at once,
+     * so cookie checks never see some partial key set. */
 
-        dtls_keys = ov_list_create(
-            (ov_list_config){.item = ov_buffer_data_functions()});
-    }
+    keys =
+        ov_list_create((ov_list_config){.item = ov_buffer_data_functions()});
 
-    if (!dtls_keys)
+    if (!keys)
         goto error;
 
     ov_buffer *buffer = NULL;
@@ -102,7 +121,7 @@ static bool init_dtls_cookie_keys(size_t quantity, size_t length) {
         if (!buffer)
             goto error;
 
-        if (!ov_list_push(dtls_keys, buffer)) {
+        if (!ov_list_push(keys, buffer)) {
             buffer = ov_buffer_free(buffer);
             goto error;
         }
@@ -113,9 +132,10 @@ static bool init_dtls_cookie_keys(size_t quantity, size_t length) {
         buffer->length = buffer->capacity;
     }
 
+    swap_dtls_cookie_keys(keys);
     return true;
 error:
-    dtls_keys = ov_list_free(dtls_keys);
+    ov_list_free(keys);
     return false;
 }
 
@@ -130,8 +150,6 @@ static bool renew_dtls_keys(uint32_t id, void *data) {
     if (!ssl)
         goto error;
 
-    dtls_keys = ov_list_free(dtls_keys);
-
     if (!init_dtls_cookie_keys(ssl->config.dtls.keys.quantity,
                                ssl->config.dtls.keys.length)) {
 
@@ -239,7 +257,11 @@ static int generate_dtls_cookie(SSL *ssl, unsigned char *cookie,
      *
      */
 
-    if (!dtls_keys) {
+    pthread_rwlock_rdlock(&dtls_keys_lock);
+    bool initialized = (NULL != dtls_keys);
+    pthread_rwlock_unlock(&dtls_keys_lock);
+
+    if (!initialized) {
 
         if (!init_dtls_cookie_keys(OV_DTLS_KEYS_QUANTITY_DEFAULT,
                                    OV_DTLS_KEYS_LENGTH_DEFAULT))
@@ -248,16 +270,21 @@ static int generate_dtls_cookie(SSL *ssl, unsigned char *cookie,
 
     srand(time(NULL));
     long int number = rand();
+
+    pthread_rwlock_rdlock(&dtls_keys_lock);
+
     number = (number * (ov_list_count(dtls_keys))) / RAND_MAX;
 
     if (number == 0)
         number = 1;
 
     ov_buffer *buffer = ov_list_get(dtls_keys, number);
-    if (!buffer)
-        goto error;
 
-    if (!write_cookie(cookie, cookie_len, buffer))
+    bool written = buffer && write_cookie(cookie, cookie_len, buffer);
+
+    pthread_rwlock_unlock(&dtls_keys_lock);
+
+    if (!written)
         goto error;
 
     return 1;
@@ -270,16 +297,17 @@ error:
 static int verify_dtls_cookie(SSL *ssl, const unsigned char *cookie,
                               unsigned int cookie_len) {
 
-    if (!ssl || !cookie || !dtls_keys)
+    if (!ssl || !cookie)
         goto error;
 
     if (cookie_len < 1)
         goto error;
 
-    if (!dtls_keys)
-        goto error;
+    pthread_rwlock_rdlock(&dtls_keys_lock);
+    bool valid = check_cookie(cookie, cookie_len, dtls_keys);
+    pthread_rwlock_unlock(&dtls_keys_lock);
 
-    if (!check_cookie(cookie, cookie_len, dtls_keys))
+    if (!valid)
         goto error;
 
     return 1;
@@ -740,7 +768,7 @@ ov_dtls *ov_dtls_free(ov_dtls *self) {
     RAND_cleanup();
 
     // free global DTLS keys
-    dtls_keys = ov_list_free(dtls_keys);
+    swap_dtls_cookie_keys(NULL);
 
     self = ov_data_pointer_free(self);
 
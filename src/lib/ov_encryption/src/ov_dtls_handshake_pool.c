@@ -0,0 +1,1182 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_dtls_handshake_pool.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_dtls_handshake_pool.h"
+
+#include <pthread.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <ov_base/ov_time.h>
+#include <ov_base/ov_utils.h>
+
+#include <openssl/err.h>
+
+#define OV_DTLS_HANDSHAKE_POOL_MAGIC_BYTES 0xd75a
+
+static const char *label_extractor_srtp = "EXTRACTOR-dtls_srtp";
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Datagram Datagram;
+
+struct Datagram {
+
+    Datagram *next;
+    size_t size;
+    uint8_t buffer[];
+};
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    Datagram *head;
+    Datagram *tail;
+
+} Datagrams;
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum State {
+
+    STATE_LISTEN = 0, // cookie exchange
+    STATE_ACCEPT = 1, // handshake
+    STATE_DONE = 2    // keys exported
+
+} State;
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_dtls_handshake {
+
+    ov_dtls_handshake_pool *pool;
+    ov_dtls_handshake_config config;
+
+    /* next in the run or done queue of the pool */
+    ov_dtls_handshake *next_run;
+    ov_dtls_handshake *next_done;
+    uint64_t queued_usec;
+
+    pthread_mutex_t lock;
+
+    struct {
+
+        bool run;        // queued or processed by some worker
+        bool done;       // queued for delivery
+        bool delivering; // callbacks running within the loop
+        bool freed;      // freed by the user
+
+    } flags;
+
+    Datagrams inbox;
+    Datagrams outbox;
+
+    bool keys_ready;
+    ov_dtls_srtp_keys keys;
+
+    /* owned by the worker processing the handshake */
+    struct {
+
+        State state;
+        uint64_t start_usec;
+
+        SSL *ssl;
+        BIO *read;
+
+        Datagrams out;
+        ov_dtls_srtp_keys keys;
+
+    } work;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_dtls_handshake_pool {
+
+    uint16_t magic_bytes;
+    ov_dtls_handshake_pool_config config;
+
+    BIO_METHOD *bio_method;
+
+    pthread_t *threads;
+    size_t started;
+
+    /* socketpair, supported by all eventloop implementations */
+    int wakeup[2];
+
+    /* run and done queue, stats */
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool running;
+
+    struct {
+
+        ov_dtls_handshake *head;
+        ov_dtls_handshake *tail;
+        size_t count;
+
+    } run;
+
+    struct {
+
+        ov_dtls_handshake *head;
+        ov_dtls_handshake *tail;
+
+    } done;
+
+    struct {
+
+        size_t queue_max;
+        uint64_t completed;
+
+        uint64_t latency_last;
+        uint64_t latency_max;
+        uint64_t latency_sum;
+
+        uint64_t waited;
+        uint64_t wait_max;
+        uint64_t wait_sum;
+
+    } stats;
+};
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #datagram FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static bool datagram_push(Datagrams *list, const uint8_t *buffer,
+                          size_t size) {
+
+    Datagram *dgram = calloc(1, sizeof(Datagram) + size);
+    if (!dgram)
+        return false;
+
+    dgram->size = size;
+    memcpy(dgram->buffer, buffer, size);
+
+    if (list->tail) {
+        list->tail->next = dgram;
+    } else {
+        list->head = dgram;
+    }
+
+    list->tail = dgram;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void datagrams_append(Datagrams *list, Datagrams *other) {
+
+    if (!other->head)
+        return;
+
+    if (list->tail) {
+        list->tail->next = other->head;
+    } else {
+        list->head = other->head;
+    }
+
+    list->tail = other->tail;
+    *other = (Datagrams){0};
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void datagrams_clear(Datagrams *list) {
+
+    Datagram *dgram = list->head;
+
+    while (dgram) {
+        Datagram *next = dgram->next;
+        free(dgram);
+        dgram = next;
+    }
+
+    *list = (Datagrams){0};
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #bio FUNCTIONS
+ *
+ *      Datagrams written by SSL are collected within the handshake.
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static long bio_ctrl(BIO *bio, int cmd, long num, void *ptr) {
+
+    UNUSED(bio);
+    UNUSED(num);
+    UNUSED(ptr);
+
+    switch (cmd) {
+    case BIO_CTRL_FLUSH:
+        return 1;
+    case BIO_CTRL_WPENDING:
+    case BIO_CTRL_PENDING:
+        return 0L;
+    default:
+        break;
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int bio_write(BIO *bio, const char *in, int size) {
+
+    if (size <= 0)
+        return -1;
+
+    ov_dtls_handshake *self = BIO_get_data(bio);
+    if (!self)
+        return -1;
+
+    if (!datagram_push(&self->work.out, (const uint8_t *)in, size))
+        return -1;
+
+    return size;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int bio_create(BIO *bio) {
+
+    BIO_set_init(bio, 1);
+    BIO_set_data(bio, NULL);
+    BIO_set_shutdown(bio, 0);
+    return 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int bio_free(BIO *bio) {
+
+    if (bio == NULL)
+        return 0;
+
+    BIO_set_data(bio, NULL);
+    return 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static BIO_METHOD *bio_method_create() {
+
+    BIO_METHOD *method = BIO_meth_new(BIO_TYPE_BIO, "DTLS handshake writer");
+    if (!method)
+        return NULL;
+
+    BIO_meth_set_write(method, bio_write);
+    BIO_meth_set_ctrl(method, bio_ctrl);
+    BIO_meth_set_create(method, bio_create);
+    BIO_meth_set_destroy(method, bio_free);
+
+    return method;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #handshake FUNCTIONS (worker)
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void handshake_destroy(ov_dtls_handshake *self) {
+
+    if (!self)
+        return;
+
+    if (self->work.ssl) {
+
+        /* frees the BIOs as well */
+        SSL_free(self->work.ssl);
+        self->work.ssl = NULL;
+        self->work.read = NULL;
+    }
+
+    datagrams_clear(&self->inbox);
+    datagrams_clear(&self->outbox);
+    datagrams_clear(&self->work.out);
+
+    pthread_mutex_destroy(&self->lock);
+
+    OPENSSL_cleanse(&self->keys, sizeof(ov_dtls_srtp_keys));
+    OPENSSL_cleanse(&self->work.keys, sizeof(ov_dtls_srtp_keys));
+
+    free(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void ssl_clear(ov_dtls_handshake *self) {
+
+    if (self->work.ssl)
+        SSL_free(self->work.ssl);
+
+    self->work.ssl = NULL;
+    self->work.read = NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool ssl_create(ov_dtls_handshake *self) {
+
+    BIO *write = NULL;
+
+    ssl_clear(self);
+
+    self->work.ssl = SSL_new(self->config.ctx);
+    if (!self->work.ssl)
+        goto error;
+
+    SSL_set_accept_state(self->work.ssl);
+
+    if (0 != SSL_set_tlsext_use_srtp(self->work.ssl,
+                                     self->config.srtp_profile))
+        goto error;
+
+    self->work.read = BIO_new(BIO_s_mem());
+    if (!self->work.read)
+        goto error;
+
+    write = BIO_new(self->pool->bio_method);
+    if (!write) {
+        BIO_free(self->work.read);
+        self->work.read = NULL;
+        goto error;
+    }
+
+    BIO_set_data(write, self);
+    BIO_set_mem_eof_return(self->work.read, -1);
+
+    SSL_set_bio(self->work.ssl, self->work.read, write);
+    SSL_set_options(self->work.ssl, SSL_OP_COOKIE_EXCHANGE);
+
+    return true;
+error:
+    ssl_clear(self);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool ssl_error_is_fatal(SSL *ssl, int r) {
+
+    char errorstring[OV_DTLS_SSL_ERROR_STRING_SIZE] = {0};
+
+    switch (SSL_get_error(ssl, r)) {
+
+    case SSL_ERROR_NONE:
+    case SSL_ERROR_WANT_READ:
+    case SSL_ERROR_WANT_CONNECT:
+    case SSL_ERROR_WANT_ACCEPT:
+    case SSL_ERROR_WANT_X509_LOOKUP:
+    case SSL_ERROR_WANT_WRITE:
+        return false;
+
+    case SSL_ERROR_SSL:
+
+        ERR_error_string_n(ERR_get_error(), errorstring,
+                           OV_DTLS_SSL_ERROR_STRING_SIZE);
+
+        ov_log_error("DTLS handshake SSL_ERROR_SSL - %s", errorstring);
+        break;
+
+    default:
+        break;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void stats_completed(ov_dtls_handshake_pool *pool, uint64_t usec) {
+
+    pthread_mutex_lock(&pool->lock);
+
+    pool->stats.completed++;
+    pool->stats.latency_last = usec;
+    pool->stats.latency_sum += usec;
+
+    if (usec > pool->stats.latency_max)
+        pool->stats.latency_max = usec;
+
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool handshake_accept(ov_dtls_handshake *self) {
+
+    int r = SSL_do_handshake(self->work.ssl);
+
+    if (SSL_is_init_finished(self->work.ssl)) {
+
+        if (!ov_dtls_srtp_keys_export(self->work.ssl, &self->work.keys)) {
+
+            ov_log_error("DTLS handshake done, failed to export SRTP keys");
+            return false;
+        }
+
+        self->work.state = STATE_DONE;
+
+        stats_completed(self->pool, ov_time_get_current_time_usecs() -
+                                        self->work.start_usec);
+        return true;
+    }
+
+    if (r <= 0)
+        ssl_error_is_fatal(self->work.ssl, r);
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool handshake_listen(ov_dtls_handshake *self, Datagram *dgram) {
+
+    if (0 == self->work.start_usec)
+        self->work.start_usec = ov_time_get_current_time_usecs();
+
+    if (!self->work.ssl && !ssl_create(self))
+        return false;
+
+    if (BIO_write(self->work.read, dgram->buffer, dgram->size) < 0)
+        return false;
+
+    BIO_ADDR *peer = BIO_ADDR_new();
+    int r = DTLSv1_listen(self->work.ssl, peer);
+
+    if (peer)
+        BIO_ADDR_free(peer);
+
+    if (r >= 1) {
+
+        /* ClientHello with valid cookie, continue the handshake */
+        self->work.state = STATE_ACCEPT;
+        return handshake_accept(self);
+    }
+
+    if (0 == r) {
+
+        /* Non Fatal error, usercode is expected to
+         * retry operation. (man DTLSv1_listen) */
+        ssl_clear(self);
+        return false;
+    }
+
+    if (ssl_error_is_fatal(self->work.ssl, r))
+        ssl_clear(self);
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool handshake_process(ov_dtls_handshake *self, Datagram *dgram) {
+
+    char buffer[OV_DTLS_SSL_BUFFER_SIZE];
+
+    switch (self->work.state) {
+
+    case STATE_LISTEN:
+        return handshake_listen(self, dgram);
+
+    case STATE_ACCEPT:
+
+        if (BIO_write(self->work.read, dgram->buffer, dgram->size) < 0)
+            return false;
+
+        return handshake_accept(self);
+
+    case STATE_DONE:
+
+        if (BIO_write(self->work.read, dgram->buffer, dgram->size) < 0)
+            return false;
+
+        // just read empty, answers retransmissions of the remote
+        SSL_read(self->work.ssl, buffer, OV_DTLS_SSL_BUFFER_SIZE);
+        break;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void pool_post_done(ov_dtls_handshake_pool *pool,
+                           ov_dtls_handshake *handshake) {
+
+    handshake->next_done = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+
+    bool was_empty = (NULL == pool->done.head);
+
+    if (pool->done.tail) {
+        pool->done.tail->next_done = handshake;
+    } else {
+        pool->done.head = handshake;
+    }
+
+    pool->done.tail = handshake;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    if (was_empty) {
+        uint8_t value = 1;
+        ssize_t out = send(pool->wakeup[1], &value, sizeof(value), 0);
+        UNUSED(out);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void handshake_run(ov_dtls_handshake *self) {
+
+    while (true) {
+
+        pthread_mutex_lock(&self->lock);
+
+        if (self->flags.freed) {
+
+            self->flags.run = false;
+            bool destroy = !self->flags.done && !self->flags.delivering;
+            pthread_mutex_unlock(&self->lock);
+
+            if (destroy)
+                handshake_destroy(self);
+
+            return;
+        }
+
+        Datagram *dgram = self->inbox.head;
+        self->inbox = (Datagrams){0};
+
+        if (!dgram) {
+            self->flags.run = false;
+            pthread_mutex_unlock(&self->lock);
+            return;
+        }
+
+        pthread_mutex_unlock(&self->lock);
+
+        bool keys = false;
+
+        while (dgram) {
+
+            Datagram *next = dgram->next;
+
+            if (handshake_process(self, dgram))
+                keys = true;
+
+            free(dgram);
+            dgram = next;
+        }
+
+        pthread_mutex_lock(&self->lock);
+
+        datagrams_append(&self->outbox, &self->work.out);
+
+        if (keys) {
+            self->keys = self->work.keys;
+            self->keys_ready = true;
+        }
+
+        if ((self->outbox.head || self->keys_ready) && !self->flags.done) {
+
+            self->flags.done = true;
+            pool_post_done(self->pool, self);
+        }
+
+        pthread_mutex_unlock(&self->lock);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *worker_run(void *arg) {
+
+    ov_dtls_handshake_pool *pool = (ov_dtls_handshake_pool *)arg;
+
+    pthread_mutex_lock(&pool->lock);
+
+    while (pool->running) {
+
+        ov_dtls_handshake *handshake = pool->run.head;
+
+        if (!handshake) {
+            pthread_cond_wait(&pool->cond, &pool->lock);
+            continue;
+        }
+
+        pool->run.head = handshake->next_run;
+        if (!pool->run.head)
+            pool->run.tail = NULL;
+
+        handshake->next_run = NULL;
+        pool->run.count--;
+
+        uint64_t wait =
+            ov_time_get_current_time_usecs() - handshake->queued_usec;
+
+        pool->stats.waited++;
+        pool->stats.wait_sum += wait;
+        if (wait > pool->stats.wait_max)
+            pool->stats.wait_max = wait;
+
+        pthread_mutex_unlock(&pool->lock);
+
+        handshake_run(handshake);
+
+        pthread_mutex_lock(&pool->lock);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #delivery FUNCTIONS (loop)
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void handshake_deliver(ov_dtls_handshake *self) {
+
+    pthread_mutex_lock(&self->lock);
+
+    self->flags.done = false;
+    self->flags.delivering = true;
+
+    Datagrams out = self->outbox;
+    self->outbox = (Datagrams){0};
+
+    bool keys = self->keys_ready;
+    self->keys_ready = false;
+
+    pthread_mutex_unlock(&self->lock);
+
+    /* flags.freed is set within the loop only, the user MAY free the
+     * handshake within the callbacks */
+
+    for (Datagram *dgram = out.head; dgram; dgram = dgram->next) {
+
+        if (self->flags.freed || !self->config.callback.send)
+            break;
+
+        self->config.callback.send(self->config.callback.userdata,
+                                   dgram->buffer, dgram->size);
+    }
+
+    datagrams_clear(&out);
+
+    if (keys && !self->flags.freed && self->config.callback.keys)
+        self->config.callback.keys(self->config.callback.userdata,
+                                   &self->keys);
+
+    pthread_mutex_lock(&self->lock);
+
+    self->flags.delivering = false;
+
+    bool destroy = self->flags.freed && !self->flags.run && !self->flags.done;
+
+    pthread_mutex_unlock(&self->lock);
+
+    if (destroy)
+        handshake_destroy(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool io_wakeup(int socket, uint8_t events, void *userdata) {
+
+    ov_dtls_handshake_pool *pool = (ov_dtls_handshake_pool *)userdata;
+    if (!pool || !(events & OV_EVENT_IO_IN))
+        return true;
+
+    uint8_t value[64];
+
+    while (0 < recv(socket, value, sizeof(value), 0))
+        ;
+
+    pthread_mutex_lock(&pool->lock);
+
+    ov_dtls_handshake *handshake = pool->done.head;
+    pool->done.head = NULL;
+    pool->done.tail = NULL;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    while (handshake) {
+
+        ov_dtls_handshake *next = handshake->next_done;
+        handshake->next_done = NULL;
+
+        handshake_deliver(handshake);
+        handshake = next;
+    }
+
+    return true;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #POOL FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_dtls_handshake_pool *
+ov_dtls_handshake_pool_create(ov_dtls_handshake_pool_config config) {
+
+    ov_dtls_handshake_pool *self = NULL;
+
+    if (!ov_ptr_valid(config.loop, "Cannot create DTLS handshake pool - "
+                                   "no loop"))
+        goto error;
+
+    if (0 == config.threads)
+        config.threads = OV_DTLS_HANDSHAKE_POOL_THREADS_DEFAULT;
+
+    if (config.threads > OV_DTLS_HANDSHAKE_POOL_THREADS_MAX)
+        config.threads = OV_DTLS_HANDSHAKE_POOL_THREADS_MAX;
+
+    self = calloc(1, sizeof(ov_dtls_handshake_pool));
+    if (!self)
+        goto error;
+
+    self->magic_bytes = OV_DTLS_HANDSHAKE_POOL_MAGIC_BYTES;
+    self->config = config;
+    self->wakeup[0] = -1;
+    self->wakeup[1] = -1;
+    self->running = true;
+
+    pthread_mutex_init(&self->lock, NULL);
+    pthread_cond_init(&self->cond, NULL);
+
+    self->bio_method = bio_method_create();
+    if (!self->bio_method)
+        goto error;
+
+    if (0 != socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0,
+                        self->wakeup))
+        goto error;
+
+    if (!ov_event_loop_set(config.loop, self->wakeup[0],
+                           OV_EVENT_IO_IN | OV_EVENT_IO_ERR, self, io_wakeup))
+        goto error;
+
+    self->threads = calloc(config.threads, sizeof(pthread_t));
+    if (!self->threads)
+        goto error;
+
+    for (size_t i = 0; i < config.threads; i++) {
+
+        if (0 != pthread_create(&self->threads[i], NULL, worker_run, self))
+            goto error;
+
+        self->started++;
+    }
+
+    return self;
+error:
+    ov_dtls_handshake_pool_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_dtls_handshake_pool *
+ov_dtls_handshake_pool_free(ov_dtls_handshake_pool *self) {
+
+    if (!self)
+        return NULL;
+
+    pthread_mutex_lock(&self->lock);
+    self->running = false;
+    pthread_cond_broadcast(&self->cond);
+    pthread_mutex_unlock(&self->lock);
+
+    for (size_t i = 0; i < self->started; i++) {
+        pthread_join(self->threads[i], NULL);
+    }
+
+    self->threads = ov_data_pointer_free(self->threads);
+
+    /* handshakes freed by the user, but still queued */
+
+    ov_dtls_handshake *handshake = self->run.head;
+
+    while (handshake) {
+
+        ov_dtls_handshake *next = handshake->next_run;
+        handshake->flags.run = false;
+
+        if (handshake->flags.freed && !handshake->flags.done)
+            handshake_destroy(handshake);
+
+        handshake = next;
+    }
+
+    handshake = self->done.head;
+
+    while (handshake) {
+
+        ov_dtls_handshake *next = handshake->next_done;
+        handshake->flags.done = false;
+
+        if (handshake->flags.freed)
+            handshake_destroy(handshake);
+
+        handshake = next;
+    }
+
+    if (-1 != self->wakeup[0]) {
+
+        ov_event_loop_unset(self->config.loop, self->wakeup[0], NULL);
+        close(self->wakeup[0]);
+        self->wakeup[0] = -1;
+    }
+
+    if (-1 != self->wakeup[1]) {
+        close(self->wakeup[1]);
+        self->wakeup[1] = -1;
+    }
+
+    if (self->bio_method) {
+        BIO_meth_free(self->bio_method);
+        self->bio_method = NULL;
+    }
+
+    pthread_cond_destroy(&self->cond);
+    pthread_mutex_destroy(&self->lock);
+
+    self = ov_data_pointer_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_dtls_handshake_pool_stats
+ov_dtls_handshake_pool_get_stats(ov_dtls_handshake_pool *self) {
+
+    ov_dtls_handshake_pool_stats stats = {0};
+
+    if (!self)
+        return stats;
+
+    pthread_mutex_lock(&self->lock);
+
+    stats.threads = self->started;
+    stats.queue.current = self->run.count;
+    stats.queue.max = self->stats.queue_max;
+    stats.completed = self->stats.completed;
+
+    stats.latency.last_usec = self->stats.latency_last;
+    stats.latency.max_usec = self->stats.latency_max;
+
+    if (self->stats.completed > 0)
+        stats.latency.avg_usec =
+            self->stats.latency_sum / self->stats.completed;
+
+    stats.wait.max_usec = self->stats.wait_max;
+
+    if (self->stats.waited > 0)
+        stats.wait.avg_usec = self->stats.wait_sum / self->stats.waited;
+
+    pthread_mutex_unlock(&self->lock);
+
+    return stats;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool json_set_number(ov_json_value *obj, const char *key,
+                            double number) {
+
+    ov_json_value *val = ov_json_number(number);
+
+    if (!ov_json_object_set(obj, key, val)) {
+        ov_json_value_free(val);
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *
+ov_dtls_handshake_pool_stats_to_json(ov_dtls_handshake_pool_stats stats) {
+
+    ov_json_value *out = ov_json_object();
+    ov_json_value *queue = ov_json_object();
+    ov_json_value *latency = ov_json_object();
+    ov_json_value *wait = ov_json_object();
+
+    if (!out || !queue || !latency || !wait)
+        goto error;
+
+    if (!json_set_number(out, "threads", stats.threads) ||
+        !json_set_number(out, "completed", stats.completed) ||
+        !json_set_number(queue, "current", stats.queue.current) ||
+        !json_set_number(queue, "max", stats.queue.max) ||
+        !json_set_number(latency, "last_usec", stats.latency.last_usec) ||
+        !json_set_number(latency, "max_usec", stats.latency.max_usec) ||
+        !json_set_number(latency, "avg_usec", stats.latency.avg_usec) ||
+        !json_set_number(wait, "max_usec", stats.wait.max_usec) ||
+        !json_set_number(wait, "avg_usec", stats.wait.avg_usec))
+        goto error;
+
+    if (!ov_json_object_set(out, "queue", queue))
+        goto error;
+
+    queue = NULL;
+
+    if (!ov_json_object_set(out, "latency", latency))
+        goto error;
+
+    latency = NULL;
+
+    if (!ov_json_object_set(out, "wait", wait))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(out);
+    ov_json_value_free(queue);
+    ov_json_value_free(latency);
+    ov_json_value_free(wait);
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #HANDSHAKE FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_dtls_handshake *ov_dtls_handshake_passive(ov_dtls_handshake_pool *pool,
+                                             ov_dtls_handshake_config config) {
+
+    ov_dtls_handshake *self = NULL;
+
+    if (!pool || !config.ctx)
+        goto error;
+
+    if (0 == config.srtp_profile[0])
+        snprintf(config.srtp_profile, OV_DTLS_PROFILE_MAX,
+                 OV_DTLS_SRTP_PROFILES);
+
+    self = calloc(1, sizeof(ov_dtls_handshake));
+    if (!self)
+        goto error;
+
+    self->pool = pool;
+    self->config = config;
+    self->work.state = STATE_LISTEN;
+
+    pthread_mutex_init(&self->lock, NULL);
+
+    return self;
+error:
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_dtls_handshake *ov_dtls_handshake_free(ov_dtls_handshake *self) {
+
+    if (!self)
+        return NULL;
+
+    pthread_mutex_lock(&self->lock);
+
+    self->flags.freed = true;
+
+    bool destroy =
+        !self->flags.run && !self->flags.done && !self->flags.delivering;
+
+    pthread_mutex_unlock(&self->lock);
+
+    if (destroy)
+        handshake_destroy(self);
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_dtls_handshake_input(ov_dtls_handshake *self, const uint8_t *buffer,
+                             size_t size) {
+
+    if (!self || !buffer || !size)
+        return false;
+
+    ov_dtls_handshake_pool *pool = self->pool;
+
+    pthread_mutex_lock(&self->lock);
+
+    if (self->flags.freed || !datagram_push(&self->inbox, buffer, size)) {
+        pthread_mutex_unlock(&self->lock);
+        return false;
+    }
+
+    if (!self->flags.run) {
+
+        self->flags.run = true;
+        self->next_run = NULL;
+
+        pthread_mutex_lock(&pool->lock);
+
+        self->queued_usec = ov_time_get_current_time_usecs();
+
+        if (pool->run.tail) {
+            pool->run.tail->next_run = self;
+        } else {
+            pool->run.head = self;
+        }
+
+        pool->run.tail = self;
+        pool->run.count++;
+
+        if (pool->run.count > pool->stats.queue_max)
+            pool->stats.queue_max = pool->run.count;
+
+        pthread_cond_signal(&pool->cond);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    pthread_mutex_unlock(&self->lock);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool srtp_key_length_of_profile(const SRTP_PROTECTION_PROFILE *profile,
+                                       uint32_t *keylen, uint32_t *saltlen) {
+
+    if (!profile)
+        return false;
+
+    switch (profile->id) {
+
+    case SRTP_AES128_CM_SHA1_80:
+    case SRTP_AES128_CM_SHA1_32:
+        *keylen = 16;
+        *saltlen = 14;
+        break;
+
+    case SRTP_AEAD_AES_128_GCM:
+        *keylen = 16;
+        *saltlen = 12;
+        break;
+
+    case SRTP_AEAD_AES_256_GCM:
+        *keylen = 32;
+        *saltlen = 12;
+        break;
+
+    default:
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_dtls_srtp_keys_export(SSL *ssl, ov_dtls_srtp_keys *keys) {
+
+    size_t size = 2 * OV_DTLS_KEY_MAX + 2 * OV_DTLS_SALT_MAX;
+    uint8_t buffer[size];
+
+    if (!ssl || !keys)
+        goto error;
+
+    uint32_t keylen = 0;
+    uint32_t saltlen = 0;
+
+    SRTP_PROTECTION_PROFILE *profile = SSL_get_selected_srtp_profile(ssl);
+
+    if (!srtp_key_length_of_profile(profile, &keylen, &saltlen))
+        goto error;
+
+    /*      The keying material contains the client write master key,
+     *      the server write master key, the client write master salt
+     *      and the server write master salt in that order. */
+
+    size = 2 * (keylen + saltlen);
+
+    if (1 != SSL_export_keying_material(ssl, buffer, size,
+                                        label_extractor_srtp,
+                                        strlen(label_extractor_srtp), NULL,
+                                        0, 0))
+        goto error;
+
+    *keys = (ov_dtls_srtp_keys){0};
+
+    keys->key_len = keylen;
+    keys->salt_len = saltlen;
+
+    uint8_t *ptr = buffer;
+
+    memcpy(keys->client.key, ptr, keylen);
+    ptr += keylen;
+    memcpy(keys->server.key, ptr, keylen);
+    ptr += keylen;
+    memcpy(keys->client.salt, ptr, saltlen);
+    ptr += saltlen;
+    memcpy(keys->server.salt, ptr, saltlen);
+
+    snprintf(keys->profile, OV_DTLS_SRTP_PROFILE_NAME_MAX, "%s",
+             profile->name);
+
+    OPENSSL_cleanse(buffer, sizeof(buffer));
+    return true;
+error:
+    return false;
+}
@@ -0,0 +1,472 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_dtls_handshake_pool_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_dtls_handshake_pool.c"
+#include <ov_test/testrun.h>
+
+#define TEST_COOKIE "test cookie"
+#define TEST_CLIENTS 32
+#define TEST_RUNS 500
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    SSL *ssl;
+    BIO *read;
+    BIO *write;
+
+    ov_dtls_handshake *handshake;
+
+    bool keys_received;
+    ov_dtls_srtp_keys keys;
+
+    size_t received;
+
+} Client;
+
+/*----------------------------------------------------------------------------*/
+
+static int cookie_generate(SSL *ssl, unsigned char *cookie,
+                           unsigned int *cookie_len) {
+
+    UNUSED(ssl);
+
+    memcpy(cookie, TEST_COOKIE, strlen(TEST_COOKIE));
+    *cookie_len = strlen(TEST_COOKIE);
+    return 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int cookie_verify(SSL *ssl, const unsigned char *cookie,
+                         unsigned int cookie_len) {
+
+    UNUSED(ssl);
+
+    if (cookie_len != strlen(TEST_COOKIE))
+        return 0;
+
+    return 0 == memcmp(cookie, TEST_COOKIE, cookie_len);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static SSL_CTX *server_ctx_create() {
+
+    SSL_CTX *ctx = SSL_CTX_new(DTLS_server_method());
+    if (!ctx)
+        return NULL;
+
+    if ((1 != SSL_CTX_use_certificate_chain_file(ctx, OV_TEST_CERT)) ||
+        (1 != SSL_CTX_use_PrivateKey_file(ctx, OV_TEST_CERT_KEY,
+                                          SSL_FILETYPE_PEM)) ||
+        (0 != SSL_CTX_set_tlsext_use_srtp(ctx, OV_DTLS_SRTP_PROFILES))) {
+
+        SSL_CTX_free(ctx);
+        return NULL;
+    }
+
+    SSL_CTX_set_min_proto_version(ctx, DTLS1_2_VERSION);
+    SSL_CTX_set_max_proto_version(ctx, DTLS1_2_VERSION);
+    SSL_CTX_set_cookie_generate_cb(ctx, cookie_generate);
+    SSL_CTX_set_cookie_verify_cb(ctx, cookie_verify);
+
+    return ctx;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static SSL_CTX *client_ctx_create() {
+
+    SSL_CTX *ctx = SSL_CTX_new(DTLS_client_method());
+    if (!ctx)
+        return NULL;
+
+    SSL_CTX_set_min_proto_version(ctx, DTLS1_2_VERSION);
+    SSL_CTX_set_max_proto_version(ctx, DTLS1_2_VERSION);
+    SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, NULL);
+
+    if (0 != SSL_CTX_set_tlsext_use_srtp(ctx, OV_DTLS_SRTP_PROFILES)) {
+        SSL_CTX_free(ctx);
+        return NULL;
+    }
+
+    return ctx;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ssize_t client_receive(void *userdata, const uint8_t *buffer,
+                              size_t size) {
+
+    Client *client = (Client *)userdata;
+    client->received++;
+    return BIO_write(client->read, buffer, size);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void client_keys(void *userdata, const ov_dtls_srtp_keys *keys) {
+
+    Client *client = (Client *)userdata;
+    client->keys = *keys;
+    client->keys_received = true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool client_init(Client *client, SSL_CTX *client_ctx,
+                        SSL_CTX *server_ctx, ov_dtls_handshake_pool *pool) {
+
+    *client = (Client){0};
+
+    client->ssl = SSL_new(client_ctx);
+    client->read = BIO_new(BIO_s_mem());
+    client->write = BIO_new(BIO_s_mem());
+
+    if (!client->ssl || !client->read || !client->write)
+        return false;
+
+    BIO_set_mem_eof_return(client->read, -1);
+    BIO_set_mem_eof_return(client->write, -1);
+
+    SSL_set_bio(client->ssl, client->read, client->write);
+    SSL_set_connect_state(client->ssl);
+    SSL_set_options(client->ssl, SSL_OP_NO_QUERY_MTU);
+    DTLS_set_link_mtu(client->ssl, 1400);
+
+    client->handshake = ov_dtls_handshake_passive(
+        pool, (ov_dtls_handshake_config){
+                  .ctx = server_ctx,
+                  .callback.userdata = client,
+                  .callback.send = client_receive,
+                  .callback.keys = client_keys});
+
+    return NULL != client->handshake;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void client_clear(Client *client) {
+
+    client->handshake = ov_dtls_handshake_free(client->handshake);
+
+    if (client->ssl)
+        SSL_free(client->ssl);
+
+    *client = (Client){0};
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void client_pump(Client *client) {
+
+    uint8_t buffer[OV_DTLS_SSL_BUFFER_SIZE];
+
+    if (!SSL_is_init_finished(client->ssl))
+        SSL_do_handshake(client->ssl);
+
+    while (BIO_ctrl_pending(client->write) > 0) {
+
+        int bytes = BIO_read(client->write, buffer, sizeof(buffer));
+        if (bytes <= 0)
+            break;
+
+        ov_dtls_handshake_input(client->handshake, buffer, bytes);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool clients_done(Client *clients, size_t count) {
+
+    for (size_t i = 0; i < count; i++) {
+
+        if (!clients[i].keys_received)
+            return false;
+
+        if (!SSL_is_init_finished(clients[i].ssl))
+            return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool run_handshakes(ov_event_loop *loop, Client *clients,
+                           size_t count) {
+
+    for (size_t run = 0; run < TEST_RUNS; run++) {
+
+        for (size_t i = 0; i < count; i++) {
+            client_pump(&clients[i]);
+        }
+
+        if (clients_done(clients, count))
+            return true;
+
+        loop->run(loop, 10000);
+    }
+
+    return false;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CASES                                                      #CASES
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int test_ov_dtls_handshake_pool_create() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    testrun(loop);
+
+    testrun(!ov_dtls_handshake_pool_create((ov_dtls_handshake_pool_config){0}));
+
+    ov_dtls_handshake_pool *pool = ov_dtls_handshake_pool_create(
+        (ov_dtls_handshake_pool_config){.loop = loop});
+
+    testrun(pool);
+    testrun(OV_DTLS_HANDSHAKE_POOL_THREADS_DEFAULT ==
+            ov_dtls_handshake_pool_get_stats(pool).threads);
+
+    testrun(NULL == ov_dtls_handshake_pool_free(pool));
+
+    pool = ov_dtls_handshake_pool_create((ov_dtls_handshake_pool_config){
+        .loop = loop, .threads = OV_DTLS_HANDSHAKE_POOL_THREADS_MAX + 1});
+
+    testrun(pool);
+    testrun(OV_DTLS_HANDSHAKE_POOL_THREADS_MAX ==
+            ov_dtls_handshake_pool_get_stats(pool).threads);
+
+    testrun(NULL == ov_dtls_handshake_pool_free(pool));
+    testrun(NULL == ov_dtls_handshake_pool_free(NULL));
+
+    loop = ov_event_loop_free(loop);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_dtls_handshake_input() {
+
+    Client client = {0};
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    SSL_CTX *server_ctx = server_ctx_create();
+    SSL_CTX *client_ctx = client_ctx_create();
+
+    testrun(loop);
+    testrun(server_ctx);
+    testrun(client_ctx);
+
+    ov_dtls_handshake_pool *pool = ov_dtls_handshake_pool_create(
+        (ov_dtls_handshake_pool_config){.loop = loop, .threads = 1});
+
+    testrun(pool);
+
+    testrun(!ov_dtls_handshake_passive(NULL, (ov_dtls_handshake_config){0}));
+    testrun(!ov_dtls_handshake_passive(pool, (ov_dtls_handshake_config){0}));
+
+    testrun(client_init(&client, client_ctx, server_ctx, pool));
+
+    testrun(!ov_dtls_handshake_input(NULL, (uint8_t *)"x", 1));
+    testrun(!ov_dtls_handshake_input(client.handshake, NULL, 1));
+
+    testrun(run_handshakes(loop, &client, 1));
+
+    /* cookie exchange, server flight */
+    testrun(client.received >= 2);
+
+    /* both sides exported the same keys */
+
+    ov_dtls_srtp_keys keys = {0};
+    testrun(ov_dtls_srtp_keys_export(client.ssl, &keys));
+
+    testrun(0 == strcmp(keys.profile, client.keys.profile));
+    testrun(0 == strcmp("SRTP_AES128_CM_SHA1_80", keys.profile));
+    testrun(16 == client.keys.key_len);
+    testrun(14 == client.keys.salt_len);
+    testrun(0 == memcmp(&keys, &client.keys, sizeof(ov_dtls_srtp_keys)));
+
+    ov_dtls_handshake_pool_stats stats = ov_dtls_handshake_pool_get_stats(pool);
+    testrun(1 == stats.completed);
+    testrun(0 == stats.queue.current);
+    testrun(1 <= stats.queue.max);
+
+    ov_json_value *json = ov_dtls_handshake_pool_stats_to_json(stats);
+    testrun(json);
+    testrun(1 == ov_json_number_get(ov_json_get(json, "/completed")));
+    testrun(ov_json_get(json, "/latency/max_usec"));
+    json = ov_json_value_free(json);
+
+    client_clear(&client);
+
+    testrun(NULL == ov_dtls_handshake_pool_free(pool));
+
+    SSL_CTX_free(server_ctx);
+    SSL_CTX_free(client_ctx);
+
+    loop = ov_event_loop_free(loop);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_dtls_handshake_free() {
+
+    Client client = {0};
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    SSL_CTX *server_ctx = server_ctx_create();
+    SSL_CTX *client_ctx = client_ctx_create();
+
+    ov_dtls_handshake_pool *pool = ov_dtls_handshake_pool_create(
+        (ov_dtls_handshake_pool_config){.loop = loop, .threads = 1});
+
+    testrun(pool);
+    testrun(client_init(&client, client_ctx, server_ctx, pool));
+
+    /* freed while queued or processed, no callback afterwards */
+
+    client_pump(&client);
+    client.handshake = ov_dtls_handshake_free(client.handshake);
+
+    for (size_t i = 0; i < 10; i++) {
+        loop->run(loop, 10000);
+    }
+
+    testrun(0 == client.received);
+    testrun(!client.keys_received);
+
+    client_clear(&client);
+
+    testrun(NULL == ov_dtls_handshake_pool_free(pool));
+
+    SSL_CTX_free(server_ctx);
+    SSL_CTX_free(client_ctx);
+
+    loop = ov_event_loop_free(loop);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_handshake_burst() {
+
+    /* Burst of clients reconnecting at once. The loop stays responsive,
+     * as it only shuttles datagrams. */
+
+    Client clients[TEST_CLIENTS] = {0};
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    SSL_CTX *server_ctx = server_ctx_create();
+    SSL_CTX *client_ctx = client_ctx_create();
+
+    ov_dtls_handshake_pool *pool = ov_dtls_handshake_pool_create(
+        (ov_dtls_handshake_pool_config){.loop = loop, .threads = 4});
+
+    testrun(pool);
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+        testrun(client_init(&clients[i], client_ctx, server_ctx, pool));
+    }
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    testrun(run_handshakes(loop, clients, TEST_CLIENTS));
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+
+    ov_dtls_handshake_pool_stats stats = ov_dtls_handshake_pool_get_stats(pool);
+    testrun(TEST_CLIENTS == stats.completed);
+
+    fprintf(stdout,
+            "%i DTLS handshakes with %zu threads in %" PRIu64 " usec, "
+            "latency avg %" PRIu64 " max %" PRIu64 " usec, "
+            "queue max %zu, wait avg %" PRIu64 " max %" PRIu64 " usec\n",
+            TEST_CLIENTS, stats.threads, usec, stats.latency.avg_usec,
+            stats.latency.max_usec, stats.queue.max, stats.wait.avg_usec,
+            stats.wait.max_usec);
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+        client_clear(&clients[i]);
+    }
+
+    testrun(NULL == ov_dtls_handshake_pool_free(pool));
+
+    SSL_CTX_free(server_ctx);
+    SSL_CTX_free(client_ctx);
+
+    loop = ov_event_loop_free(loop);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CLUSTER                                                    #CLUSTER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int all_tests() {
+
+    testrun_init();
+    testrun_test(test_ov_dtls_handshake_pool_create);
+    testrun_test(test_ov_dtls_handshake_input);
+    testrun_test(test_ov_dtls_handshake_free);
+    testrun_test(check_handshake_burst);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
@@ -476,10 +476,9 @@ static bool rotate_page(ov_format *fout, Page *page, bool continuation,
 
 /*----------------------------------------------------------------------------*/
 
-static bool add_segment(ov_format *fout, Page *page, ov_buffer *segment,
-                        bool continuation, OggParameters *params) {
-
-    size_t seglen = ov_buffer_len(segment);
+static bool add_segment(ov_format *fout, Page *page, uint8_t const *segment,
+                        size_t seglen, bool continuation,
+                        OggParameters *params) {
 
     if ((ov_ptr_valid(params, "Cannot serialize to OGG: No OGG parameters")) &&
         (ov_cond_valid(UINT8_MAX >= seglen,
@@ -492,8 +491,11 @@ static bool add_segment(ov_format *fout, Page *page, ov_buffer *segment,
 
         page->header.segment_table[page->header.num_segments++] = seglen;
 
-        memcpy(page->bitstream.data + page->bitstream.len_octets,
-               segment->start, seglen);
+        if (0 < seglen) {
+            memcpy(page->bitstream.data + page->bitstream.len_octets, segment,
+                   seglen);
+        }
+
         page->bitstream.len_octets += seglen;
 
         return true;
@@ -509,33 +511,32 @@ static bool add_segment(ov_format *fout, Page *page, ov_buffer *segment,
 static ssize_t serialize_to_pages(ov_format *fout, ov_chunker *chunker,
                                   OggParameters *params, Page *page) {
 
-    ov_buffer *segment = ov_chunker_next_chunk(chunker, 255);
-
+    // Segments are copied straight from the chunker into the page
     ssize_t serialized_octets = 0;
 
     bool continuation = false;
 
-    while (0 != segment) {
+    while (255 <= ov_chunker_available_octets(chunker)) {
 
-        add_segment(fout, page, segment, continuation, params);
+        add_segment(fout, page, ov_chunker_next_chunk_preview(chunker, 255),
+                    255, continuation, params);
+        ov_chunker_skip(chunker, 255);
 
         serialized_octets += 255;
 
-        segment = ov_buffer_free(segment);
-        segment = ov_chunker_next_chunk(chunker, 255);
-
         continuation = true;
     };
 
     // until here, we only wrote segments of exactly 255 octets, thus
     // we need either to write a last segment with less than 255 octets
     // or an empty segment
-    segment = ov_chunker_remainder(chunker);
-    add_segment(fout, page, segment, continuation, params);
+    size_t remainder = ov_chunker_available_octets(chunker);
 
-    serialized_octets += ov_buffer_len(segment);
+    add_segment(fout, page, ov_chunker_next_chunk_preview(chunker, remainder),
+                remainder, continuation, params);
+    ov_chunker_skip(chunker, remainder);
 
-    segment = ov_buffer_free(segment);
+    serialized_octets += remainder;
 
     page_increase_sample_count(page, params->samples_per_chunk);
 
@@ -31,6 +31,7 @@
 
 #include <ov_base/ov_dump.h>
 #include <ov_base/ov_linked_list.h>
+#include <ov_base/ov_rtp_view.h>
 
 #include <ov_stun/ov_stun_attributes_rfc5245.h> // RFC ICE
 #include <ov_stun/ov_stun_attributes_rfc5389.h> // RFC STUN
@@ -140,8 +141,12 @@ static bool io_external_rtp(ov_ice_base *base, uint8_t *buffer, size_t size,
     /* We change the SSRC to the proxy SSRC and forward the RTP Frame
      * internal */
 
-    uint32_t u32 = htonl(stream->local.ssrc);
-    memcpy(buffer + 8, &u32, 4);
+    ov_rtp_view rtp = {0};
+
+    if (!ov_rtp_view_parse(&rtp, buffer, l))
+        goto ignore;
+
+    ov_rtp_view_set_ssrc(&rtp, stream->local.ssrc);
 
     /* Forward to callback */
 
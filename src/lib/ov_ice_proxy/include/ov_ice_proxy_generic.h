@@ -134,6 +134,11 @@ typedef struct ov_ice_proxy_generic_config {
             void (*io)(void *userdata, const char *session_id, int stream_id,
                        uint8_t *buffer, size_t size);
 
+            /* optional, used instead of io for sessions with some handle
+             * set by ov_ice_proxy_generic_session_set_handle */
+            void (*io_handle)(void *userdata, uint32_t handle, int stream_id,
+                              uint8_t *buffer, size_t size);
+
         } stream;
 
         struct {
@@ -169,6 +174,10 @@ struct ov_ice_proxy_generic {
         bool (*update)(ov_ice_proxy_generic *self, const char *session_id,
                        const ov_sdp_session *sdp);
 
+        /* optional, NULL if handles are not supported */
+        bool (*set_handle)(ov_ice_proxy_generic *self, const char *session_id,
+                           uint32_t handle);
+
     } session;
 
     struct {
@@ -227,6 +236,23 @@ bool ov_ice_proxy_generic_update_session(ov_ice_proxy_generic *self,
 
 /*----------------------------------------------------------------------------*/
 
+/**
+    Set some handle for a session. Stream io of the session will be
+    forwarded using callbacks.stream.io_handle with this handle, so the
+    user does not need to lookup the session by its id for each packet.
+
+    @param self         instance
+    @param session_id   session to set the handle for
+    @param handle       handle to set, 0 to use callbacks.stream.io again
+
+    @returns false if the proxy does not support handles
+*/
+bool ov_ice_proxy_generic_session_set_handle(ov_ice_proxy_generic *self,
+                                             const char *session_id,
+                                             uint32_t handle);
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_ice_proxy_generic_stream_candidate_in(
     ov_ice_proxy_generic *self, const char *session_id, uint32_t stream_id,
     const ov_ice_candidate *candidate);
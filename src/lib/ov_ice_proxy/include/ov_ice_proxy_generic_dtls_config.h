@@ -42,6 +42,7 @@
 #define OV_ICE_PROXY_SSL_KEY_DTLS_KEY_QUANTITY "quantity"
 #define OV_ICE_PROXY_SSL_KEY_DTLS_KEY_LENGTH "length"
 #define OV_ICE_PROXY_SSL_KEY_DTLS_KEY_LIFETIME_USEC "lifetime usec"
+#define OV_ICE_PROXY_SSL_KEY_DTLS_HANDSHAKE_THREADS "handshake threads"
 
 /*----------------------------------------------------------------------------*/
 
@@ -113,6 +114,12 @@ typedef struct ov_ice_proxy_generic_dtls_config {
 
         } keys;
 
+        struct {
+
+            size_t threads; // handshake workers, 0 for default
+
+        } handshake;
+
     } dtls;
 
     uint64_t reconnect_interval_usec; // handshaking interval
@@ -44,6 +44,11 @@ typedef struct ov_ice_proxy_generic_dtls_cookie_store
  *      ------------------------------------------------------------------------
  */
 
+/**
+ *  The store is shared within the process, as the SSL cookie callbacks have
+ *  no userdata. Each create returns the same store and MUST be paired with
+ *  some free, the last free deletes the store.
+ */
 ov_ice_proxy_generic_dtls_cookie_store *
 ov_ice_proxy_generic_dtls_cookie_store_create();
 
@@ -35,6 +35,8 @@
 
 #include "ov_ice_proxy_generic.h"
 
+#include <ov_encryption/ov_dtls_handshake_pool.h>
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -46,4 +48,80 @@
 ov_ice_proxy_generic *
 ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config);
 
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns queue depth and latency of the DTLS handshake pool,
+    all 0 if self is not some multiplexing proxy
+*/
+ov_dtls_handshake_pool_stats
+ov_ice_proxy_multiplexing_handshake_stats(const ov_ice_proxy_generic *self);
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      SHARDING
+ *
+ *      ------------------------------------------------------------------------
+ *
+ *      Several multiplexing proxies (shards) MAY share the same external
+ *      address using SO_REUSEPORT, each running within its own thread and
+ *      eventloop. The kernel distributes incoming packets by remote address,
+ *      so some shard may receive packets of sessions owned by another one.
+ *
+ *      To allow routing of such packets, the id of the shard is encoded in
+ *      the first character of all local ICE ufrags and in the first byte of
+ *      all STUN transaction ids created by the shard.
+ */
+
+#define OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX 16
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_ice_proxy_multiplexing_shard {
+
+    uint8_t id; // 0 .. OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX - 1
+
+    void *userdata;
+
+    /*  Called for each packet received at the external socket before it is
+     *  processed. Return true if the packet was taken over by some other
+     *  shard, false to process it within this shard. */
+    bool (*foreign)(void *userdata, uint8_t *buffer, size_t size,
+                    const ov_socket_data *remote);
+
+} ov_ice_proxy_multiplexing_shard;
+
+/*----------------------------------------------------------------------------*/
+
+ov_ice_proxy_generic *
+ov_ice_proxy_multiplexing_create_shard(ov_ice_proxy_generic_config config,
+                                       ov_ice_proxy_multiplexing_shard shard);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Process some external packet received by another shard.
+
+    MUST be called within the thread of the shard.
+*/
+bool ov_ice_proxy_multiplexing_input(ov_ice_proxy_generic *self,
+                                     uint8_t *buffer, size_t size,
+                                     const ov_socket_data *remote);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns shard id encoded in some local ufrag or -1
+*/
+int ov_ice_proxy_multiplexing_shard_of_ufrag(const char *ufrag);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    @returns shard id encoded in some STUN transaction id or -1
+*/
+int ov_ice_proxy_multiplexing_shard_of_transaction(
+    const uint8_t *transaction_id);
+
 #endif /* ov_ice_proxy_multiplexing_h */
@@ -0,0 +1,110 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_ice_proxy_sharded.h
+
+        @date           2026-10-18
+
+        Multiplexing ICE proxy sharded over several worker threads.
+
+        Each worker thread runs its own eventloop with its own multiplexing
+        proxy (shard), all bound to config.external using SO_REUSEPORT.
+        STUN, DTLS and SRTP of a session are processed within the thread of
+        the shard owning the session.
+
+        The proxy is used like any other ov_ice_proxy_generic from the
+        thread of config.loop (control thread):
+
+        - session and candidate functions are executed within the shard
+          of the session, while the shard is paused
+        - ov_ice_proxy_generic_stream_send is queued to the shard
+        - session and candidate callbacks are called within config.loop
+        - stream io callbacks are called within the worker threads, so
+          callbacks.stream.io(_handle) MUST be threadsafe
+
+        Sessions are assigned to the shard with the least sessions on
+        creation. Packets received by some other shard are passed to the
+        owner based on the ufrag (STUN requests), the transaction id (STUN
+        responses) or the remote address learned from STUN (DTLS/SRTP).
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_ice_proxy_sharded_h
+#define ov_ice_proxy_sharded_h
+
+#include "ov_ice_proxy_multiplexing.h"
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_ice_proxy_sharded_config {
+
+    ov_ice_proxy_generic_config proxy;
+
+    size_t threads; // 1 .. OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX
+
+    struct {
+
+        /* config of the eventloops of the threads,
+         * default ov_socket_get_max_supported_runtime_sockets */
+        ov_event_loop_config config;
+
+        /* optional eventloop implementation, default ov_event_loop_default */
+        ov_event_loop *(*create)(ov_event_loop_config config);
+
+    } loop;
+
+} ov_ice_proxy_sharded_config;
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_ice_proxy_generic *
+ov_ice_proxy_sharded_create(ov_ice_proxy_sharded_config config);
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_ice_proxy_sharded_stats {
+
+    size_t threads;
+
+    struct {
+
+        size_t sessions;   // sessions owned by the shard
+        uint64_t received; // packets passed to the shard by other shards
+
+        ov_dtls_handshake_pool_stats handshake;
+
+    } shard[OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX];
+
+} ov_ice_proxy_sharded_stats;
+
+/**
+    @returns per shard counters, MUST be called from the control thread
+*/
+ov_ice_proxy_sharded_stats
+ov_ice_proxy_sharded_get_stats(const ov_ice_proxy_generic *self);
+
+#endif /* ov_ice_proxy_sharded_h */
@@ -49,12 +49,26 @@ typedef struct ov_ice_proxy_vocs_config {
 
     bool multiplexing;
 
+    /* multiplexing proxy over several threads, if threads > 1 */
+    struct {
+
+        size_t threads;
+
+        ov_event_loop_config loop;
+        ov_event_loop *(*loop_create)(ov_event_loop_config config);
+
+    } sharding;
+
     struct {
 
         ov_socket_configuration internal;
 
     } socket;
 
+    /* publish talk to the shared memory bus of the host as well and
+     * disable the multicast loopback, see ov_loop_bus.h */
+    bool loop_bus;
+
     ov_ice_proxy_generic_config proxy;
 
     struct {
@@ -124,4 +138,15 @@ bool ov_ice_proxy_vocs_end_of_candidates_in(ov_ice_proxy_vocs *self,
 bool ov_ice_proxy_vocs_talk(ov_ice_proxy_vocs *self, const char *session_id,
                             bool on, ov_mc_loop_data data);
 
+/*----------------------------------------------------------------------------*/
+
+/**
+    Frames and bytes sent per talk loop, see ov_metrics.h
+
+    Queue depth and latency of the DTLS handshake pool(s) are added as
+    array "dtls handshake", one item per shard, see
+    ov_dtls_handshake_pool_stats_to_json.
+*/
+ov_json_value *ov_ice_proxy_vocs_metrics(ov_ice_proxy_vocs *self);
+
 #endif /* ov_ice_proxy_vocs_h */
@@ -83,6 +83,17 @@ bool ov_ice_proxy_generic_update_session(ov_ice_proxy_generic *self,
 
 /*----------------------------------------------------------------------------*/
 
+bool ov_ice_proxy_generic_session_set_handle(ov_ice_proxy_generic *self,
+                                             const char *session_id,
+                                             uint32_t handle) {
+
+    if (!self || !session_id || !self->session.set_handle)
+        return false;
+    return self->session.set_handle(self, session_id, handle);
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_ice_proxy_generic_stream_candidate_in(
     ov_ice_proxy_generic *self, const char *session_id, uint32_t stream_id,
     const ov_ice_candidate *candidate) {
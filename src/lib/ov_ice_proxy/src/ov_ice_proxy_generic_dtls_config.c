@@ -156,6 +156,9 @@ ov_ice_proxy_generic_dtls_config_from_json(const ov_json_value *input) {
     out.dtls.keys.lifetime_usec = ov_json_number_get(
         ov_json_object_get(dtls, OV_ICE_PROXY_SSL_KEY_DTLS_KEY_LIFETIME_USEC));
 
+    out.dtls.handshake.threads = ov_json_number_get(ov_json_object_get(
+        dtls, OV_ICE_PROXY_SSL_KEY_DTLS_HANDSHAKE_THREADS));
+
 done:
     return out;
 
@@ -62,6 +62,9 @@ struct ov_ice_proxy_generic_dtls_cookie_store {
     uint16_t magic_bytes;
     ov_thread_lock lock;
 
+    /* proxies (shards) sharing the store */
+    size_t references;
+
     int cookie_counter;
     ov_ice_proxy_generic_dtls_cookie *cookie;
 };
@@ -71,12 +74,22 @@ struct ov_ice_proxy_generic_dtls_cookie_store {
 ov_ice_proxy_generic_dtls_cookie_store *
 ov_ice_proxy_generic_dtls_cookie_store_create() {
 
+    /* The SSL cookie callbacks have no userdata, so all proxies of the
+     * process share one store. */
+
+    if (global_dtls_ice_cookie_store) {
+
+        global_dtls_ice_cookie_store->references++;
+        return global_dtls_ice_cookie_store;
+    }
+
     ov_ice_proxy_generic_dtls_cookie_store *store =
         calloc(1, sizeof(ov_ice_proxy_generic_dtls_cookie_store));
 
     if (!store)
         goto error;
     store->magic_bytes = ov_ice_proxy_generic_dtls_COOKIE_STORE_MAGIC_BYTES;
+    store->references = 1;
     global_dtls_ice_cookie_store = store;
 
     if (!ov_thread_lock_init(
@@ -98,16 +111,22 @@ ov_ice_proxy_generic_dtls_cookie_store_free(
     if (!self)
         goto error;
 
+    if (self->references > 1) {
+
+        self->references--;
+        return NULL;
+    }
+
     /* Delete all cookies */
     ov_ice_proxy_generic_dtls_cookie *cookie = NULL;
 
-    while (global_dtls_ice_cookie_store->cookie) {
+    while (self->cookie) {
 
-        cookie = ov_node_pop((void **)&global_dtls_ice_cookie_store->cookie);
+        cookie = ov_node_pop((void **)&self->cookie);
         cookie = ov_data_pointer_free(cookie);
     }
 
-    ov_thread_lock_clear(&global_dtls_ice_cookie_store->lock);
+    ov_thread_lock_clear(&self->lock);
 
     global_dtls_ice_cookie_store = NULL;
     self = ov_data_pointer_free(self);
@@ -118,13 +137,11 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static bool create_cookie(size_t length) {
+static bool create_cookie(ov_ice_proxy_generic_dtls_cookie **list,
+                          size_t length) {
 
     ov_ice_proxy_generic_dtls_cookie *cookie = NULL;
 
-    if (NULL == global_dtls_ice_cookie_store)
-        goto error;
-
     if (length >= DTLS1_COOKIE_LENGTH)
         length = DTLS1_COOKIE_LENGTH - 1;
 
@@ -136,8 +153,7 @@ static bool create_cookie(size_t length) {
     if (!ov_random_string((char **)&ptr, length, NULL))
         goto error;
 
-    bool result =
-        ov_node_push((void **)&global_dtls_ice_cookie_store->cookie, cookie);
+    bool result = ov_node_push((void **)list, cookie);
 
     if (!result)
         goto error;
@@ -160,29 +176,44 @@ bool ov_ice_proxy_generic_dtls_cookie_store_initialize(
     if (NULL == global_dtls_ice_cookie_store)
         goto error;
 
-    /* Delete all cookies */
-    ov_ice_proxy_generic_dtls_cookie *cookie = NULL;
-
-    if (!ov_thread_lock_try_lock(&global_dtls_ice_cookie_store->lock))
-        goto error;
+    /* Cookies are verified within DTLS handshake workers, so the new
+     * cookies are created aside and swapped in at once. */
 
-    while (global_dtls_ice_cookie_store->cookie) {
+    bool result = false;
 
-        cookie = ov_node_pop((void **)&global_dtls_ice_cookie_store->cookie);
-        cookie = ov_data_pointer_free(cookie);
-    }
+    ov_ice_proxy_generic_dtls_cookie *cookie = NULL;
+    ov_ice_proxy_generic_dtls_cookie *fresh = NULL;
 
     for (uint8_t i = 0; i < quantity; i++) {
 
-        if (!create_cookie(length))
-            goto error;
+        if (!create_cookie(&fresh, length))
+            goto done;
     }
 
-    self->cookie_counter = ov_node_count(self->cookie);
+    if (!ov_thread_lock_try_lock(&global_dtls_ice_cookie_store->lock))
+        goto done;
+
+    cookie = global_dtls_ice_cookie_store->cookie;
+
+    global_dtls_ice_cookie_store->cookie = fresh;
+    global_dtls_ice_cookie_store->cookie_counter =
+        ov_node_count(global_dtls_ice_cookie_store->cookie);
 
     ov_thread_lock_unlock(&global_dtls_ice_cookie_store->lock);
 
-    return true;
+    /* delete the cookies replaced */
+    fresh = cookie;
+    result = true;
+
+done:
+
+    while (fresh) {
+
+        cookie = ov_node_pop((void **)&fresh);
+        cookie = ov_data_pointer_free(cookie);
+    }
+
+    return result;
 error:
     return false;
 }
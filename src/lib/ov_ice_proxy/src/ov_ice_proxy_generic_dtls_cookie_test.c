@@ -64,6 +64,19 @@ int test_ov_ice_proxy_generic_dtls_cookie_store_free() {
     testrun(NULL == ov_ice_proxy_generic_dtls_cookie_store_free(store));
     testrun(NULL == global_dtls_ice_cookie_store);
 
+    /* store shared by several proxies, e.g. the shards of some proxy */
+    store = ov_ice_proxy_generic_dtls_cookie_store_create();
+    testrun(store);
+    testrun(store == ov_ice_proxy_generic_dtls_cookie_store_create());
+    testrun(ov_ice_proxy_generic_dtls_cookie_store_initialize(store, 3, 10));
+
+    testrun(NULL == ov_ice_proxy_generic_dtls_cookie_store_free(store));
+    testrun(store == global_dtls_ice_cookie_store);
+    testrun(3 == ov_node_count(store->cookie));
+
+    testrun(NULL == ov_ice_proxy_generic_dtls_cookie_store_free(store));
+    testrun(NULL == global_dtls_ice_cookie_store);
+
     return testrun_log_success();
 }
 
@@ -44,11 +44,13 @@
 #include <ov_base/ov_config_keys.h>
 #include <ov_base/ov_convert.h>
 #include <ov_base/ov_dict.h>
+#include <ov_base/ov_expiring_map.h>
 #include <ov_base/ov_file.h>
 #include <ov_base/ov_id.h>
 #include <ov_base/ov_linked_list.h>
 #include <ov_base/ov_node.h>
 #include <ov_base/ov_random.h>
+#include <ov_base/ov_rtp_view.h>
 #include <ov_base/ov_socket.h>
 #include <ov_base/ov_string.h>
 
@@ -62,6 +64,7 @@
 #include <ov_ice/ov_ice_candidate.h>
 #include <ov_ice/ov_ice_string.h>
 
+#include <ov_encryption/ov_dtls_handshake_pool.h>
 #include <ov_encryption/ov_hash.h>
 
 #include <srtp2/srtp.h>
@@ -84,13 +87,12 @@
 
 /*----------------------------------------------------------------------------*/
 
-static const char *label_extractor_srtp = "EXTRACTOR-dtls_srtp";
-static BIO_METHOD *dtls_filter_methods = NULL;
-
-/*----------------------------------------------------------------------------*/
-
 #define OV_ICE_PROXY_MAGIC_BYTES 0x1ce1
 
+/* transactions are checked with 1/16 of their lifetime */
+#define OV_ICE_TRANSACTION_WHEEL_SLOTS 16
+#define OV_ICE_TRANSACTION_MIN_RESOLUTION_USEC 10000 // 10ms
+
 /*----------------------------------------------------------------------------*/
 
 #define OV_ICE_PROXY_DTLS_KEYS_QUANTITY_DEFAULT 10
@@ -103,8 +105,6 @@ static BIO_METHOD *dtls_filter_methods = NULL;
 #define OV_ICE_PROXY_CONNECTIVITY_PACE_USECS 50000
 #define OV_ICE_PROXY_SESSION_TIMEOUT_USECS 300000000
 
-#define OV_ICE_PROXY_SSL_ERROR_STRING_BUFFER_SIZE 200
-
 #define IMPL_STUN_ATTR_FRAMES 50
 
 /*----------------------------------------------------------------------------*/
@@ -125,19 +125,30 @@ typedef struct ov_ice_proxy {
         SSL_CTX *ctx;
         char fingerprint[ov_ice_proxy_generic_dtls_FINGERPRINT_MAX];
 
+        /* passive handshakes are processed off the loop */
+        ov_dtls_handshake_pool *pool;
+
     } dtls;
 
     struct {
 
         uint32_t dtls_key_renew;
         uint32_t transactions_invalidate;
+        uint64_t transactions_resolution_usec;
 
     } timer;
 
     ov_dict *sessions;
     ov_dict *streams;
     ov_dict *remote;
-    ov_dict *transactions;
+    ov_expiring_map *transactions;
+
+    struct {
+
+        bool enabled;
+        ov_ice_proxy_multiplexing_shard config;
+
+    } shard;
 
 } ov_ice_proxy;
 
@@ -157,6 +168,19 @@ static ov_ice_proxy *as_ice_proxy(const void *data) {
 
 /*----------------------------------------------------------------------------*/
 
+ov_dtls_handshake_pool_stats
+ov_ice_proxy_multiplexing_handshake_stats(const ov_ice_proxy_generic *self) {
+
+    ov_ice_proxy *proxy = as_ice_proxy(self);
+    if (!proxy)
+        return (ov_dtls_handshake_pool_stats){0};
+
+    /* the pool is locked internally, so this is safe from any thread */
+    return ov_dtls_handshake_pool_get_stats(proxy->dtls.pool);
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool init_config(ov_ice_proxy_generic_config *config) {
 
     if (!ov_ptr_valid(config,
@@ -211,7 +235,6 @@ static bool init_config(ov_ice_proxy_generic_config *config) {
 typedef struct Pair Pair;
 typedef struct Stream Stream;
 typedef struct Session Session;
-typedef struct Transaction Transaction;
 
 /*----------------------------------------------------------------------------*/
 
@@ -231,11 +254,8 @@ struct Pair {
         ov_ice_proxy_generic_dtls_type type;
         bool handshaked;
 
-        SSL *ssl;
-        SSL_CTX *ctx;
-
-        BIO *read;
-        BIO *write;
+        ov_dtls_handshake *handshake;
+        ov_dtls_srtp_keys keys;
 
     } dtls;
 
@@ -352,6 +372,8 @@ struct Session {
 
     ov_ice_proxy *proxy;
 
+    uint32_t handle;
+
     bool controlling;
 
     uint64_t tiebreaker;
@@ -372,14 +394,6 @@ struct Session {
     Stream *streams;
 };
 
-/*----------------------------------------------------------------------------*/
-
-struct Transaction {
-
-    uint64_t created;
-    Pair *pair;
-};
-
 /*
  *      ------------------------------------------------------------------------
  *
@@ -390,26 +404,22 @@ struct Transaction {
 
 static bool transaction_create(ov_ice_proxy *self, Pair *pair) {
 
-    Transaction *transaction = NULL;
     if (!self || !pair)
         goto error;
 
-    transaction = calloc(1, sizeof(Transaction));
-    if (!transaction)
-        goto error;
-
-    transaction->created = ov_time_get_current_time_usecs();
-    transaction->pair = pair;
-
     ov_stun_frame_generate_transaction_id((uint8_t *)pair->transaction_id);
 
-    if (!ov_dict_set(self->transactions, ov_string_dup(pair->transaction_id),
-                     transaction, NULL))
+    if (self->shard.enabled)
+        pair->transaction_id[0] = self->shard.config.id + 1;
+
+    /* pairs are owned by their streams */
+    if (!ov_expiring_map_set(
+            self->transactions, pair->transaction_id, pair,
+            self->public.config.config.limits.transaction_lifetime_usecs))
         goto error;
 
     return true;
 error:
-    transaction = ov_data_pointer_free(transaction);
     return false;
 }
 
@@ -424,13 +434,7 @@ static Pair *transaction_unset(ov_ice_proxy *self, const char *transaction_id) {
 
     strncpy(key, (char *)transaction_id, 12);
 
-    Transaction *t = ov_dict_remove(self->transactions, key);
-    if (!t)
-        goto error;
-
-    Pair *p = t->pair;
-    t = ov_data_pointer_free(t);
-    return p;
+    return ov_expiring_map_remove(self->transactions, key);
 
 error:
     return NULL;
@@ -438,64 +442,6 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static void *transaction_free(void *self) {
-
-    if (!self)
-        return NULL;
-    self = ov_data_pointer_free(self);
-    return self;
-}
-
-/*----------------------------------------------------------------------------*/
-
-struct container_timer {
-
-    uint64_t now;
-    uint64_t max;
-    ov_list *list;
-};
-
-/*----------------------------------------------------------------------------*/
-
-static bool create_timeout_key_list(const void *key, void *value, void *data) {
-
-    if (!key)
-        return true;
-
-    if (!value || !data)
-        goto error;
-
-    struct container_timer *container = (struct container_timer *)data;
-    Transaction *tdata = (Transaction *)value;
-
-    uint64_t lifetime = tdata->created + container->max;
-
-    if (container->now < lifetime)
-        return true;
-
-    // add to delete list
-    return ov_list_push(container->list, (void *)key);
-
-error:
-    return false;
-}
-
-/*----------------------------------------------------------------------------*/
-
-static bool del_key_list(void *key, void *data) {
-
-    if (!key || !data)
-        goto error;
-
-    ov_dict *dict = ov_dict_cast(data);
-    OV_ASSERT(dict);
-    return ov_dict_del(dict, key);
-error:
-    return false;
-}
-
-/*----------------------------------------------------------------------------*/
-
 static bool invalidate_transactions(uint32_t timer, void *self) {
 
     UNUSED(timer);
@@ -504,28 +450,12 @@ static bool invalidate_transactions(uint32_t timer, void *self) {
         goto error;
     proxy->timer.transactions_invalidate = OV_TIMER_INVALID;
 
-    ov_list *list = ov_list_create((ov_list_config){0});
-
-    struct container_timer container = {
-
-        .now = ov_time_get_current_time_usecs(),
-        .max = proxy->public.config.config.limits.transaction_lifetime_usecs,
-        .list = list,
-    };
-
-    if (!ov_dict_for_each(proxy->transactions, &container,
-                          create_timeout_key_list))
-        goto error;
-
-    if (!ov_list_for_each(list, proxy->transactions, del_key_list))
-        goto error;
-
-    list = ov_list_free(list);
+    ov_expiring_map_expire(proxy->transactions,
+                           ov_time_get_current_time_usecs());
 
     proxy->timer.transactions_invalidate = ov_event_loop_timer_set(
-        proxy->public.config.loop,
-        proxy->public.config.config.limits.transaction_lifetime_usecs, proxy,
-        invalidate_transactions);
+        proxy->public.config.loop, proxy->timer.transactions_resolution_usec,
+        proxy, invalidate_transactions);
 
     return true;
 error:
@@ -591,6 +521,8 @@ static void *pair_free(void *self) {
         return NULL;
     Pair *pair = (Pair *)self;
 
+    pair->dtls.handshake = ov_dtls_handshake_free(pair->dtls.handshake);
+
     if (!pair->stream)
         goto done;
 
@@ -601,16 +533,6 @@ static void *pair_free(void *self) {
 
     pair->srtp.profile = ov_data_pointer_free(pair->srtp.profile);
 
-    if (pair->dtls.ssl) {
-        SSL_free(pair->dtls.ssl);
-        pair->dtls.ssl = NULL;
-    }
-
-    if (pair->dtls.ctx) {
-        SSL_CTX_free(pair->dtls.ctx);
-        pair->dtls.ctx = NULL;
-    }
-
     ov_node_unplug((void **)&pair->stream->pairs, pair);
     if (pair == pair->stream->selected)
         pair->stream->selected = NULL;
@@ -1164,6 +1086,10 @@ static Stream *stream_create(Session *session, int i) {
 
     ov_id_fill_with_uuid(stream->uuid);
 
+    /* the ufrag of the stream starts with the hex digit of the shard */
+    if (session->proxy->shard.enabled)
+        stream->uuid[0] = "0123456789abcdef"[session->proxy->shard.config.id];
+
     if (!ov_ice_string_fill_random(stream->local.pass, OV_ICE_PASS_MIN))
         goto error;
 
@@ -2939,121 +2865,6 @@ error:
     return false;
 }
 
-/*---------------------------------------------------------------------------*/
-
-static bool
-srtp_get_key_length_of_profile(const SRTP_PROTECTION_PROFILE *profile,
-                               uint32_t *keylen, uint32_t *saltlen) {
-
-    if (!profile || !keylen || !saltlen)
-        goto error;
-
-    if (!profile->id)
-        goto error;
-
-    switch (profile->id) {
-
-    case SRTP_AES128_CM_SHA1_80:
-        *keylen = 16;
-        *saltlen = 14;
-        break;
-
-    case SRTP_AES128_CM_SHA1_32:
-        *keylen = 16;
-        *saltlen = 14;
-        break;
-
-    case SRTP_AEAD_AES_128_GCM:
-        *keylen = 16;
-        *saltlen = 12;
-        break;
-
-    case SRTP_AEAD_AES_256_GCM:
-        *keylen = 32;
-        *saltlen = 12;
-        break;
-
-    default:
-        goto error;
-    }
-
-    return true;
-error:
-    return false;
-}
-
-/*----------------------------------------------------------------------------*/
-
-static const char *dtls_get_srtp_keys(Pair *pair, uint32_t *key_len,
-                                      uint32_t *salt_len, uint8_t *server_key,
-                                      uint8_t *server_salt, uint8_t *client_key,
-                                      uint8_t *client_salt) {
-
-    size_t size =
-        2 * OV_ICE_PROXY_SRTP_KEY_MAX + 2 * OV_ICE_PROXY_SRTP_SALT_MAX + 1;
-
-    uint8_t buffer[size];
-    memset(buffer, 0, size);
-
-    if (!pair || !pair->dtls.ssl || !key_len || !salt_len || !server_key ||
-        !server_salt || !client_key || !client_salt)
-        goto error;
-
-    uint32_t keylen = 0;
-    uint32_t saltlen = 0;
-
-    SRTP_PROTECTION_PROFILE *profile =
-        SSL_get_selected_srtp_profile(pair->dtls.ssl);
-
-    if (!srtp_get_key_length_of_profile(profile, &keylen, &saltlen))
-        goto error;
-
-    if (keylen > *key_len)
-        goto error;
-
-    if (saltlen > *salt_len)
-        goto error;
-
-    /*      The total length of keying material obtained
-            should be equal to two times the sum of
-            the master key length and the salt length
-            as defined for the protection profile in use.
-
-            This provides the client write master key,
-            the server write master key,
-            the client write master salt and
-            the server write master salt in that order.
-
-    */
-
-    if (1 != SSL_export_keying_material(
-                 pair->dtls.ssl, buffer, size, label_extractor_srtp,
-                 strlen(label_extractor_srtp), NULL, 0, 0))
-        goto error;
-
-    *key_len = keylen;
-    *salt_len = saltlen;
-
-    uint8_t *ptr = buffer;
-
-    if (!memcpy(client_key, ptr, keylen))
-        return false;
-    ptr += keylen;
-    if (!memcpy(server_key, ptr, keylen))
-        return false;
-    ptr += keylen;
-    if (!memcpy(client_salt, ptr, saltlen))
-        return false;
-    ptr += saltlen;
-    if (!memcpy(server_salt, ptr, saltlen))
-        return false;
-    ptr += saltlen;
-
-    return profile->name;
-error:
-    return NULL;
-}
-
 /*----------------------------------------------------------------------------*/
 
 static bool srtp_unset_data(Pair *pair) {
@@ -3080,305 +2891,79 @@ static bool get_profile(Pair *pair) {
 
     srtp_unset_data(pair);
 
-    const char *profile = dtls_get_srtp_keys(
-        pair, &pair->srtp.key_len, &pair->srtp.salt_len, pair->srtp.server.key,
-        pair->srtp.server.salt, pair->srtp.client.key, pair->srtp.client.salt);
-
-    if (profile) {
-
-        pair->srtp.ready = true;
-        pair->srtp.profile = ov_data_pointer_free(pair->srtp.profile);
-        pair->srtp.profile = strdup(profile);
-
-        stream_complete_dtls(pair->stream, pair);
-    }
+    if (!pair->dtls.handshaked)
+        return true;
 
-    return true;
-}
+    if ((pair->dtls.keys.key_len > OV_ICE_PROXY_SRTP_KEY_MAX) ||
+        (pair->dtls.keys.salt_len > OV_ICE_PROXY_SRTP_SALT_MAX))
+        return false;
 
-/*----------------------------------------------------------------------------*/
+    pair->srtp.key_len = pair->dtls.keys.key_len;
+    pair->srtp.salt_len = pair->dtls.keys.salt_len;
 
-static long dtls_bio_ctrl(BIO *bio, int cmd, long num, void *ptr) {
+    memcpy(pair->srtp.server.key, pair->dtls.keys.server.key,
+           pair->srtp.key_len);
+    memcpy(pair->srtp.server.salt, pair->dtls.keys.server.salt,
+           pair->srtp.salt_len);
+    memcpy(pair->srtp.client.key, pair->dtls.keys.client.key,
+           pair->srtp.key_len);
+    memcpy(pair->srtp.client.salt, pair->dtls.keys.client.salt,
+           pair->srtp.salt_len);
 
-    UNUSED(bio);
-    UNUSED(num);
-    UNUSED(ptr);
+    pair->srtp.ready = true;
+    pair->srtp.profile = strdup(pair->dtls.keys.profile);
 
-    switch (cmd) {
-    case BIO_CTRL_FLUSH:
-        return 1;
-    case BIO_CTRL_WPENDING:
-    case BIO_CTRL_PENDING:
-        return 0L;
-    default:
-        break;
-    }
+    stream_complete_dtls(pair->stream, pair);
 
-    return 0;
+    return true;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static int dtls_bio_write(BIO *bio, const char *in, int size) {
-
-    if (size <= 0)
-        goto error;
-
-    Pair *pair = (Pair *)BIO_get_data(bio);
+static ssize_t dtls_handshake_send(void *userdata, const uint8_t *buffer,
+                                   size_t size) {
 
-    return pair_send(pair, (uint8_t *)in, size);
-error:
-    return -1;
+    return pair_send((Pair *)userdata, buffer, size);
 }
 
 /*----------------------------------------------------------------------------*/
 
-static int dtls_bio_create(BIO *bio) {
-
-    BIO_set_init(bio, 1);
-    BIO_set_data(bio, NULL);
-    BIO_set_shutdown(bio, 0);
-    return 1;
-}
-
-/*----------------------------------------------------------------------------*/
+static void dtls_handshake_keys(void *userdata, const ov_dtls_srtp_keys *keys) {
 
-static int dtls_bio_free(BIO *bio) {
+    Pair *pair = (Pair *)userdata;
+    if (!pair || !keys)
+        return;
 
-    if (bio == NULL) {
-        return 0;
-    }
+    pair->dtls.handshaked = true;
+    pair->dtls.keys = *keys;
 
-    BIO_set_data(bio, NULL);
-    return 1;
+    get_profile(pair);
 }
 
 /*----------------------------------------------------------------------------*/
 
-static void dtls_filter_init() {
+static bool dtls_handshake_passive(ov_ice_proxy *self, Pair *pair) {
 
-    dtls_filter_methods = BIO_meth_new(BIO_TYPE_BIO, "DTLS writer");
-
-    if (!dtls_filter_methods) {
+    if (!self || !pair)
         goto error;
-    }
-    BIO_meth_set_write(dtls_filter_methods, dtls_bio_write);
-    BIO_meth_set_ctrl(dtls_filter_methods, dtls_bio_ctrl);
-    BIO_meth_set_create(dtls_filter_methods, dtls_bio_create);
-    BIO_meth_set_destroy(dtls_filter_methods, dtls_bio_free);
-error:
-    return;
-}
 
-/*----------------------------------------------------------------------------*/
-
-static void dtls_filter_deinit() {
-
-    if (dtls_filter_methods) {
-        BIO_meth_free(dtls_filter_methods);
-        dtls_filter_methods = NULL;
-    }
-}
-
-/*----------------------------------------------------------------------------*/
-
-static BIO *dtls_filter_pair_bio_create(Pair *pair) {
-
-    BIO *bio = BIO_new(dtls_filter_methods);
-
-    if (bio == NULL) {
-        return NULL;
-    }
+    ov_dtls_handshake_config config = (ov_dtls_handshake_config){
+        .ctx = self->dtls.ctx,
+        .callback.userdata = pair,
+        .callback.send = dtls_handshake_send,
+        .callback.keys = dtls_handshake_keys};
 
-    BIO_set_data(bio, pair);
-    return bio;
-}
-
-/*----------------------------------------------------------------------------*/
-
-static bool dtls_handshake_passive(ov_ice_proxy *self, Pair *pair,
-                                   uint8_t *buffer, size_t size) {
-
-    char errorstring[OV_ICE_PROXY_SSL_ERROR_STRING_BUFFER_SIZE] = {0};
-    int errorcode = -1;
-    int n = 0, r = 0;
-
-    if (!self || !pair || !buffer || !size)
+    if (strlen(self->public.config.config.dtls.srtp.profile) >=
+        OV_DTLS_PROFILE_MAX)
         goto error;
 
-    if (pair->dtls.ssl) {
-
-        SSL_free(pair->dtls.ssl);
-        pair->dtls.ssl = NULL;
-    }
+    strcpy(config.srtp_profile, self->public.config.config.dtls.srtp.profile);
 
     pair->dtls.handshaked = false;
     pair->dtls.type = OV_ICE_PROXY_GENERIC_DTLS_PASSIVE;
-    pair->dtls.ssl = SSL_new(self->dtls.ctx);
-
-    if (!pair->dtls.ssl)
-        goto error;
-
-    SSL_set_accept_state(pair->dtls.ssl);
-
-    OV_ASSERT(1 == SSL_is_server(pair->dtls.ssl));
+    pair->dtls.handshake = ov_dtls_handshake_passive(self->dtls.pool, config);
 
-    r = SSL_set_tlsext_use_srtp(pair->dtls.ssl,
-                                self->public.config.config.dtls.srtp.profile);
-    if (0 != r)
-        goto error;
-
-    pair->dtls.read = BIO_new(BIO_s_mem());
-    if (!pair->dtls.read)
-        goto error;
-
-    pair->dtls.write = dtls_filter_pair_bio_create(pair);
-    if (!pair->dtls.write)
-        goto error;
-
-    BIO_set_mem_eof_return(pair->dtls.read, -1);
-    BIO_set_mem_eof_return(pair->dtls.write, -1);
-
-    SSL_set_bio(pair->dtls.ssl, pair->dtls.read, pair->dtls.write);
-    SSL_set_options(pair->dtls.ssl, SSL_OP_COOKIE_EXCHANGE);
-
-    r = BIO_write(pair->dtls.read, buffer, size);
-    if (r < 0)
-        goto error;
-
-    BIO_ADDR *peer_bio = BIO_ADDR_new();
-
-    r = DTLSv1_listen(pair->dtls.ssl, peer_bio);
-
-    if (peer_bio) {
-        BIO_ADDR_free(peer_bio);
-        peer_bio = NULL;
-    }
-
-    if (r >= 1) {
-
-        pair->dtls.handshaked = true;
-        get_profile(pair);
-        goto done;
-
-    } else if (r == 0) {
-
-        /*
-         *      Non Fatal error, usercode is expected to
-         *      retry operation. (man DTLSv1_listen)
-         */
-
-        SSL_free(pair->dtls.ssl);
-        pair->dtls.ssl = NULL;
-
-    } else {
-
-        n = SSL_get_error(pair->dtls.ssl, r);
-
-        switch (n) {
-
-        case SSL_ERROR_NONE:
-        case SSL_ERROR_WANT_READ:
-        case SSL_ERROR_WANT_CONNECT:
-        case SSL_ERROR_WANT_ACCEPT:
-        case SSL_ERROR_WANT_X509_LOOKUP:
-        case SSL_ERROR_WANT_WRITE:
-            break;
-
-        case SSL_ERROR_ZERO_RETURN:
-            // connection close
-            // ov_log_debug("FD %i connection closed", socket);
-            goto error;
-            break;
-
-        case SSL_ERROR_SYSCALL:
-
-            ov_log_error("SSL_ERROR_SYSCALL - "
-                         "errno %d | %s",
-                         errno, strerror(errno));
-
-            goto error;
-
-            break;
-
-        case SSL_ERROR_SSL:
-
-            errorcode = ERR_get_error();
-            ERR_error_string_n(errorcode, errorstring,
-                               OV_ICE_PROXY_SSL_ERROR_STRING_BUFFER_SIZE);
-
-            ov_log_error("socket SSL_ERROR_SSL - "
-                         "%s",
-                         errorstring);
-            goto error;
-
-            break;
-
-        default:
-
-            goto error;
-            break;
-        }
-    }
-
-done:
-    return true;
-error:
-    return false;
-}
-
-/*----------------------------------------------------------------------------*/
-
-static bool dtls_io(Pair *pair, uint8_t *buffer, size_t size) {
-
-    char buf[OV_ICE_PROXY_SSL_BUFFER_SIZE] = {0};
-
-    int r = 0;
-    ssize_t out = 0;
-
-    if (!pair || !buffer || !size)
-        goto error;
-
-    if (!pair->dtls.ssl)
-        goto error;
-    if (!pair->dtls.read)
-        goto error;
-
-    r = BIO_write(pair->dtls.read, buffer, size);
-    if (r < 0)
-        goto error;
-
-    if (!SSL_is_init_finished(pair->dtls.ssl)) {
-
-        switch (pair->dtls.type) {
-
-        case OV_ICE_PROXY_GENERIC_DTLS_PASSIVE:
-
-            r = SSL_do_handshake(pair->dtls.ssl);
-
-            if (SSL_is_init_finished(pair->dtls.ssl)) {
-                pair->dtls.handshaked = true;
-            }
-
-            break;
-
-        default:
-            goto error;
-        }
-
-        get_profile(pair);
-
-    } else {
-
-        // just read empty
-        out = SSL_read(pair->dtls.ssl, buf, OV_ICE_PROXY_SSL_BUFFER_SIZE);
-        UNUSED(out);
-
-        if (!pair->srtp.profile)
-            get_profile(pair);
-    }
-
-    return true;
+    return NULL != pair->dtls.handshake;
 error:
     return false;
 }
@@ -3399,15 +2984,13 @@ static bool io_external_ssl(ov_ice_proxy *self, uint8_t *buffer, size_t size,
     if (!pair)
         goto ignore;
 
-    if (!pair->dtls.ssl) {
-
-        if (!dtls_handshake_passive(self, pair, buffer, size))
-            goto ignore;
+    /* The loop only passes the datagram, SSL is processed within the
+     * handshake pool. */
 
+    if (!pair->dtls.handshake && !dtls_handshake_passive(self, pair))
         goto ignore;
-    }
 
-    dtls_io(pair, buffer, size);
+    ov_dtls_handshake_input(pair->dtls.handshake, buffer, size);
 
 ignore:
     return true;
@@ -3451,17 +3034,30 @@ static bool io_external_rtp(ov_ice_proxy *self, uint8_t *buffer, size_t size,
     /* We change the SSRC to the proxy SSRC and forward the RTP Frame
      * internal */
 
-    uint32_t u32 = htonl(stream->local.ssrc);
-    memcpy(buffer + 8, &u32, 4);
+    ov_rtp_view rtp = {0};
+
+    if (!ov_rtp_view_parse(&rtp, buffer, l))
+        goto ignore;
+
+    ov_rtp_view_set_ssrc(&rtp, stream->local.ssrc);
 
     /* Forward to callback */
 
     ov_ice_proxy *proxy = stream->session->proxy;
 
-    if (proxy->public.config.callbacks.stream.io)
+    if (stream->session->handle &&
+        proxy->public.config.callbacks.stream.io_handle) {
+
+        proxy->public.config.callbacks.stream.io_handle(
+            proxy->public.config.callbacks.userdata, stream->session->handle,
+            stream->index, buffer, l);
+
+    } else if (proxy->public.config.callbacks.stream.io) {
+
         proxy->public.config.callbacks.stream.io(
             proxy->public.config.callbacks.userdata, stream->session->uuid,
             stream->index, buffer, l);
+    }
 
 ignore:
     return true;
@@ -3471,6 +3067,11 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static bool io_external_process(ov_ice_proxy *self, uint8_t *buffer,
+                                size_t bytes, const ov_socket_data *remote);
+
+/*----------------------------------------------------------------------------*/
+
 static bool io_external(int socket, uint8_t events, void *userdata) {
 
     uint8_t buffer[OV_UDP_PAYLOAD_OCTETS] = {0};
@@ -3499,6 +3100,21 @@ static bool io_external(int socket, uint8_t events, void *userdata) {
                                           OV_HOST_NAME_MAX, &remote.port))
         goto error;
 
+    if (self->shard.enabled && self->shard.config.foreign &&
+        self->shard.config.foreign(self->shard.config.userdata, buffer, bytes,
+                                   &remote))
+        return true;
+
+    return io_external_process(self, buffer, bytes, &remote);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool io_external_process(ov_ice_proxy *self, uint8_t *buffer,
+                                size_t bytes, const ov_socket_data *remote) {
+
     /*  -----------------------------------------------------------------
      *      RFC 7983 paket forwarding
      *
@@ -3523,21 +3139,19 @@ static bool io_external(int socket, uint8_t events, void *userdata) {
      */
 
     if (buffer[0] <= 3)
-        return io_external_stun(self, buffer, bytes, &remote);
+        return io_external_stun(self, buffer, bytes, remote);
 
     if (buffer[0] <= 63 && buffer[0] >= 20) {
 
-        return io_external_ssl(self, buffer, bytes, &remote);
+        return io_external_ssl(self, buffer, bytes, remote);
     }
 
     if (buffer[0] <= 191 && buffer[0] >= 128) {
 
-        return io_external_rtp(self, buffer, bytes, &remote);
+        return io_external_rtp(self, buffer, bytes, remote);
     }
 
     return true;
-error:
-    return false;
 }
 
 /*
@@ -3703,7 +3317,15 @@ static ov_ice_proxy_generic *ov_ice_proxy_free(ov_ice_proxy_generic *in) {
     self->sessions = ov_dict_free(self->sessions);
     self->streams = ov_dict_free(self->streams);
     self->remote = ov_dict_free(self->remote);
-    self->transactions = ov_dict_free(self->transactions);
+    if (OV_TIMER_INVALID != self->timer.transactions_invalidate) {
+
+        ov_event_loop_timer_unset(self->public.config.loop,
+                                  self->timer.transactions_invalidate, NULL);
+
+        self->timer.transactions_invalidate = OV_TIMER_INVALID;
+    }
+
+    self->transactions = ov_expiring_map_free(self->transactions);
 
     self->candidate.string = ov_data_pointer_free(self->candidate.string);
 
@@ -3714,7 +3336,7 @@ static ov_ice_proxy_generic *ov_ice_proxy_free(ov_ice_proxy_generic *in) {
         self->socket = -1;
     }
 
-    if (OV_TIMER_INVALID == self->timer.dtls_key_renew) {
+    if (OV_TIMER_INVALID != self->timer.dtls_key_renew) {
 
         ov_event_loop_timer_unset(self->public.config.loop,
                                   self->timer.dtls_key_renew, NULL);
@@ -3722,6 +3344,9 @@ static ov_ice_proxy_generic *ov_ice_proxy_free(ov_ice_proxy_generic *in) {
         self->timer.dtls_key_renew = OV_TIMER_INVALID;
     }
 
+    /* all handshakes are freed with the sessions */
+    self->dtls.pool = ov_dtls_handshake_pool_free(self->dtls.pool);
+
     if (self->dtls.ctx) {
         SSL_CTX_free(self->dtls.ctx);
         self->dtls.ctx = NULL;
@@ -3730,7 +3355,6 @@ static ov_ice_proxy_generic *ov_ice_proxy_free(ov_ice_proxy_generic *in) {
     self->dtls.cookies =
         ov_ice_proxy_generic_dtls_cookie_store_free(self->dtls.cookies);
 
-    dtls_filter_deinit();
     // clean other openssl initializations
     // TBD check if this are all required
     // FIPS_mode_set(0);
@@ -4225,8 +3849,10 @@ static bool ov_ice_proxy_session_update(ov_ice_proxy_generic *generic,
 
         const char *value = NULL;
 
-        while (ov_sdp_attributes_iterate(&desc->attributes,
-                                         OV_ICE_STRING_CANDIDATE, &value)) {
+        /* iterate moves the list pointer, keep the one of the SDP */
+        next = desc->attributes;
+        while (ov_sdp_attributes_iterate(&next, OV_ICE_STRING_CANDIDATE,
+                                         &value)) {
 
             ov_ice_candidate *c =
                 ov_ice_candidate_from_string(value, strlen(value));
@@ -4255,6 +3881,26 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static bool ov_ice_proxy_session_set_handle(ov_ice_proxy_generic *generic,
+                                            const char *session_id,
+                                            uint32_t handle) {
+
+    ov_ice_proxy *self = as_ice_proxy(generic);
+    if (!self || !session_id)
+        goto error;
+
+    Session *session = ov_dict_get(self->sessions, session_id);
+    if (!session)
+        goto error;
+
+    session->handle = handle;
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool
 ov_ice_proxy_stream_candidate_in(ov_ice_proxy_generic *generic,
                                  const char *session_id, uint32_t stream_id,
@@ -4359,12 +4005,14 @@ static ssize_t ov_ice_proxy_stream_send(ov_ice_proxy_generic *generic,
     if (!srtp_session)
         goto error;
 
-    uint32_t u32 = htonl(stream->local.ssrc);
-    memcpy(buffer + 8, &u32, 4);
+    ov_rtp_view rtp = {0};
+
+    if (!ov_rtp_view_parse(&rtp, buffer, bytes))
+        goto error;
 
     // we set payload type to format
-    buffer[1] = 0x80 & buffer[1];
-    buffer[1] |= (uint8_t)stream->format;
+    ov_rtp_view_set_ssrc(&rtp, stream->local.ssrc);
+    ov_rtp_view_set_payload_type(&rtp, (uint8_t)stream->format);
 
     int out = bytes;
 
@@ -4389,8 +4037,9 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-ov_ice_proxy_generic *
-ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config) {
+static ov_ice_proxy_generic *
+proxy_create(ov_ice_proxy_generic_config config,
+             const ov_ice_proxy_multiplexing_shard *shard) {
 
     ov_ice_proxy *self = NULL;
 
@@ -4406,10 +4055,19 @@ ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config) {
     self->public.type = OV_ICE_PROXY_MAGIC_BYTES;
     self->public.config = config;
 
+    if (shard) {
+
+        if (!ov_cond_valid(shard->id < OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX,
+                           "Cannot create ICE Proxy - Shard id invalid"))
+            goto error;
+
+        self->shard.enabled = true;
+        self->shard.config = *shard;
+    }
+
     // init openssl
     SSL_library_init();
     SSL_load_error_strings();
-    dtls_filter_init();
 
     if (!ov_cond_valid(configure_dtls(self),
                        "Cannot create ICE Proxy - Configuring DTLS failed"))
@@ -4421,7 +4079,25 @@ ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config) {
             "Cannot create ICE Proxy - Could not create fingerprint cert"))
         goto error;
 
-    self->socket = ov_socket_create(self->public.config.external, false, NULL);
+    self->dtls.pool =
+        ov_dtls_handshake_pool_create((ov_dtls_handshake_pool_config){
+            .loop = config.loop,
+            .threads = config.config.dtls.dtls.handshake.threads});
+
+    if (!ov_ptr_valid(self->dtls.pool,
+                      "Cannot create ICE Proxy - No DTLS handshake pool"))
+        goto error;
+
+    if (self->shard.enabled) {
+
+        self->socket =
+            ov_socket_create_reuseport(self->public.config.external, NULL);
+
+    } else {
+
+        self->socket =
+            ov_socket_create(self->public.config.external, false, NULL);
+    }
 
     if (-1 == self->socket) {
 
@@ -4453,13 +4129,24 @@ ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config) {
     if (!self->sessions)
         goto error;
 
-    d_config.value.data_function.free = transaction_free;
-    self->transactions = ov_dict_create(d_config);
+    self->timer.transactions_resolution_usec =
+        config.config.limits.transaction_lifetime_usecs /
+        OV_ICE_TRANSACTION_WHEEL_SLOTS;
+
+    if (self->timer.transactions_resolution_usec <
+        OV_ICE_TRANSACTION_MIN_RESOLUTION_USEC)
+        self->timer.transactions_resolution_usec =
+            OV_ICE_TRANSACTION_MIN_RESOLUTION_USEC;
+
+    self->transactions = ov_expiring_map_create((ov_expiring_map_config){
+        .wheel.slots = OV_ICE_TRANSACTION_WHEEL_SLOTS + 1,
+        .wheel.resolution_usec = self->timer.transactions_resolution_usec});
+
     if (!self->transactions)
         goto error;
 
     self->timer.transactions_invalidate = ov_event_loop_timer_set(
-        config.loop, config.config.limits.transaction_lifetime_usecs, self,
+        config.loop, self->timer.transactions_resolution_usec, self,
         invalidate_transactions);
 
     if (OV_TIMER_INVALID == self->timer.transactions_invalidate)
@@ -4487,6 +4174,7 @@ ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config) {
     self->public.session.create = ov_ice_proxy_create_session;
     self->public.session.drop = ov_ice_proxy_session_drop;
     self->public.session.update = ov_ice_proxy_session_update;
+    self->public.session.set_handle = ov_ice_proxy_session_set_handle;
 
     self->public.stream.candidate_in = ov_ice_proxy_stream_candidate_in;
     self->public.stream.end_of_candidates_in =
@@ -4501,3 +4189,70 @@ error:
     ov_ice_proxy_free(ov_ice_proxy_generic_cast(self));
     return NULL;
 }
+
+/*----------------------------------------------------------------------------*/
+
+ov_ice_proxy_generic *
+ov_ice_proxy_multiplexing_create(ov_ice_proxy_generic_config config) {
+
+    return proxy_create(config, NULL);
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      SHARDING
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+ov_ice_proxy_generic *
+ov_ice_proxy_multiplexing_create_shard(ov_ice_proxy_generic_config config,
+                                       ov_ice_proxy_multiplexing_shard shard) {
+
+    return proxy_create(config, &shard);
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_ice_proxy_multiplexing_input(ov_ice_proxy_generic *generic,
+                                     uint8_t *buffer, size_t size,
+                                     const ov_socket_data *remote) {
+
+    ov_ice_proxy *self = as_ice_proxy(generic);
+    if (!self || !buffer || !size || !remote)
+        return false;
+
+    return io_external_process(self, buffer, size, remote);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int ov_ice_proxy_multiplexing_shard_of_ufrag(const char *ufrag) {
+
+    if (!ufrag)
+        return -1;
+
+    if ((ufrag[0] >= '0') && (ufrag[0] <= '9'))
+        return ufrag[0] - '0';
+
+    if ((ufrag[0] >= 'a') && (ufrag[0] <= 'f'))
+        return ufrag[0] - 'a' + 10;
+
+    return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int ov_ice_proxy_multiplexing_shard_of_transaction(
+    const uint8_t *transaction_id) {
+
+    if (!transaction_id)
+        return -1;
+
+    if ((transaction_id[0] < 1) ||
+        (transaction_id[0] > OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX))
+        return -1;
+
+    return transaction_id[0] - 1;
+}
@@ -0,0 +1,1221 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_ice_proxy_sharded.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_ice_proxy_sharded.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <ov_base/ov_dict.h>
+#include <ov_base/ov_expiring_map.h>
+#include <ov_base/ov_id.h>
+#include <ov_base/ov_time.h>
+#include <ov_base/ov_utils.h>
+
+#include <ov_stun/ov_stun_attributes_rfc5389.h>
+#include <ov_stun/ov_stun_frame.h>
+#include <ov_stun/ov_stun_username.h>
+
+#define OV_ICE_PROXY_SHARDED_MAGIC_BYTES 0x1ce5
+
+/* max runtime of one loop run of some shard, the loop is stopped earlier
+ * if the control thread is waiting for the shard */
+#define IMPL_SHARD_RUN_USEC 100000 // 100ms
+
+/* remote address to shard routes, refreshed by STUN consent checks */
+#define IMPL_ROUTE_LIFETIME_USEC 30000000 // 30s
+#define IMPL_ROUTE_RESOLUTION_USEC 1000000 // 1s
+
+#define IMPL_ROUTE_KEY_MAX OV_HOST_NAME_MAX + 10
+#define IMPL_STUN_ATTR_FRAMES 50
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_ice_proxy_sharded ov_ice_proxy_sharded;
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum PacketType {
+
+    PACKET_EXTERNAL = 0, // received by some other shard
+    PACKET_MEDIA = 1     // to be send to some stream of the shard
+
+} PacketType;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Packet Packet;
+
+struct Packet {
+
+    Packet *next;
+    PacketType type;
+
+    ov_socket_data remote; // PACKET_EXTERNAL
+
+    ov_id session_id; // PACKET_MEDIA
+    uint32_t stream_id;
+
+    size_t size;
+    uint8_t buffer[];
+};
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum EventType {
+
+    EVENT_SESSION_DROP = 0,
+    EVENT_SESSION_STATE = 1,
+    EVENT_CANDIDATE = 2,
+    EVENT_END_OF_CANDIDATES = 3
+
+} EventType;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Event Event;
+
+struct Event {
+
+    Event *next;
+    EventType type;
+
+    ov_id session_id;
+    ov_ice_proxy_generic_state state;
+    ov_json_value *candidate;
+};
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Shard {
+
+    uint8_t id;
+    ov_ice_proxy_sharded *sharded;
+
+    ov_event_loop *loop;
+    ov_ice_proxy_generic *proxy;
+
+    pthread_t thread;
+    bool started;
+
+    /* held while the loop of the shard runs */
+    pthread_mutex_t lock;
+    atomic_int waiting;
+
+    /* socketpair to interrupt the loop of the shard */
+    int wakeup[2];
+
+    struct {
+
+        pthread_mutex_t lock;
+        Packet *head;
+        Packet *tail;
+
+    } inbox;
+
+    size_t sessions;
+    atomic_uint_fast64_t received;
+
+} Shard;
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_ice_proxy_sharded {
+
+    ov_ice_proxy_generic public;
+
+    ov_ice_proxy_sharded_config config;
+
+    atomic_bool running;
+
+    size_t count;
+    Shard *shard;
+
+    /* session id -> Shard, used within the control thread only */
+    ov_dict *sessions;
+
+    /* remote "host:port" -> shard id + 1 */
+    struct {
+
+        pthread_rwlock_t lock;
+        ov_expiring_map *map;
+        uint32_t timer;
+
+    } routes;
+
+    /* callbacks of the shards to be called within the control thread */
+    struct {
+
+        pthread_mutex_t lock;
+        Event *head;
+        Event *tail;
+        int wakeup[2];
+
+    } events;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static ov_ice_proxy_sharded *as_ice_proxy_sharded(const void *data) {
+
+    ov_ice_proxy_generic *generic = ov_ice_proxy_generic_cast(data);
+    if (!generic)
+        return NULL;
+
+    if (generic->type == OV_ICE_PROXY_SHARDED_MAGIC_BYTES)
+        return (ov_ice_proxy_sharded *)data;
+
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #routing FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void route_key(const ov_socket_data *remote, char *key) {
+
+    snprintf(key, IMPL_ROUTE_KEY_MAX, "%s:%i", remote->host, remote->port);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void route_set(ov_ice_proxy_sharded *self, const ov_socket_data *remote,
+                      int shard) {
+
+    char key[IMPL_ROUTE_KEY_MAX] = {0};
+    route_key(remote, key);
+
+    pthread_rwlock_wrlock(&self->routes.lock);
+
+    ov_expiring_map_set(self->routes.map, key, (void *)(uintptr_t)(shard + 1),
+                        IMPL_ROUTE_LIFETIME_USEC);
+
+    pthread_rwlock_unlock(&self->routes.lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int route_get(ov_ice_proxy_sharded *self,
+                     const ov_socket_data *remote) {
+
+    char key[IMPL_ROUTE_KEY_MAX] = {0};
+    route_key(remote, key);
+
+    pthread_rwlock_rdlock(&self->routes.lock);
+    uintptr_t shard = (uintptr_t)ov_expiring_map_get(self->routes.map, key);
+    pthread_rwlock_unlock(&self->routes.lock);
+
+    return (int)shard - 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int route_stun(const uint8_t *buffer, size_t size) {
+
+    size_t attr_size = IMPL_STUN_ATTR_FRAMES;
+    uint8_t *attr[attr_size];
+    memset(attr, 0, attr_size * sizeof(uint8_t *));
+
+    if (!ov_stun_frame_is_valid(buffer, size))
+        goto error;
+
+    if (!ov_stun_frame_has_magic_cookie(buffer, size))
+        goto error;
+
+    if (!ov_stun_frame_class_is_request(buffer, size)) {
+
+        /* responses to our own checks */
+        return ov_ice_proxy_multiplexing_shard_of_transaction(
+            ov_stun_frame_get_transaction_id(buffer, size));
+    }
+
+    if (!ov_stun_frame_slice(buffer, size, attr, attr_size))
+        goto error;
+
+    uint8_t *username =
+        ov_stun_attributes_get_type(attr, attr_size, STUN_USERNAME);
+
+    if (!username)
+        goto error;
+
+    uint8_t *name = NULL;
+    size_t name_length = 0;
+
+    if (!ov_stun_username_decode(username, size - (username - buffer), &name,
+                                 &name_length))
+        goto error;
+
+    if (name_length < 1)
+        goto error;
+
+    /* USERNAME is local:remote ufrag */
+    char ufrag[2] = {(char)name[0], 0};
+    return ov_ice_proxy_multiplexing_shard_of_ufrag(ufrag);
+
+error:
+    return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int route_packet(ov_ice_proxy_sharded *self, const uint8_t *buffer,
+                        size_t size, const ov_socket_data *remote) {
+
+    int shard = -1;
+
+    if (buffer[0] > 3)
+        return route_get(self, remote);
+
+    shard = route_stun(buffer, size);
+
+    if ((shard < 0) || ((size_t)shard >= self->count))
+        return -1;
+
+    /* learn the remote for DTLS and SRTP */
+    route_set(self, remote, shard);
+    return shard;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool invalidate_routes(uint32_t timer, void *data) {
+
+    UNUSED(timer);
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(data);
+    if (!self)
+        goto error;
+
+    pthread_rwlock_wrlock(&self->routes.lock);
+    ov_expiring_map_expire(self->routes.map, ov_time_get_current_time_usecs());
+    pthread_rwlock_unlock(&self->routes.lock);
+
+    self->routes.timer =
+        ov_event_loop_timer_set(self->config.proxy.loop,
+                                IMPL_ROUTE_RESOLUTION_USEC, self,
+                                invalidate_routes);
+
+    return true;
+error:
+    return false;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #shard FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void shard_wakeup(Shard *shard) {
+
+    uint8_t value = 1;
+    ssize_t out = send(shard->wakeup[1], &value, sizeof(value), 0);
+    UNUSED(out);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void shard_lock(Shard *shard) {
+
+    atomic_fetch_add(&shard->waiting, 1);
+    shard_wakeup(shard);
+
+    pthread_mutex_lock(&shard->lock);
+    atomic_fetch_sub(&shard->waiting, 1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void shard_unlock(Shard *shard) {
+
+    pthread_mutex_unlock(&shard->lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool shard_post(Shard *shard, Packet *packet) {
+
+    packet->next = NULL;
+
+    pthread_mutex_lock(&shard->inbox.lock);
+
+    bool was_empty = (NULL == shard->inbox.head);
+
+    if (shard->inbox.tail) {
+        shard->inbox.tail->next = packet;
+    } else {
+        shard->inbox.head = packet;
+    }
+
+    shard->inbox.tail = packet;
+
+    pthread_mutex_unlock(&shard->inbox.lock);
+
+    /* the shard drains the whole inbox with each wakeup */
+    if (was_empty)
+        shard_wakeup(shard);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Packet *packet_create(PacketType type, const uint8_t *buffer,
+                             size_t size) {
+
+    Packet *packet = calloc(1, sizeof(Packet) + size);
+    if (!packet)
+        return NULL;
+
+    packet->type = type;
+    packet->size = size;
+    memcpy(packet->buffer, buffer, size);
+
+    return packet;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void shard_process_inbox(Shard *shard) {
+
+    pthread_mutex_lock(&shard->inbox.lock);
+
+    Packet *packet = shard->inbox.head;
+    shard->inbox.head = NULL;
+    shard->inbox.tail = NULL;
+
+    pthread_mutex_unlock(&shard->inbox.lock);
+
+    while (packet) {
+
+        Packet *next = packet->next;
+
+        switch (packet->type) {
+
+        case PACKET_EXTERNAL:
+
+            atomic_fetch_add(&shard->received, 1);
+
+            ov_ice_proxy_multiplexing_input(shard->proxy, packet->buffer,
+                                            packet->size, &packet->remote);
+            break;
+
+        case PACKET_MEDIA:
+
+            ov_ice_proxy_generic_stream_send(shard->proxy, packet->session_id,
+                                             packet->stream_id, packet->buffer,
+                                             packet->size);
+            break;
+        }
+
+        free(packet);
+        packet = next;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool shard_io_wakeup(int socket, uint8_t events, void *userdata) {
+
+    Shard *shard = (Shard *)userdata;
+    if (!shard || !(events & OV_EVENT_IO_IN))
+        return true;
+
+    uint8_t value[64];
+
+    while (0 < recv(socket, value, sizeof(value), 0))
+        ;
+
+    shard_process_inbox(shard);
+
+    if ((atomic_load(&shard->waiting) > 0) ||
+        !atomic_load(&shard->sharded->running))
+        shard->loop->stop(shard->loop);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool shard_foreign(void *userdata, uint8_t *buffer, size_t size,
+                          const ov_socket_data *remote) {
+
+    Shard *shard = (Shard *)userdata;
+    ov_ice_proxy_sharded *self = shard->sharded;
+
+    int owner = route_packet(self, buffer, size, remote);
+
+    if ((owner < 0) || (owner == shard->id))
+        return false;
+
+    Packet *packet = packet_create(PACKET_EXTERNAL, buffer, size);
+    if (!packet)
+        return false;
+
+    packet->remote = *remote;
+    return shard_post(&self->shard[owner], packet);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *shard_run(void *arg) {
+
+    Shard *shard = (Shard *)arg;
+
+    while (atomic_load(&shard->sharded->running)) {
+
+        pthread_mutex_lock(&shard->lock);
+        shard->loop->run(shard->loop, IMPL_SHARD_RUN_USEC);
+        pthread_mutex_unlock(&shard->lock);
+
+        /* let the control thread take the shard */
+        while (atomic_load(&shard->waiting) > 0)
+            sched_yield();
+    }
+
+    return NULL;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #event FUNCTIONS
+ *
+ *      Callbacks of the shards are passed to the control thread.
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static void event_post(ov_ice_proxy_sharded *self, Event *event) {
+
+    event->next = NULL;
+
+    pthread_mutex_lock(&self->events.lock);
+
+    if (self->events.tail) {
+        self->events.tail->next = event;
+    } else {
+        self->events.head = event;
+    }
+
+    self->events.tail = event;
+
+    pthread_mutex_unlock(&self->events.lock);
+
+    uint8_t value = 1;
+    ssize_t out = send(self->events.wakeup[1], &value, sizeof(value), 0);
+    UNUSED(out);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Event *event_create(EventType type, const char *session_id) {
+
+    Event *event = calloc(1, sizeof(Event));
+    if (!event)
+        return NULL;
+
+    event->type = type;
+
+    if (session_id)
+        ov_id_set(event->session_id, session_id);
+
+    return event;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void event_process(ov_ice_proxy_sharded *self, Event *event) {
+
+    ov_ice_proxy_generic_config *config = &self->public.config;
+
+    switch (event->type) {
+
+    case EVENT_SESSION_DROP: {
+
+        Shard *shard = ov_dict_remove(self->sessions, event->session_id);
+
+        if (shard && (shard->sessions > 0))
+            shard->sessions--;
+
+        if (config->callbacks.session.drop)
+            config->callbacks.session.drop(config->callbacks.userdata,
+                                           event->session_id);
+
+    } break;
+
+    case EVENT_SESSION_STATE:
+
+        if (config->callbacks.session.state)
+            config->callbacks.session.state(config->callbacks.userdata,
+                                            event->session_id, event->state);
+        break;
+
+    case EVENT_CANDIDATE:
+
+        if (config->callbacks.candidate.send) {
+
+            config->callbacks.candidate.send(config->callbacks.userdata,
+                                             event->candidate);
+
+        } else {
+
+            ov_json_value_free(event->candidate);
+        }
+
+        event->candidate = NULL;
+        break;
+
+    case EVENT_END_OF_CANDIDATES:
+
+        if (config->callbacks.candidate.end_of_candidates)
+            config->callbacks.candidate.end_of_candidates(
+                config->callbacks.userdata, event->session_id);
+        break;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool io_events(int socket, uint8_t events, void *userdata) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(userdata);
+    if (!self || !(events & OV_EVENT_IO_IN))
+        return true;
+
+    uint8_t value[64];
+
+    while (0 < recv(socket, value, sizeof(value), 0))
+        ;
+
+    pthread_mutex_lock(&self->events.lock);
+
+    Event *event = self->events.head;
+    self->events.head = NULL;
+    self->events.tail = NULL;
+
+    pthread_mutex_unlock(&self->events.lock);
+
+    while (event) {
+
+        Event *next = event->next;
+
+        event_process(self, event);
+
+        event->candidate = ov_json_value_free(event->candidate);
+        free(event);
+
+        event = next;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void cb_session_drop(void *userdata, const char *uuid) {
+
+    Shard *shard = (Shard *)userdata;
+    Event *event = event_create(EVENT_SESSION_DROP, uuid);
+
+    if (event)
+        event_post(shard->sharded, event);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void cb_session_state(void *userdata, const char *uuid,
+                             ov_ice_proxy_generic_state state) {
+
+    Shard *shard = (Shard *)userdata;
+    Event *event = event_create(EVENT_SESSION_STATE, uuid);
+
+    if (!event)
+        return;
+
+    event->state = state;
+    event_post(shard->sharded, event);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool cb_candidate_send(void *userdata, ov_json_value *out) {
+
+    Shard *shard = (Shard *)userdata;
+    Event *event = event_create(EVENT_CANDIDATE, NULL);
+
+    if (!event) {
+        ov_json_value_free(out);
+        return false;
+    }
+
+    event->candidate = out;
+    event_post(shard->sharded, event);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void cb_end_of_candidates(void *userdata, const char *session_id) {
+
+    Shard *shard = (Shard *)userdata;
+    Event *event = event_create(EVENT_END_OF_CANDIDATES, session_id);
+
+    if (event)
+        event_post(shard->sharded, event);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void cb_stream_io(void *userdata, const char *session_id,
+                         int stream_id, uint8_t *buffer, size_t size) {
+
+    Shard *shard = (Shard *)userdata;
+    ov_ice_proxy_generic_config *config = &shard->sharded->public.config;
+
+    if (config->callbacks.stream.io)
+        config->callbacks.stream.io(config->callbacks.userdata, session_id,
+                                    stream_id, buffer, size);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void cb_stream_io_handle(void *userdata, uint32_t handle,
+                                int stream_id, uint8_t *buffer, size_t size) {
+
+    Shard *shard = (Shard *)userdata;
+    ov_ice_proxy_generic_config *config = &shard->sharded->public.config;
+
+    if (config->callbacks.stream.io_handle)
+        config->callbacks.stream.io_handle(config->callbacks.userdata, handle,
+                                           stream_id, buffer, size);
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      #generic FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static Shard *shard_of_session(ov_ice_proxy_sharded *self,
+                               const char *session_id) {
+
+    if (!self || !session_id)
+        return NULL;
+
+    return ov_dict_get(self->sessions, session_id);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static const char *sharded_session_create(ov_ice_proxy_generic *generic,
+                                          ov_sdp_session *sdp) {
+
+    char *key = NULL;
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+    if (!self || !sdp)
+        goto error;
+
+    Shard *shard = &self->shard[0];
+
+    for (size_t i = 1; i < self->count; i++) {
+
+        if (self->shard[i].sessions < shard->sessions)
+            shard = &self->shard[i];
+    }
+
+    shard_lock(shard);
+
+    const char *id = ov_ice_proxy_generic_create_session(shard->proxy, sdp);
+    if (id)
+        key = ov_string_dup(id);
+
+    shard_unlock(shard);
+
+    if (!key)
+        goto error;
+
+    if (!ov_dict_set(self->sessions, key, shard, NULL))
+        goto error;
+
+    shard->sessions++;
+
+    /* the key remains valid until the drop of the session is processed */
+    return key;
+
+error:
+    key = ov_data_pointer_free(key);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool sharded_session_drop(ov_ice_proxy_generic *generic,
+                                 const char *session_id) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard)
+        return false;
+
+    shard_lock(shard);
+    bool result = ov_ice_proxy_generic_drop_session(shard->proxy, session_id);
+    shard_unlock(shard);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool sharded_session_update(ov_ice_proxy_generic *generic,
+                                   const char *session_id,
+                                   const ov_sdp_session *sdp) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard)
+        return false;
+
+    shard_lock(shard);
+    bool result =
+        ov_ice_proxy_generic_update_session(shard->proxy, session_id, sdp);
+    shard_unlock(shard);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool sharded_session_set_handle(ov_ice_proxy_generic *generic,
+                                       const char *session_id,
+                                       uint32_t handle) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard)
+        return false;
+
+    shard_lock(shard);
+    bool result = ov_ice_proxy_generic_session_set_handle(
+        shard->proxy, session_id, handle);
+    shard_unlock(shard);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool sharded_candidate_in(ov_ice_proxy_generic *generic,
+                                 const char *session_id, uint32_t stream_id,
+                                 const ov_ice_candidate *candidate) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard)
+        return false;
+
+    shard_lock(shard);
+    bool result = ov_ice_proxy_generic_stream_candidate_in(
+        shard->proxy, session_id, stream_id, candidate);
+    shard_unlock(shard);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool sharded_end_of_candidates_in(ov_ice_proxy_generic *generic,
+                                         const char *session_id,
+                                         uint32_t stream_id) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard)
+        return false;
+
+    shard_lock(shard);
+    bool result = ov_ice_proxy_generic_stream_end_of_candidates_in(
+        shard->proxy, session_id, stream_id);
+    shard_unlock(shard);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t sharded_get_ssrc(ov_ice_proxy_generic *generic,
+                                 const char *session_id, uint32_t stream_id) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard)
+        return 0;
+
+    shard_lock(shard);
+    uint32_t ssrc = ov_ice_proxy_generic_stream_get_ssrc(
+        shard->proxy, session_id, stream_id);
+    shard_unlock(shard);
+
+    return ssrc;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ssize_t sharded_send(ov_ice_proxy_generic *generic,
+                            const char *session_id, uint32_t stream_id,
+                            uint8_t *buffer, size_t size) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+
+    Shard *shard = shard_of_session(self, session_id);
+    if (!shard || !buffer || !size)
+        return -1;
+
+    /* SRTP protect and send are done within the shard */
+
+    Packet *packet = packet_create(PACKET_MEDIA, buffer, size);
+    if (!packet)
+        return -1;
+
+    ov_id_set(packet->session_id, session_id);
+    packet->stream_id = stream_id;
+
+    if (!shard_post(shard, packet))
+        return -1;
+
+    return size;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void shard_clear(Shard *shard) {
+
+    shard->proxy = ov_ice_proxy_generic_free(shard->proxy);
+
+    if (shard->loop && (-1 != shard->wakeup[0]))
+        ov_event_loop_unset(shard->loop, shard->wakeup[0], NULL);
+
+    shard->loop = ov_event_loop_free(shard->loop);
+
+    if (-1 != shard->wakeup[0]) {
+        close(shard->wakeup[0]);
+        shard->wakeup[0] = -1;
+    }
+
+    if (-1 != shard->wakeup[1]) {
+        close(shard->wakeup[1]);
+        shard->wakeup[1] = -1;
+    }
+
+    Packet *packet = shard->inbox.head;
+
+    while (packet) {
+        Packet *next = packet->next;
+        free(packet);
+        packet = next;
+    }
+
+    shard->inbox.head = NULL;
+    shard->inbox.tail = NULL;
+
+    pthread_mutex_destroy(&shard->inbox.lock);
+    pthread_mutex_destroy(&shard->lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_ice_proxy_generic *sharded_free(ov_ice_proxy_generic *generic) {
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+    if (!self)
+        return generic;
+
+    atomic_store(&self->running, false);
+
+    for (size_t i = 0; i < self->count; i++) {
+
+        Shard *shard = &self->shard[i];
+
+        if (!shard->started)
+            continue;
+
+        shard_wakeup(shard);
+        pthread_join(shard->thread, NULL);
+        shard->started = false;
+    }
+
+    for (size_t i = 0; i < self->count; i++) {
+        shard_clear(&self->shard[i]);
+    }
+
+    self->shard = ov_data_pointer_free(self->shard);
+
+    ov_event_loop *loop = self->config.proxy.loop;
+
+    if (OV_TIMER_INVALID != self->routes.timer) {
+        ov_event_loop_timer_unset(loop, self->routes.timer, NULL);
+        self->routes.timer = OV_TIMER_INVALID;
+    }
+
+    if (-1 != self->events.wakeup[0]) {
+        ov_event_loop_unset(loop, self->events.wakeup[0], NULL);
+        close(self->events.wakeup[0]);
+        self->events.wakeup[0] = -1;
+    }
+
+    if (-1 != self->events.wakeup[1]) {
+        close(self->events.wakeup[1]);
+        self->events.wakeup[1] = -1;
+    }
+
+    Event *event = self->events.head;
+
+    while (event) {
+        Event *next = event->next;
+        ov_json_value_free(event->candidate);
+        free(event);
+        event = next;
+    }
+
+    self->sessions = ov_dict_free(self->sessions);
+    self->routes.map = ov_expiring_map_free(self->routes.map);
+
+    pthread_rwlock_destroy(&self->routes.lock);
+    pthread_mutex_destroy(&self->events.lock);
+
+    self = ov_data_pointer_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool shard_init(ov_ice_proxy_sharded *self, Shard *shard, uint8_t id) {
+
+    shard->id = id;
+    shard->sharded = self;
+    shard->wakeup[0] = -1;
+    shard->wakeup[1] = -1;
+
+    pthread_mutex_init(&shard->lock, NULL);
+    pthread_mutex_init(&shard->inbox.lock, NULL);
+
+    shard->loop = self->config.loop.create(self->config.loop.config);
+    if (!shard->loop)
+        goto error;
+
+    if (0 != socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0,
+                        shard->wakeup))
+        goto error;
+
+    if (!ov_event_loop_set(shard->loop, shard->wakeup[0],
+                           OV_EVENT_IO_IN | OV_EVENT_IO_ERR, shard,
+                           shard_io_wakeup))
+        goto error;
+
+    ov_ice_proxy_generic_config config = self->config.proxy;
+
+    config.loop = shard->loop;
+    config.callbacks.userdata = shard;
+    config.callbacks.session.drop = cb_session_drop;
+    config.callbacks.session.state = cb_session_state;
+    config.callbacks.stream.io = cb_stream_io;
+    config.callbacks.stream.io_handle = cb_stream_io_handle;
+    config.callbacks.candidate.send = cb_candidate_send;
+    config.callbacks.candidate.end_of_candidates = cb_end_of_candidates;
+
+    shard->proxy = ov_ice_proxy_multiplexing_create_shard(
+        config, (ov_ice_proxy_multiplexing_shard){
+                    .id = id, .userdata = shard, .foreign = shard_foreign});
+
+    if (!shard->proxy)
+        goto error;
+
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_ice_proxy_generic *
+ov_ice_proxy_sharded_create(ov_ice_proxy_sharded_config config) {
+
+    ov_ice_proxy_sharded *self = NULL;
+
+    if (!ov_ptr_valid(config.proxy.loop,
+                      "Cannot create sharded ICE proxy - no loop"))
+        goto error;
+
+    if (!ov_cond_valid((config.threads > 0) &&
+                           (config.threads <=
+                            OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX),
+                       "Cannot create sharded ICE proxy - threads invalid"))
+        goto error;
+
+    /* all shards MUST bind the same port */
+    if (!ov_cond_valid(0 != config.proxy.external.port,
+                       "Cannot create sharded ICE proxy - no external port"))
+        goto error;
+
+    if (!config.loop.create)
+        config.loop.create = ov_event_loop_default;
+
+    if (0 == config.loop.config.max.sockets)
+        config.loop.config.max.sockets =
+            ov_socket_get_max_supported_runtime_sockets(0);
+
+    if (0 == config.loop.config.max.timers)
+        config.loop.config.max.timers =
+            ov_socket_get_max_supported_runtime_sockets(0);
+
+    self = calloc(1, sizeof(ov_ice_proxy_sharded));
+    if (!self)
+        goto error;
+
+    self->public.magic_bytes = OV_ICE_PROXY_GENERIC_MAGIC_BYTES;
+    self->public.type = OV_ICE_PROXY_SHARDED_MAGIC_BYTES;
+    self->public.config = config.proxy;
+    self->config = config;
+    self->events.wakeup[0] = -1;
+    self->events.wakeup[1] = -1;
+
+    atomic_store(&self->running, true);
+
+    pthread_rwlock_init(&self->routes.lock, NULL);
+    pthread_mutex_init(&self->events.lock, NULL);
+
+    ov_dict_config d_config = ov_dict_string_key_config(255);
+    self->sessions = ov_dict_create(d_config);
+    if (!self->sessions)
+        goto error;
+
+    self->routes.map = ov_expiring_map_create((ov_expiring_map_config){
+        .wheel.resolution_usec = IMPL_ROUTE_RESOLUTION_USEC});
+
+    if (!self->routes.map)
+        goto error;
+
+    self->routes.timer = ov_event_loop_timer_set(
+        config.proxy.loop, IMPL_ROUTE_RESOLUTION_USEC, self,
+        invalidate_routes);
+
+    if (OV_TIMER_INVALID == self->routes.timer)
+        goto error;
+
+    if (0 != socketpair(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK, 0,
+                        self->events.wakeup))
+        goto error;
+
+    if (!ov_event_loop_set(config.proxy.loop, self->events.wakeup[0],
+                           OV_EVENT_IO_IN | OV_EVENT_IO_ERR, self, io_events))
+        goto error;
+
+    self->shard = calloc(config.threads, sizeof(Shard));
+    if (!self->shard)
+        goto error;
+
+    for (size_t i = 0; i < config.threads; i++) {
+
+        self->count++;
+
+        if (!shard_init(self, &self->shard[i], i))
+            goto error;
+    }
+
+    for (size_t i = 0; i < self->count; i++) {
+
+        Shard *shard = &self->shard[i];
+
+        if (0 != pthread_create(&shard->thread, NULL, shard_run, shard))
+            goto error;
+
+        shard->started = true;
+    }
+
+    self->public.free = sharded_free;
+
+    self->public.session.create = sharded_session_create;
+    self->public.session.drop = sharded_session_drop;
+    self->public.session.update = sharded_session_update;
+    self->public.session.set_handle = sharded_session_set_handle;
+
+    self->public.stream.candidate_in = sharded_candidate_in;
+    self->public.stream.end_of_candidates_in = sharded_end_of_candidates_in;
+    self->public.stream.get_ssrc = sharded_get_ssrc;
+    self->public.stream.send = sharded_send;
+
+    ov_log_info("ICE proxy sharded over %zu threads at %s:%i", self->count,
+                config.proxy.external.host, config.proxy.external.port);
+
+    return ov_ice_proxy_generic_cast(self);
+error:
+    sharded_free(ov_ice_proxy_generic_cast(self));
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_ice_proxy_sharded_stats
+ov_ice_proxy_sharded_get_stats(const ov_ice_proxy_generic *generic) {
+
+    ov_ice_proxy_sharded_stats stats = {0};
+
+    ov_ice_proxy_sharded *self = as_ice_proxy_sharded(generic);
+    if (!self)
+        return stats;
+
+    stats.threads = self->count;
+
+    for (size_t i = 0; i < self->count; i++) {
+
+        stats.shard[i].sessions = self->shard[i].sessions;
+        stats.shard[i].received = atomic_load(&self->shard[i].received);
+        stats.shard[i].handshake =
+            ov_ice_proxy_multiplexing_handshake_stats(self->shard[i].proxy);
+    }
+
+    return stats;
+}
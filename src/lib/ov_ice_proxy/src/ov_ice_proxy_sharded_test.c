@@ -0,0 +1,1054 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_ice_proxy_sharded_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_ice_proxy_sharded.c"
+#include <ov_test/testrun.h>
+
+#include <openssl/ssl.h>
+#include <srtp2/srtp.h>
+
+#include <ov_base/ov_event_loop.h>
+#include <ov_base/ov_sdp_attribute.h>
+#include <ov_ice/ov_ice_string.h>
+#include <ov_stun/ov_stun_attributes_rfc5245.h>
+#include <ov_stun/ov_stun_binding.h>
+#include <ov_stun/ov_stun_fingerprint.h>
+#include <ov_stun/ov_stun_message_integrity.h>
+#include <ov_stun/ov_stun_xor_mapped_address.h>
+
+#define TEST_PACKET_SIZE 172 // opus 20ms frame + RTP header + SRTP tag
+#define TEST_CLIENTS 64
+#define TEST_PACKETS 50
+#define TEST_SHARDS 4
+
+#define TEST_SRTP_PROFILE "SRTP_AES128_CM_SHA1_80"
+#define TEST_SRTP_TAG 10
+#define TEST_PAYLOAD_TYPE 100
+#define TEST_PTIME_USEC 20000 // send interval of some 20ms frame
+#define TEST_LOAD_TIMEOUT_USEC (20 * 1000 * 1000)
+
+/*----------------------------------------------------------------------------*/
+
+static size_t stun_frame(uint8_t *buffer, size_t size, bool request,
+                         uint8_t transaction, const char *username) {
+
+    memset(buffer, 0, size);
+
+    uint8_t transaction_id[12] = {transaction, 1, 2, 3, 4, 5,
+                                  6,           7, 8, 9, 10, 11};
+
+    size_t len = 20;
+    uint8_t *next = buffer + 20;
+
+    if (username) {
+
+        if (!ov_stun_username_encode(buffer + 20, size - 20, &next,
+                                     (uint8_t *)username, strlen(username)))
+            return 0;
+
+        len = next - buffer;
+    }
+
+    if (request) {
+        ov_stun_frame_set_request(buffer, len);
+    } else {
+        ov_stun_frame_set_success_response(buffer, len);
+    }
+
+    ov_stun_frame_set_method(buffer, len, STUN_BINDING);
+    ov_stun_frame_set_magic_cookie(buffer, len);
+    ov_stun_frame_set_transaction_id(buffer, len, transaction_id);
+    ov_stun_frame_set_length(buffer, len, len - 20);
+
+    return len;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_ice_proxy_sharded *routing_create(size_t count) {
+
+    ov_ice_proxy_sharded *self = calloc(1, sizeof(ov_ice_proxy_sharded));
+    if (!self)
+        return NULL;
+
+    self->public.magic_bytes = OV_ICE_PROXY_GENERIC_MAGIC_BYTES;
+    self->public.type = OV_ICE_PROXY_SHARDED_MAGIC_BYTES;
+    self->count = count;
+
+    pthread_rwlock_init(&self->routes.lock, NULL);
+
+    self->routes.map = ov_expiring_map_create((ov_expiring_map_config){
+        .wheel.resolution_usec = IMPL_ROUTE_RESOLUTION_USEC});
+
+    return self;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *routing_free(ov_ice_proxy_sharded *self) {
+
+    if (!self)
+        return NULL;
+
+    self->routes.map = ov_expiring_map_free(self->routes.map);
+    pthread_rwlock_destroy(&self->routes.lock);
+    free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static const char *load_offer = "v=0\r\n"
+                                "o=- 0 0 IN IP4 0.0.0.0\r\n"
+                                "s=-\r\n"
+                                "t=0 0\r\n"
+                                "m=audio 9 UDP/TLS/RTP/SAVPF 100\r\n"
+                                "a=rtpmap:100 opus/48000/2\r\n";
+
+/*----------------------------------------------------------------------------*/
+
+static const char *load_answer =
+    "v=0\r\n"
+    "o=- 1 1 IN IP4 127.0.0.1\r\n"
+    "s=-\r\n"
+    "t=0 0\r\n"
+    "a=ice-options:trickle\r\n"
+    "m=audio 9 UDP/TLS/RTP/SAVPF 100\r\n"
+    "c=IN IP4 127.0.0.1\r\n"
+    "a=ice-ufrag:%s\r\n"
+    "a=ice-pwd:%s\r\n"
+    "a=fingerprint:sha-256 "
+    "7B:8B:F0:65:5F:78:E2:51:3B:AC:6F:F3:3F:46:1B:35:"
+    "DC:B8:5F:64:1A:24:C2:43:F0:A1:58:D0:A1:2C:19:08\r\n"
+    "a=setup:active\r\n"
+    "a=rtcp-mux\r\n"
+    "a=ssrc:%" PRIu32 " cname:%s\r\n"
+    "a=candidate:1 1 udp 2122260223 127.0.0.1 %" PRIu16 " typ host\r\n"
+    "a=rtpmap:100 opus/48000/2\r\n";
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct LoadTest LoadTest;
+
+typedef struct {
+
+    LoadTest *test;
+
+    int socket;
+    uint16_t port;
+    uint32_t ssrc;
+    uint16_t sequence;
+
+    char ufrag[8];
+    char pass[32];
+
+    struct {
+
+        char ufrag[64];
+        char pass[64];
+
+    } proxy;
+
+    ov_id session;
+    bool completed;
+
+    /* DTLS client, started with the first check of the proxy */
+    bool checked;
+    SSL *ssl;
+    BIO *read;
+    BIO *write;
+
+    srtp_t srtp;
+    uint8_t key[OV_DTLS_KEY_MAX + OV_DTLS_SALT_MAX];
+
+} LoadClient;
+
+struct LoadTest {
+
+    struct sockaddr_in proxy;
+
+    size_t completed;
+    _Atomic uint64_t received;
+
+    LoadClient client[TEST_CLIENTS];
+};
+
+/*----------------------------------------------------------------------------*/
+
+static void load_session_state(void *userdata, const char *uuid,
+                               ov_ice_proxy_generic_state state) {
+
+    LoadTest *test = (LoadTest *)userdata;
+
+    if (OV_ICE_PROXY_GENERIC_COMPLETED != state)
+        return;
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+
+        LoadClient *client = &test->client[i];
+
+        if (client->completed || !ov_id_match(client->session, uuid))
+            continue;
+
+        client->completed = true;
+        test->completed++;
+        return;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_stream_io(void *userdata, const char *session_id,
+                           int stream_id, uint8_t *buffer, size_t size) {
+
+    UNUSED(session_id);
+    UNUSED(stream_id);
+    UNUSED(buffer);
+    UNUSED(size);
+
+    /* called within the threads of the shards */
+    LoadTest *test = (LoadTest *)userdata;
+    atomic_fetch_add(&test->received, 1);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ssize_t load_client_send(LoadClient *client, const uint8_t *buffer,
+                                size_t size) {
+
+    return sendto(client->socket, buffer, size, 0,
+                  (struct sockaddr *)&client->test->proxy,
+                  sizeof(client->test->proxy));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_stun(LoadClient *client, const uint8_t *buffer,
+                             size_t size,
+                             const struct sockaddr_storage *remote) {
+
+    uint8_t out[OV_UDP_PAYLOAD_OCTETS] = {0};
+
+    if (!ov_stun_frame_is_valid(buffer, size) ||
+        !ov_stun_frame_has_magic_cookie(buffer, size) ||
+        !ov_stun_method_is_binding(buffer, size) ||
+        !ov_stun_frame_class_is_request(buffer, size))
+        goto error;
+
+    /* Answer the checks of the controlling proxy, XOR-MAPPED-ADDRESS is
+     * the external address of the proxy, so the pair is no peer reflexive
+     * one. */
+
+    size_t size_out = 20 + ov_stun_xor_mapped_address_encoding_length(remote) +
+                      ov_stun_message_integrity_encoding_length() +
+                      ov_stun_fingerprint_encoding_length();
+
+    if (size_out > OV_UDP_PAYLOAD_OCTETS)
+        goto error;
+
+    uint8_t *ptr = out + 20;
+
+    if (!ov_stun_frame_set_success_response(out, size_out) ||
+        !ov_stun_frame_set_method(out, size_out, STUN_BINDING) ||
+        !ov_stun_frame_set_magic_cookie(out, size_out) ||
+        !ov_stun_frame_set_length(out, size_out, size_out - 20) ||
+        !ov_stun_frame_set_transaction_id(
+            out, size_out, ov_stun_frame_get_transaction_id(buffer, size)))
+        goto error;
+
+    if (!ov_stun_xor_mapped_address_encode(ptr, size_out - (ptr - out), out,
+                                           &ptr, remote))
+        goto error;
+
+    if (!ov_stun_add_message_integrity(out, size_out, ptr, &ptr,
+                                       (uint8_t *)client->pass,
+                                       strlen(client->pass)))
+        goto error;
+
+    if (!ov_stun_add_fingerprint(out, size_out, ptr, &ptr))
+        goto error;
+
+    client->checked = true;
+    return 0 < load_client_send(client, out, ptr - out);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_check(LoadClient *client) {
+
+    uint8_t out[OV_UDP_PAYLOAD_OCTETS] = {0};
+    uint8_t transaction_id[12] = {0};
+    char username[OV_UDP_PAYLOAD_OCTETS] = {0};
+
+    /* The proxy starts to check the pairs of some session with the first
+     * valid request of the remote, as browsers send them. */
+
+    if (!snprintf(username, sizeof(username), "%s:%s", client->proxy.ufrag,
+                  client->ufrag))
+        goto error;
+
+    size_t size_out =
+        20 + ov_stun_ice_controlled_encoding_length() +
+        ov_stun_ice_priority_encoding_length() +
+        ov_stun_username_encoding_length((uint8_t *)username,
+                                         strlen(username)) +
+        ov_stun_message_integrity_encoding_length() +
+        ov_stun_fingerprint_encoding_length();
+
+    if (size_out > OV_UDP_PAYLOAD_OCTETS)
+        goto error;
+
+    uint8_t *ptr = out + 20;
+
+    if (!ov_stun_frame_generate_transaction_id(transaction_id) ||
+        !ov_stun_frame_set_request(out, size_out) ||
+        !ov_stun_frame_set_method(out, size_out, STUN_BINDING) ||
+        !ov_stun_frame_set_magic_cookie(out, size_out) ||
+        !ov_stun_frame_set_length(out, size_out, size_out - 20) ||
+        !ov_stun_frame_set_transaction_id(out, size_out, transaction_id))
+        goto error;
+
+    if (!ov_stun_ice_controlled_encode(ptr, size_out - (ptr - out), &ptr,
+                                       client->ssrc) ||
+        !ov_stun_ice_priority_encode(ptr, size_out - (ptr - out), &ptr,
+                                     2122260223) ||
+        !ov_stun_username_encode(ptr, size_out - (ptr - out), &ptr,
+                                 (uint8_t *)username, strlen(username)))
+        goto error;
+
+    if (!ov_stun_add_message_integrity(out, size_out, ptr, &ptr,
+                                       (uint8_t *)client->proxy.pass,
+                                       strlen(client->proxy.pass)))
+        goto error;
+
+    if (!ov_stun_add_fingerprint(out, size_out, ptr, &ptr))
+        goto error;
+
+    return 0 < load_client_send(client, out, ptr - out);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_srtp(LoadClient *client) {
+
+    ov_dtls_srtp_keys keys = {0};
+    srtp_policy_t policy = {0};
+
+    if (!ov_dtls_srtp_keys_export(client->ssl, &keys))
+        goto error;
+
+    if (0 != strcmp(keys.profile, TEST_SRTP_PROFILE))
+        goto error;
+
+    /* The client protects with the client key, the proxy is DTLS server */
+
+    memcpy(client->key, keys.client.key, keys.key_len);
+    srtp_append_salt_to_key(client->key, keys.key_len, keys.client.salt,
+                            keys.salt_len);
+
+    srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtp);
+    srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtcp);
+
+    policy.ssrc.type = ssrc_specific;
+    policy.ssrc.value = client->ssrc;
+    policy.key = client->key;
+    policy.next = NULL;
+
+    return srtp_err_status_ok == srtp_create(&client->srtp, &policy);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_client_pump(LoadClient *client) {
+
+    uint8_t buffer[OV_UDP_PAYLOAD_OCTETS];
+
+    if (!client->checked || client->srtp)
+        return;
+
+    if (!SSL_is_init_finished(client->ssl)) {
+
+        DTLSv1_handle_timeout(client->ssl);
+        SSL_do_handshake(client->ssl);
+    }
+
+    while (BIO_ctrl_pending(client->write) > 0) {
+
+        int bytes = BIO_read(client->write, buffer, sizeof(buffer));
+        if (bytes <= 0)
+            break;
+
+        load_client_send(client, buffer, bytes);
+    }
+
+    if (SSL_is_init_finished(client->ssl))
+        load_client_srtp(client);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_io(int socket, uint8_t events, void *userdata) {
+
+    uint8_t buffer[OV_UDP_PAYLOAD_OCTETS] = {0};
+    struct sockaddr_storage remote = {0};
+    socklen_t remote_len = sizeof(remote);
+
+    LoadClient *client = (LoadClient *)userdata;
+
+    if (!(events & OV_EVENT_IO_IN))
+        return true;
+
+    ssize_t bytes = recvfrom(socket, buffer, sizeof(buffer), 0,
+                             (struct sockaddr *)&remote, &remote_len);
+
+    if (bytes < 1)
+        return true;
+
+    if (buffer[0] <= 3) {
+
+        load_client_stun(client, buffer, bytes, &remote);
+
+    } else if ((buffer[0] >= 20) && (buffer[0] <= 63)) {
+
+        BIO_write(client->read, buffer, bytes);
+    }
+
+    load_client_pump(client);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_init(LoadClient *client, LoadTest *test,
+                             SSL_CTX *ctx, ov_event_loop *loop, size_t i) {
+
+    *client = (LoadClient){.test = test, .socket = -1};
+
+    struct sockaddr_in sa = {.sin_family = AF_INET,
+                             .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+
+    socklen_t sa_len = sizeof(sa);
+
+    client->socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (-1 == client->socket)
+        goto error;
+
+    if ((0 != bind(client->socket, (struct sockaddr *)&sa, sizeof(sa))) ||
+        (0 != getsockname(client->socket, (struct sockaddr *)&sa, &sa_len)) ||
+        !ov_socket_ensure_nonblocking(client->socket))
+        goto error;
+
+    client->port = ntohs(sa.sin_port);
+    client->ssrc = 0x10000 + i;
+
+    snprintf(client->ufrag, sizeof(client->ufrag), "c%04zu", i);
+    snprintf(client->pass, sizeof(client->pass),
+             "loadtestpassword%08zu", i);
+
+    client->ssl = SSL_new(ctx);
+    client->read = BIO_new(BIO_s_mem());
+    client->write = BIO_new(BIO_s_mem());
+
+    if (!client->ssl || !client->read || !client->write)
+        goto error;
+
+    BIO_set_mem_eof_return(client->read, -1);
+    BIO_set_mem_eof_return(client->write, -1);
+
+    SSL_set_bio(client->ssl, client->read, client->write);
+    SSL_set_connect_state(client->ssl);
+    SSL_set_options(client->ssl, SSL_OP_NO_QUERY_MTU);
+    DTLS_set_link_mtu(client->ssl, 1400);
+
+    return ov_event_loop_set(loop, client->socket,
+                             OV_EVENT_IO_IN | OV_EVENT_IO_ERR |
+                                 OV_EVENT_IO_CLOSE,
+                             client, load_client_io);
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_client_clear(LoadClient *client, ov_event_loop *loop) {
+
+    if (-1 != client->socket) {
+
+        ov_event_loop_unset(loop, client->socket, NULL);
+        close(client->socket);
+    }
+
+    if (client->srtp)
+        srtp_dealloc(client->srtp);
+
+    /* frees the BIOs too */
+    if (client->ssl)
+        SSL_free(client->ssl);
+
+    *client = (LoadClient){.socket = -1};
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_connect(LoadClient *client,
+                                ov_ice_proxy_generic *proxy) {
+
+    char answer[OV_UDP_PAYLOAD_OCTETS] = {0};
+    ov_sdp_session *sdp = NULL;
+
+    sdp = ov_sdp_parse(load_offer, strlen(load_offer));
+    if (!sdp)
+        goto error;
+
+    const char *id = ov_ice_proxy_generic_create_session(proxy, sdp);
+    if (!id || !ov_id_set(client->session, id))
+        goto error;
+
+    const char *ufrag =
+        ov_sdp_attribute_get(sdp->description->attributes, OV_ICE_STRING_USER);
+
+    const char *pass =
+        ov_sdp_attribute_get(sdp->description->attributes, OV_ICE_STRING_PASS);
+
+    if (!ufrag || !pass || (strlen(ufrag) >= sizeof(client->proxy.ufrag)) ||
+        (strlen(pass) >= sizeof(client->proxy.pass)))
+        goto error;
+
+    strcpy(client->proxy.ufrag, ufrag);
+    strcpy(client->proxy.pass, pass);
+
+    sdp = ov_sdp_session_free(sdp);
+
+    if (!snprintf(answer, sizeof(answer), load_answer, client->ufrag,
+                  client->pass, client->ssrc, client->ufrag, client->port))
+        goto error;
+
+    sdp = ov_sdp_parse(answer, strlen(answer));
+    if (!sdp)
+        goto error;
+
+    if (!ov_ice_proxy_generic_update_session(proxy, client->session, sdp))
+        goto error;
+
+    sdp = ov_sdp_session_free(sdp);
+    return true;
+error:
+    ov_sdp_session_free(sdp);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool load_client_send_rtp(LoadClient *client, uint32_t timestamp) {
+
+    uint8_t packet[TEST_PACKET_SIZE] = {0};
+    int length = TEST_PACKET_SIZE - TEST_SRTP_TAG;
+
+    uint16_t sequence = htons(client->sequence++);
+    uint32_t ts = htonl(timestamp);
+    uint32_t ssrc = htonl(client->ssrc);
+
+    packet[0] = 0x80;
+    packet[1] = TEST_PAYLOAD_TYPE;
+    memcpy(packet + 2, &sequence, sizeof(sequence));
+    memcpy(packet + 4, &ts, sizeof(ts));
+    memcpy(packet + 8, &ssrc, sizeof(ssrc));
+
+    if (srtp_err_status_ok != srtp_protect(client->srtp, packet, &length))
+        return false;
+
+    return length == load_client_send(client, packet, length);
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CASES                                                      #CASES
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int test_ov_ice_proxy_sharded_create() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    testrun(loop);
+
+    ov_ice_proxy_sharded_config config = {0};
+
+    testrun(!ov_ice_proxy_sharded_create(config));
+
+    config.proxy.loop = loop;
+    testrun(!ov_ice_proxy_sharded_create(config));
+
+    config.threads = OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX + 1;
+    config.proxy.external.port = 50000;
+    testrun(!ov_ice_proxy_sharded_create(config));
+
+    /* shards MUST share some fixed port */
+    config.threads = 2;
+    config.proxy.external.port = 0;
+    testrun(!ov_ice_proxy_sharded_create(config));
+
+    testrun(0 == ov_ice_proxy_sharded_get_stats(NULL).threads);
+    testrun(0 == ov_ice_proxy_multiplexing_handshake_stats(NULL).threads);
+
+    loop = ov_event_loop_free(loop);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_shard_encoding() {
+
+    testrun(-1 == ov_ice_proxy_multiplexing_shard_of_ufrag(NULL));
+    testrun(-1 == ov_ice_proxy_multiplexing_shard_of_ufrag("x123"));
+    testrun(0 == ov_ice_proxy_multiplexing_shard_of_ufrag("0123"));
+    testrun(9 == ov_ice_proxy_multiplexing_shard_of_ufrag("9abc"));
+    testrun(15 == ov_ice_proxy_multiplexing_shard_of_ufrag("f000"));
+
+    uint8_t transaction_id[12] = {0};
+
+    testrun(-1 == ov_ice_proxy_multiplexing_shard_of_transaction(NULL));
+    testrun(-1 ==
+            ov_ice_proxy_multiplexing_shard_of_transaction(transaction_id));
+
+    transaction_id[0] = 1;
+    testrun(0 ==
+            ov_ice_proxy_multiplexing_shard_of_transaction(transaction_id));
+
+    transaction_id[0] = OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX;
+    testrun(OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX - 1 ==
+            ov_ice_proxy_multiplexing_shard_of_transaction(transaction_id));
+
+    transaction_id[0] = OV_ICE_PROXY_MULTIPLEXING_SHARDS_MAX + 1;
+    testrun(-1 ==
+            ov_ice_proxy_multiplexing_shard_of_transaction(transaction_id));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_route_packet() {
+
+    uint8_t buffer[500] = {0};
+    uint8_t rtp[TEST_PACKET_SIZE] = {0x80, 100};
+
+    ov_socket_data remote = {.host = "192.168.1.1", .port = 12345};
+    ov_socket_data other = {.host = "192.168.1.2", .port = 12345};
+
+    ov_ice_proxy_sharded *self = routing_create(TEST_SHARDS);
+    testrun(self);
+
+    /* unknown remote */
+    testrun(-1 == route_packet(self, rtp, sizeof(rtp), &remote));
+
+    /* STUN request, local ufrag of shard 2 */
+    size_t len = stun_frame(buffer, sizeof(buffer), true, 0, "2abc:remote");
+    testrun(len > 20);
+    testrun(2 == route_packet(self, buffer, len, &remote));
+
+    /* remote learned for DTLS and SRTP */
+    testrun(2 == route_packet(self, rtp, sizeof(rtp), &remote));
+    testrun(-1 == route_packet(self, rtp, sizeof(rtp), &other));
+
+    /* STUN response to some check of shard 3 */
+    len = stun_frame(buffer, sizeof(buffer), false, 4, NULL);
+    testrun(len == 20);
+    testrun(3 == route_packet(self, buffer, len, &other));
+    testrun(3 == route_packet(self, rtp, sizeof(rtp), &other));
+
+    /* shard not running */
+    len = stun_frame(buffer, sizeof(buffer), true, 0, "fabc:remote");
+    testrun(-1 == route_packet(self, buffer, len, &remote));
+    testrun(2 == route_packet(self, rtp, sizeof(rtp), &remote));
+
+    /* request without USERNAME */
+    len = stun_frame(buffer, sizeof(buffer), true, 0, NULL);
+    testrun(-1 == route_packet(self, buffer, len, &remote));
+
+    /* routes expire */
+    testrun(2 == ov_expiring_map_count(self->routes.map));
+    ov_expiring_map_expire(self->routes.map,
+                           ov_time_get_current_time_usecs() +
+                               2 * IMPL_ROUTE_LIFETIME_USEC);
+    testrun(0 == ov_expiring_map_count(self->routes.map));
+    testrun(-1 == route_packet(self, rtp, sizeof(rtp), &remote));
+
+    self = routing_free(self);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_shard_distribution() {
+
+    /* Synthetic clients send SRTP sized packets to some SO_REUSEPORT
+     * group, as the shards do. Each packet is routed like within the
+     * receiving shard, to check the distribution of the kernel and the
+     * cost of the routing. */
+
+    ov_socket_configuration config = {
+        .host = "127.0.0.1", .type = UDP, .port = 0};
+
+    int shard[TEST_SHARDS] = {0};
+    int client[TEST_CLIENTS] = {0};
+    size_t received[TEST_SHARDS] = {0};
+
+    shard[0] = ov_socket_create_reuseport(config, NULL);
+    testrun(-1 != shard[0]);
+
+    ov_socket_data local = {0};
+    testrun(ov_socket_get_data(shard[0], &local, NULL));
+    config.port = local.port;
+
+    for (size_t i = 1; i < TEST_SHARDS; i++) {
+        shard[i] = ov_socket_create_reuseport(config, NULL);
+        testrun(-1 != shard[i]);
+    }
+
+    for (size_t i = 0; i < TEST_SHARDS; i++) {
+        testrun(ov_socket_ensure_nonblocking(shard[i]));
+    }
+
+    ov_ice_proxy_sharded *self = routing_create(TEST_SHARDS);
+    testrun(self);
+
+    struct sockaddr_in dest = {.sin_family = AF_INET,
+                               .sin_port = htons(config.port),
+                               .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+
+    uint8_t packet[TEST_PACKET_SIZE] = {0x80, 100};
+    uint8_t buffer[OV_UDP_PAYLOAD_OCTETS] = {0};
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+
+        client[i] = socket(AF_INET, SOCK_DGRAM, 0);
+        testrun(-1 != client[i]);
+
+        /* the client was assigned by some STUN request before */
+        ov_socket_data remote = {.host = "127.0.0.1"};
+        struct sockaddr_in sa = {.sin_family = AF_INET,
+                                 .sin_addr.s_addr = htonl(INADDR_LOOPBACK)};
+
+        testrun(0 == bind(client[i], (struct sockaddr *)&sa, sizeof(sa)));
+
+        socklen_t sa_len = sizeof(sa);
+        testrun(0 == getsockname(client[i], (struct sockaddr *)&sa, &sa_len));
+        remote.port = ntohs(sa.sin_port);
+
+        route_set(self, &remote, i % TEST_SHARDS);
+    }
+
+    size_t total = 0;
+    size_t foreign = 0;
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t p = 0; p < TEST_PACKETS; p++) {
+
+        for (size_t i = 0; i < TEST_CLIENTS; i++) {
+
+            testrun(sizeof(packet) ==
+                    sendto(client[i], packet, sizeof(packet), 0,
+                           (struct sockaddr *)&dest, sizeof(dest)));
+        }
+
+        for (size_t s = 0; s < TEST_SHARDS; s++) {
+
+            while (true) {
+
+                ov_socket_data remote = {0};
+                socklen_t sa_len = sizeof(remote.sa);
+
+                ssize_t bytes =
+                    recvfrom(shard[s], buffer, sizeof(buffer), 0,
+                             (struct sockaddr *)&remote.sa, &sa_len);
+
+                if (bytes < 1)
+                    break;
+
+                testrun(ov_socket_parse_sockaddr_storage(
+                    &remote.sa, remote.host, OV_HOST_NAME_MAX,
+                    &remote.port));
+
+                int owner = route_packet(self, buffer, bytes, &remote);
+                testrun(owner >= 0);
+
+                if (owner != (int)s)
+                    foreign++;
+
+                received[s]++;
+                total++;
+            }
+        }
+    }
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+
+    /* loopback UDP MAY drop some packets */
+    testrun(total > 0);
+
+    for (size_t s = 0; s < TEST_SHARDS; s++) {
+        fprintf(stdout, "shard %zu received %zu packets\n", s, received[s]);
+    }
+
+    fprintf(stdout,
+            "%zu packets of %i clients in %" PRIu64 " usec "
+            "(%.0f packets/s), %zu passed to other shards\n",
+            total, TEST_CLIENTS, usec,
+            usec ? (double)total * 1000000.0 / (double)usec : 0.0, foreign);
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+        close(client[i]);
+    }
+
+    for (size_t s = 0; s < TEST_SHARDS; s++) {
+        close(shard[s]);
+    }
+
+    self = routing_free(self);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_sharded_srtp_load() {
+
+    /* Synthetic clients run ICE, DTLS and SRTP against some sharded proxy,
+     * like ov_rtp_cli does against some real one, and stream SRTP sized
+     * frames afterwards. */
+
+    ov_event_loop *loop = ov_event_loop_default((ov_event_loop_config){
+        .max.sockets = 2 * TEST_CLIENTS + 100, .max.timers = 100});
+
+    testrun(loop);
+
+    ov_socket_configuration external = {
+        .host = "127.0.0.1", .type = UDP, .port = 0};
+
+    /* get some free port to be shared by the shards */
+    ov_socket_data local = {0};
+    int sd = ov_socket_create(external, false, NULL);
+    testrun(-1 != sd);
+    testrun(ov_socket_get_data(sd, &local, NULL));
+    close(sd);
+
+    external.port = local.port;
+
+    LoadTest *test = calloc(1, sizeof(LoadTest));
+    testrun(test);
+
+    test->proxy = (struct sockaddr_in){.sin_family = AF_INET,
+                                       .sin_port = htons(external.port),
+                                       .sin_addr.s_addr =
+                                           htonl(INADDR_LOOPBACK)};
+
+    ov_ice_proxy_sharded_config config = {.threads = TEST_SHARDS};
+
+    config.proxy.loop = loop;
+    config.proxy.external = external;
+    strncpy(config.proxy.config.dtls.cert, OV_TEST_CERT, PATH_MAX - 1);
+    strncpy(config.proxy.config.dtls.key, OV_TEST_CERT_KEY, PATH_MAX - 1);
+    strcpy(config.proxy.config.dtls.srtp.profile, TEST_SRTP_PROFILE);
+
+    config.proxy.callbacks.userdata = test;
+    config.proxy.callbacks.session.state = load_session_state;
+    config.proxy.callbacks.stream.io = load_stream_io;
+
+    ov_ice_proxy_generic *proxy = ov_ice_proxy_sharded_create(config);
+    testrun(proxy);
+
+    SSL_CTX *ctx = SSL_CTX_new(DTLS_client_method());
+    testrun(ctx);
+
+    SSL_CTX_set_min_proto_version(ctx, DTLS1_2_VERSION);
+    SSL_CTX_set_max_proto_version(ctx, DTLS1_2_VERSION);
+    SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, NULL);
+    testrun(0 == SSL_CTX_set_tlsext_use_srtp(ctx, TEST_SRTP_PROFILE));
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+
+        LoadClient *client = &test->client[i];
+        testrun(load_client_init(client, test, ctx, loop, i));
+        testrun(load_client_connect(client, proxy));
+    }
+
+    /* (1) ICE and DTLS of all sessions */
+
+    uint64_t deadline = start + TEST_LOAD_TIMEOUT_USEC;
+
+    while ((test->completed < TEST_CLIENTS) &&
+           (ov_time_get_current_time_usecs() < deadline)) {
+
+        for (size_t i = 0; i < TEST_CLIENTS; i++) {
+
+            LoadClient *client = &test->client[i];
+
+            if (!client->checked)
+                load_client_check(client);
+
+            load_client_pump(client);
+        }
+
+        loop->run(loop, 10000);
+    }
+
+    uint64_t usec_connect = ov_time_get_current_time_usecs() - start;
+
+    testrun(TEST_CLIENTS == test->completed);
+
+    ov_ice_proxy_sharded_stats stats = ov_ice_proxy_sharded_get_stats(proxy);
+    testrun(TEST_SHARDS == stats.threads);
+
+    for (size_t s = 0; s < TEST_SHARDS; s++) {
+
+        /* sessions are assigned to the shard with the least sessions */
+        testrun(TEST_CLIENTS / TEST_SHARDS == stats.shard[s].sessions);
+    }
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+        testrun(test->client[i].srtp);
+    }
+
+    /* (2) SRTP of all sessions */
+
+    size_t sent = 0;
+    uint64_t expected = TEST_CLIENTS * TEST_PACKETS;
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t p = 0; p < TEST_PACKETS; p++) {
+
+        for (size_t i = 0; i < TEST_CLIENTS; i++) {
+
+            if (load_client_send_rtp(&test->client[i], p * 960))
+                sent++;
+        }
+
+        /* pace the frames like media, a burst of all frames overflows the
+         * receive buffers of loopback */
+
+        uint64_t next = start + (p + 1) * TEST_PTIME_USEC;
+        uint64_t now = ov_time_get_current_time_usecs();
+
+        while (now < next) {
+            loop->run(loop, next - now);
+            now = ov_time_get_current_time_usecs();
+        }
+    }
+
+    deadline = start + TEST_LOAD_TIMEOUT_USEC;
+
+    while ((atomic_load(&test->received) < expected) &&
+           (ov_time_get_current_time_usecs() < deadline)) {
+
+        loop->run(loop, 10000);
+    }
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+    uint64_t received = atomic_load(&test->received);
+
+    testrun(expected == sent);
+
+    /* loopback UDP MAY drop some packets */
+    testrun(received > 0);
+    testrun(received <= expected);
+
+    stats = ov_ice_proxy_sharded_get_stats(proxy);
+
+    for (size_t s = 0; s < TEST_SHARDS; s++) {
+
+        fprintf(stdout,
+                "shard %zu sessions %zu, passed %" PRIu64
+                ", handshakes %" PRIu64 " (avg %" PRIu64 " usec)\n",
+                s, stats.shard[s].sessions, stats.shard[s].received,
+                stats.shard[s].handshake.completed,
+                stats.shard[s].handshake.latency.avg_usec);
+    }
+
+    fprintf(stdout,
+            "%i sessions connected in %" PRIu64 " usec, %" PRIu64
+            " of %" PRIu64 " SRTP packets in %" PRIu64
+            " usec (%.0f packets/s)\n",
+            TEST_CLIENTS, usec_connect, received, expected, usec,
+            usec ? (double)received * 1000000.0 / (double)usec : 0.0);
+
+    for (size_t i = 0; i < TEST_CLIENTS; i++) {
+        load_client_clear(&test->client[i], loop);
+    }
+
+    SSL_CTX_free(ctx);
+    free(test);
+
+    proxy = ov_ice_proxy_generic_free(proxy);
+    loop = ov_event_loop_free(loop);
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST CLUSTER                                                    #CLUSTER
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+int all_tests() {
+
+    testrun_init();
+    testrun_test(test_ov_ice_proxy_sharded_create);
+    testrun_test(check_shard_encoding);
+    testrun_test(check_route_packet);
+    testrun_test(check_shard_distribution);
+    testrun_test(check_sharded_srtp_load);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
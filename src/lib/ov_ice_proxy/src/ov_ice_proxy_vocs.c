@@ -27,13 +27,23 @@
 
         ------------------------------------------------------------------------
 */
+#define _GNU_SOURCE // sendmmsg
+
 #include "../include/ov_ice_proxy_vocs.h"
 #include "../include/ov_ice_config_from_generic.h"
 #include "../include/ov_ice_proxy_dynamic.h"
 #include "../include/ov_ice_proxy_multiplexing.h"
+#include "../include/ov_ice_proxy_sharded.h"
 
+#include <ov_base/ov_loop_bus.h>
+#include <ov_base/ov_metrics.h>
+#include <ov_base/ov_time.h>
 #include <ov_core/ov_mc_loop_data.h>
 
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/socket.h>
+
 #define OV_ICE_PROXY_VOCS_MAGIC_BYTES 0x1ce3
 
 #define OV_ICE_PROXY_VOCS_DEFAULT_SDP                                          \
@@ -47,6 +57,13 @@
     "maxplaybackrate=48000;stereo=1;"                                          \
     "useinbandfec=1\r\n"
 
+#define IMPL_HANDLES_DEFAULT 64
+#define IMPL_SEND_ERROR_LOG_INTERVAL_USEC 1000000
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct Session Session;
+
 /*----------------------------------------------------------------------------*/
 
 struct ov_ice_proxy_vocs {
@@ -57,29 +74,177 @@ struct ov_ice_proxy_vocs {
     ov_ice_proxy_generic *proxy;
 
     ov_dict *sessions;
+
+    /* stream io of a sharded proxy is called within its worker threads,
+     * sessions, handles and destinations are changed with the write lock,
+     * the lock MUST NOT be held while calling the proxy */
+    pthread_rwlock_t lock;
+
+    /* loop name -> ov_loop_bus, shared by all sessions */
+    ov_dict *buses;
+
+    /* frames and bytes sent per talk loop, counted within the
+     * worker threads */
+    ov_metrics *metrics;
+
+    /* failed talk sends, logged at most once per interval */
+    struct {
+
+        _Atomic uint64_t count;
+        _Atomic uint64_t logged_usec;
+
+    } send_errors;
+
+    /* session by handle, handle 0 is invalid,
+     * free holds the unused handles as stack */
+    struct {
+
+        uint32_t size;
+        Session **session;
+
+        uint32_t unused;
+        uint32_t *free;
+
+    } handles;
 };
 
 /*----------------------------------------------------------------------------*/
 
-typedef struct Session {
+typedef struct Destination {
+
+    ov_mc_loop_data data;
+
+    struct sockaddr_storage sa;
+    socklen_t sa_len;
+
+    ov_loop_bus *bus;
+
+    struct {
+
+        ov_metrics_series *frames_out;
+        ov_metrics_series *bytes_out;
+
+    } metric;
+
+} Destination;
+
+/*----------------------------------------------------------------------------*/
+
+struct Session {
 
     ov_id id;
     ov_ice_proxy_vocs *proxy;
 
+    uint32_t handle;
+
     int socket;
     ov_socket_data local;
 
+    /* loop name -> Destination */
     ov_dict *talk;
 
-} Session;
+    /* message vector of all talk destinations, rebuild on talk changes,
+     * all messages share one iovec */
+    struct {
+
+        size_t count;
+        struct mmsghdr *msg;
+        struct iovec iov;
+
+        size_t buses;
+        ov_loop_bus **bus;
+
+        Destination **dest;
+
+    } destinations;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static bool handles_grow(ov_ice_proxy_vocs *self) {
+
+    uint32_t size = self->handles.size * 2;
+    if (0 == size)
+        size = IMPL_HANDLES_DEFAULT;
+
+    if (size <= self->handles.size)
+        goto error;
+
+    Session **slots = realloc(self->handles.session, size * sizeof(Session *));
+    if (!slots)
+        goto error;
+
+    self->handles.session = slots;
+
+    memset(slots + self->handles.size, 0,
+           (size - self->handles.size) * sizeof(Session *));
+
+    uint32_t *stack = realloc(self->handles.free, size * sizeof(uint32_t));
+    if (!stack)
+        goto error;
+
+    self->handles.free = stack;
+
+    /* pushed in reverse, so the lowest handle is used first */
+
+    uint32_t first = self->handles.size;
+    if (0 == first)
+        first = 1;
+
+    for (uint32_t handle = size - 1; handle >= first; handle--) {
+        stack[self->handles.unused++] = handle;
+    }
+
+    self->handles.size = size;
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t handle_create(ov_ice_proxy_vocs *self, Session *session) {
+
+    if ((0 == self->handles.unused) && !handles_grow(self))
+        goto error;
+
+    uint32_t handle = self->handles.free[--self->handles.unused];
+
+    self->handles.session[handle] = session;
+    return handle;
+error:
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static Session *handle_get(ov_ice_proxy_vocs *self, uint32_t handle) {
+
+    if ((0 == handle) || (handle >= self->handles.size))
+        return NULL;
+
+    return self->handles.session[handle];
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void handle_release(ov_ice_proxy_vocs *self, uint32_t handle) {
+
+    if ((0 == handle) || (handle >= self->handles.size))
+        return;
+
+    if (!self->handles.session[handle])
+        return;
+
+    self->handles.session[handle] = NULL;
+    self->handles.free[self->handles.unused++] = handle;
+}
 
 /*----------------------------------------------------------------------------*/
 
 static bool io_internal(int socket, uint8_t events, void *userdata) {
 
     uint8_t buffer[OV_UDP_PAYLOAD_OCTETS] = {0};
-    ov_socket_data remote = {};
-    socklen_t src_addr_len = sizeof(remote.sa);
 
     Session *session = (Session *)userdata;
     if (!session || !socket || !events)
@@ -91,14 +256,12 @@ static bool io_internal(int socket, uint8_t events, void *userdata) {
 
     OV_ASSERT(events & OV_EVENT_IO_IN);
 
-    ssize_t bytes = recvfrom(socket, (char *)buffer, OV_UDP_PAYLOAD_OCTETS, 0,
-                             (struct sockaddr *)&remote.sa, &src_addr_len);
+    /* the sender address is not used, so it is not requested */
 
-    if (bytes < 1)
-        goto error;
+    ssize_t bytes =
+        recvfrom(socket, (char *)buffer, OV_UDP_PAYLOAD_OCTETS, 0, NULL, NULL);
 
-    if (!ov_socket_parse_sockaddr_storage(&remote.sa, remote.host,
-                                          OV_HOST_NAME_MAX, &remote.port))
+    if (bytes < 1)
         goto error;
 
     ssize_t out = ov_ice_proxy_generic_stream_send(
@@ -120,7 +283,9 @@ static void *session_free(void *self) {
     if (!session)
         return NULL;
 
-    ov_ice_proxy_generic_drop_session(session->proxy->proxy, session->id);
+    ov_ice_proxy_vocs *proxy = session->proxy;
+
+    ov_ice_proxy_generic_drop_session(proxy->proxy, session->id);
 
     if (session->proxy->config.callback.session_completed)
         session->proxy->config.callback.session_completed(
@@ -135,7 +300,15 @@ static void *session_free(void *self) {
         session->socket = -1;
     }
 
+    pthread_rwlock_wrlock(&proxy->lock);
+    handle_release(proxy, session->handle);
+    pthread_rwlock_unlock(&proxy->lock);
+
     session->talk = ov_dict_free(session->talk);
+    session->destinations.msg = ov_data_pointer_free(session->destinations.msg);
+    session->destinations.bus = ov_data_pointer_free(session->destinations.bus);
+    session->destinations.dest =
+        ov_data_pointer_free(session->destinations.dest);
     session = ov_data_pointer_free(session);
     return session;
 }
@@ -161,6 +334,12 @@ static Session *create_session(ov_ice_proxy_vocs *proxy, const char *uuid) {
     ov_socket_get_data(self->socket, &self->local, NULL);
     ov_socket_ensure_nonblocking(self->socket);
 
+    /* subscribers of the host receive the bus only */
+
+    if (proxy->config.loop_bus &&
+        !ov_loop_bus_multicast_loop(self->socket, false))
+        goto error;
+
     uint8_t event = OV_EVENT_IO_IN | OV_EVENT_IO_ERR | OV_EVENT_IO_CLOSE;
 
     if (!ov_event_loop_set(proxy->config.loop, self->socket, event, self,
@@ -174,8 +353,29 @@ static Session *create_session(ov_ice_proxy_vocs *proxy, const char *uuid) {
     if (!self->talk)
         goto error;
 
-    if (!ov_dict_set(proxy->sessions, strdup(self->id), self, NULL))
+    pthread_rwlock_wrlock(&proxy->lock);
+
+    if (!ov_dict_set(proxy->sessions, strdup(self->id), self, NULL)) {
+        pthread_rwlock_unlock(&proxy->lock);
         goto error;
+    }
+
+    /* Without some handle or if the proxy does not support handles,
+     * stream io is forwarded by session id. */
+
+    self->handle = handle_create(proxy, self);
+
+    pthread_rwlock_unlock(&proxy->lock);
+
+    if (self->handle && !ov_ice_proxy_generic_session_set_handle(
+                            proxy->proxy, self->id, self->handle)) {
+
+        pthread_rwlock_wrlock(&proxy->lock);
+        handle_release(proxy, self->handle);
+        pthread_rwlock_unlock(&proxy->lock);
+
+        self->handle = 0;
+    }
 
     return self;
 error:
@@ -185,13 +385,27 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static bool session_remove(ov_ice_proxy_vocs *self, const char *uuid) {
+
+    /* session_free calls the proxy, so the session is removed first */
+
+    pthread_rwlock_wrlock(&self->lock);
+    Session *session = ov_dict_remove(self->sessions, uuid);
+    pthread_rwlock_unlock(&self->lock);
+
+    session_free(session);
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static void session_drop(void *userdata, const char *uuid) {
 
     ov_ice_proxy_vocs *self = ov_ice_proxy_vocs_cast(userdata);
     if (!self || !uuid)
         goto error;
 
-    ov_dict_del(self->sessions, uuid);
+    session_remove(self, uuid);
 
 error:
     return;
@@ -216,54 +430,151 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-struct container_talk {
+static bool add_destination(const void *key, void *val, void *data) {
 
-    const uint8_t *ptr;
-    size_t len;
+    if (!key)
+        return true;
 
-    Session *session;
-};
+    Destination *dest = (Destination *)val;
+    Session *session = (Session *)data;
 
-/*----------------------------------------------------------------------------*/
+    struct mmsghdr *msg =
+        &session->destinations.msg[session->destinations.count];
 
-static bool send_to_loop(const void *key, void *val, void *data) {
+    *msg = (struct mmsghdr){0};
+    msg->msg_hdr.msg_name = &dest->sa;
+    msg->msg_hdr.msg_namelen = dest->sa_len;
+    msg->msg_hdr.msg_iov = &session->destinations.iov;
+    msg->msg_hdr.msg_iovlen = 1;
 
-    if (!key)
-        return true;
+    session->destinations.dest[session->destinations.count] = dest;
+    session->destinations.count++;
 
-    struct sockaddr_storage sa = {0};
+    if (dest->bus)
+        session->destinations.bus[session->destinations.buses++] = dest->bus;
 
-    ov_mc_loop_data *loopdata = (ov_mc_loop_data *)val;
-    struct container_talk *container = (struct container_talk *)data;
+    return true;
+}
 
-    Session *session = container->session;
+/*----------------------------------------------------------------------------*/
 
-    socklen_t sock_len = sizeof(struct sockaddr_in);
+static bool session_update_destinations(Session *session) {
 
-    if (!ov_socket_fill_sockaddr_storage(&sa, session->local.sa.ss_family,
-                                         loopdata->socket.host,
-                                         loopdata->socket.port))
+    size_t count = ov_dict_count(session->talk);
+
+    session->destinations.count = 0;
+    session->destinations.msg = ov_data_pointer_free(session->destinations.msg);
+
+    session->destinations.buses = 0;
+    session->destinations.bus = ov_data_pointer_free(session->destinations.bus);
+    session->destinations.dest =
+        ov_data_pointer_free(session->destinations.dest);
+
+    if (0 == count)
+        return true;
+
+    session->destinations.msg = calloc(count, sizeof(struct mmsghdr));
+    if (!session->destinations.msg)
         goto error;
 
-    if (session->local.sa.ss_family == AF_INET6)
-        sock_len = sizeof(struct sockaddr_in6);
+    session->destinations.bus = calloc(count, sizeof(ov_loop_bus *));
+    if (!session->destinations.bus)
+        goto error;
 
-    ssize_t bytes = sendto(session->socket, container->ptr, container->len, 0,
-                           (struct sockaddr *)&sa, sock_len);
-    /*
-        ov_log_debug("send %zi bytes of %zi bytes to loop %s:%i",
-            bytes, container->len, loopdata->socket.host,
-            loopdata->socket.port);
-    */
-    UNUSED(bytes);
+    session->destinations.dest = calloc(count, sizeof(Destination *));
+    if (!session->destinations.dest)
+        goto error;
 
-    return true;
+    return ov_dict_for_each(session->talk, session, add_destination);
 error:
     return false;
 }
 
 /*----------------------------------------------------------------------------*/
 
+static void send_error_log(ov_ice_proxy_vocs *self, int socket) {
+
+    uint64_t errors = atomic_fetch_add(&self->send_errors.count, 1) + 1;
+
+    uint64_t now = ov_time_get_current_time_usecs();
+    uint64_t logged = atomic_load(&self->send_errors.logged_usec);
+
+    if (now - logged < IMPL_SEND_ERROR_LOG_INTERVAL_USEC)
+        return;
+
+    /* only one worker thread wins the interval */
+
+    if (!atomic_compare_exchange_strong(&self->send_errors.logged_usec,
+                                        &logged, now))
+        return;
+
+    ov_log_error("ICE proxy failed to send to talk loop on socket %i - "
+                 "%i | %s (%" PRIu64 " failed sends)",
+                 socket, errno, strerror(errno), errors);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void send_to_talk(Session *session, uint8_t *buffer, size_t size) {
+
+    session->destinations.iov.iov_base = buffer;
+    session->destinations.iov.iov_len = size;
+
+    size_t sent = 0;
+
+    while (sent < session->destinations.count) {
+
+        int out = sendmmsg(session->socket, session->destinations.msg + sent,
+                           session->destinations.count - sent, 0);
+
+        if (out < 1) {
+
+            /* skip the failed destination only, the others
+             * still get the frame */
+
+            send_error_log(session->proxy, session->socket);
+            sent++;
+            continue;
+        }
+
+        for (size_t i = sent; i < sent + (size_t)out; ++i) {
+
+            Destination *dest = session->destinations.dest[i];
+
+            ov_metrics_count(dest->metric.frames_out, 1);
+            ov_metrics_count(dest->metric.bytes_out, size);
+        }
+
+        sent += (size_t)out;
+    }
+
+    for (size_t i = 0; i < session->destinations.buses; ++i) {
+        ov_loop_bus_publish(session->destinations.bus[i], buffer, size);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool is_rtcp(const uint8_t *buffer) {
+
+    switch (buffer[1]) {
+
+    case 200: // RTCP sender report
+    case 201: // RTCP receiver report
+    case 202: // RTCP SDES
+    case 203: // RTCP GOOD BYE
+    case 204: // RTCP APP DATA
+        return true;
+
+    default:
+        break;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static void stream_io(void *userdata, const char *session_id, int stream_id,
                       uint8_t *buffer, size_t size) {
 
@@ -272,43 +583,43 @@ static void stream_io(void *userdata, const char *session_id, int stream_id,
         goto error;
     OV_ASSERT(stream_id == 0);
 
-    Session *session = ov_dict_get(self->sessions, session_id);
-    if (!session)
-        goto ignore;
+    if (is_rtcp(buffer))
+        goto error;
 
-    switch (buffer[1]) {
+    pthread_rwlock_rdlock(&self->lock);
+
+    Session *session = ov_dict_get(self->sessions, session_id);
+    if (session)
+        send_to_talk(session, buffer, size);
 
-    case 200:
-        // ov_log_debug("RTCP sender report received - ignoring");
-        goto ignore;
+    pthread_rwlock_unlock(&self->lock);
 
-    case 201:
-        // ov_log_debug("RTCP receiver report received - ignoring");
-        goto ignore;
+error:
+    return;
+}
 
-    case 202:
-        // ov_log_debug("RTCP SDES received - ignoring");
-        goto ignore;
+/*----------------------------------------------------------------------------*/
 
-    case 203:
-        // ov_log_debug("RTCP GOOD BYE received - ignoring");
-        goto ignore;
+static void stream_io_handle(void *userdata, uint32_t handle, int stream_id,
+                             uint8_t *buffer, size_t size) {
 
-    case 204:
-        // ov_log_debug("RTCP APP DATA received - ignoring");
-        goto ignore;
+    ov_ice_proxy_vocs *self = ov_ice_proxy_vocs_cast(userdata);
+    if (!self || !buffer || (size < 2))
+        goto error;
+    OV_ASSERT(stream_id == 0);
+    UNUSED(stream_id);
 
-    default:
-        break;
-    }
+    if (is_rtcp(buffer))
+        goto error;
 
-    struct container_talk container = (struct container_talk){
+    pthread_rwlock_rdlock(&self->lock);
 
-        .ptr = buffer, .len = size, .session = session};
+    Session *session = handle_get(self, handle);
+    if (session)
+        send_to_talk(session, buffer, size);
 
-    ov_dict_for_each(session->talk, &container, send_to_loop);
+    pthread_rwlock_unlock(&self->lock);
 
-ignore:
 error:
     return;
 }
@@ -362,18 +673,30 @@ ov_ice_proxy_vocs *ov_ice_proxy_vocs_create(ov_ice_proxy_vocs_config config) {
         goto error;
 
     self->magic_bytes = OV_ICE_PROXY_VOCS_MAGIC_BYTES;
+    pthread_rwlock_init(&self->lock, NULL);
 
     config.proxy.callbacks.userdata = self;
     config.proxy.callbacks.session.drop = session_drop;
     config.proxy.callbacks.session.state = session_state;
     config.proxy.callbacks.stream.io = stream_io;
+    config.proxy.callbacks.stream.io_handle = stream_io_handle;
     config.proxy.callbacks.candidate.send = candidates_send;
     config.proxy.callbacks.candidate.end_of_candidates = end_of_candidates_send;
 
     self->config = config;
 
-    if (config.multiplexing) {
+    if (config.multiplexing && (config.sharding.threads > 1)) {
+
+        self->proxy = ov_ice_proxy_sharded_create((ov_ice_proxy_sharded_config){
+            .proxy = config.proxy,
+            .threads = config.sharding.threads,
+            .loop.config = config.sharding.loop,
+            .loop.create = config.sharding.loop_create});
+
+    } else if (config.multiplexing) {
+
         self->proxy = ov_ice_proxy_multiplexing_create(config.proxy);
+
     } else {
 
         self->proxy = ov_ice_proxy_dynamic_create(config.proxy);
@@ -391,6 +714,20 @@ ov_ice_proxy_vocs *ov_ice_proxy_vocs_create(ov_ice_proxy_vocs_config config) {
                       "Cannot create ICE Proxy - Could not create sessions db"))
         goto error;
 
+    d_config = ov_dict_string_key_config(255);
+    d_config.value.data_function.free = ov_loop_bus_free_void;
+
+    self->buses = ov_dict_create(d_config);
+    if (!ov_ptr_valid(self->buses,
+                      "Cannot create ICE Proxy - Could not create loop buses"))
+        goto error;
+
+    self->metrics =
+        ov_metrics_create((ov_metrics_config){.prefix = "openvocs_ice_proxy"});
+    if (!ov_ptr_valid(self->metrics,
+                      "Cannot create ICE Proxy - Could not create metrics"))
+        goto error;
+
     return self;
 error:
     ov_ice_proxy_vocs_free(self);
@@ -406,6 +743,11 @@ ov_ice_proxy_vocs *ov_ice_proxy_vocs_free(ov_ice_proxy_vocs *self) {
 
     self->proxy = ov_ice_proxy_generic_free(self->proxy);
     self->sessions = ov_dict_free(self->sessions);
+    self->buses = ov_dict_free(self->buses);
+    self->metrics = ov_metrics_free(self->metrics);
+    self->handles.session = ov_data_pointer_free(self->handles.session);
+    self->handles.free = ov_data_pointer_free(self->handles.free);
+    pthread_rwlock_destroy(&self->lock);
     self = ov_data_pointer_free(self);
 error:
     return self;
@@ -445,6 +787,12 @@ ov_ice_proxy_vocs_config_from_json(const ov_json_value *input) {
 
         if (ov_json_is_true(ov_json_get(config, "/" OV_KEY_MULTIPLEXING)))
             out.multiplexing = true;
+
+        out.sharding.threads =
+            ov_json_number_get(ov_json_get(config, "/" OV_KEY_THREADS));
+
+        if (ov_json_is_true(ov_json_get(config, "/" OV_KEY_LOOP_BUS)))
+            out.loop_bus = true;
     }
 
     return out;
@@ -502,7 +850,7 @@ bool ov_ice_proxy_vocs_drop_session(ov_ice_proxy_vocs *self, const char *uuid) {
 
     if (!self || !uuid)
         return false;
-    return ov_dict_del(self->sessions, uuid);
+    return session_remove(self, uuid);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -546,10 +894,47 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static ov_loop_bus *get_loop_bus(ov_ice_proxy_vocs *self,
+                                 ov_socket_configuration group) {
+
+    /* called with the write lock */
+
+    ov_loop_bus_config config = {0};
+    ov_loop_bus *bus = NULL;
+
+    if (!ov_loop_bus_name(group, config.name, sizeof(config.name)))
+        goto error;
+
+    bus = ov_dict_get(self->buses, config.name);
+    if (bus)
+        return bus;
+
+    bus = ov_loop_bus_create(config);
+    if (!bus)
+        goto error;
+
+    char *key = strdup(config.name);
+
+    if (!key || !ov_dict_set(self->buses, key, bus, NULL)) {
+        ov_data_pointer_free(key);
+        goto error;
+    }
+
+    return bus;
+error:
+    ov_log_error("ICE proxy failed to open loop bus %s:%" PRIu16, group.host,
+                 group.port);
+    ov_loop_bus_free(bus);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_ice_proxy_vocs_talk(ov_ice_proxy_vocs *self, const char *session_id,
                             bool on, ov_mc_loop_data data) {
 
-    bool result = false;
+    Destination *dest = NULL;
+    char *key = NULL;
 
     if (!self || !session_id)
         goto error;
@@ -560,29 +945,136 @@ bool ov_ice_proxy_vocs_talk(ov_ice_proxy_vocs *self, const char *session_id,
 
     if (!on) {
 
-        result = ov_dict_del(session->talk, data.name);
+        pthread_rwlock_wrlock(&self->lock);
 
-    } else {
+        bool ok = ov_dict_del(session->talk, data.name) &&
+                  session_update_destinations(session);
+
+        pthread_rwlock_unlock(&self->lock);
+        return ok;
+    }
+
+    dest = calloc(1, sizeof(Destination));
+    if (!dest)
+        goto error;
+
+    dest->data = data;
+
+    dest->metric.frames_out =
+        ov_metrics_counter(self->metrics, "frames_out", data.name);
+    dest->metric.bytes_out =
+        ov_metrics_counter(self->metrics, "bytes_out", data.name);
+
+    /* resolve the destination once, not for each packet */
+
+    if (!ov_socket_fill_sockaddr_storage(&dest->sa, session->local.sa.ss_family,
+                                         data.socket.host, data.socket.port))
+        goto error;
+
+    dest->sa_len = sizeof(struct sockaddr_in);
+    if (session->local.sa.ss_family == AF_INET6)
+        dest->sa_len = sizeof(struct sockaddr_in6);
 
-        ov_mc_loop_data *t_data = calloc(1, sizeof(ov_mc_loop_data));
+    key = strdup(data.name);
+    if (!key)
+        goto error;
 
-        if (t_data) {
+    pthread_rwlock_wrlock(&self->lock);
 
-            *t_data = data;
+    if (self->config.loop_bus) {
 
-            char *key = strdup(data.name);
+        dest->bus = get_loop_bus(self, data.socket);
 
-            if (!ov_dict_set(session->talk, key, t_data, NULL)) {
-                t_data = ov_data_pointer_free(t_data);
-                key = ov_data_pointer_free(key);
-            } else {
-                result = true;
-            }
+        if (!dest->bus) {
+            pthread_rwlock_unlock(&self->lock);
+            goto error;
         }
     }
 
-    return result;
+    if (!ov_dict_set(session->talk, key, dest, NULL)) {
+        pthread_rwlock_unlock(&self->lock);
+        goto error;
+    }
+
+    bool ok = session_update_destinations(session);
+
+    pthread_rwlock_unlock(&self->lock);
+    return ok;
 
 error:
+    ov_data_pointer_free(dest);
+    ov_data_pointer_free(key);
     return false;
 }
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *handshake_stats_to_json(ov_ice_proxy_vocs *self) {
+
+    ov_json_value *out = ov_json_array();
+    ov_json_value *val = NULL;
+
+    if (!out)
+        goto error;
+
+    if (!self->config.multiplexing)
+        return out;
+
+    if (self->config.sharding.threads > 1) {
+
+        ov_ice_proxy_sharded_stats stats =
+            ov_ice_proxy_sharded_get_stats(self->proxy);
+
+        for (size_t i = 0; i < stats.threads; i++) {
+
+            val = ov_dtls_handshake_pool_stats_to_json(
+                stats.shard[i].handshake);
+
+            if (!ov_json_array_push(out, val))
+                goto error;
+        }
+
+        val = NULL;
+
+    } else {
+
+        val = ov_dtls_handshake_pool_stats_to_json(
+            ov_ice_proxy_multiplexing_handshake_stats(self->proxy));
+
+        if (!ov_json_array_push(out, val))
+            goto error;
+
+        val = NULL;
+    }
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_ice_proxy_vocs_metrics(ov_ice_proxy_vocs *self) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+
+    if (!ov_ice_proxy_vocs_cast(self))
+        goto error;
+
+    out = ov_metrics_to_json(self->metrics);
+    if (!out)
+        goto error;
+
+    val = handshake_stats_to_json(self);
+    if (!ov_json_object_set(out, OV_KEY_DTLS_HANDSHAKE, val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
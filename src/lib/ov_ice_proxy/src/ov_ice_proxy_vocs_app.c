@@ -576,6 +576,40 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static bool cb_event_state(void *userdata, const int socket,
+                           const ov_event_parameter *params,
+                           ov_json_value *input) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+
+    ov_ice_proxy_vocs_app *self = ov_ice_proxy_vocs_app_cast(userdata);
+    if (!self || !params || socket < 0 || !input)
+        goto error;
+
+    out = ov_event_api_create_success_response(input);
+
+    val = ov_ice_proxy_vocs_metrics(self->proxy);
+    if (!ov_json_object_set(ov_event_api_get_response(out), OV_KEY_METRICS,
+                            val))
+        goto error;
+
+    val = NULL;
+
+    ov_event_io_send(params, socket, out);
+    out = ov_json_value_free(out);
+    input = ov_json_value_free(input);
+    return true;
+
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    ov_json_value_free(input);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool register_event_callbacks(ov_ice_proxy_vocs_app *app) {
 
     OV_ASSERT(app);
@@ -609,6 +643,10 @@ static bool register_event_callbacks(ov_ice_proxy_vocs_app *app) {
     if (!ov_event_engine_register(app->engine, OV_KEY_TALK, app, cb_event_talk))
         goto error;
 
+    if (!ov_event_engine_register(app->engine, OV_KEY_STATE, app,
+                                  cb_event_state))
+        goto error;
+
     return true;
 error:
     return false;
@@ -38,6 +38,7 @@
 #include <ov_core/ov_mixer_registry.h>
 
 #include <ov_encryption/ov_dtls.h>
+#include <ov_encryption/ov_dtls_handshake_pool.h>
 
 #include <srtp2/srtp.h>
 
@@ -99,12 +100,18 @@ typedef struct ov_interconnect_config {
         uint64_t client_connect_trigger_usec;
         uint64_t keepalive_trigger_usec;
 
+        size_t handshake_threads; // DTLS handshake workers, 0 for default
+
     } limits;
 
     ov_dtls_config dtls;
 
     ov_mixer_config mixer;
 
+    /* publish loops to the shared memory bus of the host as well,
+     * see ov_loop_bus.h */
+    bool loop_bus;
+
 } ov_interconnect_config;
 
 /*
@@ -174,7 +181,18 @@ bool ov_interconnect_srtp_ready(ov_interconnect *self,
 
 int ov_interconnect_get_media_socket(const ov_interconnect *self);
 
+ov_dtls_handshake_pool *
+ov_interconnect_get_dtls_handshake_pool(const ov_interconnect *self);
+
 const ov_interconnect_loop *
 ov_interconnect_get_loop(const ov_interconnect *self, const char *name);
 
+/**
+    Frames forwarded per loop, see ov_metrics.h
+
+    Queue depth and latency of the DTLS handshake pool are added as
+    "dtls handshake", see ov_dtls_handshake_pool_stats_to_json.
+*/
+ov_json_value *ov_interconnect_get_metrics(ov_interconnect *self);
+
 #endif /* ov_interconnect_h */
@@ -35,6 +35,7 @@ typedef struct ov_interconnect_loop ov_interconnect_loop;
 /*----------------------------------------------------------------------------*/
 
 #include "ov_interconnect.h"
+#include <ov_base/ov_metrics.h>
 
 /*----------------------------------------------------------------------------*/
 
@@ -46,6 +47,12 @@ typedef struct ov_interconnect_loop_config {
     ov_socket_configuration multicast;
     ov_socket_configuration internal;
 
+    /* publish to the bus and disable the multicast loopback */
+    bool loop_bus;
+
+    /* optional, frames forwarded from and to the loop */
+    ov_metrics *metrics;
+
 } ov_interconnect_loop_config;
 
 /*
@@ -56,6 +56,7 @@ struct ov_interconnect {
     ov_interconnect_config config;
 
     ov_dtls *dtls;
+    ov_dtls_handshake_pool *handshakes;
 
     struct {
 
@@ -83,6 +84,8 @@ struct ov_interconnect {
     ov_dict *registered;
 
     ov_mixer_registry *mixers;
+
+    ov_metrics *metrics;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -350,6 +353,29 @@ error:
     return;
 }
 
+/*----------------------------------------------------------------------------*/
+
+static void event_mixer_overload(void *userdata, const char *event_name,
+                                 int socket, ov_json_value *input) {
+
+    ov_interconnect *self = ov_interconnect_cast(userdata);
+    if (!self || !event_name || !input)
+        goto error;
+
+    bool overloaded = ov_json_is_true(
+        ov_json_get(input, "/" OV_KEY_PARAMETER "/" OV_KEY_OVERLOAD));
+
+    if (!ov_mixer_registry_set_overload(self->mixers, socket, overloaded))
+        goto error;
+
+    ov_log_info("mixer at socket %i %s", socket,
+                overloaded ? "overloaded" : "recovered");
+
+error:
+    ov_json_value_free(input);
+    return;
+}
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -1310,6 +1336,10 @@ static bool register_events(ov_interconnect *self) {
     if (!ov_event_app_register(self->app.mixer, "join", self, event_mixer_join))
         goto error;
 
+    if (!ov_event_app_register(self->app.mixer, OV_KEY_OVERLOAD, self,
+                               event_mixer_overload))
+        goto error;
+
     return true;
 error:
     return false;
@@ -1365,6 +1395,13 @@ ov_interconnect *ov_interconnect_create(ov_interconnect_config config) {
     if (!self->dtls)
         goto error;
 
+    self->handshakes =
+        ov_dtls_handshake_pool_create((ov_dtls_handshake_pool_config){
+            .loop = config.loop, .threads = config.limits.handshake_threads});
+
+    if (!self->handshakes)
+        goto error;
+
     self->app.signaling = ov_event_app_create(
         (ov_event_app_config){.io = config.io,
                               .callbacks.userdata = self,
@@ -1381,6 +1418,11 @@ ov_interconnect *ov_interconnect_create(ov_interconnect_config config) {
 
     self->loops = ov_dict_create(d_config);
 
+    self->metrics = ov_metrics_create(
+        (ov_metrics_config){.prefix = "openvocs_interconnect"});
+    if (!self->metrics)
+        goto error;
+
     d_config = ov_dict_string_key_config(255);
     d_config.value.data_function.free = NULL;
 
@@ -1445,10 +1487,12 @@ ov_interconnect *ov_interconnect_free(ov_interconnect *self) {
         ov_dict_free(self->session.by_signaling_remote);
     self->session.by_media_remote = ov_dict_free(self->session.by_media_remote);
 
+    self->handshakes = ov_dtls_handshake_pool_free(self->handshakes);
     self->dtls = ov_dtls_free(self->dtls);
     self->app.signaling = ov_event_app_free(self->app.signaling);
     self->app.mixer = ov_event_app_free(self->app.mixer);
     self->mixers = ov_mixer_registry_free(self->mixers);
+    self->metrics = ov_metrics_free(self->metrics);
     ov_interconnect_dtls_filter_deinit();
     self = ov_data_pointer_free(self);
 error:
@@ -1554,6 +1598,9 @@ ov_interconnect_config_from_json(const ov_json_value *val) {
     config.limits.keepalive_trigger_usec = ov_json_number_get(
         ov_json_get(conf, "/" OV_KEY_LIMITS "/" OV_KEY_KEEPALIVE_SEC));
 
+    config.limits.handshake_threads = ov_json_number_get(
+        ov_json_get(conf, "/" OV_KEY_LIMITS "/" OV_KEY_THREADS));
+
     config.limits.client_connect_trigger_usec *= 1000000;
     config.limits.keepalive_trigger_usec *= 1000000;
 
@@ -1561,6 +1608,8 @@ ov_interconnect_config_from_json(const ov_json_value *val) {
 
     config.mixer = ov_mixer_config_from_json(conf);
 
+    config.loop_bus = ov_json_is_true(ov_json_get(conf, "/" OV_KEY_LOOP_BUS));
+
     return config;
 
 error:
@@ -1594,6 +1643,8 @@ static bool load_loop(const void *key, void *val, void *data) {
     strncpy(config.name, name, OV_HOST_NAME_MAX);
     config.multicast = socket_config;
     config.internal = self->config.socket.internal;
+    config.loop_bus = self->config.loop_bus;
+    config.metrics = self->metrics;
 
     ov_interconnect_loop *loop = ov_interconnect_loop_create(config);
 
@@ -1732,6 +1783,17 @@ int ov_interconnect_get_media_socket(const ov_interconnect *self) {
 
 /*----------------------------------------------------------------------------*/
 
+ov_dtls_handshake_pool *
+ov_interconnect_get_dtls_handshake_pool(const ov_interconnect *self) {
+
+    if (!self)
+        return NULL;
+
+    return self->handshakes;
+}
+
+/*----------------------------------------------------------------------------*/
+
 const ov_interconnect_loop *
 ov_interconnect_get_loop(const ov_interconnect *self, const char *name) {
 
@@ -1841,4 +1903,31 @@ done:
 error:
     ov_json_value_free(out);
     return false;
-}
\ No newline at end of file
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_interconnect_get_metrics(ov_interconnect *self) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+
+    if (!ov_interconnect_cast(self))
+        goto error;
+
+    out = ov_metrics_to_json(self->metrics);
+    if (!out)
+        goto error;
+
+    val = ov_dtls_handshake_pool_stats_to_json(
+        ov_dtls_handshake_pool_get_stats(self->handshakes));
+
+    if (!ov_json_object_set(out, OV_KEY_DTLS_HANDSHAKE, val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
@@ -30,9 +30,10 @@
 #include "../include/ov_interconnect_loop.h"
 
 #include <ov_base/ov_convert.h>
+#include <ov_base/ov_loop_bus.h>
 #include <ov_base/ov_mc_socket.h>
 #include <ov_base/ov_random.h>
-#include <ov_base/ov_rtp_frame.h>
+#include <ov_base/ov_rtp_view.h>
 
 /*----------------------------------------------------------------------------*/
 
@@ -45,9 +46,18 @@ struct ov_interconnect_loop {
     ov_socket_data local;
     int socket;
 
+    ov_loop_bus *bus;
+
     ov_mixer_data mixer;
 
     uint16_t sequence_number;
+
+    struct {
+
+        ov_metrics_series *frames_in;
+        ov_metrics_series *frames_out;
+
+    } metric;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -58,8 +68,7 @@ static bool io_from_mixer(int socket, uint8_t events, void *userdata) {
     ov_socket_data remote = {};
     socklen_t src_addr_len = sizeof(remote.sa);
 
-    ov_rtp_frame *frame = NULL;
-    ov_rtp_frame *out = NULL;
+    ov_rtp_view frame = {0};
 
     ov_interconnect_loop *self = (ov_interconnect_loop *)userdata;
     if (!self || !socket)
@@ -79,28 +88,18 @@ static bool io_from_mixer(int socket, uint8_t events, void *userdata) {
     if (bytes < 1)
         goto error;
 
-    frame = ov_rtp_frame_decode(buffer, bytes);
-    if (!frame) {
+    if (!ov_rtp_view_parse(&frame, buffer, bytes)) {
         ov_log_error("Not a RTP frame.");
         goto error;
     }
 
     self->sequence_number++;
+    ov_rtp_view_set_sequence_number(&frame, self->sequence_number);
 
-    ov_rtp_frame_expansion exp = frame->expanded;
-    exp.sequence_number = self->sequence_number;
-
-    out = ov_rtp_frame_encode(&exp);
+    ov_metrics_count(self->metric.frames_in, 1);
 
-    bool result = ov_interconnect_loop_io(self->config.base, self,
-                                          out->bytes.data, out->bytes.length);
-
-    frame = ov_rtp_frame_free(frame);
-    out = ov_rtp_frame_free(out);
-    return result;
+    return ov_interconnect_loop_io(self->config.base, self, buffer, bytes);
 error:
-    frame = ov_rtp_frame_free(frame);
-    ov_rtp_frame_free(out);
     return false;
 }
 
@@ -131,6 +130,11 @@ ov_interconnect_loop_create(ov_interconnect_loop_config config) {
     self->config = config;
     self->ssrc = ov_random_uint32();
 
+    self->metric.frames_in =
+        ov_metrics_counter(config.metrics, "frames_in", config.name);
+    self->metric.frames_out =
+        ov_metrics_counter(config.metrics, "frames_out", config.name);
+
     ov_socket_configuration socket = config.internal;
     socket.type = UDP;
     socket.port = 0;
@@ -146,6 +150,24 @@ ov_interconnect_loop_create(ov_interconnect_loop_config config) {
     if (!ov_socket_get_data(self->socket, &self->local, NULL))
         goto error;
 
+    if (config.loop_bus) {
+
+        ov_loop_bus_config bus = {0};
+
+        if (ov_loop_bus_name(config.multicast, bus.name, sizeof(bus.name)))
+            self->bus = ov_loop_bus_create(bus);
+
+        if (!self->bus) {
+            ov_log_error("could not open loop bus %s", config.name);
+            goto error;
+        }
+
+        /* subscribers of the host receive the bus only */
+
+        if (!ov_loop_bus_multicast_loop(self->socket, false))
+            goto error;
+    }
+
     ov_log_debug("opened LOOP receiver %s | %s:%i for %s:%i", self->config.name,
                  self->local.host, self->local.port,
                  self->config.multicast.host, self->config.multicast.port);
@@ -177,6 +199,8 @@ void *ov_interconnect_loop_free(void *data) {
         self->socket = -1;
     }
 
+    self->bus = ov_loop_bus_free(self->bus);
+
     ov_interconnect_drop_mixer(self->config.base, self->mixer.socket);
     self = ov_data_pointer_free(self);
     return NULL;
@@ -323,6 +347,11 @@ bool ov_interconnect_loop_send(const ov_interconnect_loop *self,
     if (out != (ssize_t)size)
         goto error;
 
+    if (self->bus && !ov_loop_bus_publish(self->bus, buffer, size))
+        goto error;
+
+    ov_metrics_count(self->metric.frames_out, 1);
+
     return true;
 error:
     return false;
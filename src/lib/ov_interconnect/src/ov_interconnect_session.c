@@ -43,7 +43,7 @@
 #include <ov_base/ov_convert.h>
 #include <ov_base/ov_dict.h>
 #include <ov_base/ov_id.h>
-#include <ov_base/ov_rtp_frame.h>
+#include <ov_base/ov_rtp_view.h>
 #include <ov_base/ov_socket.h>
 #include <ov_base/ov_string.h>
 
@@ -77,6 +77,9 @@ struct ov_interconnect_session {
         BIO *read;
         BIO *write;
 
+        /* passive handshakes are processed off the loop */
+        ov_dtls_handshake *handshake;
+
     } dtls;
 
     struct {
@@ -286,6 +289,8 @@ void *ov_interconnect_session_free(void *data) {
     self->ssrcs = ov_dict_free(self->ssrcs);
     self->loops = ov_dict_free(self->loops);
 
+    self->dtls.handshake = ov_dtls_handshake_free(self->dtls.handshake);
+
     if (self->dtls.ssl) {
         SSL_free(self->dtls.ssl);
         self->dtls.ssl = NULL;
@@ -617,6 +622,8 @@ bool ov_interconnect_session_handshake_active(ov_interconnect_session *self,
 
     memcpy(self->remote.fingerprint, fingerprint, OV_DTLS_FINGERPRINT_MAX);
 
+    self->dtls.handshake = ov_dtls_handshake_free(self->dtls.handshake);
+
     if (self->dtls.ssl) {
 
         SSL_free(self->dtls.ssl);
@@ -1012,111 +1019,101 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static bool handshake_passive(ov_interconnect_session *self,
-                              const uint8_t *buffer, size_t size) {
+static bool srtp_start(ov_interconnect_session *self, const char *profile) {
 
-    int r = 0, n = 0;
-
-    if (!self)
-        goto error;
+    self->srtp.ready = true;
+    self->srtp.profile = ov_data_pointer_free(self->srtp.profile);
+    self->srtp.profile = strdup(profile);
 
-    ov_dtls *dtls = self->config.dtls;
+    if (self->srtp.local.session)
+        return true;
 
-    if (self->dtls.ssl) {
-        SSL_free(self->dtls.ssl);
-        self->dtls.ssl = NULL;
-    }
+    srtp_err_status_t r = srtp_create(&self->srtp.local.session, NULL);
 
-    self->dtls.dtls = dtls;
-    self->dtls.handshaked = false;
-    self->dtls.type = OV_DTLS_PASSIVE;
-    self->dtls.ssl = SSL_new(ov_dtls_get_ctx(dtls));
+    switch (r) {
 
-    if (!self->dtls.ssl)
-        goto error;
+    case srtp_err_status_ok:
+        ov_log_debug("Session %s SRTP READY", self->id);
+        prepare_streams(self);
+        ov_interconnect_srtp_ready(self->config.base, self);
 
-    SSL_set_accept_state(self->dtls.ssl);
+        break;
 
-    r = SSL_set_tlsext_use_srtp(self->dtls.ssl, ov_dtls_get_srtp_profile(dtls));
-    if (0 != r)
-        goto error;
+    default:
+        ov_log_error("Session %s srtp failed %i", self->id, r);
+        return false;
+    }
 
-    self->dtls.read = BIO_new(BIO_s_mem());
-    self->dtls.write = ov_interconnect_dtls_bio_create(self);
-    BIO_set_mem_eof_return(self->dtls.read, -1);
-    BIO_set_mem_eof_return(self->dtls.write, -1);
+    return true;
+}
 
-    SSL_set_bio(self->dtls.ssl, self->dtls.read, self->dtls.write);
-    SSL_set_options(self->dtls.ssl, SSL_OP_COOKIE_EXCHANGE);
+/*----------------------------------------------------------------------------*/
 
-    r = BIO_write(self->dtls.read, buffer, size);
-    if (r < 0)
-        goto error;
+static ssize_t handshake_send(void *userdata, const uint8_t *buffer,
+                              size_t size) {
 
-    BIO_ADDR *peer_bio = BIO_ADDR_new();
+    return ov_interconnect_session_send(userdata, buffer, size);
+}
 
-    r = DTLSv1_listen(self->dtls.ssl, peer_bio);
+/*----------------------------------------------------------------------------*/
 
-    if (peer_bio) {
-        BIO_ADDR_free(peer_bio);
-        peer_bio = NULL;
-    }
+static void handshake_keys(void *userdata, const ov_dtls_srtp_keys *keys) {
 
-    if (r >= 1) {
+    ov_interconnect_session *self = (ov_interconnect_session *)userdata;
+    if (!self || !keys)
+        return;
 
-        self->dtls.handshaked = true;
-        goto done;
+    if ((keys->key_len > OV_DTLS_KEY_MAX) ||
+        (keys->salt_len > OV_DTLS_SALT_MAX))
+        return;
 
-    } else if (r == 0) {
+    self->dtls.handshaked = true;
 
-        /*
-         *      Non Fatal error, usercode is expected to
-         *      retry operation. (man DTLSv1_listen)
-         */
+    srtp_unset_data(self);
 
-        self->dtls.dtls = NULL;
+    self->srtp.key_len = keys->key_len;
+    self->srtp.salt_len = keys->salt_len;
 
-        SSL_free(self->dtls.ssl);
-        self->dtls.ssl = NULL;
+    memcpy(self->srtp.server.key, keys->server.key, keys->key_len);
+    memcpy(self->srtp.server.salt, keys->server.salt, keys->salt_len);
+    memcpy(self->srtp.client.key, keys->client.key, keys->key_len);
+    memcpy(self->srtp.client.salt, keys->client.salt, keys->salt_len);
 
-    } else {
+    srtp_start(self, keys->profile);
+}
 
-        n = SSL_get_error(self->dtls.ssl, r);
+/*----------------------------------------------------------------------------*/
 
-        switch (n) {
+static bool handshake_passive(ov_interconnect_session *self) {
 
-        case SSL_ERROR_NONE:
-        case SSL_ERROR_WANT_READ:
-        case SSL_ERROR_WANT_CONNECT:
-        case SSL_ERROR_WANT_ACCEPT:
-        case SSL_ERROR_WANT_X509_LOOKUP:
-        case SSL_ERROR_WANT_WRITE:
-            break;
+    if (!self)
+        goto error;
 
-        case SSL_ERROR_ZERO_RETURN:
-            // connection close
-            // ov_log_debug("FD %i connection closed", socket);
-            goto error;
-            break;
+    ov_dtls *dtls = self->config.dtls;
 
-        case SSL_ERROR_SYSCALL:
-            goto error;
+    const char *profile = ov_dtls_get_srtp_profile(dtls);
+    if (!profile || (strlen(profile) >= OV_DTLS_PROFILE_MAX))
+        goto error;
 
-            break;
+    ov_dtls_handshake_config config = (ov_dtls_handshake_config){
+        .ctx = ov_dtls_get_ctx(dtls),
+        .callback.userdata = self,
+        .callback.send = handshake_send,
+        .callback.keys = handshake_keys};
 
-        case SSL_ERROR_SSL:
-            goto error;
+    strcpy(config.srtp_profile, profile);
 
-            break;
+    self->dtls.handshake = ov_dtls_handshake_free(self->dtls.handshake);
+    self->dtls.handshake = ov_dtls_handshake_passive(
+        ov_interconnect_get_dtls_handshake_pool(self->config.base), config);
 
-        default:
+    if (!self->dtls.handshake)
+        goto error;
 
-            goto error;
-            break;
-        }
-    }
+    self->dtls.dtls = dtls;
+    self->dtls.handshaked = false;
+    self->dtls.type = OV_DTLS_PASSIVE;
 
-done:
     return true;
 error:
     return false;
@@ -1138,8 +1135,14 @@ bool ov_interconnect_session_media_io_ssl_external(
     if (!self || !buffer || size < 1)
         goto error;
 
-    if (!self->dtls.dtls)
-        return handshake_passive(self, buffer, size);
+    if (!self->dtls.dtls && !handshake_passive(self))
+        goto error;
+
+    /* The loop only passes the datagram, SSL is processed within the
+     * handshake pool. */
+
+    if (self->dtls.handshake)
+        return ov_dtls_handshake_input(self->dtls.handshake, buffer, size);
 
     r = BIO_write(self->dtls.read, buffer, size);
     if (r < 0)
@@ -1147,22 +1150,7 @@ bool ov_interconnect_session_media_io_ssl_external(
 
     if (!SSL_is_init_finished(self->dtls.ssl)) {
 
-        switch (self->dtls.type) {
-
-        case OV_DTLS_PASSIVE:
-
-            r = SSL_do_handshake(self->dtls.ssl);
-
-            if (SSL_is_init_finished(self->dtls.ssl)) {
-                self->dtls.handshaked = true;
-            }
-
-            break;
-
-        case OV_DTLS_ACTIVE:
-            perform_ssl_client_handshake(self);
-            break;
-        }
+        perform_ssl_client_handshake(self);
 
         srtp_unset_data(self);
 
@@ -1171,32 +1159,8 @@ bool ov_interconnect_session_media_io_ssl_external(
             self->srtp.server.key, self->srtp.server.salt,
             self->srtp.client.key, self->srtp.client.salt);
 
-        if (profile) {
-
-            self->srtp.ready = true;
-            self->srtp.profile = ov_data_pointer_free(self->srtp.profile);
-            self->srtp.profile = strdup(profile);
-
-            if (!self->srtp.local.session) {
-
-                srtp_err_status_t r =
-                    srtp_create(&self->srtp.local.session, NULL);
-
-                switch (r) {
-
-                case srtp_err_status_ok:
-                    ov_log_debug("Session %s SRTP READY", self->id);
-                    prepare_streams(self);
-                    ov_interconnect_srtp_ready(self->config.base, self);
-
-                    break;
-
-                default:
-                    ov_log_error("Session %s srtp failed %i", self->id, r);
-                    goto error;
-                }
-            }
-        }
+        if (profile && !srtp_start(self, profile))
+            goto error;
 
     } else {
 
@@ -1337,13 +1301,12 @@ bool ov_interconnect_session_media_io_external(ov_interconnect_session *self,
 
     /* Remote is external media remote */
 
-    ov_rtp_frame *frame = NULL;
+    ov_rtp_view frame = {0};
 
     if (!self || !buffer || !size || !remote)
         goto error;
 
-    frame = ov_rtp_frame_decode(buffer, size);
-    if (!frame) {
+    if (!ov_rtp_view_parse(&frame, buffer, size)) {
         ov_log_error("Not a RTP frame.");
         goto ignore;
     }
@@ -1397,8 +1360,8 @@ bool ov_interconnect_session_media_io_external(ov_interconnect_session *self,
         break;
     }
 
-    char *loop_name =
-        ov_dict_get(self->ssrcs, (void *)(uintptr_t)frame->expanded.ssrc);
+    char *loop_name = ov_dict_get(
+        self->ssrcs, (void *)(uintptr_t)ov_rtp_view_ssrc(&frame));
 
     if (!loop_name) {
         ov_log_error("Could not find loopname.");
@@ -1418,8 +1381,7 @@ bool ov_interconnect_session_media_io_external(ov_interconnect_session *self,
     uint32_t ssrc_to_set = ov_interconnect_loop_get_ssrc(loop);
 
     /* set SSRC to internal SSRC */
-    uint32_t u32 = htonl(ssrc_to_set);
-    memcpy(buffer + 8, &u32, 4);
+    ov_rtp_view_set_ssrc(&frame, ssrc_to_set);
 
     if (!ov_interconnect_loop_send(loop, buffer, l)) {
         ov_log_error("Could not send at loop %s", loop_name);
@@ -1427,10 +1389,8 @@ bool ov_interconnect_session_media_io_external(ov_interconnect_session *self,
     }
 
 ignore:
-    frame = ov_rtp_frame_free(frame);
     return true;
 error:
-    frame = ov_rtp_frame_free(frame);
     return false;
 }
 
@@ -1455,12 +1415,15 @@ bool ov_interconnect_session_forward_loop_io(ov_interconnect_session *self,
     uint32_t ssrc_to_set = ov_interconnect_loop_get_ssrc(loop);
 
     /* (3) set ssrc and payload type*/
-    uint32_t u32 = htonl(ssrc_to_set);
-    memcpy(buffer + 8, &u32, 4);
+    ov_rtp_view rtp = {0};
+
+    if (!ov_rtp_view_parse(&rtp, buffer, size))
+        goto error;
+
+    ov_rtp_view_set_ssrc(&rtp, ssrc_to_set);
 
     // we set payload type to 100
-    buffer[1] = 0x80 & buffer[1];
-    buffer[1] |= 0X64;
+    ov_rtp_view_set_payload_type(&rtp, 0x64);
 
     int out = size;
 
@@ -27,8 +27,10 @@
 #ifndef ov_log_ng_h
 #define ov_log_ng_h
 
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /*----------------------------------------------------------------------------*/
 
@@ -115,6 +117,70 @@ bool ov_log_ng(ov_log_level level, char const *file, char const *function,
 
 /*----------------------------------------------------------------------------*/
 
+/**
+ * Per-callsite cache for the resolved output of a log statement.
+ *
+ * Every ov_log_* macro expansion owns a static instance. On first use, the
+ * output configured for the file/function of the statement is resolved and
+ * stored along with its effective level, tagged with the configuration
+ * generation.
+ *
+ * `ov_log_set_output`, `ov_log_mute`, `ov_log_unmute`, `ov_log_init` and
+ * `ov_log_close` bump the generation, invalidating all cached entries.
+ *
+ * A statement that is filtered out thus costs loading the site state and
+ * comparing it against the current generation and level - no lookup is done.
+ */
+typedef struct {
+
+    /* (generation << 8) | effective level, 0 if never resolved */
+    _Atomic uint64_t state;
+    void *_Atomic output;
+
+} ov_log_callsite;
+
+/**
+ * Current configuration generation. Starts with 1, hence a zeroed
+ * ov_log_callsite is always stale.
+ * Do not modify directly.
+ */
+extern _Atomic uint64_t ov_log_generation;
+
+/**
+ * @return true if a statement with `level` would be discarded by the output
+ * cached in `site`. If the site is stale, returns false.
+ */
+static inline bool ov_log_callsite_filtered(ov_log_callsite *site,
+                                            ov_log_level level) {
+
+    /* If the generation of `site` is outdated, the subtraction wraps around
+     * and the comparison always fails */
+    uint64_t threshold =
+        atomic_load_explicit(&site->state, memory_order_acquire) -
+        (atomic_load_explicit(&ov_log_generation, memory_order_relaxed) << 8);
+
+    return (uint64_t)level > threshold;
+}
+
+/**
+ * Like `ov_log_ng`, but resolves the output via `site` and refreshes it
+ * if stale.
+ */
+bool ov_log_ng_site(ov_log_callsite *site, ov_log_level level,
+                    char const *file, char const *function, size_t line,
+                    char const *format, ...);
+
+#define OV_LOG_SITE_INTERNAL(level, M, ...)                                    \
+    ({                                                                         \
+        static ov_log_callsite ov_log_site_internal_ = {0};                    \
+        ov_log_callsite_filtered(&ov_log_site_internal_, level)                \
+            ? true                                                             \
+            : ov_log_ng_site(&ov_log_site_internal_, level, __FILE__,          \
+                             __FUNCTION__, __LINE__, M, ##__VA_ARGS__);        \
+    })
+
+/*----------------------------------------------------------------------------*/
+
 /**
  * Stop logging anything but error messages
  */
@@ -141,31 +207,30 @@ void ov_log_unmute();
 #undef ov_log_emergency
 
 #define ov_log_dev(M, ...)                                                     \
-    ov_log_ng(OV_LOG_DEV, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_DEV, M, ##__VA_ARGS__)
 
 #define ov_log_debug(M, ...)                                                   \
-    ov_log_ng(OV_LOG_DEBUG, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_DEBUG, M, ##__VA_ARGS__)
 
 #define ov_log_info(M, ...)                                                    \
-    ov_log_ng(OV_LOG_INFO, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_INFO, M, ##__VA_ARGS__)
 
 #define ov_log_notice(M, ...)                                                  \
-    ov_log_ng(OV_LOG_NOTICE, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_NOTICE, M, ##__VA_ARGS__)
 
 #define ov_log_warning(M, ...)                                                 \
-    ov_log_ng(OV_LOG_WARNING, __FILE__, __FUNCTION__, __LINE__, M,             \
-              ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_WARNING, M, ##__VA_ARGS__)
 
 #define ov_log_error(M, ...)                                                   \
-    ov_log_ng(OV_LOG_ERR, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_ERR, M, ##__VA_ARGS__)
 
 #define ov_log_critical(M, ...)                                                \
-    ov_log_ng(OV_LOG_CRIT, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_CRIT, M, ##__VA_ARGS__)
 
 #define ov_log_alert(M, ...)                                                   \
-    ov_log_ng(OV_LOG_ALERT, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_ALERT, M, ##__VA_ARGS__)
 
 #define ov_log_emergency(M, ...)                                               \
-    ov_log_ng(OV_LOG_EMERG, __FILE__, __FUNCTION__, __LINE__, M, ##__VA_ARGS__)
+    OV_LOG_SITE_INTERNAL(OV_LOG_EMERG, M, ##__VA_ARGS__)
 
 #endif /* ov_log_ng_h */
@@ -286,6 +286,19 @@ static module_output g_default_output = {
 
 static bool g_muted = false;
 
+_Atomic uint64_t ov_log_generation = 1;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Invalidates all ov_log_callsite caches.
+ * Must be called whenever the result of `output_for` or the effective
+ * level might change.
+ */
+static void bump_generation() {
+    atomic_fetch_add_explicit(&ov_log_generation, 1, memory_order_acq_rel);
+}
+
 /*****************************************************************************
                                      CREATE
  ****************************************************************************/
@@ -319,6 +332,10 @@ bool ov_log_init() {
 
     /* Number of buckets should be in the order of number of modules */
     g_default_output.func_outputs = log_hashtable_create(100);
+
+    /* Only after the table is in place, otherwise a callsite might cache
+     * a resolution made against the old state */
+    bump_generation();
     return 0 != g_default_output.func_outputs;
 }
 
@@ -414,6 +431,9 @@ bool ov_log_close() {
         .output.filehandle = DEFAULT_FILEHANDLE,
     };
 
+    /* Callsites must not refer to the outputs freed above */
+    bump_generation();
+
     return retval;
 }
 
@@ -465,8 +485,11 @@ static int set_module_output(module_output *mout, const ov_log_output output,
 int ov_log_set_output(char const *module_name, char const *function_name,
                       ov_log_level level, const ov_log_output output) {
 
+    int old = -1;
+
     if (0 == module_name) {
-        return set_module_output(&g_default_output, output, level);
+        old = set_module_output(&g_default_output, output, level);
+        goto done;
     }
 
     LOG_ASSERT(0 != module_name);
@@ -483,7 +506,8 @@ int ov_log_set_output(char const *module_name, char const *function_name,
     LOG_ASSERT(0 != mout->func_outputs);
 
     if (0 == function_name) {
-        return set_module_output(mout, output, level);
+        old = set_module_output(mout, output, level);
+        goto done;
     }
 
     module_output *fout = log_hashtable_get(mout->func_outputs, function_name);
@@ -496,7 +520,14 @@ int ov_log_set_output(char const *module_name, char const *function_name,
     LOG_ASSERT(0 != fout);
     LOG_ASSERT(FUNC_MAGIC_NUMBER == fout->magic_number);
 
-    return set_module_output(fout, output, level);
+    old = set_module_output(fout, output, level);
+
+done:
+
+    /* Bump only once the new output is complete, so no callsite caches a
+     * half-configured output */
+    bump_generation();
+    return old;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -745,34 +776,21 @@ static bool rotate_log_if_required(module_output *mout) {
                                       LOG
  ****************************************************************************/
 
-bool ov_log_ng(ov_log_level level, char const *file, char const *function,
-               size_t line, char const *format, ...) {
-
-    va_list ap;
-
-    if (g_muted && (OV_LOG_ERR < level)) {
-        return true;
-    }
-
-    if ((0 == file) || (0 == format)) {
-        goto error;
-    }
+static bool log_to_output(module_output *fout, ov_log_level level,
+                          char const *file, char const *function, size_t line,
+                          char const *format, va_list ap) {
 
-    module_output *fout = output_for(file, function);
+    LOG_ASSERT(0 != fout);
+    LOG_ASSERT(0 != file);
+    LOG_ASSERT(0 != format);
 
-    if (level > fout->level) {
-        return true;
-    }
+    va_list ap_systemd;
 
     if (0 == function) {
         function = "UNKNOWN";
     }
 
-    LOG_ASSERT(0 != file);
-    LOG_ASSERT(0 != function);
-    LOG_ASSERT(0 != format);
-
-    va_start(ap, format);
+    va_copy(ap_systemd, ap);
 
     bool logged_to_stream = false;
     bool should_log_to_stream = (0 < fout->output.filehandle);
@@ -794,31 +812,134 @@ bool ov_log_ng(ov_log_level level, char const *file, char const *function,
 
     rotate_log_if_required(fout);
 
-    va_end(ap);
-
-    va_start(ap, format);
-
     if (fout->output.use.systemd &&
-        (!log_to_systemd(level, file, function, line, format, ap))) {
+        (!log_to_systemd(level, file, function, line, format, ap_systemd))) {
         goto error;
     }
 
-    va_end(ap);
+    va_end(ap_systemd);
 
     return true;
 
 error:
 
-    va_end(ap);
+    va_end(ap_systemd);
     return false;
 }
 
 /*----------------------------------------------------------------------------*/
 
-void ov_log_mute() { g_muted = true; }
+bool ov_log_ng(ov_log_level level, char const *file, char const *function,
+               size_t line, char const *format, ...) {
+
+    if (g_muted && (OV_LOG_ERR < level)) {
+        return true;
+    }
+
+    if ((0 == file) || (0 == format)) {
+        return false;
+    }
+
+    module_output *fout = output_for(file, function);
+
+    if (level > fout->level) {
+        return true;
+    }
+
+    va_list ap;
+    va_start(ap, format);
+
+    bool result = log_to_output(fout, level, file, function, line, format, ap);
+
+    va_end(ap);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static module_output *resolve_callsite(ov_log_callsite *site,
+                                       char const *file,
+                                       char const *function) {
+
+    LOG_ASSERT(0 != site);
+    LOG_ASSERT(0 != file);
+
+    uint64_t generation =
+        atomic_load_explicit(&ov_log_generation, memory_order_acquire);
+
+    uint64_t state = atomic_load_explicit(&site->state, memory_order_acquire);
+
+    if ((state >> 8) == generation) {
+        return atomic_load_explicit(&site->output, memory_order_relaxed);
+    }
+
+    module_output *fout = output_for(file, function);
+
+    ov_log_level level = fout->level;
+
+    if (g_muted && (OV_LOG_ERR < level)) {
+        level = OV_LOG_ERR;
+    }
+
+    // If the level cannot be cached, the site stays stale - and the
+    // next call resolves again
+    if ((0 <= level) && (0xff > level)) {
+
+        atomic_store_explicit(&site->output, fout, memory_order_relaxed);
+        atomic_store_explicit(&site->state, (generation << 8) | level,
+                              memory_order_release);
+    }
+
+    return fout;
+}
 
 /*----------------------------------------------------------------------------*/
 
-void ov_log_unmute() { g_muted = false; }
+bool ov_log_ng_site(ov_log_callsite *site, ov_log_level level,
+                    char const *file, char const *function, size_t line,
+                    char const *format, ...) {
+
+    if (0 == site) {
+        return false;
+    }
+
+    if (g_muted && (OV_LOG_ERR < level)) {
+        return true;
+    }
+
+    if ((0 == file) || (0 == format)) {
+        return false;
+    }
+
+    module_output *fout = resolve_callsite(site, file, function);
+
+    if (level > fout->level) {
+        return true;
+    }
+
+    va_list ap;
+    va_start(ap, format);
+
+    bool result = log_to_output(fout, level, file, function, line, format, ap);
+
+    va_end(ap);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+void ov_log_mute() {
+    g_muted = true;
+    bump_generation();
+}
+
+/*----------------------------------------------------------------------------*/
+
+void ov_log_unmute() {
+    g_muted = false;
+    bump_generation();
+}
 
 /*----------------------------------------------------------------------------*/
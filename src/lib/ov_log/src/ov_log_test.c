@@ -30,8 +30,10 @@
 #include "testrun.h"
 
 #include <ftw.h>
+#include <inttypes.h>
 #include <stdio.h>
 #include <sys/stat.h>
+#include <time.h>
 
 /*----------------------------------------------------------------------------*/
 
@@ -369,6 +371,145 @@ static int test_ov_log() {
 
 /*----------------------------------------------------------------------------*/
 
+static void log_debug_via_callsite() { ov_log_debug("DEBUG"); }
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_log_callsite() {
+
+    ov_log_init();
+
+    int fh = file_temp();
+    FILE *f = get_file_ptr(fh);
+    testrun(0 != f);
+
+    testrun(ov_log_set_output("ov_log_test.c", 0, OV_LOG_INFO,
+                              (ov_log_output){
+                                  .filehandle = fh,
+                              }));
+
+    log_debug_via_callsite();
+    testrun(file_empty(f));
+
+    // Callsite is cached now - changing the output must invalidate it
+    ov_log_set_output("ov_log_test.c", 0, OV_LOG_DEBUG,
+                      (ov_log_output){
+                          .filehandle = fh,
+                      });
+
+    log_debug_via_callsite();
+    testrun(!file_empty(f));
+    testrun(file_clear(f));
+
+    ov_log_mute();
+    log_debug_via_callsite();
+    testrun(file_empty(f));
+
+    ov_log_unmute();
+    log_debug_via_callsite();
+    testrun(!file_empty(f));
+    testrun(file_clear(f));
+
+    // Function specific output takes precedence
+    int fh_func = file_temp();
+    FILE *f_func = get_file_ptr(fh_func);
+    testrun(0 != f_func);
+
+    testrun(ov_log_set_output("ov_log_test.c", "log_debug_via_callsite",
+                              OV_LOG_DEBUG,
+                              (ov_log_output){
+                                  .filehandle = fh_func,
+                              }));
+
+    log_debug_via_callsite();
+    testrun(file_empty(f));
+    testrun(!file_empty(f_func));
+
+    // After closing, fall back to the default output, which must not
+    // crash although the cached output has been freed
+    ov_log_close();
+
+    ov_log_set_output(0, 0, OV_LOG_INFO,
+                      (ov_log_output){
+                          .filehandle = -1,
+                      });
+
+    log_debug_via_callsite();
+
+    fclose(f);
+    fclose(f_func);
+
+    ov_log_close();
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t now_nsecs() {
+
+    struct timespec ts = {0};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_log_filtered_benchmark() {
+
+    const size_t runs = 1000 * 1000;
+
+    ov_log_init();
+
+    // Several modules and functions configured to fill the lookup tables
+    ov_log_set_output("aaa.c", 0, OV_LOG_DEBUG,
+                      (ov_log_output){.filehandle = -1});
+    ov_log_set_output("ov_log_test.c", "not_our_func", OV_LOG_DEBUG,
+                      (ov_log_output){.filehandle = -1});
+
+    int fh = file_temp();
+    FILE *f = get_file_ptr(fh);
+    testrun(0 != f);
+
+    testrun(ov_log_set_output("ov_log_test.c", 0, OV_LOG_INFO,
+                              (ov_log_output){.filehandle = fh}));
+
+    uint64_t start = now_nsecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_log_ng(OV_LOG_DEBUG, __FILE__, __FUNCTION__, __LINE__, "%zu", i);
+    }
+
+    uint64_t lookup_nsecs = now_nsecs() - start;
+
+    start = now_nsecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        ov_log_debug("%zu", i);
+    }
+
+    uint64_t callsite_nsecs = now_nsecs() - start;
+
+    fprintf(stdout,
+            "Filtered log statements (%zu runs): lookup %" PRIu64
+            " ns/call, cached callsite %" PRIu64 " ns/call\n",
+            runs, lookup_nsecs / runs, callsite_nsecs / runs);
+
+    // Timings depend on the host, only the filtering is checked
+    testrun(file_empty(f));
+
+    ov_log_info("passes the filter");
+    testrun(!file_empty(f));
+
+    fclose(f);
+
+    ov_log_close();
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 static int test_ov_log_level_from_string() {
 
     testrun(OV_LOG_INVALID == ov_log_level_from_string(0));
@@ -421,4 +562,5 @@ static int tear_down() {
 /*----------------------------------------------------------------------------*/
 
 RUN_TESTS("ov_log", init, test_ov_log, test_ov_log_level_from_string,
-          test_ov_log_level_to_string, tear_down);
+          test_ov_log_level_to_string, test_ov_log_callsite,
+          test_ov_log_filtered_benchmark, tear_down);
@@ -0,0 +1,181 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+
+        View of some SIP message within the receive buffer.
+
+        ov_sip_view_parse accepts the same messages as ov_sip_serde,
+        but neither allocates nor copies. It records where start line,
+        headers and body are located within the receive buffer.
+        Well known headers are looked up by index, all other headers
+        by name.
+
+        Strings are only materialised on demand, e.g. by
+        ov_sip_view_to_message.
+
+        Streaming:
+
+        If the buffer does not contain a complete message yet, parse
+        returns 0 and remembers how far it got. Call parse again with
+        the same view and the grown buffer. The buffer may move in
+        between, but the octets already passed MUST NOT change.
+
+        Once parse returned the length of a complete message, the view
+        refers to this message until the next call. Drop the octets
+        from the receive buffer before calling parse again.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef OV_SIP_VIEW_H
+#define OV_SIP_VIEW_H
+/*----------------------------------------------------------------------------*/
+
+#include "ov_sip_message.h"
+#include <sys/types.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define OV_SIP_VIEW_HEADERS_MAX 64
+
+/* Largest message accepted, start line and headers included */
+#define OV_SIP_VIEW_OCTETS_MAX 65535
+
+/*----------------------------------------------------------------------------*/
+
+typedef enum {
+
+    OV_SIP_VIEW_VIA = 0,
+    OV_SIP_VIEW_CALL_ID,
+    OV_SIP_VIEW_CSEQ,
+    OV_SIP_VIEW_CONTENT_LENGTH,
+    OV_SIP_VIEW_CONTENT_TYPE,
+    OV_SIP_VIEW_FROM,
+    OV_SIP_VIEW_TO,
+    OV_SIP_VIEW_CONTACT,
+    OV_SIP_VIEW_MAX_FORWARDS,
+
+    OV_SIP_VIEW_KNOWN_HEADERS
+
+} ov_sip_view_header;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint32_t offset;
+    uint32_t length;
+
+} ov_sip_view_span;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_sip_view {
+
+    char const *data;
+
+    ov_sip_message_type type;
+
+    /* request: method and URI, response: code and reason */
+    ov_sip_view_span method;
+    ov_sip_view_span uri;
+    uint16_t code;
+    ov_sip_view_span reason;
+
+    size_t num_headers;
+
+    struct {
+        ov_sip_view_span name;
+        ov_sip_view_span value;
+    } headers[OV_SIP_VIEW_HEADERS_MAX];
+
+    /* index into headers + 1 of the first occurrence, 0 if not present */
+    uint8_t known[OV_SIP_VIEW_KNOWN_HEADERS];
+
+    ov_sip_view_span body;
+
+    /* streaming state, internal */
+    struct {
+        size_t skipped;
+        size_t scanned;
+        size_t header_end;
+    } stream;
+
+} ov_sip_view;
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Parse the next message within data.
+ *
+ * Empty lines in front of the message, e.g. keep alives, are skipped
+ * and counted in the return value.
+ *
+ * @return length of the message within data, 0 if the message is not
+ * complete yet, -1 if data does not contain a valid SIP message
+ */
+ssize_t ov_sip_view_parse(ov_sip_view *self, char const *data, size_t length);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @param length set to the length of the value
+ * @return value of the first header of id, not zero terminated, or 0
+ */
+char const *ov_sip_view_header_get(ov_sip_view const *self,
+                                   ov_sip_view_header id, size_t *length);
+
+/**
+ * Look up some header by its name, case insensitive.
+ * Compact forms of well known headers, e.g. "i" for "Call-ID", are found
+ * by either name.
+ */
+char const *ov_sip_view_header_by_name(ov_sip_view const *self,
+                                       char const *name, size_t *length);
+
+/**
+ * Iterate all headers in the order received.
+ * @param pos iterator, MUST be 0 for the first call
+ */
+bool ov_sip_view_header_next(ov_sip_view const *self, size_t *pos,
+                             char const **name, size_t *name_length,
+                             char const **value, size_t *value_length);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @return CSeq number, 0 if not present or invalid
+ */
+uint32_t ov_sip_view_cseq(ov_sip_view const *self, char const **method,
+                          size_t *method_length);
+
+uint32_t ov_sip_view_content_length(ov_sip_view const *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Materialise the message viewed.
+ * Well known headers are set with their full name, even if received in
+ * compact form.
+ */
+ov_sip_message *ov_sip_view_to_message(ov_sip_view const *self);
+
+/*----------------------------------------------------------------------------*/
+#endif
@@ -0,0 +1,640 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sip_view.c
+
+        @date           2026-10-18
+
+        ------------------------------------------------------------------------
+*/
+
+#include "../include/ov_sip_view.h"
+#include "../include/ov_sip_headers.h"
+#include <ov_base/ov_string.h>
+#include <ov_base/ov_utils.h>
+#include <string.h>
+#include <strings.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define SP ' '
+#define HTAB '\t'
+#define CR '\r'
+#define LF '\n'
+#define SIP_VERSION "SIP/2.0"
+
+/*----------------------------------------------------------------------------*/
+
+static struct {
+
+    char const *name;
+    char const *compact;
+
+} const g_known_headers[OV_SIP_VIEW_KNOWN_HEADERS] = {
+
+    [OV_SIP_VIEW_VIA] = {OV_SIP_HEADER_VIA, "v"},
+    [OV_SIP_VIEW_CALL_ID] = {OV_SIP_HEADER_CALL_ID, "i"},
+    [OV_SIP_VIEW_CSEQ] = {OV_SIP_HEADER_CSEQ, 0},
+    [OV_SIP_VIEW_CONTENT_LENGTH] = {OV_SIP_HEADER_CONTENT_LENGTH, "l"},
+    [OV_SIP_VIEW_CONTENT_TYPE] = {OV_SIP_HEADER_CONTENT_TYPE, "c"},
+    [OV_SIP_VIEW_FROM] = {OV_SIP_HEADER_FROM, "f"},
+    [OV_SIP_VIEW_TO] = {OV_SIP_HEADER_TO, "t"},
+    [OV_SIP_VIEW_CONTACT] = {OV_SIP_HEADER_CONTACT, "m"},
+    [OV_SIP_VIEW_MAX_FORWARDS] = {OV_SIP_HEADER_MAX_FORWARS, 0},
+};
+
+/*****************************************************************************
+                                    HELPERS
+ ****************************************************************************/
+
+static bool name_equals(char const *name, size_t length, char const *known) {
+
+    return (0 != known) && (length == strlen(known)) &&
+           (0 == strncasecmp(name, known, length));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_sip_view_header classify(char const *name, size_t length) {
+
+    for (size_t i = 0; i < OV_SIP_VIEW_KNOWN_HEADERS; ++i) {
+
+        if (name_equals(name, length, g_known_headers[i].name) ||
+            name_equals(name, length, g_known_headers[i].compact)) {
+            return i;
+        }
+    }
+
+    return OV_SIP_VIEW_KNOWN_HEADERS;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool is_whitespace(char c) { return (SP == c) || (HTAB == c); }
+
+/*----------------------------------------------------------------------------*/
+
+static ov_sip_view_span trimmed_span(char const *data, char const *start,
+                                     char const *end) {
+
+    while ((start < end) && is_whitespace(*start)) {
+        ++start;
+    }
+
+    while ((end > start) && is_whitespace(end[-1])) {
+        --end;
+    }
+
+    return (ov_sip_view_span){
+        .offset = start - data,
+        .length = end - start,
+    };
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool parse_number(char const *str, size_t length, uint32_t max,
+                         uint32_t *number) {
+
+    uint64_t value = 0;
+
+    if ((0 == length) || (10 < length)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < length; ++i) {
+
+        if ((str[i] < '0') || (str[i] > '9')) {
+            return false;
+        }
+
+        value = 10 * value + (str[i] - '0');
+    }
+
+    if (value > max) {
+        return false;
+    } else {
+        *number = value;
+        return true;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static char const *span_ptr(ov_sip_view const *self, ov_sip_view_span span) {
+    return self->data + span.offset;
+}
+
+/*****************************************************************************
+                                    PARSING
+ ****************************************************************************/
+
+static bool parse_start_line(ov_sip_view *self, char const *line,
+                             char const *end) {
+
+    char const *sp1 = memchr(line, SP, end - line);
+
+    if ((0 == sp1) || (sp1 == line)) {
+        return false;
+    }
+
+    char const *sp2 = memchr(sp1 + 1, SP, end - sp1 - 1);
+
+    if (0 == sp2) {
+        return false;
+
+    } else if ((sp1 - line == sizeof(SIP_VERSION) - 1) &&
+               (0 == memcmp(line, SIP_VERSION, sp1 - line))) {
+
+        uint32_t code = 0;
+
+        if (!parse_number(sp1 + 1, sp2 - sp1 - 1, UINT16_MAX, &code)) {
+            return false;
+        }
+
+        self->type = OV_SIP_RESPONSE;
+        self->code = code;
+        self->reason = (ov_sip_view_span){
+            .offset = sp2 + 1 - self->data,
+            .length = end - sp2 - 1,
+        };
+
+        return true;
+
+    } else if ((sp2 == sp1 + 1) || (end - sp2 - 1 != sizeof(SIP_VERSION) - 1) ||
+               (0 != memcmp(sp2 + 1, SIP_VERSION, end - sp2 - 1))) {
+
+        return false;
+
+    } else {
+
+        self->type = OV_SIP_REQUEST;
+        self->method = (ov_sip_view_span){
+            .offset = line - self->data,
+            .length = sp1 - line,
+        };
+        self->uri = (ov_sip_view_span){
+            .offset = sp1 + 1 - self->data,
+            .length = sp2 - sp1 - 1,
+        };
+
+        return true;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool parse_header_line(ov_sip_view *self, char const *line,
+                              char const *end) {
+
+    // Folded header lines are not supported, same as ov_sip_serde
+
+    char const *colon = memchr(line, ':', end - line);
+
+    if ((0 == colon) || is_whitespace(line[0])) {
+        return false;
+    } else if (OV_SIP_VIEW_HEADERS_MAX == self->num_headers) {
+        return false;
+    }
+
+    ov_sip_view_span name = trimmed_span(self->data, line, colon);
+    ov_sip_view_span value = trimmed_span(self->data, colon + 1, end);
+
+    if (0 == name.length) {
+        return false;
+    }
+
+    size_t index = self->num_headers++;
+
+    self->headers[index].name = name;
+    self->headers[index].value = value;
+
+    ov_sip_view_header id = classify(span_ptr(self, name), name.length);
+
+    if ((OV_SIP_VIEW_KNOWN_HEADERS == id) || (0 != self->known[id])) {
+        return true;
+
+    } else if (OV_SIP_VIEW_CONTENT_LENGTH == id) {
+
+        uint32_t length = 0;
+
+        if (!parse_number(span_ptr(self, value), value.length,
+                          OV_SIP_VIEW_OCTETS_MAX, &length)) {
+            return false;
+        }
+
+        self->body.length = length;
+    }
+
+    self->known[id] = index + 1;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool parse_head(ov_sip_view *self, size_t start, size_t end) {
+
+    char const *line = self->data + start;
+
+    // without the empty line terminating the headers
+    char const *last = self->data + end - 2;
+
+    self->type = OV_SIP_INVALID;
+    self->num_headers = 0;
+    self->body = (ov_sip_view_span){.offset = end};
+    memset(self->known, 0, sizeof(self->known));
+
+    while (line < last) {
+
+        char const *lf = memchr(line, LF, last - line);
+
+        if ((0 == lf) || (lf == line) || (CR != lf[-1])) {
+            return false;
+        }
+
+        bool ok = (OV_SIP_INVALID == self->type)
+                      ? parse_start_line(self, line, lf - 1)
+                      : parse_header_line(self, line, lf - 1);
+
+        if (!ok) {
+            return false;
+        }
+
+        line = lf + 1;
+    }
+
+    return OV_SIP_INVALID != self->type;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t skip_empty_lines(char const *data, size_t length) {
+
+    size_t skipped = 0;
+
+    while ((skipped + 1 < length) && (CR == data[skipped]) &&
+           (LF == data[skipped + 1])) {
+        skipped += 2;
+    }
+
+    return skipped;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t find_header_end(char const *data, size_t start, size_t length) {
+
+    // offset after CRLF CRLF or 0
+
+    char const *ptr = data + start;
+    char const *end = data + length;
+
+    while (ptr < end) {
+
+        char const *lf = memchr(ptr, LF, end - ptr);
+
+        if (0 == lf) {
+            return 0;
+
+        } else if ((lf - data >= 3) && (CR == lf[-1]) && (LF == lf[-2]) &&
+                   (CR == lf[-3])) {
+            return lf + 1 - data;
+
+        } else {
+            ptr = lf + 1;
+        }
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void reset_stream(ov_sip_view *self) {
+
+    self->stream.skipped = 0;
+    self->stream.scanned = 0;
+    self->stream.header_end = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ssize_t ov_sip_view_parse(ov_sip_view *self, char const *data, size_t length) {
+
+    if ((0 == self) || (0 == data)) {
+        goto error;
+    }
+
+    self->data = data;
+
+    if (0 == self->stream.header_end) {
+
+        size_t skipped = self->stream.skipped;
+
+        skipped += skip_empty_lines(data + skipped, length - skipped);
+        self->stream.skipped = skipped;
+
+        // Rescan the last 3 octets, CRLF CRLF might be split
+
+        size_t start = skipped;
+
+        if (self->stream.scanned >= skipped + 3) {
+            start = self->stream.scanned - 3;
+        }
+
+        size_t header_end = find_header_end(data, start, length);
+
+        if ((0 == header_end) && (length - skipped > OV_SIP_VIEW_OCTETS_MAX)) {
+            goto error;
+
+        } else if (0 == header_end) {
+            self->stream.scanned = length;
+            return 0;
+
+        } else if (!parse_head(self, skipped, header_end)) {
+            goto error;
+        }
+
+        self->stream.header_end = header_end;
+    }
+
+    size_t total = self->stream.header_end + self->body.length;
+
+    if (length < total) {
+        return 0;
+    }
+
+    reset_stream(self);
+    return total;
+
+error:
+
+    if (0 != self) {
+        reset_stream(self);
+        self->data = 0;
+        self->type = OV_SIP_INVALID;
+        self->num_headers = 0;
+    }
+
+    return -1;
+}
+
+/*****************************************************************************
+                                    HEADERS
+ ****************************************************************************/
+
+char const *ov_sip_view_header_get(ov_sip_view const *self,
+                                   ov_sip_view_header id, size_t *length) {
+
+    if ((0 == self) || (0 == self->data) || (0 == length) ||
+        (OV_SIP_VIEW_KNOWN_HEADERS <= (int)id) || (0 == self->known[id])) {
+
+        if (0 != length) {
+            *length = 0;
+        }
+
+        return 0;
+
+    } else {
+
+        ov_sip_view_span value = self->headers[self->known[id] - 1].value;
+        *length = value.length;
+        return span_ptr(self, value);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+char const *ov_sip_view_header_by_name(ov_sip_view const *self,
+                                       char const *name, size_t *length) {
+
+    if ((0 == self) || (0 == name) || (0 == length)) {
+        return 0;
+    }
+
+    size_t name_length = strlen(name);
+    ov_sip_view_header id = classify(name, name_length);
+
+    if (OV_SIP_VIEW_KNOWN_HEADERS != id) {
+        return ov_sip_view_header_get(self, id, length);
+    }
+
+    size_t pos = 0;
+    char const *key = 0;
+    size_t key_length = 0;
+    char const *value = 0;
+
+    while (ov_sip_view_header_next(self, &pos, &key, &key_length, &value,
+                                   length)) {
+
+        if ((key_length == name_length) &&
+            (0 == strncasecmp(key, name, key_length))) {
+            return value;
+        }
+    }
+
+    *length = 0;
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_sip_view_header_next(ov_sip_view const *self, size_t *pos,
+                             char const **name, size_t *name_length,
+                             char const **value, size_t *value_length) {
+
+    if ((0 == self) || (0 == self->data) || (0 == pos) || (0 == name) ||
+        (0 == name_length) || (0 == value) || (0 == value_length) ||
+        (*pos >= self->num_headers)) {
+        return false;
+
+    } else {
+
+        ov_sip_view_span n = self->headers[*pos].name;
+        ov_sip_view_span v = self->headers[*pos].value;
+
+        *name = span_ptr(self, n);
+        *name_length = n.length;
+        *value = span_ptr(self, v);
+        *value_length = v.length;
+
+        ++*pos;
+        return true;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint32_t ov_sip_view_cseq(ov_sip_view const *self, char const **method,
+                          size_t *method_length) {
+
+    size_t length = 0;
+    char const *cseq = ov_sip_view_header_get(self, OV_SIP_VIEW_CSEQ, &length);
+
+    char const *sp = (0 == cseq) ? 0 : memchr(cseq, SP, length);
+    uint32_t number = 0;
+
+    if ((0 == sp) || (!parse_number(cseq, sp - cseq, UINT32_MAX, &number))) {
+        return 0;
+    }
+
+    ov_sip_view_span span = trimmed_span(cseq, sp, cseq + length);
+
+    if (0 != method) {
+        *method = cseq + span.offset;
+    }
+
+    if (0 != method_length) {
+        *method_length = span.length;
+    }
+
+    return number;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint32_t ov_sip_view_content_length(ov_sip_view const *self) {
+
+    if ((0 == self) || (0 == self->data)) {
+        return 0;
+    } else {
+        return self->body.length;
+    }
+}
+
+/*****************************************************************************
+                                  MATERIALISE
+ ****************************************************************************/
+
+static char *span_dup(ov_sip_view const *self, ov_sip_view_span span) {
+    return strndup(span_ptr(self, span), span.length);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_sip_message *create_message(ov_sip_view const *self) {
+
+    ov_sip_message *msg = 0;
+
+    if (OV_SIP_RESPONSE == self->type) {
+
+        char *reason = span_dup(self, self->reason);
+        msg = ov_sip_message_response_create(self->code, reason);
+        ov_free(reason);
+
+    } else {
+
+        char *method = span_dup(self, self->method);
+        char *uri = span_dup(self, self->uri);
+
+        msg = ov_sip_message_request_create(method, uri);
+
+        ov_free(method);
+        ov_free(uri);
+    }
+
+    return msg;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool set_headers(ov_sip_message *msg, ov_sip_view const *self) {
+
+    bool ok = true;
+
+    for (size_t i = 0; ok && (i < self->num_headers); ++i) {
+
+        ov_sip_view_span name = self->headers[i].name;
+        ov_sip_view_header id = classify(span_ptr(self, name), name.length);
+
+        char *dup_name = 0;
+        char const *header = 0;
+
+        if (OV_SIP_VIEW_KNOWN_HEADERS == id) {
+            dup_name = span_dup(self, name);
+            header = dup_name;
+        } else {
+            header = g_known_headers[id].name;
+        }
+
+        char *value = span_dup(self, self->headers[i].value);
+
+        ok = ov_sip_message_header_set(msg, header, value);
+
+        ov_free(dup_name);
+        ov_free(value);
+    }
+
+    return ok;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool set_body(ov_sip_message *msg, ov_sip_view const *self) {
+
+    if (0 == self->body.length) {
+        return true;
+    }
+
+    size_t length = 0;
+    char const *type =
+        ov_sip_view_header_get(self, OV_SIP_VIEW_CONTENT_TYPE, &length);
+
+    if (0 == type) {
+        ov_log_error("SIP message body without content type");
+        return false;
+    }
+
+    char *content_type = strndup(type, length);
+    ov_buffer *body = ov_buffer_create(self->body.length);
+
+    memcpy(body->start, span_ptr(self, self->body), self->body.length);
+    body->length = self->body.length;
+
+    bool ok = ov_sip_message_body_set(msg, body, content_type);
+
+    if (!ok) {
+        ov_buffer_free(body);
+    }
+
+    ov_free(content_type);
+    return ok;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_sip_message *ov_sip_view_to_message(ov_sip_view const *self) {
+
+    if ((0 == self) || (0 == self->data) ||
+        (OV_SIP_INVALID == self->type)) {
+        return 0;
+    }
+
+    ov_sip_message *msg = create_message(self);
+
+    if ((0 == msg) || (!set_headers(msg, self)) || (!set_body(msg, self))) {
+        return ov_sip_message_free(msg);
+    } else {
+        return msg;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
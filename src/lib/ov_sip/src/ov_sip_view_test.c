@@ -0,0 +1,667 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_sip_view_test.c
+
+        @date           2026-10-18
+
+        ------------------------------------------------------------------------
+*/
+
+#include <ov_base/ov_registered_cache.h>
+#include <ov_base/ov_time.h>
+#include <ov_test/ov_test.h>
+
+#include "../include/ov_sip_serde.h"
+#include "ov_sip_view.c"
+
+/*----------------------------------------------------------------------------*/
+
+#define CRLF "\r\n"
+
+static char const *register_request =
+    "REGISTER sip:openvocs.org SIP/2.0" CRLF
+    "Via: SIP/2.0/UDP 10.0.0.1:5060;branch=z9hG4bK776asdhds" CRLF
+    "Max-Forwards: 70" CRLF "To: Bob <sip:bob@openvocs.org>" CRLF
+    "From: Bob <sip:bob@openvocs.org>;tag=456248" CRLF
+    "Call-ID: 843817637684230@998sdasdh09" CRLF "CSeq: 1826 REGISTER" CRLF
+    "Contact: <sip:bob@10.0.0.1>" CRLF "Expires: 7200" CRLF
+    "Content-Length: 0" CRLF CRLF;
+
+static char const *options_request =
+    "OPTIONS sip:carol@openvocs.org SIP/2.0" CRLF
+    "v: SIP/2.0/UDP 10.0.0.2;branch=z9hG4bKhjhs8ass877" CRLF
+    "Max-Forwards: 70" CRLF "t: <sip:carol@openvocs.org>" CRLF
+    "f: Alice <sip:alice@openvocs.org>;tag=1928301774" CRLF
+    "i: a84b4c76e66710" CRLF "CSeq: 63104 OPTIONS" CRLF
+    "m: <sip:alice@10.0.0.2>" CRLF "Accept: application/sdp" CRLF
+    "l: 0" CRLF CRLF;
+
+static char const *ok_response =
+    "SIP/2.0 200 OK" CRLF
+    "Via: SIP/2.0/UDP 10.0.0.3:5060;branch=z9hG4bKnashds8" CRLF
+    "To: Bob <sip:bob@openvocs.org>;tag=a6c85cf" CRLF
+    "From: Alice <sip:alice@openvocs.org>;tag=1928301774" CRLF
+    "Call-ID: a84b4c76e66710" CRLF "CSeq: 314159 INVITE" CRLF
+    "Contact: <sip:bob@10.0.0.3>" CRLF "Content-Length: 0" CRLF CRLF;
+
+#define SDP                                                                    \
+    "v=0" CRLF "o=alice 2890844526 2890844526 IN IP4 10.0.0.2" CRLF "s=-" CRLF \
+    "c=IN IP4 10.0.0.2" CRLF "t=0 0" CRLF "m=audio 49170 RTP/AVP 0" CRLF       \
+    "a=rtpmap:0 PCMU/8000" CRLF
+
+static char const *invite_request =
+    "INVITE sip:bob@openvocs.org SIP/2.0" CRLF
+    "Via: SIP/2.0/UDP 10.0.0.2:5060;branch=z9hG4bK74bf9" CRLF
+    "Via: SIP/2.0/UDP 10.0.0.9:5060;branch=z9hG4bK1f9a2" CRLF
+    "Max-Forwards: 70" CRLF "To: Bob <sip:bob@openvocs.org>" CRLF
+    "From: Alice <sip:alice@openvocs.org>;tag=9fxced76sl" CRLF
+    "Call-ID: 3848276298220188511@10.0.0.2" CRLF "CSeq: 1 INVITE" CRLF
+    "Contact: <sip:alice@10.0.0.2>" CRLF
+    "Content-Type: application/sdp" CRLF "Content-Length: 130" CRLF CRLF SDP;
+
+/*----------------------------------------------------------------------------*/
+
+static bool value_is(char const *value, size_t length, char const *ref) {
+
+    return (0 != value) && (length == strlen(ref)) &&
+           (0 == memcmp(value, ref, length));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool header_is(ov_sip_view const *view, ov_sip_view_header id,
+                      char const *ref) {
+
+    size_t length = 0;
+    char const *value = ov_sip_view_header_get(view, id, &length);
+
+    if (0 == ref) {
+        return (0 == value) && (0 == length);
+    } else {
+        return value_is(value, length, ref);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_parse() {
+
+    ov_sip_view view = {0};
+
+    size_t length = strlen(invite_request);
+    testrun(130 == strlen(SDP));
+
+    testrun(-1 == ov_sip_view_parse(0, invite_request, length));
+    testrun(-1 == ov_sip_view_parse(&view, 0, length));
+    testrun(0 == ov_sip_view_parse(&view, invite_request, 0));
+
+    testrun((ssize_t)length ==
+            ov_sip_view_parse(&view, invite_request, length));
+
+    testrun(OV_SIP_REQUEST == view.type);
+    testrun(value_is(invite_request + view.method.offset, view.method.length,
+                     "INVITE"));
+    testrun(value_is(invite_request + view.uri.offset, view.uri.length,
+                     "sip:bob@openvocs.org"));
+    testrun(10 == view.num_headers);
+    testrun(130 == view.body.length);
+    testrun(value_is(invite_request + view.body.offset, view.body.length, SDP));
+
+    // No copy, all points into the receive buffer
+
+    size_t vlen = 0;
+    char const *value =
+        ov_sip_view_header_get(&view, OV_SIP_VIEW_CALL_ID, &vlen);
+    testrun(value > invite_request);
+    testrun(value < invite_request + length);
+
+    // Response
+
+    length = strlen(ok_response);
+    testrun((ssize_t)length == ov_sip_view_parse(&view, ok_response, length));
+    testrun(OV_SIP_RESPONSE == view.type);
+    testrun(200 == view.code);
+    testrun(value_is(ok_response + view.reason.offset, view.reason.length,
+                     "OK"));
+    testrun(0 == view.body.length);
+
+    // Keep alives in front are skipped, trailing octets ignored
+
+    char buffer[4096] = {0};
+    snprintf(buffer, sizeof(buffer), CRLF CRLF "%s%s", register_request,
+             options_request);
+
+    ssize_t consumed = ov_sip_view_parse(&view, buffer, strlen(buffer));
+    testrun(4 + strlen(register_request) == (size_t)consumed);
+    testrun(header_is(&view, OV_SIP_VIEW_CSEQ, "1826 REGISTER"));
+
+    testrun(strlen(options_request) ==
+            (size_t)ov_sip_view_parse(&view, buffer + consumed,
+                                      strlen(buffer) - consumed));
+    testrun(header_is(&view, OV_SIP_VIEW_CSEQ, "63104 OPTIONS"));
+
+    // Invalid messages
+
+    char const *invalid[] = {
+        "INVITE sip:bob@openvocs.org" CRLF CRLF,
+        "INVITE sip:bob@openvocs.org SIP/3.0" CRLF CRLF,
+        "INVITE  SIP/2.0" CRLF CRLF,
+        "SIP/2.0 200" CRLF CRLF,
+        "SIP/2.0 2x0 OK" CRLF CRLF,
+        "SIP/2.0 200 OK" CRLF "Via SIP/2.0/UDP 10.0.0.3" CRLF CRLF,
+        "SIP/2.0 200 OK" CRLF " folded: header" CRLF CRLF,
+        "SIP/2.0 200 OK" CRLF ": nameless" CRLF CRLF,
+        "SIP/2.0 200 OK" CRLF "Content-Length: -1" CRLF CRLF,
+        "SIP/2.0 200 OK" CRLF "Content-Length: 70000" CRLF CRLF,
+        "SIP/2.0 200 OK\nCall-ID: 1" CRLF CRLF,
+        0,
+    };
+
+    for (size_t i = 0; 0 != invalid[i]; ++i) {
+        testrun(-1 == ov_sip_view_parse(&view, invalid[i], strlen(invalid[i])));
+        testrun(0 == ov_sip_view_content_length(&view));
+    }
+
+    // Too many headers
+
+    size_t written = snprintf(buffer, sizeof(buffer), "SIP/2.0 200 OK" CRLF);
+
+    for (size_t i = 0; i <= OV_SIP_VIEW_HEADERS_MAX; ++i) {
+        written += snprintf(buffer + written, sizeof(buffer) - written,
+                            "X-%zu: a" CRLF, i);
+    }
+
+    written += snprintf(buffer + written, sizeof(buffer) - written, CRLF);
+    testrun(-1 == ov_sip_view_parse(&view, buffer, written));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_parse_streaming() {
+
+    ov_sip_view view = {0};
+
+    // Octet by octet, the buffer moving with each call
+
+    char const *messages[] = {invite_request, register_request, ok_response,
+                              0};
+
+    for (size_t m = 0; 0 != messages[m]; ++m) {
+
+        size_t length = strlen(messages[m]);
+        char *buffers[2] = {calloc(1, length + 2), calloc(1, length + 2)};
+
+        memcpy(buffers[0], CRLF, 2);
+        memcpy(buffers[0] + 2, messages[m], length);
+        memcpy(buffers[1], buffers[0], length + 2);
+
+        for (size_t i = 1; i < length + 2; ++i) {
+            testrun(0 == ov_sip_view_parse(&view, buffers[i % 2], i));
+        }
+
+        testrun((ssize_t)length + 2 ==
+                ov_sip_view_parse(&view, buffers[0], length + 2));
+
+        testrun(OV_SIP_INVALID != view.type);
+
+        free(buffers[0]);
+        free(buffers[1]);
+    }
+
+    // Header too large to ever complete
+
+    char *huge = calloc(1, OV_SIP_VIEW_OCTETS_MAX + 64);
+    size_t written = sprintf(huge, "SIP/2.0 200 OK" CRLF "X: ");
+    memset(huge + written, 'a', OV_SIP_VIEW_OCTETS_MAX);
+
+    testrun(0 == ov_sip_view_parse(&view, huge, written));
+    testrun(-1 == ov_sip_view_parse(&view, huge,
+                                    written + OV_SIP_VIEW_OCTETS_MAX));
+
+    free(huge);
+
+    // State reset after an error
+
+    testrun((ssize_t)strlen(ok_response) ==
+            ov_sip_view_parse(&view, ok_response, strlen(ok_response)));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_header_get() {
+
+    ov_sip_view view = {0};
+    size_t length = 0;
+
+    testrun(0 == ov_sip_view_header_get(0, OV_SIP_VIEW_VIA, &length));
+    testrun(0 == ov_sip_view_header_get(&view, OV_SIP_VIEW_VIA, &length));
+    testrun(0 == length);
+
+    testrun(0 < ov_sip_view_parse(&view, invite_request,
+                                  strlen(invite_request)));
+
+    testrun(0 == ov_sip_view_header_get(&view, OV_SIP_VIEW_VIA, 0));
+    testrun(0 == ov_sip_view_header_get(&view, OV_SIP_VIEW_KNOWN_HEADERS,
+                                        &length));
+
+    // first of several
+
+    testrun(header_is(&view, OV_SIP_VIEW_VIA,
+                      "SIP/2.0/UDP 10.0.0.2:5060;branch=z9hG4bK74bf9"));
+    testrun(header_is(&view, OV_SIP_VIEW_CALL_ID,
+                      "3848276298220188511@10.0.0.2"));
+    testrun(header_is(&view, OV_SIP_VIEW_CSEQ, "1 INVITE"));
+    testrun(header_is(&view, OV_SIP_VIEW_CONTENT_LENGTH, "130"));
+    testrun(header_is(&view, OV_SIP_VIEW_CONTENT_TYPE, "application/sdp"));
+    testrun(header_is(&view, OV_SIP_VIEW_MAX_FORWARDS, "70"));
+
+    // compact forms
+
+    testrun(0 < ov_sip_view_parse(&view, options_request,
+                                  strlen(options_request)));
+
+    testrun(header_is(&view, OV_SIP_VIEW_VIA,
+                      "SIP/2.0/UDP 10.0.0.2;branch=z9hG4bKhjhs8ass877"));
+    testrun(header_is(&view, OV_SIP_VIEW_CALL_ID, "a84b4c76e66710"));
+    testrun(header_is(&view, OV_SIP_VIEW_TO, "<sip:carol@openvocs.org>"));
+    testrun(header_is(&view, OV_SIP_VIEW_CONTACT, "<sip:alice@10.0.0.2>"));
+    testrun(header_is(&view, OV_SIP_VIEW_CONTENT_LENGTH, "0"));
+    testrun(header_is(&view, OV_SIP_VIEW_CONTENT_TYPE, 0));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_header_by_name() {
+
+    ov_sip_view view = {0};
+    size_t length = 0;
+
+    testrun(0 < ov_sip_view_parse(&view, options_request,
+                                  strlen(options_request)));
+
+    testrun(0 == ov_sip_view_header_by_name(0, "Accept", &length));
+    testrun(0 == ov_sip_view_header_by_name(&view, 0, &length));
+    testrun(0 == ov_sip_view_header_by_name(&view, "Accept", 0));
+
+    char const *value = ov_sip_view_header_by_name(&view, "accept", &length);
+    testrun(value_is(value, length, "application/sdp"));
+
+    value = ov_sip_view_header_by_name(&view, "Call-ID", &length);
+    testrun(value_is(value, length, "a84b4c76e66710"));
+
+    value = ov_sip_view_header_by_name(&view, "I", &length);
+    testrun(value_is(value, length, "a84b4c76e66710"));
+
+    testrun(0 == ov_sip_view_header_by_name(&view, "Expires", &length));
+    testrun(0 == length);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_header_next() {
+
+    ov_sip_view view = {0};
+
+    size_t pos = 0;
+    char const *name = 0;
+    size_t name_length = 0;
+    char const *value = 0;
+    size_t value_length = 0;
+
+    testrun(!ov_sip_view_header_next(&view, &pos, &name, &name_length, &value,
+                                     &value_length));
+
+    testrun(0 < ov_sip_view_parse(&view, register_request,
+                                  strlen(register_request)));
+
+    testrun(!ov_sip_view_header_next(&view, 0, &name, &name_length, &value,
+                                     &value_length));
+
+    size_t count = 0;
+
+    while (ov_sip_view_header_next(&view, &pos, &name, &name_length, &value,
+                                   &value_length)) {
+
+        if (0 == count) {
+            testrun(value_is(name, name_length, "Via"));
+        } else if (7 == count) {
+            testrun(value_is(name, name_length, "Expires"));
+            testrun(value_is(value, value_length, "7200"));
+        }
+
+        ++count;
+    }
+
+    testrun(9 == count);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_cseq() {
+
+    ov_sip_view view = {0};
+
+    char const *method = 0;
+    size_t length = 0;
+
+    testrun(0 == ov_sip_view_cseq(0, &method, &length));
+    testrun(0 == ov_sip_view_cseq(&view, &method, &length));
+
+    testrun(0 < ov_sip_view_parse(&view, ok_response, strlen(ok_response)));
+    testrun(314159 == ov_sip_view_cseq(&view, &method, &length));
+    testrun(value_is(method, length, "INVITE"));
+    testrun(314159 == ov_sip_view_cseq(&view, 0, 0));
+
+    char const *invalid = "SIP/2.0 200 OK" CRLF "CSeq: x INVITE" CRLF CRLF;
+    testrun(0 < ov_sip_view_parse(&view, invalid, strlen(invalid)));
+    testrun(0 == ov_sip_view_cseq(&view, &method, &length));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_content_length() {
+
+    ov_sip_view view = {0};
+
+    testrun(0 == ov_sip_view_content_length(0));
+    testrun(0 == ov_sip_view_content_length(&view));
+
+    testrun(0 < ov_sip_view_parse(&view, invite_request,
+                                  strlen(invite_request)));
+    testrun(130 == ov_sip_view_content_length(&view));
+
+    // Missing Content-Length means no body
+
+    char const *msg = "SIP/2.0 200 OK" CRLF "Call-ID: 1" CRLF CRLF "abc";
+    testrun((ssize_t)strlen(msg) - 3 ==
+            ov_sip_view_parse(&view, msg, strlen(msg)));
+    testrun(0 == ov_sip_view_content_length(&view));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool same_as_serde(char const *raw) {
+
+    ov_serde *serde = ov_sip_serde();
+    ov_buffer *buf = ov_buffer_from_string(raw);
+
+    ov_sip_serde_add_raw(serde, buf);
+    ov_sip_message *ref = ov_sip_serde_pop_datum(serde, 0);
+
+    ov_sip_view view = {0};
+    ov_sip_view_parse(&view, raw, strlen(raw));
+    ov_sip_message *msg = ov_sip_view_to_message(&view);
+
+    char *ref_str = ov_sip_message_to_string(serde, ref);
+    char *msg_str = ov_sip_message_to_string(serde, msg);
+
+    bool same = (0 != ref_str) && (0 == ov_string_compare(ref_str, msg_str));
+
+    ov_free(ref_str);
+    ov_free(msg_str);
+    ov_sip_message_free(ref);
+    ov_sip_message_free(msg);
+    ov_buffer_free(buf);
+    ov_serde_free(serde);
+
+    return same;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_ov_sip_view_to_message() {
+
+    ov_sip_view view = {0};
+
+    testrun(0 == ov_sip_view_to_message(0));
+    testrun(0 == ov_sip_view_to_message(&view));
+
+    testrun(0 < ov_sip_view_parse(&view, options_request,
+                                  strlen(options_request)));
+
+    ov_sip_message *msg = ov_sip_view_to_message(&view);
+    testrun(0 != msg);
+
+    testrun(OV_SIP_REQUEST == ov_sip_message_type_get(msg));
+    testrun(0 == ov_string_compare("OPTIONS", ov_sip_message_method(msg)));
+    testrun(0 == ov_string_compare("a84b4c76e66710",
+                                   ov_sip_message_header(msg, "Call-ID")));
+    testrun(0 == ov_string_compare("application/sdp",
+                                   ov_sip_message_header(msg, "Accept")));
+
+    msg = ov_sip_message_free(msg);
+
+    testrun(0 < ov_sip_view_parse(&view, invite_request,
+                                  strlen(invite_request)));
+
+    msg = ov_sip_view_to_message(&view);
+    testrun(0 != msg);
+
+    ov_buffer const *body = ov_sip_message_body(msg);
+    testrun(0 != body);
+    testrun(value_is((char const *)body->start, body->length, SDP));
+
+    msg = ov_sip_message_free(msg);
+
+    // Body requires Content-Type
+
+    char const *untyped = "SIP/2.0 200 OK" CRLF "Content-Length: 3" CRLF CRLF
+                          "abc";
+    testrun(0 < ov_sip_view_parse(&view, untyped, strlen(untyped)));
+    testrun(0 == ov_sip_view_to_message(&view));
+
+    // Same message as created by ov_sip_serde
+
+    testrun(same_as_serde(register_request));
+    testrun(same_as_serde(ok_response));
+    testrun(same_as_serde(invite_request));
+
+    return testrun_log_success();
+}
+
+/*****************************************************************************
+                                  PERFORMANCE
+ ****************************************************************************/
+
+/* Capture as logged by ov_sip_replay, lines not ending in CRLF separate
+ * messages */
+
+static size_t load_capture(char *buffer, size_t size, char const **messages,
+                           size_t *lengths, size_t max_messages) {
+
+    char const *path = getenv("OV_SIP_REPLAY_CAPTURE");
+    FILE *file = (0 == path) ? 0 : fopen(path, "r");
+
+    if (0 == file) {
+        return 0;
+    }
+
+    size_t num = 0;
+    size_t used = 0;
+    char *start = 0;
+    char line[1024] = {0};
+
+    while ((num < max_messages) && (0 != fgets(line, sizeof(line), file))) {
+
+        size_t len = strlen(line);
+        bool crlf = (len > 1) && (CR == line[len - 2]) && (LF == line[len - 1]);
+
+        if (crlf && (used + len < size)) {
+
+            start = (0 == start) ? buffer + used : start;
+            memcpy(buffer + used, line, len);
+            used += len;
+
+        } else if (0 != start) {
+
+            messages[num] = start;
+            lengths[num] = buffer + used - start;
+            ++num;
+            start = 0;
+        }
+    }
+
+    if ((0 != start) && (num < max_messages)) {
+        messages[num] = start;
+        lengths[num] = buffer + used - start;
+        ++num;
+    }
+
+    fclose(file);
+    return num;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void parse_performance(char const *name, char const **messages,
+                              size_t *lengths, size_t num_messages,
+                              size_t runs) {
+
+    ov_sip_view view = {0};
+    size_t octets = 0;
+    size_t valid = 0;
+
+    for (size_t m = 0; m < num_messages; ++m) {
+        octets += lengths[m];
+        valid += (0 < ov_sip_view_parse(&view, messages[m], lengths[m]));
+    }
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        for (size_t m = 0; m < num_messages; ++m) {
+            ov_sip_view_parse(&view, messages[m], lengths[m]);
+        }
+    }
+
+    uint64_t view_usec = ov_time_get_current_time_usecs() - start;
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        for (size_t m = 0; m < num_messages; ++m) {
+            ov_sip_view_parse(&view, messages[m], lengths[m]);
+            ov_sip_message_free(ov_sip_view_to_message(&view));
+        }
+    }
+
+    uint64_t message_usec = ov_time_get_current_time_usecs() - start;
+
+    ov_serde *serde = ov_sip_serde();
+    ov_buffer **buffers = calloc(num_messages, sizeof(ov_buffer *));
+
+    for (size_t m = 0; m < num_messages; ++m) {
+        buffers[m] = ov_buffer_create(lengths[m]);
+        ov_buffer_set(buffers[m], messages[m], lengths[m]);
+    }
+
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+        for (size_t m = 0; m < num_messages; ++m) {
+            ov_sip_serde_add_raw(serde, buffers[m]);
+            ov_sip_message_free(ov_sip_serde_pop_datum(serde, 0));
+        }
+    }
+
+    uint64_t serde_usec = ov_time_get_current_time_usecs() - start;
+
+    for (size_t m = 0; m < num_messages; ++m) {
+        ov_buffer_free(buffers[m]);
+    }
+
+    free(buffers);
+    serde = ov_serde_free(serde);
+
+    double ops = runs * num_messages;
+
+    fprintf(stdout,
+            "%s (%zu messages, %zu valid, %zu bytes): ov_sip_view_parse %.0f "
+            "ns/op, +to_message %.0f ns/op, ov_sip_serde %.0f ns/op, "
+            "view %.1f MB/s\n",
+            name, num_messages, valid, octets, 1000.0 * view_usec / ops,
+            1000.0 * message_usec / ops, 1000.0 * serde_usec / ops,
+            (0 == view_usec) ? 0.0 : (double)runs * octets / view_usec);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int check_sip_view_performance() {
+
+    char const *messages[] = {register_request, options_request, ok_response,
+                              invite_request};
+    size_t lengths[] = {strlen(register_request), strlen(options_request),
+                        strlen(ok_response), strlen(invite_request)};
+
+    parse_performance("builtin", messages, lengths, 4, 20000);
+
+    size_t const max = 4096;
+    size_t const size = 4 * 1024 * 1024;
+
+    char *buffer = calloc(1, size);
+    char const **captured = calloc(max, sizeof(char *));
+    size_t *captured_lengths = calloc(max, sizeof(size_t));
+
+    size_t num = load_capture(buffer, size, captured, captured_lengths, max);
+
+    if (0 < num) {
+        parse_performance("capture", captured, captured_lengths, num,
+                          1 + 80000 / num);
+    }
+
+    free(buffer);
+    free(captured);
+    free(captured_lengths);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int tear_down() {
+
+    ov_registered_cache_free_all();
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+OV_TEST_RUN("ov_sip_view", test_ov_sip_view_parse,
+            test_ov_sip_view_parse_streaming, test_ov_sip_view_header_get,
+            test_ov_sip_view_header_by_name, test_ov_sip_view_header_next,
+            test_ov_sip_view_cseq, test_ov_sip_view_content_length,
+            test_ov_sip_view_to_message, check_sip_view_performance,
+            tear_down);
@@ -30,19 +30,14 @@
 #include "../include/ov_stun_transaction_store.h"
 #include "../include/ov_stun_frame.h"
 
-#include <ov_base/ov_dict.h>
-#include <ov_base/ov_list.h>
+#include <ov_base/ov_expiring_map.h>
 #include <ov_base/ov_time.h>
 
 #define OV_STUN_TRANSACTION_STORE_MAGIC_BYTES 0xef82
 
-/*----------------------------------------------------------------------------*/
-
-struct TransactionData {
-
-    uint64_t created;
-    void *data;
-};
+/* transactions are checked with 1/128 of the invalidation time */
+#define IMPL_WHEEL_SLOTS 128
+#define IMPL_MIN_RESOLUTION_USEC 10000 // 10ms
 
 /*----------------------------------------------------------------------------*/
 
@@ -51,61 +46,14 @@ struct ov_stun_transaction_store {
     uint16_t magic_bytes;
     ov_stun_transaction_store_config config;
 
-    ov_dict *dict;
-    uint32_t timer_invalidate;
-};
+    ov_expiring_map *map;
 
-/*----------------------------------------------------------------------------*/
-
-struct container_timer {
-
-    uint64_t now;
-    uint64_t max;
-    ov_list *list;
+    uint64_t resolution_usec;
+    uint32_t timer_invalidate;
 };
 
 /*----------------------------------------------------------------------------*/
 
-static bool create_timeout_key_list(const void *key, void *value, void *data) {
-
-    if (!key)
-        return true;
-
-    if (!value || !data)
-        goto error;
-
-    struct container_timer *container = (struct container_timer *)data;
-    struct TransactionData *tdata = (struct TransactionData *)value;
-
-    uint64_t lifetime = tdata->created + container->max;
-
-    if (container->now < lifetime)
-        return true;
-
-    // add to delete list
-    return ov_list_push(container->list, (void *)key);
-
-error:
-    return false;
-}
-
-/*----------------------------------------------------------------------------*/
-
-static bool del_key_list(void *key, void *data) {
-
-    if (!key || !data)
-        goto error;
-
-    ov_dict *dict = ov_dict_cast(data);
-    OV_ASSERT(dict);
-
-    return ov_dict_del(dict, key);
-error:
-    return false;
-}
-
-/*----------------------------------------------------------------------------*/
-
 static bool invalidate_transactions(uint32_t timer, void *data) {
 
     UNUSED(timer);
@@ -114,26 +62,11 @@ static bool invalidate_transactions(uint32_t timer, void *data) {
     if (!self)
         goto error;
 
-    ov_list *list = ov_list_create((ov_list_config){0});
-
-    struct container_timer container = {
-
-        .now = ov_time_get_current_time_usecs(),
-        .max = self->config.timer.invalidation_usec,
-        .list = list,
-    };
-
-    if (!ov_dict_for_each(self->dict, &container, create_timeout_key_list))
-        goto error;
-
-    if (!ov_list_for_each(list, self->dict, del_key_list))
-        goto error;
-
-    list = ov_list_free(list);
+    ov_expiring_map_expire(self->map, ov_time_get_current_time_usecs());
 
-    self->timer_invalidate = ov_event_loop_timer_set(
-        self->config.loop, self->config.timer.invalidation_usec, self,
-        invalidate_transactions);
+    self->timer_invalidate =
+        ov_event_loop_timer_set(self->config.loop, self->resolution_usec,
+                                self, invalidate_transactions);
 
     return true;
 error:
@@ -174,16 +107,20 @@ ov_stun_transaction_store_create(ov_stun_transaction_store_config config) {
     self->magic_bytes = OV_STUN_TRANSACTION_STORE_MAGIC_BYTES;
     self->config = config;
 
-    ov_dict_config d_config = ov_dict_string_key_config(255);
-    d_config.value.data_function.free = ov_data_pointer_free;
+    self->resolution_usec = config.timer.invalidation_usec / IMPL_WHEEL_SLOTS;
+    if (self->resolution_usec < IMPL_MIN_RESOLUTION_USEC)
+        self->resolution_usec = IMPL_MIN_RESOLUTION_USEC;
+
+    /* values are owned by the caller */
+    self->map = ov_expiring_map_create((ov_expiring_map_config){
+        .wheel.slots = IMPL_WHEEL_SLOTS + 1,
+        .wheel.resolution_usec = self->resolution_usec});
 
-    self->dict = ov_dict_create(d_config);
-    if (!self->dict)
+    if (!self->map)
         goto error;
 
     self->timer_invalidate = ov_event_loop_timer_set(
-        config.loop, self->config.timer.invalidation_usec, self,
-        invalidate_transactions);
+        config.loop, self->resolution_usec, self, invalidate_transactions);
 
     return self;
 error:
@@ -206,7 +143,7 @@ ov_stun_transaction_store_free(ov_stun_transaction_store *self) {
         self->timer_invalidate = OV_TIMER_INVALID;
     }
 
-    self->dict = ov_dict_free(self->dict);
+    self->map = ov_expiring_map_free(self->map);
     self = ov_data_pointer_free(self);
 error:
     return self;
@@ -236,36 +173,21 @@ ov_stun_transaction_store *ov_stun_transaction_store_cast(const void *data) {
 bool ov_stun_transaction_store_create_transaction(
     ov_stun_transaction_store *self, uint8_t *ptr, void *input) {
 
-    struct TransactionData *data = NULL;
-    char *key = NULL;
+    char key[13] = {0};
 
     if (!self || !ptr)
         goto error;
 
-    key = calloc(13, sizeof(char));
-    if (!key)
-        goto error;
     ov_stun_frame_generate_transaction_id((uint8_t *)key);
 
-    data = calloc(1, sizeof(struct TransactionData));
-    if (!data)
-        goto error;
-
-    data->created = ov_time_get_current_time_usecs();
-    data->data = input;
-
-    bool result = false;
-
-    result = ov_dict_set(self->dict, key, data, NULL);
-    if (!result)
+    if (!ov_expiring_map_set(self->map, key, input,
+                             self->config.timer.invalidation_usec))
         goto error;
 
     memcpy(ptr, key, 12);
 
     return true;
 error:
-    ov_data_pointer_free(key);
-    ov_data_pointer_free(data);
     return false;
 }
 
@@ -274,7 +196,6 @@ error:
 void *ov_stun_transaction_store_unset(ov_stun_transaction_store *self,
                                       const uint8_t *transaction_id) {
 
-    void *data = NULL;
     char key[13] = {0};
 
     if (!self || !transaction_id)
@@ -282,13 +203,7 @@ void *ov_stun_transaction_store_unset(ov_stun_transaction_store *self,
 
     strncpy(key, (char *)transaction_id, 12);
 
-    struct TransactionData *tdata = ov_dict_remove(self->dict, key);
-    if (tdata)
-        data = tdata->data;
-
-    ov_data_pointer_free(tdata);
-
-    return data;
+    return ov_expiring_map_remove(self->map, key);
 error:
     return NULL;
 }
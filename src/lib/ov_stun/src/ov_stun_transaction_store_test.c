@@ -52,7 +52,7 @@ int test_ov_stun_transaction_store_create() {
     ov_stun_transaction_store *store = ov_stun_transaction_store_create(config);
     testrun(store);
     testrun(ov_stun_transaction_store_cast(store));
-    testrun(store->dict);
+    testrun(store->map);
     testrun(OV_TIMER_INVALID != store->timer_invalidate);
 
     testrun(NULL == ov_stun_transaction_store_free(store));
@@ -99,7 +99,7 @@ int test_ov_stun_transaction_store_create_transaction() {
     uint8_t *ptr = buffer;
 
     testrun(ov_stun_transaction_store_create_transaction(store, ptr, data));
-    testrun(1 == ov_dict_count(store->dict));
+    testrun(1 == ov_expiring_map_count(store->map));
     testrun(data == ov_stun_transaction_store_unset(store, ptr));
 
     for (size_t i = 0; i < 20; i++) {
@@ -135,7 +135,7 @@ int test_ov_stun_transaction_store_unset() {
     uint8_t *ptr = buffer;
 
     testrun(ov_stun_transaction_store_create_transaction(store, ptr, data));
-    testrun(1 == ov_dict_count(store->dict));
+    testrun(1 == ov_expiring_map_count(store->map));
     testrun(data == ov_stun_transaction_store_unset(store, ptr));
 
     for (size_t i = 0; i < 20; i++) {
@@ -44,6 +44,10 @@ typedef struct ov_vad_core_config {
     ov_event_loop *loop;
     ov_vad_config vad;
 
+    /* receive loops of publishers of the same host from shared memory,
+     * see ov_loop_bus.h */
+    bool loop_bus;
+
     struct {
 
         uint32_t frames_activate;
@@ -84,4 +88,9 @@ bool ov_vad_core_add_loop(ov_vad_core *self, const char *loop,
 
 bool ov_vad_core_set_vad(ov_vad_core *self, ov_vad_config config);
 
+/**
+    Frames received and processing time per loop, see ov_metrics.h
+*/
+ov_json_value *ov_vad_core_metrics(ov_vad_core *self);
+
 #endif /* ov_vad_core_h */
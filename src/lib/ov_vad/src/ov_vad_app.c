@@ -161,6 +161,31 @@ error:
 
 /*---------------------------------------------------------------------------*/
 
+static void cb_state(void *userdata, const char *name, int socket,
+                     ov_json_value *input) {
+
+    ov_json_value *out = NULL;
+
+    ov_vad_app *self = ov_vad_app_cast(userdata);
+    if (!self || !name || !socket || !input)
+        goto error;
+
+    ov_json_value *state = ov_json_object();
+    ov_json_object_set(state, OV_KEY_METRICS, ov_vad_core_metrics(self->vad));
+
+    out = ov_event_api_create_success_response(input);
+    ov_json_object_set(out, OV_KEY_RESPONSE, state);
+
+    ov_event_app_send(self->app, socket, out);
+
+error:
+    ov_json_value_free(out);
+    ov_json_value_free(input);
+    return;
+}
+
+/*---------------------------------------------------------------------------*/
+
 static bool register_callbacks(ov_vad_app *self) {
 
     if (!self)
@@ -172,6 +197,9 @@ static bool register_callbacks(ov_vad_app *self) {
     if (!ov_event_app_register(self->app, OV_KEY_LOOPS, self, cb_loops))
         goto error;
 
+    if (!ov_event_app_register(self->app, OV_KEY_STATE, self, cb_state))
+        goto error;
+
     return true;
 error:
     return false;
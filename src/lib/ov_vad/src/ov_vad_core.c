@@ -33,8 +33,10 @@
 #include <ov_base/ov_config_keys.h>
 #include <ov_base/ov_dict.h>
 #include <ov_base/ov_linked_list.h>
+#include <ov_base/ov_loop_bus.h>
 #include <ov_base/ov_mc_socket.h>
-#include <ov_base/ov_rtp_frame.h>
+#include <ov_base/ov_metrics.h>
+#include <ov_base/ov_rtp_view.h>
 #include <ov_base/ov_string.h>
 #include <ov_base/ov_thread_lock.h>
 #include <ov_base/ov_thread_loop.h>
@@ -57,6 +59,8 @@ struct ov_vad_core {
     ov_dict *loops;
     uint32_t idle_check;
 
+    ov_metrics *metrics;
+
     struct {
 
         ov_codec_factory *factory;
@@ -84,6 +88,7 @@ typedef struct Loops {
 
     ov_vad_core *core;
     int socket;
+    ov_loop_bus *bus;
     ov_socket_configuration config;
     char *name;
     bool on;
@@ -97,6 +102,13 @@ typedef struct Loops {
 
     ov_dict *ssrcs;
 
+    struct {
+
+        ov_metrics_series *frames_in;
+        ov_metrics_series *vad_usec;
+
+    } metric;
+
 } Loops;
 
 /*---------------------------------------------------------------------------*/
@@ -113,6 +125,7 @@ static void *loop_data_free(void *self) {
         close(loop->socket);
     }
 
+    loop->bus = ov_loop_bus_free(loop->bus);
     loop->ssrcs = ov_dict_free(loop->ssrcs);
 
     loop = ov_data_pointer_free(loop);
@@ -243,24 +256,27 @@ static bool check_all_inactive(const void *key, void *val, void *data) {
 
 /*---------------------------------------------------------------------------*/
 
-static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
-                           size_t size) {
+static bool detect_voice(ov_vad_core *self, Loops *loop, uint8_t *buf,
+                         size_t size) {
 
     int16_t pcm16[2048] = {0};
 
-    ov_rtp_frame *frame = ov_rtp_frame_decode(buf, size);
-    if (!frame)
+    ov_rtp_view frame = {0};
+    if (!ov_rtp_view_parse(&frame, buf, size))
         goto error;
 
-    ov_codec *stream_codec = get_codec_ssrc(self, frame->expanded.ssrc);
+    uint32_t ssrc = ov_rtp_view_ssrc(&frame);
+    ov_codec *stream_codec = get_codec_ssrc(self, ssrc);
+
+    size_t payload_length = 0;
+    const uint8_t *payload = ov_rtp_view_payload(&frame, &payload_length);
 
     int32_t length_bytes = 0;
 
     if (stream_codec)
         length_bytes = ov_codec_decode(
-            stream_codec, frame->expanded.sequence_number,
-            frame->expanded.payload.data, frame->expanded.payload.length,
-            (uint8_t *)pcm16, 2048);
+            stream_codec, ov_rtp_view_sequence_number(&frame), payload,
+            payload_length, (uint8_t *)pcm16, 2048);
 
     if (0 > length_bytes)
         goto done;
@@ -268,8 +284,7 @@ static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
     ov_vad_parameters vad_params = {0};
     ov_pcm_16_get_vad_parameters(length_bytes / 2, pcm16, &vad_params);
 
-    Counter *counter =
-        ov_dict_get(loop->ssrcs, (void *)(intptr_t)frame->expanded.ssrc);
+    Counter *counter = ov_dict_get(loop->ssrcs, (void *)(intptr_t)ssrc);
 
     if (!counter) {
 
@@ -277,8 +292,7 @@ static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
         if (!counter)
             goto error;
 
-        ov_dict_set(loop->ssrcs, (void *)(intptr_t)frame->expanded.ssrc,
-                    counter, NULL);
+        ov_dict_set(loop->ssrcs, (void *)(intptr_t)ssrc, counter, NULL);
     }
 
     counter->last_active = ov_time_get_current_time_usecs();
@@ -298,8 +312,7 @@ static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
             if (counter->on >= self->config.limits.frames_activate) {
 
                 // voice switch on
-                ov_log_debug("VAD on %s SSRC %i", loop->name,
-                             frame->expanded.ssrc);
+                ov_log_debug("VAD on %s SSRC %i", loop->name, ssrc);
 
                 counter->active = true;
                 counter->on = 0;
@@ -317,8 +330,7 @@ static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
             if (counter->off >= self->config.limits.frames_deactivate) {
                 // voice switch off
 
-                ov_log_debug("VAD off %s SSRC %i", loop->name,
-                             frame->expanded.ssrc);
+                ov_log_debug("VAD off %s SSRC %i", loop->name, ssrc);
 
                 counter->off = 0;
                 counter->active = false;
@@ -352,7 +364,6 @@ static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
     }
 
 done:
-    frame = ov_rtp_frame_free(frame);
     return true;
 error:
     return false;
@@ -360,6 +371,23 @@ error:
 
 /*---------------------------------------------------------------------------*/
 
+static bool handle_loop_io(ov_vad_core *self, Loops *loop, uint8_t *buf,
+                           size_t size) {
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    ov_metrics_count(loop->metric.frames_in, 1);
+
+    bool result = detect_voice(self, loop, buf, size);
+
+    ov_metrics_observe(loop->metric.vad_usec,
+                       ov_time_get_current_time_usecs() - start);
+
+    return result;
+}
+
+/*---------------------------------------------------------------------------*/
+
 struct container1 {
 
     time_t now;
@@ -494,6 +522,11 @@ ov_vad_core *ov_vad_core_create(ov_vad_core_config config) {
 
     vad->loops = ov_dict_create(d_config);
 
+    vad->metrics =
+        ov_metrics_create((ov_metrics_config){.prefix = "openvocs_vad"});
+    if (!vad->metrics)
+        goto error;
+
     vad->codec.factory = ov_codec_factory_create_standard();
 
     d_config = ov_dict_intptr_key_config(255);
@@ -522,6 +555,7 @@ ov_vad_core *ov_vad_core_free(ov_vad_core *self) {
         return self;
 
     self->loops = ov_dict_free(self->loops);
+    self->metrics = ov_metrics_free(self->metrics);
 
     self->codec.factory = ov_codec_factory_free(self->codec.factory);
 
@@ -556,6 +590,8 @@ ov_vad_core_config ov_vad_core_config_from_json(const ov_json_value *in) {
     config.limits.frames_deactivate =
         ov_json_number_get(ov_json_get(limits, "/" OV_KEY_DEACTIVATE));
 
+    config.loop_bus = ov_json_is_true(ov_json_object_get(in, OV_KEY_LOOP_BUS));
+
     return config;
 }
 
@@ -594,6 +630,32 @@ error:
 
 /*---------------------------------------------------------------------------*/
 
+static void callback_io_loop_bus(void *userdata, const uint8_t *buffer,
+                                 size_t bytes) {
+
+    Loops *loop = (Loops *)userdata;
+
+    /* the buffer is a copy of the frame owned by the bus */
+    handle_loop_io(loop->core, loop, (uint8_t *)buffer, bytes);
+}
+
+/*---------------------------------------------------------------------------*/
+
+static ov_loop_bus *open_loop_bus(ov_vad_core *self, Loops *loop) {
+
+    ov_loop_bus_config config = (ov_loop_bus_config){
+        .loop = self->config.loop,
+        .callback.userdata = loop,
+        .callback.io = callback_io_loop_bus};
+
+    if (!ov_loop_bus_name(loop->config, config.name, sizeof(config.name)))
+        return NULL;
+
+    return ov_loop_bus_create(config);
+}
+
+/*---------------------------------------------------------------------------*/
+
 bool ov_vad_core_add_loop(ov_vad_core *self, const char *name,
                           ov_socket_configuration config) {
 
@@ -629,6 +691,23 @@ bool ov_vad_core_add_loop(ov_vad_core *self, const char *name,
     d_config.value.data_function.free = ov_data_pointer_free;
     loop->ssrcs = ov_dict_create(d_config);
 
+    loop->metric.frames_in =
+        ov_metrics_counter(self->metrics, "frames_in", loop->name);
+    loop->metric.vad_usec =
+        ov_metrics_histogram(self->metrics, "vad_usec", loop->name);
+
+    if (self->config.loop_bus) {
+
+        loop->bus = open_loop_bus(self, loop);
+
+        if (!loop->bus) {
+
+            ov_log_error("VAD failed to open loop bus %s", loop->name);
+            loop_data_free(loop);
+            goto error;
+        }
+    }
+
     if (!ov_dict_set(self->loops, (void *)(intptr_t)socket, loop, NULL)) {
         loop_data_free(loop);
         goto error;
@@ -654,4 +733,14 @@ bool ov_vad_core_set_vad(ov_vad_core *self, ov_vad_config config) {
 
     self->config.vad = config;
     return true;
-}
\ No newline at end of file
+}
+
+/*---------------------------------------------------------------------------*/
+
+ov_json_value *ov_vad_core_metrics(ov_vad_core *self) {
+
+    if (!ov_vad_core_cast(self))
+        return NULL;
+
+    return ov_metrics_to_json(self->metrics);
+}
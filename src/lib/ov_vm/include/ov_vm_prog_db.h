@@ -141,6 +141,11 @@ bool ov_vm_prog_db_update_time(ov_vm_prog_db *self, char const *id);
 
 /**
  * Searches for a program that was started BEFORE time_limit_epoch_usecs
+ *
+ * Programs are kept in a heap ordered by their start time, hence this
+ * returns the program started earliest in O(1).
+ * Inserting, removing or updating the time of a program is O(log n).
+ *
  * @return UUID string of found request or 0 if something went wrong/none found
  */
 char const *ov_vm_prog_db_next_due(ov_vm_prog_db *self,
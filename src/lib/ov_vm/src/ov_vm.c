@@ -182,25 +182,39 @@ ov_vm_retval invalid_handler(ov_vm *vm, ov_vm_prog *prog) {
 
 static void abort_program(ov_vm *self, ov_vm_prog *prog);
 
-static void prune_overdue_requests(ov_vm *self, ov_vm_prog_db *db,
-                                   uint64_t timeout_usecs,
-                                   size_t max_no_to_prune) {
+static size_t prune_overdue_requests(ov_vm *self, ov_vm_prog_db *db,
+                                     uint64_t timeout_usecs) {
 
     uint64_t now_usecs = ov_time_get_current_time_usecs() - timeout_usecs;
 
     char const *id = ov_vm_prog_db_next_due(db, now_usecs);
     size_t overdue = 0;
 
-    for (; (0 != id) && (overdue < max_no_to_prune); ++overdue) {
+    for (; 0 != id; ++overdue) {
 
         ov_log_info("Program %s overdue", ov_string_sanitize(id));
         ov_vm_prog *prog = ov_vm_prog_db_get(db, id);
+
+        if (0 == prog) {
+            break;
+        }
+
         abort_program(self, prog);
 
         id = ov_vm_prog_db_next_due(db, now_usecs);
+
+        /* Aborting releases the program, never abort the same twice */
+
+        if (id == ov_vm_prog_id(prog)) {
+            break;
+        }
+    }
+
+    if (0 < overdue) {
+        ov_log_info("Aborted %zu overdue programs", overdue);
     }
 
-    ov_log_info("Aborted %zu overdue programs", overdue);
+    return overdue;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -214,7 +228,7 @@ static bool timer_callback(uint32_t id, void *the_vm) {
     if (!is_vm_valid(vm)) {
         return false;
     } else {
-        prune_overdue_requests(vm, vm->db, vm->program_timeout_usecs, 5);
+        prune_overdue_requests(vm, vm->db, vm->program_timeout_usecs);
         vm->timer_id = ov_event_loop_timer_set(
             vm->loop, vm->program_timeout_usecs, vm, timer_callback);
 
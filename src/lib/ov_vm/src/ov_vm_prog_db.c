@@ -95,6 +95,9 @@ typedef struct {
     ov_vm_prog_mem public;
     uint64_t start_time_epoch_usecs;
 
+    /* Position within the deadline heap, 0 if not contained */
+    size_t heap_index;
+
 } ProgState;
 
 /*----------------------------------------------------------------------------*/
@@ -123,6 +126,17 @@ struct ov_vm_prog_db_struct {
         size_t capacity;
     } available;
 
+    /*
+     * Min heap of all programs in use, ordered by start time.
+     * All programs share the same timeout, hence the root is the program
+     * due next.
+     * Like available, usable index runs from 1 through capacity.
+     */
+    struct {
+        ProgState **states;
+        size_t size;
+    } deadlines;
+
     struct {
         void (*release)(void *data, void *add);
         void *additional;
@@ -252,6 +266,7 @@ ov_vm_prog_db *ov_vm_prog_db_create(size_t slots, void *additional,
     db->pool.states = calloc(slots, sizeof(ProgState));
     db->pool.capacity = slots;
     db->available.states = calloc(slots + 1, sizeof(ProgState *));
+    db->deadlines.states = calloc(slots + 1, sizeof(ProgState *));
 
     for (size_t i = 0; slots > i; ++i) {
         db->available.states[i + 1] = db->pool.states + i;
@@ -311,12 +326,125 @@ ov_vm_prog_db *ov_vm_prog_db_free(ov_vm_prog_db *self) {
         self->aliases = ov_hashtable_free(self->aliases);
 
         self->available.states = ov_free(self->available.states);
+        self->deadlines.states = ov_free(self->deadlines.states);
         free(self);
     }
 
     return 0;
 }
 
+/*****************************************************************************
+                                 DEADLINE HEAP
+ ****************************************************************************/
+
+static bool deadline_before(ProgState const *a, ProgState const *b) {
+
+    return a->start_time_epoch_usecs < b->start_time_epoch_usecs;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void deadline_place(ov_vm_prog_db *self, size_t index,
+                           ProgState *state) {
+
+    self->deadlines.states[index] = state;
+    state->heap_index = index;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void deadline_sift_up(ov_vm_prog_db *self, size_t index) {
+
+    ProgState **heap = self->deadlines.states;
+    ProgState *state = heap[index];
+
+    while ((1 < index) && deadline_before(state, heap[index / 2])) {
+
+        deadline_place(self, index, heap[index / 2]);
+        index /= 2;
+    }
+
+    deadline_place(self, index, state);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void deadline_sift_down(ov_vm_prog_db *self, size_t index) {
+
+    ProgState **heap = self->deadlines.states;
+    ProgState *state = heap[index];
+    size_t size = self->deadlines.size;
+
+    while (2 * index <= size) {
+
+        size_t child = 2 * index;
+
+        if ((child < size) && deadline_before(heap[child + 1], heap[child])) {
+            ++child;
+        }
+
+        if (!deadline_before(heap[child], state)) {
+            break;
+        }
+
+        deadline_place(self, index, heap[child]);
+        index = child;
+    }
+
+    deadline_place(self, index, state);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void deadline_insert_unsafe(ov_vm_prog_db *self, ProgState *state) {
+
+    OV_ASSERT(0 == state->heap_index);
+    OV_ASSERT(self->deadlines.size < self->pool.capacity);
+
+    ++self->deadlines.size;
+    deadline_place(self, self->deadlines.size, state);
+    deadline_sift_up(self, self->deadlines.size);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void deadline_remove_unsafe(ov_vm_prog_db *self, ProgState *state) {
+
+    size_t index = state->heap_index;
+
+    if (0 == index) {
+        return;
+    }
+
+    OV_ASSERT(state == self->deadlines.states[index]);
+
+    ProgState *last = self->deadlines.states[self->deadlines.size];
+
+    self->deadlines.states[self->deadlines.size] = 0;
+    --self->deadlines.size;
+    state->heap_index = 0;
+
+    if (last == state) {
+        return;
+    }
+
+    deadline_place(self, index, last);
+    deadline_sift_up(self, index);
+    deadline_sift_down(self, last->heap_index);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void deadline_update_unsafe(ov_vm_prog_db *self, ProgState *state) {
+
+    if (0 == state->heap_index) {
+        deadline_insert_unsafe(self, state);
+    } else {
+        deadline_sift_up(self, state->heap_index);
+        deadline_sift_down(self, state->heap_index);
+    }
+}
+
 /*****************************************************************************
                                      INSERT
  ****************************************************************************/
@@ -332,7 +460,7 @@ static ProgState *register_prog_unsafe(ov_hashtable *store, ProgState *prog) {
         ov_log_error("Could not register prog for ID %s", id);
         return 0;
     } else {
-        ov_log_info("Registered program %s", id);
+        ov_log_debug("Registered program %s", id);
         return prog;
     }
 }
@@ -406,9 +534,9 @@ static bool already_registered(ov_vm_prog_db *self, char const *id) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_vm_prog *insert_prog(ProgState *prog, ov_hashtable *store,
-                               char const *id, ov_vm_instr const *instructions,
-                               void *data) {
+static ov_vm_prog *insert_prog(ov_vm_prog_db *self, ProgState *prog,
+                               ov_hashtable *store, char const *id,
+                               ov_vm_instr const *instructions, void *data) {
 
     OV_ASSERT((0 != store) && (0 != id) && (0 != instructions));
 
@@ -416,8 +544,15 @@ static ov_vm_prog *insert_prog(ProgState *prog, ov_hashtable *store,
         return 0;
     } else {
         prog->start_time_epoch_usecs = ov_time_get_current_time_usecs();
-        return (ov_vm_prog *)register_prog_unsafe(
+
+        ProgState *registered = register_prog_unsafe(
             store, init_prog_state_unsafe(prog, id, instructions, data));
+
+        if (0 != registered) {
+            deadline_insert_unsafe(self, registered);
+        }
+
+        return (ov_vm_prog *)registered;
     }
 }
 
@@ -436,7 +571,7 @@ ov_vm_prog *ov_vm_prog_db_insert(ov_vm_prog_db *self, char const *id,
         return 0;
 
     } else {
-        return insert_prog(fresh_prog_state_unsafe(self), store, id,
+        return insert_prog(self, fresh_prog_state_unsafe(self), store, id,
                            instructions, data);
     }
 }
@@ -519,6 +654,7 @@ static bool release_prog(ov_vm_prog_db *self, ProgState *prog) {
 
             OV_ASSERT(capacity >= ti);
 
+            deadline_remove_unsafe(self, prog);
             clear_state(prog, self->release.additional, self->release.release);
 
             self->available.states[ti] = prog;
@@ -626,7 +762,7 @@ static void remove_aliases_for(ov_hashtable *aliases, char const *id) {
 
 static bool remove_internal(ov_vm_prog_db *self, char const *id) {
 
-    ov_log_info("Removing program %s", id);
+    ov_log_debug("Removing program %s", id);
     ProgState *prog = ov_hashtable_remove(get_store_mut(self), id);
 
     if (release_prog(self, prog)) {
@@ -663,8 +799,9 @@ bool ov_vm_prog_db_update_time(ov_vm_prog_db *self, char const *id) {
 
     } else {
 
-        ov_log_info("Updating time for request %s", id);
+        ov_log_debug("Updating time for request %s", id);
         state->start_time_epoch_usecs = ov_time_get_current_time_usecs();
+        deadline_update_unsafe(self, state);
 
         return true;
     }
@@ -674,20 +811,23 @@ bool ov_vm_prog_db_update_time(ov_vm_prog_db *self, char const *id) {
                                     NEXT_DUE
  ****************************************************************************/
 
-static char const *next_due_unsafe(ProgState *progs, size_t capacity,
+static char const *next_due_unsafe(ov_vm_prog_db const *self,
                                    uint64_t time_limit_epoch_usecs) {
 
-    OV_ASSERT(0 != progs);
+    OV_ASSERT(0 != self);
 
-    for (size_t i = 0; i < capacity; ++i) {
+    if (0 == self->deadlines.size) {
+        return 0;
+    }
 
-        if (time_limit_epoch_usecs > progs[i].start_time_epoch_usecs) {
+    ProgState *next = self->deadlines.states[1];
 
-            char const *id = ov_vm_prog_id((ov_vm_prog *)(progs + i));
-            ov_log_info("Next due request: %s", id);
+    if (time_limit_epoch_usecs > next->start_time_epoch_usecs) {
 
-            return id;
-        }
+        char const *id = ov_vm_prog_id((ov_vm_prog *)next);
+        ov_log_debug("Next due request: %s", id);
+
+        return id;
     }
 
     return 0;
@@ -704,8 +844,7 @@ char const *ov_vm_prog_db_next_due(ov_vm_prog_db *self,
 
     } else {
 
-        return next_due_unsafe(self->pool.states, self->pool.capacity,
-                               time_limit_epoch_usecs);
+        return next_due_unsafe(self, time_limit_epoch_usecs);
     }
 }
 
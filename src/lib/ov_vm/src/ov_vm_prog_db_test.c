@@ -510,6 +510,71 @@ static int test_ov_vm_prog_db_next_due() {
 
 /*----------------------------------------------------------------------------*/
 
+static int test_ov_vm_prog_db_next_due_order() {
+
+    const size_t num = 100;
+
+    ov_vm_prog_db *store = ov_vm_prog_db_create(num, 0, 0);
+    testrun(0 != store);
+
+    char id[OV_VM_PROG_ID_MAX_LEN] = {0};
+
+    for (size_t i = 0; i < num; ++i) {
+
+        snprintf(id, sizeof(id), "prog-%zu", i);
+        ProgState *state =
+            (ProgState *)ov_vm_prog_db_insert(store, id, test_instr, 0);
+        testrun(0 != state);
+
+        /* scramble start times */
+        state->start_time_epoch_usecs = 1 + (i * 37) % num;
+        deadline_update_unsafe(store, state);
+    }
+
+    testrun(num == store->deadlines.size);
+    testrun(0 == ov_vm_prog_db_next_due(store, 1));
+
+    /* remove some program in the middle of the heap */
+
+    testrun(0 == strcmp("prog-0", ov_vm_prog_db_next_due(store, 2)));
+    testrun(ov_vm_prog_db_remove(store, "prog-50"));
+    testrun(num - 1 == store->deadlines.size);
+
+    /* move the next due to the end */
+
+    testrun(ov_vm_prog_db_update_time(store, "prog-0"));
+    testrun(0 == ov_vm_prog_db_next_due(store, 1));
+
+    uint64_t last = 0;
+    size_t found = 0;
+
+    char const *next = ov_vm_prog_db_next_due(store, UINT64_MAX);
+
+    while (0 != next) {
+
+        ProgState *state = (ProgState *)ov_vm_prog_db_get(store, next);
+        testrun(0 != state);
+        testrun(last <= state->start_time_epoch_usecs);
+
+        last = state->start_time_epoch_usecs;
+        ++found;
+
+        testrun(ov_vm_prog_db_remove(store, next));
+        testrun(0 == state->heap_index);
+
+        next = ov_vm_prog_db_next_due(store, UINT64_MAX);
+    }
+
+    testrun(num - 1 == found);
+    testrun(0 == store->deadlines.size);
+
+    testrun(0 == ov_vm_prog_db_free(store));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 static int test_ov_vm_prog_db_alias() {
 
     testrun(!ov_vm_prog_db_alias(0, 0, 0));
@@ -770,6 +835,7 @@ static int test_ov_vm_prog_db_alias() {
 OV_TEST_RUN("ov_vm_prog_db", test_ov_vm_prog_db_create, test_ov_vm_prog_db_free,
             test_ov_vm_prog_db_insert, test_ov_vm_prog_db_get,
             test_ov_vm_prog_db_remove, test_ov_vm_prog_db_update_time,
-            test_ov_vm_prog_db_next_due, test_ov_vm_prog_db_alias);
+            test_ov_vm_prog_db_next_due, test_ov_vm_prog_db_next_due_order,
+            test_ov_vm_prog_db_alias);
 
 /*----------------------------------------------------------------------------*/
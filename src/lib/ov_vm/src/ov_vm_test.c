@@ -951,8 +951,128 @@ static int test_ov_vm_data_for() {
 
 /*----------------------------------------------------------------------------*/
 
+static int test_prune_overdue_requests() {
+
+    int test_data = 42;
+
+    resources res = create_resources_w_opcodes_notify_handlers(0, 0);
+    testrun(0 != res.vm);
+
+    reset_handler_states();
+    reset_notify_states();
+    reset_release_state();
+
+    ov_vm_instr instr[] = {
+        {OP_NEXT, 11, 12, 13}, {OP_WAIT, 14, 15, 16}, {OP_END, 0, 0, 0}};
+
+    char id[OV_VM_PROG_ID_MAX_LEN] = {0};
+
+    for (size_t i = 0; i < 20; ++i) {
+
+        snprintf(id, sizeof(id), "prog-%zu", i);
+        testrun(OV_EXEC_WAIT == ov_vm_trigger(res.vm, instr, id, &test_data));
+    }
+
+    testrun(OV_EXEC_OK == ov_vm_continue(res.vm, "prog-3"));
+    testrun(notify_state_equals(done_state, 1, "prog-3"));
+
+    testrun(0 == prune_overdue_requests(res.vm, res.vm->db, 1000 * 1000));
+
+    usleep(1000);
+
+    /* All overdue programs are aborted within one batch */
+
+    testrun(19 == prune_overdue_requests(res.vm, res.vm->db, 0));
+
+    testrun(19 == aborted_state.times_called);
+    testrun(notify_state_equals(failed_state, 0, 0));
+    testrun(0 == ov_vm_prog_db_next_due(res.vm->db, UINT64_MAX));
+
+    free_resources(res);
+
+    reset_handler_states();
+    reset_notify_states();
+    reset_release_state();
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int check_ov_vm_performance() {
+
+    const size_t num = 100000;
+    int test_data = 42;
+
+    ov_vm_config cfg = {
+        .default_program_timeout_msecs = TIMEOUT_VM_MSECS,
+        .max_requests = num,
+    };
+
+    resources res = create_resources_w_opcodes_notify_handlers(&cfg, 0);
+    testrun(0 != res.vm);
+
+    ov_vm_instr instr[] = {
+        {OP_NEXT, 11, 12, 13}, {OP_WAIT, 14, 15, 16}, {OP_END, 0, 0, 0}};
+
+    char id[OV_VM_PROG_ID_MAX_LEN] = {0};
+
+    ov_log_mute();
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < num; ++i) {
+        snprintf(id, sizeof(id), "prog-%zu", i);
+        ov_vm_trigger(res.vm, instr, id, &test_data);
+    }
+
+    uint64_t usec_trigger = ov_time_get_current_time_usecs() - start;
+    start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < num; ++i) {
+        snprintf(id, sizeof(id), "prog-%zu", i);
+        ov_vm_continue(res.vm, id);
+    }
+
+    uint64_t usec_complete = ov_time_get_current_time_usecs() - start;
+
+    for (size_t i = 0; i < num; ++i) {
+        snprintf(id, sizeof(id), "prog-%zu", i);
+        ov_vm_trigger(res.vm, instr, id, &test_data);
+    }
+
+    usleep(1000);
+    start = ov_time_get_current_time_usecs();
+
+    size_t aborted = prune_overdue_requests(res.vm, res.vm->db, 0);
+
+    uint64_t usec_timeout = ov_time_get_current_time_usecs() - start;
+
+    ov_log_unmute();
+
+    fprintf(stdout,
+            "%zu programs: trigger %.1f ns/op, complete %.1f ns/op, "
+            "timeout %.1f ns/op\n",
+            num, 1000.0 * usec_trigger / num, 1000.0 * usec_complete / num,
+            1000.0 * usec_timeout / num);
+
+    testrun(num == aborted);
+    testrun(0 == ov_vm_prog_db_next_due(res.vm->db, UINT64_MAX));
+
+    free_resources(res);
+
+    reset_handler_states();
+    reset_notify_states();
+    reset_release_state();
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 OV_TEST_RUN("ov_vm", test_ov_vm_create, test_ov_vm_free, test_ov_vm_register,
             test_ov_vm_trigger, test_ov_vm_continue, test_ov_vm_abort,
-            test_ov_vm_data_for);
+            test_ov_vm_data_for, test_prune_overdue_requests,
+            check_ov_vm_performance);
 
 /*----------------------------------------------------------------------------*/
@@ -81,6 +81,10 @@ bool ov_mc_backend_registry_unregister_mixer(ov_mc_backend_registry *self,
 
 /*----------------------------------------------------------------------------*/
 
+/**
+    Acquire some unused mixer for the user. Mixers of hosts without any
+    overloaded mixer are preferred.
+*/
 ov_mc_mixer_data
 ov_mc_backend_registry_acquire_user(ov_mc_backend_registry *self,
                                     const char *uuid);
@@ -104,4 +108,9 @@ bool ov_mc_backend_registry_release_user(ov_mc_backend_registry *self,
 ov_mc_backend_registry_count
 ov_mc_backend_registry_count_mixers(ov_mc_backend_registry *self);
 
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_backend_registry_set_overload(ov_mc_backend_registry *self,
+                                         int socket, bool overloaded);
+
 #endif /* ov_mc_backend_registry_h */
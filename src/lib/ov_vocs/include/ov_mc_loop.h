@@ -27,6 +27,11 @@
         IO interface for some mulicast loop. Will deliver RAW IO received at 
         some Multicast socket. 
 
+        With loop_bus enabled, the loop is received from the shared memory
+        bus of the host as well (see ov_base/ov_loop_bus.h). Publishers of
+        the same host using the bus disable multicast loopback, so their
+        frames are only received once.
+
 
         ------------------------------------------------------------------------
 */
@@ -34,6 +39,8 @@
 #define ov_mc_loop_h
 
 #include <ov_base/ov_event_loop.h>
+#include <ov_base/ov_loop_bus.h>
+#include <ov_base/ov_metrics.h>
 #include <ov_core/ov_mc_loop_data.h>
 
 /*----------------------------------------------------------------------------*/
@@ -47,6 +54,11 @@ typedef struct ov_mc_loop_config {
     ov_event_loop *loop;
     ov_mc_loop_data data;
 
+    bool loop_bus;
+
+    /* optional, frames and bytes received per loop */
+    ov_metrics *metrics;
+
     struct {
 
         void *userdata;
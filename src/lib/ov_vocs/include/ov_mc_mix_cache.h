@@ -0,0 +1,124 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_mc_mix_cache.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_vocs
+
+        @brief          Cache of encoded mixes, shared between mixers.
+
+        Mixers with the same input (same frames of the same streams at the
+        same volumes) produce the same mix. The first mixer encoding some
+        mix stores the encoded payload with the signature of its input,
+        all other mixers reuse it and only write their own RTP header.
+
+        The cache is a fixed table of slots within POSIX shared memory,
+        so mixer processes of one host share the cache by using the same
+        name. Without a name, the cache is process local.
+
+        Slots are guarded by a sequence lock, readers never block writers.
+        A writer finding some slot locked skips storing.
+
+        ------------------------------------------------------------------------
+*/
+#ifndef ov_mc_mix_cache_h
+#define ov_mc_mix_cache_h
+
+#include <ov_base/ov_json_value.h>
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define OV_MC_MIX_CACHE_NAME_DEFAULT "/openvocs_mix_cache"
+#define OV_MC_MIX_CACHE_NAME_MAX 64
+#define OV_MC_MIX_CACHE_SLOTS_DEFAULT 256
+#define OV_MC_MIX_CACHE_MAX_AGE_USEC_DEFAULT 100000
+#define OV_MC_MIX_CACHE_PAYLOAD_MAX 1280
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_mc_mix_cache ov_mc_mix_cache;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_mc_mix_cache_config {
+
+    /* shared memory object, process local cache if empty */
+    char name[OV_MC_MIX_CACHE_NAME_MAX];
+
+    size_t slots;          // rounded up to a power of 2
+    uint64_t max_age_usec; // entries older are not reused
+
+} ov_mc_mix_cache_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct ov_mc_mix_cache_stats {
+
+    uint64_t hits;   // encodes saved
+    uint64_t misses; // encodes done
+    uint64_t stored;
+
+} ov_mc_mix_cache_stats;
+
+/*----------------------------------------------------------------------------*/
+
+ov_mc_mix_cache *ov_mc_mix_cache_create(ov_mc_mix_cache_config config);
+ov_mc_mix_cache *ov_mc_mix_cache_free(ov_mc_mix_cache *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Get the payload stored for signature.
+
+    @param length       in: size of payload, out: bytes copied
+    @param num_samples  samples of the mix encoded
+
+    @returns true on hit
+*/
+bool ov_mc_mix_cache_get(ov_mc_mix_cache *self, uint64_t signature,
+                         uint64_t now_usec, uint8_t *payload, size_t *length,
+                         size_t *num_samples);
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_mix_cache_set(ov_mc_mix_cache *self, uint64_t signature,
+                         uint64_t now_usec, const uint8_t *payload,
+                         size_t length, size_t num_samples);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Order independent combination of the signatures of the inputs of
+    some mix. Start with 0.
+*/
+uint64_t ov_mc_mix_cache_signature_add(uint64_t signature, uint64_t input);
+
+/*----------------------------------------------------------------------------*/
+
+ov_mc_mix_cache_stats ov_mc_mix_cache_get_stats(const ov_mc_mix_cache *self);
+
+ov_json_value *ov_mc_mix_cache_stats_to_json(ov_mc_mix_cache_stats stats);
+
+#endif /* ov_mc_mix_cache_h */
@@ -36,6 +36,11 @@
 #include <ov_base/ov_vad_config.h>
 
 #include "ov_mc_loop.h"
+#include "ov_mc_mix_cache.h"
+
+#define OV_MC_MIXER_CORE_CYCLE_USECS 20000
+#define OV_MC_MIXER_CORE_OVERLOAD_WINDOW_DEFAULT 50
+#define OV_MC_MIXER_CORE_OVERLOAD_OVERRUNS_DEFAULT 5
 
 /*----------------------------------------------------------------------------*/
 
@@ -53,6 +58,34 @@ typedef struct ov_mc_mixer_core_forward {
 
 /*----------------------------------------------------------------------------*/
 
+/**
+    Each mix cycle is timed from the moment it was due until its frame
+    was sent. Cycles exceeding deadline_usecs are overruns. With at least
+    `overruns` within `window` cycles the mixer is overloaded and sheds
+    load, until some whole window passed without any overrun.
+
+    While overloaded
+     - only the max_talkers loudest frames are mixed (loudest by the
+       amplitude measured by the incoming VAD, first received without)
+     - skip_normalization mixes without incoming VAD and normalisation
+     - encoder_complexity (1 ... 10) is used for encoding
+
+    0 disables any of these.
+*/
+typedef struct ov_mc_mixer_core_overload_config {
+
+    uint64_t deadline_usecs; // default OV_MC_MIXER_CORE_CYCLE_USECS
+    size_t window;
+    size_t overruns;
+
+    size_t max_talkers;
+    bool skip_normalization;
+    int encoder_complexity;
+
+} ov_mc_mixer_core_overload_config;
+
+/*----------------------------------------------------------------------------*/
+
 typedef struct ov_mc_mixer_core_config {
 
     ov_event_loop *loop;
@@ -78,6 +111,43 @@ typedef struct ov_mc_mixer_core_config {
 
     } limit;
 
+    /* Adaptive jitter buffer per SSRC instead of the frame buffer.
+     * The delay follows the jitter measured, between min_frames and
+     * limit.frame_buffer_max. Lost frames are concealed by the codec
+     * (Opus PLC or in-band FEC of the next frame). */
+    struct {
+
+        bool adaptive;
+        size_t min_frames;
+
+    } jitter_buffer;
+
+    /* Share encoded mixes with other mixers of the same input,
+     * see ov_mc_mix_cache.h */
+    struct {
+
+        bool enabled;
+        ov_mc_mix_cache_config config;
+
+    } mix_cache;
+
+    /* Receive loops of publishers of the same host from shared memory,
+     * see ov_loop_bus.h */
+    bool loop_bus;
+
+    ov_mc_mixer_core_overload_config overload;
+
+    /* Not part of the configuration sent by the manager,
+     * kept on reconfigure */
+    struct {
+
+        void *userdata;
+
+        /* called whenever the mixer enters or leaves overload */
+        void (*overload)(void *userdata, bool overloaded);
+
+    } callback;
+
     ov_socket_configuration manager;
 
 } ov_mc_mixer_core_config;
@@ -150,4 +220,15 @@ uint8_t ov_mc_mixer_core_get_volume(const ov_mc_mixer_core *self,
 
 ov_json_value *ov_mc_mixer_state(ov_mc_mixer_core *self);
 
+bool ov_mc_mixer_core_is_overloaded(const ov_mc_mixer_core *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+    Late / lost / concealed counters per stream of the adaptive jitter
+    buffer, keyed by the SSRC. Empty object if the jitter buffer is not
+    adaptive.
+*/
+ov_json_value *ov_mc_mixer_core_jitter_buffer_stats(ov_mc_mixer_core *self);
+
 #endif /* ov_mc_mixer_core_h */
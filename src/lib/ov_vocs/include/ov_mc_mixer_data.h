@@ -42,6 +42,9 @@ typedef struct ov_mc_mixer_data {
     ov_id uuid;
     ov_id user;
 
+    /* reported by the mixer, see ov_mc_mixer_core_overload_config */
+    bool overloaded;
+
 } ov_mc_mixer_data;
 
 /*
@@ -53,6 +53,13 @@ ov_json_value *ov_mc_mixer_msg_configure(ov_mc_mixer_core_config config);
 ov_mc_mixer_core_config
 ov_mc_mixer_msg_configure_from_json(const ov_json_value *json);
 
+/**
+    Overload part of the configure message, also used to read the
+    overload configuration of the manager.
+*/
+ov_mc_mixer_core_overload_config
+ov_mc_mixer_msg_overload_config_from_json(const ov_json_value *json);
+
 /*----------------------------------------------------------------------------*/
 
 /**
@@ -187,4 +194,20 @@ ov_json_value *ov_mc_mixer_msg_state();
 
 /*----------------------------------------------------------------------------*/
 
+/**
+ * Sent by the mixer to its manager when entering or leaving overload.
+ * {
+    "event":"overload",
+    "parameter":
+    {
+        "overload":true
+    },
+    "uuid":"3bc4a60c-6adf-486c-ab62-61ae041d054e"
+    }
+*/
+ov_json_value *ov_mc_mixer_msg_overload(bool overloaded);
+bool ov_mc_mixer_msg_overload_get(const ov_json_value *msg);
+
+/*----------------------------------------------------------------------------*/
+
 #endif /* ov_mc_mixer_msg_h */
@@ -595,6 +595,27 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static void cb_event_overload(void *userdata, const char *name, int socket,
+                              ov_json_value *input) {
+
+    ov_mc_backend *self = ov_mc_backend_cast(userdata);
+    if (!self || !name || socket < 0 || !input)
+        goto error;
+
+    bool overloaded = ov_mc_mixer_msg_overload_get(input);
+
+    ov_log_info("Mixer %i %s overload", socket,
+                overloaded ? "entered" : "left");
+
+    ov_mc_backend_registry_set_overload(self->registry, socket, overloaded);
+
+error:
+    ov_json_value_free(input);
+    return;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool register_app_callbacks(ov_mc_backend *self) {
 
     OV_ASSERT(self);
@@ -627,6 +648,10 @@ static bool register_app_callbacks(ov_mc_backend *self) {
                                cb_event_forward))
         goto error;
 
+    if (!ov_event_app_register(self->app, OV_KEY_OVERLOAD, self,
+                               cb_event_overload))
+        goto error;
+
     return true;
 error:
     return false;
@@ -1061,6 +1086,36 @@ ov_mc_backend_config ov_mc_backend_config_from_json(const ov_json_value *val) {
     config.mixer.config.limit.frame_buffer_max =
         ov_json_number_get(ov_json_get(par, "/" OV_KEY_FRAME_BUFFER));
 
+    if (ov_json_is_true(ov_json_get(
+            par, "/" OV_KEY_JITTER_BUFFER "/" OV_KEY_ENABLED))) {
+        config.mixer.config.jitter_buffer.adaptive = true;
+    } else {
+        config.mixer.config.jitter_buffer.adaptive = false;
+    }
+
+    config.mixer.config.jitter_buffer.min_frames = ov_json_number_get(
+        ov_json_get(par, "/" OV_KEY_JITTER_BUFFER "/" OV_KEY_MIN));
+
+    if (ov_json_is_true(
+            ov_json_get(par, "/" OV_KEY_MIX_CACHE "/" OV_KEY_ENABLED))) {
+        config.mixer.config.mix_cache.enabled = true;
+    } else {
+        config.mixer.config.mix_cache.enabled = false;
+    }
+
+    const char *mix_cache_name = ov_json_string_get(
+        ov_json_get(par, "/" OV_KEY_MIX_CACHE "/" OV_KEY_NAME));
+
+    if (mix_cache_name)
+        strncpy(config.mixer.config.mix_cache.config.name, mix_cache_name,
+                OV_MC_MIX_CACHE_NAME_MAX - 1);
+
+    if (ov_json_is_true(ov_json_get(par, "/" OV_KEY_LOOP_BUS))) {
+        config.mixer.config.loop_bus = true;
+    } else {
+        config.mixer.config.loop_bus = false;
+    }
+
     if (ov_json_is_true(ov_json_get(par, "/" OV_KEY_NORMALIZE_INPUT))) {
         config.mixer.config.normalize_input = true;
     } else {
@@ -1079,6 +1134,9 @@ ov_mc_backend_config ov_mc_backend_config_from_json(const ov_json_value *val) {
         config.mixer.config.normalize_mixing_result_by_square_root = false;
     }
 
+    config.mixer.config.overload = ov_mc_mixer_msg_overload_config_from_json(
+        ov_json_get(par, "/" OV_KEY_OVERLOAD));
+
     return config;
 }
 
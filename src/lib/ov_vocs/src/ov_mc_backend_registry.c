@@ -34,6 +34,8 @@
 #include <ov_base/ov_socket.h>
 #include <ov_base/ov_string.h>
 
+#include <ov_core/ov_mixer_pool.h>
+
 #define OV_MC_BACKEND_REGISTRY_MAGIC_BYTES 0xbeab
 
 /*----------------------------------------------------------------------------*/
@@ -45,6 +47,9 @@ struct ov_mc_backend_registry {
 
     ov_dict *users;
 
+    /* unused mixers per host */
+    ov_mixer_pool *pool;
+
     size_t sockets;
     ov_mc_mixer_data socket[];
 };
@@ -85,6 +90,10 @@ ov_mc_backend_registry_create(ov_mc_backend_registry_config config) {
     if (!self->users)
         goto error;
 
+    self->pool = ov_mixer_pool_create();
+    if (!self->pool)
+        goto error;
+
     return self;
 error:
     ov_mc_backend_registry_free(self);
@@ -100,6 +109,7 @@ ov_mc_backend_registry_free(ov_mc_backend_registry *self) {
         return self;
 
     self->users = ov_dict_free(self->users);
+    self->pool = ov_mixer_pool_free(self->pool);
     self = ov_data_pointer_free(self);
     return NULL;
 }
@@ -131,7 +141,15 @@ bool ov_mc_backend_registry_register_mixer(ov_mc_backend_registry *self,
         goto error;
 
     ov_mc_mixer_data *slot = &self->socket[data.socket];
+
+    if (0 != slot->user[0])
+        ov_dict_del(self->users, slot->user);
+
+    if (!ov_mixer_pool_add(self->pool, data.socket, data.remote.host))
+        goto error;
+
     *slot = data;
+    slot->overloaded = false;
 
     memset(slot->user, 0, sizeof(ov_id));
 
@@ -155,6 +173,12 @@ bool ov_mc_backend_registry_unregister_mixer(ov_mc_backend_registry *self,
         goto error;
 
     ov_mc_mixer_data *slot = &self->socket[socket];
+
+    if (0 != slot->user[0])
+        ov_dict_del(self->users, slot->user);
+
+    ov_mixer_pool_remove(self->pool, socket);
+
     *slot = (ov_mc_mixer_data){0};
     slot->socket = -1;
     return true;
@@ -170,20 +194,10 @@ ov_mc_backend_registry_count_mixers(ov_mc_backend_registry *self) {
     if (!self)
         goto error;
 
-    ov_mc_backend_registry_count counter = (ov_mc_backend_registry_count){0};
+    ov_mixer_pool_count count = ov_mixer_pool_count_mixers(self->pool);
 
-    for (size_t i = 0; i < self->sockets; i++) {
-
-        if (-1 == self->socket[i].socket)
-            continue;
-
-        counter.mixers++;
-
-        if (0 != self->socket[i].user[0])
-            counter.used++;
-    }
-
-    return counter;
+    return (ov_mc_backend_registry_count){.mixers = count.mixers,
+                                          .used = count.used};
 
 error:
     return (ov_mc_backend_registry_count){0};
@@ -198,23 +212,12 @@ ov_mc_backend_registry_acquire_user(ov_mc_backend_registry *self,
     if (!self || !uuid)
         goto error;
 
-    ov_mc_mixer_data *slot = NULL;
-
-    for (size_t i = 0; i < self->sockets; i++) {
-
-        if (-1 == self->socket[i].socket)
-            continue;
-
-        if (0 != self->socket[i].user[0])
-            continue;
-
-        slot = &self->socket[i];
-        break;
-    }
-
-    if (!slot)
+    int socket = ov_mixer_pool_acquire(self->pool);
+    if (-1 == socket)
         goto error;
 
+    ov_mc_mixer_data *slot = &self->socket[socket];
+
     strncpy(slot->user, uuid, sizeof(ov_id));
 
     char *key = ov_string_dup((char *)slot->user);
@@ -223,6 +226,7 @@ ov_mc_backend_registry_acquire_user(ov_mc_backend_registry *self,
     if (!ov_dict_set(self->users, key, (void *)val, NULL)) {
         key = ov_data_pointer_free(key);
         memset(slot->user, 0, sizeof(ov_id));
+        ov_mixer_pool_release(self->pool, socket);
         goto error;
     }
 
@@ -279,9 +283,35 @@ bool ov_mc_backend_registry_release_user(ov_mc_backend_registry *self,
 
     ov_mc_mixer_data *data = &self->socket[slot];
 
-    memset(data->user, 0, sizeof(ov_id));
+    if (0 != data->user[0]) {
+        memset(data->user, 0, sizeof(ov_id));
+        ov_mixer_pool_release(self->pool, slot);
+    }
     ov_dict_del(self->users, uuid);
     return true;
 error:
     return false;
 }
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_backend_registry_set_overload(ov_mc_backend_registry *self,
+                                         int socket, bool overloaded) {
+
+    if (!self)
+        goto error;
+
+    if (socket > (int)self->sockets)
+        goto error;
+    if (socket < 1)
+        goto error;
+
+    ov_mc_mixer_data *slot = &self->socket[socket];
+    if (socket != slot->socket)
+        goto error;
+
+    slot->overloaded = overloaded;
+    return ov_mixer_pool_set_overload(self->pool, socket, overloaded);
+error:
+    return false;
+}
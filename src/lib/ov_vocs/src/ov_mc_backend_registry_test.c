@@ -275,6 +275,63 @@ int test_ov_mc_backend_registry_acquire_user() {
 
 /*----------------------------------------------------------------------------*/
 
+int test_ov_mc_backend_registry_set_overload() {
+
+    ov_mc_backend_registry *reg =
+        ov_mc_backend_registry_create((ov_mc_backend_registry_config){0});
+    testrun(reg);
+
+    testrun(ov_mc_backend_registry_register_mixer(
+        reg, (ov_mc_mixer_data){
+                 .socket = 1, .uuid = "m-1", .remote.host = "10.0.0.1"}));
+    testrun(ov_mc_backend_registry_register_mixer(
+        reg, (ov_mc_mixer_data){
+                 .socket = 2, .uuid = "m-2", .remote.host = "10.0.0.1"}));
+    testrun(ov_mc_backend_registry_register_mixer(
+        reg, (ov_mc_mixer_data){
+                 .socket = 3, .uuid = "m-3", .remote.host = "10.0.0.2"}));
+
+    testrun(!ov_mc_backend_registry_set_overload(NULL, 1, true));
+    testrun(!ov_mc_backend_registry_set_overload(reg, 0, true));
+    testrun(!ov_mc_backend_registry_set_overload(reg, 4, true));
+
+    testrun(ov_mc_backend_registry_set_overload(reg, 1, true));
+    testrun(reg->socket[1].overloaded);
+
+    /* host 10.0.0.1 is overloaded, 10.0.0.2 is preferred */
+
+    ov_mc_mixer_data data = ov_mc_backend_registry_acquire_user(reg, "1-1");
+    testrun(3 == data.socket);
+
+    /* overloaded hosts are used if nothing else is left */
+
+    data = ov_mc_backend_registry_acquire_user(reg, "2-1");
+    testrun((1 == data.socket) || (2 == data.socket));
+
+    int socket = data.socket;
+
+    data = ov_mc_backend_registry_acquire_user(reg, "3-1");
+    testrun((1 == data.socket) || (2 == data.socket));
+    testrun(socket != data.socket);
+
+    data = ov_mc_backend_registry_acquire_user(reg, "4-1");
+    testrun(0 == data.socket);
+
+    /* recovered */
+
+    testrun(ov_mc_backend_registry_set_overload(reg, 1, false));
+    testrun(!reg->socket[1].overloaded);
+
+    testrun(ov_mc_backend_registry_set_overload(reg, 2, true));
+    testrun(ov_mc_backend_registry_unregister_mixer(reg, 2));
+    testrun(2 == ov_mc_backend_registry_count_mixers(reg).mixers);
+
+    testrun(NULL == ov_mc_backend_registry_free(reg));
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_mc_backend_registry_get_user() {
 
     ov_mc_backend_registry *reg =
@@ -380,6 +437,7 @@ int all_tests() {
     testrun_test(test_ov_mc_backend_registry_get_user);
     testrun_test(test_ov_mc_backend_registry_get_socket);
     testrun_test(test_ov_mc_backend_registry_release_user);
+    testrun_test(test_ov_mc_backend_registry_set_overload);
 
     return testrun_counter;
 }
@@ -55,6 +55,9 @@ typedef struct IceProxyConnection {
     uint64_t load;
     ov_dict *sessions;
 
+    /* position within the load heap, 0 if not contained */
+    size_t heap_index;
+
 } IceProxyConnection;
 
 /*----------------------------------------------------------------------------*/
@@ -66,6 +69,16 @@ struct ov_mc_frontend_registry {
 
     ov_dict *sessions;
 
+    /*
+     * Min heap of all registered proxies ordered by load,
+     * the least loaded proxy at the root.
+     * Usable index runs from 1 through size.
+     */
+    struct {
+        IceProxyConnection **connections;
+        size_t size;
+    } load;
+
     size_t sockets;
     IceProxyConnection socket[];
 };
@@ -113,8 +126,122 @@ error:
     return NULL;
 }
 
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      LOAD HEAP
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static bool load_before(const IceProxyConnection *a,
+                        const IceProxyConnection *b) {
+
+    if (a->load != b->load)
+        return a->load < b->load;
+
+    return a->socket < b->socket;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_place(ov_mc_frontend_registry *self, size_t index,
+                       IceProxyConnection *connection) {
+
+    self->load.connections[index] = connection;
+    connection->heap_index = index;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_sift_up(ov_mc_frontend_registry *self, size_t index) {
+
+    IceProxyConnection **heap = self->load.connections;
+    IceProxyConnection *connection = heap[index];
+
+    while ((1 < index) && load_before(connection, heap[index / 2])) {
+
+        load_place(self, index, heap[index / 2]);
+        index /= 2;
+    }
+
+    load_place(self, index, connection);
+}
+
 /*----------------------------------------------------------------------------*/
 
+static void load_sift_down(ov_mc_frontend_registry *self, size_t index) {
+
+    IceProxyConnection **heap = self->load.connections;
+    IceProxyConnection *connection = heap[index];
+    size_t size = self->load.size;
+
+    while (2 * index <= size) {
+
+        size_t child = 2 * index;
+
+        if ((child < size) && load_before(heap[child + 1], heap[child])) {
+            ++child;
+        }
+
+        if (!load_before(heap[child], connection)) {
+            break;
+        }
+
+        load_place(self, index, heap[child]);
+        index = child;
+    }
+
+    load_place(self, index, connection);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_insert(ov_mc_frontend_registry *self,
+                        IceProxyConnection *connection) {
+
+    OV_ASSERT(0 == connection->heap_index);
+    OV_ASSERT(self->load.size < self->sockets);
+
+    ++self->load.size;
+    load_place(self, self->load.size, connection);
+    load_sift_up(self, self->load.size);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void load_remove(ov_mc_frontend_registry *self,
+                        IceProxyConnection *connection) {
+
+    size_t index = connection->heap_index;
+
+    if (0 == index)
+        return;
+
+    OV_ASSERT(connection == self->load.connections[index]);
+
+    IceProxyConnection *last = self->load.connections[self->load.size];
+
+    self->load.connections[self->load.size] = 0;
+    --self->load.size;
+    connection->heap_index = 0;
+
+    if (last == connection)
+        return;
+
+    load_place(self, index, last);
+    load_sift_up(self, index);
+    load_sift_down(self, last->heap_index);
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      GENERIC FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
+
 static void init_socket(IceProxyConnection *self) {
 
     self->socket = -1;
@@ -149,6 +276,11 @@ ov_mc_frontend_registry_create(ov_mc_frontend_registry_config config) {
     if (!self->sessions)
         goto error;
 
+    self->load.connections =
+        calloc(max_sockets + 1, sizeof(IceProxyConnection *));
+    if (!self->load.connections)
+        goto error;
+
     return self;
 error:
     ov_mc_frontend_registry_free(self);
@@ -169,6 +301,7 @@ ov_mc_frontend_registry_free(ov_mc_frontend_registry *self) {
     }
 
     self->sessions = ov_dict_free(self->sessions);
+    self->load.connections = ov_data_pointer_free(self->load.connections);
     self = ov_data_pointer_free(self);
     return NULL;
 }
@@ -212,8 +345,11 @@ bool ov_mc_frontend_registry_register_proxy(ov_mc_frontend_registry *self,
         goto error;
 
     connection->socket = socket;
+    connection->load = 0;
     strncpy(connection->uuid, uuid, sizeof(ov_id));
 
+    load_insert(self, connection);
+
     return true;
 error:
     return false;
@@ -233,8 +369,11 @@ bool ov_mc_frontend_registry_unregister_proxy(ov_mc_frontend_registry *self,
         goto error;
 
     IceProxyConnection *connection = &self->socket[socket];
+    load_remove(self, connection);
+
     connection->sessions = ov_dict_free(connection->sessions);
     connection->socket = -1;
+    connection->load = 0;
     memset(connection->uuid, 0, sizeof(ov_id));
 
     return true;
@@ -249,21 +388,10 @@ int ov_mc_frontend_registry_get_proxy_socket(ov_mc_frontend_registry *self) {
     if (!self)
         goto error;
 
-    uint64_t load = UINT64_MAX;
-    int socket = -1;
-
-    for (size_t i = 0; i < self->sockets; i++) {
-
-        if (-1 == self->socket[i].socket)
-            continue;
-
-        if (self->socket[i].load < load) {
-            load = self->socket[i].load;
-            socket = i;
-        }
-    }
+    if (0 == self->load.size)
+        goto error;
 
-    return socket;
+    return self->load.connections[1]->socket;
 
 error:
     return -1;
@@ -313,6 +441,10 @@ bool ov_mc_frontend_registry_register_session(ov_mc_frontend_registry *self,
     }
 
     connection->load++;
+
+    if (0 != connection->heap_index)
+        load_sift_down(self, connection->heap_index);
+
     return true;
 error:
     return false;
@@ -333,9 +465,14 @@ bool ov_mc_frontend_registry_unregister_session(ov_mc_frontend_registry *self,
     sess = ov_data_pointer_free(sess);
     ov_dict_del(self->sessions, session_uuid);
 
-    if (connection->load > 0)
+    if (connection->load > 0) {
+
         connection->load--;
 
+        if (0 != connection->heap_index)
+            load_sift_up(self, connection->heap_index);
+    }
+
     return true;
 error:
     return false;
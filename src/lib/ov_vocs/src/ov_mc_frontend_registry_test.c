@@ -243,6 +243,19 @@ int test_ov_mc_frontend_registry_get_proxy_socket() {
     testrun(ov_mc_frontend_registry_register_session(reg, 3, "session6"));
     testrun(2 == ov_mc_frontend_registry_get_proxy_socket(reg));
 
+    /* released sessions make a proxy the least loaded again */
+
+    testrun(ov_mc_frontend_registry_unregister_session(reg, "session4"));
+    testrun(ov_mc_frontend_registry_unregister_session(reg, "session1"));
+    testrun(1 == ov_mc_frontend_registry_get_proxy_socket(reg));
+
+    testrun(ov_mc_frontend_registry_unregister_proxy(reg, 1));
+    testrun(2 == ov_mc_frontend_registry_get_proxy_socket(reg));
+    testrun(ov_mc_frontend_registry_unregister_proxy(reg, 2));
+    testrun(3 == ov_mc_frontend_registry_get_proxy_socket(reg));
+    testrun(ov_mc_frontend_registry_unregister_proxy(reg, 3));
+    testrun(-1 == ov_mc_frontend_registry_get_proxy_socket(reg));
+
     testrun(NULL == ov_mc_frontend_registry_free(reg));
 
     return testrun_log_success();
@@ -40,6 +40,15 @@ struct ov_mc_loop {
 
     int rtp_fhd;
     // int rtcp_fhd;
+
+    ov_loop_bus *bus;
+
+    struct {
+
+        ov_metrics_series *frames_in;
+        ov_metrics_series *bytes_in;
+
+    } metric;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -66,6 +75,9 @@ static bool io_multicast(int sfd, uint8_t events, void *userdata) {
     if (-1 == bytes)
         goto done;
 
+    ov_metrics_count(loop->metric.frames_in, 1);
+    ov_metrics_count(loop->metric.bytes_in, bytes);
+
     in = ov_socket_data_from_sockaddr_storage(&in.sa);
 
     if (loop->config.callback.io)
@@ -80,6 +92,47 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static void io_loop_bus(void *userdata, const uint8_t *buffer, size_t bytes) {
+
+    ov_mc_loop *loop = ov_mc_loop_cast(userdata);
+
+    /* frames of the bus are sent from the same host */
+    ov_socket_data in = {0};
+
+    if (!loop)
+        return;
+
+    ov_metrics_count(loop->metric.frames_in, 1);
+    ov_metrics_count(loop->metric.bytes_in, bytes);
+
+    if (loop->config.callback.io)
+        loop->config.callback.io(loop->config.callback.userdata,
+                                 &loop->config.data, buffer, bytes, &in);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_loop_bus *open_loop_bus(ov_mc_loop *loop) {
+
+    ov_loop_bus_config config = (ov_loop_bus_config){
+        .loop = loop->config.loop,
+        .callback.userdata = loop,
+        .callback.io = io_loop_bus};
+
+    ov_loop_bus *bus = NULL;
+
+    if (ov_loop_bus_name(loop->config.data.socket, config.name,
+                         sizeof(config.name)))
+        bus = ov_loop_bus_create(config);
+
+    if (!bus)
+        ov_log_error("Failed to open loop bus %s", loop->config.data.name);
+
+    return bus;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static int open_mc_udp_socket(char const *interface, int port) {
 
     ov_socket_configuration s_config =
@@ -128,6 +181,18 @@ ov_mc_loop *ov_mc_loop_create(ov_mc_loop_config config) {
     1);
     */
 
+    loop->metric.frames_in =
+        ov_metrics_counter(config.metrics, "frames_in", config.data.name);
+    loop->metric.bytes_in =
+        ov_metrics_counter(config.metrics, "bytes_in", config.data.name);
+
+    if (config.loop_bus) {
+
+        loop->bus = open_loop_bus(loop);
+        if (!loop->bus)
+            goto error;
+    }
+
     ov_event_loop *l = config.loop;
 
     if (ov_event_loop_set(l,
@@ -168,6 +233,7 @@ ov_mc_loop *ov_mc_loop_free(ov_mc_loop *self) {
         return self;
 
     close_mc_sfh(self->config.loop, self->rtp_fhd);
+    self->bus = ov_loop_bus_free(self->bus);
     // close_mc_sfh(self->config.loop, self->rtcp_fhd);
 
     self = ov_data_pointer_free(self);
@@ -236,6 +302,13 @@ ov_json_value *ov_mc_loop_to_json(ov_mc_loop *self) {
     if (!ov_json_object_set(out, OV_KEY_SOCKET, val))
         goto error;
 
+    if (self->bus) {
+
+        val = ov_loop_bus_stats_to_json(ov_loop_bus_get_stats(self->bus));
+        if (!ov_json_object_set(out, OV_KEY_LOOP_BUS, val))
+            goto error;
+    }
+
     return out;
 error:
     ov_json_value_free(val);
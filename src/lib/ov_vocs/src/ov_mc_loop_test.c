@@ -177,6 +177,70 @@ int test_ov_mc_loop_cast() {
 
 /*----------------------------------------------------------------------------*/
 
+int test_ov_mc_loop_bus() {
+
+    struct userdata userdata = {0};
+
+    ov_metrics *metrics = ov_metrics_create((ov_metrics_config){0});
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    ov_mc_loop_config config =
+        (ov_mc_loop_config){.loop = loop,
+                            .data = (ov_mc_loop_data){.socket.host = "229.0.0."
+                                                                     "1",
+                                                      .socket.port = 12345,
+                                                      .socket.type = UDP,
+                                                      .name = "loop_bus_1",
+                                                      .volume = 50},
+                            .loop_bus = true,
+                            .metrics = metrics,
+                            .callback.userdata = &userdata,
+                            .callback.io = cb_io};
+
+    ov_mc_loop *l = ov_mc_loop_create(config);
+    testrun(l);
+    testrun(l->bus);
+
+    /* buses are named after the multicast group */
+
+    ov_loop_bus_config bus = {0};
+    testrun(ov_loop_bus_name(config.data.socket, bus.name, sizeof(bus.name)));
+    testrun(0 == strcmp("229.0.0.1:12345", bus.name));
+
+    ov_loop_bus *publisher = ov_loop_bus_create(bus);
+    testrun(publisher);
+
+    testrun(ov_loop_bus_publish(publisher, (uint8_t *)"test", 4));
+    testrun(loop->run(loop, OV_RUN_ONCE));
+
+    testrun(4 == userdata.bytes);
+    testrun(0 == memcmp("test", userdata.buffer, 4));
+    testrun(0 == strcmp("loop_bus_1", userdata.data.name));
+    testrun(0 == userdata.remote.host[0]);
+
+    testrun(1 == ov_metrics_counter_get(
+                     ov_metrics_counter(metrics, "frames_in", "loop_bus_1")));
+    testrun(4 == ov_metrics_counter_get(
+                     ov_metrics_counter(metrics, "bytes_in", "loop_bus_1")));
+
+    ov_json_value *out = ov_mc_loop_to_json(l);
+    testrun(1 == ov_json_number_get(ov_json_get(
+                     out, "/" OV_KEY_LOOP_BUS "/received")));
+    out = ov_json_value_free(out);
+
+    testrun(NULL == ov_loop_bus_free(publisher));
+    testrun(NULL == ov_mc_loop_free(l));
+    testrun(ov_loop_bus_unlink(bus.name));
+    testrun(NULL == ov_event_loop_free(loop));
+    testrun(NULL == ov_metrics_free(metrics));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_mc_loop_set_volume() {
 
     struct userdata userdata = {0};
@@ -299,6 +363,7 @@ int all_tests() {
     testrun_test(test_ov_mc_loop_create);
     testrun_test(test_ov_mc_loop_free);
     testrun_test(test_ov_mc_loop_cast);
+    testrun_test(test_ov_mc_loop_bus);
 
     testrun_test(test_ov_mc_loop_set_volume);
     testrun_test(test_ov_mc_loop_get_volume);
@@ -0,0 +1,330 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_mc_mix_cache.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "../include/ov_mc_mix_cache.h"
+
+#include <stdatomic.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <ov_base/ov_json.h>
+#include <ov_base/ov_shm.h>
+#include <ov_base/ov_utils.h>
+
+#define OV_MC_MIX_CACHE_MAGIC_BYTES 0x6d78
+#define OV_MC_MIX_CACHE_SHM_MAGIC 0x6f766d78
+
+#define SLOTS_MAX 65536
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    /* odd while written */
+    _Atomic uint32_t sequence;
+
+    uint32_t length;
+    uint32_t num_samples;
+
+    uint64_t signature;
+    uint64_t created_usec;
+
+    uint8_t payload[OV_MC_MIX_CACHE_PAYLOAD_MAX];
+
+} Slot;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    ov_shm_header header;
+
+    Slot slot[];
+
+} Table;
+
+/*----------------------------------------------------------------------------*/
+
+struct ov_mc_mix_cache {
+
+    uint16_t magic_bytes;
+    ov_mc_mix_cache_config config;
+
+    size_t mask;
+
+    Table *table;
+    size_t size;
+    bool shared;
+
+    ov_mc_mix_cache_stats stats;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static ov_mc_mix_cache *as_mix_cache(const void *data) {
+
+    if (!data)
+        return NULL;
+
+    if (*(uint16_t *)data != OV_MC_MIX_CACHE_MAGIC_BYTES)
+        return NULL;
+
+    return (ov_mc_mix_cache *)data;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_mc_mix_cache *ov_mc_mix_cache_create(ov_mc_mix_cache_config config) {
+
+    ov_mc_mix_cache *self = NULL;
+
+    if (0 == config.slots)
+        config.slots = OV_MC_MIX_CACHE_SLOTS_DEFAULT;
+
+    if (0 == config.max_age_usec)
+        config.max_age_usec = OV_MC_MIX_CACHE_MAX_AGE_USEC_DEFAULT;
+
+    size_t slots = 1;
+
+    while ((slots < config.slots) && (slots < SLOTS_MAX)) {
+        slots <<= 1;
+    }
+
+    config.slots = slots;
+    config.name[OV_MC_MIX_CACHE_NAME_MAX - 1] = 0;
+
+    self = calloc(1, sizeof(ov_mc_mix_cache));
+    if (!self)
+        goto error;
+
+    self->magic_bytes = OV_MC_MIX_CACHE_MAGIC_BYTES;
+    self->config = config;
+    self->mask = slots - 1;
+    self->size = sizeof(Table) + slots * sizeof(Slot);
+
+    if (0 != config.name[0]) {
+
+        self->shared = true;
+        self->table = ov_shm_map(config.name, self->size);
+
+    } else {
+
+        self->table = calloc(1, self->size);
+    }
+
+    if (!self->table) {
+        ov_log_error("Mix cache: failed to map %s", config.name);
+        goto error;
+    }
+
+    if (!ov_shm_header_init(&self->table->header, OV_MC_MIX_CACHE_SHM_MAGIC,
+                            slots, sizeof(Slot))) {
+        ov_log_error("Mix cache: incompatible table %s", config.name);
+        goto error;
+    }
+
+    return self;
+error:
+    ov_mc_mix_cache_free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_mc_mix_cache *ov_mc_mix_cache_free(ov_mc_mix_cache *self) {
+
+    if (!as_mix_cache(self))
+        return self;
+
+    if (self->shared && self->table) {
+
+        /* the shared memory object is kept for other processes */
+        self->table = ov_shm_unmap(self->table, self->size);
+
+    } else {
+
+        free(self->table);
+    }
+
+    free(self);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_mix_cache_get(ov_mc_mix_cache *self, uint64_t signature,
+                         uint64_t now_usec, uint8_t *payload, size_t *length,
+                         size_t *num_samples) {
+
+    if (!as_mix_cache(self) || !payload || !length || !num_samples)
+        goto error;
+
+    Slot *slot = &self->table->slot[signature & self->mask];
+
+    uint32_t sequence = atomic_load_explicit(&slot->sequence,
+                                             memory_order_acquire);
+
+    /* a writer may change the slot while copying, read the length once and
+     * bound the copy, the sequence check below discards torn reads */
+
+    size_t bytes = *(volatile uint32_t *)&slot->length;
+    size_t samples = slot->num_samples;
+
+    if ((sequence & 1) || (slot->signature != signature) ||
+        (slot->created_usec + self->config.max_age_usec < now_usec) ||
+        (bytes > *length)) {
+        goto miss;
+    }
+
+    if (bytes > OV_MC_MIX_CACHE_PAYLOAD_MAX)
+        bytes = OV_MC_MIX_CACHE_PAYLOAD_MAX;
+
+    memcpy(payload, slot->payload, bytes);
+
+    atomic_thread_fence(memory_order_acquire);
+
+    if (sequence !=
+        atomic_load_explicit(&slot->sequence, memory_order_relaxed)) {
+        goto miss;
+    }
+
+    *length = bytes;
+    *num_samples = samples;
+
+    self->stats.hits++;
+    return true;
+
+miss:
+    self->stats.misses++;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_mix_cache_set(ov_mc_mix_cache *self, uint64_t signature,
+                         uint64_t now_usec, const uint8_t *payload,
+                         size_t length, size_t num_samples) {
+
+    if (!as_mix_cache(self) || !payload || (0 == length))
+        goto error;
+
+    if (length > OV_MC_MIX_CACHE_PAYLOAD_MAX)
+        goto error;
+
+    Slot *slot = &self->table->slot[signature & self->mask];
+
+    uint32_t sequence =
+        atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+
+    if (sequence & 1)
+        goto error;
+
+    /* lock, skip if some other writer was faster */
+
+    if (!atomic_compare_exchange_strong_explicit(
+            &slot->sequence, &sequence, sequence + 1, memory_order_acquire,
+            memory_order_relaxed)) {
+        goto error;
+    }
+
+    atomic_thread_fence(memory_order_release);
+
+    slot->signature = signature;
+    slot->created_usec = now_usec;
+    slot->length = length;
+    slot->num_samples = num_samples;
+    memcpy(slot->payload, payload, length);
+
+    atomic_store_explicit(&slot->sequence, sequence + 2,
+                          memory_order_release);
+
+    self->stats.stored++;
+    return true;
+error:
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t mix64(uint64_t x) {
+
+    /* splitmix64 finalizer */
+
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+
+    return x;
+}
+
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_mc_mix_cache_signature_add(uint64_t signature, uint64_t input) {
+
+    /* addition is order independent */
+    return signature + mix64(input + 0x9e3779b97f4a7c15ULL);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_mc_mix_cache_stats ov_mc_mix_cache_get_stats(const ov_mc_mix_cache *self) {
+
+    if (!as_mix_cache(self))
+        return (ov_mc_mix_cache_stats){0};
+
+    return self->stats;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_mc_mix_cache_stats_to_json(ov_mc_mix_cache_stats stats) {
+
+    ov_json_value *out = ov_json_object();
+    ov_json_value *val = NULL;
+
+    val = ov_json_number(stats.hits);
+    if (!ov_json_object_set(out, "saved", val))
+        goto error;
+
+    val = ov_json_number(stats.misses);
+    if (!ov_json_object_set(out, "encoded", val))
+        goto error;
+
+    val = ov_json_number(stats.stored);
+    if (!ov_json_object_set(out, "stored", val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(val);
+    ov_json_value_free(out);
+    return NULL;
+}
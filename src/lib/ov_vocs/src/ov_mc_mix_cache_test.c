@@ -0,0 +1,268 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_mc_mix_cache_test.c
+
+        @date           2026-10-18
+
+
+        ------------------------------------------------------------------------
+*/
+#include "ov_mc_mix_cache.c"
+
+#include <ov_base/ov_time.h>
+#include <sys/mman.h>
+#include <ov_test/testrun.h>
+
+/*----------------------------------------------------------------------------*/
+
+static ov_mc_mix_cache_config shared_config(const char *suffix) {
+
+    ov_mc_mix_cache_config config = {0};
+
+    snprintf(config.name, sizeof(config.name), "/ov_mix_cache_test_%i_%s",
+             getpid(), suffix);
+
+    return config;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mix_cache_create() {
+
+    ov_mc_mix_cache *cache =
+        ov_mc_mix_cache_create((ov_mc_mix_cache_config){.slots = 100});
+    testrun(cache);
+    testrun(!cache->shared);
+    testrun(127 == cache->mask);
+    testrun(OV_MC_MIX_CACHE_MAX_AGE_USEC_DEFAULT ==
+            cache->config.max_age_usec);
+    testrun(NULL == ov_mc_mix_cache_free(cache));
+
+    /* shared */
+
+    ov_mc_mix_cache_config config = shared_config("create");
+
+    cache = ov_mc_mix_cache_create(config);
+    testrun(cache);
+    testrun(cache->shared);
+    testrun(OV_MC_MIX_CACHE_SLOTS_DEFAULT == cache->config.slots);
+
+    /* same name, different geometry */
+
+    config.slots = 2 * OV_MC_MIX_CACHE_SLOTS_DEFAULT;
+    testrun(NULL == ov_mc_mix_cache_create(config));
+
+    testrun(NULL == ov_mc_mix_cache_free(cache));
+    shm_unlink(config.name);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mix_cache_free() {
+
+    testrun(NULL == ov_mc_mix_cache_free(NULL));
+
+    ov_mc_mix_cache *cache =
+        ov_mc_mix_cache_create((ov_mc_mix_cache_config){0});
+    testrun(cache);
+    testrun(NULL == ov_mc_mix_cache_free(cache));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mix_cache_get() {
+
+    uint8_t payload[OV_MC_MIX_CACHE_PAYLOAD_MAX] = {0};
+    uint8_t out[OV_MC_MIX_CACHE_PAYLOAD_MAX] = {0};
+
+    size_t length = sizeof(out);
+    size_t samples = 0;
+
+    memset(payload, 'a', sizeof(payload));
+
+    ov_mc_mix_cache_config config = shared_config("get");
+    config.max_age_usec = 1000;
+
+    ov_mc_mix_cache *writer = ov_mc_mix_cache_create(config);
+    ov_mc_mix_cache *reader = ov_mc_mix_cache_create(config);
+    testrun(writer);
+    testrun(reader);
+
+    testrun(!ov_mc_mix_cache_get(NULL, 1, 0, out, &length, &samples));
+    testrun(!ov_mc_mix_cache_get(reader, 1, 0, out, &length, &samples));
+    testrun(1 == reader->stats.misses);
+
+    testrun(!ov_mc_mix_cache_set(NULL, 1, 0, payload, 100, 960));
+    testrun(!ov_mc_mix_cache_set(writer, 1, 0, payload, 0, 960));
+    testrun(!ov_mc_mix_cache_set(writer, 1, 0, payload,
+                                 OV_MC_MIX_CACHE_PAYLOAD_MAX + 1, 960));
+
+    testrun(ov_mc_mix_cache_set(writer, 1, 500, payload, 100, 960));
+
+    /* shared with the reader */
+
+    testrun(ov_mc_mix_cache_get(reader, 1, 1000, out, &length, &samples));
+    testrun(100 == length);
+    testrun(960 == samples);
+    testrun(0 == memcmp(payload, out, 100));
+    testrun(1 == reader->stats.hits);
+
+    /* signature differs */
+
+    length = sizeof(out);
+    testrun(!ov_mc_mix_cache_get(reader, 1 + reader->config.slots, 1000, out,
+                                 &length, &samples));
+
+    /* too old */
+
+    testrun(!ov_mc_mix_cache_get(reader, 1, 2000, out, &length, &samples));
+
+    /* buffer too small */
+
+    length = 99;
+    testrun(!ov_mc_mix_cache_get(reader, 1, 1000, out, &length, &samples));
+
+    /* locked while written */
+
+    length = sizeof(out);
+    atomic_fetch_add(&writer->table->slot[1].sequence, 1);
+    testrun(!ov_mc_mix_cache_get(reader, 1, 1000, out, &length, &samples));
+    testrun(!ov_mc_mix_cache_set(writer, 1, 1000, payload, 100, 960));
+    atomic_fetch_add(&writer->table->slot[1].sequence, 1);
+    testrun(ov_mc_mix_cache_get(reader, 1, 1000, out, &length, &samples));
+
+    ov_mc_mix_cache_stats stats = ov_mc_mix_cache_get_stats(reader);
+    testrun(2 == stats.hits);
+    testrun(5 == stats.misses);
+    testrun(1 == ov_mc_mix_cache_get_stats(writer).stored);
+
+    testrun(NULL == ov_mc_mix_cache_free(writer));
+    testrun(NULL == ov_mc_mix_cache_free(reader));
+    shm_unlink(config.name);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mix_cache_signature_add() {
+
+    uint64_t a = ov_mc_mix_cache_signature_add(0, 1);
+    a = ov_mc_mix_cache_signature_add(a, 2);
+    a = ov_mc_mix_cache_signature_add(a, 3);
+
+    uint64_t b = ov_mc_mix_cache_signature_add(0, 3);
+    b = ov_mc_mix_cache_signature_add(b, 1);
+    b = ov_mc_mix_cache_signature_add(b, 2);
+
+    testrun(a == b);
+
+    uint64_t c = ov_mc_mix_cache_signature_add(0, 1);
+    c = ov_mc_mix_cache_signature_add(c, 2);
+
+    testrun(a != c);
+    testrun(0 != ov_mc_mix_cache_signature_add(0, 0));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mix_cache_stats_to_json() {
+
+    ov_json_value *out = ov_mc_mix_cache_stats_to_json(
+        (ov_mc_mix_cache_stats){.hits = 3, .misses = 2, .stored = 1});
+
+    testrun(3 == ov_json_number_get(ov_json_get(out, "/saved")));
+    testrun(2 == ov_json_number_get(ov_json_get(out, "/encoded")));
+    testrun(1 == ov_json_number_get(ov_json_get(out, "/stored")));
+
+    out = ov_json_value_free(out);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_mix_cache_performance() {
+
+    uint8_t payload[200] = {0};
+    uint8_t out[OV_MC_MIX_CACHE_PAYLOAD_MAX] = {0};
+
+    const size_t runs = 1000000;
+
+    ov_mc_mix_cache *cache =
+        ov_mc_mix_cache_create((ov_mc_mix_cache_config){0});
+    testrun(cache);
+
+    testrun(ov_mc_mix_cache_set(cache, 42, 1, payload, sizeof(payload), 960));
+
+    uint64_t start = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < runs; ++i) {
+
+        size_t length = sizeof(out);
+        size_t samples = 0;
+
+        ov_mc_mix_cache_get(cache, 42, 1, out, &length, &samples);
+    }
+
+    uint64_t usec = ov_time_get_current_time_usecs() - start;
+
+    fprintf(stdout, "mix cache: %zu hits of %zu bytes %.1f ns/op\n", runs,
+            sizeof(payload), 1000.0 * usec / runs);
+
+    testrun(runs == cache->stats.hits);
+    testrun(NULL == ov_mc_mix_cache_free(cache));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    testrun_test(test_ov_mc_mix_cache_create);
+    testrun_test(test_ov_mc_mix_cache_free);
+    testrun_test(test_ov_mc_mix_cache_get);
+    testrun_test(test_ov_mc_mix_cache_signature_add);
+    testrun_test(test_ov_mc_mix_cache_stats_to_json);
+    testrun_test(check_mix_cache_performance);
+
+    return testrun_counter;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      TEST EXECUTION                                                  #EXEC
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+testrun_run(all_tests);
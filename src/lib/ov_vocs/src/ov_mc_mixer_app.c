@@ -93,6 +93,24 @@ static void cb_connected(void *userdata, int socket) {
     return;
 }
 
+/*----------------------------------------------------------------------------*/
+
+static void cb_overload(void *userdata, bool overloaded) {
+
+    ov_mc_mixer_app *app = ov_mc_mixer_app_cast(userdata);
+    if (!app || (-1 == app->socket))
+        goto error;
+
+    /* let the manager steer new users to other mixers */
+
+    ov_json_value *out = ov_mc_mixer_msg_overload(overloaded);
+    ov_event_app_send(app->app, app->socket, out);
+    out = ov_json_value_free(out);
+
+error:
+    return;
+}
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -589,8 +607,11 @@ ov_mc_mixer_app *ov_mc_mixer_app_create(ov_mc_mixer_app_config config) {
 
     app->socket = ov_event_app_open_connection(app->app, conn_config);
 
-    app->mixer = ov_mc_mixer_core_create((ov_mc_mixer_core_config){
-        .loop = config.loop, .manager = config.manager});
+    app->mixer = ov_mc_mixer_core_create(
+        (ov_mc_mixer_core_config){.loop = config.loop,
+                                  .manager = config.manager,
+                                  .callback.userdata = app,
+                                  .callback.overload = cb_overload});
     if (!app->mixer)
         goto error;
 
@@ -38,12 +38,16 @@
 
 #include <ov_base/ov_dict.h>
 #include <ov_base/ov_linked_list.h>
+#include <ov_base/ov_metrics.h>
 #include <ov_base/ov_rtcp.h>
 #include <ov_base/ov_string.h>
 
 #include <ov_backend/ov_frame_data.h>
 #include <ov_backend/ov_frame_data_list.h>
 #include <ov_base/ov_rtp_frame_buffer.h>
+#include <ov_base/ov_rtp_jitter_buffer.h>
+#include <ov_base/ov_rtp_view.h>
+#include <ov_base/ov_time.h>
 
 #include <ov_codec/ov_codec.h>
 #include <ov_codec/ov_codec_factory.h>
@@ -69,6 +73,37 @@ struct ov_mc_mixer_core {
     ov_dict *loops;
 
     ov_rtp_frame_buffer *frame_buffer;
+    ov_rtp_jitter_buffer *jitter_buffer;
+    ov_frame_data_list *jitter_buffer_playout;
+
+    ov_mc_mix_cache *mix_cache;
+
+    ov_metrics *metrics;
+
+    struct {
+
+        ov_metrics_series *frames_dropped;
+        ov_metrics_series *frames_out;
+        ov_metrics_series *decode_usec;
+        ov_metrics_series *encode_usec;
+        ov_metrics_series *mix_usec;
+        ov_metrics_series *cycle_usec;
+        ov_metrics_series *overruns;
+        ov_metrics_series *overloads;
+
+    } metric;
+
+    struct {
+
+        /* time the next mix cycle is due */
+        uint64_t due_usec;
+
+        size_t cycles;
+        size_t overruns;
+
+        bool active;
+
+    } overload;
 
     uint32_t mix_timer;
 
@@ -175,6 +210,17 @@ static void cb_io_multicast(void *userdata, const ov_mc_loop_data *data,
         break;
     }
 
+    /* Echo cancelation == ignore all incoming frames with the SSRC
+     * of the forward destination configured, without decoding them.
+     * The view is only read here. */
+
+    ov_rtp_view view = {0};
+
+    if (!ov_rtp_view_parse(&view, (uint8_t *)buffer, bytes) ||
+        (ov_rtp_view_ssrc(&view) == mixer->forward.ssrc)) {
+        return;
+    }
+
     frame = ov_rtp_frame_decode(buffer, bytes);
 
     if (0 != frame) {
@@ -186,18 +232,19 @@ static void cb_io_multicast(void *userdata, const ov_mc_loop_data *data,
         frame->bytes.data[1] |= data->volume;
         frame->expanded.payload_type = data->volume;
 
-        /* Echo cancelation == ignore all incoming frames with the SSRC
-         * of the forward destination configured. */
+        if (mixer->jitter_buffer) {
+
+            frame = ov_rtp_jitter_buffer_add(mixer->jitter_buffer, frame,
+                                             ov_time_get_current_time_usecs());
 
-        if (frame->expanded.ssrc == mixer->forward.ssrc) {
-            /*
-                        ov_log_debug("Ignoring (Dropping) frame for SSRC %"
-               PRIu32, frame->expanded.ssrc);
-            */
         } else {
 
             frame = ov_rtp_frame_buffer_add(mixer->frame_buffer, frame);
         }
+
+        /* late, duplicate or replaced */
+        if (frame)
+            ov_metrics_count(mixer->metric.frames_dropped, 1);
     }
 
     frame = ov_rtp_frame_free(frame);
@@ -213,6 +260,8 @@ typedef struct {
         bool voice_detected : 1;
     };
 
+    uint8_t volume; // of the last frame, used for concealment
+
     time_t last_used_epoch_secs; // For garbage collection
 
 } RtpStream;
@@ -314,10 +363,15 @@ static ov_buffer *decode(ov_mc_mixer_core *mixer, ov_rtp_frame const *frame,
     ov_buffer *decoded = ov_buffer_create(buflen_max);
     OV_ASSERT(NULL != decoded);
 
+    uint64_t start_usec = ov_time_get_current_time_usecs();
+
     decoded->length = ov_codec_decode(
         codec, frame->expanded.sequence_number, frame->expanded.payload.data,
         frame->expanded.payload.length, decoded->start, decoded->capacity);
 
+    ov_metrics_observe(mixer->metric.decode_usec,
+                       ov_time_get_current_time_usecs() - start_usec);
+
     return decoded;
 error:
     return NULL;
@@ -510,6 +564,42 @@ frame_data_from_pcm_with_vad(ov_buffer const *decoded,
 
 /*----------------------------------------------------------------------------*/
 
+static ov_frame_data *
+frame_data_from_decoded(ov_mc_mixer_core *mixer, ov_buffer const *decoded,
+                        ov_rtp_frame_expansion const *frame,
+                        RtpStream *rtp_stream) {
+
+    ov_frame_data *data = 0;
+
+    if ((0 != decoded) && (0 != decoded->length)) {
+
+        /* Scale volume to percent */
+
+        double scale_factor = frame->payload_type;
+        scale_factor /= 100.0;
+
+        bool shed = mixer->overload.active &&
+                    mixer->config.overload.skip_normalization;
+
+        if (mixer->config.incoming_vad && !shed) {
+
+            ov_log_debug("VAD active - normalizing");
+            data = frame_data_from_pcm_with_vad(
+                decoded, frame, mixer->config.vad, mixer->config.drop_no_va,
+                scale_factor, rtp_stream);
+
+        } else {
+
+            ov_log_debug("VAD inactive - no normalization");
+            data = frame_data_from_pcm(decoded, frame, scale_factor);
+        }
+    }
+
+    return data;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static ov_frame_data *frame_data_extract_nocheck(ov_mc_mixer_core *mixer,
                                                  ov_rtp_frame *const frame) {
 
@@ -528,31 +618,74 @@ static ov_frame_data *frame_data_extract_nocheck(ov_mc_mixer_core *mixer,
         const size_t buflen_max =
             2 * OV_MAX_FRAME_LENGTH_MS * OV_MAX_SAMPLERATE_HZ / 1000;
 
-        /* Scale volume to percent */
-
-        double scale_factor = frame->expanded.payload_type;
-        scale_factor /= 100.0;
+        rtp_stream->volume = frame->expanded.payload_type;
 
         decoded = decode(mixer, frame, rtp_stream->codec, buflen_max);
 
-        if ((0 != decoded) && (0 != decoded->length)) {
+        data = frame_data_from_decoded(mixer, decoded, &frame->expanded,
+                                       rtp_stream);
+    }
 
-            if (mixer->config.incoming_vad) {
+    decoded = ov_buffer_free(decoded);
+    OV_ASSERT(0 == decoded);
 
-                ov_log_debug("VAD active - normalizing");
-                data = frame_data_from_pcm_with_vad(
-                    decoded, &frame->expanded, mixer->config.vad,
-                    mixer->config.drop_no_va, scale_factor, rtp_stream);
+    return data;
+}
 
-            } else {
+/*----------------------------------------------------------------------------*/
 
-                ov_log_debug("VAD inactive - no normalization");
-                data = frame_data_from_pcm(decoded, &frame->expanded,
-                                           scale_factor);
-            }
-        }
+/**
+ * Conceal some slot lost within the jitter buffer.
+ * The frame following (if any) is passed to the codec for in-band FEC.
+ */
+static ov_frame_data *
+frame_data_conceal_nocheck(ov_mc_mixer_core *mixer,
+                           ov_rtp_jitter_buffer_slot const *slot) {
+
+    ov_frame_data *data = 0;
+    ov_buffer *decoded = 0;
+
+    RtpStream *rtp_stream = rtp_stream_for_ssrc(mixer, slot->ssrc);
+
+    if (!ov_ptr_valid(rtp_stream,
+                      "Cannot conceal frame - no Stream info found") ||
+        (0 == rtp_stream->codec)) {
+        goto error;
+    }
+
+    const uint8_t *next = 0;
+    size_t next_length = 0;
+
+    if (0 != slot->next) {
+        next = slot->next->expanded.payload.data;
+        next_length = slot->next->expanded.payload.length;
     }
 
+    const size_t buflen_max =
+        2 * OV_MAX_FRAME_LENGTH_MS * OV_MAX_SAMPLERATE_HZ / 1000;
+
+    decoded = ov_buffer_create(buflen_max);
+    OV_ASSERT(0 != decoded);
+
+    int32_t bytes = ov_codec_conceal(rtp_stream->codec, next, next_length,
+                                     decoded->start, decoded->capacity);
+
+    if (0 >= bytes)
+        goto error;
+
+    decoded->length = bytes;
+
+    ov_rtp_frame_expansion expanded = {
+        .ssrc = slot->ssrc,
+        .sequence_number = slot->sequence_number,
+        .timestamp = slot->timestamp,
+        .payload_type = rtp_stream->volume,
+    };
+
+    data = frame_data_from_decoded(mixer, decoded, &expanded, rtp_stream);
+
+error:
+
     decoded = ov_buffer_free(decoded);
     OV_ASSERT(0 == decoded);
 
@@ -711,35 +844,38 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static ov_buffer *mix_frames_nocheck(ov_mc_mixer_core *self, size_t num_frames,
-                                     ov_list *frames_list, size_t *num_samples,
-                                     ov_frame_data_list **used_frames) {
+static ov_buffer *mix_frame_data_nocheck(ov_frame_data_list const *list,
+                                         size_t *num_samples) {
 
-    if ((!ov_ptr_valid(self, "Internal error: No mixer processing object")) ||
-        (!ov_ptr_valid(used_frames,
-                       "Internal error: No pointer to store used frames")) ||
-        (0 == num_samples) || (0 == frames_list) || (0 == num_frames)) {
-        goto error;
-    }
+    size_t len_bytes = 0;
+
+    frame_length_from_frame_list(list, &len_bytes, num_samples);
 
-    ov_frame_data_list *list = ov_frame_data_list_create(num_frames);
-    *used_frames = list;
+    return mix_nocheck(list, len_bytes, *num_samples);
+}
 
-    extract_frame_data(self, list, frames_list);
+/*----------------------------------------------------------------------------*/
 
-    frames_list = ov_mc_mixer_core_frame_processing_list_free(frames_list);
+static ov_frame_data_list *
+frame_data_from_frames_nocheck(ov_mc_mixer_core *self, size_t num_frames,
+                               ov_list *frames_list) {
 
-    size_t len_bytes = 0;
+    ov_frame_data_list *list = 0;
 
-    frame_length_from_frame_list(list, &len_bytes, num_samples);
+    if ((!ov_ptr_valid(self, "Internal error: No mixer processing object")) ||
+        (0 == frames_list) || (0 == num_frames)) {
+        goto error;
+    }
 
-    return mix_nocheck(list, len_bytes, *num_samples);
+    list = ov_frame_data_list_create(num_frames);
+
+    extract_frame_data(self, list, frames_list);
 
 error:
 
     frames_list = ov_mc_mixer_core_frame_processing_list_free(frames_list);
 
-    return 0;
+    return list;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -880,6 +1016,7 @@ static bool forward_mixed_frame_to_destination(ov_mc_mixer_core *mixer,
     if (-1 == bytes)
         goto error;
 
+    ov_metrics_count(mixer->metric.frames_out, 1);
     return true;
 error:
     return false;
@@ -890,7 +1027,8 @@ error:
 static void
 forward_mixed_frame_to_encoder(ov_mc_mixer_core *mixer,
                                ov_frame_data mixed_data,
-                               ov_frame_data_list *original_frames) {
+                               ov_frame_data_list *original_frames,
+                               uint64_t signature) {
 
     ov_rtp_frame *encoded_frame = NULL;
     UNUSED(original_frames);
@@ -906,8 +1044,32 @@ forward_mixed_frame_to_encoder(ov_mc_mixer_core *mixer,
 
     ov_codec *codec = get_destination_codec(mixer);
 
+    if (codec && (0 != mixer->config.overload.encoder_complexity)) {
+
+        int complexity = OV_CODEC_COMPLEXITY_DEFAULT;
+
+        if (mixer->overload.active)
+            complexity = mixer->config.overload.encoder_complexity;
+
+        ov_codec_set_complexity(codec, complexity);
+    }
+
+    uint64_t start_usec = ov_time_get_current_time_usecs();
+
     encoded_frame = encode_frame_nocheck(&mixed_data, codec);
 
+    ov_metrics_observe(mixer->metric.encode_usec,
+                       ov_time_get_current_time_usecs() - start_usec);
+
+    if (mixer->mix_cache && encoded_frame) {
+
+        ov_mc_mix_cache_set(mixer->mix_cache, signature,
+                            ov_time_get_current_time_usecs(),
+                            encoded_frame->expanded.payload.data,
+                            encoded_frame->expanded.payload.length,
+                            num_samples);
+    }
+
     if (!forward_mixed_frame_to_destination(mixer, encoded_frame))
         goto error;
 error:
@@ -917,31 +1079,16 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static bool process_frames(ov_mc_mixer_core *mixer, ov_list *frames) {
-
-    bool result = false;
-    ov_buffer *mixed_payload = NULL;
-    ov_frame_data_list *used_frames = NULL;
-
-    if (!mixer || !frames)
-        goto finish;
-
-    size_t num_frames = ov_list_count(frames);
-
-    size_t num_samples = 0;
-
-    mixed_payload = mix_frames_nocheck(mixer, num_frames, frames, &num_samples,
-                                       &used_frames);
-
-    frames = 0;
+static bool forward_mixed(ov_mc_mixer_core *mixer, ov_buffer *mixed_payload,
+                          size_t num_samples, ov_frame_data_list *used_frames,
+                          uint64_t signature) {
 
     if (0 == mixed_payload) {
         mixed_payload = get_comfort_noise(mixer, &num_samples);
     }
 
     if (0 == mixed_payload) {
-        result = true;
-        goto finish;
+        return true;
     }
 
     /*-----------------------------------------------------------------------*/
@@ -961,20 +1108,196 @@ static bool process_frames(ov_mc_mixer_core *mixer, ov_list *frames) {
     mixer->output.sequence_number += 1;
     mixer->output.timestamp += num_samples;
 
-    forward_mixed_frame_to_encoder(mixer, mixed_data, used_frames);
+    forward_mixed_frame_to_encoder(mixer, mixed_data, used_frames, signature);
 
     mixed_data.pcm16s_32bit = 0;
+    mixed_payload = ov_buffer_free(mixed_payload);
+    OV_ASSERT(0 == mixed_payload);
+
+    mixer->output.mark = false;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Signature of the input of some mix, equal for all mixers mixing the
+ * same frames at the same volumes with the same settings.
+ */
+static uint64_t mix_signature(ov_mc_mixer_core *mixer,
+                              ov_frame_data_list const *list) {
+
+    uint64_t signature = 0;
+
+    for (size_t i = 0; (0 != list) && (list->capacity > i); ++i) {
+
+        ov_frame_data const *frame = list->frames[i];
+
+        if (0 == frame)
+            continue;
 
+        uint64_t input = frame->ssid;
+        input = (input << 16) | frame->sequence_number;
+
+        /* the loop volume travels as payload type,
+         * see frame_data_extract_nocheck */
+        uint8_t volume = frame->payload_type;
+
+        signature = ov_mc_mix_cache_signature_add(signature, input);
+        signature =
+            ov_mc_mix_cache_signature_add(signature, frame->timestamp);
+        signature = ov_mc_mix_cache_signature_add(signature, volume);
+    }
+
+    uint64_t settings = mixer->config.samplerate_hz;
+    settings = (settings << 16) |
+               (uint16_t)mixer->config.comfort_noise_max_amplitude;
+    settings = (settings << 1) | mixer->config.incoming_vad;
+    settings = (settings << 1) | mixer->config.drop_no_va;
+    settings = (settings << 1) | mixer->config.rtp_keepalive;
+    settings = (settings << 1) |
+               mixer->config.normalize_mixing_result_by_square_root;
+
+    /* the mix of an overloaded mixer may be reduced */
+    settings = (settings << 1) | mixer->overload.active;
+
+    return ov_mc_mix_cache_signature_add(signature, settings);
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Forward the encoded mix of some other mixer with the same input,
+ * only the RTP header is our own.
+ */
+static bool forward_cached_mix(ov_mc_mixer_core *mixer, uint64_t signature) {
+
+    uint8_t payload[OV_MC_MIX_CACHE_PAYLOAD_MAX];
+    size_t length = sizeof(payload);
+    size_t num_samples = 0;
+
+    if (!ov_mc_mix_cache_get(mixer->mix_cache, signature,
+                             ov_time_get_current_time_usecs(), payload,
+                             &length, &num_samples)) {
+        return false;
+    }
+
+    ov_rtp_frame_expansion exp = {
+
+        .version = RTP_VERSION_2,
+        .payload_type = mixer->output.payload_type,
+        .marker_bit = mixer->output.mark,
+        .sequence_number = mixer->output.sequence_number,
+        .timestamp = mixer->output.timestamp,
+        .ssrc = mixer->output.ssid,
+
+        .payload.length = length,
+        .payload.data = payload,
+
+    };
+
+    ov_rtp_frame *frame = ov_rtp_frame_encode(&exp);
+
+    forward_mixed_frame_to_destination(mixer, frame);
+    frame = ov_rtp_frame_free(frame);
+
+    mixer->output.sequence_number += 1;
+    mixer->output.timestamp += num_samples;
     mixer->output.mark = false;
-    result = true;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ * Drop all but the max loudest frames of the list.
+ * Of equally loud frames, the later ones are dropped first. Without VAD
+ * no amplitudes are known, hence the first max frames are kept.
+ */
+static void keep_loudest_frames(ov_frame_data_list *list, size_t max) {
+
+    size_t count = 0;
+
+    for (size_t i = 0; i < list->capacity; ++i) {
+
+        if (0 != list->frames[i])
+            ++count;
+    }
+
+    while (count > max) {
+
+        size_t quietest = list->capacity;
+
+        for (size_t i = 0; i < list->capacity; ++i) {
+
+            if (0 == list->frames[i])
+                continue;
+
+            if ((quietest == list->capacity) ||
+                (list->frames[i]->max_amplitude <=
+                 list->frames[quietest]->max_amplitude)) {
+                quietest = i;
+            }
+        }
+
+        list->frames[quietest] = ov_frame_data_free(list->frames[quietest]);
+        --count;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool forward_frame_data(ov_mc_mixer_core *mixer,
+                               ov_frame_data_list *list) {
+
+    ov_buffer *mixed_payload = NULL;
+    size_t num_samples = 0;
+    uint64_t signature = 0;
+
+    if ((0 != list) && mixer->overload.active &&
+        (0 != mixer->config.overload.max_talkers)) {
+
+        keep_loudest_frames(list, mixer->config.overload.max_talkers);
+    }
+
+    if (mixer->mix_cache) {
+
+        signature = mix_signature(mixer, list);
+
+        if (forward_cached_mix(mixer, signature))
+            return true;
+    }
+
+    if (0 != list)
+        mixed_payload = mix_frame_data_nocheck(list, &num_samples);
+
+    return forward_mixed(mixer, mixed_payload, num_samples, list, signature);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool process_frames(ov_mc_mixer_core *mixer, ov_list *frames) {
+
+    bool result = false;
+    ov_frame_data_list *used_frames = NULL;
+
+    if (!mixer || !frames)
+        goto finish;
+
+    size_t num_frames = ov_list_count(frames);
+
+    used_frames = frame_data_from_frames_nocheck(mixer, num_frames, frames);
+
+    frames = 0;
+
+    result = forward_frame_data(mixer, used_frames);
 
 finish:
 
-    mixed_payload = ov_buffer_free(mixed_payload);
     frames = ov_mc_mixer_core_frame_processing_list_free(frames);
     used_frames = ov_frame_data_list_free(used_frames);
 
-    OV_ASSERT(0 == mixed_payload);
     OV_ASSERT(0 == used_frames);
     OV_ASSERT(0 == frames);
 
@@ -983,6 +1306,66 @@ finish:
 
 /*----------------------------------------------------------------------------*/
 
+static bool push_jitter_buffer_slot(void *userdata,
+                                    ov_rtp_jitter_buffer_slot *slot) {
+
+    ov_frame_data *data = 0;
+
+    ov_mc_mixer_core *mixer = ov_mc_mixer_core_cast(userdata);
+    ov_frame_data_list *list = mixer->jitter_buffer_playout;
+
+    if (0 != slot->frame) {
+
+        if (0 != slot->frame->expanded.payload.length)
+            data = frame_data_extract_nocheck(mixer, slot->frame);
+
+        slot->frame = ov_rtp_frame_free(slot->frame);
+
+    } else {
+
+        data = frame_data_conceal_nocheck(mixer, slot);
+
+        if (0 == data)
+            return false;
+    }
+
+    data = ov_frame_data_list_push_data(list, data);
+    data = ov_frame_data_free(data);
+    OV_ASSERT(0 == data);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool process_jitter_buffer(ov_mc_mixer_core *mixer) {
+
+    size_t num_streams =
+        ov_rtp_jitter_buffer_count_streams(mixer->jitter_buffer);
+
+    if (0 == num_streams)
+        num_streams = 1;
+
+    ov_frame_data_list *list = ov_frame_data_list_create(num_streams);
+
+    mixer->jitter_buffer_playout = list;
+
+    ov_rtp_jitter_buffer_playout(mixer->jitter_buffer,
+                                 ov_time_get_current_time_usecs(), mixer,
+                                 push_jitter_buffer_slot);
+
+    mixer->jitter_buffer_playout = NULL;
+
+    bool result = forward_frame_data(mixer, list);
+
+    list = ov_frame_data_list_free(list);
+    OV_ASSERT(0 == list);
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool codec_gc_run(ov_mc_mixer_core *self,
                          uint32_t max_stream_lifetime_secs);
 
@@ -1005,9 +1388,67 @@ static bool run_gc_if_required(ov_mc_mixer_core *self) {
 
 /*----------------------------------------------------------------------------*/
 
+static void set_overload(ov_mc_mixer_core *mixer, bool overloaded) {
+
+    mixer->overload.active = overloaded;
+
+    if (overloaded) {
+
+        ov_log_error("Mixer %s overloaded - shedding load", mixer->name);
+        ov_metrics_count(mixer->metric.overloads, 1);
+
+    } else {
+
+        ov_log_info("Mixer %s recovered from overload", mixer->name);
+    }
+
+    if (mixer->config.callback.overload)
+        mixer->config.callback.overload(mixer->config.callback.userdata,
+                                        overloaded);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void monitor_cycle(ov_mc_mixer_core *mixer, uint64_t due_usec,
+                          uint64_t done_usec) {
+
+    uint64_t cycle_usec = 0;
+
+    if (done_usec > due_usec)
+        cycle_usec = done_usec - due_usec;
+
+    ov_metrics_observe(mixer->metric.cycle_usec, cycle_usec);
+
+    if (cycle_usec > mixer->config.overload.deadline_usecs) {
+
+        mixer->overload.overruns++;
+        ov_metrics_count(mixer->metric.overruns, 1);
+    }
+
+    if (++mixer->overload.cycles < mixer->config.overload.window)
+        return;
+
+    bool overloaded = mixer->overload.active;
+
+    if (mixer->overload.overruns >= mixer->config.overload.overruns) {
+        overloaded = true;
+    } else if (0 == mixer->overload.overruns) {
+        overloaded = false;
+    }
+
+    mixer->overload.cycles = 0;
+    mixer->overload.overruns = 0;
+
+    if (overloaded != mixer->overload.active)
+        set_overload(mixer, overloaded);
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool cb_mix(uint32_t id, void *data) {
 
     ov_list *frame_list = 0;
+    uint64_t done_usec = 0;
 
     ov_mc_mixer_core *mixer = ov_mc_mixer_core_cast(data);
 
@@ -1016,8 +1457,25 @@ static bool cb_mix(uint32_t id, void *data) {
 
     run_gc_if_required(mixer);
 
-    mixer->mix_timer =
-        ov_event_loop_timer_set(mixer->config.loop, 20000, mixer, cb_mix);
+    mixer->mix_timer = ov_event_loop_timer_set(
+        mixer->config.loop, OV_MC_MIXER_CORE_CYCLE_USECS, mixer, cb_mix);
+
+    uint64_t start_usec = ov_time_get_current_time_usecs();
+
+    /* the timer was set at the start of the last cycle,
+     * time spent waiting for the loop counts against the deadline */
+
+    uint64_t due_usec = mixer->overload.due_usec;
+
+    if ((0 == due_usec) || (due_usec > start_usec))
+        due_usec = start_usec;
+
+    mixer->overload.due_usec = start_usec + OV_MC_MIXER_CORE_CYCLE_USECS;
+
+    if (mixer->jitter_buffer) {
+        process_jitter_buffer(mixer);
+        goto done;
+    }
 
     frame_list = ov_rtp_frame_buffer_get_current_frames(mixer->frame_buffer);
 
@@ -1031,6 +1489,12 @@ static bool cb_mix(uint32_t id, void *data) {
 
     frame_list = ov_mc_mixer_core_frame_processing_list_free(frame_list);
 
+done:
+    done_usec = ov_time_get_current_time_usecs();
+
+    ov_metrics_observe(mixer->metric.mix_usec, done_usec - start_usec);
+    monitor_cycle(mixer, due_usec, done_usec);
+
     return true;
 }
 
@@ -1133,9 +1597,103 @@ set_config_defaults(ov_mc_mixer_core_config config) {
     out.comfort_noise_max_amplitude =
         get_max_amplitude(out.comfort_noise_max_amplitude);
 
+    out.limit = config.limit;
+
+    if (0 == out.limit.frame_buffer_max)
+        out.limit.frame_buffer_max = 10;
+
+    out.jitter_buffer = config.jitter_buffer;
+    out.mix_cache = config.mix_cache;
+    out.loop_bus = config.loop_bus;
+
+    out.overload = config.overload;
+    out.callback = config.callback;
+
+    if (0 == out.overload.deadline_usecs)
+        out.overload.deadline_usecs = OV_MC_MIXER_CORE_CYCLE_USECS;
+
+    if (0 == out.overload.window)
+        out.overload.window = OV_MC_MIXER_CORE_OVERLOAD_WINDOW_DEFAULT;
+
+    if (0 == out.overload.overruns)
+        out.overload.overruns = OV_MC_MIXER_CORE_OVERLOAD_OVERRUNS_DEFAULT;
+
     return out;
 }
 
+/*----------------------------------------------------------------------------*/
+
+static bool configure_jitter_buffer(ov_mc_mixer_core *self) {
+
+    self->jitter_buffer = ov_rtp_jitter_buffer_free(self->jitter_buffer);
+
+    if (!self->config.jitter_buffer.adaptive)
+        return true;
+
+    self->jitter_buffer =
+        ov_rtp_jitter_buffer_create((ov_rtp_jitter_buffer_config){
+            .clock_rate_hz = self->config.samplerate_hz,
+            .frame_length_usec = 1000 * OV_DEFAULT_FRAME_LENGTH_MS,
+            .delay.min_frames = self->config.jitter_buffer.min_frames,
+            .delay.max_frames = self->config.limit.frame_buffer_max,
+        });
+
+    return 0 != self->jitter_buffer;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void configure_mix_cache(ov_mc_mixer_core *self) {
+
+    self->mix_cache = ov_mc_mix_cache_free(self->mix_cache);
+
+    if (!self->config.mix_cache.enabled)
+        return;
+
+    ov_mc_mix_cache_config config = self->config.mix_cache.config;
+
+    if (0 == config.name[0])
+        strncpy(config.name, OV_MC_MIX_CACHE_NAME_DEFAULT,
+                sizeof(config.name) - 1);
+
+    self->mix_cache = ov_mc_mix_cache_create(config);
+
+    /* mixing works without the cache */
+
+    if (!self->mix_cache)
+        ov_log_warning("Mixer: mix cache %s not available", config.name);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool configure_metrics(ov_mc_mixer_core *self) {
+
+    self->metrics =
+        ov_metrics_create((ov_metrics_config){.prefix = "openvocs_mixer"});
+
+    if (!self->metrics)
+        return false;
+
+    self->metric.frames_dropped =
+        ov_metrics_counter(self->metrics, "frames_dropped", NULL);
+    self->metric.frames_out =
+        ov_metrics_counter(self->metrics, "frames_out", NULL);
+    self->metric.decode_usec =
+        ov_metrics_histogram(self->metrics, "decode_usec", NULL);
+    self->metric.encode_usec =
+        ov_metrics_histogram(self->metrics, "encode_usec", NULL);
+    self->metric.mix_usec =
+        ov_metrics_histogram(self->metrics, "mix_usec", NULL);
+    self->metric.cycle_usec =
+        ov_metrics_histogram(self->metrics, "cycle_usec", NULL);
+    self->metric.overruns =
+        ov_metrics_counter(self->metrics, "deadline_overruns", NULL);
+    self->metric.overloads =
+        ov_metrics_counter(self->metrics, "overloads", NULL);
+
+    return true;
+}
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -1162,9 +1720,6 @@ ov_mc_mixer_core *ov_mc_mixer_core_create(ov_mc_mixer_core_config config) {
     config = set_config_defaults(config);
     config.loop = loop;
 
-    if (0 == config.limit.frame_buffer_max)
-        config.limit.frame_buffer_max = 10;
-
     mixer = calloc(1, sizeof(ov_mc_mixer_core));
     if (!mixer)
         goto error;
@@ -1187,6 +1742,14 @@ ov_mc_mixer_core *ov_mc_mixer_core_create(ov_mc_mixer_core_config config) {
     if (!mixer->frame_buffer)
         goto error;
 
+    if (!configure_jitter_buffer(mixer))
+        goto error;
+
+    configure_mix_cache(mixer);
+
+    if (!configure_metrics(mixer))
+        goto error;
+
     mixer->mix_timer =
         ov_event_loop_timer_set(config.loop, 20000, mixer, cb_mix);
 
@@ -1224,6 +1787,7 @@ bool ov_mc_mixer_core_reconfigure(ov_mc_mixer_core *self,
     }
 
     ov_event_loop *loop = config.loop;
+    config.callback = self->config.callback;
     config = set_config_defaults(config);
     config.loop = loop;
     self->config = config;
@@ -1233,6 +1797,11 @@ bool ov_mc_mixer_core_reconfigure(ov_mc_mixer_core *self,
 
     self->mix_timer = ov_event_loop_timer_set(config.loop, 20000, self, cb_mix);
 
+    configure_mix_cache(self);
+
+    if (!configure_jitter_buffer(self))
+        goto error;
+
     return true;
 error:
     return false;
@@ -1261,8 +1830,12 @@ ov_mc_mixer_core *ov_mc_mixer_core_free(ov_mc_mixer_core *self) {
     if (self->frame_buffer)
         self->frame_buffer = self->frame_buffer->free(self->frame_buffer);
 
+    self->jitter_buffer = ov_rtp_jitter_buffer_free(self->jitter_buffer);
+    self->mix_cache = ov_mc_mix_cache_free(self->mix_cache);
+
     self->name = ov_data_pointer_free(self->name);
     self->loops = ov_dict_free(self->loops);
+    self->metrics = ov_metrics_free(self->metrics);
     self->codec.factory = ov_codec_factory_free(self->codec.factory);
     self->codec.codecs = ov_dict_free(self->codec.codecs);
     self->comfort_noise_32bit = ov_buffer_free(self->comfort_noise_32bit);
@@ -1349,6 +1922,8 @@ bool ov_mc_mixer_core_join(ov_mc_mixer_core *self, ov_mc_loop_data loop) {
 
         .loop = self->config.loop,
         .data = loop,
+        .loop_bus = self->config.loop_bus,
+        .metrics = self->metrics,
         .callback.userdata = self,
         .callback.io = cb_io_multicast};
 
@@ -1411,6 +1986,9 @@ bool ov_mc_mixer_core_release(ov_mc_mixer_core *self) {
         ov_rtp_frame_buffer_get_current_frames(self->frame_buffer);
     frames = ov_mc_mixer_core_frame_processing_list_free(frames);
 
+    if (!configure_jitter_buffer(self))
+        goto error;
+
     return true;
 error:
     return false;
@@ -1599,6 +2177,27 @@ ov_json_value *ov_mc_mixer_state(ov_mc_mixer_core *self) {
     if (!ov_json_object_set(temp, OV_KEY_SSRC, val))
         goto error;
 
+    if (self->mix_cache) {
+
+        val = ov_mc_mix_cache_stats_to_json(
+            ov_mc_mix_cache_get_stats(self->mix_cache));
+
+        if (!ov_json_object_set(out, OV_KEY_MIX_CACHE, val))
+            goto error;
+    }
+
+    val = ov_metrics_to_json(self->metrics);
+    if (!ov_json_object_set(out, OV_KEY_METRICS, val))
+        goto error;
+
+    if (self->overload.active) {
+        val = ov_json_true();
+    } else {
+        val = ov_json_false();
+    }
+    if (!ov_json_object_set(out, OV_KEY_OVERLOAD, val))
+        goto error;
+
     return out;
 error:
     ov_json_value_free(val);
@@ -1606,6 +2205,19 @@ error:
     return NULL;
 }
 
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_mc_mixer_core_jitter_buffer_stats(ov_mc_mixer_core *self) {
+
+    if (!self)
+        return NULL;
+
+    if (!self->jitter_buffer)
+        return ov_json_object();
+
+    return ov_rtp_jitter_buffer_stats_to_json(self->jitter_buffer);
+}
+
 /*****************************************************************************
                       Garbage collector for Codec database
  ****************************************************************************/
@@ -1684,3 +2296,13 @@ static bool codec_gc_run(ov_mc_mixer_core *self,
         return false;
     }
 }
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_mixer_core_is_overloaded(const ov_mc_mixer_core *self) {
+
+    if (!ov_mc_mixer_core_cast(self))
+        return false;
+
+    return self->overload.active;
+}
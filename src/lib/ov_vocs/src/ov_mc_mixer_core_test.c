@@ -30,6 +30,8 @@
 #include "ov_mc_mixer_core.c"
 #include <ov_test/testrun.h>
 
+#include <sys/mman.h>
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -155,6 +157,25 @@ int test_ov_mc_mixer_core_reconfigure() {
 
     testrun(0 != core->mix_timer);
     testrun(NULL != core->comfort_noise_32bit);
+    testrun(NULL == core->jitter_buffer);
+
+    testrun(ov_mc_mixer_core_reconfigure(
+        core, (ov_mc_mixer_core_config){.loop = loop,
+                                        .jitter_buffer.adaptive = true,
+                                        .jitter_buffer.min_frames = 2,
+                                        .limit.frame_buffer_max = 8}));
+
+    testrun(NULL != core->jitter_buffer);
+
+    testrun(ov_mc_mixer_core_reconfigure(
+        core, (ov_mc_mixer_core_config){.loop = loop}));
+
+    testrun(NULL == core->jitter_buffer);
+
+    testrun(ov_mc_mixer_core_reconfigure(
+        core, (ov_mc_mixer_core_config){.loop = loop, .loop_bus = true}));
+
+    testrun(core->config.loop_bus);
 
     testrun(NULL == ov_mc_mixer_core_free(core));
     testrun(NULL == ov_event_loop_free(loop));
@@ -164,6 +185,304 @@ int test_ov_mc_mixer_core_reconfigure() {
 
 /*----------------------------------------------------------------------------*/
 
+static ov_frame_data_list *mix_input(uint32_t ssrc, uint16_t seq) {
+
+    ov_frame_data_list *list = ov_frame_data_list_create(1);
+
+    ov_frame_data *data = ov_frame_data_create();
+    data->ssid = ssrc;
+    data->sequence_number = seq;
+    data->timestamp = 960 * seq;
+    data->payload_type = 100;
+    data->num_samples = 960;
+    data->pcm16s_32bit = ov_buffer_create(960 * sizeof(int32_t));
+    data->pcm16s_32bit->length = 960 * sizeof(int32_t);
+
+    for (size_t i = 0; i < 960; ++i) {
+        ((int32_t *)data->pcm16s_32bit->start)[i] = (i % 48) * 100;
+    }
+
+    ov_frame_data_list_push_data(list, data);
+    return list;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mixer_core_mix_cache() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    testrun(loop);
+
+    ov_mc_mixer_core_config config = (ov_mc_mixer_core_config){
+        .loop = loop,
+        .mix_cache.enabled = true,
+    };
+
+    snprintf(config.mix_cache.config.name,
+             sizeof(config.mix_cache.config.name), "/ov_mixer_core_test_%i",
+             getpid());
+
+    ov_mc_mixer_core *a = ov_mc_mixer_core_create(config);
+    ov_mc_mixer_core *b = ov_mc_mixer_core_create(config);
+    testrun(a);
+    testrun(b);
+    testrun(a->mix_cache);
+    testrun(b->mix_cache);
+
+    /* same input, one encode */
+
+    ov_frame_data_list *list = mix_input(1, 1);
+
+    testrun(mix_signature(a, list) == mix_signature(b, list));
+
+    testrun(forward_frame_data(a, list));
+    testrun(1 == ov_mc_mix_cache_get_stats(a->mix_cache).misses);
+    testrun(1 == ov_mc_mix_cache_get_stats(a->mix_cache).stored);
+    testrun(1 == a->output.sequence_number);
+
+    testrun(forward_frame_data(b, list));
+    testrun(1 == ov_mc_mix_cache_get_stats(b->mix_cache).hits);
+    testrun(0 == ov_mc_mix_cache_get_stats(b->mix_cache).stored);
+    testrun(1 == b->output.sequence_number);
+    testrun(960 == b->output.timestamp);
+
+    list = ov_frame_data_list_free(list);
+
+    /* other input */
+
+    list = mix_input(1, 2);
+    testrun(forward_frame_data(b, list));
+    testrun(1 == ov_mc_mix_cache_get_stats(b->mix_cache).misses);
+    testrun(1 == ov_mc_mix_cache_get_stats(b->mix_cache).stored);
+    list = ov_frame_data_list_free(list);
+
+    ov_json_value *state = ov_mc_mixer_state(b);
+    testrun(1 == ov_json_number_get(
+                     ov_json_get(state, "/" OV_KEY_MIX_CACHE "/saved")));
+    testrun(1 == ov_json_number_get(
+                     ov_json_get(state, "/" OV_KEY_MIX_CACHE "/encoded")));
+    state = ov_json_value_free(state);
+
+    shm_unlink(config.mix_cache.config.name);
+
+    testrun(NULL == ov_mc_mixer_core_free(a));
+    testrun(NULL == ov_mc_mixer_core_free(b));
+    testrun(NULL == ov_event_loop_free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mixer_core_jitter_buffer_stats() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    testrun(loop);
+
+    ov_mc_mixer_core *core = ov_mc_mixer_core_create(
+        (ov_mc_mixer_core_config){.loop = loop});
+    testrun(core);
+
+    testrun(NULL == ov_mc_mixer_core_jitter_buffer_stats(NULL));
+
+    ov_json_value *stats = ov_mc_mixer_core_jitter_buffer_stats(core);
+    testrun(ov_json_is_object(stats));
+    testrun(0 == ov_json_object_count(stats));
+    stats = ov_json_value_free(stats);
+
+    testrun(NULL == ov_mc_mixer_core_free(core));
+
+    core = ov_mc_mixer_core_create((ov_mc_mixer_core_config){
+        .loop = loop, .jitter_buffer.adaptive = true});
+    testrun(core);
+    testrun(core->jitter_buffer);
+
+    /* frames are buffered per SSRC */
+
+    for (uint16_t seq = 1; seq < 4; ++seq) {
+
+        ov_rtp_frame *frame = ov_rtp_frame_encode(&(ov_rtp_frame_expansion){
+            .version = 2,
+            .ssrc = 4321,
+            .sequence_number = seq,
+            .timestamp = 960 * seq,
+        });
+
+        uint64_t now = ov_time_get_current_time_usecs();
+
+        testrun(NULL ==
+                ov_rtp_jitter_buffer_add(core->jitter_buffer, frame, now));
+    }
+
+    testrun(process_jitter_buffer(core));
+
+    stats = ov_mc_mixer_core_jitter_buffer_stats(core);
+    testrun(1 == ov_json_object_count(stats));
+    testrun(3 == ov_json_number_get(ov_json_get(stats, "/4321/received")));
+    testrun(1 == ov_json_number_get(ov_json_get(stats, "/4321/played")));
+    testrun(0 == ov_json_number_get(ov_json_get(stats, "/4321/lost")));
+    stats = ov_json_value_free(stats);
+
+    testrun(NULL == ov_mc_mixer_core_free(core));
+    testrun(NULL == ov_event_loop_free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct overload_userdata {
+
+    size_t calls;
+    bool overloaded;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static void overload_callback(void *userdata, bool overloaded) {
+
+    struct overload_userdata *data = userdata;
+    data->calls++;
+    data->overloaded = overloaded;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mixer_core_overload() {
+
+    struct overload_userdata userdata = {0};
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    testrun(loop);
+
+    ov_mc_mixer_core *core = ov_mc_mixer_core_create((ov_mc_mixer_core_config){
+        .loop = loop,
+        .overload.window = 4,
+        .overload.overruns = 2,
+        .overload.max_talkers = 2,
+        .callback.userdata = &userdata,
+        .callback.overload = overload_callback});
+    testrun(core);
+
+    testrun(OV_MC_MIXER_CORE_CYCLE_USECS ==
+            core->config.overload.deadline_usecs);
+    testrun(!ov_mc_mixer_core_is_overloaded(NULL));
+    testrun(!ov_mc_mixer_core_is_overloaded(core));
+
+    uint64_t late = 1000 + OV_MC_MIXER_CORE_CYCLE_USECS + 1;
+
+    /* single overrun within a window is tolerated */
+
+    monitor_cycle(core, 1000, late);
+    monitor_cycle(core, 1000, 2000);
+    monitor_cycle(core, 1000, 2000);
+    monitor_cycle(core, 1000, 2000);
+    testrun(!ov_mc_mixer_core_is_overloaded(core));
+    testrun(0 == userdata.calls);
+
+    /* done before due counts as in time */
+
+    monitor_cycle(core, 2000, 1000);
+    testrun(0 == core->overload.overruns);
+
+    monitor_cycle(core, 1000, late);
+    monitor_cycle(core, 1000, late);
+    monitor_cycle(core, 1000, 2000);
+    testrun(ov_mc_mixer_core_is_overloaded(core));
+    testrun(1 == userdata.calls);
+    testrun(userdata.overloaded);
+
+    /* stays overloaded while overruns remain */
+
+    for (size_t i = 0; i < 3; ++i) {
+        monitor_cycle(core, 1000, 2000);
+    }
+    monitor_cycle(core, 1000, late);
+    testrun(ov_mc_mixer_core_is_overloaded(core));
+    testrun(1 == userdata.calls);
+
+    /* a clean window recovers */
+
+    for (size_t i = 0; i < 4; ++i) {
+        monitor_cycle(core, 1000, 2000);
+    }
+    testrun(!ov_mc_mixer_core_is_overloaded(core));
+    testrun(2 == userdata.calls);
+    testrun(!userdata.overloaded);
+
+    /* callback survives reconfigure */
+
+    testrun(ov_mc_mixer_core_reconfigure(
+        core, (ov_mc_mixer_core_config){.loop = loop}));
+    testrun(core->config.callback.overload == overload_callback);
+
+    testrun(NULL == ov_mc_mixer_core_free(core));
+    testrun(NULL == ov_event_loop_free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_keep_loudest_frames() {
+
+    ov_frame_data_list *list = ov_frame_data_list_create(5);
+    testrun(list);
+
+    int16_t amplitude[] = {10, 500, 0, 300, 20};
+
+    for (size_t i = 0; i < 5; ++i) {
+
+        if (0 == amplitude[i])
+            continue;
+
+        list->frames[i] = ov_frame_data_create();
+        testrun(list->frames[i]);
+        list->frames[i]->max_amplitude = amplitude[i];
+    }
+
+    keep_loudest_frames(list, 4);
+    testrun(0 != list->frames[0]);
+
+    keep_loudest_frames(list, 2);
+    testrun(0 == list->frames[0]);
+    testrun(500 == list->frames[1]->max_amplitude);
+    testrun(0 == list->frames[2]);
+    testrun(300 == list->frames[3]->max_amplitude);
+    testrun(0 == list->frames[4]);
+
+    list = ov_frame_data_list_free(list);
+
+    /* without VAD all amplitudes are 0, the first frames are kept */
+
+    list = ov_frame_data_list_create(5);
+    testrun(list);
+
+    for (size_t i = 0; i < 5; ++i) {
+        list->frames[i] = ov_frame_data_create();
+        testrun(list->frames[i]);
+    }
+
+    keep_loudest_frames(list, 2);
+    testrun(0 != list->frames[0]);
+    testrun(0 != list->frames[1]);
+    testrun(0 == list->frames[2]);
+    testrun(0 == list->frames[3]);
+    testrun(0 == list->frames[4]);
+
+    list = ov_frame_data_list_free(list);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_mc_mixer_core_set_name() {
 
     ov_event_loop *loop = ov_event_loop_default(
@@ -714,6 +1033,10 @@ int all_tests() {
     testrun_test(test_ov_mc_mixer_core_get_volume);
 
     testrun_test(test_ov_mc_mixer_state);
+    testrun_test(test_ov_mc_mixer_core_jitter_buffer_stats);
+    testrun_test(test_ov_mc_mixer_core_mix_cache);
+    testrun_test(test_ov_mc_mixer_core_overload);
+    testrun_test(test_keep_loudest_frames);
 
     return testrun_counter;
 }
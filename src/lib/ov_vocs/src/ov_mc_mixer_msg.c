@@ -107,6 +107,84 @@ ov_json_value *ov_mc_mixer_msg_configure(ov_mc_mixer_core_config config) {
     if (!ov_json_object_set(par, OV_KEY_FRAME_BUFFER, val))
         goto error;
 
+    val = ov_json_object();
+    if (!ov_json_object_set(par, OV_KEY_JITTER_BUFFER, val))
+        goto error;
+
+    ov_json_value *jitter = val;
+
+    if (config.jitter_buffer.adaptive) {
+        val = ov_json_true();
+    } else {
+        val = ov_json_false();
+    }
+    if (!ov_json_object_set(jitter, OV_KEY_ENABLED, val))
+        goto error;
+
+    val = ov_json_number(config.jitter_buffer.min_frames);
+    if (!ov_json_object_set(jitter, OV_KEY_MIN, val))
+        goto error;
+
+    val = ov_json_object();
+    if (!ov_json_object_set(par, OV_KEY_MIX_CACHE, val))
+        goto error;
+
+    ov_json_value *cache = val;
+
+    if (config.mix_cache.enabled) {
+        val = ov_json_true();
+    } else {
+        val = ov_json_false();
+    }
+    if (!ov_json_object_set(cache, OV_KEY_ENABLED, val))
+        goto error;
+
+    val = ov_json_string(config.mix_cache.config.name);
+    if (!ov_json_object_set(cache, OV_KEY_NAME, val))
+        goto error;
+
+    if (config.loop_bus) {
+        val = ov_json_true();
+    } else {
+        val = ov_json_false();
+    }
+    if (!ov_json_object_set(par, OV_KEY_LOOP_BUS, val))
+        goto error;
+
+    val = ov_json_object();
+    if (!ov_json_object_set(par, OV_KEY_OVERLOAD, val))
+        goto error;
+
+    ov_json_value *overload = val;
+
+    val = ov_json_number(config.overload.deadline_usecs);
+    if (!ov_json_object_set(overload, OV_KEY_DEADLINE_USECS, val))
+        goto error;
+
+    val = ov_json_number(config.overload.window);
+    if (!ov_json_object_set(overload, OV_KEY_WINDOW, val))
+        goto error;
+
+    val = ov_json_number(config.overload.overruns);
+    if (!ov_json_object_set(overload, OV_KEY_OVERRUNS, val))
+        goto error;
+
+    val = ov_json_number(config.overload.max_talkers);
+    if (!ov_json_object_set(overload, OV_KEY_MAX_TALKERS, val))
+        goto error;
+
+    if (config.overload.skip_normalization) {
+        val = ov_json_true();
+    } else {
+        val = ov_json_false();
+    }
+    if (!ov_json_object_set(overload, OV_KEY_SKIP_NORMALIZATION, val))
+        goto error;
+
+    val = ov_json_number(config.overload.encoder_complexity);
+    if (!ov_json_object_set(overload, OV_KEY_ENCODER_COMPLEXITY, val))
+        goto error;
+
     if (config.normalize_input) {
         val = ov_json_true();
     } else {
@@ -140,6 +218,34 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+ov_mc_mixer_core_overload_config
+ov_mc_mixer_msg_overload_config_from_json(const ov_json_value *json) {
+
+    ov_mc_mixer_core_overload_config config =
+        (ov_mc_mixer_core_overload_config){0};
+
+    config.deadline_usecs =
+        ov_json_number_get(ov_json_get(json, "/" OV_KEY_DEADLINE_USECS));
+
+    config.window = ov_json_number_get(ov_json_get(json, "/" OV_KEY_WINDOW));
+
+    config.overruns =
+        ov_json_number_get(ov_json_get(json, "/" OV_KEY_OVERRUNS));
+
+    config.max_talkers =
+        ov_json_number_get(ov_json_get(json, "/" OV_KEY_MAX_TALKERS));
+
+    config.skip_normalization =
+        ov_json_is_true(ov_json_get(json, "/" OV_KEY_SKIP_NORMALIZATION));
+
+    config.encoder_complexity =
+        ov_json_number_get(ov_json_get(json, "/" OV_KEY_ENCODER_COMPLEXITY));
+
+    return config;
+}
+
+/*----------------------------------------------------------------------------*/
+
 ov_mc_mixer_core_config
 ov_mc_mixer_msg_configure_from_json(const ov_json_value *json) {
 
@@ -176,6 +282,27 @@ ov_mc_mixer_msg_configure_from_json(const ov_json_value *json) {
     config.limit.frame_buffer_max =
         ov_json_number_get(ov_json_get(par, "/" OV_KEY_FRAME_BUFFER));
 
+    config.jitter_buffer.adaptive = ov_json_is_true(
+        ov_json_get(par, "/" OV_KEY_JITTER_BUFFER "/" OV_KEY_ENABLED));
+
+    config.jitter_buffer.min_frames = ov_json_number_get(
+        ov_json_get(par, "/" OV_KEY_JITTER_BUFFER "/" OV_KEY_MIN));
+
+    config.mix_cache.enabled = ov_json_is_true(
+        ov_json_get(par, "/" OV_KEY_MIX_CACHE "/" OV_KEY_ENABLED));
+
+    const char *name = ov_json_string_get(
+        ov_json_get(par, "/" OV_KEY_MIX_CACHE "/" OV_KEY_NAME));
+
+    if (name)
+        strncpy(config.mix_cache.config.name, name,
+                OV_MC_MIX_CACHE_NAME_MAX - 1);
+
+    config.loop_bus = ov_json_is_true(ov_json_get(par, "/" OV_KEY_LOOP_BUS));
+
+    config.overload = ov_mc_mixer_msg_overload_config_from_json(
+        ov_json_get(par, "/" OV_KEY_OVERLOAD));
+
     if (ov_json_is_true(ov_json_get(par, "/" OV_KEY_NORMALIZE_INPUT))) {
         config.normalize_input = true;
     } else {
@@ -532,3 +659,39 @@ ov_json_value *ov_mc_mixer_msg_state() {
 
     return ov_event_api_message_create(OV_KEY_STATE, NULL, 0);
 }
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_mc_mixer_msg_overload(bool overloaded) {
+
+    ov_json_value *out = NULL;
+    ov_json_value *val = NULL;
+    ov_json_value *par = NULL;
+
+    out = ov_event_api_message_create(OV_KEY_OVERLOAD, NULL, 0);
+    par = ov_event_api_set_parameter(out);
+    if (!par)
+        goto error;
+
+    if (overloaded) {
+        val = ov_json_true();
+    } else {
+        val = ov_json_false();
+    }
+    if (!ov_json_object_set(par, OV_KEY_OVERLOAD, val))
+        goto error;
+
+    return out;
+error:
+    ov_json_value_free(out);
+    ov_json_value_free(val);
+    return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+bool ov_mc_mixer_msg_overload_get(const ov_json_value *msg) {
+
+    return ov_json_is_true(
+        ov_json_get(msg, "/" OV_KEY_PARAMETER "/" OV_KEY_OVERLOAD));
+}
@@ -250,6 +250,64 @@ int test_ov_mc_mixer_msg_state() {
     return testrun_log_success();
 }
 
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mixer_msg_overload() {
+
+    ov_json_value *val = ov_mc_mixer_msg_overload(true);
+    testrun(val);
+    testrun(ov_event_api_event_is(val, OV_KEY_OVERLOAD));
+    testrun(ov_mc_mixer_msg_overload_get(val));
+    val = ov_json_value_free(val);
+
+    val = ov_mc_mixer_msg_overload(false);
+    testrun(val);
+    testrun(!ov_mc_mixer_msg_overload_get(val));
+    val = ov_json_value_free(val);
+
+    testrun(!ov_mc_mixer_msg_overload_get(NULL));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_mc_mixer_msg_overload_config_from_json() {
+
+    ov_mc_mixer_core_config config = {
+        .overload.deadline_usecs = 15000,
+        .overload.window = 10,
+        .overload.overruns = 2,
+        .overload.max_talkers = 4,
+        .overload.skip_normalization = true,
+        .overload.encoder_complexity = 3};
+
+    ov_json_value *msg = ov_mc_mixer_msg_configure(config);
+    testrun(msg);
+
+    ov_mc_mixer_core_overload_config overload =
+        ov_mc_mixer_msg_overload_config_from_json(ov_json_get(
+            msg, "/" OV_KEY_PARAMETER "/" OV_KEY_OVERLOAD));
+
+    testrun(15000 == overload.deadline_usecs);
+    testrun(10 == overload.window);
+    testrun(2 == overload.overruns);
+    testrun(4 == overload.max_talkers);
+    testrun(overload.skip_normalization);
+    testrun(3 == overload.encoder_complexity);
+
+    config = ov_mc_mixer_msg_configure_from_json(msg);
+    testrun(4 == config.overload.max_talkers);
+
+    msg = ov_json_value_free(msg);
+
+    overload = ov_mc_mixer_msg_overload_config_from_json(NULL);
+    testrun(0 == overload.window);
+    testrun(!overload.skip_normalization);
+
+    return testrun_log_success();
+}
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -275,6 +333,8 @@ int all_tests() {
     testrun_test(test_ov_mc_mixer_msg_shutdown);
     testrun_test(test_ov_mc_mixer_msg_release);
     testrun_test(test_ov_mc_mixer_msg_state);
+    testrun_test(test_ov_mc_mixer_msg_overload);
+    testrun_test(test_ov_mc_mixer_msg_overload_config_from_json);
 
     return testrun_counter;
 }
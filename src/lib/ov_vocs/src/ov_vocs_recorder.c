@@ -45,6 +45,7 @@
 #include <ov_core/ov_recording.h>
 
 #include <ov_database/ov_database_events.h>
+#include <ov_database/ov_database_journal.h>
 
 /*----------------------------------------------------------------------------*/
 
@@ -82,6 +83,9 @@ struct ov_vocs_recorder {
 
     ov_database *db;
 
+    /* participation events are written off the loop */
+    ov_db_journal *journal;
+
     ov_callback_registry *callbacks;
 };
 
@@ -838,6 +842,9 @@ ov_vocs_recorder *ov_vocs_recorder_create(ov_vocs_recorder_config config) {
         ov_log_error("Could not initialize event database");
     }
 
+    self->journal =
+        ov_db_journal_create((ov_db_journal_config){.db = self->db});
+
     // add startup delay for recordings to let recorders connect before
     self->timer.startup_delay =
         ov_event_loop_timer_set(self->config.loop, OV_RECORDER_STARTUP_DELAY,
@@ -870,6 +877,7 @@ ov_vocs_recorder *ov_vocs_recorder_free(ov_vocs_recorder *self) {
     self->recorder = ov_dict_free(self->recorder);
     self->recordings = ov_dict_free(self->recordings);
     self->callbacks = ov_callback_registry_free(self->callbacks);
+    self->journal = ov_db_journal_free(self->journal);
 
     self = ov_data_pointer_free(self);
 
@@ -983,9 +991,8 @@ void ov_vocs_recorder_join_loop(ov_vocs_recorder *self, const char *user,
     time_t now;
     time(&now);
 
-    ov_db_events_add_participation_state(get_database_mut(self), user, role,
-                                         loop, OV_PARTICIPATION_STATE_RECV,
-                                         now);
+    ov_db_journal_add_participation_state(self->journal, user, role, loop,
+                                          OV_PARTICIPATION_STATE_RECV, now);
 
 error:
     return;
@@ -1002,8 +1009,8 @@ void ov_vocs_recorder_leave_loop(ov_vocs_recorder *self, const char *user,
     time_t now;
     time(&now);
 
-    ov_db_events_add_participation_state(self->db, user, role, loop,
-                                         OV_PARTICIPATION_STATE_RECV_OFF, now);
+    ov_db_journal_add_participation_state(self->journal, user, role, loop,
+                                          OV_PARTICIPATION_STATE_RECV_OFF, now);
 
 error:
     return;
@@ -1020,8 +1027,8 @@ void ov_vocs_recorder_talk_on_loop(ov_vocs_recorder *self, const char *user,
     time_t now;
     time(&now);
 
-    ov_db_events_add_participation_state(self->db, user, role, loop,
-                                         OV_PARTICIPATION_STATE_SEND, now);
+    ov_db_journal_add_participation_state(self->journal, user, role, loop,
+                                          OV_PARTICIPATION_STATE_SEND, now);
 
 error:
     return;
@@ -1038,8 +1045,8 @@ void ov_vocs_recorder_talk_off_loop(ov_vocs_recorder *self, const char *user,
     time_t now;
     time(&now);
 
-    ov_db_events_add_participation_state(self->db, user, role, loop,
-                                         OV_PARTICIPATION_STATE_SEND_OFF, now);
+    ov_db_journal_add_participation_state(self->journal, user, role, loop,
+                                          OV_PARTICIPATION_STATE_SEND_OFF, now);
 
 error:
     return;
@@ -1060,8 +1067,8 @@ void ov_vocs_recorder_ptt(ov_vocs_recorder *self, const char *user,
     if (!off)
         state = OV_PARTICIPATION_STATE_PTT;
 
-    ov_db_events_add_participation_state(self->db, user, role, loop, state,
-                                         now);
+    ov_db_journal_add_participation_state(self->journal, user, role, loop,
+                                          state, now);
 
 error:
     return;
@@ -368,6 +368,30 @@ bool ov_vocs_db_inject(ov_vocs_db *self, ov_vocs_db_type type,
  */
 ov_json_value *ov_vocs_db_eject(ov_vocs_db *self, ov_vocs_db_type type);
 
+/*----------------------------------------------------------------------------*/
+
+/**
+ *      Get the number of modifications of the auth data set.
+ *
+ *      Used to skip persisting auth data, which did not change.
+ *
+ *      @param self     instance pointer
+ */
+uint64_t ov_vocs_db_auth_changes(ov_vocs_db *self);
+
+/*----------------------------------------------------------------------------*/
+
+/**
+ *      Eject copies of the state of all users changed since the last call.
+ *
+ *      Users without state are set to null. Injecting a state data set
+ *      resets the changes.
+ *
+ *      @param self     instance pointer
+ *      @returns object of users changed, empty if nothing changed
+ */
+ov_json_value *ov_vocs_db_eject_state_changes(ov_vocs_db *self);
+
 /*
  *      ------------------------------------------------------------------------
  *
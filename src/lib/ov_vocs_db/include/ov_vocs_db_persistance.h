@@ -68,6 +68,13 @@ typedef struct ov_vocs_db_persistance_config {
 
     } timeout;
 
+    struct {
+
+        /* state changes logged before compacting them into the snapshot */
+        uint64_t state_log_entries;
+
+    } limits;
+
 } ov_vocs_db_persistance_config;
 
 /*
@@ -72,6 +72,15 @@ struct ov_vocs_db {
         ov_json_value *state;
 
     } data;
+
+    /* changes to be picked up by the persistance */
+
+    struct {
+
+        uint64_t auth;
+        ov_json_value *state;
+
+    } changes;
 };
 
 /*
@@ -118,6 +127,7 @@ static bool vocs_db_clear(ov_vocs_db *self) {
 
     self->data.domains = ov_json_value_free(self->data.domains);
     self->data.state = ov_json_value_free(self->data.state);
+    self->changes.state = ov_json_value_free(self->changes.state);
 
     return true;
 error:
@@ -1104,6 +1114,8 @@ bool ov_vocs_db_delete_entity(ov_vocs_db *self, ov_vocs_db_entity entity,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     result = db_delete(self, id, entity);
 
     switch (entity) {
@@ -1288,6 +1300,8 @@ bool ov_vocs_db_create_entity(ov_vocs_db *self, ov_vocs_db_entity entity,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     /* check if id is already in use for the entity type */
 
     ov_dict *dict = get_index_dict(self, entity);
@@ -2102,6 +2116,8 @@ bool ov_vocs_db_update_entity_key(ov_vocs_db *self, ov_vocs_db_entity entity,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_dict *dict = get_index_dict(self, entity);
 
     ov_json_value *data = ov_dict_get(dict, id);
@@ -2263,6 +2279,8 @@ bool ov_vocs_db_delete_entity_key(ov_vocs_db *self, ov_vocs_db_entity entity,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_dict *dict = get_index_dict(self, entity);
 
     ov_json_value *data = ov_dict_get(dict, id);
@@ -2775,6 +2793,8 @@ bool ov_vocs_db_update_entity_item(ov_vocs_db *self, ov_vocs_db_entity entity,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_dict *dict = get_index_dict(self, entity);
 
     ov_json_value *data = ov_dict_get(dict, id);
@@ -2867,6 +2887,7 @@ static bool inject_auth(ov_vocs_db *self, ov_json_value *data) {
     ov_log_info("DB inject new auth dataset");
     self->data.domains = ov_json_value_free(self->data.domains);
     self->data.domains = data;
+    self->changes.auth++;
 
     index_clear(self);
 
@@ -2897,6 +2918,9 @@ static bool inject_state(ov_vocs_db *self, ov_json_value *data) {
     self->data.state = ov_json_value_free(self->data.state);
     self->data.state = data;
 
+    /* injected state is the persisted one */
+    self->changes.state = ov_json_value_free(self->changes.state);
+
     if (!ov_thread_lock_unlock(&self->lock)) {
         OV_ASSERT(1 == 0);
         goto error;
@@ -2963,6 +2987,107 @@ error:
     return false;
 }
 
+/*----------------------------------------------------------------------------*/
+
+uint64_t ov_vocs_db_auth_changes(ov_vocs_db *self) {
+
+    uint64_t changes = 0;
+
+    if (!self)
+        goto error;
+
+    if (!ov_thread_lock_try_lock(&self->lock))
+        goto error;
+
+    changes = self->changes.auth;
+
+    if (!ov_thread_lock_unlock(&self->lock)) {
+        OV_ASSERT(1 == 0);
+        goto error;
+    }
+
+error:
+    return changes;
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct container_changes {
+
+    ov_vocs_db *db;
+    ov_json_value *out;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static bool copy_changed_user(const void *key, void *val, void *data) {
+
+    if (!key)
+        return true;
+
+    UNUSED(val);
+
+    struct container_changes *c = (struct container_changes *)data;
+
+    ov_json_value *copy = NULL;
+    ov_json_value *user = ov_json_object_get(c->db->data.state, key);
+
+    if (!user) {
+        copy = ov_json_null();
+    } else if (!ov_json_value_copy((void **)&copy, user)) {
+        goto error;
+    }
+
+    if (!ov_json_object_set(c->out, key, copy))
+        goto error;
+
+    return true;
+error:
+    copy = ov_json_value_free(copy);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_json_value *ov_vocs_db_eject_state_changes(ov_vocs_db *self) {
+
+    ov_json_value *out = NULL;
+
+    if (!self)
+        goto error;
+
+    if (!ov_thread_lock_try_lock(&self->lock))
+        goto error;
+
+    struct container_changes container = {.db = self, .out = ov_json_object()};
+
+    if (!self->changes.state) {
+
+        out = container.out;
+
+    } else if (ov_json_object_for_each(self->changes.state, &container,
+                                       copy_changed_user)) {
+
+        out = container.out;
+        self->changes.state = ov_json_value_free(self->changes.state);
+
+    } else {
+
+        container.out = ov_json_value_free(container.out);
+    }
+
+    if (!ov_thread_lock_unlock(&self->lock)) {
+        OV_ASSERT(1 == 0);
+        goto error;
+    }
+
+    return out;
+
+error:
+    out = ov_json_value_free(out);
+    return NULL;
+}
+
 /*
  *      ------------------------------------------------------------------------
  *
@@ -2982,6 +3107,8 @@ bool ov_vocs_db_set_password(ov_vocs_db *self, const char *user,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *data = ov_dict_get(self->index.users, user);
     if (!data)
         goto done;
@@ -3229,6 +3356,8 @@ bool ov_vocs_db_add_project_admin(ov_vocs_db *self, const char *project,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *project_obj = ov_dict_get(self->index.projects, project);
     if (!project_obj)
         goto done;
@@ -3277,6 +3406,8 @@ bool ov_vocs_db_add_domain_admin(ov_vocs_db *self, const char *domain,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *domain_obj = ov_dict_get(self->index.domains, domain);
     if (!domain_obj)
         goto done;
@@ -3910,6 +4041,22 @@ error:
  *      ------------------------------------------------------------------------
  */
 
+static void state_changed(ov_vocs_db *self, const char *user) {
+
+    OV_ASSERT(self);
+    OV_ASSERT(user);
+
+    if (!self->changes.state)
+        self->changes.state = ov_json_object();
+
+    ov_json_value *val = ov_json_null();
+
+    if (!ov_json_object_set(self->changes.state, user, val))
+        val = ov_json_value_free(val);
+}
+
+/*----------------------------------------------------------------------------*/
+
 static ov_json_value *get_set_loop(ov_vocs_db *self, const char *user,
                                    const char *role, const char *loop) {
 
@@ -3976,6 +4123,8 @@ bool ov_vocs_db_set_state(ov_vocs_db *self, const char *user, const char *role,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    state_changed(self, user);
+
     ov_json_value *obj = get_set_loop(self, user, role, loop);
     if (!obj)
         goto done;
@@ -4071,6 +4220,8 @@ bool ov_vocs_db_set_volume(ov_vocs_db *self, const char *user, const char *role,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    state_changed(self, user);
+
     ov_json_value *obj = get_set_loop(self, user, role, loop);
     if (!obj)
         goto done;
@@ -4177,6 +4328,8 @@ bool ov_vocs_db_set_layout(ov_vocs_db *self, const char *role,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *role_data = ov_dict_get(self->index.roles, role);
     if (!role_data) {
         val = ov_json_value_free(val);
@@ -4345,6 +4498,8 @@ bool ov_vocs_db_set_keyset_layout(ov_vocs_db *self, const char *domain,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *root = ov_dict_get(self->index.domains, domain);
     if (!root)
         goto done;
@@ -4540,6 +4695,8 @@ bool ov_vocs_db_set_user_data(ov_vocs_db *self, const char *user,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    state_changed(self, user);
+
     ov_json_value *root = get_set_user(self, user);
     if (!root)
         goto done;
@@ -4655,6 +4812,8 @@ bool ov_vocs_db_set_recorded(ov_vocs_db *self, const char *loop, bool on) {
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *data = ov_dict_get(self->index.loops, loop);
     if (!data)
         goto done;
@@ -4977,6 +5136,8 @@ bool ov_vocs_db_remove_permission(ov_vocs_db *self,
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *loop = ov_dict_get(self->index.loops, permission.loop);
     if (!loop)
         goto done;
@@ -5029,6 +5190,8 @@ bool ov_vocs_db_add_permission(ov_vocs_db *self, ov_sip_permission permission) {
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    self->changes.auth++;
+
     ov_json_value *loop = ov_dict_get(self->index.loops, permission.loop);
     if (!loop)
         goto done;
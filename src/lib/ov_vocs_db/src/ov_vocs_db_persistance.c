@@ -37,10 +37,13 @@
 #include <lber.h>
 #include <ldap.h>
 
+#include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <sys/dir.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
 #include <ov_base/ov_config_keys.h>
 #include <ov_base/ov_dir.h>
@@ -60,10 +63,19 @@
 #define IMPL_DEFAULT_LOCK_USEC 100 * 1000          // 100ms
 #define IMPL_DEFAULT_LDAP_TIMEOUT_USEC 5000 * 1000 // 5sec
 #define IMPL_DEFAULT_PATH "/opt/vocsdb"
+#define IMPL_DEFAULT_STATE_LOG_ENTRIES 100
+
+#define IMPL_STATE_FILE "state.json"
+#define IMPL_STATE_LOG_FILE "state.log"
 
 #define IMPL_GIT_AUTHOR_NAME "system"
 #define IMPL_GIT_AUTHOR_EMAIL "persistance@email"
 
+#define IMPL_MESSAGE_LDAP_IMPORT OV_THREAD_MESSAGE_START_USER_TYPES
+#define IMPL_MESSAGE_PERSIST (OV_THREAD_MESSAGE_START_USER_TYPES + 1)
+
+/*----------------------------------------------------------------------------*/
+
 struct ov_vocs_db_persistance {
 
     uint16_t magic_byte;
@@ -83,90 +95,172 @@ struct ov_vocs_db_persistance {
     int socket;
 
     ov_broadcast_registry *broadcasts;
+
+    /* Changes ejected within the loop, waiting for some thread to write
+     * them. Only the loop adds changes, so ejecting never waits for IO. */
+
+    struct {
+
+        pthread_mutex_t lock;
+
+        ov_json_value *state;
+        ov_json_value *auth;
+        uint64_t auth_changes;
+
+    } pending;
+
+    /* Data as persisted below config.path, all writes are done while
+     * holding store.lock */
+
+    struct {
+
+        pthread_mutex_t lock;
+
+        ov_json_value *state;
+        ov_json_value *domains;
+        uint64_t log_entries;
+
+    } store;
 };
 
-/*----------------------------------------------------------------------------*/
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      FILE FUNCTIONS
+ *
+ *      ------------------------------------------------------------------------
+ */
 
-static bool auth_prepare_dir(const char *path) {
+static bool write_all(int fd, const char *data, size_t length) {
 
-    struct stat statbuf = {0};
-    errno = 0;
+    while (length > 0) {
 
-    char sub[PATH_MAX] = {0};
+        ssize_t written = write(fd, data, length);
+
+        if ((-1 == written) && (EINTR == errno))
+            continue;
+
+        if (written <= 0)
+            return false;
+
+        data += written;
+        length -= written;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool write_file_atomic(const char *path, const char *string,
+                              mode_t mode) {
 
     OV_ASSERT(path);
+    OV_ASSERT(string);
 
-    if (!ov_dir_access_to_path(path)) {
+    char tmp[PATH_MAX] = {0};
 
-        if (!ov_dir_tree_create(path)) {
-            ov_log_error("Faile to create dir %s", path);
-        }
+    ssize_t bytes = snprintf(tmp, PATH_MAX, "%s.tmp", path);
+    if ((bytes < 0) || (bytes >= PATH_MAX))
+        goto error;
 
-        OV_ASSERT(ov_dir_access_to_path(path));
+    int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, mode);
+    if (-1 == fd) {
+        ov_log_error("Failed to open %s - %s", tmp, strerror(errno));
+        goto error;
     }
 
-    /* we clean all config at path */
+    bool ok = write_all(fd, string, strlen(string)) &&
+              write_all(fd, "\n", 1) && (0 == fsync(fd));
 
-    DIR *dir = opendir(path);
-    if (!dir) {
+    close(fd);
+
+    if (!ok || (0 != rename(tmp, path))) {
+        ov_log_error("Failed to write %s - %s", path, strerror(errno));
+        unlink(tmp);
         goto error;
     }
 
-    struct dirent *entry = NULL;
+    return true;
+error:
+    return false;
+}
 
-    while ((entry = readdir(dir)) != NULL) {
+/*----------------------------------------------------------------------------*/
 
-        /* we ignore all dot (./ ../ .git/) */
-        if (entry->d_name[0] == '.')
-            continue;
+static bool write_json_atomic(const char *path, const ov_json_value *value,
+                              mode_t mode) {
 
-        memset(sub, 0, PATH_MAX);
-        snprintf(sub, PATH_MAX, "%s/%s", path, entry->d_name);
+    char *string = ov_json_value_to_string_with_config(
+        value, ov_json_config_stringify_default());
 
-        if (0 != stat(sub, &statbuf))
-            goto error;
+    if (!string)
+        return false;
 
-        mode_t mode = statbuf.st_mode & S_IFMT;
+    bool result = write_file_atomic(path, string, mode);
+    string = ov_data_pointer_free(string);
 
-        switch (mode) {
+    return result;
+}
 
-        case S_IFDIR:
+/*----------------------------------------------------------------------------*/
 
-            /* remove the child directory with all of it's childs */
-            ov_dir_tree_remove(sub);
-            break;
+struct container_outdated {
 
-        case S_IFREG:
-        case S_IFLNK:
+    const ov_json_value *keep;
+    ov_json_value *cache;
+};
 
-            /* remove the file/link */
-            unlink(sub);
-            break;
+/*----------------------------------------------------------------------------*/
 
-        default:
-            // ignore
+static bool remove_outdated(const char *path, struct container_outdated c) {
+
+    /* Removes all subfolders of path not contained in c.keep */
+
+    struct stat statbuf = {0};
+    char sub[PATH_MAX] = {0};
+
+    OV_ASSERT(path);
+
+    DIR *dir = opendir(path);
+    if (!dir)
+        return false;
+
+    struct dirent *entry = NULL;
+
+    while ((entry = readdir(dir)) != NULL) {
+
+        /* we ignore all dot (./ ../ .git/) */
+        if (entry->d_name[0] == '.')
             continue;
-        }
-    }
 
-    closedir(dir);
+        if (ov_json_object_get(c.keep, entry->d_name))
+            continue;
 
-    int r = chmod(path, S_IRWXU | S_IRWXG | S_IROTH);
-    if (r != 0) {
+        memset(sub, 0, PATH_MAX);
+        snprintf(sub, PATH_MAX, "%s/%s", path, entry->d_name);
 
-        ov_log_error("Failed to change file access of %s", path);
-    } else {
+        if ((0 != stat(sub, &statbuf)) || (!S_ISDIR(statbuf.st_mode)))
+            continue;
 
-        ov_log_debug("Changed rigths of %s", path);
+        ov_log_debug("DB persistance removing %s", sub);
+        ov_dir_tree_remove(sub);
+
+        if (c.cache)
+            ov_json_object_del(c.cache, entry->d_name);
     }
 
+    closedir(dir);
     return true;
-
-error:
-    return false;
 }
 
-/*----------------------------------------------------------------------------*/
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      AUTH PERSISTANCE
+ *
+ *      ------------------------------------------------------------------------
+ */
 
 struct container_write {
 
@@ -216,15 +310,10 @@ static bool save_main_config(const ov_json_value *value,
 
     ov_json_object_del(out, OV_KEY_PROJECTS);
 
-    if (!ov_json_write_file(path, out))
+    if (!write_json_atomic(path, out,
+                           S_IRUSR | S_IWUSR | S_IWGRP | S_IRGRP | S_IROTH))
         goto error;
 
-    r = chmod(path, S_IRUSR | S_IWUSR | S_IWGRP | S_IRGRP | S_IROTH);
-    if (r != 0) {
-
-        ov_log_error("Failed to change file access of %s", path);
-    }
-
     ov_json_value_free(out);
     return true;
 error:
@@ -290,6 +379,10 @@ static bool save_config(const void *key, void *item, void *data) {
         goto error;
 
     ov_json_value *projects = ov_json_object_get(domain, OV_KEY_PROJECTS);
+
+    /* Projects deleted since the last write */
+    remove_outdated(path, (struct container_outdated){.keep = projects});
+
     if (!projects)
         return true;
 
@@ -307,21 +400,77 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-static bool persist_auth(ov_vocs_db_persistance *self) {
+struct container_domains {
+
+    ov_vocs_db_persistance *self;
+    const char *path;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static char *domain_to_string(const ov_json_value *domain) {
+
+    return ov_json_value_to_string_with_config(
+        domain, ov_json_config_stringify_minimal());
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool save_domain_if_changed(const void *key, void *item, void *data) {
+
+    if (!key)
+        return true;
+
+    struct container_domains *c = (struct container_domains *)data;
+    ov_vocs_db_persistance *self = c->self;
 
-    OV_ASSERT(self);
     bool result = false;
+    char *string = domain_to_string(item);
 
-    ov_json_value *out =
-        ov_vocs_db_eject(self->config.db, OV_VOCS_DB_TYPE_AUTH);
-    if (!out)
+    if (!string)
         goto done;
 
+    const char *written =
+        ov_json_string_get(ov_json_object_get(self->store.domains, key));
+
+    if (written && (0 == strcmp(written, string))) {
+        result = true;
+        goto done;
+    }
+
+    struct container_write container = {.path = c->path};
+
+    result = save_config(key, item, &container);
+
+    if (result) {
+        ov_json_object_set(self->store.domains, key, ov_json_string(string));
+    } else {
+        ov_json_object_del(self->store.domains, key);
+    }
+
+done:
+    string = ov_data_pointer_free(string);
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool persist_auth(ov_vocs_db_persistance *self,
+                         const ov_json_value *auth) {
+
+    /* Called with store.lock held. Only domains changed since the last
+     * write are written, each file is replaced atomically. */
+
+    OV_ASSERT(self);
+    OV_ASSERT(auth);
+
     char path[PATH_MAX + 10] = {0};
     snprintf(path, PATH_MAX + 10, "%s/auth", self->config.path);
 
-    if (!auth_prepare_dir(path))
-        goto done;
+    if (!ov_dir_access_to_path(path) && !ov_dir_tree_create(path)) {
+        ov_log_error("Failed to create dir %s", path);
+        return false;
+    }
 
     int r = chmod(path, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
     if (r != 0) {
@@ -329,18 +478,344 @@ static bool persist_auth(ov_vocs_db_persistance *self) {
         ov_log_error("Failed to change file access of %s", path);
     }
 
-    struct container_write container = {
+    if (!self->store.domains)
+        self->store.domains = ov_json_object();
 
-        .path = path};
+    struct container_domains container = {.self = self, .path = path};
+
+    bool result = ov_json_object_for_each((ov_json_value *)auth, &container,
+                                          save_domain_if_changed);
+
+    /* Domains deleted since the last write */
+    result &= remove_outdated(path,
+                              (struct container_outdated){
+                                  .keep = auth, .cache = self->store.domains});
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool remember_domain(const void *key, void *item, void *data) {
+
+    if (!key)
+        return true;
+
+    ov_json_value *domains = ov_json_value_cast(data);
+    char *string = domain_to_string(item);
+
+    bool result = string && ov_json_object_set(domains, key,
+                                               ov_json_string(string));
+
+    string = ov_data_pointer_free(string);
+    return result;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      STATE PERSISTANCE
+ *
+ *      State is persisted as snapshot state.json and the log state.log.
+ *      Each line of the log contains the users changed:
+ *
+ *          {"user1":{...},"user2":null}
+ *
+ *      where null means the state of the user was removed. Once the
+ *      log contains limits.state_log_entries lines, it is compacted into
+ *      the snapshot.
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static bool apply_state_change(const void *key, void *item, void *data) {
+
+    if (!key)
+        return true;
+
+    ov_json_value *state = ov_json_value_cast(data);
+    ov_json_value *copy = NULL;
+
+    if (ov_json_is_null(item)) {
+        ov_json_object_del(state, key);
+        return true;
+    }
+
+    if (!ov_json_value_copy((void **)&copy, item))
+        goto error;
+
+    if (!ov_json_object_set(state, key, copy))
+        goto error;
+
+    return true;
+error:
+    copy = ov_json_value_free(copy);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool merge_state_change(const void *key, void *item, void *data) {
+
+    /* unlike apply_state_change, null is kept as marker of removal */
+
+    if (!key)
+        return true;
+
+    ov_json_value *copy = NULL;
+
+    if (!ov_json_value_copy((void **)&copy, item))
+        goto error;
+
+    if (!ov_json_object_set(ov_json_value_cast(data), key, copy))
+        goto error;
+
+    return true;
+error:
+    copy = ov_json_value_free(copy);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool compact_state(ov_vocs_db_persistance *self) {
+
+    /* Called with store.lock held */
+
+    char path[PATH_MAX + 20] = {0};
+
+    if (!self->store.state)
+        return true;
+
+    snprintf(path, sizeof(path), "%s/%s", self->config.path, IMPL_STATE_FILE);
+
+    if (!write_json_atomic(path, self->store.state,
+                           S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH))
+        return false;
+
+    /* The log is contained within the snapshot now. Replaying it after
+     * crashing right here does no harm, as it contains complete users. */
+
+    snprintf(path, sizeof(path), "%s/%s", self->config.path,
+             IMPL_STATE_LOG_FILE);
+
+    if ((0 != unlink(path)) && (ENOENT != errno)) {
+        ov_log_error("Failed to remove %s - %s", path, strerror(errno));
+        return false;
+    }
+
+    self->store.log_entries = 0;
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool append_state_log(ov_vocs_db_persistance *self,
+                             const ov_json_value *changes) {
+
+    char *string = NULL;
+    char path[PATH_MAX + 20] = {0};
+    int fd = -1;
+
+    if (!self->store.state)
+        self->store.state = ov_json_object();
+
+    if (!ov_json_object_for_each((ov_json_value *)changes, self->store.state,
+                                 apply_state_change))
+        goto error;
+
+    if (++self->store.log_entries >= self->config.limits.state_log_entries)
+        return compact_state(self);
+
+    string = ov_json_value_to_string_with_config(
+        changes, ov_json_config_stringify_minimal());
+
+    if (!string)
+        goto error;
+
+    snprintf(path, sizeof(path), "%s/%s", self->config.path,
+             IMPL_STATE_LOG_FILE);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_APPEND,
+              S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+
+    if (-1 == fd)
+        goto error;
+
+    if (!write_all(fd, string, strlen(string)) ||
+        !write_all(fd, "\n", 1) || (0 != fsync(fd)))
+        goto error;
+
+    close(fd);
+    string = ov_data_pointer_free(string);
+    return true;
+
+error:
+    if (-1 != fd)
+        close(fd);
+
+    string = ov_data_pointer_free(string);
+
+    ov_log_error("DB failed to append to state log - compacting");
+    return compact_state(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *load_state(ov_vocs_db_persistance *self, bool *torn) {
+
+    /* Called with store.lock held */
+
+    char path[PATH_MAX + 20] = {0};
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t length = 0;
+
+    self->store.log_entries = 0;
+
+    snprintf(path, sizeof(path), "%s/%s", self->config.path, IMPL_STATE_FILE);
+    ov_json_value *state = ov_json_read_file(path);
+
+    snprintf(path, sizeof(path), "%s/%s", self->config.path,
+             IMPL_STATE_LOG_FILE);
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return state;
+
+    while (-1 != (length = getline(&line, &size, fp))) {
+
+        if ((length > 0) && ('\n' == line[length - 1]))
+            --length;
+
+        ov_json_value *changes = ov_json_value_from_string(line, length);
+
+        if (!changes) {
+
+            /* Crashed while appending, drop the rest */
+            ov_log_error("DB state log %s torn after %" PRIu64 " entries",
+                         path, self->store.log_entries);
+
+            *torn = true;
+            break;
+        }
+
+        if (!state)
+            state = ov_json_object();
+
+        ov_json_object_for_each(changes, state, apply_state_change);
+        changes = ov_json_value_free(changes);
+
+        ++self->store.log_entries;
+    }
+
+    line = ov_data_pointer_free(line);
+    fclose(fp);
+
+    return state;
+}
+
+/*
+ *      ------------------------------------------------------------------------
+ *
+ *      SNAPSHOTS
+ *
+ *      Timers run within the loop. They only eject the changes from the db
+ *      and hand them over to some thread of the thread loop for writing.
+ *
+ *      ------------------------------------------------------------------------
+ */
+
+static bool persist_pending(ov_vocs_db_persistance *self) {
+
+    bool result = true;
+
+    pthread_mutex_lock(&self->store.lock);
+    pthread_mutex_lock(&self->pending.lock);
+
+    ov_json_value *state = self->pending.state;
+    ov_json_value *auth = self->pending.auth;
+
+    self->pending.state = NULL;
+    self->pending.auth = NULL;
+
+    pthread_mutex_unlock(&self->pending.lock);
+
+    if (state)
+        result &= append_state_log(self, state);
+
+    if (auth && !persist_auth(self, auth)) {
+
+        /* force the next auth snapshot to eject and write again */
+        pthread_mutex_lock(&self->pending.lock);
+        self->pending.auth_changes = UINT64_MAX;
+        pthread_mutex_unlock(&self->pending.lock);
+
+        result = false;
+    }
+
+    pthread_mutex_unlock(&self->store.lock);
+
+    state = ov_json_value_free(state);
+    auth = ov_json_value_free(auth);
 
-    result = ov_json_object_for_each(out, &container, save_config);
-done:
-    out = ov_json_value_free(out);
     return result;
 }
 
 /*----------------------------------------------------------------------------*/
 
+static bool send_persist_message(ov_vocs_db_persistance *self) {
+
+    ov_thread_message *msg =
+        ov_thread_message_standard_create(IMPL_MESSAGE_PERSIST, NULL);
+
+    if (!msg)
+        return false;
+
+    if (ov_thread_loop_send_message(self->thread_loop, msg,
+                                    OV_RECEIVER_THREAD))
+        return true;
+
+    /* Changes stay pending and are written with the next message */
+    ov_log_error("DB failed to hand over snapshot to thread");
+    ov_thread_message_free(msg);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool queue_auth(ov_vocs_db_persistance *self) {
+
+    OV_ASSERT(self);
+
+    uint64_t changes = ov_vocs_db_auth_changes(self->config.db);
+
+    pthread_mutex_lock(&self->pending.lock);
+    bool unchanged = (changes == self->pending.auth_changes);
+    pthread_mutex_unlock(&self->pending.lock);
+
+    if (unchanged)
+        return true;
+
+    ov_json_value *out =
+        ov_vocs_db_eject(self->config.db, OV_VOCS_DB_TYPE_AUTH);
+    if (!out)
+        return false;
+
+    pthread_mutex_lock(&self->pending.lock);
+
+    /* Some older auth copy not written yet is outdated */
+    ov_json_value_free(self->pending.auth);
+    self->pending.auth = out;
+    self->pending.auth_changes = changes;
+
+    pthread_mutex_unlock(&self->pending.lock);
+
+    return send_persist_message(self);
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool timer_auth_snapshot(uint32_t id, void *data) {
 
     ov_vocs_db_persistance *self = ov_vocs_db_persistance_cast(data);
@@ -353,7 +828,7 @@ static bool timer_auth_snapshot(uint32_t id, void *data) {
     if (!ov_thread_lock_try_lock(&self->lock))
         goto reenable_timer;
 
-    if (!persist_auth(self))
+    if (!queue_auth(self))
         ov_log_error("DB failed to persist auth snapshot");
 
     if (!ov_thread_lock_unlock(&self->lock)) {
@@ -372,23 +847,37 @@ reenable_timer:
 
 /*----------------------------------------------------------------------------*/
 
-static bool persist_state(ov_vocs_db_persistance *self) {
+static bool queue_state(ov_vocs_db_persistance *self) {
 
     OV_ASSERT(self);
     bool result = true;
 
-    ov_json_value *out =
-        ov_vocs_db_eject(self->config.db, OV_VOCS_DB_TYPE_STATE);
-    if (!out)
+    ov_json_value *changes = ov_vocs_db_eject_state_changes(self->config.db);
+    if (!changes)
+        return false;
+
+    if (ov_json_object_is_empty(changes))
         goto done;
 
-    char path[PATH_MAX + 20] = {0};
-    snprintf(path, PATH_MAX + 20, "%s/state.json", self->config.path);
+    pthread_mutex_lock(&self->pending.lock);
 
-    result = ov_json_write_file(path, out);
-    out = ov_json_value_free(out);
+    if (!self->pending.state) {
+
+        self->pending.state = changes;
+        changes = NULL;
+
+    } else {
+
+        result = ov_json_object_for_each(changes, self->pending.state,
+                                         merge_state_change);
+    }
+
+    pthread_mutex_unlock(&self->pending.lock);
+
+    result &= send_persist_message(self);
 
 done:
+    changes = ov_json_value_free(changes);
     return result;
 }
 
@@ -407,7 +896,7 @@ static bool timer_state_snapshot(uint32_t id, void *data) {
     if (!ov_thread_lock_try_lock(&self->lock))
         goto reenable_timer;
 
-    if (!persist_state(self))
+    if (!queue_state(self))
         ov_log_error("DB failed to persist state snapshot");
 
     if (!ov_thread_lock_unlock(&self->lock)) {
@@ -1027,6 +1516,9 @@ ov_vocs_db_persistance_create(ov_vocs_db_persistance_config config) {
     if (0 == config.path[0])
         strncpy(config.path, IMPL_DEFAULT_PATH, PATH_MAX);
 
+    if (0 == config.limits.state_log_entries)
+        config.limits.state_log_entries = IMPL_DEFAULT_STATE_LOG_ENTRIES;
+
     self = calloc(1, sizeof(ov_vocs_db_persistance));
     if (!self)
         goto error;
@@ -1034,6 +1526,9 @@ ov_vocs_db_persistance_create(ov_vocs_db_persistance_config config) {
     self->magic_byte = OV_VOCS_DB_PERSISTANCE_MAGIC_BYTE;
     self->config = config;
 
+    pthread_mutex_init(&self->pending.lock, NULL);
+    pthread_mutex_init(&self->store.lock, NULL);
+
     if (!ov_thread_lock_init(&self->lock, config.timeout.thread_lock_usec))
         goto error;
 
@@ -1173,6 +1668,18 @@ ov_vocs_db_persistance_free(ov_vocs_db_persistance *self) {
 
     self->thread_loop = ov_thread_loop_free(self->thread_loop);
 
+    /* write changes no thread picked up */
+    if (!persist_pending(self))
+        ov_log_error("DB failed to persist pending changes");
+
+    self->pending.state = ov_json_value_free(self->pending.state);
+    self->pending.auth = ov_json_value_free(self->pending.auth);
+    self->store.state = ov_json_value_free(self->store.state);
+    self->store.domains = ov_json_value_free(self->store.domains);
+
+    pthread_mutex_destroy(&self->pending.lock);
+    pthread_mutex_destroy(&self->store.lock);
+
     /* unlock */
     if (!ov_thread_lock_unlock(&self->lock)) {
         OV_ASSERT(1 == 0);
@@ -1406,11 +1913,15 @@ error:
 bool ov_vocs_db_persistance_load(ov_vocs_db_persistance *self) {
 
     bool result = false;
+    bool torn = false;
+
     if (!self)
         goto error;
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
+    pthread_mutex_lock(&self->store.lock);
+
     char path[PATH_MAX + 20] = {0};
     snprintf(path, PATH_MAX + 20, "%s/auth", self->config.path);
 
@@ -1418,29 +1929,59 @@ bool ov_vocs_db_persistance_load(ov_vocs_db_persistance *self) {
     if (!val)
         goto done;
 
+    /* remember what is persisted, to write changed domains only */
+
+    self->store.domains = ov_json_value_free(self->store.domains);
+    self->store.domains = ov_json_object();
+
+    if (!ov_json_object_for_each(val, self->store.domains, remember_domain))
+        self->store.domains = ov_json_value_free(self->store.domains);
+
     result = ov_vocs_db_inject(self->config.db, OV_VOCS_DB_TYPE_AUTH, val);
     if (!result) {
         val = ov_json_value_free(val);
         goto done;
     }
 
-    ov_log_debug("DB load auth from %s", path);
+    pthread_mutex_lock(&self->pending.lock);
+    self->pending.auth = ov_json_value_free(self->pending.auth);
+    self->pending.auth_changes = ov_vocs_db_auth_changes(self->config.db);
+    pthread_mutex_unlock(&self->pending.lock);
 
-    snprintf(path, PATH_MAX + 20, "%s/state.json", self->config.path);
+    ov_log_debug("DB load auth from %s", path);
 
-    val = ov_json_read_file(path);
+    val = load_state(self, &torn);
     if (!val)
         goto done;
 
+    self->store.state = ov_json_value_free(self->store.state);
+
+    if (!ov_json_value_copy((void **)&self->store.state, val)) {
+        val = ov_json_value_free(val);
+        result = false;
+        goto done;
+    }
+
     result &= ov_vocs_db_inject(self->config.db, OV_VOCS_DB_TYPE_STATE, val);
     if (!result) {
         val = ov_json_value_free(val);
         goto done;
     }
 
-    ov_log_debug("DB load state from %s", path);
+    pthread_mutex_lock(&self->pending.lock);
+    self->pending.state = ov_json_value_free(self->pending.state);
+    pthread_mutex_unlock(&self->pending.lock);
+
+    /* Do not append to some torn log */
+    if (torn)
+        result &= compact_state(self);
+
+    ov_log_debug("DB load state from %s with %" PRIu64 " log entries",
+                 self->config.path, self->store.log_entries);
 
 done:
+    pthread_mutex_unlock(&self->store.lock);
+
     if (!ov_thread_lock_unlock(&self->lock)) {
         OV_ASSERT(1 == 0);
         goto error;
@@ -1454,6 +1995,49 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static bool persist_all(ov_vocs_db_persistance *self) {
+
+    /* Called with store.lock held */
+
+    bool result = false;
+
+    pthread_mutex_lock(&self->pending.lock);
+
+    /* pending changes are contained in the copies ejected below */
+    self->pending.state = ov_json_value_free(self->pending.state);
+    self->pending.auth = ov_json_value_free(self->pending.auth);
+    self->pending.auth_changes = ov_vocs_db_auth_changes(self->config.db);
+
+    pthread_mutex_unlock(&self->pending.lock);
+
+    ov_json_value_free(ov_vocs_db_eject_state_changes(self->config.db));
+
+    ov_json_value *auth =
+        ov_vocs_db_eject(self->config.db, OV_VOCS_DB_TYPE_AUTH);
+
+    if (!auth)
+        goto done;
+
+    result = persist_auth(self, auth);
+    auth = ov_json_value_free(auth);
+
+    ov_json_value *state =
+        ov_vocs_db_eject(self->config.db, OV_VOCS_DB_TYPE_STATE);
+
+    if (!state)
+        goto done;
+
+    self->store.state = ov_json_value_free(self->store.state);
+    self->store.state = state;
+
+    result &= compact_state(self);
+
+done:
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_vocs_db_persistance_save(ov_vocs_db_persistance *self) {
 
     bool result = false;
@@ -1464,8 +2048,9 @@ bool ov_vocs_db_persistance_save(ov_vocs_db_persistance *self) {
     if (!ov_thread_lock_try_lock(&self->lock))
         goto error;
 
-    result = persist_auth(self);
-    result &= persist_state(self);
+    pthread_mutex_lock(&self->store.lock);
+    result = persist_all(self);
+    pthread_mutex_unlock(&self->store.lock);
 
     if (!ov_thread_lock_unlock(&self->lock)) {
         OV_ASSERT(1 == 0);
@@ -1973,15 +2558,10 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
-bool handle_in_thread(ov_thread_loop *loop, ov_thread_message *msg) {
+static bool import_ldap_users(ov_vocs_db_persistance *self,
+                              ov_thread_message *msg) {
 
     ov_json_value *users = NULL;
-    ov_vocs_db_persistance *self = NULL;
-
-    if (!loop || !msg)
-        goto error;
-
-    self = ov_thread_loop_get_data(loop);
 
     OV_ASSERT(msg->json_message);
 
@@ -2020,15 +2600,49 @@ bool handle_in_thread(ov_thread_loop *loop, ov_thread_message *msg) {
     ov_vocs_db_send_vocs_trigger(self->config.db, changes);
     changes = ov_json_value_free(changes);
 
-    ov_thread_message_free(msg);
     return true;
 error:
-    ov_thread_message_free(msg);
     return false;
 }
 
 /*----------------------------------------------------------------------------*/
 
+bool handle_in_thread(ov_thread_loop *loop, ov_thread_message *msg) {
+
+    bool result = false;
+    ov_vocs_db_persistance *self = NULL;
+
+    if (!loop || !msg)
+        goto error;
+
+    self = ov_thread_loop_get_data(loop);
+
+    switch (msg->type) {
+
+    case IMPL_MESSAGE_LDAP_IMPORT:
+        result = import_ldap_users(self, msg);
+        break;
+
+    case IMPL_MESSAGE_PERSIST:
+
+        result = persist_pending(self);
+
+        if (!result)
+            ov_log_error("DB failed to write snapshot");
+
+        break;
+
+    default:
+        break;
+    }
+
+error:
+    ov_thread_message_free(msg);
+    return result;
+}
+
+/*----------------------------------------------------------------------------*/
+
 bool handle_in_loop(ov_thread_loop *loop, ov_thread_message *msg) {
 
     if (!loop || !msg)
@@ -2077,7 +2691,7 @@ bool ov_vocs_db_persistance_ldap_import(ov_vocs_db_persistance *self,
     if (!ov_json_object_set(out, OV_KEY_DOMAIN, val))
         goto error;
 
-    msg = ov_thread_message_standard_create(1, out);
+    msg = ov_thread_message_standard_create(IMPL_MESSAGE_LDAP_IMPORT, out);
     if (!msg)
         goto error;
 
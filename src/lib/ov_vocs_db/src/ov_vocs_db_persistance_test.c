@@ -338,6 +338,350 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static size_t count_lines(const char *path) {
+
+    size_t lines = 0;
+    int c = 0;
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return 0;
+
+    while (EOF != (c = fgetc(fp))) {
+        if ('\n' == c)
+            lines++;
+    }
+
+    fclose(fp);
+    return lines;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ino_t inode_of(const char *path) {
+
+    struct stat statbuf = {0};
+
+    if (0 != stat(path, &statbuf))
+        return 0;
+
+    return statbuf.st_ino;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_vocs_db_persistance_state_log() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    ov_io *io = ov_io_create((ov_io_config){.loop = loop});
+
+    ov_vocs_db *db = ov_vocs_db_create((ov_vocs_db_config){0});
+
+    testrun(loop);
+    testrun(io);
+    testrun(db);
+    testrun(create_db(db, 1, 1, 1));
+
+    char dir[] = "/tmp/ov_vocs_db_persistance_XXXXXX";
+    testrun(mkdtemp(dir));
+
+    char log[PATH_MAX] = {0};
+    char snapshot[PATH_MAX] = {0};
+    snprintf(log, PATH_MAX, "%s/%s", dir, IMPL_STATE_LOG_FILE);
+    snprintf(snapshot, PATH_MAX, "%s/%s", dir, IMPL_STATE_FILE);
+
+    ov_vocs_db_persistance_config c = (ov_vocs_db_persistance_config){
+        .loop = loop, .db = db, .io = io, .limits.state_log_entries = 3};
+
+    strncpy(c.path, dir, PATH_MAX);
+
+    ov_vocs_db_persistance *self = ov_vocs_db_persistance_create(c);
+    testrun(self);
+    testrun(ov_vocs_db_persistance_save(self));
+
+    testrun(ov_file_read_check(snapshot) == NULL);
+    testrun(0 == count_lines(log));
+
+    // nothing changed, nothing to queue
+
+    testrun(queue_state(self));
+    testrun(NULL == self->pending.state);
+
+    // each snapshot appends one line
+
+    testrun(ov_vocs_db_set_state(db, "user1", "role1", "loop1", OV_VOCS_SEND));
+    testrun(ov_vocs_db_set_volume(db, "user1", "role1", "loop1", 40));
+    testrun(queue_state(self));
+    testrun(persist_pending(self));
+    testrun(1 == count_lines(log));
+
+    testrun(ov_vocs_db_set_state(db, "user2", "role1", "loop1", OV_VOCS_RECV));
+    testrun(queue_state(self));
+    testrun(persist_pending(self));
+    testrun(2 == count_lines(log));
+
+    // replayed on load
+
+    ov_vocs_db *db2 = ov_vocs_db_create((ov_vocs_db_config){0});
+    testrun(db2);
+
+    c.db = db2;
+    ov_vocs_db_persistance *other = ov_vocs_db_persistance_create(c);
+    testrun(other);
+    testrun(ov_vocs_db_persistance_load(other));
+    testrun(2 == other->store.log_entries);
+
+    testrun(OV_VOCS_SEND ==
+            ov_vocs_db_get_state(db2, "user1", "role1", "loop1"));
+    testrun(40 == ov_vocs_db_get_volume(db2, "user1", "role1", "loop1"));
+    testrun(OV_VOCS_RECV ==
+            ov_vocs_db_get_state(db2, "user2", "role1", "loop1"));
+
+    testrun(NULL == ov_vocs_db_persistance_free(other));
+
+    // compacted into the snapshot once the limit is reached
+
+    testrun(ov_vocs_db_set_volume(db, "user1", "role1", "loop1", 60));
+    testrun(queue_state(self));
+    testrun(persist_pending(self));
+
+    testrun(0 == count_lines(log));
+    testrun(0 == self->store.log_entries);
+
+    // torn line at the end of the log is dropped
+
+    testrun(ov_vocs_db_set_volume(db, "user1", "role1", "loop1", 70));
+    testrun(queue_state(self));
+    testrun(persist_pending(self));
+    testrun(1 == count_lines(log));
+
+    FILE *fp = fopen(log, "a");
+    testrun(fp);
+    fprintf(fp, "{\"user1\":{\"role1\":");
+    fclose(fp);
+
+    testrun(NULL == ov_vocs_db_free(db2));
+    db2 = ov_vocs_db_create((ov_vocs_db_config){0});
+
+    c.db = db2;
+    other = ov_vocs_db_persistance_create(c);
+    testrun(other);
+    testrun(ov_vocs_db_persistance_load(other));
+
+    testrun(70 == ov_vocs_db_get_volume(db2, "user1", "role1", "loop1"));
+    testrun(OV_VOCS_RECV ==
+            ov_vocs_db_get_state(db2, "user2", "role1", "loop1"));
+
+    // compacted, the torn line is gone
+    testrun(0 == count_lines(log));
+
+    testrun(NULL == ov_vocs_db_persistance_free(other));
+    testrun(NULL == ov_vocs_db_free(db2));
+
+    // pending changes are written on free
+
+    testrun(ov_vocs_db_set_volume(db, "user1", "role1", "loop1", 80));
+    testrun(queue_state(self));
+    testrun(NULL == ov_vocs_db_persistance_free(self));
+
+    db2 = ov_vocs_db_create((ov_vocs_db_config){0});
+    c.db = db2;
+    other = ov_vocs_db_persistance_create(c);
+    testrun(ov_vocs_db_persistance_load(other));
+    testrun(80 == ov_vocs_db_get_volume(db2, "user1", "role1", "loop1"));
+
+    testrun(NULL == ov_vocs_db_persistance_free(other));
+    testrun(NULL == ov_vocs_db_free(db2));
+
+    testrun(ov_dir_tree_remove(dir));
+
+    testrun(NULL == ov_vocs_db_free(db));
+    testrun(NULL == ov_io_free(io));
+    testrun(NULL == ov_event_loop_free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_vocs_db_persistance_auth_incremental() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    ov_io *io = ov_io_create((ov_io_config){.loop = loop});
+
+    ov_vocs_db *db = ov_vocs_db_create((ov_vocs_db_config){0});
+
+    testrun(loop);
+    testrun(io);
+    testrun(db);
+    testrun(create_db(db, 2, 2, 1));
+
+    char dir[] = "/tmp/ov_vocs_db_persistance_XXXXXX";
+    testrun(mkdtemp(dir));
+
+    char id0[PATH_MAX] = {0};
+    char id1[PATH_MAX] = {0};
+    char project[PATH_MAX] = {0};
+
+    snprintf(id0, PATH_MAX, "%s/auth/id0/%s", dir,
+             OV_VOCS_DB_PERSISTANCE_CONFIG_FILE);
+    snprintf(id1, PATH_MAX, "%s/auth/id1/%s", dir,
+             OV_VOCS_DB_PERSISTANCE_CONFIG_FILE);
+    snprintf(project, PATH_MAX, "%s/auth/id1/project11", dir);
+
+    ov_vocs_db_persistance_config c = (ov_vocs_db_persistance_config){
+        .loop = loop, .db = db, .io = io};
+
+    strncpy(c.path, dir, PATH_MAX);
+
+    ov_vocs_db_persistance *self = ov_vocs_db_persistance_create(c);
+    testrun(self);
+    testrun(ov_vocs_db_persistance_save(self));
+
+    ino_t inode0 = inode_of(id0);
+    ino_t inode1 = inode_of(id1);
+
+    testrun(0 != inode0);
+    testrun(0 != inode1);
+    testrun(ov_dir_access_to_path(project));
+
+    // unchanged auth is not ejected at all
+
+    testrun(queue_auth(self));
+    testrun(NULL == self->pending.auth);
+
+    // only the domain changed is rewritten
+
+    ov_json_value *name = ov_json_string("changed");
+    testrun(ov_vocs_db_update_entity_key(db, OV_VOCS_DB_DOMAIN, "id1",
+                                         OV_KEY_NAME, name));
+    name = ov_json_value_free(name);
+
+    testrun(queue_auth(self));
+    testrun(persist_pending(self));
+
+    testrun(inode0 == inode_of(id0));
+    testrun(inode1 != inode_of(id1));
+
+    // deleted entities are removed from disk
+
+    testrun(ov_vocs_db_delete_entity(db, OV_VOCS_DB_PROJECT, "project11"));
+    testrun(queue_auth(self));
+    testrun(persist_pending(self));
+
+    testrun(!ov_dir_access_to_path(project));
+    testrun(inode0 == inode_of(id0));
+
+    testrun(ov_vocs_db_delete_entity(db, OV_VOCS_DB_DOMAIN, "id1"));
+    testrun(queue_auth(self));
+    testrun(persist_pending(self));
+
+    testrun(0 == inode_of(id1));
+    testrun(inode0 == inode_of(id0));
+
+    // what was written loads again
+
+    ov_vocs_db *db2 = ov_vocs_db_create((ov_vocs_db_config){0});
+    testrun(db2);
+
+    c.db = db2;
+    ov_vocs_db_persistance *other = ov_vocs_db_persistance_create(c);
+    testrun(other);
+    testrun(ov_vocs_db_persistance_load(other));
+
+    ov_json_value *out =
+        ov_vocs_db_get_entity(db2, OV_VOCS_DB_PROJECT, "project01");
+    testrun(out);
+    out = ov_json_value_free(out);
+    testrun(!ov_vocs_db_get_entity(db2, OV_VOCS_DB_DOMAIN, "id1"));
+
+    testrun(NULL == ov_vocs_db_persistance_free(other));
+    testrun(NULL == ov_vocs_db_free(db2));
+    testrun(NULL == ov_vocs_db_persistance_free(self));
+
+    testrun(ov_dir_tree_remove(dir));
+
+    testrun(NULL == ov_vocs_db_free(db));
+    testrun(NULL == ov_io_free(io));
+    testrun(NULL == ov_event_loop_free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_snapshot_performance() {
+
+    ov_event_loop *loop = ov_event_loop_default(
+        (ov_event_loop_config){.max.sockets = 100, .max.timers = 100});
+
+    ov_io *io = ov_io_create((ov_io_config){.loop = loop});
+
+    ov_vocs_db *db = ov_vocs_db_create((ov_vocs_db_config){0});
+
+    testrun(loop);
+    testrun(io);
+    testrun(db);
+    testrun(create_db(db, 10, 10, 10));
+
+    char dir[] = "/tmp/ov_vocs_db_persistance_XXXXXX";
+    testrun(mkdtemp(dir));
+
+    ov_vocs_db_persistance_config c = (ov_vocs_db_persistance_config){
+        .loop = loop, .db = db, .io = io};
+
+    strncpy(c.path, dir, PATH_MAX);
+
+    ov_vocs_db_persistance *self = ov_vocs_db_persistance_create(c);
+    testrun(self);
+
+    const size_t runs = 50;
+
+    uint64_t start = ov_time_get_current_time_usecs();
+    for (size_t i = 0; i < runs; i++) {
+        testrun(ov_vocs_db_persistance_save(self));
+    }
+    uint64_t save_usec = ov_time_get_current_time_usecs() - start;
+
+    // time spent within the loop by both snapshot timers
+
+    char user[100] = {0};
+    uint64_t loop_usec = 0;
+
+    for (size_t i = 0; i < runs; i++) {
+
+        snprintf(user, 100, "user%zu", i);
+        testrun(ov_vocs_db_set_volume(db, user, "role", "loop", 50));
+
+        start = ov_time_get_current_time_usecs();
+        testrun(queue_state(self));
+        testrun(queue_auth(self));
+        loop_usec += ov_time_get_current_time_usecs() - start;
+
+        testrun(persist_pending(self));
+    }
+
+    fprintf(stdout,
+            "10/10/10 save %.0f ns/op, snapshot timers within loop "
+            "%.0f ns/op\n",
+            1000.0 * save_usec / runs, 1000.0 * loop_usec / runs);
+
+    testrun(NULL == ov_vocs_db_persistance_free(self));
+    testrun(ov_dir_tree_remove(dir));
+
+    testrun(NULL == ov_vocs_db_free(db));
+    testrun(NULL == ov_io_free(io));
+    testrun(NULL == ov_event_loop_free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int check_performance() {
 
     ov_event_loop *loop = ov_event_loop_default(
@@ -412,8 +756,11 @@ int all_tests() {
 
     testrun_test(test_ov_vocs_db_persistance_save);
     testrun_test(test_ov_vocs_db_persistance_load);
+    testrun_test(test_ov_vocs_db_persistance_state_log);
+    testrun_test(test_ov_vocs_db_persistance_auth_incremental);
 
     testrun_test(check_performance);
+    testrun_test(check_snapshot_performance);
 
     return testrun_counter;
 }
@@ -2509,6 +2509,98 @@ int test_ov_vocs_db_eject() {
 
 /*----------------------------------------------------------------------------*/
 
+int test_ov_vocs_db_auth_changes() {
+
+    ov_vocs_db *db = ov_vocs_db_create((ov_vocs_db_config){0});
+    testrun(db);
+
+    testrun(0 == ov_vocs_db_auth_changes(NULL));
+
+    testrun(create_test_db(db));
+
+    uint64_t changes = ov_vocs_db_auth_changes(db);
+    testrun(0 != changes);
+
+    // state changes do not count
+
+    testrun(ov_vocs_db_set_state(db, "user11", "role11", "loop11",
+                                 OV_VOCS_SEND));
+    testrun(changes == ov_vocs_db_auth_changes(db));
+
+    testrun(ov_vocs_db_set_password(db, "user11", "pass"));
+    testrun(changes < ov_vocs_db_auth_changes(db));
+    changes = ov_vocs_db_auth_changes(db);
+
+    testrun(ov_vocs_db_delete_entity(db, OV_VOCS_DB_USER, "user11"));
+    testrun(changes < ov_vocs_db_auth_changes(db));
+
+    testrun(NULL == ov_vocs_db_free(db));
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_vocs_db_eject_state_changes() {
+
+    ov_vocs_db *db = ov_vocs_db_create((ov_vocs_db_config){0});
+    testrun(db);
+
+    testrun(NULL == ov_vocs_db_eject_state_changes(NULL));
+
+    testrun(create_test_db(db));
+
+    ov_json_value *changes = ov_vocs_db_eject_state_changes(db);
+    testrun(changes);
+    testrun(ov_json_object_is_empty(changes));
+    changes = ov_json_value_free(changes);
+
+    testrun(ov_vocs_db_set_state(db, "user11", "role11", "loop11",
+                                 OV_VOCS_SEND));
+    testrun(ov_vocs_db_set_volume(db, "user11", "role11", "loop11", 40));
+    testrun(ov_vocs_db_set_volume(db, "user12", "role11", "loop11", 50));
+
+    changes = ov_vocs_db_eject_state_changes(db);
+    testrun(changes);
+    testrun(2 == ov_json_object_count(changes));
+    testrun(ov_json_get(changes, "/user11/role11/loop11"));
+    testrun(ov_json_get(changes, "/user12/role11/loop11"));
+
+    // changes are the same as the state ejected
+
+    ov_json_value *state = ov_vocs_db_eject(db, OV_VOCS_DB_TYPE_STATE);
+    testrun(state);
+
+    char *expect = ov_json_value_to_string(ov_json_get(state, "/user11"));
+    char *string = ov_json_value_to_string(ov_json_get(changes, "/user11"));
+    testrun(expect && string);
+    testrun(0 == strcmp(expect, string));
+
+    expect = ov_data_pointer_free(expect);
+    string = ov_data_pointer_free(string);
+    state = ov_json_value_free(state);
+    changes = ov_json_value_free(changes);
+
+    // ejected once only
+
+    changes = ov_vocs_db_eject_state_changes(db);
+    testrun(ov_json_object_is_empty(changes));
+    changes = ov_json_value_free(changes);
+
+    // injected state is not a change
+
+    testrun(ov_vocs_db_set_volume(db, "user11", "role11", "loop11", 60));
+    testrun(ov_vocs_db_inject(db, OV_VOCS_DB_TYPE_STATE, ov_json_object()));
+
+    changes = ov_vocs_db_eject_state_changes(db);
+    testrun(ov_json_object_is_empty(changes));
+    changes = ov_json_value_free(changes);
+
+    testrun(NULL == ov_vocs_db_free(db));
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
 int test_ov_vocs_db_set_password() {
 
     ov_vocs_db *db = ov_vocs_db_create((ov_vocs_db_config){0});
@@ -4056,6 +4148,8 @@ int all_tests() {
 
     testrun_test(test_ov_vocs_db_inject);
     testrun_test(test_ov_vocs_db_eject);
+    testrun_test(test_ov_vocs_db_auth_changes);
+    testrun_test(test_ov_vocs_db_eject_state_changes);
 
     testrun_test(test_ov_vocs_db_set_password);
     testrun_test(test_ov_vocs_db_authenticate);
@@ -36,6 +36,7 @@
 
 #include <ov_core/ov_domain.h>
 #include <ov_core/ov_event_io.h>
+#include <ov_core/ov_http_asset_cache.h>
 #include <ov_core/ov_http_pointer.h>
 #include <ov_core/ov_websocket_message.h>
 #include <ov_core/ov_websocket_pointer.h>
@@ -70,6 +71,8 @@ typedef struct ov_web_server_config {
 
     } limits;
 
+    ov_http_asset_cache_config cache;
+
     ov_http_message_config http_message;
     ov_websocket_frame_config websocket_frame;
 
@@ -583,11 +583,11 @@ static bool cb_wss_send_json(void *userdata, int socket,
     if (!conn)
         goto error;
 
-    str = ov_json_value_to_string(msg);
-    if (!str)
-        goto error;
+    ov_json_stringify_config stringify = ov_json_config_stringify_default();
 
-    ssize_t length = strlen(str);
+    ssize_t length = ov_json_parser_calculate(msg, &stringify);
+    if (length < 0)
+        goto error;
 
     /* Send the string over websocket frames */
 
@@ -606,7 +606,7 @@ static bool cb_wss_send_json(void *userdata, int socket,
 
         frame->buffer->start[0] = 0x80 | OV_WEBSOCKET_OPCODE_TEXT;
 
-        if (!ov_websocket_set_data(frame, (uint8_t *)str, length, false)) {
+        if (!ov_websocket_frame_set_json(frame, msg, &stringify, length)) {
             goto error;
         }
 
@@ -620,6 +620,10 @@ static bool cb_wss_send_json(void *userdata, int socket,
     /* send fragmented */
     size_t counter = 0;
 
+    str = ov_json_value_to_string(msg);
+    if (!str)
+        goto error;
+
     uint8_t *ptr = (uint8_t *)str;
     ssize_t open = length;
 
@@ -1044,6 +1048,9 @@ ov_web_server_config_from_json(const ov_json_value *value) {
     out.limits.max_content_bytes_per_websocket_frame = ov_json_number_get(
         ov_json_get(config, "/" OV_KEY_LIMITS "/" OV_WEBSOCKET_KEY));
 
+    out.cache = ov_http_asset_cache_config_from_json(
+        ov_json_object_get(config, OV_KEY_CACHE));
+
     ov_json_value *mime = ov_json_object_get(config, OV_KEY_MIME);
 
     const char *str = ov_json_string_get(ov_json_object_get(mime, OV_KEY_PATH));
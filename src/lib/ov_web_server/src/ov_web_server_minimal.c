@@ -49,6 +49,8 @@ struct ov_web_server_minimal {
 
     /* dedicated private registry for formats */
     ov_file_format_registry *formats;
+
+    ov_http_asset_cache *assets;
 };
 
 /*
@@ -114,6 +116,118 @@ error:
 
 /*----------------------------------------------------------------------------*/
 
+static bool answer_asset(ov_web_server_minimal *self, ov_file_format_desc fmt,
+                         const ov_http_message *request, const char *path,
+                         int socket, bool head) {
+
+    OV_ASSERT(self);
+    OV_ASSERT(request);
+    OV_ASSERT(path);
+
+    ov_http_message *msg = NULL;
+
+    uint8_t *buffer = NULL;
+    size_t size = 0;
+
+    const ov_http_asset *asset = ov_http_asset_cache_get(self->assets, path);
+
+    if (!asset) {
+        ov_log_error("Failed to read file %s", path);
+        goto error;
+    }
+
+    ov_http_asset_encoding encoding =
+        ov_http_asset_select_encoding(asset, request);
+
+    if (ov_http_asset_not_modified(asset, encoding, request)) {
+
+        msg = ov_http_create_status_string(request->config, request->version,
+                                           304, OV_HTTP_NOT_MODIFIED);
+
+        if (!msg)
+            goto error;
+
+        if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER, "openvocs"))
+            goto error;
+
+        if (!ov_http_message_set_date(msg))
+            goto error;
+
+        if (!ov_http_asset_add_header(msg, asset, encoding))
+            goto error;
+
+        if (!ov_http_message_close_header(msg))
+            goto error;
+
+        goto send;
+    }
+
+    ov_memory_pointer content = asset->variant[encoding].content;
+
+    if (!asset->loaded) {
+
+        /* file too large for the cache, read from disk */
+
+        content = (ov_memory_pointer){.length = asset->size};
+
+        if (!head) {
+
+            if (OV_FILE_SUCCESS != ov_file_read(path, &buffer, &size)) {
+                ov_log_error("Failed to read file %s", path);
+                goto error;
+            }
+
+            content = (ov_memory_pointer){.start = buffer, .length = size};
+        }
+    }
+
+    msg = ov_http_create_status_string(request->config, request->version, 200,
+                                       OV_HTTP_OK);
+
+    if (!msg)
+        goto error;
+
+    if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER, "openvocs"))
+        goto error;
+
+    if (!ov_http_message_add_content_type(msg, fmt.mime,
+                                          asset->utf8 ? "utf-8" : NULL))
+        goto error;
+
+    if (!ov_http_message_set_date(msg))
+        goto error;
+
+    if (!ov_http_message_set_content_length(msg, content.length))
+        goto error;
+
+    if (!ov_http_message_add_header_string(msg, "Accept-Ranges", "bytes"))
+        goto error;
+
+    if (!ov_http_asset_add_header(msg, asset, encoding))
+        goto error;
+
+    if (!ov_http_message_close_header(msg))
+        goto error;
+
+    if (!head && !ov_http_message_add_body(msg, content))
+        goto error;
+
+send:
+
+    if (!ov_web_server_send(self->core, socket, msg->buffer))
+        goto error;
+
+    buffer = ov_data_pointer_free(buffer);
+    msg = ov_http_message_free(msg);
+    return true;
+error:
+    buffer = ov_data_pointer_free(buffer);
+    msg = ov_http_message_free(msg);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool answer_head_range(ov_web_server_minimal *self,
                               ov_file_format_desc fmt,
                               const ov_http_message *request, const char *path,
@@ -212,12 +326,6 @@ error:
 bool answer_head(ov_web_server_minimal *self, int socket,
                  ov_file_format_desc fmt, const ov_http_message *request) {
 
-    // ov_format *format = NULL;
-    ov_http_message *msg = NULL;
-
-    uint8_t *buffer = NULL;
-    size_t size = 0;
-
     if (!self || (socket < 0) || !request)
         goto error;
 
@@ -247,62 +355,8 @@ bool answer_head(ov_web_server_minimal *self, int socket,
     if (range)
         return answer_head_range(self, fmt, request, path, range, socket);
 
-    if (OV_FILE_SUCCESS != ov_file_read(path, &buffer, &size)) {
-        ov_log_error("Failed to read file %s", path);
-        goto error;
-    }
-
-    if (request) {
-
-        msg = ov_http_create_status_string(request->config, request->version,
-                                           200, OV_HTTP_OK);
-
-    } else {
-
-        msg = ov_http_create_status_string(
-            self->config.http_message,
-            (ov_http_version){.major = 1, .minor = 1}, 200, OV_HTTP_OK);
-    }
-
-    if (!msg)
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER, "openvocs"))
-        goto error;
-
-    if (ov_file_encoding_is_utf8(path)) {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, "utf-8"))
-            goto error;
-
-    } else {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, NULL))
-            goto error;
-    }
-
-    if (!ov_http_message_set_date(msg))
-        goto error;
-
-    if (!ov_http_message_set_content_length(msg, size))
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, "Accept-Ranges", "bytes"))
-        goto error;
-
-    if (!ov_http_message_close_header(msg))
-        goto error;
-
-    if (!ov_web_server_send(self->core, socket, msg->buffer))
-        goto error;
-
-    buffer = ov_data_pointer_free(buffer);
-    msg = ov_http_message_free(msg);
-    return true;
+    return answer_asset(self, fmt, request, path, socket, true);
 error:
-    // format = ov_format_close(format);
-    buffer = ov_data_pointer_free(buffer);
-    msg = ov_http_message_free(msg);
     return false;
 }
 
@@ -469,12 +523,6 @@ error:
 bool answer_get(ov_web_server_minimal *self, int socket,
                 ov_file_format_desc fmt, const ov_http_message *request) {
 
-    // ov_format *format = NULL;
-    ov_http_message *msg = NULL;
-
-    uint8_t *buffer = NULL;
-    size_t size = 0;
-
     if (!self || (socket < 0) || !request)
         goto error;
 
@@ -511,66 +559,8 @@ bool answer_get(ov_web_server_minimal *self, int socket,
     if (range)
         return answer_get_range(self, fmt, request, path, range, socket);
 
-    if (OV_FILE_SUCCESS != ov_file_read(path, &buffer, &size)) {
-        ov_log_error("Failed to read file %s", path);
-        goto error;
-    }
-
-    if (request) {
-
-        msg = ov_http_create_status_string(request->config, request->version,
-                                           200, OV_HTTP_OK);
-
-    } else {
-
-        msg = ov_http_create_status_string(
-            self->config.http_message,
-            (ov_http_version){.major = 1, .minor = 1}, 200, OV_HTTP_OK);
-    }
-
-    if (!msg)
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, OV_KEY_SERVER, "openvocs"))
-        goto error;
-
-    if (ov_file_encoding_is_utf8(path)) {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, "utf-8"))
-            goto error;
-
-    } else {
-
-        if (!ov_http_message_add_content_type(msg, fmt.mime, NULL))
-            goto error;
-    }
-
-    if (!ov_http_message_set_date(msg))
-        goto error;
-
-    if (!ov_http_message_set_content_length(msg, size))
-        goto error;
-
-    if (!ov_http_message_add_header_string(msg, "Accept-Ranges", "bytes"))
-        goto error;
-
-    if (!ov_http_message_close_header(msg))
-        goto error;
-
-    if (!ov_http_message_add_body(
-            msg, (ov_memory_pointer){.start = buffer, .length = size}))
-        goto error;
-
-    if (!ov_web_server_send(self->core, socket, msg->buffer))
-        goto error;
-
-    buffer = ov_data_pointer_free(buffer);
-    msg = ov_http_message_free(msg);
-    return true;
+    return answer_asset(self, fmt, request, path, socket, false);
 error:
-    // format = ov_format_close(format);
-    buffer = ov_data_pointer_free(buffer);
-    msg = ov_http_message_free(msg);
     return false;
 }
 
@@ -718,6 +708,10 @@ ov_web_server_minimal_create(ov_web_server_config config) {
 
     self->config = config;
 
+    self->assets = ov_http_asset_cache_create(config.cache);
+    if (!self->assets)
+        goto error;
+
     self->core = ov_web_server_create(config);
     if (!self->core) {
         ov_log_error("Failed to create webserver core.");
@@ -746,6 +740,7 @@ ov_web_server_minimal *ov_web_server_minimal_free(ov_web_server_minimal *self) {
         goto error;
 
     self->core = ov_web_server_free(self->core);
+    self->assets = ov_http_asset_cache_free(self->assets);
     self = ov_data_pointer_free(self);
     return NULL;
 error:
@@ -24,6 +24,10 @@
 
         Returns an event loop that best suits the OV_ARCH architecture
 
+        On linux, the io_uring based loop is used if the environment
+        variable OV_EVENT_LOOP is set to "io_uring" and the kernel
+        supports it, the epoll based loop otherwise.
+
         ------------------------------------------------------------------------
 */
 #ifndef ov_arch_event_loop_h
@@ -31,6 +35,8 @@
 
 #include <ov_base/ov_event_loop.h>
 
+#define OV_OS_EVENT_LOOP_ENV "OV_EVENT_LOOP"
+
 ov_event_loop *ov_os_event_loop(ov_event_loop_config config);
 
 #endif /* ov_arch_event_loop_h */
@@ -27,9 +27,12 @@
 
 #include "../include/ov_os_event_loop.h"
 #include <ov_arch/ov_arch.h>
+#include <stdlib.h>
+#include <string.h>
 
 #if OV_ARCH == OV_LINUX
 
+#include <ov_os_linux/ov_event_loop_io_uring.h>
 #include <ov_os_linux/ov_event_loop_linux.h>
 
 #define EVENT_LOOP_CREATOR ov_event_loop_linux
@@ -50,6 +53,25 @@
 
 ov_event_loop *ov_os_event_loop(ov_event_loop_config config) {
 
+#if OV_ARCH == OV_LINUX
+
+    char const *requested = getenv(OV_OS_EVENT_LOOP_ENV);
+
+    if ((0 != requested) && (0 == strcmp(requested, "io_uring"))) {
+
+        ov_event_loop *loop = ov_event_loop_io_uring(config);
+
+        if (0 != loop) {
+            ov_log_info("Using ov_event_loop_io_uring");
+            return loop;
+        }
+
+        ov_log_warning("io_uring not supported - falling back to "
+                       EVENT_LOOP_CREATOR_STR);
+    }
+
+#endif
+
     ov_log_info("Using " EVENT_LOOP_CREATOR_STR);
     return EVENT_LOOP_CREATOR(config);
 }
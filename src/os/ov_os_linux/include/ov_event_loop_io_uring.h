@@ -0,0 +1,62 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_event_loop_io_uring.h
+
+        @date           2026-10-18
+
+        @ingroup        ov_event_loop
+
+        @see            ov_event_loop
+
+        ov_event_loop implementation on top of io_uring.
+
+        Sockets are watched by poll requests, timers are ring timeouts,
+        no timerfds involved. All requests queued while processing some
+        iteration, e.g. re-arming the polls of the sockets just served,
+        are submitted together with waiting for the next completions -
+        a single system call per iteration.
+
+        The loop keeps the level triggered semantics of ov_event_loop:
+        a socket not drained within its callback is reported again.
+
+        Requires a kernel supporting io_uring with IORING_FEAT_EXT_ARG
+        (Linux 5.11). ov_event_loop_io_uring returns NULL otherwise,
+        use ov_event_loop_linux then.
+
+        BEWARE: Just as the default implementation, this event loop is
+
+                NOT THREAD SAFE!
+
+        ------------------------------------------------------------------------
+*/
+#if defined __linux__
+
+#ifndef ov_event_loop_io_uring_h
+#define ov_event_loop_io_uring_h
+
+#include <ov_base/ov_event_loop.h>
+
+ov_event_loop *ov_event_loop_io_uring(ov_event_loop_config config);
+
+#endif /* ov_event_loop_io_uring_h */
+
+#endif /* linux */
@@ -0,0 +1,1365 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_event_loop_io_uring.c
+
+        @date           2026-10-18
+
+        @ingroup        ov_event_loop_linux
+
+        @brief          io_uring version of ov_event_loop_linux
+
+        Talks to the kernel by system calls directly, no liburing.
+
+        Sockets are polled one shot and re-armed after their callback.
+        Multishot polls would save the re-arming, but report edges only,
+        while users of ov_event_loop rely on being called again for
+        data left within the socket.
+
+        Each request carries its kind, the generation of its slot and
+        the slot index as user_data. Unsetting some socket or timer
+        increments the generation of the slot, so completions of
+        requests cancelled in between are recognised and dropped.
+
+        ------------------------------------------------------------------------
+*/
+
+#if defined __linux__
+
+#include "../include/ov_event_loop_io_uring.h"
+
+#include <limits.h>
+#include <ov_base/ov_time.h>
+#include <ov_base/ov_utils.h>
+#include <time.h>
+
+/* Thats the linux specific part ... */
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+/*----------------------------------------------------------------------------*/
+
+static const uint16_t IMPL_IO_URING_LOOP_TYPE = 0xf002;
+
+static const uint8_t IMPL_WAKEUP_SIGNAL = (uint8_t)'w';
+
+#define IMPL_RING_ENTRIES_MIN 64
+#define IMPL_RING_ENTRIES_MAX 4096
+
+typedef enum {
+
+    REQUEST_IGNORE = 0,
+    REQUEST_POLL = 1,
+    REQUEST_TIMER = 2
+
+} RequestType;
+
+/*----------------------------------------------------------------------------*/
+
+struct callback {
+
+    int fd;
+    uint32_t generation;
+    uint32_t poll_events;
+    bool armed;
+
+    bool (*callback)(int socket_fd, uint8_t events, void *data);
+    void *data;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct timer {
+
+    bool active;
+    uint32_t generation;
+
+    /* absolute, read by the kernel on submission */
+    struct __kernel_timespec expiry;
+
+    bool (*callback)(uint32_t id, void *data);
+    void *data;
+};
+
+/*----------------------------------------------------------------------------*/
+
+struct ring {
+
+    int fd;
+
+    void *sq_ptr;
+    size_t sq_size;
+
+    void *cq_ptr;
+    size_t cq_size;
+
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+
+    struct {
+
+        _Atomic unsigned *head;
+        _Atomic unsigned *tail;
+        unsigned mask;
+        unsigned entries;
+
+        /* SQEs filled, published to the kernel on submission */
+        unsigned tail_local;
+
+    } sq;
+
+    struct {
+
+        _Atomic unsigned *head;
+        _Atomic unsigned *tail;
+        unsigned mask;
+        struct io_uring_cqe *cqes;
+
+    } cq;
+};
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    ov_event_loop public;
+    ov_event_loop_config config;
+
+    bool running;
+    pthread_t thread;
+
+    int wakeup_fd;
+
+    struct ring ring;
+
+    /* Guards the submission queue, callbacks might be set from other
+     * threads while the loop waits for completions */
+    pthread_mutex_t sq_lock;
+
+    struct callback *callbacks;
+    size_t max_callbacks;
+
+    struct {
+
+        struct timer *slots;
+
+        uint32_t *free;
+        size_t free_count;
+
+    } timers;
+
+} Loop;
+
+/******************************************************************************
+ *                                 CALLBACKS
+ ******************************************************************************/
+
+static ov_event_loop *impl_free(ov_event_loop *self);
+
+static bool impl_is_running(const ov_event_loop *self);
+
+static bool impl_stop(ov_event_loop *self);
+
+static bool impl_run(ov_event_loop *self, uint64_t max);
+
+static bool impl_callback_set(ov_event_loop *self, int socket, uint8_t events,
+                              void *data,
+                              bool (*callback)(int socket_fd, uint8_t events,
+                                               void *data));
+
+static bool impl_callback_unset(ov_event_loop *self, int socket,
+                                void **userdata);
+
+static uint32_t impl_timer_set(ov_event_loop *self, uint64_t relative_usec,
+                               void *data,
+                               bool (*callback)(uint32_t id, void *data));
+
+static bool impl_timer_unset(ov_event_loop *self, uint32_t id,
+                             void **userdata);
+
+/*----------------------------------------------------------------------------*/
+
+static Loop *cast_to_loop(const void *x) {
+
+    if (0 == x)
+        return 0;
+    if (0 == ov_event_loop_cast(x))
+        return 0;
+    if (IMPL_IO_URING_LOOP_TYPE != ((ov_event_loop *)x)->type)
+        return 0;
+
+    return (Loop *)x;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t request_id(RequestType type, uint32_t generation,
+                          size_t index) {
+
+    return ((uint64_t)type << 62) |
+           ((uint64_t)(generation & 0x3fffffff) << 32) |
+           (uint64_t)(uint32_t)index;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t to_poll_events(uint8_t ov_flag) {
+
+    uint32_t events = 0;
+
+    if (ov_flag & OV_EVENT_IO_IN)
+        events |= POLLIN | POLLPRI;
+
+    if (ov_flag & OV_EVENT_IO_OUT)
+        events |= POLLOUT;
+
+    if (ov_flag & OV_EVENT_IO_CLOSE)
+        events |= POLLHUP;
+
+    if (ov_flag & OV_EVENT_IO_ERR)
+        events |= POLLERR;
+
+    return events;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint8_t from_poll_events(uint32_t events) {
+
+    uint8_t ov_flag = 0;
+
+    if (events & (POLLIN | POLLPRI))
+        ov_flag |= OV_EVENT_IO_IN;
+
+    if (events & POLLOUT)
+        ov_flag |= OV_EVENT_IO_OUT;
+
+    if (events & POLLHUP)
+        ov_flag |= OV_EVENT_IO_CLOSE;
+
+    if (events & (POLLERR | POLLNVAL))
+        ov_flag |= OV_EVENT_IO_ERR;
+
+    return ov_flag;
+}
+
+/******************************************************************************
+ *                                    RING
+ ******************************************************************************/
+
+static int ring_enter(struct ring *ring, unsigned to_submit,
+                      unsigned min_complete, unsigned flags, void *arg,
+                      size_t arg_size) {
+
+    return (int)syscall(__NR_io_uring_enter, ring->fd, to_submit, min_complete,
+                        flags, arg, arg_size);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void ring_clear(struct ring *ring) {
+
+    if (0 != ring->sqes)
+        munmap(ring->sqes, ring->sqes_size);
+
+    if ((0 != ring->cq_ptr) && (ring->cq_ptr != ring->sq_ptr))
+        munmap(ring->cq_ptr, ring->cq_size);
+
+    if (0 != ring->sq_ptr)
+        munmap(ring->sq_ptr, ring->sq_size);
+
+    if (-1 < ring->fd)
+        close(ring->fd);
+
+    memset(ring, 0, sizeof(struct ring));
+    ring->fd = -1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *ring_map(int fd, size_t size, off_t offset) {
+
+    void *ptr =
+        mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+
+    if (MAP_FAILED == ptr)
+        return 0;
+
+    return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool ring_init(struct ring *ring, unsigned entries) {
+
+    OV_ASSERT(0 != ring);
+
+    struct io_uring_params params = {0};
+
+    memset(ring, 0, sizeof(struct ring));
+
+    ring->fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+
+    if (0 > ring->fd) {
+
+        ov_log_error("io_uring not available: %s", strerror(errno));
+        goto error;
+    }
+
+    /* EXT_ARG allows waiting with timeout without some timeout request,
+     * NODROP keeps completions if the completion queue overflows */
+
+    if (!(params.features & IORING_FEAT_EXT_ARG) ||
+        !(params.features & IORING_FEAT_NODROP)) {
+
+        ov_log_error("io_uring of kernel lacks required features");
+        goto error;
+    }
+
+    ring->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+
+        if (ring->cq_size > ring->sq_size)
+            ring->sq_size = ring->cq_size;
+
+        ring->cq_size = ring->sq_size;
+    }
+
+    ring->sq_ptr = ring_map(ring->fd, ring->sq_size, IORING_OFF_SQ_RING);
+
+    if (0 == ring->sq_ptr)
+        goto error;
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+
+        ring->cq_ptr = ring->sq_ptr;
+
+    } else {
+
+        ring->cq_ptr = ring_map(ring->fd, ring->cq_size, IORING_OFF_CQ_RING);
+    }
+
+    if (0 == ring->cq_ptr)
+        goto error;
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = ring_map(ring->fd, ring->sqes_size, IORING_OFF_SQES);
+
+    if (0 == ring->sqes)
+        goto error;
+
+    uint8_t *sq = ring->sq_ptr;
+    uint8_t *cq = ring->cq_ptr;
+
+    ring->sq.head = (_Atomic unsigned *)(sq + params.sq_off.head);
+    ring->sq.tail = (_Atomic unsigned *)(sq + params.sq_off.tail);
+    ring->sq.mask = *(unsigned *)(sq + params.sq_off.ring_mask);
+    ring->sq.entries = *(unsigned *)(sq + params.sq_off.ring_entries);
+    ring->sq.tail_local = atomic_load(ring->sq.tail);
+
+    /* SQEs are always used in order */
+    unsigned *array = (unsigned *)(sq + params.sq_off.array);
+
+    for (unsigned i = 0; i < ring->sq.entries; ++i) {
+        array[i] = i;
+    }
+
+    ring->cq.head = (_Atomic unsigned *)(cq + params.cq_off.head);
+    ring->cq.tail = (_Atomic unsigned *)(cq + params.cq_off.tail);
+    ring->cq.mask = *(unsigned *)(cq + params.cq_off.ring_mask);
+    ring->cq.cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+    return true;
+
+error:
+
+    ring_clear(ring);
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static unsigned ring_publish_unsafe(struct ring *ring) {
+
+    atomic_store_explicit(ring->sq.tail, ring->sq.tail_local,
+                          memory_order_release);
+
+    return ring->sq.tail_local -
+           atomic_load_explicit(ring->sq.head, memory_order_acquire);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static struct io_uring_sqe *ring_get_sqe_unsafe(struct ring *ring) {
+
+    unsigned head = atomic_load_explicit(ring->sq.head, memory_order_acquire);
+
+    if (ring->sq.tail_local - head >= ring->sq.entries) {
+
+        /* queue full - submit without waiting for completions */
+
+        unsigned to_submit = ring_publish_unsafe(ring);
+
+        if (0 > ring_enter(ring, to_submit, 0, 0, 0, 0)) {
+
+            ov_log_error("Could not submit to io_uring: %s", strerror(errno));
+            return 0;
+        }
+
+        head = atomic_load_explicit(ring->sq.head, memory_order_acquire);
+
+        if (ring->sq.tail_local - head >= ring->sq.entries)
+            return 0;
+    }
+
+    struct io_uring_sqe *sqe =
+        ring->sqes + (ring->sq.tail_local & ring->sq.mask);
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    ring->sq.tail_local += 1;
+
+    return sqe;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool queue_request(Loop *loop, uint8_t opcode, int fd, uint64_t addr,
+                          uint32_t flags, uint64_t data) {
+
+    OV_ASSERT(0 != loop);
+
+    pthread_mutex_lock(&loop->sq_lock);
+
+    struct io_uring_sqe *sqe = ring_get_sqe_unsafe(&loop->ring);
+
+    if (0 != sqe) {
+
+        sqe->opcode = opcode;
+        sqe->fd = fd;
+        sqe->addr = addr;
+        sqe->user_data = data;
+
+        switch (opcode) {
+
+            case IORING_OP_POLL_ADD:
+                sqe->poll32_events = flags;
+                break;
+
+            case IORING_OP_TIMEOUT:
+                sqe->len = 1;
+                sqe->timeout_flags = flags;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    pthread_mutex_unlock(&loop->sq_lock);
+
+    if (0 == sqe) {
+        ov_log_error("io_uring submission queue exhausted");
+        return false;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool wakeup_unsafe(Loop *restrict loop) {
+
+    OV_ASSERT(0 != loop);
+
+    if (0 == loop->callbacks)
+        return false;
+
+    int wakeup_fd = loop->wakeup_fd;
+
+    OV_ASSERT(-1 < wakeup_fd);
+
+    return sizeof(IMPL_WAKEUP_SIGNAL) ==
+           send(wakeup_fd, &IMPL_WAKEUP_SIGNAL, sizeof(IMPL_WAKEUP_SIGNAL), 0);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void notify_unsafe(Loop *loop) {
+
+    /* Requests queued from within the loop are submitted with the next
+     * wait anyway. Some other thread has to interrupt the wait. */
+
+    if (loop->running && !pthread_equal(loop->thread, pthread_self()))
+        wakeup_unsafe(loop);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool read_and_drop(int fd, uint8_t events, void *data) {
+
+    UNUSED(events);
+    UNUSED(data);
+
+    char buf[100];
+    return -1 < read(fd, buf, sizeof(buf) / sizeof(buf[0]));
+}
+
+/******************************************************************************
+ *                            CALLBACK REGISTERING
+ ******************************************************************************/
+
+/**
+ * Searches callback array for fd and returns hit, or empty callback.
+ * You have to check callback->fd!
+ */
+static struct callback *get_callback_for_fd_unsafe(Loop *restrict loop,
+                                                   int fd) {
+
+    OV_ASSERT(0 != loop);
+
+    if (0 > fd)
+        return 0;
+
+    /* loop->callbacks array is organized as a simple hash table */
+
+    size_t max_callbacks = loop->max_callbacks;
+
+    size_t start_index = fd % max_callbacks;
+
+    struct callback *cb = loop->callbacks + start_index;
+
+    if ((fd == cb->fd) || (0 > cb->fd))
+        return cb;
+
+    for (size_t i = start_index + 1; i < max_callbacks; ++i) {
+
+        cb = loop->callbacks + i;
+        if ((fd == cb->fd) || (0 > cb->fd))
+            return cb;
+    }
+
+    for (size_t i = 0; i < 1 + start_index; ++i) {
+
+        cb = loop->callbacks + i;
+        if ((fd == cb->fd) || (0 > cb->fd))
+            return cb;
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool arm_poll_unsafe(Loop *loop, struct callback *cb) {
+
+    size_t index = cb - loop->callbacks;
+
+    cb->armed = queue_request(loop, IORING_OP_POLL_ADD, cb->fd, 0,
+                              cb->poll_events,
+                              request_id(REQUEST_POLL, cb->generation, index));
+
+    return cb->armed;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool release_fd_unsafe(Loop *loop, int fd, void **attached_data) {
+
+    OV_ASSERT(0 != loop);
+
+    if (0 > fd)
+        return false;
+
+    struct callback *cb = get_callback_for_fd_unsafe(loop, fd);
+
+    if ((0 == cb) || (fd != cb->fd)) {
+        return true;
+    }
+
+    size_t index = cb - loop->callbacks;
+
+    if (cb->armed) {
+
+        queue_request(loop, IORING_OP_POLL_REMOVE, -1,
+                      request_id(REQUEST_POLL, cb->generation, index), 0,
+                      request_id(REQUEST_IGNORE, 0, 0));
+    }
+
+    void *data = cb->data;
+    uint32_t generation = cb->generation + 1;
+
+    memset(cb, 0, sizeof(struct callback));
+    cb->fd = -1;
+    cb->generation = generation;
+
+    if (0 != attached_data) {
+        *attached_data = data;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool register_fd(Loop *loop, int fd, uint32_t events, void *data,
+                        bool (*callback)(int socket_fd, uint8_t events,
+                                         void *data)) {
+
+    struct callback *cb = 0;
+
+    if (0 == loop) {
+        goto error;
+    }
+
+    if (0 == events) {
+        ov_log_error("FAILURE callback listening "
+                     "without events "
+                     "is NOT SUPPORTED.");
+        goto error;
+    }
+
+    if (0 == callback) {
+        ov_log_error("Wont register without callback");
+        goto error;
+    }
+
+    cb = get_callback_for_fd_unsafe(loop, fd);
+
+    if (0 == cb) {
+        ov_log_error("Could not register socket %i on loop", fd);
+        goto error;
+    }
+
+    if (fd == cb->fd) {
+        release_fd_unsafe(loop, fd, 0);
+    }
+
+    cb->fd = fd;
+    cb->data = data;
+    cb->callback = callback;
+    cb->poll_events = events;
+
+    if (!arm_poll_unsafe(loop, cb)) {
+
+        ov_log_error("Could not add new fd to io_uring: %i", fd);
+        release_fd_unsafe(loop, fd, 0);
+        goto error;
+    }
+
+    notify_unsafe(loop);
+    return true;
+
+error:
+
+    return false;
+}
+
+/******************************************************************************
+ *                               TIMER HANDLING
+ ******************************************************************************/
+
+static void release_timer_unsafe(Loop *loop, size_t index) {
+
+    struct timer *timer = loop->timers.slots + index;
+
+    OV_ASSERT(timer->active);
+
+    timer->active = false;
+    timer->generation += 1;
+    timer->callback = 0;
+    timer->data = 0;
+
+    loop->timers.free[loop->timers.free_count] = index;
+    loop->timers.free_count += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool arm_timer_unsafe(Loop *loop, size_t index) {
+
+    struct timer *timer = loop->timers.slots + index;
+
+    return queue_request(loop, IORING_OP_TIMEOUT, -1,
+                         (uint64_t)(uintptr_t)&timer->expiry,
+                         IORING_TIMEOUT_ABS,
+                         request_id(REQUEST_TIMER, timer->generation, index));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool handle_timer(Loop *loop, size_t index, uint32_t generation,
+                         int32_t result) {
+
+    if (index >= loop->config.max.timers)
+        return false;
+
+    struct timer *timer = loop->timers.slots + index;
+
+    if ((!timer->active) ||
+        ((timer->generation & 0x3fffffff) != generation)) {
+
+        /* unset in between */
+        return true;
+    }
+
+    if (-ECANCELED == result) {
+
+        /* cancelled by the kernel as the submitting thread exited */
+        return arm_timer_unsafe(loop, index);
+    }
+
+    bool (*callback)(uint32_t id, void *data) = timer->callback;
+    void *data = timer->data;
+
+    release_timer_unsafe(loop, index);
+
+    if (-ETIME != result) {
+
+        ov_log_error("Timer %zu failed: %s", index + 1, strerror(-result));
+        return false;
+    }
+
+    return callback(index + 1, data);
+}
+
+/******************************************************************************
+ *                           I/O CALLBACK EXECUTION
+ ******************************************************************************/
+
+static bool handle_poll(Loop *loop, size_t index, uint32_t generation,
+                        int32_t result) {
+
+    if (index >= loop->max_callbacks)
+        return false;
+
+    struct callback *cb = loop->callbacks + index;
+
+    if ((0 > cb->fd) || ((cb->generation & 0x3fffffff) != generation)) {
+
+        /* unset or replaced in between */
+        return true;
+    }
+
+    cb->armed = false;
+
+    int fd = cb->fd;
+    uint32_t current = cb->generation;
+
+    uint8_t events = 0;
+    bool closed = false;
+
+    switch (result) {
+
+        case -ECANCELED:
+
+            /* cancelled by the kernel as the submitting thread exited */
+            return arm_poll_unsafe(loop, cb);
+
+        case -EBADF:
+
+            /* closed without unset, epoll forgets such fds silently */
+            return release_fd_unsafe(loop, fd, 0);
+
+        default:
+            break;
+    }
+
+    if (0 > result) {
+
+        ov_log_error("Polling %i failed: %s", fd, strerror(-result));
+        events = OV_EVENT_IO_ERR;
+        closed = true;
+
+    } else {
+
+        events = from_poll_events((uint32_t)result);
+        closed = (0 != (events & OV_EVENT_IO_CLOSE));
+    }
+
+    bool retval = false;
+
+    if ((0 != events) && (0 != cb->callback))
+        retval = cb->callback(fd, events, cb->data);
+
+    /* the callback might have unset or replaced the fd */
+
+    if ((fd != cb->fd) || (current != cb->generation))
+        return retval;
+
+    if (closed) {
+
+        release_fd_unsafe(loop, fd, 0);
+
+    } else {
+
+        arm_poll_unsafe(loop, cb);
+    }
+
+    return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void handle_completion(Loop *loop, struct io_uring_cqe *cqe) {
+
+    RequestType type = (RequestType)(cqe->user_data >> 62);
+    uint32_t generation = (cqe->user_data >> 32) & 0x3fffffff;
+    size_t index = (uint32_t)cqe->user_data;
+
+    switch (type) {
+
+        case REQUEST_POLL:
+            handle_poll(loop, index, generation, cqe->res);
+            break;
+
+        case REQUEST_TIMER:
+            handle_timer(loop, index, generation, cqe->res);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t process_completions(Loop *loop) {
+
+    struct ring *ring = &loop->ring;
+    size_t processed = 0;
+
+    while (true) {
+
+        unsigned head =
+            atomic_load_explicit(ring->cq.head, memory_order_relaxed);
+        unsigned tail =
+            atomic_load_explicit(ring->cq.tail, memory_order_acquire);
+
+        if (head == tail)
+            break;
+
+        /* copy out - callbacks might cause further completions */
+        struct io_uring_cqe cqe = ring->cq.cqes[head & ring->cq.mask];
+
+        atomic_store_explicit(ring->cq.head, head + 1, memory_order_release);
+
+        if (0 < loop->public.log_fd) {
+            dprintf(loop->public.log_fd,
+                    "io_uring: completion %" PRIx64 " result %i\n",
+                    (uint64_t)cqe.user_data, cqe.res);
+        }
+
+        handle_completion(loop, &cqe);
+        ++processed;
+    }
+
+    return processed;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool submit_and_wait(Loop *loop, uint64_t timeout_usec) {
+
+    struct __kernel_timespec ts = {
+
+        .tv_sec = timeout_usec / 1000 / 1000,
+        .tv_nsec = 1000 * (timeout_usec % (1000 * 1000)),
+    };
+
+    struct io_uring_getevents_arg arg = {
+
+        .ts = (uint64_t)(uintptr_t)&ts,
+    };
+
+    pthread_mutex_lock(&loop->sq_lock);
+    unsigned to_submit = ring_publish_unsafe(&loop->ring);
+    pthread_mutex_unlock(&loop->sq_lock);
+
+    int r = ring_enter(&loop->ring, to_submit, 1,
+                       IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg,
+                       sizeof(arg));
+
+    if (0 <= r)
+        return true;
+
+    switch (errno) {
+
+        case ETIME:
+        case EINTR:
+        case EAGAIN:
+        case EBUSY:
+            return true;
+
+        default:
+            ov_log_error("I/O error occured: %s", strerror(errno));
+            return false;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t get_rel_timeout_usecs(uint64_t start_usec,
+                                      uint64_t rel_timeout_usecs) {
+
+    uint64_t now_usec = ov_time_get_current_time_usecs();
+
+    if (now_usec - start_usec >= rel_timeout_usecs)
+        return 0;
+
+    return rel_timeout_usecs - (now_usec - start_usec);
+}
+
+/******************************************************************************
+ *                                   CREATE
+ ******************************************************************************/
+
+static void loop_clear(Loop *loop) {
+
+    if (0 != loop->callbacks) {
+
+        for (size_t i = 0; i < loop->max_callbacks; ++i) {
+
+            int fd = loop->callbacks[i].fd;
+
+            if (release_fd_unsafe(loop, fd, 0)) {
+                close(fd);
+            }
+        }
+
+        free(loop->callbacks);
+        loop->callbacks = 0;
+    }
+
+    /* closing the ring cancels all requests pending */
+    ring_clear(&loop->ring);
+
+    if (0 != loop->timers.slots) {
+        free(loop->timers.slots);
+        loop->timers.slots = 0;
+    }
+
+    if (0 != loop->timers.free) {
+        free(loop->timers.free);
+        loop->timers.free = 0;
+    }
+
+    pthread_mutex_destroy(&loop->sq_lock);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool loop_init(Loop *loop, ov_event_loop_config config) {
+
+    OV_ASSERT(0 != loop);
+
+    memset(loop, 0, sizeof(Loop));
+
+    loop->ring.fd = -1;
+    loop->wakeup_fd = -1;
+
+    pthread_mutex_init(&loop->sq_lock, 0);
+
+    if (!ov_event_loop_set_type(&loop->public, IMPL_IO_URING_LOOP_TYPE))
+        goto error;
+
+    loop->config = config;
+
+    loop->max_callbacks = 2;
+    loop->max_callbacks += loop->config.max.sockets;
+
+    loop->callbacks = calloc(loop->max_callbacks, sizeof(struct callback));
+
+    if (0 == loop->callbacks) {
+        ov_log_error("Failed to allocate bytes for callbacks.");
+        goto error;
+    }
+
+    for (size_t i = 0; i < loop->max_callbacks; i++) {
+        loop->callbacks[i].fd = -1;
+    }
+
+    size_t num_timers = loop->config.max.timers;
+
+    loop->timers.slots = calloc(num_timers, sizeof(struct timer));
+    loop->timers.free = calloc(num_timers, sizeof(uint32_t));
+
+    if ((0 == loop->timers.slots) || (0 == loop->timers.free)) {
+        ov_log_error("Failed to allocate bytes for timers.");
+        goto error;
+    }
+
+    /* lowest ids first */
+    for (size_t i = 0; i < num_timers; ++i) {
+        loop->timers.free[i] = num_timers - 1 - i;
+    }
+
+    loop->timers.free_count = num_timers;
+
+    size_t entries = loop->max_callbacks + num_timers;
+
+    if (entries < IMPL_RING_ENTRIES_MIN)
+        entries = IMPL_RING_ENTRIES_MIN;
+
+    if (entries > IMPL_RING_ENTRIES_MAX)
+        entries = IMPL_RING_ENTRIES_MAX;
+
+    if (!ring_init(&loop->ring, entries))
+        goto error;
+
+    loop->running = false;
+
+    loop->public.free = impl_free;
+
+    loop->public.is_running = impl_is_running;
+    loop->public.stop = impl_stop;
+    loop->public.run = impl_run;
+
+    loop->public.callback.set = impl_callback_set;
+    loop->public.callback.unset = impl_callback_unset;
+
+    loop->public.timer.set = impl_timer_set;
+    loop->public.timer.unset = impl_timer_unset;
+
+    /*
+     *      Use a wakeup socket pair to interrupt waiting for
+     *      completions, e.g. on stop.
+     */
+
+    int wakeup_fds[2] = {0};
+
+    if (0 != socketpair(AF_LOCAL, SOCK_STREAM, 0, wakeup_fds))
+        goto error;
+
+    if (!impl_callback_set((ov_event_loop *)loop, wakeup_fds[0],
+                           OV_EVENT_IO_IN, 0, read_and_drop) ||
+        !impl_callback_set((ov_event_loop *)loop, wakeup_fds[1],
+                           OV_EVENT_IO_IN, 0, read_and_drop)) {
+
+        ov_log_error("Could not register wakeup fd");
+        close(wakeup_fds[0]);
+        close(wakeup_fds[1]);
+        goto error;
+    }
+
+    loop->wakeup_fd = wakeup_fds[0];
+
+    loop->public.log_fd = -1;
+
+    return true;
+
+error:
+
+    loop_clear(loop);
+    return false;
+}
+
+/*---------------------------------------------------------------------------*/
+
+ov_event_loop *ov_event_loop_io_uring(ov_event_loop_config config) {
+
+    Loop *loop = 0;
+
+    config = ov_event_loop_config_adapt_to_runtime(config);
+
+    if ((config.max.sockets < 1) || (config.max.timers < 1)) {
+        ov_log_error("Eventloop config not supported.");
+        goto error;
+    }
+
+    loop = calloc(1, sizeof(Loop));
+
+    if (0 == loop)
+        goto error;
+
+    if (!loop_init(loop, config))
+        goto error;
+
+    return (ov_event_loop *)loop;
+
+error:
+
+    if (0 != loop)
+        free(loop);
+
+    return 0;
+}
+
+/******************************************************************************
+ *                                    FREE
+ ******************************************************************************/
+
+static ov_event_loop *impl_free(ov_event_loop *self) {
+
+    Loop *loop = cast_to_loop(self);
+    if (!loop)
+        goto error;
+
+    loop->running = false;
+
+    loop_clear(loop);
+    free(loop);
+
+    return 0;
+
+error:
+    return self;
+}
+
+/******************************************************************************
+ *                                RUN CONTROL
+ ******************************************************************************/
+
+static bool impl_is_running(const ov_event_loop *self) {
+
+    Loop *loop = cast_to_loop(self);
+    if (!loop)
+        return false;
+
+    return loop->running;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool impl_stop(ov_event_loop *self) {
+
+    Loop *loop = cast_to_loop(self);
+    if (!loop)
+        return false;
+
+    loop->running = false;
+
+    return wakeup_unsafe(loop);
+}
+
+/*---------------------------------------------------------------------------*/
+
+static bool impl_run(ov_event_loop *self, uint64_t max_usecs) {
+
+    Loop *loop = cast_to_loop(self);
+
+    if (0 == loop)
+        goto error;
+
+    if (1000 > max_usecs)
+        max_usecs = 1000;
+
+    loop->thread = pthread_self();
+    loop->running = true;
+
+    uint64_t start_usecs = ov_time_get_current_time_usecs();
+
+    do {
+
+        uint64_t timeout_usecs = get_rel_timeout_usecs(start_usecs, max_usecs);
+
+        if (0 == timeout_usecs) {
+            loop->running = false;
+            break;
+        }
+
+        if (!submit_and_wait(loop, timeout_usecs))
+            goto error;
+
+        process_completions(loop);
+
+    } while (loop->running);
+
+    return true;
+
+error:
+
+    if (0 != loop)
+        loop->running = false;
+
+    return false;
+}
+
+/******************************************************************************
+ *                             CALLBACK HANDLING
+ ******************************************************************************/
+
+static bool impl_callback_set(ov_event_loop *self, int fd, uint8_t events,
+                              void *data,
+                              bool (*callback)(int socket_fd, uint8_t events,
+                                               void *data)) {
+
+    Loop *loop = cast_to_loop(self);
+
+    if (0 == loop)
+        goto error;
+
+    int so_opt = 0;
+    socklen_t so_len = sizeof(so_opt);
+
+    if (0 != getsockopt(fd, SOL_SOCKET, SO_ERROR, &so_opt, &so_len)) {
+        ov_log_error("FAILURE callback listening on socket with error "
+                     "is NOT SUPPORTED.");
+        goto error;
+    }
+
+    if (!ov_socket_ensure_nonblocking(fd)) {
+        close(fd);
+        goto error;
+    }
+
+    uint32_t poll_events = to_poll_events(events);
+
+    if (0 == poll_events)
+        goto error;
+
+    return register_fd(loop, fd, poll_events, data, callback);
+
+error:
+
+    return false;
+}
+
+/*------------------------------------------------------------------*/
+
+static bool impl_callback_unset(ov_event_loop *self, int fd, void **userdata) {
+
+    Loop *loop = cast_to_loop(self);
+
+    if (0 == loop)
+        goto error;
+
+    if (0 > fd)
+        goto error;
+
+    bool result = release_fd_unsafe(loop, fd, userdata);
+    notify_unsafe(loop);
+
+    return result;
+
+error:
+
+    return false;
+}
+
+/*------------------------------------------------------------------*/
+
+static uint32_t impl_timer_set(ov_event_loop *self, uint64_t relative_usec,
+                               void *data,
+                               bool (*callback)(uint32_t id, void *data)) {
+
+    Loop *loop = cast_to_loop(self);
+
+    if ((0 == loop) || (0 == callback)) {
+        goto error;
+    }
+
+    if (0 == loop->timers.free_count) {
+        ov_log_error("could not acquire a new timer");
+        goto error;
+    }
+
+    if (0 == relative_usec) {
+        relative_usec = 1;
+    }
+
+    struct timespec now = {0};
+
+    if (0 != clock_gettime(CLOCK_MONOTONIC, &now)) {
+        ov_log_error("Could not get current time");
+        goto error;
+    }
+
+    loop->timers.free_count -= 1;
+    size_t index = loop->timers.free[loop->timers.free_count];
+
+    struct timer *timer = loop->timers.slots + index;
+
+    uint64_t nsec = (uint64_t)now.tv_nsec + 1000 * (relative_usec % 1000000);
+
+    timer->expiry.tv_sec = now.tv_sec + relative_usec / 1000000 +
+                           nsec / 1000000000;
+    timer->expiry.tv_nsec = nsec % 1000000000;
+
+    timer->active = true;
+    timer->callback = callback;
+    timer->data = data;
+
+    if (!arm_timer_unsafe(loop, index)) {
+
+        ov_log_error("Could not queue timeout");
+        release_timer_unsafe(loop, index);
+        goto error;
+    }
+
+    notify_unsafe(loop);
+
+    return index + 1;
+
+error:
+
+    return OV_TIMER_INVALID;
+}
+
+/*------------------------------------------------------------------*/
+
+static bool impl_timer_unset(ov_event_loop *self, uint32_t id,
+                             void **userdata) {
+
+    Loop *loop = cast_to_loop(self);
+
+    if (0 == loop) {
+        ov_log_error("called with wrong argument");
+        goto error;
+    }
+
+    if ((OV_TIMER_INVALID == id) || (id > loop->config.max.timers))
+        goto error;
+
+    size_t index = id - 1;
+    struct timer *timer = loop->timers.slots + index;
+
+    if (!timer->active) {
+        /* timer was not set or has expired - that-s fine */
+        return true;
+    }
+
+    queue_request(loop, IORING_OP_TIMEOUT_REMOVE, -1,
+                  request_id(REQUEST_TIMER, timer->generation, index), 0,
+                  request_id(REQUEST_IGNORE, 0, 0));
+
+    if (0 != userdata) {
+        *userdata = timer->data;
+    }
+
+    release_timer_unsafe(loop, index);
+    notify_unsafe(loop);
+
+    return true;
+
+error:
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+#endif /* linux */
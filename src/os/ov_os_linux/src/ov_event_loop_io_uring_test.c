@@ -0,0 +1,319 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_event_loop_io_uring_test.c
+
+        @date           2026-10-18
+
+        @ingroup        ov_event_loop
+
+        ------------------------------------------------------------------------
+*/
+
+#include <ov_test/ov_test.h>
+
+#if defined __linux__
+
+#include "ov_event_loop_io_uring.c"
+
+#include "../include/ov_event_loop_linux.h"
+#include <ov_base/ov_event_loop_test_interface.h>
+#include <ov_base/ov_reconnect_manager_test_interface.h>
+
+/*----------------------------------------------------------------------------*/
+
+static bool open_udp_pair(int *receiver, int *sender) {
+
+    ov_socket_configuration config = {.host = "127.0.0.1", .type = UDP};
+
+    *receiver = ov_socket_create(config, false, NULL);
+
+    if ((0 > *receiver) ||
+        (!ov_socket_get_config(*receiver, &config, NULL, NULL)))
+        return false;
+
+    *sender = ov_socket_create(config, true, NULL);
+
+    return -1 < *sender;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool read_one_datagram(int socket, uint8_t events, void *data) {
+
+    UNUSED(events);
+
+    char buffer[100] = {0};
+
+    if (0 < recv(socket, buffer, sizeof(buffer), 0))
+        *(int *)data += 1;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool dummy_timer_callback(uint32_t id, void *data) {
+
+    UNUSED(id);
+    UNUSED(data);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int test_reconnect() {
+
+    return ov_reconnect_manager_connect_test(ov_event_loop_io_uring);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_event_loop_io_uring() {
+
+    ov_event_loop_config config = {.max.sockets = 10, .max.timers = 10};
+
+    ov_event_loop *loop = ov_event_loop_io_uring(config);
+    testrun(loop);
+
+    Loop *impl = cast_to_loop(loop);
+    testrun(impl);
+    testrun(-1 < impl->ring.fd);
+    testrun(10 == impl->timers.free_count);
+
+    // lowest timer ids first
+
+    uint32_t id = loop->timer.set(loop, 1000, NULL, dummy_timer_callback);
+    testrun(1 == id);
+    testrun(9 == impl->timers.free_count);
+    testrun(loop->timer.unset(loop, id, NULL));
+    testrun(10 == impl->timers.free_count);
+
+    // out of range
+
+    testrun(!loop->timer.unset(loop, 11, NULL));
+
+    testrun(NULL == loop->free(loop));
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int test_ov_event_loop_io_uring_level_triggered() {
+
+    ov_event_loop_config config = {.max.sockets = 10, .max.timers = 10};
+
+    ov_event_loop *loop = ov_event_loop_io_uring(config);
+    testrun(loop);
+
+    int receiver = -1;
+    int sender = -1;
+    testrun(open_udp_pair(&receiver, &sender));
+
+    int counter = 0;
+
+    testrun(loop->callback.set(loop, receiver, OV_EVENT_IO_IN, &counter,
+                               read_one_datagram));
+
+    // each callback reads one datagram only, the rest is reported again
+
+    testrun(3 == send(sender, "abc", 3, 0));
+    testrun(3 == send(sender, "def", 3, 0));
+    testrun(3 == send(sender, "ghi", 3, 0));
+
+    for (size_t i = 0; (i < 100) && (3 > counter); ++i) {
+        testrun(loop->run(loop, 10 * 1000));
+    }
+
+    testrun(3 == counter);
+
+    // unset and set again before any submission
+
+    testrun(loop->callback.unset(loop, receiver, NULL));
+    testrun(loop->callback.set(loop, receiver, OV_EVENT_IO_IN, &counter,
+                               read_one_datagram));
+
+    testrun(3 == send(sender, "jkl", 3, 0));
+
+    for (size_t i = 0; (i < 100) && (4 > counter); ++i) {
+        testrun(loop->run(loop, 10 * 1000));
+    }
+
+    testrun(4 == counter);
+
+    // unset sockets are not reported any longer
+
+    testrun(loop->callback.unset(loop, receiver, NULL));
+    testrun(3 == send(sender, "mno", 3, 0));
+    testrun(loop->run(loop, 50 * 1000));
+    testrun(4 == counter);
+
+    testrun(NULL == loop->free(loop));
+
+    close(receiver);
+    close(sender);
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct burst {
+
+    ov_event_loop *loop;
+    int received;
+    int expected;
+};
+
+/*----------------------------------------------------------------------------*/
+
+static bool receive_burst(int socket, uint8_t events, void *data) {
+
+    UNUSED(events);
+
+    char buffer[200] = {0};
+    struct burst *burst = data;
+
+    if (0 < recv(socket, buffer, sizeof(buffer), 0))
+        burst->received += 1;
+
+    if (burst->received == burst->expected)
+        burst->loop->stop(burst->loop);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t receive_bursts(ov_event_loop *(*create)(ov_event_loop_config),
+                               size_t num_sockets, size_t runs) {
+
+    /* num_sockets receivers, each receives one datagram per run -
+     * as many streams of some media gateway */
+
+    ov_event_loop *loop = create(
+        (ov_event_loop_config){.max.sockets = 2 * num_sockets + 10,
+                               .max.timers = 10});
+
+    OV_ASSERT(loop);
+
+    int receivers[num_sockets];
+    int senders[num_sockets];
+
+    struct burst burst = {.loop = loop, .expected = num_sockets};
+
+    for (size_t i = 0; i < num_sockets; ++i) {
+
+        OV_ASSERT(open_udp_pair(receivers + i, senders + i));
+        OV_ASSERT(loop->callback.set(loop, receivers[i], OV_EVENT_IO_IN,
+                                     &burst, receive_burst));
+    }
+
+    char payload[160] = {0};
+    uint64_t usecs = 0;
+
+    for (size_t r = 0; r < runs; ++r) {
+
+        burst.received = 0;
+
+        for (size_t i = 0; i < num_sockets; ++i) {
+            send(senders[i], payload, sizeof(payload), 0);
+        }
+
+        uint64_t start = ov_time_get_current_time_usecs();
+        loop->run(loop, OV_RUN_MAX);
+        usecs += ov_time_get_current_time_usecs() - start;
+
+        OV_ASSERT(burst.received == burst.expected);
+    }
+
+    /* free closes the receivers */
+    loop->free(loop);
+
+    for (size_t i = 0; i < num_sockets; ++i) {
+        close(senders[i]);
+    }
+
+    return usecs;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int check_io_uring_performance() {
+
+    const size_t runs = 1000;
+    const size_t sockets[] = {1, 16, 128};
+
+    for (size_t i = 0; i < sizeof(sockets) / sizeof(sockets[0]); ++i) {
+
+        uint64_t epoll_usecs =
+            receive_bursts(ov_event_loop_linux, sockets[i], runs);
+
+        uint64_t uring_usecs =
+            receive_bursts(ov_event_loop_io_uring, sockets[i], runs);
+
+        fprintf(stdout,
+                "%zu sockets: ov_event_loop_linux %.0f ns/datagram, "
+                "ov_event_loop_io_uring %.0f ns/datagram\n",
+                sockets[i], 1000.0 * epoll_usecs / (runs * sockets[i]),
+                1000.0 * uring_usecs / (runs * sockets[i]));
+    }
+
+    return testrun_log_success();
+}
+
+/*----------------------------------------------------------------------------*/
+
+int all_tests() {
+
+    testrun_init();
+
+    ov_event_loop *probe =
+        ov_event_loop_io_uring(ov_event_loop_config_default());
+
+    if (0 == probe) {
+
+        testrun_log("io_uring not supported by the kernel - skipping");
+        return testrun_counter;
+    }
+
+    probe = ov_event_loop_free(probe);
+
+    testrun_test(test_ov_event_loop_io_uring);
+    testrun_test(test_ov_event_loop_io_uring_level_triggered);
+
+    OV_EVENT_LOOP_PERFORM_INTERFACE_TESTS(ov_event_loop_io_uring);
+    testrun_test(test_reconnect);
+
+    testrun_test(check_io_uring_performance);
+
+    return testrun_counter;
+}
+
+testrun_run(all_tests);
+
+#else
+
+OV_TEST_RUN("OV_EVENT_LOOP_IO_URING", NULL);
+
+#endif /* linux */
@@ -34,6 +34,7 @@
 #include <ov_base/ov_config.h>
 #include <ov_base/ov_config_keys.h>
 #include <ov_base/ov_constants.h>
+#include <ov_base/ov_event_keys.h>
 #include <ov_base/ov_mc_socket.h>
 #include <ov_base/ov_random.h>
 #include <ov_base/ov_rtp_app.h>
@@ -308,6 +309,8 @@ ov_alsa_audio_app_config_from_json(ov_json_value const *jcfg,
 
         strcpy(cfg.rtp_socket.host, listen_interface);
 
+        cfg.loop_bus = ov_json_is_true(ov_json_get(jcfg, "/" OV_KEY_LOOP_BUS));
+
         ov_json_value const *debug = ov_json_get(jcfg, "/" OV_KEY_DEBUG);
 
         cfg.debug.rtp_logging =
@@ -395,6 +398,7 @@ struct ov_alsa_audio_app {
         size_t frame_length_ms;
         size_t max_frames_to_buffer;
         ov_json_value *default_codec;
+        bool loop_bus;
     } settings;
 
     uint32_t mix_and_replay_timer;
@@ -571,6 +575,23 @@ static uint32_t get_channel_ssid(ov_alsa_audio_app const *self, size_t index) {
 
 /*----------------------------------------------------------------------------*/
 
+// Mixed PCM waiting for ALSA, 1s at most
+#define OUT_BUFFER_OCTETS (OV_DEFAULT_SAMPLERATE * OV_DEFAULT_OCTETS_PER_SAMPLE)
+
+static ov_chunker *create_pcm_buffer() {
+
+    ov_chunker *buffer = ov_chunker_create_ring(OUT_BUFFER_OCTETS);
+
+    if (0 == buffer) {
+        ov_log_warning("Falling back to growing PCM buffer");
+        buffer = ov_chunker_create();
+    }
+
+    return buffer;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static ov_alsa_playback *create_alsa_playback(OutChannel const *channel,
                                               uint16_t msecs_to_buffer_ahead) {
 
@@ -673,7 +694,7 @@ static size_t initialize_out_channels(ov_alsa_audio_app *self,
 
             } else {
 
-                channels[i].buffer = ov_chunker_create();
+                channels[i].buffer = create_pcm_buffer();
                 channels[i].playback = create_alsa_playback(channels + i, 100);
                 channels[i].mixer = create_mixer_for(
                     channels + i, get_recv_codec_for(self, i), frame_length_ms);
@@ -796,6 +817,7 @@ static ov_rtp_app *create_rtp_app(ov_alsa_audio_app *self, OutChannel *channel,
 
             .multicast = true,
             .rtp_socket = socket_config_for_mc_loop(mc_loop, mc_port),
+            .loop_bus = self->settings.loop_bus,
             .rtp_handler = cb_rtp_recv,
             .rtp_handler_userdata = channel,
 
@@ -989,6 +1011,7 @@ ov_alsa_audio_app *ov_alsa_audio_app_create(ov_event_loop *loop,
 
         self->settings.frame_length_ms = OV_DEFAULT_FRAME_LENGTH_MS;
         self->settings.max_frames_to_buffer = cfg.max_num_frames;
+        self->settings.loop_bus = cfg.loop_bus;
         self->mix_and_replay_timer = OV_TIMER_INVALID;
     }
 
@@ -1159,6 +1182,72 @@ static ov_json_value *in_channel_to_json(InChannel const *channel) {
 
 /*----------------------------------------------------------------------------*/
 
+static ov_json_value *mixer_stats_to_json(ov_alsa_rtp_mixer const *mixer) {
+
+    ov_alsa_rtp_mixer_stats stats = ov_alsa_rtp_mixer_get_stats(mixer);
+
+    ov_json_value *jstats = ov_json_object();
+
+    ov_json_object_set(jstats, "periods", ov_json_number(stats.periods));
+    ov_json_object_set(jstats, "periods_silent",
+                       ov_json_number(stats.periods_silent));
+    ov_json_object_set(jstats, "frames_mixed",
+                       ov_json_number(stats.frames_mixed));
+    ov_json_object_set(jstats, "frames_dropped",
+                       ov_json_number(stats.frames_dropped));
+    ov_json_object_set(jstats, "mix_usecs_max",
+                       ov_json_number(stats.mix_usecs_max));
+    ov_json_object_set(
+        jstats, "mix_usecs_avg",
+        ov_json_number(stats.mix_usecs_total /
+                       (double)OV_OR_DEFAULT(stats.periods, 1)));
+
+    return jstats;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *
+playback_stats_to_json(ov_alsa_playback const *playback) {
+
+    ov_alsa_playback_stats stats = ov_alsa_playback_get_stats(playback);
+
+    ov_json_value *jstats = ov_json_object();
+
+    ov_json_object_set(jstats, "periods_played",
+                       ov_json_number(stats.periods_played));
+    ov_json_object_set(jstats, "xruns", ov_json_number(stats.xruns));
+    ov_json_object_set(jstats, "buffer_empty",
+                       ov_json_number(stats.buffer_empty));
+    ov_json_object_set(jstats, "latency_usecs",
+                       ov_json_number(stats.latency_usecs));
+    ov_json_object_set(jstats, "latency_usecs_max",
+                       ov_json_number(stats.latency_usecs_max));
+
+    return jstats;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *out_channel_stats_to_json(OutChannel const *channel) {
+
+    ov_json_value *jstats = ov_json_object();
+
+    if (0 != channel->mixer) {
+        ov_json_object_set(jstats, OV_KEY_MIXER,
+                           mixer_stats_to_json(channel->mixer));
+    }
+
+    if (0 != channel->playback) {
+        ov_json_object_set(jstats, OV_KEY_PLAYBACK,
+                           playback_stats_to_json(channel->playback));
+    }
+
+    return jstats;
+}
+
+/*----------------------------------------------------------------------------*/
+
 static bool out_channel_to_json_to(ov_json_value *jchannel,
                                    OutChannel const *channel) {
 
@@ -1167,7 +1256,9 @@ static bool out_channel_to_json_to(ov_json_value *jchannel,
         ov_json_object_set(jchannel, OV_KEY_DEVICE,
                            ov_json_string(channel->device)) &&
         ov_json_object_set(jchannel, OV_KEY_IN_USE,
-                           ov_json_bool(0 != channel->playback))) {
+                           ov_json_bool(0 != channel->playback)) &&
+        ov_json_object_set(jchannel, OV_KEY_STATISTICS,
+                           out_channel_stats_to_json(channel))) {
 
         return true;
 
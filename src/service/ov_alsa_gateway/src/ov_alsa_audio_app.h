@@ -86,6 +86,10 @@ typedef struct {
 
     ov_socket_configuration rtp_socket;
 
+    // Receive loops from the shared memory bus of the host as well,
+    // required once publishers of the host use it, see ov_loop_bus.h
+    bool loop_bus;
+
     struct {
         char const *rtp_logging;
     } debug;
@@ -74,6 +74,7 @@ int ov_alsa_audio_app_config_from_json_test() {
     testrun(ov_string_equal(cfg.channels.output[0], "d2"));
     testrun(ov_string_equal(cfg.static_loops.output[0], 0));
     testrun(cfg.static_loops.output_ports[0] == 0);
+    testrun(!cfg.loop_bus);
 
     ov_alsa_audio_app_config_clear(&cfg);
 
@@ -121,7 +122,8 @@ int ov_alsa_audio_app_config_from_json_test() {
         "         {\"" OV_KEY_DEVICE "\":\"dout\", \"" OV_KEY_LOOP
         "\":\"1.11.111.3\", \"" OV_KEY_PORT "\": 777}"
         "     ]"
-        " }"
+        " },"
+        " \"" OV_KEY_LOOP_BUS "\": true"
         "}");
 
     testrun(0 != jval);
@@ -137,6 +139,7 @@ int ov_alsa_audio_app_config_from_json_test() {
     testrun(ov_string_equal(cfg.channels.output[0], "dout"));
     testrun(ov_string_equal(cfg.static_loops.output[0], "1.11.111.3"));
     testrun(777 == cfg.static_loops.output_ports[0]);
+    testrun(cfg.loop_bus);
 
     ov_alsa_audio_app_config_clear(&cfg);
 
@@ -80,8 +80,6 @@ struct ov_alsa_playback {
 
     bool buffer_after_interrupt;
 
-    ov_buffer *alsa_period_buffer;
-
     ov_buffer *comfort_noise;
 
     ov_alsa *alsa;
@@ -89,9 +87,18 @@ struct ov_alsa_playback {
     struct {
 
         ov_counter periods_played;
+        ov_counter xruns;        // underruns reported by ALSA
+        ov_counter buffer_empty; // ALSA buffer found drained
 
     } counter;
 
+    struct {
+
+        uint64_t usecs;
+        uint64_t usecs_max;
+
+    } latency;
+
     int logging_fd;
 };
 
@@ -115,12 +122,15 @@ static ov_alsa_playback const *as_playback(void const *ptr) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_alsa_playback_play_result play_pcm(ov_alsa *alsa, uint8_t *pcm) {
+static ov_alsa_playback_play_result play_pcm(ov_alsa_playback *self,
+                                             uint8_t *pcm) {
 
     ov_result res = {0};
 
     ov_alsa_playback_play_result alsa_res = ALSA_REPLAY_OK;
 
+    ov_alsa *alsa = self->alsa;
+
     if (ov_ptr_valid(alsa, "Cannot play buffer: Invalid ALSA object") &&
         (!ov_alsa_play_period(alsa, (int16_t *)pcm, &res))) {
 
@@ -132,6 +142,7 @@ static ov_alsa_playback_play_result play_pcm(ov_alsa *alsa, uint8_t *pcm) {
 
         if (OV_ERROR_AUDIO_UNDERRUN == res.error_code) {
 
+            ov_counter_increase(self->counter.xruns, 1);
             alsa_res = ALSA_REPLAY_INSUFFICIENT;
 
         } else {
@@ -148,23 +159,23 @@ static ov_alsa_playback_play_result play_pcm(ov_alsa *alsa, uint8_t *pcm) {
 /*----------------------------------------------------------------------------*/
 
 static ov_alsa_playback_play_result
-feed_alsa_buffer_next_period(ov_chunker *chunker, ov_alsa *alsa,
-                             uint8_t *buffer, size_t octets_per_period) {
-
-    if (ov_ptr_valid(buffer, "Cannot play period - invalid buffer")) {
+feed_alsa_buffer_next_period(ov_chunker *chunker, ov_alsa_playback *self,
+                             size_t octets_per_period) {
 
-        if (ov_chunker_next_chunk_raw(chunker, octets_per_period, buffer)) {
+    // Play straight from the chunker without copying the period
+    uint8_t const *pcm =
+        ov_chunker_next_chunk_preview(chunker, octets_per_period);
 
-            return play_pcm(alsa, buffer) ? ALSA_REPLAY_OK : ALSA_REPLAY_FAILED;
+    if (0 != pcm) {
 
-        } else {
+        bool played = play_pcm(self, (uint8_t *)pcm);
+        ov_chunker_skip(chunker, octets_per_period);
 
-            return ALSA_REPLAY_INSUFFICIENT;
-        }
+        return played ? ALSA_REPLAY_OK : ALSA_REPLAY_FAILED;
 
     } else {
 
-        return ALSA_REPLAY_FAILED;
+        return ALSA_REPLAY_INSUFFICIENT;
     }
 }
 
@@ -177,8 +188,6 @@ feed_alsa_buffer_up_to(ov_alsa_playback *self, ov_chunker *pcm,
     if (ov_ptr_valid(self, "Cannot feed ALSA buffer new audio - invalid "
                            "ov_alsa_playback object")) {
 
-        OV_ASSERT(0 != self->alsa_period_buffer);
-
         size_t periods_fed = 0;
         ov_alsa_playback_play_result result = ALSA_REPLAY_OK;
 
@@ -186,9 +195,8 @@ feed_alsa_buffer_up_to(ov_alsa_playback *self, ov_chunker *pcm,
              (ALSA_REPLAY_OK == result) && (periods_fed <= num_max_periods);
              periods_fed++) {
 
-            result = feed_alsa_buffer_next_period(
-                pcm, self->alsa, self->alsa_period_buffer->start,
-                self->alsa_octets_per_period);
+            result = feed_alsa_buffer_next_period(pcm, self,
+                                                  self->alsa_octets_per_period);
         };
 
         --periods_fed; // Loop is iterated over one time too much
@@ -226,15 +234,26 @@ feed_alsa_buffer_up_to(ov_alsa_playback *self, ov_chunker *pcm,
 
 /*----------------------------------------------------------------------------*/
 
+static void update_latency(ov_alsa_playback *self, size_t samples_in_alsa,
+                           ov_chunker *pcm) {
+
+    // PCM already mixed, but not yet played
+    size_t samples = samples_in_alsa + ov_chunker_available_octets(pcm) /
+                                           OV_DEFAULT_OCTETS_PER_SAMPLE;
+
+    self->latency.usecs = (1000000 * (uint64_t)samples) / OV_DEFAULT_SAMPLERATE;
+    self->latency.usecs_max =
+        OV_MAX(self->latency.usecs_max, self->latency.usecs);
+}
+
+/*----------------------------------------------------------------------------*/
+
 static ov_alsa_playback_play_result
 replay_if_necessary(ov_alsa_playback *self, ov_alsa *alsa, ov_chunker *pcm,
                     size_t bufsize_samples) {
 
     ssize_t writeable_samples = ov_alsa_get_no_available_samples(alsa);
 
-    size_t remaining_samples_in_alsa_buffer =
-        (size_t)(bufsize_samples - writeable_samples);
-
     if (writeable_samples > (ssize_t)bufsize_samples) {
 
         ov_log_error("Serious ALSA problem: ALSA buffer smaller than number of "
@@ -242,6 +261,13 @@ replay_if_necessary(ov_alsa_playback *self, ov_alsa *alsa, ov_chunker *pcm,
         writeable_samples = bufsize_samples;
     }
 
+    size_t remaining_samples_in_alsa_buffer =
+        (size_t)(bufsize_samples - writeable_samples);
+
+    if (0 <= writeable_samples) {
+        update_latency(self, remaining_samples_in_alsa_buffer, pcm);
+    }
+
     if (0 > writeable_samples) {
 
         ov_log_warning("ALSA: problem with ALSA connection");
@@ -252,6 +278,8 @@ replay_if_necessary(ov_alsa_playback *self, ov_alsa *alsa, ov_chunker *pcm,
 
         ov_log_warning("Probable ALSA buffer underflow encountered");
 
+        ov_counter_increase(self->counter.buffer_empty, 1);
+
         self->buffer_after_interrupt = true;
 
         return ALSA_REPLAY_INSUFFICIENT;
@@ -321,7 +349,7 @@ bool ov_alsa_playback_play_comfort_noise(ov_alsa_playback *self) {
         ov_ptr_valid(self->comfort_noise,
                      "Cannot play comfort noise - comfort noise not "
                      "initialized")) {
-        return play_pcm(self->alsa, self->comfort_noise->start);
+        return play_pcm(self, self->comfort_noise->start);
     } else {
         return false;
     }
@@ -350,8 +378,6 @@ static ov_alsa_playback *create_alsa_playback(const ov_alsa_playback_config cfg,
     self->alsa_buffer_size_samples =
         ov_alsa_get_buffer_size_samples(self->alsa);
 
-    self->alsa_period_buffer = ov_buffer_create(self->alsa_octets_per_period);
-
     self->comfort_noise = create_comfort_noise(
         ov_convert_samples_to_msecs(samples_per_period, OV_DEFAULT_SAMPLERATE),
         cfg.comfort_noise.max_amplitude);
@@ -400,7 +426,6 @@ ov_alsa_playback *ov_alsa_playback_free(ov_alsa_playback *self) {
     if (0 != as_playback(self)) {
 
         self->alsa = ov_alsa_free(self->alsa);
-        self->alsa_period_buffer = ov_buffer_free(self->alsa_period_buffer);
         self->comfort_noise = ov_buffer_free(self->comfort_noise);
 
         return ov_free(self);
@@ -426,3 +451,22 @@ bool ov_alsa_playback_reset(ov_alsa_playback *self) {
 }
 
 /*----------------------------------------------------------------------------*/
+
+ov_alsa_playback_stats
+ov_alsa_playback_get_stats(ov_alsa_playback const *self) {
+
+    ov_alsa_playback_stats stats = {0};
+
+    if (0 != as_playback(self)) {
+
+        stats.periods_played = self->counter.periods_played.counter;
+        stats.xruns = self->counter.xruns.counter;
+        stats.buffer_empty = self->counter.buffer_empty.counter;
+        stats.latency_usecs = self->latency.usecs;
+        stats.latency_usecs_max = self->latency.usecs_max;
+    }
+
+    return stats;
+}
+
+/*----------------------------------------------------------------------------*/
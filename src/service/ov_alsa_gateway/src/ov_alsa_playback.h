@@ -87,3 +87,19 @@ bool ov_alsa_playback_play_comfort_noise(ov_alsa_playback *self);
 bool ov_alsa_playback_reset(ov_alsa_playback *self);
 
 /*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint64_t periods_played;
+    uint64_t xruns;        // underruns reported by ALSA
+    uint64_t buffer_empty; // ALSA buffer found drained before refilling
+
+    /* PCM queued in the ALSA buffer and the chunker at the last replay */
+    uint64_t latency_usecs;
+    uint64_t latency_usecs_max;
+
+} ov_alsa_playback_stats;
+
+ov_alsa_playback_stats ov_alsa_playback_get_stats(ov_alsa_playback const *self);
+
+/*----------------------------------------------------------------------------*/
@@ -120,7 +120,13 @@ static bool init_alsa_record(ov_alsa_record *self, ov_alsa_record_config cfg) {
     ov_codec *codec = ov_codec_factory_get_codec_from_json(
         0, cfg.rtp_stream.codec_config, cfg.rtp_stream.ssid);
 
-    ov_chunker *chunker = ov_chunker_create();
+    // Captured PCM waiting to be sent, 1s at most
+    ov_chunker *chunker = ov_chunker_create_ring(OV_DEFAULT_SAMPLERATE *
+                                                 OV_DEFAULT_OCTETS_PER_SAMPLE);
+
+    if (0 == chunker) {
+        chunker = ov_chunker_create();
+    }
 
     if (ov_ptr_valid(self,
                      "Cannot initialize alsa record object - 0 pointer") &&
@@ -257,13 +263,19 @@ static void *cb_alsa_record(void *arg) {
 
             ov_chunker_add(chunker, pcm);
 
-            if (ov_chunker_next_chunk_raw(chunker, octets_for_one_frame,
-                                          pcm->start) &&
-                send_as_rtp(&self->rtp, pcm->start, octets_for_one_frame)) {
+            uint8_t const *frame =
+                ov_chunker_next_chunk_preview(chunker, octets_for_one_frame);
+
+            if ((0 != frame) &&
+                send_as_rtp(&self->rtp, frame, octets_for_one_frame)) {
 
                 ov_counter_increase(self->counter.rtp_sent, 1);
             }
 
+            if (0 != frame) {
+                ov_chunker_skip(chunker, octets_for_one_frame);
+            }
+
             pcm->length = 0;
         };
 
@@ -27,26 +27,34 @@
 /*----------------------------------------------------------------------------*/
 
 #include "ov_alsa_rtp_mixer.h"
+#include <ov_arch/ov_arch_math.h>
 #include <ov_base/ov_convert.h>
 #include <ov_base/ov_dict.h>
-#include <ov_base/ov_rtp_frame_buffer.h>
-#include <ov_base/ov_thread_lock.h>
+#include <ov_base/ov_spsc_queue.h>
+#include <ov_base/ov_time.h>
 #include <ov_codec/ov_codec.h>
 #include <ov_codec/ov_codec_factory.h>
 #include <ov_codec/ov_codec_opus.h>
 #include <ov_pcm16s/ov_pcm16_mod.h>
 #include <ov_pcm_gen/ov_pcm_gen.h>
+#include <stdatomic.h>
 
 /*----------------------------------------------------------------------------*/
 
 #define MAGIC_BYTES 0x2f2d2e2f
 
+/* Frames received within one period over all streams */
+#define FRAME_QUEUE_CAPACITY 256
+
 struct ov_alsa_rtp_mixer_struct {
 
     uint32_t magic_bytes;
 
-    ov_rtp_frame_buffer *frame_buffer;
-    ov_thread_lock frame_buffer_lock;
+    /* Network thread -> audio thread, frames are owned by the queue */
+    ov_spsc_queue *frame_queue;
+
+    /* Frames rejected by the network thread due to a full queue */
+    _Atomic uint64_t frames_rejected;
 
     struct {
 
@@ -55,6 +63,8 @@ struct ov_alsa_rtp_mixer_struct {
 
         double sample_rate_hertz;
 
+        size_t max_num_frames_per_stream;
+
     } settings;
 
     struct {
@@ -69,7 +79,20 @@ struct ov_alsa_rtp_mixer_struct {
 
     } comfort_noise;
 
-    ov_dict *codecs;
+    /* Everything below is only touched by the audio thread */
+
+    ov_dict *streams;
+
+    struct {
+
+        ov_buffer *decoded_16bit;
+        int32_t *decoded_32bit;
+        int32_t *mixed_32bit;
+        ov_buffer *pcm16;
+
+    } scratch;
+
+    ov_alsa_rtp_mixer_stats stats;
 };
 
 /*----------------------------------------------------------------------------*/
@@ -92,13 +115,22 @@ typedef struct {
     ov_codec *codec;
     time_t last_used_epoch_secs; // For garbage collection
 
-} codec_entry;
+    /* Frames in order of their sequence numbers, oldest first */
+    size_t num_frames;
+    ov_rtp_frame *frames[];
+
+} stream_entry;
 
 /*----------------------------------------------------------------------------*/
 
-static codec_entry *codec_entry_free(codec_entry *entry) {
+static stream_entry *stream_entry_free(stream_entry *entry) {
 
     if (0 != entry) {
+
+        for (size_t i = 0; i < entry->num_frames; ++i) {
+            entry->frames[i] = ov_rtp_frame_free(entry->frames[i]);
+        }
+
         entry->codec = ov_codec_free(entry->codec);
         return ov_free(entry);
     }
@@ -108,61 +140,111 @@ static codec_entry *codec_entry_free(codec_entry *entry) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_codec *codec_from_codec_entry(codec_entry *entry) {
-
-    if (0 != entry) {
-
-        entry->last_used_epoch_secs = time(0);
-        return entry->codec;
-
-    } else {
+static void *stream_entry_free_void(void *entry) {
 
-        return 0;
-    }
+    return (void *)stream_entry_free(entry);
 }
 
 /*----------------------------------------------------------------------------*/
 
-static ov_codec *get_codec_for_ssrc(ov_alsa_rtp_mixer *self, uint32_t ssrc) {
+static stream_entry *get_stream_for_ssrc(ov_alsa_rtp_mixer *self,
+                                         uint32_t ssrc) {
 
     intptr_t key = ssrc;
-    codec_entry *codec = 0;
-
-    if (ov_ptr_valid(self,
-                     "Cannot get Codec - invalid ALSA RTP mixer pointer")) {
+    stream_entry *entry = ov_dict_get(self->streams, (void *)key);
 
-        codec = ov_dict_get(self->codecs, (void *)key);
+    if (0 == entry) {
 
-        if (!codec) {
+        entry = calloc(1, sizeof(stream_entry) +
+                              self->settings.max_num_frames_per_stream *
+                                  sizeof(ov_rtp_frame *));
 
-            codec = calloc(1, sizeof(codec_entry));
+        if (0 != entry) {
 
-            codec->codec =
+            entry->codec =
                 ov_codec_factory_get_codec(0, ov_codec_opus_id(), key, 0);
 
-            if (codec && (!ov_dict_set(self->codecs, (void *)key, codec, 0))) {
-                codec = codec_entry_free(codec);
+            if (!ov_dict_set(self->streams, (void *)key, entry, 0)) {
+                entry = stream_entry_free(entry);
             }
         }
     }
 
-    return codec_from_codec_entry(codec);
+    if (0 != entry) {
+        entry->last_used_epoch_secs = time(0);
+    }
+
+    return entry;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static ov_codec *get_codec_for_frame(ov_alsa_rtp_mixer *mixer,
-                                     const ov_rtp_frame *frame) {
+static int16_t sequence_diff(ov_rtp_frame const *a, ov_rtp_frame const *b) {
 
-    if (ov_ptr_valid(frame,
-                     "Cannot get codec for RTP frame: invalid frame pointer")) {
+    // Wraps around at 2^16
+    return (int16_t)(a->expanded.sequence_number -
+                     b->expanded.sequence_number);
+}
 
-        return get_codec_for_ssrc(mixer, frame->expanded.ssrc);
+/*----------------------------------------------------------------------------*/
 
-    } else {
+/**
+ * @return frame that was not stored (duplicate or too old) or dropped to make
+ * room, or 0
+ */
+static ov_rtp_frame *stream_add_frame(stream_entry *entry, size_t capacity,
+                                      ov_rtp_frame *frame) {
+
+    size_t pos = entry->num_frames;
+
+    while ((0 < pos) && (0 > sequence_diff(frame, entry->frames[pos - 1]))) {
+        --pos;
+    }
+
+    if ((0 < pos) && (0 == sequence_diff(frame, entry->frames[pos - 1]))) {
+        return frame;
+    }
+
+    ov_rtp_frame *dropped = 0;
+
+    if (capacity <= entry->num_frames) {
+
+        if (0 == pos) {
+            return frame;
+        }
+
+        dropped = entry->frames[0];
+        memmove(entry->frames, entry->frames + 1,
+                (entry->num_frames - 1) * sizeof(ov_rtp_frame *));
+
+        --entry->num_frames;
+        --pos;
+    }
 
+    memmove(entry->frames + pos + 1, entry->frames + pos,
+            (entry->num_frames - pos) * sizeof(ov_rtp_frame *));
+
+    entry->frames[pos] = frame;
+    ++entry->num_frames;
+
+    return dropped;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_rtp_frame *stream_pop_frame(stream_entry *entry) {
+
+    if (0 == entry->num_frames) {
         return 0;
     }
+
+    ov_rtp_frame *frame = entry->frames[0];
+
+    --entry->num_frames;
+    memmove(entry->frames, entry->frames + 1,
+            entry->num_frames * sizeof(ov_rtp_frame *));
+
+    return frame;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -199,24 +281,56 @@ create_comfort_noise_for_default_frame(ov_alsa_rtp_mixer *self) {
 
 /*----------------------------------------------------------------------------*/
 
-static void *codec_entry_free_void(void *codec) {
+static void *rtp_frame_free_void(void *frame) {
 
-    return (void *)codec_entry_free(codec);
+    return (void *)ov_rtp_frame_free(frame);
 }
 
 /*----------------------------------------------------------------------------*/
 
-ov_alsa_rtp_mixer *ov_alsa_rtp_mixer_create(ov_alsa_rtp_mixer_config cfg) {
+static bool create_scratch(ov_alsa_rtp_mixer *self) {
 
-    ov_rtp_frame_buffer_config fbconf = {
-        .num_frames_to_buffer_per_stream =
-            OV_OR_DEFAULT(cfg.max_num_frames_per_stream, 10),
-    };
+    size_t samples = self->settings.frame_length_samples;
+
+    self->scratch.decoded_16bit = ov_buffer_create(samples * sizeof(int16_t));
+    self->scratch.decoded_32bit = calloc(samples, sizeof(int32_t));
+    self->scratch.mixed_32bit = calloc(samples, sizeof(int32_t));
+    self->scratch.pcm16 = ov_buffer_create(samples * sizeof(int16_t));
+
+    if ((0 == self->scratch.pcm16) || (0 == self->scratch.decoded_16bit)) {
+        return false;
+    }
+
+    self->scratch.pcm16->length = samples * sizeof(int16_t);
+
+    return (0 != self->scratch.decoded_32bit) &&
+           (0 != self->scratch.mixed_32bit);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void free_scratch(ov_alsa_rtp_mixer *self) {
+
+    self->scratch.decoded_16bit = ov_buffer_free(self->scratch.decoded_16bit);
+    self->scratch.decoded_32bit = ov_free(self->scratch.decoded_32bit);
+    self->scratch.mixed_32bit = ov_free(self->scratch.mixed_32bit);
+    self->scratch.pcm16 = ov_buffer_free(self->scratch.pcm16);
+}
+
+/*----------------------------------------------------------------------------*/
+
+ov_alsa_rtp_mixer *ov_alsa_rtp_mixer_create(ov_alsa_rtp_mixer_config cfg) {
 
     ov_alsa_rtp_mixer *mixer = calloc(1, sizeof(ov_alsa_rtp_mixer));
 
+    if (!ov_ptr_valid(mixer,
+                      "Could not create ALSA RTP mixer - out of memory")) {
+        return 0;
+    }
+
     mixer->magic_bytes = MAGIC_BYTES;
-    mixer->frame_buffer = ov_rtp_frame_buffer_create(fbconf);
+    mixer->frame_queue = ov_spsc_queue_create(FRAME_QUEUE_CAPACITY);
+    atomic_init(&mixer->frames_rejected, 0);
     mixer->rtp_keepalive = true;
     mixer->comfort_noise.enabled = (0 == cfg.comfort_noise_max_amplitude);
 
@@ -232,15 +346,21 @@ ov_alsa_rtp_mixer *ov_alsa_rtp_mixer_create(ov_alsa_rtp_mixer_config cfg) {
     mixer->settings.frame_length_samples = ov_convert_msecs_to_samples(
         mixer->settings.frame_length_ms, mixer->settings.sample_rate_hertz);
 
+    mixer->settings.max_num_frames_per_stream =
+        OV_OR_DEFAULT(cfg.max_num_frames_per_stream, 10);
+
     mixer->comfort_noise.noisy_frame_16bit =
         create_comfort_noise_for_default_frame(mixer);
 
     ov_dict_config d_config = ov_dict_intptr_key_config(255);
-    d_config.value.data_function.free = codec_entry_free_void;
-    mixer->codecs = ov_dict_create(d_config);
+    d_config.value.data_function.free = stream_entry_free_void;
+    mixer->streams = ov_dict_create(d_config);
 
-    ov_thread_lock_init(&mixer->frame_buffer_lock,
-                        1000 * OV_DEFAULT_FRAME_LENGTH_MS / 2.0);
+    if ((0 == mixer->frame_queue) || (!create_scratch(mixer))) {
+
+        ov_log_error("Could not create ALSA RTP mixer");
+        mixer = ov_alsa_rtp_mixer_free(mixer);
+    }
 
     return mixer;
 }
@@ -254,12 +374,14 @@ ov_alsa_rtp_mixer *ov_alsa_rtp_mixer_free(ov_alsa_rtp_mixer *self) {
 
         fprintf(stderr, "Freeing ALSA RTP mixer\n");
 
-        self->frame_buffer = ov_rtp_frame_buffer_free(self->frame_buffer);
-        ov_thread_lock_clear(&self->frame_buffer_lock);
-        self->codecs = ov_dict_free(self->codecs);
+        self->frame_queue =
+            ov_spsc_queue_free(self->frame_queue, rtp_frame_free_void);
+        self->streams = ov_dict_free(self->streams);
         self->comfort_noise.noisy_frame_16bit =
             ov_buffer_free(self->comfort_noise.noisy_frame_16bit);
 
+        free_scratch(self);
+
         return ov_free(self);
 
     } else {
@@ -270,33 +392,18 @@ ov_alsa_rtp_mixer *ov_alsa_rtp_mixer_free(ov_alsa_rtp_mixer *self) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_rtp_frame *frame_buffer_add(ov_thread_lock *lock,
-                                      ov_rtp_frame_buffer *buffer,
-                                      ov_rtp_frame *frame) {
-
-    if (ov_thread_lock_try_lock(lock)) {
-
-        frame = ov_rtp_frame_buffer_add(buffer, frame);
-
-        ov_thread_lock_unlock(lock);
-
-        return frame;
-
-    } else {
-
-        return 0;
-    }
-}
-
-/*----------------------------------------------------------------------------*/
-
 bool ov_alsa_rtp_mixer_add_frame(ov_alsa_rtp_mixer *self, ov_rtp_frame *frame) {
 
     if (ov_ptr_valid(
             self, "Cannot add RTP frame to mixing buffer - invalid pointer")) {
 
-        ov_rtp_frame_free(frame_buffer_add(&self->frame_buffer_lock,
-                                           self->frame_buffer, frame));
+        if ((0 != frame) && (!ov_spsc_queue_push(self->frame_queue, frame))) {
+
+            atomic_fetch_add_explicit(&self->frames_rejected, 1,
+                                      memory_order_relaxed);
+            frame = ov_rtp_frame_free(frame);
+        }
+
         return true;
 
     } else {
@@ -307,15 +414,23 @@ bool ov_alsa_rtp_mixer_add_frame(ov_alsa_rtp_mixer *self, ov_rtp_frame *frame) {
 
 /*----------------------------------------------------------------------------*/
 
-static ov_list *free_frame_list(ov_list *list) {
+static void take_queued_frames(ov_alsa_rtp_mixer *self) {
 
-    for (ov_rtp_frame *frame = ov_list_pop(list); 0 != frame;
-         frame = ov_list_pop(list)) {
+    for (ov_rtp_frame *frame = ov_spsc_queue_pop(self->frame_queue);
+         0 != frame; frame = ov_spsc_queue_pop(self->frame_queue)) {
 
-        frame = ov_rtp_frame_free(frame);
-    }
+        stream_entry *entry = get_stream_for_ssrc(self, frame->expanded.ssrc);
 
-    return ov_list_free(list);
+        if (0 != entry) {
+            frame = stream_add_frame(
+                entry, self->settings.max_num_frames_per_stream, frame);
+        }
+
+        if (0 != frame) {
+            ++self->stats.frames_dropped;
+            frame = ov_rtp_frame_free(frame);
+        }
+    }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -344,127 +459,127 @@ static bool decode_frame(ov_codec *codec, ov_rtp_frame *frame,
 
 /*----------------------------------------------------------------------------*/
 
-static ov_buffer *mix_frames(ov_alsa_rtp_mixer *self, ov_list *frames,
-                             size_t frame_length_samples) {
-
-    size_t num_frames = ov_list_count(frames);
-    size_t num_mixed_frames = 0;
+typedef struct {
 
-    size_t len_16bit = frame_length_samples * sizeof(int16_t);
-    size_t len_32bit = frame_length_samples * sizeof(int32_t);
+    ov_alsa_rtp_mixer *mixer;
+    size_t num_frames;
+    size_t num_mixed_frames;
 
-    ov_buffer *decoded_16bit = ov_buffer_create(len_16bit);
-    decoded_16bit->length = len_16bit;
+} mix_args;
 
-    ov_buffer *decoded_32bit = ov_buffer_create(len_32bit);
-    decoded_32bit->length = len_32bit;
+/*----------------------------------------------------------------------------*/
 
-    ov_buffer *mixed_32bit = ov_buffer_create(len_32bit);
-    mixed_32bit->length = len_32bit;
-    memset(mixed_32bit->start, 0, mixed_32bit->length);
+static bool mix_oldest_frame_of_stream(const void *key, void *value,
+                                       void *data) {
 
-    for (size_t i = 0; i < num_frames; ++i) {
+    UNUSED(key);
 
-        ov_rtp_frame *frame = ov_list_pop(frames);
+    stream_entry *entry = value;
+    mix_args *args = data;
 
-        if (decode_frame(get_codec_for_frame(self, frame), frame,
-                         decoded_16bit) &&
-            (ov_ptr_valid(decoded_16bit, "Could not decode RTP frame") &&
-             ov_cond_valid(len_16bit == decoded_16bit->length,
-                           "Decoded RTP frame has unexpected length") &&
-             (ov_cond_valid(ov_pcm_16_scale_to_32(
-                                frame_length_samples,
-                                (int16_t *)decoded_16bit->start,
-                                (int32_t *)decoded_32bit->start, 1.0, 0, 0),
-                            "Could not scale decoded PCM to 32 bit")) &&
-             ov_cond_valid(ov_pcm_32_add(frame_length_samples,
-                                         (int32_t *)mixed_32bit->start,
-                                         (int32_t *)decoded_32bit->start),
-                           "Could not add decoded RTP payload"))) {
-            ++num_mixed_frames;
-        }
+    ov_rtp_frame *frame = stream_pop_frame(entry);
 
-        frame = ov_rtp_frame_free(frame);
+    if (0 == frame) {
+        return true;
     }
 
-    ov_buffer *pcm16 = ov_buffer_create(len_16bit);
-    pcm16->length = len_16bit;
+    ++args->num_frames;
 
-    double scale_factor = OV_OR_DEFAULT(num_mixed_frames, 1);
+    ov_alsa_rtp_mixer *self = args->mixer;
 
-    if ((!ov_cond_valid(ov_pcm_32_scale(frame_length_samples,
-                                        (int32_t *)mixed_32bit->start,
-                                        1.0 / scale_factor),
-                        "Could not scale mixed PCM")) ||
-        (!ov_cond_valid(ov_pcm_32_clip_to_16(frame_length_samples,
-                                             (int32_t *)mixed_32bit->start,
-                                             (int16_t *)pcm16->start),
-                        "Could not clip mixed PCM"))) {
+    size_t frame_length_samples = self->settings.frame_length_samples;
+    ov_buffer *decoded_16bit = self->scratch.decoded_16bit;
+
+    entry->last_used_epoch_secs = time(0);
 
-        pcm16 = ov_buffer_free(pcm16);
+    if (decode_frame(entry->codec, frame, decoded_16bit) &&
+        ov_cond_valid(frame_length_samples * sizeof(int16_t) ==
+                          decoded_16bit->length,
+                      "Decoded RTP frame has unexpected length") &&
+        ov_cond_valid(ov_pcm_16_scale_to_32(frame_length_samples,
+                                            (int16_t *)decoded_16bit->start,
+                                            self->scratch.decoded_32bit, 1.0,
+                                            0, 0),
+                      "Could not scale decoded PCM to 32 bit") &&
+        ov_cond_valid(ov_pcm_32_add(frame_length_samples,
+                                    self->scratch.mixed_32bit,
+                                    self->scratch.decoded_32bit),
+                      "Could not add decoded RTP payload")) {
+
+        ++args->num_mixed_frames;
     }
 
-    decoded_16bit = ov_buffer_free(decoded_16bit);
-    decoded_32bit = ov_buffer_free(decoded_32bit);
-    mixed_32bit = ov_buffer_free(mixed_32bit);
+    frame = ov_rtp_frame_free(frame);
 
-    return pcm16;
+    return true;
 }
 
 /*----------------------------------------------------------------------------*/
 
-static bool process_frames(ov_alsa_rtp_mixer *self, ov_list *frames,
-                           ov_chunker *chunker_to_write_to) {
+/**
+ * Mixes the oldest frame of each stream into scratch.pcm16.
+ * @return number of frames taken from the streams
+ */
+static size_t mix_frames(ov_alsa_rtp_mixer *self, bool *ok) {
 
-    bool ok = false;
+    size_t frame_length_samples = self->settings.frame_length_samples;
 
-    if (ov_ptr_valid(self, "Cannot mix frames - invalid mixer pointer") &&
-        ov_ptr_valid_warn(frames, "Cannot mix frames - no frame list")) {
+    memset(self->scratch.mixed_32bit, 0,
+           frame_length_samples * sizeof(int32_t));
 
-        ov_buffer *mixed_payload =
-            mix_frames(self, frames, self->settings.frame_length_samples);
+    mix_args args = {.mixer = self};
 
-        if (0 != mixed_payload) {
+    ov_dict_for_each(self->streams, &args, mix_oldest_frame_of_stream);
 
-            ov_chunker_add(chunker_to_write_to, mixed_payload);
-            ok = true;
+    self->stats.frames_mixed += args.num_mixed_frames;
 
-        } else {
+    double scale_factor = OV_OR_DEFAULT(args.num_mixed_frames, 1);
 
-            ov_log_debug("No frame to forward to ALSA");
-            if (0 != self->comfort_noise.noisy_frame_16bit) {
-                ov_log_debug("Adding comfort noise");
-                ov_chunker_add(chunker_to_write_to,
-                               self->comfort_noise.noisy_frame_16bit);
+    *ok = ov_cond_valid(ov_pcm_32_scale(frame_length_samples,
+                                        self->scratch.mixed_32bit,
+                                        1.0 / scale_factor),
+                        "Could not scale mixed PCM") &&
+          ov_cond_valid(
+              ov_pcm_32_clip_to_16(frame_length_samples,
+                                   self->scratch.mixed_32bit,
+                                   (int16_t *)self->scratch.pcm16->start),
+              "Could not clip mixed PCM");
+
+    return args.num_frames;
+}
 
-            } else {
-                ov_log_debug("Comfort noise not added - not configured");
-            }
-        }
+/*----------------------------------------------------------------------------*/
 
-        mixed_payload = ov_buffer_free(mixed_payload);
-    }
+static bool process_frames(ov_alsa_rtp_mixer *self,
+                           ov_chunker *chunker_to_write_to) {
 
-    frames = free_frame_list(frames);
+    bool mixed = false;
 
-    return ok;
-}
+    if (0 == mix_frames(self, &mixed)) {
 
-/*----------------------------------------------------------------------------*/
+        ++self->stats.periods_silent;
+        ov_log_warning("Cannot mix frames - no frames to mix");
+        return false;
 
-static ov_list *frame_buffer_get_current_frames(ov_thread_lock *lock,
-                                                ov_rtp_frame_buffer *buffer) {
+    } else if (mixed) {
 
-    ov_list *frames = 0;
+        ov_chunker_add(chunker_to_write_to, self->scratch.pcm16);
+        return true;
 
-    if (ov_thread_lock_try_lock(lock)) {
+    } else {
 
-        frames = ov_rtp_frame_buffer_get_current_frames(buffer);
+        ov_log_debug("No frame to forward to ALSA");
+        if (0 != self->comfort_noise.noisy_frame_16bit) {
+            ov_log_debug("Adding comfort noise");
+            ov_chunker_add(chunker_to_write_to,
+                           self->comfort_noise.noisy_frame_16bit);
 
-        ov_thread_lock_unlock(lock);
-    }
+        } else {
+            ov_log_debug("Comfort noise not added - not configured");
+        }
 
-    return frames;
+        return false;
+    }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -474,10 +589,19 @@ bool ov_alsa_rtp_mixer_mix(ov_alsa_rtp_mixer *self,
 
     if (ov_ptr_valid(self, "Cannot mix frames - invalid mixer pointer")) {
 
-        ov_list *frame_list = frame_buffer_get_current_frames(
-            &self->frame_buffer_lock, self->frame_buffer);
+        uint64_t start_usecs = ov_time_get_current_time_usecs();
 
-        return process_frames(self, frame_list, chunker_to_write_to);
+        take_queued_frames(self);
+        bool ok = process_frames(self, chunker_to_write_to);
+
+        uint64_t mix_usecs = ov_time_get_current_time_usecs() - start_usecs;
+
+        ++self->stats.periods;
+        self->stats.mix_usecs_total += mix_usecs;
+        self->stats.mix_usecs_max =
+            OV_MAX(self->stats.mix_usecs_max, mix_usecs);
+
+        return ok;
 
     } else {
 
@@ -485,6 +609,23 @@ bool ov_alsa_rtp_mixer_mix(ov_alsa_rtp_mixer *self,
     }
 }
 
+/*----------------------------------------------------------------------------*/
+
+ov_alsa_rtp_mixer_stats
+ov_alsa_rtp_mixer_get_stats(ov_alsa_rtp_mixer const *self) {
+
+    ov_alsa_rtp_mixer_stats stats = {0};
+
+    if (0 != as_mixer(self)) {
+
+        stats = self->stats;
+        stats.frames_dropped += atomic_load_explicit(&self->frames_rejected,
+                                                     memory_order_relaxed);
+    }
+
+    return stats;
+}
+
 /*****************************************************************************
                       Garbage collection of stale streams
  ****************************************************************************/
@@ -506,7 +647,7 @@ static bool collect_stale_stream_ssids(const void *key, void *value,
                            "pointer") &&
         (sizeof(args->ssids) / sizeof(args->ssids[0]) > args->ssids_found)) {
 
-        codec_entry *entry = value;
+        stream_entry *entry = value;
 
         if ((0 != entry) &&
             (entry->last_used_epoch_secs < args->before_epoch_secs)) {
@@ -525,14 +666,14 @@ static bool collect_stale_stream_ssids(const void *key, void *value,
 
 /*----------------------------------------------------------------------------*/
 
-static void clean_codec_entries(ov_dict *codec_entries, gc_args args) {
+static void clean_stream_entries(ov_dict *stream_entries, gc_args args) {
 
     for (size_t i = 0; i < args.ssids_found; ++i) {
 
         ov_log_info("ALSA RTP mixer: Removing stale stream %" PRIu32,
                     args.ssids[i]);
         intptr_t ssidptr = args.ssids[i];
-        ov_dict_del(codec_entries, (void *)ssidptr);
+        ov_dict_del(stream_entries, (void *)ssidptr);
     }
 }
 
@@ -551,8 +692,8 @@ bool ov_alsa_rtp_mixer_garbage_collect(ov_alsa_rtp_mixer *self,
                      "Cannot perform garbage collection - invalid ALSA RTP "
                      "mixer")) {
 
-        ov_dict_for_each(self->codecs, &args, collect_stale_stream_ssids);
-        clean_codec_entries(self->codecs, args);
+        ov_dict_for_each(self->streams, &args, collect_stale_stream_ssids);
+        clean_stream_entries(self->streams, args);
 
         return true;
 
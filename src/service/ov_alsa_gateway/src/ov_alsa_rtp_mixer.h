@@ -23,6 +23,13 @@
         @author Michael J. Beer, DLR/GSOC
         @copyright (c) 2024 German Aerospace Center DLR e.V. (GSOC)
 
+        Frames are handed from the thread adding frames to the thread mixing
+        them by a lock free queue. There must be only one thread adding
+        frames and one thread mixing (and collecting garbage).
+
+        Mixing does not allocate memory as long as the set of streams
+        does not change.
+
         ------------------------------------------------------------------------
 */
 #ifndef OV_ALSA_MIXER_H
@@ -65,6 +72,26 @@ bool ov_alsa_rtp_mixer_mix(ov_alsa_rtp_mixer *self,
 
 /*----------------------------------------------------------------------------*/
 
+typedef struct {
+
+    uint64_t periods;        // calls to ov_alsa_rtp_mixer_mix
+    uint64_t periods_silent; // periods without any frame to mix
+    uint64_t frames_mixed;
+    uint64_t frames_dropped; // queue full, duplicate or too late
+
+    uint64_t mix_usecs_max;
+    uint64_t mix_usecs_total;
+
+} ov_alsa_rtp_mixer_stats;
+
+/**
+ * Must be called from the mixing thread.
+ */
+ov_alsa_rtp_mixer_stats
+ov_alsa_rtp_mixer_get_stats(ov_alsa_rtp_mixer const *self);
+
+/*----------------------------------------------------------------------------*/
+
 bool ov_alsa_rtp_mixer_garbage_collect(ov_alsa_rtp_mixer *self,
                                        uint32_t max_stream_lifetime_secs);
 
@@ -87,6 +87,10 @@ int main(int argc, char **argv) {
 
     app_config.loop = loop;
 
+    /* eventloops of the worker threads, if sharding is enabled */
+    app_config.proxy.sharding.loop = loop_config;
+    app_config.proxy.sharding.loop_create = ov_os_event_loop;
+
     app = ov_ice_proxy_vocs_app_create(app_config);
     if (!app) {
         ov_log_error("Failed to create APP");
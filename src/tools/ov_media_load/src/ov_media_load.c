@@ -0,0 +1,1454 @@
+/***
+        ------------------------------------------------------------------------
+
+        Copyright (c) 2026 German Aerospace Center DLR e.V. (GSOC)
+
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+                http://www.apache.org/licenses/LICENSE-2.0
+
+        Unless required by applicable law or agreed to in writing, software
+        distributed under the License is distributed on an "AS IS" BASIS,
+        WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+        See the License for the specific language governing permissions and
+        limitations under the License.
+
+        This file is part of the openvocs project. https://openvocs.org
+
+        ------------------------------------------------------------------------
+*//**
+        @file           ov_media_load.c
+
+        @date           2026-10-18
+
+        Load generator for the media plane.
+
+        Simulates users talking on loops: each user sends RTP frames with
+        talk / silence periods into the multicast group of its loop (or to
+        some unicast target, e.g. an interconnect). The media of each loop
+        is received back and analysed for latency, jitter and loss.
+
+        Mixed media, i.e. frames with SSRCs not sent by us, is decoded.
+        The onset of voice in the mix after silence is matched with the
+        talk spurt that ended the silence of all simulated users, which
+        gives the latency through the mixers.
+
+        Runs are reproducible: talk / silence periods are drawn from a
+        seeded generator, payloads are either encoded once at startup or
+        taken from a capture.
+
+        Results are written as JSON.
+
+        ------------------------------------------------------------------------
+*/
+
+#include <ov_base/ov_buffer.h>
+#include <ov_base/ov_event_loop.h>
+#include <ov_base/ov_histogram.h>
+#include <ov_base/ov_json.h>
+#include <ov_base/ov_mc_socket.h>
+#include <ov_base/ov_rtp_app.h>
+#include <ov_base/ov_rtp_frame.h>
+#include <ov_base/ov_rtp_source_stats.h>
+#include <ov_base/ov_socket.h>
+#include <ov_base/ov_string.h>
+#include <ov_base/ov_time.h>
+#include <ov_base/ov_utils.h>
+
+#include <ov_codec/ov_codec.h>
+#include <ov_codec/ov_codec_factory.h>
+
+#include <ov_format/ov_format.h>
+#include <ov_format/ov_format_pcap.h>
+#include <ov_format/ov_format_registry.h>
+#include <ov_format/ov_format_rtp.h>
+
+#include <ov_log/ov_log.h>
+#include <ov_os/ov_os_event_loop.h>
+
+#include <getopt.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*----------------------------------------------------------------------------*/
+
+#define MAX_WATCHED 32
+#define MAX_PAYLOADS 3000
+#define SENT_LOG 64
+#define PAYLOAD_TYPE 100
+#define SSRC_BASE 0x4f560000
+#define DRAIN_USECS 250000
+
+/* Onset detection on mixed media */
+#define VOICE_THRESHOLD 1000
+#define SILENCE_USECS 100000
+#define ONSET_WINDOW_USECS 1000000
+#define MAX_DECODED_SAMPLES 5760
+
+/*----------------------------------------------------------------------------*/
+
+#define PANIC(...)                                                             \
+    do {                                                                       \
+        fprintf(stderr, __VA_ARGS__);                                          \
+        exit(EXIT_FAILURE);                                                    \
+    } while (0)
+
+#define LOG(...) fprintf(stderr, __VA_ARGS__)
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    size_t users;
+    size_t loops;
+
+    uint32_t duration_secs;
+    uint64_t seed;
+
+    uint32_t talk_msecs;
+    uint32_t silence_msecs;
+    uint32_t frame_msecs;
+
+    char const *codec_name;
+    char const *pcap_file;
+    char const *domain_file;
+    char const *output_file;
+
+    ov_socket_configuration group;
+    ov_socket_configuration target;
+    ov_socket_configuration listen;
+
+    pid_t watched[MAX_WATCHED];
+    size_t num_watched;
+
+    bool enable_log;
+
+} load_config;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    ov_socket_configuration socket;
+    ov_rtp_app *app;
+
+    uint64_t frames;
+    uint64_t foreign_frames;
+
+    /* one entry per user, indexed by ssrc - SSRC_BASE */
+    ov_rtp_source_stats *streams;
+
+    ov_histogram latency_usecs;
+
+    /* frames with foreign SSRCs, decoded to detect voice onsets */
+    struct {
+
+        ov_codec *codec;
+        uint32_t ssrc;
+
+        uint64_t frames;
+        uint64_t undecodable;
+
+        uint64_t last_voice_usecs;
+        uint64_t onsets;
+        uint64_t matched_spurt;
+
+        ov_histogram latency_usecs;
+
+    } mix;
+
+} receiver;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    int sd;
+    size_t loop;
+
+    bool talking;
+    bool spurt_start;
+
+    uint16_t seq;
+    uint32_t timestamp;
+    uint64_t next_usecs;
+
+    size_t payload;
+
+    struct {
+        uint16_t seq;
+        uint64_t usecs;
+    } sent[SENT_LOG];
+
+} user;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint64_t ticks;
+    uint64_t stime;
+    char name[64];
+
+} cpu_sample;
+
+/*----------------------------------------------------------------------------*/
+
+static struct {
+
+    load_config config;
+
+    ov_event_loop *loop;
+
+    uint64_t rng;
+
+    user *users;
+
+    receiver *receivers;
+    size_t num_receivers;
+
+    struct sockaddr_storage *destinations;
+    socklen_t destination_len;
+
+    struct {
+        ov_buffer *data[MAX_PAYLOADS];
+        size_t count;
+    } payloads;
+
+    uint32_t samples_per_frame;
+
+    bool sending;
+    uint64_t start_usecs;
+    uint64_t stop_usecs;
+
+    struct {
+        uint64_t frames;
+        uint64_t bytes;
+        uint64_t spurts;
+        uint64_t failed;
+    } sent;
+
+    /* talk spurts starting after all users were silent for a while */
+    struct {
+        size_t talking;
+        uint64_t silent_since_usecs;
+        uint64_t id;
+        uint64_t usecs;
+    } spurt;
+
+    ov_histogram send_lag_usecs;
+
+    cpu_sample cpu_start[MAX_WATCHED + 1];
+    cpu_sample cpu_stop[MAX_WATCHED + 1];
+
+} g = {0};
+
+/*****************************************************************************
+                                 CONFIGURATION
+ ****************************************************************************/
+
+static const char usage_string[] =
+    "Simulates users talking on loops and reports latency, jitter, loss\n"
+    "and CPU usage as JSON\n\n"
+    "      -u, --users=N        number of simulated users (10)\n"
+    "      -m, --loops=M        number of loops (4)\n"
+    "      -d, --duration=SECS  duration of the run (10)\n"
+    "      -s, --seed=SEED      seed for talk / silence periods (1)\n"
+    "      -t, --talk=MSECS     mean talk period (1000)\n"
+    "      -q, --silence=MSECS  mean silence period (1500)\n"
+    "      -g, --group=HOST:PORT multicast group of the first loop,\n"
+    "                           loop i uses PORT + 2i (224.0.0.1:12345)\n"
+    "      -D, --domain=FILE    take the loops from a domain config\n"
+    "      -T, --target=HOST:PORT send to this unicast socket instead\n"
+    "                           of the multicast groups\n"
+    "      -l, --listen=HOST:PORT receive media on this unicast socket\n"
+    "                           as well\n"
+    "      -c, --codec=NAME     codec to encode payloads and to decode\n"
+    "                           mixed media with (opus)\n"
+    "      -p, --pcap=FILE      take payloads from RTP captured in FILE\n"
+    "      -w, --watch=PID[,PID] report CPU usage of these processes\n"
+    "      -o, --output=FILE    write results to FILE (stdout)\n"
+    "      -L, --log            turn on logging\n";
+
+_Noreturn static void usage(char const *binary_path) {
+
+    fprintf(stderr,
+            "Usage:\n\n"
+            "    %s [OPTION [...]]\n\n"
+            "%s\n\n\n",
+            binary_path, usage_string);
+
+    exit(EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool parse_socket(char const *in, ov_socket_configuration *out) {
+
+    char const *colon = strrchr(in, ':');
+
+    if ((0 == colon) || (colon == in) ||
+        ((size_t)(colon - in) >= sizeof(out->host)))
+        return false;
+
+    memset(out->host, 0, sizeof(out->host));
+    memcpy(out->host, in, (size_t)(colon - in));
+
+    char *end = 0;
+    long port = strtol(colon + 1, &end, 10);
+
+    if ((0 != *end) || (0 >= port) || (UINT16_MAX < port))
+        return false;
+
+    out->port = (uint16_t)port;
+    out->type = UDP;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool parse_pids(char const *in, load_config *cfg) {
+
+    char *end = 0;
+
+    while (0 != *in) {
+
+        long pid = strtol(in, &end, 10);
+
+        if ((end == in) || (0 >= pid) || (MAX_WATCHED <= cfg->num_watched))
+            return false;
+
+        cfg->watched[cfg->num_watched++] = (pid_t)pid;
+
+        in = end;
+
+        while ((',' == *in) || (' ' == *in))
+            ++in;
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t parse_number(char const *in, uint32_t min) {
+
+    char *end = 0;
+    unsigned long number = strtoul(in, &end, 0);
+
+    if ((0 != *end) || (min > number) || (UINT32_MAX < number))
+        PANIC("Invalid number %s\n", in);
+
+    return (uint32_t)number;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static load_config get_config(int argc, char **argv) {
+
+    load_config cfg = (load_config){
+
+        .users = 10,
+        .loops = 4,
+        .duration_secs = 10,
+        .seed = 1,
+        .talk_msecs = 1000,
+        .silence_msecs = 1500,
+        .frame_msecs = OV_DEFAULT_FRAME_LENGTH_MS,
+        .codec_name = "opus",
+        .group = {.host = "224.0.0.1", .port = 12345, .type = UDP},
+
+    };
+
+    struct option longopts[] = {
+
+        {"users", required_argument, 0, 'u'},
+        {"loops", required_argument, 0, 'm'},
+        {"duration", required_argument, 0, 'd'},
+        {"seed", required_argument, 0, 's'},
+        {"talk", required_argument, 0, 't'},
+        {"silence", required_argument, 0, 'q'},
+        {"group", required_argument, 0, 'g'},
+        {"domain", required_argument, 0, 'D'},
+        {"target", required_argument, 0, 'T'},
+        {"listen", required_argument, 0, 'l'},
+        {"codec", required_argument, 0, 'c'},
+        {"pcap", required_argument, 0, 'p'},
+        {"watch", required_argument, 0, 'w'},
+        {"output", required_argument, 0, 'o'},
+        {"log", no_argument, 0, 'L'},
+        {"help", no_argument, 0, 'h'},
+        {0},
+    };
+
+    while (true) {
+
+        int option_index = 0;
+        int c = getopt_long(argc, argv, "u:m:d:s:t:q:g:D:T:l:c:p:w:o:Lh",
+                            longopts, &option_index);
+
+        if (-1 == c) {
+            break;
+        }
+
+        switch (c) {
+
+        case 'u':
+            cfg.users = parse_number(optarg, 1);
+            break;
+
+        case 'm':
+            cfg.loops = parse_number(optarg, 1);
+            break;
+
+        case 'd':
+            cfg.duration_secs = parse_number(optarg, 1);
+            break;
+
+        case 's':
+            cfg.seed = parse_number(optarg, 0);
+            break;
+
+        case 't':
+            cfg.talk_msecs = parse_number(optarg, cfg.frame_msecs);
+            break;
+
+        case 'q':
+            cfg.silence_msecs = parse_number(optarg, cfg.frame_msecs);
+            break;
+
+        case 'g':
+            if (!parse_socket(optarg, &cfg.group))
+                PANIC("Invalid socket %s\n", optarg);
+            break;
+
+        case 'D':
+            cfg.domain_file = optarg;
+            break;
+
+        case 'T':
+            if (!parse_socket(optarg, &cfg.target))
+                PANIC("Invalid socket %s\n", optarg);
+            break;
+
+        case 'l':
+            if (!parse_socket(optarg, &cfg.listen))
+                PANIC("Invalid socket %s\n", optarg);
+            break;
+
+        case 'c':
+            cfg.codec_name = optarg;
+            break;
+
+        case 'p':
+            cfg.pcap_file = optarg;
+            break;
+
+        case 'w':
+            if (!parse_pids(optarg, &cfg))
+                PANIC("Invalid process list %s\n", optarg);
+            break;
+
+        case 'o':
+            cfg.output_file = optarg;
+            break;
+
+        case 'L':
+            cfg.enable_log = true;
+            break;
+
+        default:
+            usage(argv[0]);
+        };
+    }
+
+    return cfg;
+}
+
+/*****************************************************************************
+                                     LOOPS
+ ****************************************************************************/
+
+static bool add_domain_loop(const void *key, void *value, void *data) {
+
+    UNUSED(key);
+
+    size_t *count = data;
+
+    if (*count >= g.config.loops)
+        return true;
+
+    ov_json_value const *multicast = ov_json_get(value, "/multicast");
+
+    if (0 == multicast)
+        return true;
+
+    ov_socket_configuration scfg = ov_socket_configuration_from_json(
+        multicast, (ov_socket_configuration){.type = UDP});
+
+    scfg.type = UDP;
+
+    if ((0 == scfg.host[0]) || (0 == scfg.port))
+        return true;
+
+    g.receivers[(*count)++].socket = scfg;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t loops_from_domain(char const *path) {
+
+    ov_json_value *domain = ov_json_read_file(path);
+
+    if (0 == domain)
+        PANIC("Could not read domain config %s\n", path);
+
+    size_t count = 0;
+
+    ov_json_object_for_each((ov_json_value *)ov_json_get(domain, "/loops"),
+                            &count, add_domain_loop);
+
+    domain = ov_json_value_free(domain);
+
+    return count;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void setup_loop_sockets() {
+
+    /* one receiver per loop, one more for --listen */
+
+    g.receivers = calloc(g.config.loops + 1, sizeof(receiver));
+
+    if (0 != g.config.domain_file) {
+
+        g.config.loops = loops_from_domain(g.config.domain_file);
+
+        if (0 == g.config.loops)
+            PANIC("No multicast loops in %s\n", g.config.domain_file);
+
+    } else {
+
+        for (size_t i = 0; i < g.config.loops; ++i) {
+
+            g.receivers[i].socket = g.config.group;
+            g.receivers[i].socket.port += 2 * i;
+        }
+    }
+
+    g.num_receivers = g.config.loops;
+
+    g.destinations = calloc(g.config.loops, sizeof(struct sockaddr_storage));
+    g.destination_len = sizeof(struct sockaddr_in);
+
+    for (size_t i = 0; i < g.config.loops; ++i) {
+
+        ov_socket_configuration dest = g.receivers[i].socket;
+
+        if (0 != g.config.target.host[0])
+            dest = g.config.target;
+
+        if (!ov_socket_fill_sockaddr_storage(g.destinations + i, AF_INET,
+                                             dest.host, dest.port))
+            PANIC("Could not resolve %s:%" PRIu16 "\n", dest.host, dest.port);
+    }
+}
+
+/*****************************************************************************
+                                    PAYLOADS
+ ****************************************************************************/
+
+static bool add_payload(uint8_t const *data, size_t length) {
+
+    if ((0 == length) || (MAX_PAYLOADS <= g.payloads.count))
+        return false;
+
+    ov_buffer *buffer = ov_buffer_create(length);
+    memcpy(buffer->start, data, length);
+    buffer->length = length;
+
+    g.payloads.data[g.payloads.count++] = buffer;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_format *open_pcap_as_rtp_format(char const *pcap_path) {
+
+    ov_format *fmt = ov_format_open(pcap_path, OV_READ);
+    ov_format *next = 0;
+
+    if (0 == fmt)
+        goto error;
+
+    next = ov_format_as(fmt, "pcap", 0, 0);
+    if (0 == next)
+        goto error;
+
+    fmt = ov_format_pcap_create_network_layer_format(next);
+    next = 0;
+    if (0 == fmt)
+        goto error;
+
+    next = ov_format_as(fmt, "udp", 0, 0);
+    if (0 == next)
+        goto error;
+
+    fmt = ov_format_as(next, "rtp", 0, 0);
+    next = 0;
+
+    return fmt;
+
+error:
+
+    fmt = ov_format_close(fmt);
+    next = ov_format_close(next);
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void payloads_from_pcap(char const *path) {
+
+    ov_format *rtp_fmt = open_pcap_as_rtp_format(path);
+
+    if (0 == rtp_fmt)
+        PANIC("Could not open %s as PCAP/Ethernet/IP/UDP/RTP\n", path);
+
+    while (ov_format_has_more_data(rtp_fmt)) {
+
+        ov_buffer payload = ov_format_payload_read_chunk_nocopy(rtp_fmt, 0);
+
+        ov_buffer *padding = ov_format_rtp_get_padding(rtp_fmt);
+
+        /* SRTP frames carry padding, their payload is useless here */
+
+        if ((0 != padding) && (OV_FORMAT_RTP_NO_PADDING != padding))
+            continue;
+
+        if ((0 != payload.start) && !add_payload(payload.start, payload.length))
+            break;
+    }
+
+    rtp_fmt = ov_format_close(rtp_fmt);
+
+    if (0 == g.payloads.count)
+        PANIC("No RTP payloads found in %s\n", path);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void payloads_from_codec(char const *codec_name) {
+
+    /* One second of a voice like signal - a gliding tone with some
+     * syllable rate amplitude modulation - encoded once and replayed.
+     * The envelope stays above VOICE_THRESHOLD, so dips do not look
+     * like voice onsets in the mix */
+
+    ov_codec *codec = ov_codec_factory_get_codec(0, codec_name, 1, 0);
+
+    if (0 == codec)
+        PANIC("Codec %s not available\n", codec_name);
+
+    uint32_t rate = ov_codec_get_samplerate_hertz(codec);
+    size_t frames = 1000 / g.config.frame_msecs;
+
+    g.samples_per_frame = rate * g.config.frame_msecs / 1000;
+
+    int16_t pcm[g.samples_per_frame];
+    uint8_t encoded[OV_UDP_PAYLOAD_OCTETS];
+
+    double phase = 0;
+
+    for (size_t f = 0; f < frames; ++f) {
+
+        for (size_t i = 0; i < g.samples_per_frame; ++i) {
+
+            double t = (double)(f * g.samples_per_frame + i) / rate;
+            double frequency = 180.0 + 60.0 * sin(2 * M_PI * 0.7 * t);
+            double envelope = 0.6 + 0.4 * sin(2 * M_PI * 4.0 * t);
+
+            phase += 2 * M_PI * frequency / rate;
+            pcm[i] = (int16_t)(8000.0 * envelope * sin(phase));
+        }
+
+        int32_t bytes =
+            ov_codec_encode(codec, (uint8_t *)pcm, sizeof(pcm), encoded,
+                            sizeof(encoded));
+
+        if (0 >= bytes)
+            PANIC("Could not encode with %s\n", codec_name);
+
+        add_payload(encoded, (size_t)bytes);
+    }
+
+    codec = ov_codec_free(codec);
+}
+
+/*****************************************************************************
+                                    RECEIVING
+ ****************************************************************************/
+
+static bool has_voice(receiver *r, ov_rtp_frame_expansion const *rtp) {
+
+    if ((0 != r->mix.codec) && (rtp->ssrc != r->mix.ssrc))
+        r->mix.codec = ov_codec_free(r->mix.codec);
+
+    if (0 == r->mix.codec) {
+
+        r->mix.ssrc = rtp->ssrc;
+        r->mix.codec = ov_codec_factory_get_codec(0, g.config.codec_name,
+                                                  rtp->ssrc, 0);
+    }
+
+    int16_t pcm[MAX_DECODED_SAMPLES];
+
+    int32_t bytes = -1;
+
+    if (0 != r->mix.codec) {
+
+        bytes = ov_codec_decode(r->mix.codec, rtp->sequence_number,
+                                rtp->payload.data, rtp->payload.length,
+                                (uint8_t *)pcm, sizeof(pcm));
+    }
+
+    if (0 > bytes) {
+        ++r->mix.undecodable;
+        return false;
+    }
+
+    size_t samples = (size_t)bytes / sizeof(int16_t);
+
+    for (size_t i = 0; i < samples; ++i) {
+
+        if ((VOICE_THRESHOLD <= pcm[i]) || (-VOICE_THRESHOLD >= pcm[i]))
+            return true;
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void analyse_mix(receiver *r, ov_rtp_frame_expansion const *rtp,
+                        uint64_t now) {
+
+    ++r->mix.frames;
+
+    if (!has_voice(r, rtp))
+        return;
+
+    /* Voice after silence, or after the mixer stopped sending */
+
+    bool onset = (0 == r->mix.last_voice_usecs) ||
+                 (now >= r->mix.last_voice_usecs + SILENCE_USECS);
+
+    r->mix.last_voice_usecs = now;
+
+    if (!onset)
+        return;
+
+    ++r->mix.onsets;
+
+    if ((0 == g.spurt.id) || (r->mix.matched_spurt == g.spurt.id) ||
+        (now < g.spurt.usecs) || (now > g.spurt.usecs + ONSET_WINDOW_USECS))
+        return;
+
+    r->mix.matched_spurt = g.spurt.id;
+    ov_histogram_add(&r->mix.latency_usecs, now - g.spurt.usecs);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool cb_rtp(ov_rtp_frame *frame, void *userdata) {
+
+    receiver *r = userdata;
+    uint64_t now = ov_time_get_current_time_usecs();
+
+    ov_rtp_frame_expansion const *rtp = &frame->expanded;
+
+    ++r->frames;
+
+    uint32_t index = rtp->ssrc - SSRC_BASE;
+
+    if ((rtp->ssrc < SSRC_BASE) || (index >= g.config.users)) {
+
+        ++r->foreign_frames;
+        analyse_mix(r, rtp, now);
+
+    } else {
+
+        user const *u = g.users + index;
+
+        ov_rtp_source_stats_update(r->streams + index, rtp->sequence_number,
+                                   rtp->timestamp, now);
+
+        size_t slot = rtp->sequence_number % SENT_LOG;
+
+        if ((u->sent[slot].seq == rtp->sequence_number) &&
+            (0 != u->sent[slot].usecs) && (now >= u->sent[slot].usecs)) {
+
+            ov_histogram_add(&r->latency_usecs, now - u->sent[slot].usecs);
+        }
+    }
+
+    frame = ov_rtp_frame_free(frame);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void open_receiver(receiver *r, bool multicast) {
+
+    r->streams = calloc(g.config.users, sizeof(ov_rtp_source_stats));
+
+    for (size_t i = 0; r->streams && (i < g.config.users); ++i) {
+        r->streams[i].clock_rate_hz =
+            g.samples_per_frame * 1000 / g.config.frame_msecs;
+    }
+
+    r->app = ov_rtp_app_create(g.loop, (ov_rtp_app_config){
+                                           .multicast = multicast,
+                                           .rtp_socket = r->socket,
+                                           .rtp_handler = cb_rtp,
+                                           .rtp_handler_userdata = r,
+                                       });
+
+    if (0 == r->app)
+        PANIC("Could not receive on %s:%" PRIu16 "\n", r->socket.host,
+              r->socket.port);
+}
+
+/*****************************************************************************
+                                    SENDING
+ ****************************************************************************/
+
+static uint64_t next_random() {
+
+    /* xorshift64* - same sequence on any platform for some seed */
+
+    g.rng ^= g.rng >> 12;
+    g.rng ^= g.rng << 25;
+    g.rng ^= g.rng >> 27;
+
+    return g.rng * 0x2545F4914F6CDD1DULL;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool chance(uint32_t numerator, uint32_t denominator) {
+
+    return (next_random() >> 11) % denominator < numerator;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void update_talk_state(user *u, uint64_t now) {
+
+    /* Periods are geometrically distributed per frame, i.e. the
+     * discrete version of exponentially distributed talk spurts */
+
+    if (u->talking) {
+
+        u->talking = !chance(g.config.frame_msecs, g.config.talk_msecs);
+
+        if (!u->talking && (0 == --g.spurt.talking))
+            g.spurt.silent_since_usecs = now;
+
+    } else if (chance(g.config.frame_msecs, g.config.silence_msecs)) {
+
+        u->talking = true;
+        u->spurt_start = true;
+        ++g.sent.spurts;
+
+        /* Only spurts ending a silence of all users are recognizable
+         * as onsets in the mix */
+
+        if ((0 == g.spurt.talking++) &&
+            (now >= g.spurt.silent_since_usecs + SILENCE_USECS)) {
+
+            ++g.spurt.id;
+            g.spurt.usecs = now;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void send_frame(user *u, uint32_t ssrc, uint64_t now) {
+
+    ov_buffer const *payload = g.payloads.data[u->payload];
+
+    u->payload = (u->payload + 1) % g.payloads.count;
+
+    ov_rtp_frame *frame = ov_rtp_frame_encode(&(ov_rtp_frame_expansion){
+        .version = RTP_VERSION_2,
+        .marker_bit = u->spurt_start,
+        .payload_type = PAYLOAD_TYPE,
+        .sequence_number = u->seq,
+        .timestamp = u->timestamp,
+        .ssrc = ssrc,
+        .payload.length = payload->length,
+        .payload.data = payload->start,
+    });
+
+    if (0 == frame) {
+        ++g.sent.failed;
+        return;
+    }
+
+    size_t slot = u->seq % SENT_LOG;
+
+    u->sent[slot].seq = u->seq;
+    u->sent[slot].usecs = now;
+
+    if (ov_rtp_app_send_to_sockaddr(
+            u->sd, frame, (struct sockaddr *)(g.destinations + u->loop),
+            g.destination_len)) {
+
+        ++g.sent.frames;
+        g.sent.bytes += frame->bytes.length;
+
+    } else {
+
+        ++g.sent.failed;
+    }
+
+    frame = ov_rtp_frame_free(frame);
+
+    u->spurt_start = false;
+    ++u->seq;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool cb_tick(uint32_t id, void *data);
+
+static void schedule_tick() {
+
+    uint64_t now = ov_time_get_current_time_usecs();
+    uint64_t next = UINT64_MAX;
+
+    for (size_t i = 0; i < g.config.users; ++i) {
+
+        if (g.users[i].next_usecs < next)
+            next = g.users[i].next_usecs;
+    }
+
+    if (OV_TIMER_INVALID ==
+        g.loop->timer.set(g.loop, next > now ? next - now : 0, 0, cb_tick)) {
+
+        /* no more frames would be sent, results would be bogus */
+        LOG("Could not schedule sending, stopping\n");
+        g.sending = false;
+        g.loop->stop(g.loop);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool cb_tick(uint32_t id, void *data) {
+
+    UNUSED(id);
+    UNUSED(data);
+
+    if (!g.sending)
+        return true;
+
+    uint64_t frame_usecs = 1000 * g.config.frame_msecs;
+    uint64_t now = ov_time_get_current_time_usecs();
+
+    for (size_t i = 0; i < g.config.users; ++i) {
+
+        user *u = g.users + i;
+
+        while (u->next_usecs <= now) {
+
+            ov_histogram_add(&g.send_lag_usecs, now - u->next_usecs);
+
+            update_talk_state(u, now);
+
+            if (u->talking)
+                send_frame(u, SSRC_BASE + i, now);
+
+            u->timestamp += g.samples_per_frame;
+            u->next_usecs += frame_usecs;
+        }
+    }
+
+    schedule_tick();
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void setup_users() {
+
+    uint64_t frame_usecs = 1000 * g.config.frame_msecs;
+
+    g.users = calloc(g.config.users, sizeof(user));
+
+    g.rng = g.config.seed * 0x9E3779B97F4A7C15ULL + 1;
+
+    ov_socket_configuration any = {.host = "0.0.0.0", .type = UDP};
+
+    for (size_t i = 0; i < g.config.users; ++i) {
+
+        user *u = g.users + i;
+
+        u->sd = ov_socket_create(any, false, 0);
+
+        if (0 > u->sd)
+            PANIC("Could not open socket for user %zu\n", i);
+
+        u->loop = i % g.config.loops;
+
+        /* spread the users over one frame period */
+        u->next_usecs = g.start_usecs + i * frame_usecs / g.config.users;
+
+        u->seq = (uint16_t)next_random();
+        u->timestamp = (uint32_t)next_random();
+        u->payload = next_random() % g.payloads.count;
+
+        u->talking = chance(g.config.talk_msecs,
+                            g.config.talk_msecs + g.config.silence_msecs);
+        u->spurt_start = u->talking;
+
+        if (u->talking)
+            ++g.spurt.talking;
+    }
+}
+
+/*****************************************************************************
+                                      CPU
+ ****************************************************************************/
+
+static bool sample_cpu(pid_t pid, cpu_sample *sample) {
+
+    char path[64] = {0};
+    char line[1024] = {0};
+
+    snprintf(path, sizeof(path), "/proc/%i/stat", (int)pid);
+
+    FILE *f = fopen(path, "r");
+
+    if (0 == f)
+        return false;
+
+    size_t length = fread(line, 1, sizeof(line) - 1, f);
+    fclose(f);
+
+    /* the command is in parentheses and might contain anything */
+
+    char *open = strchr(line, '(');
+    char *close = strrchr(line, ')');
+
+    if ((0 == length) || (0 == open) || (0 == close) || (close < open))
+        return false;
+
+    size_t name_length = (size_t)(close - open - 1);
+
+    if (name_length >= sizeof(sample->name))
+        name_length = sizeof(sample->name) - 1;
+
+    memcpy(sample->name, open + 1, name_length);
+    sample->name[name_length] = 0;
+
+    unsigned long utime = 0;
+    unsigned long stime = 0;
+
+    /* fields 3 - 15: state ... utime stime */
+
+    if (2 != sscanf(close + 2,
+                    "%*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu",
+                    &utime, &stime)) {
+        return false;
+    }
+
+    sample->ticks = utime + stime;
+    sample->stime = stime;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void sample_all_cpus(cpu_sample *samples) {
+
+    sample_cpu(getpid(), samples);
+
+    for (size_t i = 0; i < g.config.num_watched; ++i) {
+
+        if (!sample_cpu(g.config.watched[i], samples + 1 + i))
+            LOG("Could not sample CPU of process %i\n", g.config.watched[i]);
+    }
+}
+
+/*****************************************************************************
+                                     RESULTS
+ ****************************************************************************/
+
+static bool set_number(ov_json_value *obj, char const *key, double number) {
+
+    return ov_json_object_set(obj, key, ov_json_number(number));
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *config_to_json() {
+
+    ov_json_value *out = ov_json_object();
+
+    set_number(out, "users", g.config.users);
+    set_number(out, "loops", g.config.loops);
+    set_number(out, "duration_secs", g.config.duration_secs);
+    set_number(out, "seed", g.config.seed);
+    set_number(out, "talk_msecs", g.config.talk_msecs);
+    set_number(out, "silence_msecs", g.config.silence_msecs);
+    set_number(out, "frame_msecs", g.config.frame_msecs);
+
+    ov_json_object_set(out, "payloads",
+                       ov_json_string(0 != g.config.pcap_file
+                                          ? g.config.pcap_file
+                                          : g.config.codec_name));
+
+    return out;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *receiver_to_json(receiver const *r, double secs) {
+
+    ov_json_value *out = ov_json_object();
+
+    char socket[OV_HOST_NAME_MAX + 10] = {0};
+    snprintf(socket, sizeof(socket), "%s:%" PRIu16, r->socket.host,
+             r->socket.port);
+
+    ov_json_object_set(out, "socket", ov_json_string(socket));
+
+    uint64_t expected = 0;
+    int64_t lost = 0;
+    uint64_t duplicates = 0;
+    uint64_t reordered = 0;
+    size_t streams = 0;
+
+    ov_histogram jitter = {0};
+
+    for (size_t i = 0; i < g.config.users; ++i) {
+
+        ov_rtp_source_stats const *s = r->streams + i;
+
+        if (0 == s->packets)
+            continue;
+
+        ++streams;
+        expected += ov_rtp_source_stats_expected(s);
+        lost += ov_rtp_source_stats_lost(s);
+        duplicates += s->duplicates;
+        reordered += s->reordered;
+
+        ov_histogram_add(&jitter,
+                         (uint64_t)ov_rtp_source_stats_jitter_usecs(s));
+    }
+
+    set_number(out, "frames", r->frames);
+    set_number(out, "frames_per_sec", r->frames / secs);
+    set_number(out, "foreign_frames", r->foreign_frames);
+    set_number(out, "streams", streams);
+    set_number(out, "lost", lost);
+    set_number(out, "loss_percent", expected ? 100.0 * lost / expected : 0);
+    set_number(out, "duplicates", duplicates);
+    set_number(out, "reordered", reordered);
+
+    ov_json_object_set(out, "latency_usecs",
+                       ov_histogram_to_json(&r->latency_usecs));
+    ov_json_object_set(out, "jitter_usecs", ov_histogram_to_json(&jitter));
+
+    ov_json_value *mix = ov_json_object();
+
+    set_number(mix, "frames", r->mix.frames);
+    set_number(mix, "undecodable", r->mix.undecodable);
+    set_number(mix, "onsets", r->mix.onsets);
+    ov_json_object_set(mix, "latency_usecs",
+                       ov_histogram_to_json(&r->mix.latency_usecs));
+
+    ov_json_object_set(out, "mix", mix);
+
+    return out;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *cpu_to_json(double secs) {
+
+    ov_json_value *out = ov_json_array();
+    long ticks_per_sec = sysconf(_SC_CLK_TCK);
+
+    for (size_t i = 0; i < 1 + g.config.num_watched; ++i) {
+
+        cpu_sample const *start = g.cpu_start + i;
+        cpu_sample const *stop = g.cpu_stop + i;
+
+        if ((0 == stop->name[0]) || (stop->ticks < start->ticks))
+            continue;
+
+        ov_json_value *process = ov_json_object();
+
+        set_number(process, "pid",
+                   0 == i ? getpid() : g.config.watched[i - 1]);
+        ov_json_object_set(process, "name", ov_json_string(stop->name));
+
+        set_number(process, "cpu_percent",
+                   100.0 * (stop->ticks - start->ticks) / ticks_per_sec /
+                       secs);
+        set_number(process, "system_percent",
+                   100.0 * (stop->stime - start->stime) / ticks_per_sec /
+                       secs);
+
+        ov_json_array_push(out, process);
+    }
+
+    return out;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static ov_json_value *results_to_json() {
+
+    double secs = (g.stop_usecs - g.start_usecs) / 1e6;
+
+    ov_json_value *out = ov_json_object();
+    ov_json_value *sent = ov_json_object();
+    ov_json_value *receivers = ov_json_array();
+
+    ov_json_object_set(out, "config", config_to_json());
+
+    set_number(sent, "frames", g.sent.frames);
+    set_number(sent, "frames_per_sec", g.sent.frames / secs);
+    set_number(sent, "bytes", g.sent.bytes);
+    set_number(sent, "failed", g.sent.failed);
+    set_number(sent, "spurts", g.sent.spurts);
+    set_number(sent, "spurts_after_silence", g.spurt.id);
+
+    ov_json_object_set(sent, "lag_usecs",
+                       ov_histogram_to_json(&g.send_lag_usecs));
+
+    ov_json_object_set(out, "sent", sent);
+
+    for (size_t i = 0; i < g.num_receivers; ++i) {
+        ov_json_array_push(receivers, receiver_to_json(g.receivers + i, secs));
+    }
+
+    ov_json_object_set(out, "receivers", receivers);
+    ov_json_object_set(out, "cpu", cpu_to_json(secs));
+
+    return out;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool write_results(char const *path) {
+
+    ov_json_value *results = results_to_json();
+    char *str = ov_json_value_to_string(results);
+
+    results = ov_json_value_free(results);
+
+    if (0 == str)
+        return false;
+
+    FILE *out = stdout;
+
+    if ((0 != path) && (0 == (out = fopen(path, "w")))) {
+
+        LOG("Could not open %s: %s\n", path, strerror(errno));
+        str = ov_free(str);
+        return false;
+    }
+
+    fprintf(out, "%s\n", str);
+
+    if (stdout != out)
+        fclose(out);
+
+    str = ov_free(str);
+
+    return true;
+}
+
+/*****************************************************************************
+                                      RUN
+ ****************************************************************************/
+
+static bool cb_drained(uint32_t id, void *data) {
+
+    UNUSED(id);
+    UNUSED(data);
+
+    g.loop->stop(g.loop);
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool cb_duration(uint32_t id, void *data) {
+
+    UNUSED(id);
+    UNUSED(data);
+
+    /* stop sending, but receive frames still in flight */
+
+    g.sending = false;
+    g.stop_usecs = ov_time_get_current_time_usecs();
+
+    sample_all_cpus(g.cpu_stop);
+
+    if (OV_TIMER_INVALID ==
+        g.loop->timer.set(g.loop, DRAIN_USECS, 0, cb_drained)) {
+
+        g.loop->stop(g.loop);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void cleanup() {
+
+    for (size_t i = 0; i < g.num_receivers; ++i) {
+
+        g.receivers[i].app = ov_rtp_app_free(g.receivers[i].app);
+        g.receivers[i].streams = ov_free(g.receivers[i].streams);
+        g.receivers[i].mix.codec = ov_codec_free(g.receivers[i].mix.codec);
+    }
+
+    for (size_t i = 0; (0 != g.users) && (i < g.config.users); ++i) {
+
+        close(g.users[i].sd);
+    }
+
+    for (size_t i = 0; i < g.payloads.count; ++i) {
+
+        g.payloads.data[i] = ov_buffer_free(g.payloads.data[i]);
+    }
+
+    g.receivers = ov_free(g.receivers);
+    g.users = ov_free(g.users);
+    g.destinations = ov_free(g.destinations);
+
+    g.loop = ov_event_loop_free(g.loop);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int main(int argc, char **argv) {
+
+    ov_log_init();
+
+    g.config = get_config(argc, argv);
+
+    /* stdout is for the results */
+
+    ov_log_set_output(0, 0, g.config.enable_log ? OV_LOG_INFO : OV_LOG_ERR,
+                      (ov_log_output){
+                          .use.systemd = false,
+                          .filehandle = fileno(stderr),
+                      });
+
+    setup_loop_sockets();
+
+    if (0 != g.config.pcap_file) {
+
+        if (!ov_format_registry_register_default(0))
+            PANIC("Could not initialize formats\n");
+
+        payloads_from_pcap(g.config.pcap_file);
+
+        /* replayed payloads, assume the default frame size */
+        g.samples_per_frame =
+            OV_DEFAULT_SAMPLERATE * g.config.frame_msecs / 1000;
+
+    } else {
+
+        payloads_from_codec(g.config.codec_name);
+    }
+
+    g.loop = ov_os_event_loop((ov_event_loop_config){
+        .max.sockets = ov_socket_get_max_supported_runtime_sockets(0),
+        .max.timers = 10,
+    });
+
+    if ((0 == g.loop) || !ov_event_loop_setup_signals(g.loop))
+        PANIC("Could not create event loop\n");
+
+    for (size_t i = 0; i < g.config.loops; ++i) {
+
+        open_receiver(g.receivers + i, true);
+    }
+
+    if (0 != g.config.listen.host[0]) {
+
+        g.receivers[g.num_receivers].socket = g.config.listen;
+        open_receiver(g.receivers + g.num_receivers, false);
+        ++g.num_receivers;
+    }
+
+    g.start_usecs = ov_time_get_current_time_usecs();
+
+    setup_users();
+
+    sample_all_cpus(g.cpu_start);
+
+    g.sending = true;
+
+    schedule_tick();
+
+    if (OV_TIMER_INVALID ==
+        g.loop->timer.set(g.loop,
+                          1000 * 1000 * (uint64_t)g.config.duration_secs, 0,
+                          cb_duration)) {
+
+        PANIC("Could not schedule the end of the run\n");
+    }
+
+    LOG("%zu users talking on %zu loops for %" PRIu32 " s\n", g.config.users,
+        g.config.loops, g.config.duration_secs);
+
+    g.loop->run(g.loop, OV_RUN_MAX);
+
+    if (g.sending) {
+
+        /* interrupted */
+        g.stop_usecs = ov_time_get_current_time_usecs();
+        sample_all_cpus(g.cpu_stop);
+    }
+
+    int retval = write_results(g.config.output_file) ? EXIT_SUCCESS
+                                                      : EXIT_FAILURE;
+
+    cleanup();
+
+    if (0 != g.config.pcap_file)
+        ov_format_registry_clear(0);
+
+    ov_codec_factory_free(0);
+
+    ov_log_close();
+
+    return retval;
+}
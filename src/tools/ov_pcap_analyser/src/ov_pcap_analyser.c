@@ -35,11 +35,18 @@
 #include <ov_codec/ov_codec_opus.h>
 
 #include <ov_base/ov_dict.h>
+#include <ov_base/ov_rtp_source_stats.h>
+#include <ov_base/ov_rtp_view.h>
+#include <ov_base/ov_spsc_queue.h>
+#include <ov_base/ov_time.h>
 
 #include <opus.h>
 #include <ov_base/ov_utils.h>
 
 #include <fcntl.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -60,6 +67,15 @@ typedef struct {
     bool enable_log;
     bool list_streams;
 
+    struct {
+
+        bool enabled;
+        size_t jobs;
+        bool decode;
+        uint32_t clock_rate_hz;
+
+    } summary;
+
     struct {
 
         bool analyze;
@@ -95,7 +111,15 @@ static const char usage_string[] = "Prints analysis of an IP/UDP/RTP/OPUS "
                                    "      -L, --log      turn on logging\n"
                                    "      -l, --list     list ssids of all "
                                    "streams found at the end of the report\n"
-                                   "      -c, --csv      Output PCM as Tex \n";
+                                   "      -c, --csv      Output PCM as Tex \n"
+                                   "      -S, --summary  print a summary of "
+                                   "all streams, read in one pass\n"
+                                   "      -j N, --jobs=N analyse streams "
+                                   "with N threads (summary only)\n"
+                                   "      -d, --decode   decode all streams "
+                                   "(summary only)\n"
+                                   "      -r HZ, --rate=HZ RTP clock rate "
+                                   "for jitter (summary only)\n";
 
 _Noreturn void usage(char const *binary_path) {
 
@@ -119,6 +143,7 @@ static analyser_config get_config(int argc, char **argv) {
         .pcap_file = 0,
         .codec_name = ov_codec_opus_id(),
         .enable_log = false,
+        .summary.clock_rate_hz = OV_DEFAULT_SAMPLERATE,
 
     };
 
@@ -167,17 +192,55 @@ static analyser_config get_config(int argc, char **argv) {
 
     };
 
+    struct option opt_summary = {
+
+        .name = "summary",
+        .has_arg = no_argument,
+        .flag = 0,
+        .val = 'S',
+
+    };
+
+    struct option opt_jobs = {
+
+        .name = "jobs",
+        .has_arg = required_argument,
+        .flag = 0,
+        .val = 'j',
+
+    };
+
+    struct option opt_decode = {
+
+        .name = "decode",
+        .has_arg = no_argument,
+        .flag = 0,
+        .val = 'd',
+
+    };
+
+    struct option opt_rate = {
+
+        .name = "rate",
+        .has_arg = required_argument,
+        .flag = 0,
+        .val = 'r',
+
+    };
+
     struct option opt_null = {0};
 
-    struct option longopts[] = {opt_list_streams, opt_csv,       opt_stream,
-                                opt_log,          opt_pcap_file, opt_null};
+    struct option longopts[] = {
+        opt_list_streams, opt_csv,     opt_stream, opt_log,  opt_pcap_file,
+        opt_summary,      opt_jobs,    opt_decode, opt_rate, opt_null};
 
     int c = 0;
 
     while (true) {
 
         int option_index = 0;
-        c = getopt_long(argc, argv, "lLf:s:c", longopts, &option_index);
+        c = getopt_long(argc, argv, "lLf:s:cSj:dr:", longopts,
+                        &option_index);
 
         if (-1 == c) {
             break;
@@ -217,6 +280,31 @@ static analyser_config get_config(int argc, char **argv) {
             cfg.enable_log = true;
             break;
 
+        case 'S':
+
+            cfg.summary.enabled = true;
+            break;
+
+        case 'j':
+
+            cfg.summary.jobs = strtoul(optarg, 0, 0);
+            break;
+
+        case 'd':
+
+            cfg.summary.decode = true;
+            break;
+
+        case 'r':
+
+            cfg.summary.clock_rate_hz = strtoul(optarg, 0, 0);
+
+            if (0 == cfg.summary.clock_rate_hz) {
+                usage(argv[0]);
+            }
+
+            break;
+
         default:
 
             LOG_WARN("unknown option %c\n", c);
@@ -792,6 +880,737 @@ static void parse_rtp(ov_format *rtp_fmt, bool print_ssrcs) {
 
 /*----------------------------------------------------------------------------*/
 
+/*****************************************************************************
+                               STREAMING SUMMARY
+
+    Reads the capture in one pass: The file is mapped, the packets are
+    parsed by a header only fast path (pcap -> ethernet / linux sll ->
+    ipv4 / ipv6 -> udp -> rtp) without any copying, and passed on in
+    batches to worker threads. Streams are sharded by SSRC, hence any
+    stream is analysed by exactly one worker and no locking is required
+    beyond the batch queues.
+ ****************************************************************************/
+
+#define SUMMARY_BATCH_PACKETS 1024
+#define SUMMARY_BATCHES_PER_WORKER 64
+#define SUMMARY_MAX_JOBS 64
+
+#define PCAP_GLOBAL_HEADER_OCTETS 24
+#define PCAP_PACKET_HEADER_OCTETS 16
+
+#define ETHERTYPE_IPV4 0x0800
+#define ETHERTYPE_IPV6 0x86dd
+#define ETHERTYPE_VLAN 0x8100
+#define ETHERTYPE_QINQ 0x88a8
+
+#define IP_PROTOCOL_UDP 17
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint64_t arrival_usecs;
+
+    /* points into the mapped capture */
+    uint8_t const *payload;
+    uint32_t payload_length;
+
+    uint32_t ssrc;
+    uint32_t timestamp;
+    uint16_t sequence_number;
+    uint8_t payload_type;
+
+} packet_ref;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    size_t count;
+    packet_ref packets[SUMMARY_BATCH_PACKETS];
+
+} packet_batch;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint32_t ssrc;
+    uint8_t payload_type;
+
+    uint64_t bytes;
+    ov_rtp_source_stats rtp;
+
+    ov_codec *codec;
+    uint64_t decoded_samples;
+    uint64_t decode_errors;
+
+} stream_summary;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    pthread_t thread;
+
+    /* main -> worker */
+    ov_spsc_queue *full;
+    sem_t full_sem;
+
+    /* worker -> main */
+    ov_spsc_queue *empty;
+    sem_t empty_sem;
+
+    size_t allocated;
+    packet_batch *current;
+
+    ov_codec_factory *codecs;
+    ov_dict *streams;
+
+} stream_worker;
+
+/*----------------------------------------------------------------------------*/
+
+typedef struct {
+
+    uint64_t packets;
+    uint64_t rtp;
+    uint64_t srtp;
+    uint64_t other;
+    uint64_t truncated;
+
+} capture_counters;
+
+/*----------------------------------------------------------------------------*/
+
+static uint16_t read_be16(uint8_t const *ptr) {
+
+    return (uint16_t)((ptr[0] << 8) | ptr[1]);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint32_t read_u32(uint8_t const *ptr, bool swapped) {
+
+    uint32_t value = 0;
+    memcpy(&value, ptr, sizeof(value));
+
+    return swapped ? __builtin_bswap32(value) : value;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *free_stream_summary(void *vptr) {
+
+    stream_summary *stream = vptr;
+
+    if (0 != stream) {
+
+        stream->codec = ov_codec_free(stream->codec);
+        free(stream);
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static stream_summary *get_stream_summary(stream_worker *worker,
+                                          packet_ref const *packet) {
+
+    /* 0 is no valid key, but a valid SSRC */
+    intptr_t key = (intptr_t)packet->ssrc + 1;
+
+    stream_summary *stream = ov_dict_get(worker->streams, (void *)key);
+
+    if (0 != stream)
+        return stream;
+
+    stream = calloc(1, sizeof(stream_summary));
+    OV_ASSERT(0 != stream);
+
+    stream->ssrc = packet->ssrc;
+    stream->payload_type = packet->payload_type;
+    stream->rtp.clock_rate_hz = configuration.summary.clock_rate_hz;
+
+    if (configuration.summary.decode) {
+
+        stream->codec = ov_codec_factory_get_codec(
+            worker->codecs, configuration.codec_name, packet->ssrc, 0);
+    }
+
+    ov_dict_set(worker->streams, (void *)key, stream, 0);
+
+    return stream;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void update_stream_summary(stream_summary *stream,
+                                  packet_ref const *packet) {
+
+    stream->bytes += packet->payload_length;
+
+    ov_rtp_source_stats_update(&stream->rtp, packet->sequence_number,
+                               packet->timestamp, packet->arrival_usecs);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void decode_packet(stream_summary *stream, packet_ref const *packet) {
+
+    uint8_t pcm[MAX_SAMPLES_PER_FRAME * sizeof(int16_t)];
+
+    if (0 == stream->codec)
+        return;
+
+    int32_t bytes = ov_codec_decode(stream->codec, packet->sequence_number,
+                                    packet->payload, packet->payload_length,
+                                    pcm, sizeof(pcm));
+
+    if (0 >= bytes) {
+        ++stream->decode_errors;
+    } else {
+        stream->decoded_samples += (uint64_t)bytes / sizeof(int16_t);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *run_stream_worker(void *arg) {
+
+    stream_worker *worker = arg;
+
+    while (true) {
+
+        sem_wait(&worker->full_sem);
+
+        packet_batch *batch = ov_spsc_queue_pop(worker->full);
+
+        /* the only post without batch marks the end of the capture */
+
+        if (0 == batch)
+            break;
+
+        for (size_t i = 0; i < batch->count; ++i) {
+
+            packet_ref const *packet = batch->packets + i;
+            stream_summary *stream = get_stream_summary(worker, packet);
+
+            update_stream_summary(stream, packet);
+            decode_packet(stream, packet);
+        }
+
+        batch->count = 0;
+
+        ov_spsc_queue_push(worker->empty, batch);
+        sem_post(&worker->empty_sem);
+    }
+
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static packet_batch *get_empty_batch(stream_worker *worker) {
+
+    packet_batch *batch = ov_spsc_queue_pop(worker->empty);
+
+    while (0 == batch) {
+
+        if (SUMMARY_BATCHES_PER_WORKER > worker->allocated) {
+
+            ++worker->allocated;
+            return calloc(1, sizeof(packet_batch));
+        }
+
+        sem_wait(&worker->empty_sem);
+        batch = ov_spsc_queue_pop(worker->empty);
+    }
+
+    return batch;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void submit_batch(stream_worker *worker) {
+
+    if ((0 == worker->current) || (0 == worker->current->count))
+        return;
+
+    /* at most SUMMARY_BATCHES_PER_WORKER batches exist - never full */
+    ov_spsc_queue_push(worker->full, worker->current);
+    sem_post(&worker->full_sem);
+
+    worker->current = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void dispatch_packet(stream_worker *workers, size_t num_workers,
+                            packet_ref const *packet) {
+
+    uint32_t hash = packet->ssrc * 0x9e3779b1;
+    stream_worker *worker = workers + (hash >> 16) % num_workers;
+
+    if (0 == worker->current) {
+        worker->current = get_empty_batch(worker);
+        OV_ASSERT(0 != worker->current);
+    }
+
+    worker->current->packets[worker->current->count++] = *packet;
+
+    if (SUMMARY_BATCH_PACKETS == worker->current->count) {
+        submit_batch(worker);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint8_t const *skip_link_layer(uint32_t link_type, uint8_t const *ptr,
+                                      size_t *length, uint16_t *ethertype) {
+
+    switch (link_type) {
+
+    case OV_FORMAT_PCAP_LINKTYPE_ETHERNET:
+
+        if (14 > *length)
+            return 0;
+
+        *ethertype = read_be16(ptr + 12);
+        ptr += 14;
+        *length -= 14;
+
+        while (((ETHERTYPE_VLAN == *ethertype) ||
+                (ETHERTYPE_QINQ == *ethertype)) &&
+               (4 <= *length)) {
+
+            *ethertype = read_be16(ptr + 2);
+            ptr += 4;
+            *length -= 4;
+        }
+
+        return ptr;
+
+    case OV_FORMAT_PCAP_LINKTYPE_LINUX_SLL:
+
+        if (16 > *length)
+            return 0;
+
+        *ethertype = read_be16(ptr + 14);
+        *length -= 16;
+
+        return ptr + 16;
+
+    default:
+
+        return 0;
+    };
+}
+
+/*----------------------------------------------------------------------------*/
+
+static uint8_t const *skip_network_layer(uint16_t ethertype,
+                                         uint8_t const *ptr, size_t *length) {
+
+    size_t header_length = 0;
+    size_t total_length = 0;
+
+    switch (ethertype) {
+
+    case ETHERTYPE_IPV4:
+
+        if ((20 > *length) || (4 != ptr[0] >> 4))
+            return 0;
+
+        header_length = 4 * (ptr[0] & 0x0f);
+        total_length = read_be16(ptr + 2);
+
+        /* fragments other than complete datagrams are not reassembled */
+
+        if ((IP_PROTOCOL_UDP != ptr[9]) || (0 != (read_be16(ptr + 6) & 0x3fff)))
+            return 0;
+
+        break;
+
+    case ETHERTYPE_IPV6:
+
+        if ((40 > *length) || (6 != ptr[0] >> 4) ||
+            (IP_PROTOCOL_UDP != ptr[6]))
+            return 0;
+
+        header_length = 40;
+        total_length = 40 + read_be16(ptr + 4);
+        break;
+
+    default:
+
+        return 0;
+    };
+
+    if ((header_length > total_length) || (total_length > *length))
+        return 0;
+
+    /* strip ethernet trailers */
+    *length = total_length - header_length;
+
+    return ptr + header_length;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool parse_packet_fast(uint32_t link_type, uint8_t const *ptr,
+                              size_t length, packet_ref *packet,
+                              capture_counters *counters) {
+
+    uint16_t ethertype = 0;
+
+    ptr = skip_link_layer(link_type, ptr, &length, &ethertype);
+
+    if (0 != ptr)
+        ptr = skip_network_layer(ethertype, ptr, &length);
+
+    if ((0 == ptr) || (8 > length) || (read_be16(ptr + 4) > length) ||
+        (8 > read_be16(ptr + 4))) {
+
+        ++counters->other;
+        return false;
+    }
+
+    length = read_be16(ptr + 4) - 8;
+    ptr += 8;
+
+    ov_rtp_view view = {0};
+
+    /* RTCP payload types 72 - 76 (RFC 5761) are no RTP */
+
+    if ((!ov_rtp_view_parse(&view, (uint8_t *)ptr, length)) ||
+        ((72 <= (ptr[1] & 0x7f)) && (76 >= (ptr[1] & 0x7f)))) {
+
+        ++counters->other;
+        return false;
+    }
+
+    if (0 != (ptr[0] & 0x20)) {
+
+        ++counters->srtp;
+        return false;
+    }
+
+    size_t payload_length = 0;
+
+    packet->payload = ov_rtp_view_payload(&view, &payload_length);
+    packet->payload_length = (uint32_t)payload_length;
+    packet->ssrc = ov_rtp_view_ssrc(&view);
+    packet->timestamp = ov_rtp_view_timestamp(&view);
+    packet->sequence_number = ov_rtp_view_sequence_number(&view);
+    packet->payload_type = ov_rtp_view_payload_type(&view);
+
+    ++counters->rtp;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void parse_capture(uint8_t const *data, size_t size,
+                          stream_worker *workers, size_t num_workers,
+                          capture_counters *counters) {
+
+    uint32_t magic = 0;
+    memcpy(&magic, data, sizeof(magic));
+
+    bool swapped = false;
+    bool nanosecs = false;
+
+    switch (magic) {
+
+    case 0xa1b2c3d4:
+        break;
+
+    case 0xa1b23c4d:
+        nanosecs = true;
+        break;
+
+    case 0xd4c3b2a1:
+        swapped = true;
+        break;
+
+    case 0x4d3cb2a1:
+        swapped = true;
+        nanosecs = true;
+        break;
+
+    default:
+        PANIC("%s is no PCAP file\n", configuration.pcap_file);
+    };
+
+    uint32_t link_type = read_u32(data + 20, swapped);
+
+    if ((OV_FORMAT_PCAP_LINKTYPE_ETHERNET != link_type) &&
+        (OV_FORMAT_PCAP_LINKTYPE_LINUX_SLL != link_type)) {
+
+        PANIC("Unsupported link type %" PRIu32 "\n", link_type);
+    }
+
+    size_t offset = PCAP_GLOBAL_HEADER_OCTETS;
+
+    while (PCAP_PACKET_HEADER_OCTETS <= size - offset) {
+
+        uint8_t const *hdr = data + offset;
+
+        uint64_t secs = read_u32(hdr, swapped);
+        uint64_t fraction = read_u32(hdr + 4, swapped);
+        size_t stored = read_u32(hdr + 8, swapped);
+
+        offset += PCAP_PACKET_HEADER_OCTETS;
+
+        if (stored > size - offset) {
+
+            ++counters->truncated;
+            break;
+        }
+
+        ++counters->packets;
+
+        packet_ref packet = {
+            .arrival_usecs =
+                secs * 1000000 + (nanosecs ? fraction / 1000 : fraction),
+        };
+
+        if (parse_packet_fast(link_type, data + offset, stored, &packet,
+                              counters)) {
+
+            dispatch_packet(workers, num_workers, &packet);
+        }
+
+        offset += stored;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+
+static bool collect_stream(const void *key, void *value, void *data) {
+
+    UNUSED(key);
+
+    stream_summary ***next = data;
+
+    **next = value;
+    ++*next;
+
+    return true;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int compare_streams(void const *a, void const *b) {
+
+    stream_summary const *sa = *(stream_summary *const *)a;
+    stream_summary const *sb = *(stream_summary *const *)b;
+
+    return (sa->ssrc > sb->ssrc) - (sa->ssrc < sb->ssrc);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void print_stream_summary(FILE *out, stream_summary const *stream) {
+
+    ov_rtp_source_stats const *rtp = &stream->rtp;
+
+    uint64_t expected = ov_rtp_source_stats_expected(rtp);
+    int64_t lost = ov_rtp_source_stats_lost(rtp);
+
+    double duration = (rtp->last_usecs - rtp->first_usecs) / 1e6;
+    double jitter_msecs = ov_rtp_source_stats_jitter_usecs(rtp) / 1000.0;
+
+    fprintf(out,
+            "%12" PRIu32 " %4" PRIu8 " %10" PRIu64 " %12" PRIu64
+            " %10.3f %8" PRIi64 " %7.3f %6" PRIu64 " %6" PRIu64 " %8.3f",
+            stream->ssrc, stream->payload_type, rtp->packets, stream->bytes,
+            duration, lost, expected ? 100.0 * lost / expected : 0.0,
+            rtp->duplicates, rtp->reordered, jitter_msecs);
+
+    if (configuration.summary.decode) {
+
+        fprintf(out, " %12" PRIu64 " %8" PRIu64, stream->decoded_samples,
+                stream->decode_errors);
+    }
+
+    fprintf(out, "\n");
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void print_summary(FILE *out, stream_worker *workers,
+                          size_t num_workers) {
+
+    size_t num_streams = 0;
+
+    for (size_t i = 0; i < num_workers; ++i) {
+        num_streams += (size_t)ov_dict_count(workers[i].streams);
+    }
+
+    stream_summary **streams = calloc(num_streams + 1, sizeof(*streams));
+    stream_summary **next = streams;
+
+    for (size_t i = 0; i < num_workers; ++i) {
+        ov_dict_for_each(workers[i].streams, &next, collect_stream);
+    }
+
+    qsort(streams, num_streams, sizeof(*streams), compare_streams);
+
+    fprintf(out,
+            "#       SSRC   PT    packets        bytes   duration     lost"
+            "   loss%%   dupl  reord jitter(ms)");
+
+    if (configuration.summary.decode) {
+        fprintf(out, "      samples  errors");
+    }
+
+    fprintf(out, "\n");
+
+    for (size_t i = 0; i < num_streams; ++i) {
+        print_stream_summary(out, streams[i]);
+    }
+
+    free(streams);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static size_t get_num_jobs() {
+
+    size_t jobs = configuration.summary.jobs;
+
+    if (0 == jobs) {
+
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = 0 < cpus ? (size_t)cpus : 1;
+    }
+
+    return jobs > SUMMARY_MAX_JOBS ? SUMMARY_MAX_JOBS : jobs;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void *free_batch(void *batch) {
+
+    free(batch);
+    return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+static int summarize_capture(char const *path) {
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    struct stat st = {0};
+
+    if ((0 > fd) || (0 != fstat(fd, &st)))
+        PANIC("Could not open %s: %s\n", path, strerror(errno));
+
+    size_t size = (size_t)st.st_size;
+
+    if (PCAP_GLOBAL_HEADER_OCTETS > size)
+        PANIC("%s is no PCAP file\n", path);
+
+    uint8_t const *data = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    close(fd);
+
+    if (MAP_FAILED == data)
+        PANIC("Could not map %s: %s\n", path, strerror(errno));
+
+    madvise((void *)data, size, MADV_SEQUENTIAL);
+
+    size_t num_workers = get_num_jobs();
+    stream_worker workers[SUMMARY_MAX_JOBS] = {0};
+
+    ov_codec_factory *codecs = 0;
+
+    if (configuration.summary.decode) {
+
+        /* the global factory is created lazily - not thread safe */
+        codecs = ov_codec_factory_create_standard();
+    }
+
+    for (size_t i = 0; i < num_workers; ++i) {
+
+        stream_worker *worker = workers + i;
+
+        worker->full = ov_spsc_queue_create(SUMMARY_BATCHES_PER_WORKER);
+        worker->empty = ov_spsc_queue_create(SUMMARY_BATCHES_PER_WORKER);
+        worker->codecs = codecs;
+
+        ov_dict_config cfg = ov_dict_intptr_key_config(1000);
+        cfg.value.data_function.free = free_stream_summary;
+
+        worker->streams = ov_dict_create(cfg);
+
+        sem_init(&worker->full_sem, 0, 0);
+        sem_init(&worker->empty_sem, 0, 0);
+
+        if ((0 == worker->full) || (0 == worker->empty) ||
+            (0 == worker->streams) ||
+            (0 != pthread_create(&worker->thread, 0, run_stream_worker,
+                                 worker))) {
+
+            PANIC("Could not start worker\n");
+        }
+    }
+
+    capture_counters counters = {0};
+
+    uint64_t start_usecs = ov_time_get_current_time_usecs();
+
+    parse_capture(data, size, workers, num_workers, &counters);
+
+    for (size_t i = 0; i < num_workers; ++i) {
+
+        submit_batch(workers + i);
+        sem_post(&workers[i].full_sem);
+    }
+
+    for (size_t i = 0; i < num_workers; ++i) {
+        pthread_join(workers[i].thread, 0);
+    }
+
+    double secs = (ov_time_get_current_time_usecs() - start_usecs) / 1e6;
+
+    print_summary(stdout, workers, num_workers);
+
+    fprintf(stdout,
+            "Analysed %" PRIu64 " packets: %" PRIu64 " RTP, %" PRIu64
+            " SRTP, %" PRIu64 " other, %" PRIu64
+            " truncated. %.1f MB in %.3f s (%.1f MB/s) with %zu threads\n",
+            counters.packets, counters.rtp, counters.srtp, counters.other,
+            counters.truncated, size / 1e6, secs,
+            secs > 0 ? size / 1e6 / secs : 0.0, num_workers);
+
+    for (size_t i = 0; i < num_workers; ++i) {
+
+        stream_worker *worker = workers + i;
+
+        worker->streams = ov_dict_free(worker->streams);
+        worker->full = ov_spsc_queue_free(worker->full, free_batch);
+        worker->empty = ov_spsc_queue_free(worker->empty, free_batch);
+
+        sem_destroy(&worker->full_sem);
+        sem_destroy(&worker->empty_sem);
+    }
+
+    if (0 != codecs) {
+        codecs = ov_codec_factory_free(codecs);
+    }
+
+    munmap((void *)data, size);
+
+    return EXIT_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+
 int main(int argc, char **argv) {
 
     ov_log_init();
@@ -813,6 +1632,14 @@ int main(int argc, char **argv) {
         usage(argv[0]);
     }
 
+    if (configuration.summary.enabled) {
+
+        int retval = summarize_capture(configuration.pcap_file);
+
+        ov_log_close();
+        return retval;
+    }
+
     if (!ov_format_registry_register_default(0)) {
 
         PANIC("Could not initialize formats");